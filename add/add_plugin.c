@@ -27,6 +27,9 @@ static const char* interface_name = "Add";
 static const char* interface_description = "Add two numbers of any type (int32/int64/float/double, positive/negative), returns double";
 static const char* interface_version = "1.0.0";
 
+/* Add通过pt_pack_*读取参数，接受版本2参数包 / Add reads its parameters through pt_pack_*, so it accepts version 2 packs / Add liest seine Parameter über pt_pack_*, daher akzeptiert es Pakete der Version 2 */
+NXLD_PLUGIN_EXPORT const uint32_t nxld_plugin_pack_version = NXLD_PACK_VERSION_2;
+
 /**
  * @brief 获取插件名称 / Get plugin name / Plugin-Namen abrufen
  * @param name 名称缓冲区 / Name buffer / Namenspuffer
@@ -255,29 +258,109 @@ static double convert_to_double(const pt_curried_param_t* param) {
     }
 }
 
+/**
+ * @brief 读取参数包中的一个参数（两种参数包布局） / Read one parameter from the pack (either pack layout) / Einen Parameter aus dem Paket lesen (beide Paketlayouts)
+ * @param pack_ptr 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
+ * @param index 参数索引 / Parameter index / Parameterindex
+ * @return 参数的类型、大小和值，索引无效时类型为UNKNOWN且值为0 / Type, size and value of the parameter, type UNKNOWN and value 0 if the index is invalid / Typ, Größe und Wert des Parameters, Typ UNKNOWN und Wert 0 bei ungültigem Index
+ */
+static pt_curried_param_t read_pack_param(const void* pack_ptr, int index) {
+    pt_curried_param_t param = { NXLD_PARAM_TYPE_UNKNOWN, 0, { 0 } };
+    const pt_param_value_u* value = pt_pack_param_value(pack_ptr, index);
+    if (value == NULL) {
+        return param;
+    }
+    param.type = pt_pack_param_type(pack_ptr, index);
+    param.size = pt_pack_param_size(pack_ptr, index);
+    param.value = *value;
+    return param;
+}
+
 /**
  * @brief 加法函数 / Addition function / Additionsfunktion
- * @param pack_ptr 参数包指针（序列化后的连续内存块）/ Parameter pack pointer (serialized contiguous memory block) / Parameterpaket-Zeiger (serialisierter zusammenhängender Speicherblock)
+ * @param pack_ptr 参数包指针（版本1或版本2布局，由pt_pack_*读取） / Parameter pack pointer (version 1 or version 2 layout, read through pt_pack_*) / Parameterpaket-Zeiger (Layout der Version 1 oder 2, gelesen über pt_pack_*)
  * @return 两个参数的和，参数无效时返回 0.0 / Sum of two parameters, returns 0.0 if parameters are invalid / Summe zweier Parameter, gibt 0.0 zurück wenn Parameter ungültig sind
- * @note 参数包已通过序列化机制传递，数据格式与 pt_param_pack_t 兼容，可直接转换使用 / Parameter pack is passed via serialization mechanism, data format is compatible with pt_param_pack_t and can be directly cast / Parameterpaket wird über Serialisierungsmechanismus übergeben, Datenformat ist mit pt_param_pack_t kompatibel und kann direkt umgewandelt werden
  */
 NXLD_PLUGIN_EXPORT double NXLD_PLUGIN_CALL Add(void* pack_ptr) {
     /* 参数验证 / Parameter validation / Parametervalidierung */
-    if (pack_ptr == NULL) {
+    if (pack_ptr == NULL || pt_pack_param_count(pack_ptr) < 2) {
         return 0.0;
     }
     
-    pt_param_pack_t* pack = (pt_param_pack_t*)pack_ptr;
+    /* 转换参数并执行加法 / Convert parameters and perform addition / Parameter konvertieren und Addition durchführen */
+    pt_curried_param_t a = read_pack_param(pack_ptr, 0);
+    pt_curried_param_t b = read_pack_param(pack_ptr, 1);
     
-    /* 验证参数包结构 / Validate parameter pack structure / Parameterpaket-Struktur validieren */
-    if (pack->param_count < 2 || pack->params == NULL) {
-        return 0.0;
+    return convert_to_double(&a) + convert_to_double(&b);
+}
+
+/**
+ * @brief 批量加法函数 / Batch addition function / Batch-Additionsfunktion
+ * @param batch 列布局的批量调用 / Batch call in column layout / Batch-Aufruf im Spaltenlayout
+ * @return 成功返回0，参数无效时返回-1 / Returns 0 on success, -1 if parameters are invalid / Gibt 0 bei Erfolg zurück, -1 wenn Parameter ungültig sind
+ * @note 每行结果与Add相同，写入results[row].double_val / Each row yields the same result as Add, written to results[row].double_val / Jede Zeile liefert dasselbe Ergebnis wie Add, geschrieben nach results[row].double_val
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL Add_Vec(const pt_batch_t* batch) {
+    if (batch == NULL || batch->param_count < 2 || batch->types == NULL || batch->sizes == NULL ||
+        batch->columns == NULL || batch->results == NULL) {
+        return -1;
     }
     
-    /* 转换参数并执行加法 / Convert parameters and perform addition / Parameter konvertieren und Addition durchführen */
-    double a = convert_to_double(&pack->params[0]);
-    double b = convert_to_double(&pack->params[1]);
+    const pt_param_value_u* column_a = batch->columns[0];
+    const pt_param_value_u* column_b = batch->columns[1];
     
-    return a + b;
+    /* 两列均为DOUBLE时直接相加 / Add directly when both columns are DOUBLE / Direkt addieren, wenn beide Spalten DOUBLE sind */
+    if (batch->types[0] == NXLD_PARAM_TYPE_DOUBLE && batch->types[1] == NXLD_PARAM_TYPE_DOUBLE) {
+        for (uint32_t row = 0; row < batch->count; row++) {
+            batch->results[row].double_val = column_a[row].double_val + column_b[row].double_val;
+        }
+        return 0;
+    }
+    
+    pt_curried_param_t a = { (nxld_param_type_t)batch->types[0], batch->sizes[0], { 0 } };
+    pt_curried_param_t b = { (nxld_param_type_t)batch->types[1], batch->sizes[1], { 0 } };
+    for (uint32_t row = 0; row < batch->count; row++) {
+        a.value = column_a[row];
+        b.value = column_b[row];
+        batch->results[row].double_val = convert_to_double(&a) + convert_to_double(&b);
+    }
+    return 0;
 }
 
+
+/* Add参数类型 / Add parameter types / Add-Parametertypen */
+static const nxld_param_type_t add_param_types[] = { NXLD_PARAM_TYPE_ANY, NXLD_PARAM_TYPE_ANY };
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "Add",
+        "Add two numbers of any type (int32/int64/float/double, positive/negative), returns double",
+        "1.0.0",
+        (void*)Add,
+        NXLD_RETURN_TYPE_DOUBLE,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        2,
+        2,
+        add_param_types
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_PACK
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ * @return 静态描述符，一次调用提供全部接口元数据 / Static descriptor providing all interface metadata in one call / Statischer Deskriptor, der alle Schnittstellen-Metadaten mit einem Aufruf liefert
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}
@@ -47,6 +47,110 @@ typedef struct {
     pt_curried_param_t* params;     /**< 参数数组 / Parameter array / Parameter-Array */
 } pt_param_pack_t;
 
+/* 版本2参数包的标识，版本1的param_count不会取到此值 / Tag of version 2 packs, a version 1 param_count never takes this value / Kennung von Paketen der Version 2, ein param_count der Version 1 nimmt diesen Wert nie an */
+#define PT_PARAM_PACK_V2_MAGIC 0x32765450u
+
+/**
+ * @brief 版本2参数包（结构数组布局，插件导出nxld_plugin_pack_version时使用） / Version 2 parameter pack (struct-of-arrays layout, used when the plugin exports nxld_plugin_pack_version) / Parameterpaket Version 2 (Struct-of-Arrays-Layout, verwendet wenn das Plugin nxld_plugin_pack_version exportiert)
+ */
+typedef struct {
+    uint32_t magic;                 /**< PT_PARAM_PACK_V2_MAGIC / PT_PARAM_PACK_V2_MAGIC / PT_PARAM_PACK_V2_MAGIC */
+    uint32_t param_count;           /**< 参数数量 / Parameter count / Parameteranzahl */
+    const pt_param_value_u* values; /**< 8字节对齐的参数值数组 / 8-byte aligned parameter value array / 8-Byte-ausgerichtetes Parameterwert-Array */
+    const size_t* sizes;            /**< 参数大小数组，所有大小都等于类型自然大小时为NULL / Parameter size array, NULL when every size is the natural size of its type / Parametergrößen-Array, NULL wenn jede Größe der natürlichen Größe ihres Typs entspricht */
+    const uint8_t* types;           /**< 参数类型数组（nxld_param_type_t） / Parameter type array (nxld_param_type_t) / Parametertyp-Array (nxld_param_type_t) */
+} pt_param_pack_v2_t;
+
+/**
+ * @brief 检查参数包是否为版本2 / Check whether a parameter pack is version 2 / Prüfen, ob ein Parameterpaket Version 2 ist
+ */
+static inline int pt_pack_is_v2(const void* pack_ptr) {
+    return pack_ptr != NULL && *(const uint32_t*)pack_ptr == PT_PARAM_PACK_V2_MAGIC;
+}
+
+/**
+ * @brief 读取参数数量（两种布局） / Read the parameter count (either layout) / Parameteranzahl lesen (beide Layouts)
+ */
+static inline int pt_pack_param_count(const void* pack_ptr) {
+    if (pack_ptr == NULL) {
+        return 0;
+    }
+    return pt_pack_is_v2(pack_ptr) ? (int)((const pt_param_pack_v2_t*)pack_ptr)->param_count
+                                   : ((const pt_param_pack_t*)pack_ptr)->param_count;
+}
+
+/**
+ * @brief 读取参数类型（两种布局） / Read a parameter type (either layout) / Parametertyp lesen (beide Layouts)
+ * @return 参数类型，索引越界时返回NXLD_PARAM_TYPE_VOID / Parameter type, NXLD_PARAM_TYPE_VOID if the index is out of range / Parametertyp, NXLD_PARAM_TYPE_VOID bei Index außerhalb des Bereichs
+ */
+static inline nxld_param_type_t pt_pack_param_type(const void* pack_ptr, int index) {
+    if (index < 0 || index >= pt_pack_param_count(pack_ptr)) {
+        return NXLD_PARAM_TYPE_VOID;
+    }
+    return pt_pack_is_v2(pack_ptr) ? (nxld_param_type_t)((const pt_param_pack_v2_t*)pack_ptr)->types[index]
+                                   : ((const pt_param_pack_t*)pack_ptr)->params[index].type;
+}
+
+/**
+ * @brief 读取参数值（两种布局） / Read a parameter value (either layout) / Parameterwert lesen (beide Layouts)
+ * @return 参数值指针，索引越界时返回NULL / Parameter value pointer, NULL if the index is out of range / Parameterwert-Zeiger, NULL bei Index außerhalb des Bereichs
+ */
+static inline const pt_param_value_u* pt_pack_param_value(const void* pack_ptr, int index) {
+    if (index < 0 || index >= pt_pack_param_count(pack_ptr)) {
+        return NULL;
+    }
+    return pt_pack_is_v2(pack_ptr) ? &((const pt_param_pack_v2_t*)pack_ptr)->values[index]
+                                   : &((const pt_param_pack_t*)pack_ptr)->params[index].value;
+}
+
+/**
+ * @brief 读取参数大小（两种布局） / Read a parameter size (either layout) / Parametergröße lesen (beide Layouts)
+ * @return 参数大小，索引越界时返回0 / Parameter size, 0 if the index is out of range / Parametergröße, 0 bei Index außerhalb des Bereichs
+ */
+static inline size_t pt_pack_param_size(const void* pack_ptr, int index) {
+    if (index < 0 || index >= pt_pack_param_count(pack_ptr)) {
+        return 0;
+    }
+    if (!pt_pack_is_v2(pack_ptr)) {
+        return ((const pt_param_pack_t*)pack_ptr)->params[index].size;
+    }
+    
+    const pt_param_pack_v2_t* pack = (const pt_param_pack_v2_t*)pack_ptr;
+    if (pack->sizes != NULL) {
+        return pack->sizes[index];
+    }
+    switch ((nxld_param_type_t)pack->types[index]) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_FLOAT:
+            return 4;
+        case NXLD_PARAM_TYPE_INT64:
+        case NXLD_PARAM_TYPE_DOUBLE:
+            return 8;
+        case NXLD_PARAM_TYPE_CHAR:
+            return 1;
+        default:
+            return sizeof(void*);
+    }
+}
+
+/* 批量接口的名称后缀 / Name suffix of batch interfaces / Namenssuffix von Batch-Schnittstellen */
+#define PT_BATCH_INTERFACE_SUFFIX "_Vec"
+
+/**
+ * @brief 批量调用（列布局） / Batch call (column layout) / Batch-Aufruf (Spaltenlayout)
+ * @details 插件可为接口导出 int32_t <Interface>_Vec(const pt_batch_t* batch)，成功时写满results并返回0；整数结果写入int64_val，FLOAT写入float_val，DOUBLE写入double_val，指针写入ptr_val / A plugin may export int32_t <Interface>_Vec(const pt_batch_t* batch) for an interface; on success it fills results and returns 0. Integer results go to int64_val, FLOAT to float_val, DOUBLE to double_val and pointers to ptr_val / Ein Plugin kann für eine Schnittstelle int32_t <Interface>_Vec(const pt_batch_t* batch) exportieren; bei Erfolg füllt es results und gibt 0 zurück. Ganzzahlergebnisse gehen nach int64_val, FLOAT nach float_val, DOUBLE nach double_val und Zeiger nach ptr_val
+ * @details 返回非0时，row_done中标记为1的行视为已执行并使用其结果，其余行逐行重新调用；不标记行的函数失败时不得有任何行已产生副作用 / On a non-zero return, rows marked 1 in row_done count as executed and their results are used, the remaining rows are called again one by one; a function that does not mark rows must not have side effects from any row when it fails / Bei einer Rückgabe ungleich 0 gelten in row_done mit 1 markierte Zeilen als ausgeführt und ihre Ergebnisse werden verwendet, die übrigen Zeilen werden einzeln erneut aufgerufen; eine Funktion, die keine Zeilen markiert, darf bei einem Fehler keine Nebenwirkungen aus irgendeiner Zeile haben
+ */
+typedef struct {
+    uint32_t count;                 /**< 行数 / Row count / Zeilenanzahl */
+    uint32_t param_count;           /**< 列数（参数数量） / Column count (parameter count) / Spaltenanzahl (Parameteranzahl) */
+    const uint8_t* types;           /**< 每列的参数类型（nxld_param_type_t） / Parameter type of each column (nxld_param_type_t) / Parametertyp jeder Spalte (nxld_param_type_t) */
+    const size_t* sizes;            /**< 每列的参数大小 / Parameter size of each column / Parametergröße jeder Spalte */
+    const pt_param_value_u* const* columns; /**< columns[param][row] / columns[param][row] / columns[param][row] */
+    pt_param_value_u* results;      /**< 输出列results[row] / Output column results[row] / Ausgabespalte results[row] */
+    uint8_t* row_done;              /**< 输出每行完成标志（调用前清零） / Output per-row completion flags (zeroed before the call) / Ausgabe der Abschlussflags je Zeile (vor dem Aufruf genullt) */
+} pt_batch_t;
+
 #ifdef __cplusplus
 }
 #endif
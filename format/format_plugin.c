@@ -239,3 +239,132 @@ NXLD_PLUGIN_EXPORT const char* NXLD_PLUGIN_CALL FormatDouble(void* pack_ptr) {
     return format_buffer;
 }
 
+/* 批量格式化缓冲区，有效期至下一次批量调用 / Batch formatting buffer, valid until the next batch call / Batch-Formatierungspuffer, gültig bis zum nächsten Batch-Aufruf */
+static char* batch_buffer = NULL;
+static size_t batch_buffer_size = 0;
+
+/**
+ * @brief 确保批量缓冲区至少有size字节 / Ensure the batch buffer has at least size bytes / Sicherstellen, dass der Batch-Puffer mindestens size Bytes hat
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int reserve_batch_buffer(size_t size) {
+    if (size <= batch_buffer_size) {
+        return 0;
+    }
+    char* grown = (char*)realloc(batch_buffer, size);
+    if (grown == NULL) {
+        return -1;
+    }
+    batch_buffer = grown;
+    batch_buffer_size = size;
+    return 0;
+}
+
+/**
+ * @brief 将单列批量调用格式化为字符串 / Format a single-column batch call as strings / Einspaltigen Batch-Aufruf als Zeichenfolgen formatieren
+ * @param batch 批量调用 / Batch call / Batch-Aufruf
+ * @param as_int32 按int32格式化，否则按double / Format as int32, otherwise as double / Als int32 formatieren, sonst als double
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @note 先计算总长度再写入，缓冲区增长不会使已写入的指针失效 / Measures the total length before writing so growing the buffer never invalidates written pointers / Misst die Gesamtlänge vor dem Schreiben, damit das Wachsen des Puffers keine geschriebenen Zeiger ungültig macht
+ */
+static int32_t format_batch(const pt_batch_t* batch, int as_int32) {
+    if (batch == NULL || batch->param_count < 1 || batch->types == NULL || batch->sizes == NULL ||
+        batch->columns == NULL || batch->results == NULL) {
+        return -1;
+    }
+    
+    pt_curried_param_t param = { (nxld_param_type_t)batch->types[0], batch->sizes[0], { 0 } };
+    size_t total = 0;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        param.value = batch->columns[0][row];
+        int length = as_int32 ? snprintf(NULL, 0, "%d", (int32_t)convert_to_double(&param))
+                              : snprintf(NULL, 0, "%.6f", convert_to_double(&param));
+        if (length < 0) {
+            return -1;
+        }
+        total += (size_t)length + 1;
+    }
+    if (reserve_batch_buffer(total) != 0) {
+        return -1;
+    }
+    
+    char* text = batch_buffer;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        param.value = batch->columns[0][row];
+        size_t remaining = total - (size_t)(text - batch_buffer);
+        int length = as_int32 ? snprintf(text, remaining, "%d", (int32_t)convert_to_double(&param))
+                              : snprintf(text, remaining, "%.6f", convert_to_double(&param));
+        batch->results[row].ptr_val = text;
+        text += length + 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 批量格式化 int32 / Format int32 values in batch / int32-Werte im Stapel formatieren
+ * @param batch 批量调用，字符串指针写入ptr_val / Batch call, string pointers are written to ptr_val / Batch-Aufruf, Zeichenfolgenzeiger werden nach ptr_val geschrieben
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL FormatInt32_Vec(const pt_batch_t* batch) {
+    return format_batch(batch, 1);
+}
+
+/**
+ * @brief 批量格式化 double / Format double values in batch / double-Werte im Stapel formatieren
+ * @param batch 批量调用，字符串指针写入ptr_val / Batch call, string pointers are written to ptr_val / Batch-Aufruf, Zeichenfolgenzeiger werden nach ptr_val geschrieben
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL FormatDouble_Vec(const pt_batch_t* batch) {
+    return format_batch(batch, 0);
+}
+
+
+/* 格式化接口参数类型 / Format interface parameter types / Parametertypen der Formatierungsschnittstellen */
+static const nxld_param_type_t format_int32_param_types[] = { NXLD_PARAM_TYPE_INT32 };
+static const nxld_param_type_t format_double_param_types[] = { NXLD_PARAM_TYPE_DOUBLE };
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "FormatInt32",
+        "Format int32 as string (value: int32), returns string pointer",
+        "1.0.0",
+        (void*)FormatInt32,
+        NXLD_RETURN_TYPE_STRING,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        1,
+        1,
+        format_int32_param_types
+    },
+    {
+        "FormatDouble",
+        "Format double as string (value: double), returns string pointer",
+        "1.0.0",
+        (void*)FormatDouble,
+        NXLD_RETURN_TYPE_STRING,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        1,
+        1,
+        format_double_param_types
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_PACK
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ * @return 静态描述符，一次调用提供全部接口元数据 / Static descriptor providing all interface metadata in one call / Statischer Deskriptor, der alle Schnittstellen-Metadaten mit einem Aufruf liefert
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}
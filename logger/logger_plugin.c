@@ -319,3 +319,40 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL WriteLog(void* pack_ptr) {
     return 0;
 }
 
+
+/* WriteLog参数类型（message, file_path） / WriteLog parameter types (message, file_path) / WriteLog-Parametertypen (message, file_path) */
+static const nxld_param_type_t write_log_param_types[] = { NXLD_PARAM_TYPE_STRING, NXLD_PARAM_TYPE_STRING };
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "WriteLog",
+        "Write log message to file (message: string, file_path: optional string), returns int32 (0=success, -1=failure)",
+        "1.0.0",
+        (void*)WriteLog,
+        NXLD_RETURN_TYPE_INT32,
+        0,
+        NXLD_PARAM_COUNT_VARIABLE,
+        1,
+        2,
+        write_log_param_types
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_PACK
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ * @return 静态描述符，一次调用提供全部接口元数据 / Static descriptor providing all interface metadata in one call / Statischer Deskriptor, der alle Schnittstellen-Metadaten mit einem Aufruf liefert
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}
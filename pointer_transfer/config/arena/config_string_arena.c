@@ -0,0 +1,163 @@
+/**
+ * @file config_string_arena.c
+ * @brief 配置字符串去重内存区 / Deduplicating Configuration String Arena / Deduplizierende Konfigurations-Zeichenfolgen-Arena
+ */
+
+#include "config_string_arena.h"
+#include "pointer_transfer_context.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 初始去重表槽位数量 / Initial deduplication table slot count / Anfängliche Slot-Anzahl der Deduplizierungstabelle */
+#define CONFIG_STRING_ARENA_INITIAL_SLOTS 64
+
+/**
+ * @brief FNV-1a字符串哈希 / FNV-1a string hash / FNV-1a-Zeichenfolgen-Hash
+ */
+static uint32_t hash_config_string(const char* data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief 创建字符串内存区 / Create string arena / Zeichenfolgen-Arena erstellen
+ */
+config_string_arena_t* create_config_string_arena(void) {
+    config_string_arena_t* arena = (config_string_arena_t*)calloc(1, sizeof(config_string_arena_t));
+    if (arena == NULL) {
+        return NULL;
+    }
+    
+    arena->slots = (config_string_slot_t*)calloc(CONFIG_STRING_ARENA_INITIAL_SLOTS, sizeof(config_string_slot_t));
+    if (arena->slots == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena->slot_capacity = CONFIG_STRING_ARENA_INITIAL_SLOTS;
+    return arena;
+}
+
+/**
+ * @brief 扩展去重表（负载超过3/4时） / Grow deduplication table (when load exceeds 3/4) / Deduplizierungstabelle erweitern (bei Auslastung über 3/4)
+ */
+static int grow_config_string_slots(config_string_arena_t* arena) {
+    if (arena->slot_capacity > SIZE_MAX / CAPACITY_GROWTH_FACTOR / sizeof(config_string_slot_t)) {
+        return -1;
+    }
+    size_t new_capacity = arena->slot_capacity * CAPACITY_GROWTH_FACTOR;
+    config_string_slot_t* new_slots = (config_string_slot_t*)calloc(new_capacity, sizeof(config_string_slot_t));
+    if (new_slots == NULL) {
+        return -1;
+    }
+    
+    for (size_t i = 0; i < arena->slot_capacity; i++) {
+        const config_string_slot_t* slot = &arena->slots[i];
+        if (slot->str == NULL) {
+            continue;
+        }
+        size_t pos = slot->hash & (new_capacity - 1);
+        while (new_slots[pos].str != NULL) {
+            pos = (pos + 1) & (new_capacity - 1);
+        }
+        new_slots[pos] = *slot;
+    }
+    free(arena->slots);
+    arena->slots = new_slots;
+    arena->slot_capacity = new_capacity;
+    return 0;
+}
+
+/**
+ * @brief 从内存块分配字节 / Allocate bytes from a chunk / Bytes aus einem Block zuweisen
+ */
+static char* allocate_config_string_bytes(config_string_arena_t* arena, size_t size) {
+    config_string_chunk_t* chunk = arena->chunks;
+    if (chunk == NULL || chunk->size - chunk->used < size) {
+        /* 超长字符串单独成块 / Oversized strings get a chunk of their own / Überlange Zeichenfolgen erhalten einen eigenen Block */
+        size_t chunk_size = size > CONFIG_STRING_ARENA_CHUNK_SIZE ? size : CONFIG_STRING_ARENA_CHUNK_SIZE;
+        if (chunk_size > SIZE_MAX - sizeof(config_string_chunk_t)) {
+            return NULL;
+        }
+        chunk = (config_string_chunk_t*)malloc(sizeof(config_string_chunk_t) + chunk_size);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        chunk->next = arena->chunks;
+        chunk->used = 0;
+        chunk->size = chunk_size;
+        arena->chunks = chunk;
+    }
+    
+    char* result = (char*)(chunk + 1) + chunk->used;
+    chunk->used += size;
+    return result;
+}
+
+/**
+ * @brief 驻留字符串 / Intern string / Zeichenfolge internieren
+ */
+char* intern_config_string(config_string_arena_t* arena, const char* data, size_t length) {
+    if (arena == NULL || (data == NULL && length > 0) || length == SIZE_MAX) {
+        return NULL;
+    }
+    
+    arena->request_count++;
+    
+    /* 扩展失败时表仍然可用，只是更拥挤 / If growing fails the table still works, only more crowded / Schlägt die Erweiterung fehl, funktioniert die Tabelle weiter, nur voller */
+    if ((arena->unique_count + 1) * 4 > arena->slot_capacity * 3) {
+        grow_config_string_slots(arena);
+    }
+    
+    uint32_t hash = hash_config_string(data, length);
+    size_t pos = hash & (arena->slot_capacity - 1);
+    while (arena->slots[pos].str != NULL) {
+        const config_string_slot_t* slot = &arena->slots[pos];
+        if (slot->hash == hash && slot->length == length && (length == 0 || memcmp(slot->str, data, length) == 0)) {
+            return (char*)slot->str;
+        }
+        pos = (pos + 1) & (arena->slot_capacity - 1);
+    }
+    
+    char* str = allocate_config_string_bytes(arena, length + 1);
+    if (str == NULL) {
+        return NULL;
+    }
+    if (length > 0) {
+        memcpy(str, data, length);
+    }
+    str[length] = '\0';
+    arena->bytes_used += length + 1;
+    
+    /* 保留至少一个空槽使探测终止 / Keep at least one empty slot so probing terminates / Mindestens einen leeren Slot behalten, damit die Sondierung endet */
+    if (arena->unique_count + 1 < arena->slot_capacity) {
+        arena->slots[pos].str = str;
+        arena->slots[pos].length = length;
+        arena->slots[pos].hash = hash;
+        arena->unique_count++;
+    }
+    return str;
+}
+
+/**
+ * @brief 销毁字符串内存区 / Destroy string arena / Zeichenfolgen-Arena zerstören
+ */
+void destroy_config_string_arena(config_string_arena_t* arena) {
+    if (arena == NULL) {
+        return;
+    }
+    
+    config_string_chunk_t* chunk = arena->chunks;
+    while (chunk != NULL) {
+        config_string_chunk_t* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    if (arena->slots != NULL) {
+        free(arena->slots);
+    }
+    free(arena);
+}
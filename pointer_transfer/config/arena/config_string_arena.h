@@ -0,0 +1,82 @@
+/**
+ * @file config_string_arena.h
+ * @brief 配置字符串去重内存区接口 / Deduplicating Configuration String Arena Interface / Schnittstelle der deduplizierenden Konfigurations-Zeichenfolgen-Arena
+ */
+
+#ifndef CONFIG_STRING_ARENA_H
+#define CONFIG_STRING_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/* 默认内存块大小 / Default chunk size / Standard-Blockgröße */
+#define CONFIG_STRING_ARENA_CHUNK_SIZE 16384
+    
+/**
+ * @brief 内存块（字符串紧随其后） / Memory chunk (strings follow it) / Speicherblock (Zeichenfolgen folgen ihm)
+ */
+typedef struct config_string_chunk_s {
+    struct config_string_chunk_s* next; /**< 前一个内存块 / Previous chunk / Vorheriger Block */
+    size_t used;                   /**< 已用字节 / Bytes used / Belegte Bytes */
+    size_t size;                   /**< 数据区大小 / Data area size / Größe des Datenbereichs */
+} config_string_chunk_t;
+    
+/**
+ * @brief 去重表槽位 / Deduplication table slot / Slot der Deduplizierungstabelle
+ */
+typedef struct {
+    const char* str;               /**< 内存区中的字符串（空槽为NULL） / String in the arena (NULL for empty slots) / Zeichenfolge in der Arena (NULL für leere Slots) */
+    size_t length;                 /**< 字符串长度 / String length / Zeichenfolgenlänge */
+    uint32_t hash;                 /**< 字符串哈希 / String hash / Zeichenfolgen-Hash */
+} config_string_slot_t;
+    
+/**
+ * @brief 单次加载的字符串内存区 / String arena of a single load / Zeichenfolgen-Arena eines einzelnen Ladevorgangs
+ * @details 相同内容只存一份，整个内存区一次释放 / Equal contents are stored once, the whole arena is released at once / Gleiche Inhalte werden einmal gespeichert, die ganze Arena wird auf einmal freigegeben
+ */
+typedef struct {
+    config_string_chunk_t* chunks; /**< 内存块链表（最新在前） / Chunk list (newest first) / Blockliste (neueste zuerst) */
+    config_string_slot_t* slots;   /**< 开放寻址去重表 / Open addressing deduplication table / Deduplizierungstabelle mit offener Adressierung */
+    size_t slot_capacity;          /**< 槽位数量（2的幂） / Slot count (power of two) / Slot-Anzahl (Zweierpotenz) */
+    size_t unique_count;           /**< 不同字符串数量 / Distinct string count / Anzahl verschiedener Zeichenfolgen */
+    size_t request_count;          /**< 请求次数 / Request count / Anzahl der Anforderungen */
+    size_t bytes_used;             /**< 字符串占用字节 / Bytes taken by strings / Von Zeichenfolgen belegte Bytes */
+} config_string_arena_t;
+    
+/**
+ * @brief 创建字符串内存区 / Create string arena / Zeichenfolgen-Arena erstellen
+ * @return 内存区，失败返回NULL / Arena, NULL on failure / Arena, NULL bei Fehler
+ */
+config_string_arena_t* create_config_string_arena(void);
+    
+/**
+ * @brief 驻留字符串，相同内容返回同一指针 / Intern string, equal contents return the same pointer / Zeichenfolge internieren, gleiche Inhalte liefern denselben Zeiger
+ * @param arena 内存区 / Arena / Arena
+ * @param data 字符串数据（不要求NUL结尾） / String data (need not be NUL-terminated) / Zeichenfolgendaten (müssen nicht NUL-terminiert sein)
+ * @param length 字符串长度 / String length / Zeichenfolgenlänge
+ * @return 以NUL结尾的驻留字符串（随内存区释放），失败返回NULL / NUL-terminated interned string (released with the arena), NULL on failure / NUL-terminierte internierte Zeichenfolge (mit der Arena freigegeben), NULL bei Fehler
+ */
+char* intern_config_string(config_string_arena_t* arena, const char* data, size_t length);
+    
+/**
+ * @brief 销毁字符串内存区 / Destroy string arena / Zeichenfolgen-Arena zerstören
+ * @param arena 内存区（可为NULL） / Arena (may be NULL) / Arena (kann NULL sein)
+ */
+void destroy_config_string_arena(config_string_arena_t* arena);
+    
+/**
+ * @brief 保留内存区直到规则释放（所有权转给上下文） / Keep arena until rules are released (ownership moves to the context) / Arena bis zur Regelfreigabe behalten (Besitz geht an den Kontext)
+ * @param arena 内存区 / Arena / Arena
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int retain_config_string_arena(config_string_arena_t* arena);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_STRING_ARENA_H */
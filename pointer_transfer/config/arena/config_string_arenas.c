@@ -0,0 +1,62 @@
+/**
+ * @file config_string_arenas.c
+ * @brief 上下文字符串内存区管理 / Context String Arena Management / Verwaltung der Kontext-Zeichenfolgen-Arenen
+ */
+
+#include "config_string_arena.h"
+#include "../common/config_errors.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+/**
+ * @brief 保留内存区直到规则释放 / Keep arena until rules are released / Arena bis zur Regelfreigabe behalten
+ */
+int retain_config_string_arena(config_string_arena_t* arena) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || arena == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    if (ctx->string_arena_count >= ctx->string_arena_capacity) {
+        size_t new_capacity = ctx->string_arena_capacity == 0 ? 4 : ctx->string_arena_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity > SIZE_MAX / sizeof(void*)) {
+            internal_log_write("ERROR", "retain_config_string_arena: capacity overflow detected");
+            return CONFIG_ERR_OVERFLOW;
+        }
+        void** new_arenas = (void**)realloc(ctx->string_arenas, new_capacity * sizeof(void*));
+        if (new_arenas == NULL) {
+            internal_log_write("ERROR", "retain_config_string_arena: failed to expand arena array");
+            return CONFIG_ERR_MEMORY;
+        }
+        ctx->string_arenas = new_arenas;
+        ctx->string_arena_capacity = new_capacity;
+    }
+    
+    ctx->string_arenas[ctx->string_arena_count++] = arena;
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 释放所有字符串内存区 / Release all string arenas / Alle Zeichenfolgen-Arenen freigeben
+ * @details 必须在引用内存区的规则释放之后调用 / Must be called after the rules referencing the arenas are freed / Muss nach der Freigabe der Regeln aufgerufen werden, die auf die Arenen verweisen
+ */
+void release_config_string_arenas(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < ctx->string_arena_count; i++) {
+        destroy_config_string_arena((config_string_arena_t*)ctx->string_arenas[i]);
+    }
+    if (ctx->string_arenas != NULL) {
+        free(ctx->string_arenas);
+    }
+    ctx->string_arenas = NULL;
+    ctx->string_arena_count = 0;
+    ctx->string_arena_capacity = 0;
+}
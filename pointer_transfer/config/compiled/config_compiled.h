@@ -0,0 +1,163 @@
+/**
+ * @file config_compiled.h
+ * @brief 编译规则缓存（.nxptc）接口 / Compiled Rules Cache (.nxptc) Interface / Schnittstelle des kompilierten Regel-Caches (.nxptc)
+ */
+
+#ifndef CONFIG_COMPILED_H
+#define CONFIG_COMPILED_H
+
+#include "pointer_transfer_types.h"
+#include "../rules/config_rules_parsed.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/* .nxptc文件格式常量 / .nxptc file format constants / .nxptc-Dateiformatkonstanten */
+#define COMPILED_RULES_MAGIC 0x4354504EU      /* "NPTC" 小端 / little-endian / Little-Endian */
+#define COMPILED_RULES_VERSION 3U
+#define COMPILED_RULES_SUFFIX "c"               /* .nxpt -> .nxptc */
+#define COMPILED_RULES_STRING_FIELDS 10
+#define COMPILED_RULES_NO_STRING 0xFFFFFFFFU
+    
+/**
+ * @brief 源文件标识（大小、修改时间、内容哈希） / Source file stamp (size, mtime, content hash) / Quelldatei-Stempel (Größe, Änderungszeit, Inhalts-Hash)
+ */
+typedef struct {
+    uint64_t size;                 /**< 源文件大小 / Source file size / Quelldateigröße */
+    int64_t mtime;                 /**< 源文件修改时间 / Source file modification time / Quelldatei-Änderungszeit */
+    uint64_t hash;                 /**< 源文件内容FNV-1a哈希 / Source content FNV-1a hash / FNV-1a-Hash des Quellinhalts */
+} compiled_source_stamp_t;
+    
+/**
+ * @brief .nxptc文件头 / .nxptc file header / .nxptc-Dateikopf
+ * @details 布局：文件头、规则记录、预计算索引键、入口键值、字符串池；偏移量均为8字节对齐 / Layout: header, rule records, precomputed index keys, entry key-values, string pool; offsets are 8-byte aligned / Aufbau: Kopf, Regeldatensätze, vorberechnete Indexschlüssel, Einstiegs-Schlüssel-Werte, Zeichenfolgenpool; Offsets sind 8-Byte-ausgerichtet
+ */
+typedef struct {
+    uint32_t magic;                /**< 魔数 / Magic number / Magische Zahl */
+    uint32_t version;              /**< 格式版本 / Format version / Formatversion */
+    uint32_t header_size;          /**< 文件头大小 / Header size / Kopfgröße */
+    uint32_t record_size;          /**< 规则记录大小 / Rule record size / Regeldatensatzgröße */
+    compiled_source_stamp_t source; /**< 源文件标识 / Source file stamp / Quelldatei-Stempel */
+    uint64_t file_size;            /**< 整个文件大小（检测截断） / Whole file size (detects truncation) / Gesamte Dateigröße (erkennt Abschneiden) */
+    uint64_t rule_count;           /**< 规则数量 / Rule count / Regelanzahl */
+    uint64_t line_count;           /**< 源文件行数 / Source line count / Zeilenanzahl der Quelle */
+    uint64_t rules_offset;         /**< 规则记录偏移 / Rule records offset / Offset der Regeldatensätze */
+    uint64_t keys_offset;          /**< 索引键偏移 / Index keys offset / Offset der Indexschlüssel */
+    uint64_t entry_count;          /**< 入口键值数量 / Entry key-value count / Anzahl der Einstiegs-Schlüssel-Werte */
+    uint64_t entries_offset;       /**< 入口键值偏移 / Entry key-values offset / Offset der Einstiegs-Schlüssel-Werte */
+    uint64_t pool_offset;          /**< 字符串池偏移 / String pool offset / Offset des Zeichenfolgenpools */
+    uint64_t pool_size;            /**< 字符串池大小 / String pool size / Größe des Zeichenfolgenpools */
+    int32_t max_seen_index;        /**< 最大段索引 / Maximum section index / Maximaler Abschnittsindex */
+    int32_t disable_info_log;      /**< DisableInfoLog（-1=未设置） / DisableInfoLog (-1=not set) / DisableInfoLog (-1=nicht gesetzt) */
+    int32_t enable_validation;     /**< EnableValidation（-1=未设置） / EnableValidation (-1=not set) / EnableValidation (-1=nicht gesetzt) */
+    int32_t reserved;              /**< 保留 / Reserved / Reserviert */
+} compiled_rules_header_t;
+    
+/**
+ * @brief .nxptc规则记录 / .nxptc rule record / .nxptc-Regeldatensatz
+ */
+typedef struct {
+    uint32_t strings[COMPILED_RULES_STRING_FIELDS]; /**< 字符串池偏移（COMPILED_RULES_NO_STRING=NULL） / String pool offsets (COMPILED_RULES_NO_STRING=NULL) / Zeichenfolgenpool-Offsets (COMPILED_RULES_NO_STRING=NULL) */
+    int32_t source_param_index;    /**< 源参数索引 / Source parameter index / Quell-Parameterindex */
+    int32_t target_param_index;    /**< 目标参数索引 / Target parameter index / Ziel-Parameterindex */
+    int32_t transfer_mode;         /**< 传递模式 / Transfer mode / Übertragungsmodus */
+    int32_t enabled;               /**< 启用标志 / Enabled flag / Aktivierungsflag */
+    int32_t cache_self;            /**< 缓存自身规则标志 / Cache self rule flag / Selbst-Regel-Cache-Flag */
+    int32_t ownership;             /**< 目标参数所有权（原保留字段，版本3起使用） / Target parameter ownership (formerly reserved, used since version 3) / Besitz des Zielparameters (früher reserviert, seit Version 3 verwendet) */
+} compiled_rule_record_t;
+    
+/**
+ * @brief .nxptc入口键值记录 / .nxptc entry key-value record / .nxptc-Einstiegs-Schlüssel-Wert-Datensatz
+ */
+typedef struct {
+    uint32_t key_id;               /**< 键标识（config_key_id_t） / Key identifier (config_key_id_t) / Schlüsselkennung (config_key_id_t) */
+    uint32_t value;                /**< 值的字符串池偏移 / String pool offset of the value / Zeichenfolgenpool-Offset des Werts */
+    uint32_t line_number;          /**< 源文件行号 / Source line number / Zeilennummer der Quelle */
+    uint32_t reserved;             /**< 保留 / Reserved / Reserviert */
+} compiled_entry_record_t;
+    
+/**
+ * @brief 计算源文件标识 / Compute source file stamp / Quelldatei-Stempel berechnen
+ * @param config_path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @param stamp_out 输出标识 / Output stamp / Ausgabe-Stempel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int compute_rule_source_stamp(const char* config_path, compiled_source_stamp_t* stamp_out);
+    
+/**
+ * @brief 构建.nxptc路径 / Build .nxptc path / .nxptc-Pfad erstellen
+ * @param config_path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @return 新分配的路径（调用者释放），失败返回NULL / Newly allocated path (caller frees), NULL on failure / Neu zugewiesener Pfad (Aufrufer gibt frei), NULL bei Fehler
+ */
+char* build_compiled_rules_path(const char* config_path);
+    
+/**
+ * @brief 获取规则字符串字段 / Get rule string field / Regel-Zeichenfolgenfeld abrufen
+ * @param rule 规则 / Rule / Regel
+ * @param field 字段序号（0..COMPILED_RULES_STRING_FIELDS-1） / Field number (0..COMPILED_RULES_STRING_FIELDS-1) / Feldnummer (0..COMPILED_RULES_STRING_FIELDS-1)
+ * @return 字段指针的地址 / Address of the field pointer / Adresse des Feldzeigers
+ */
+char** get_rule_string_field(pointer_transfer_rule_t* rule, size_t field);
+    
+/**
+ * @brief 写入.nxptc文件 / Write .nxptc file / .nxptc-Datei schreiben
+ * @param config_path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @param stamp 解析前计算的源文件标识 / Source stamp computed before parsing / Vor dem Parsen berechneter Quellstempel
+ * @param parsed 源文件的单次扫描结果 / Single pass result of the source / Ergebnis des Einzeldurchlaufs der Quelle
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int write_compiled_rules(const char* config_path, const compiled_source_stamp_t* stamp, const parsed_rules_file_t* parsed);
+    
+/**
+ * @brief 已映射并校验的.nxptc文件 / Mapped and validated .nxptc file / Zugeordnete und validierte .nxptc-Datei
+ */
+typedef struct {
+    void* map;                     /**< 文件映射 / File mapping / Dateizuordnung */
+    const unsigned char* data;     /**< 映射数据 / Mapped data / Zugeordnete Daten */
+    compiled_rules_header_t header; /**< 文件头副本 / Header copy / Kopie des Dateikopfs */
+    char* compiled_path;           /**< .nxptc路径 / .nxptc path / .nxptc-Pfad */
+} compiled_rules_view_t;
+    
+/**
+ * @brief 映射并校验.nxptc文件，不修改上下文（可在工作线程调用） / Map and validate .nxptc file without touching the context (callable from worker threads) / .nxptc-Datei zuordnen und validieren, ohne den Kontext zu ändern (aus Arbeitsthreads aufrufbar)
+ * @param config_path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @param stamp 当前源文件标识 / Current source stamp / Aktueller Quellstempel
+ * @param view_out 输出视图（通过install_compiled_rules或close_compiled_rules释放） / Output view (released by install_compiled_rules or close_compiled_rules) / Ausgabeansicht (freigegeben durch install_compiled_rules oder close_compiled_rules)
+ * @return 成功返回0，文件缺失、过期或无效返回非0 / Returns 0 on success, non-zero if the file is missing, stale or invalid / Gibt 0 bei Erfolg zurück, ungleich 0 wenn die Datei fehlt, veraltet oder ungültig ist
+ */
+int open_compiled_rules(const char* config_path, const compiled_source_stamp_t* stamp, compiled_rules_view_t* view_out);
+    
+/**
+ * @brief 将已校验的.nxptc视图安装到上下文 / Install a validated .nxptc view into context / Validierte .nxptc-Ansicht in den Kontext installieren
+ * @details 规则字符串直接指向映射的字符串池，并应用文件中记录的入口设置；视图总是被消耗 / Rule strings point straight into the mapped string pool and the recorded entry settings are applied; the view is always consumed / Regel-Zeichenfolgen zeigen direkt in den zugeordneten Pool und die gespeicherten Einstiegseinstellungen werden angewendet; die Ansicht wird immer verbraucht
+ * @param config_path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @param view open_compiled_rules得到的视图 / View from open_compiled_rules / Ansicht aus open_compiled_rules
+ * @param rule_count_out 输出加载的规则数量 / Output loaded rule count / Ausgabe geladene Regelanzahl
+ * @param line_count_out 输出源文件行数 / Output source line count / Ausgabe Zeilenanzahl der Quelle
+ * @param entry_result_out 非NULL时应用记录的[EntryPlugin]段并输出结果 / When non-NULL, applies the recorded [EntryPlugin] section and outputs the result / Wenn nicht NULL, wird der gespeicherte [EntryPlugin]-Abschnitt angewendet und das Ergebnis ausgegeben
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int install_compiled_rules(const char* config_path, compiled_rules_view_t* view,
+                           size_t* rule_count_out, size_t* line_count_out, int* entry_result_out);
+    
+/**
+ * @brief 关闭未安装的.nxptc视图 / Close an uninstalled .nxptc view / Nicht installierte .nxptc-Ansicht schließen
+ * @param view 视图 / View / Ansicht
+ */
+void close_compiled_rules(compiled_rules_view_t* view);
+    
+/**
+ * @brief 保留.nxptc映射直到规则释放 / Keep .nxptc mapping until rules are released / .nxptc-Zuordnung bis zur Regelfreigabe behalten
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int retain_compiled_rule_map(void* map);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_COMPILED_H */
@@ -0,0 +1,92 @@
+/**
+ * @file config_compiled_common.c
+ * @brief 编译规则缓存公共函数 / Compiled Rules Cache Common Functions / Gemeinsame Funktionen des kompilierten Regel-Caches
+ */
+
+#include "config_compiled.h"
+#include "../common/config_errors.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 计算源文件标识 / Compute source file stamp / Quelldatei-Stempel berechnen
+ */
+int compute_rule_source_stamp(const char* config_path, compiled_source_stamp_t* stamp_out) {
+    if (config_path == NULL || stamp_out == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    memset(stamp_out, 0, sizeof(compiled_source_stamp_t));
+    if (pt_platform_get_file_timestamp(config_path, &stamp_out->mtime) != 0) {
+        return CONFIG_ERR_FILE_OPEN;
+    }
+    
+    pt_platform_file_map_t* map = pt_platform_file_map_open(config_path);
+    if (map == NULL) {
+        return CONFIG_ERR_FILE_OPEN;
+    }
+    
+    /* FNV-1a内容哈希，捕获大小和时间戳相同的修改 / FNV-1a content hash catches edits with equal size and timestamp / FNV-1a-Inhalts-Hash erkennt Änderungen mit gleicher Größe und gleichem Zeitstempel */
+    const unsigned char* data = (const unsigned char*)pt_platform_file_map_data(map);
+    size_t size = pt_platform_file_map_size(map);
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint64_t)data[i];
+        hash *= 1099511628211ULL;
+    }
+    pt_platform_file_map_close(map);
+    
+    stamp_out->size = (uint64_t)size;
+    stamp_out->hash = hash;
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 构建.nxptc路径 / Build .nxptc path / .nxptc-Pfad erstellen
+ */
+char* build_compiled_rules_path(const char* config_path) {
+    if (config_path == NULL) {
+        return NULL;
+    }
+    
+    size_t path_len = strlen(config_path);
+    size_t suffix_len = strlen(COMPILED_RULES_SUFFIX);
+    if (path_len > SIZE_MAX - suffix_len - 1) {
+        return NULL;
+    }
+    
+    char* compiled_path = (char*)malloc(path_len + suffix_len + 1);
+    if (compiled_path == NULL) {
+        return NULL;
+    }
+    memcpy(compiled_path, config_path, path_len);
+    memcpy(compiled_path + path_len, COMPILED_RULES_SUFFIX, suffix_len + 1);
+    return compiled_path;
+}
+
+/**
+ * @brief 获取规则字符串字段 / Get rule string field / Regel-Zeichenfolgenfeld abrufen
+ * @details 字段顺序即.nxptc记录中的顺序，修改会使旧文件失效（需提升版本号） / The field order is the order in .nxptc records, changing it invalidates old files (bump the version) / Die Feldreihenfolge entspricht der in .nxptc-Datensätzen; Änderungen machen alte Dateien ungültig (Version erhöhen)
+ */
+char** get_rule_string_field(pointer_transfer_rule_t* rule, size_t field) {
+    if (rule == NULL) {
+        return NULL;
+    }
+    
+    switch (field) {
+        case 0: return &rule->source_plugin;
+        case 1: return &rule->source_interface;
+        case 2: return &rule->target_plugin;
+        case 3: return &rule->target_plugin_path;
+        case 4: return &rule->target_interface;
+        case 5: return &rule->target_param_value;
+        case 6: return &rule->description;
+        case 7: return &rule->multicast_group;
+        case 8: return &rule->condition;
+        case 9: return &rule->set_group;
+        default: return NULL;
+    }
+}
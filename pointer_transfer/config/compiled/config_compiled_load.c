@@ -0,0 +1,249 @@
+/**
+ * @file config_compiled_load.c
+ * @brief 编译规则缓存加载 / Compiled Rules Cache Loader / Lader des kompilierten Regel-Caches
+ */
+
+#include "config_compiled.h"
+#include "../common/config_errors.h"
+#include "../rules/config_rules_merger.h"
+#include "../entry/config_entry_parser.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 校验.nxptc文件头和记录 / Validate .nxptc header and records / .nxptc-Kopf und Datensätze validieren
+ * @return 有效返回0，否则返回-1 / Returns 0 if valid, -1 otherwise / Gibt 0 zurück wenn gültig, sonst -1
+ */
+static int validate_compiled_rules(const unsigned char* data, size_t size, const compiled_rules_header_t* header) {
+    if (header->magic != COMPILED_RULES_MAGIC || header->version != COMPILED_RULES_VERSION ||
+        header->header_size != sizeof(compiled_rules_header_t) || header->record_size != sizeof(compiled_rule_record_t)) {
+        return -1;
+    }
+    if (header->file_size != (uint64_t)size) {
+        return -1;
+    }
+    
+    /* 各段必须首尾相接且在文件内 / Sections must be contiguous and inside the file / Abschnitte müssen zusammenhängend und innerhalb der Datei liegen */
+    uint64_t rule_count = header->rule_count;
+    uint64_t entry_count = header->entry_count;
+    if (rule_count > (uint64_t)size / (sizeof(compiled_rule_record_t) + sizeof(uint64_t)) ||
+        entry_count > (uint64_t)size / sizeof(compiled_entry_record_t)) {
+        return -1;
+    }
+    if (header->rules_offset != sizeof(compiled_rules_header_t) ||
+        header->keys_offset != header->rules_offset + rule_count * sizeof(compiled_rule_record_t) ||
+        header->entries_offset != header->keys_offset + rule_count * sizeof(uint64_t) ||
+        header->pool_offset != header->entries_offset + entry_count * sizeof(compiled_entry_record_t) ||
+        header->pool_offset > (uint64_t)size ||
+        header->pool_size > (uint64_t)size - header->pool_offset) {
+        return -1;
+    }
+    
+    /* 池以NUL结尾，所有偏移在池内即可保证字符串终止 / The pool ends with NUL, so in-pool offsets guarantee termination / Der Pool endet mit NUL, daher garantieren Offsets im Pool die Terminierung */
+    const char* pool = (const char*)(data + header->pool_offset);
+    if (header->pool_size > 0 && pool[header->pool_size - 1] != '\0') {
+        return -1;
+    }
+    
+    const compiled_rule_record_t* records = (const compiled_rule_record_t*)(data + header->rules_offset);
+    for (uint64_t i = 0; i < rule_count; i++) {
+        for (size_t field = 0; field < COMPILED_RULES_STRING_FIELDS; field++) {
+            uint32_t offset = records[i].strings[field];
+            if (offset != COMPILED_RULES_NO_STRING && (uint64_t)offset >= header->pool_size) {
+                return -1;
+            }
+        }
+        if (records[i].transfer_mode < (int32_t)TRANSFER_MODE_UNICAST || records[i].transfer_mode > (int32_t)TRANSFER_MODE_MULTICAST) {
+            return -1;
+        }
+        if (records[i].ownership < (int32_t)PARAM_OWNERSHIP_COPY || records[i].ownership > (int32_t)PARAM_OWNERSHIP_BORROW) {
+            return -1;
+        }
+    }
+    
+    const compiled_entry_record_t* entries = (const compiled_entry_record_t*)(data + header->entries_offset);
+    for (uint64_t i = 0; i < entry_count; i++) {
+        if (!CONFIG_KEY_IS_ENTRY(entries[i].key_id) ||
+            (uint64_t)entries[i].value >= header->pool_size) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 应用记录的[EntryPlugin]段 / Apply recorded [EntryPlugin] section / Gespeicherten [EntryPlugin]-Abschnitt anwenden
+ * @return 入口配置结果 / Entry configuration result / Ergebnis der Einstiegskonfiguration
+ */
+static int apply_compiled_entries(const char* config_path, const unsigned char* data, const compiled_rules_header_t* header) {
+    size_t entry_count = (size_t)header->entry_count;
+    config_key_value_t* items = NULL;
+    if (entry_count > 0) {
+        items = (config_key_value_t*)malloc(entry_count * sizeof(config_key_value_t));
+        if (items == NULL) {
+            return CONFIG_ERR_MEMORY;
+        }
+    }
+    
+    const compiled_entry_record_t* entries = (const compiled_entry_record_t*)(data + header->entries_offset);
+    const char* pool = (const char*)(data + header->pool_offset);
+    for (size_t i = 0; i < entry_count; i++) {
+        items[i].key_id = (config_key_id_t)entries[i].key_id;
+        items[i].value.data = pool + entries[i].value;
+        items[i].value.length = strlen(items[i].value.data);
+        items[i].line_number = (size_t)entries[i].line_number;
+    }
+    
+    int result = apply_entry_plugin_items(config_path, items, entry_count);
+    if (items != NULL) {
+        free(items);
+    }
+    return result;
+}
+
+/**
+ * @brief 关闭未安装的.nxptc视图 / Close an uninstalled .nxptc view / Nicht installierte .nxptc-Ansicht schließen
+ */
+void close_compiled_rules(compiled_rules_view_t* view) {
+    if (view == NULL) {
+        return;
+    }
+    
+    if (view->map != NULL) {
+        pt_platform_file_map_close((pt_platform_file_map_t*)view->map);
+    }
+    if (view->compiled_path != NULL) {
+        free(view->compiled_path);
+    }
+    memset(view, 0, sizeof(compiled_rules_view_t));
+}
+
+/**
+ * @brief 映射并校验.nxptc文件 / Map and validate .nxptc file / .nxptc-Datei zuordnen und validieren
+ */
+int open_compiled_rules(const char* config_path, const compiled_source_stamp_t* stamp, compiled_rules_view_t* view_out) {
+    if (config_path == NULL || stamp == NULL || view_out == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    memset(view_out, 0, sizeof(compiled_rules_view_t));
+    view_out->compiled_path = build_compiled_rules_path(config_path);
+    if (view_out->compiled_path == NULL) {
+        return CONFIG_ERR_MEMORY;
+    }
+    pt_platform_file_map_t* map = pt_platform_file_map_open(view_out->compiled_path);
+    if (map == NULL) {
+        close_compiled_rules(view_out);
+        return CONFIG_ERR_FILE_OPEN;
+    }
+    view_out->map = map;
+    
+    const unsigned char* data = (const unsigned char*)pt_platform_file_map_data(map);
+    size_t size = pt_platform_file_map_size(map);
+    if (size < sizeof(compiled_rules_header_t)) {
+        internal_log_write("WARNING", "Compiled rules %s is truncated, reparsing source", view_out->compiled_path);
+        close_compiled_rules(view_out);
+        return CONFIG_ERR_INCOMPLETE;
+    }
+    memcpy(&view_out->header, data, sizeof(compiled_rules_header_t));
+    
+    const compiled_rules_header_t* header = &view_out->header;
+    if (header->source.size != stamp->size || header->source.mtime != stamp->mtime || header->source.hash != stamp->hash) {
+        internal_log_write("INFO", "Compiled rules %s is out of date, reparsing source", view_out->compiled_path);
+        close_compiled_rules(view_out);
+        return CONFIG_ERR_INCOMPLETE;
+    }
+    if (validate_compiled_rules(data, size, header) != 0) {
+        internal_log_write("WARNING", "Compiled rules %s is invalid, reparsing source", view_out->compiled_path);
+        close_compiled_rules(view_out);
+        return CONFIG_ERR_INCOMPLETE;
+    }
+    view_out->data = data;
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 将已校验的.nxptc视图安装到上下文 / Install a validated .nxptc view into context / Validierte .nxptc-Ansicht in den Kontext installieren
+ */
+int install_compiled_rules(const char* config_path, compiled_rules_view_t* view,
+                           size_t* rule_count_out, size_t* line_count_out, int* entry_result_out) {
+    if (config_path == NULL || view == NULL || view->data == NULL || rule_count_out == NULL || line_count_out == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    /* 与文本解析相同，先应用入口设置再记录日志 / As with text parsing, apply entry settings before logging / Wie beim Textparsen Einstiegseinstellungen vor der Protokollierung anwenden */
+    const compiled_rules_header_t* header = &view->header;
+    config_file_settings_t settings;
+    settings.disable_info_log = header->disable_info_log;
+    settings.enable_validation = header->enable_validation;
+    apply_config_file_settings(&settings);
+    
+    size_t rule_count = (size_t)header->rule_count;
+    size_t start_rule_index = ctx->rule_count;
+    if (start_rule_index > SIZE_MAX - rule_count) {
+        close_compiled_rules(view);
+        return CONFIG_ERR_OVERFLOW;
+    }
+    while (ctx->rule_capacity < start_rule_index + rule_count) {
+        if (expand_rules_capacity() != 0) {
+            close_compiled_rules(view);
+            return CONFIG_ERR_MEMORY;
+        }
+    }
+    
+    /* 映射在规则释放前保持有效 / The mapping stays valid until the rules are released / Die Zuordnung bleibt bis zur Freigabe der Regeln gültig */
+    if (rule_count > 0 && retain_compiled_rule_map(view->map) != CONFIG_ERR_SUCCESS) {
+        close_compiled_rules(view);
+        return CONFIG_ERR_MEMORY;
+    }
+    
+    const unsigned char* data = view->data;
+    const compiled_rule_record_t* records = (const compiled_rule_record_t*)(data + header->rules_offset);
+    const uint64_t* keys = (const uint64_t*)(data + header->keys_offset);
+    char* pool = (char*)(data + header->pool_offset);
+    for (size_t i = 0; i < rule_count; i++) {
+        const compiled_rule_record_t* record = &records[i];
+        pointer_transfer_rule_t* rule = &ctx->rules[start_rule_index + i];
+        memset(rule, 0, sizeof(pointer_transfer_rule_t));
+        for (size_t field = 0; field < COMPILED_RULES_STRING_FIELDS; field++) {
+            if (record->strings[field] != COMPILED_RULES_NO_STRING) {
+                *get_rule_string_field(rule, field) = pool + record->strings[field];
+            }
+        }
+        rule->source_param_index = record->source_param_index;
+        rule->target_param_index = record->target_param_index;
+        rule->transfer_mode = (transfer_mode_t)record->transfer_mode;
+        rule->enabled = record->enabled;
+        rule->cache_self = record->cache_self;
+        rule->ownership = (param_ownership_t)record->ownership;
+        rule->strings_shared = 1;
+    }
+    ctx->rule_count = start_rule_index + rule_count;
+    commit_appended_rules(start_rule_index, rule_count > 0 ? keys : NULL);
+    
+    /* 入口值指向字符串池，须在关闭映射前应用 / Entry values point into the string pool and must be applied before the mapping is closed / Einstiegswerte zeigen in den Pool und müssen vor dem Schließen der Zuordnung angewendet werden */
+    if (entry_result_out != NULL) {
+        *entry_result_out = apply_compiled_entries(config_path, data, header);
+    }
+    
+    *rule_count_out = rule_count;
+    *line_count_out = (size_t)header->line_count;
+    internal_log_write("INFO", "Mapped compiled rules %s: %zu rules", view->compiled_path, rule_count);
+    
+    /* 有规则时映射归注册表所有 / With rules the mapping is owned by the registry / Mit Regeln gehört die Zuordnung der Registrierung */
+    if (rule_count > 0) {
+        view->map = NULL;
+    }
+    close_compiled_rules(view);
+    return CONFIG_ERR_SUCCESS;
+}
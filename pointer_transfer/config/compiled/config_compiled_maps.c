@@ -0,0 +1,63 @@
+/**
+ * @file config_compiled_maps.c
+ * @brief 编译规则缓存映射管理 / Compiled Rules Cache Mapping Management / Verwaltung der Zuordnungen des kompilierten Regel-Caches
+ */
+
+#include "config_compiled.h"
+#include "../common/config_errors.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+/**
+ * @brief 保留.nxptc映射直到规则释放 / Keep .nxptc mapping until rules are released / .nxptc-Zuordnung bis zur Regelfreigabe behalten
+ */
+int retain_compiled_rule_map(void* map) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || map == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    if (ctx->compiled_rule_map_count >= ctx->compiled_rule_map_capacity) {
+        size_t new_capacity = ctx->compiled_rule_map_capacity == 0 ? 4 : ctx->compiled_rule_map_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity > SIZE_MAX / sizeof(void*)) {
+            internal_log_write("ERROR", "retain_compiled_rule_map: capacity overflow detected");
+            return CONFIG_ERR_OVERFLOW;
+        }
+        void** new_maps = (void**)realloc(ctx->compiled_rule_maps, new_capacity * sizeof(void*));
+        if (new_maps == NULL) {
+            internal_log_write("ERROR", "retain_compiled_rule_map: failed to expand mapping array");
+            return CONFIG_ERR_MEMORY;
+        }
+        ctx->compiled_rule_maps = new_maps;
+        ctx->compiled_rule_map_capacity = new_capacity;
+    }
+    
+    ctx->compiled_rule_maps[ctx->compiled_rule_map_count++] = map;
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 释放所有.nxptc映射 / Release all .nxptc mappings / Alle .nxptc-Zuordnungen freigeben
+ * @details 必须在引用映射的规则释放之后调用 / Must be called after the rules referencing the mappings are freed / Muss nach der Freigabe der Regeln aufgerufen werden, die auf die Zuordnungen verweisen
+ */
+void release_compiled_rule_maps(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < ctx->compiled_rule_map_count; i++) {
+        pt_platform_file_map_close((pt_platform_file_map_t*)ctx->compiled_rule_maps[i]);
+    }
+    if (ctx->compiled_rule_maps != NULL) {
+        free(ctx->compiled_rule_maps);
+    }
+    ctx->compiled_rule_maps = NULL;
+    ctx->compiled_rule_map_count = 0;
+    ctx->compiled_rule_map_capacity = 0;
+}
@@ -0,0 +1,261 @@
+/**
+ * @file config_compiled_write.c
+ * @brief 编译规则缓存写入 / Compiled Rules Cache Writer / Schreiber des kompilierten Regel-Caches
+ */
+
+#include "config_compiled.h"
+#include "../common/config_errors.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include "pointer_transfer_context.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 去重字符串池构建器 / Deduplicating string pool builder / Deduplizierender Zeichenfolgenpool-Ersteller
+ */
+typedef struct {
+    char* data;                    /**< 池数据 / Pool data / Pooldaten */
+    size_t size;                   /**< 已用字节 / Used bytes / Belegte Bytes */
+    size_t capacity;               /**< 容量 / Capacity / Kapazität */
+    size_t* slots;                 /**< 开放寻址表（偏移+1，0=空） / Open addressing table (offset+1, 0=empty) / Offene Adressierungstabelle (Offset+1, 0=leer) */
+    uint64_t* slot_hashes;         /**< 槽位哈希 / Slot hashes / Slot-Hashes */
+    size_t slot_count;             /**< 槽位数量（2的幂） / Slot count (power of two) / Slot-Anzahl (Zweierpotenz) */
+} string_pool_builder_t;
+
+/**
+ * @brief 字符串哈希（FNV-1a） / String hash (FNV-1a) / Zeichenfolgen-Hash (FNV-1a)
+ */
+static uint64_t hash_pool_string(const char* str, size_t len) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint64_t)(unsigned char)str[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief 将字符串加入池，相同字符串只存一次 / Add string to pool, storing equal strings once / Zeichenfolge zum Pool hinzufügen, gleiche Zeichenfolgen nur einmal speichern
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+static int intern_pool_string(string_pool_builder_t* pool, const char* str, size_t len, uint32_t* offset_out) {
+    uint64_t hash = hash_pool_string(str, len);
+    size_t mask = pool->slot_count - 1;
+    size_t slot = (size_t)hash & mask;
+    
+    while (pool->slots[slot] != 0) {
+        size_t offset = pool->slots[slot] - 1;
+        if (pool->slot_hashes[slot] == hash && strlen(pool->data + offset) == len && memcmp(pool->data + offset, str, len) == 0) {
+            *offset_out = (uint32_t)offset;
+            return CONFIG_ERR_SUCCESS;
+        }
+        slot = (slot + 1) & mask;
+    }
+    
+    /* 偏移量必须能放入uint32且不等于COMPILED_RULES_NO_STRING / Offsets must fit uint32 and differ from COMPILED_RULES_NO_STRING / Offsets müssen in uint32 passen und sich von COMPILED_RULES_NO_STRING unterscheiden */
+    if (pool->size + len + 1 >= (size_t)COMPILED_RULES_NO_STRING) {
+        internal_log_write("WARNING", "write_compiled_rules: string pool exceeds 4 GiB, not writing cache");
+        return CONFIG_ERR_OVERFLOW;
+    }
+    
+    if (pool->size + len + 1 > pool->capacity) {
+        size_t new_capacity = pool->capacity == 0 ? 4096 : pool->capacity;
+        while (new_capacity < pool->size + len + 1) {
+            new_capacity *= 2;
+        }
+        char* new_data = (char*)realloc(pool->data, new_capacity);
+        if (new_data == NULL) {
+            return CONFIG_ERR_MEMORY;
+        }
+        pool->data = new_data;
+        pool->capacity = new_capacity;
+    }
+    
+    if (len > 0) {
+        memcpy(pool->data + pool->size, str, len);
+    }
+    pool->data[pool->size + len] = '\0';
+    pool->slots[slot] = pool->size + 1;
+    pool->slot_hashes[slot] = hash;
+    *offset_out = (uint32_t)pool->size;
+    pool->size += len + 1;
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 写入整个缓冲区 / Write whole buffer / Gesamten Puffer schreiben
+ */
+static int write_block(FILE* fp, const void* data, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    return fwrite(data, 1, size, fp) == size ? 0 : -1;
+}
+
+/**
+ * @brief 写入.nxptc文件 / Write .nxptc file / .nxptc-Datei schreiben
+ * @details 先写临时文件再替换，读者不会看到写了一半的文件 / Writes a temporary file and replaces, so readers never see a half-written file / Schreibt eine temporäre Datei und ersetzt, Leser sehen nie eine halb geschriebene Datei
+ */
+int write_compiled_rules(const char* config_path, const compiled_source_stamp_t* stamp, const parsed_rules_file_t* parsed) {
+    if (config_path == NULL || stamp == NULL || parsed == NULL || (parsed->rules == NULL && parsed->rule_count > 0)) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_rule_t* rules = parsed->rules;
+    size_t rule_count = parsed->rule_count;
+    size_t entry_count = parsed->entry_item_count;
+    if (rule_count > SIZE_MAX / sizeof(compiled_rule_record_t) / COMPILED_RULES_STRING_FIELDS / 2 ||
+        entry_count > SIZE_MAX / sizeof(compiled_entry_record_t) / 4) {
+        return CONFIG_ERR_OVERFLOW;
+    }
+    
+    /* 槽位数量取不小于两倍字符串上限的2的幂 / Slot count is the power of two not below twice the string bound / Slot-Anzahl ist die Zweierpotenz nicht unter dem doppelten Zeichenfolgen-Höchstwert */
+    string_pool_builder_t pool;
+    memset(&pool, 0, sizeof(pool));
+    pool.slot_count = 16;
+    while (pool.slot_count < (rule_count * COMPILED_RULES_STRING_FIELDS + entry_count) * 2) {
+        pool.slot_count *= 2;
+    }
+    pool.slots = (size_t*)calloc(pool.slot_count, sizeof(size_t));
+    pool.slot_hashes = (uint64_t*)calloc(pool.slot_count, sizeof(uint64_t));
+    compiled_rule_record_t* records = (compiled_rule_record_t*)calloc(rule_count > 0 ? rule_count : 1, sizeof(compiled_rule_record_t));
+    uint64_t* keys = (uint64_t*)calloc(rule_count > 0 ? rule_count : 1, sizeof(uint64_t));
+    compiled_entry_record_t* entries = (compiled_entry_record_t*)calloc(entry_count > 0 ? entry_count : 1, sizeof(compiled_entry_record_t));
+    int result = CONFIG_ERR_SUCCESS;
+    if (pool.slots == NULL || pool.slot_hashes == NULL || records == NULL || keys == NULL || entries == NULL) {
+        result = CONFIG_ERR_MEMORY;
+    }
+    
+    for (size_t i = 0; i < rule_count && result == CONFIG_ERR_SUCCESS; i++) {
+        pointer_transfer_rule_t* rule = &rules[i];
+        compiled_rule_record_t* record = &records[i];
+        for (size_t field = 0; field < COMPILED_RULES_STRING_FIELDS; field++) {
+            char* value = *get_rule_string_field(rule, field);
+            record->strings[field] = COMPILED_RULES_NO_STRING;
+            if (value != NULL) {
+                result = intern_pool_string(&pool, value, strlen(value), &record->strings[field]);
+                if (result != CONFIG_ERR_SUCCESS) {
+                    break;
+                }
+            }
+        }
+        record->source_param_index = rule->source_param_index;
+        record->target_param_index = rule->target_param_index;
+        record->transfer_mode = (int32_t)rule->transfer_mode;
+        record->enabled = rule->enabled;
+        record->cache_self = rule->cache_self;
+        record->ownership = (int32_t)rule->ownership;
+        
+        /* 预计算索引键，加载时无需再格式化和哈希 / Precompute index keys so loading needs no formatting or hashing / Indexschlüssel vorberechnen, damit beim Laden weder formatiert noch gehasht wird */
+        if (rule->source_plugin != NULL && rule->source_interface != NULL) {
+            keys[i] = calculate_rule_hash_key_for_index(rule->source_plugin, rule->source_interface, rule->source_param_index);
+        }
+    }
+    
+    /* 入口键值只存标识和值，加载时无需再分词 / Entry key-values store only identifier and value, so loading needs no tokenizing / Einstiegs-Schlüssel-Werte speichern nur Kennung und Wert, beim Laden ist keine Tokenisierung nötig */
+    for (size_t i = 0; i < entry_count && result == CONFIG_ERR_SUCCESS; i++) {
+        const config_key_value_t* item = &parsed->entry_items[i];
+        entries[i].key_id = (uint32_t)item->key_id;
+        entries[i].line_number = item->line_number > UINT32_MAX ? UINT32_MAX : (uint32_t)item->line_number;
+        result = intern_pool_string(&pool, item->value.data, item->value.length, &entries[i].value);
+    }
+    
+    char* compiled_path = NULL;
+    char* temp_path = NULL;
+    if (result == CONFIG_ERR_SUCCESS) {
+        compiled_path = build_compiled_rules_path(config_path);
+        /* 临时文件名带序号，并行链式加载同一文件时互不覆盖 / The temporary name carries a sequence number so parallel chain loads of the same file do not clobber each other / Der temporäre Name trägt eine Sequenznummer, damit paralleles Kettenladen derselben Datei sich nicht überschreibt */
+        static volatile int temp_sequence = 0;
+        size_t temp_size = compiled_path != NULL ? strlen(compiled_path) + 32 : 0;
+        temp_path = compiled_path != NULL ? (char*)malloc(temp_size) : NULL;
+        if (temp_path == NULL) {
+            result = CONFIG_ERR_MEMORY;
+        } else {
+            snprintf(temp_path, temp_size, "%s.%d.tmp", compiled_path, pt_platform_atomic_fetch_add_int(&temp_sequence, 1));
+        }
+    }
+    
+    if (result == CONFIG_ERR_SUCCESS) {
+        size_t pool_padded = (pool.size + 7) & ~(size_t)7;
+        compiled_rules_header_t header;
+        memset(&header, 0, sizeof(header));
+        header.magic = COMPILED_RULES_MAGIC;
+        header.version = COMPILED_RULES_VERSION;
+        header.header_size = (uint32_t)sizeof(compiled_rules_header_t);
+        header.record_size = (uint32_t)sizeof(compiled_rule_record_t);
+        header.source = *stamp;
+        header.rule_count = (uint64_t)rule_count;
+        header.line_count = (uint64_t)parsed->line_count;
+        header.rules_offset = (uint64_t)sizeof(compiled_rules_header_t);
+        header.keys_offset = header.rules_offset + (uint64_t)rule_count * sizeof(compiled_rule_record_t);
+        header.entry_count = (uint64_t)entry_count;
+        header.entries_offset = header.keys_offset + (uint64_t)rule_count * sizeof(uint64_t);
+        header.pool_offset = header.entries_offset + (uint64_t)entry_count * sizeof(compiled_entry_record_t);
+        header.pool_size = (uint64_t)pool.size;
+        header.file_size = header.pool_offset + (uint64_t)pool_padded;
+        header.max_seen_index = (int32_t)parsed->max_seen_index;
+        header.disable_info_log = parsed->settings.disable_info_log;
+        header.enable_validation = parsed->settings.enable_validation;
+        
+        static const char padding[8] = {0};
+        FILE* fp = fopen(temp_path, "wb");
+        if (fp == NULL) {
+            result = CONFIG_ERR_FILE_OPEN;
+        } else {
+            if (write_block(fp, &header, sizeof(header)) != 0 ||
+                write_block(fp, records, rule_count * sizeof(compiled_rule_record_t)) != 0 ||
+                write_block(fp, keys, rule_count * sizeof(uint64_t)) != 0 ||
+                write_block(fp, entries, entry_count * sizeof(compiled_entry_record_t)) != 0 ||
+                write_block(fp, pool.data, pool.size) != 0 ||
+                write_block(fp, padding, pool_padded - pool.size) != 0) {
+                result = CONFIG_ERR_FILE_OPEN;
+            }
+            if (fclose(fp) != 0) {
+                result = CONFIG_ERR_FILE_OPEN;
+            }
+            if (result == CONFIG_ERR_SUCCESS && pt_platform_replace_file(temp_path, compiled_path) != 0) {
+                result = CONFIG_ERR_FILE_OPEN;
+            }
+            if (result != CONFIG_ERR_SUCCESS) {
+                remove(temp_path);
+            }
+        }
+        
+        if (result == CONFIG_ERR_SUCCESS) {
+            internal_log_write("INFO", "Wrote compiled rules %s: %zu rules, %zu bytes of strings",
+                              compiled_path, rule_count, pool.size);
+        } else {
+            internal_log_write("WARNING", "write_compiled_rules: failed to write %s (error %d)", compiled_path, result);
+        }
+    }
+    
+    if (temp_path != NULL) {
+        free(temp_path);
+    }
+    if (compiled_path != NULL) {
+        free(compiled_path);
+    }
+    if (pool.data != NULL) {
+        free(pool.data);
+    }
+    if (pool.slots != NULL) {
+        free(pool.slots);
+    }
+    if (pool.slot_hashes != NULL) {
+        free(pool.slot_hashes);
+    }
+    if (records != NULL) {
+        free(records);
+    }
+    if (keys != NULL) {
+        free(keys);
+    }
+    if (entries != NULL) {
+        free(entries);
+    }
+    return result;
+}
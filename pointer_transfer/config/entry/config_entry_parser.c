@@ -6,213 +6,298 @@
 #include "config_entry_parser.h"
 #include "../common/config_errors.h"
 #include "../common/config_parser_common.h"
+#include "../tokenizer/config_tokenizer.h"
 #include "pointer_transfer_config.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_platform.h"
 #include "pointer_transfer_utils.h"
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <stdint.h>
 
 /**
- * @brief 解析入口配置的键值对 / Parse entry configuration key-value pair / Einstiegs-Konfigurations-Schlüssel-Wert-Paar parsen
+ * @brief 用片段替换入口字符串配置 / Replace entry string setting with span / Einstiegs-Zeichenfolgeneinstellung durch Abschnitt ersetzen
  */
-static int parse_entry_key_value(pointer_transfer_context_t* ctx, const char* key, const char* value, size_t line_number) {
-    if (ctx == NULL || key == NULL || value == NULL) {
-        return CONFIG_ERR_INVALID_PARAM;
-    }
-    
-    if (strcmp(key, "PluginName") == 0) {
-        if (ctx->entry_plugin_name != NULL) free(ctx->entry_plugin_name);
-        ctx->entry_plugin_name = allocate_string(value);
-    } else if (strcmp(key, "PluginPath") == 0) {
-        if (ctx->entry_plugin_path != NULL) free(ctx->entry_plugin_path);
-        ctx->entry_plugin_path = allocate_string(value);
-    } else if (strcmp(key, "NxptPath") == 0) {
-        if (ctx->entry_nxpt_path != NULL) free(ctx->entry_nxpt_path);
-        ctx->entry_nxpt_path = allocate_string(value);
-    } else if (strcmp(key, "AutoRunInterface") == 0) {
-        if (ctx->entry_auto_run_interface != NULL) free(ctx->entry_auto_run_interface);
-        ctx->entry_auto_run_interface = allocate_string(value);
-    } else if (strcmp(key, "DisableInfoLog") == 0) {
-        int disable_info = parse_boolean_value(value);
-        ctx->disable_info_log = disable_info;
-        internal_log_write("INFO", "DisableInfoLog configuration: %d (%s)", 
-                          disable_info, disable_info ? "INFO logs disabled" : "INFO logs enabled");
-    } else if (strcmp(key, "EnableValidation") == 0) {
-        int enable_validation = parse_boolean_value(value);
-        ctx->enable_validation = enable_validation;
-        internal_log_write("INFO", "EnableValidation configuration: %d (%s)", 
-                          enable_validation, enable_validation ? "validation enabled" : "validation disabled");
-    } else if (strcmp(key, "IgnorePlugins") == 0) {
-        /* 解析忽略插件列表（逗号分隔） / Parse ignored plugins list (comma-separated) / Liste der ignorierten Plugins parsen (kommagetrennt) */
-        if (value != NULL && strlen(value) > 0) {
-            char* value_copy = allocate_string(value);
-            if (value_copy != NULL) {
-                char* token = strtok(value_copy, ",");
-                while (token != NULL) {
-                    /* 去除前后空白字符 / Trim whitespace / Leerzeichen entfernen */
-                    trim_string(token);
-                    if (strlen(token) > 0) {
-                        /* 添加到忽略列表 / Add to ignore list / Zur Ignorierliste hinzufügen */
-                        if (ctx->ignore_plugin_count >= ctx->ignore_plugin_capacity) {
-                            size_t new_capacity = ctx->ignore_plugin_capacity == 0 ? 8 : ctx->ignore_plugin_capacity * 2;
-                            
-                            if (new_capacity < ctx->ignore_plugin_capacity || new_capacity > SIZE_MAX / sizeof(char*)) {
-                                internal_log_write("ERROR", "IgnorePlugins: capacity overflow detected (current=%zu, new=%zu)", 
-                                                  ctx->ignore_plugin_capacity, new_capacity);
-                                token = strtok(NULL, ",");
-                                continue;
-                            }
-                            
-                            char** new_plugins = (char**)realloc(ctx->ignore_plugins, new_capacity * sizeof(char*));
-                            if (new_plugins == NULL) {
-                                internal_log_write("ERROR", "IgnorePlugins: failed to allocate memory for ignore plugins array (new_capacity=%zu)", new_capacity);
-                                token = strtok(NULL, ",");
-                                continue;
-                            }
-                            
-                            memset(new_plugins + ctx->ignore_plugin_count, 0, (new_capacity - ctx->ignore_plugin_capacity) * sizeof(char*));
-                            ctx->ignore_plugins = new_plugins;
-                            ctx->ignore_plugin_capacity = new_capacity;
-                        }
-                        
-                        /* 检查是否已存在 / Check if already exists / Prüfen, ob bereits vorhanden */
-                        int already_exists = 0;
-                        for (size_t i = 0; i < ctx->ignore_plugin_count; i++) {
-                            if (ctx->ignore_plugins[i] != NULL && strcmp(ctx->ignore_plugins[i], token) == 0) {
-                                already_exists = 1;
-                                break;
-                            }
-                        }
-                        
-                        if (!already_exists) {
-                            char* token_copy = allocate_string(token);
-                            if (token_copy != NULL) {
-                                ctx->ignore_plugins[ctx->ignore_plugin_count] = token_copy;
-                                ctx->ignore_plugin_count++;
-                                internal_log_write("INFO", "Added ignored plugin path from config: %s", token);
-                            } else {
-                                internal_log_write("WARNING", "IgnorePlugins: failed to allocate memory for plugin path: %s", token);
-                            }
-                        }
-                    }
-                    token = strtok(NULL, ",");
-                }
-                free(value_copy);
-            }
-        }
+static void assign_entry_string(char** field, config_span_t value) {
+    if (*field != NULL) free(*field);
+    *field = copy_config_span(value);
+}
+
+/**
+ * @brief 解析入口布尔值 / Parse entry boolean value / Einstiegs-Boolean-Wert parsen
+ */
+static int parse_entry_boolean(config_span_t value) {
+    char buffer[32];
+    if (copy_config_span_to_buffer(value, buffer, sizeof(buffer)) != 0) {
+        return 0;
     }
-    
-    return CONFIG_ERR_SUCCESS;
+    return parse_boolean_value(buffer);
 }
 
 /**
- * @brief 解析入口插件配置 / Parse entry plugin configuration / Einstiegs-Plugin-Konfiguration parsen
+ * @brief 解析入口整数值 / Parse entry integer value / Einstiegs-Ganzzahlwert parsen
+ * @return 成功返回0，不是整数返回-1 / Returns 0 on success, -1 if not an integer / Gibt 0 bei Erfolg zurück, -1 wenn keine Ganzzahl
  */
-int parse_entry_plugin_config(const char* config_path) {
-    if (config_path == NULL) {
-        return CONFIG_ERR_INVALID_PARAM;
+static int parse_entry_integer(config_span_t value, long long* value_out) {
+    char buffer[32];
+    if (copy_config_span_to_buffer(value, buffer, sizeof(buffer)) != 0) {
+        return -1;
     }
     
-    FILE* fp = fopen(config_path, "r");
-    if (fp == NULL) {
-        internal_log_write("WARNING", "Failed to open entry plugin config file: %s", config_path);
-        return CONFIG_ERR_FILE_OPEN;
+    char* end_ptr = NULL;
+    long long parsed = strtoll(buffer, &end_ptr, 10);
+    if (end_ptr == buffer || *end_ptr != '\0') {
+        return -1;
     }
-    
-    internal_log_write("INFO", "Parsing entry plugin config file: %s", config_path);
-    
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        internal_log_write("ERROR", "parse_entry_plugin_config: global context is NULL");
-        fclose(fp);
-        return CONFIG_ERR_INVALID_PARAM;
+    *value_out = parsed;
+    return 0;
+}
+
+/**
+ * @brief 添加一个忽略插件路径 / Add one ignored plugin path / Einen ignorierten Plugin-Pfad hinzufügen
+ */
+static void add_ignored_plugin(pointer_transfer_context_t* ctx, config_span_t token) {
+    /* 添加到忽略列表 / Add to ignore list / Zur Ignorierliste hinzufügen */
+    if (ctx->ignore_plugin_count >= ctx->ignore_plugin_capacity) {
+        size_t new_capacity = ctx->ignore_plugin_capacity == 0 ? 8 : ctx->ignore_plugin_capacity * 2;
+        
+        if (new_capacity < ctx->ignore_plugin_capacity || new_capacity > SIZE_MAX / sizeof(char*)) {
+            internal_log_write("ERROR", "IgnorePlugins: capacity overflow detected (current=%zu, new=%zu)", 
+                              ctx->ignore_plugin_capacity, new_capacity);
+            return;
+        }
+        
+        char** new_plugins = (char**)realloc(ctx->ignore_plugins, new_capacity * sizeof(char*));
+        if (new_plugins == NULL) {
+            internal_log_write("ERROR", "IgnorePlugins: failed to allocate memory for ignore plugins array (new_capacity=%zu)", new_capacity);
+            return;
+        }
+        
+        memset(new_plugins + ctx->ignore_plugin_count, 0, (new_capacity - ctx->ignore_plugin_capacity) * sizeof(char*));
+        ctx->ignore_plugins = new_plugins;
+        ctx->ignore_plugin_capacity = new_capacity;
     }
     
-    char* line_buffer = NULL;
-    size_t line_buffer_size = 4096;
-    char current_section[512] = {0};
-    int in_entry_section = 0;
+    /* 检查是否已存在 / Check if already exists / Prüfen, ob bereits vorhanden */
+    for (size_t i = 0; i < ctx->ignore_plugin_count; i++) {
+        if (ctx->ignore_plugins[i] != NULL && config_span_equals(token, ctx->ignore_plugins[i])) {
+            return;
+        }
+    }
     
-    line_buffer = (char*)malloc(line_buffer_size);
-    if (line_buffer == NULL) {
-        fclose(fp);
-        return CONFIG_ERR_MEMORY;
+    char* token_copy = copy_config_span(token);
+    if (token_copy != NULL) {
+        ctx->ignore_plugins[ctx->ignore_plugin_count] = token_copy;
+        ctx->ignore_plugin_count++;
+        internal_log_write("INFO", "Added ignored plugin path from config: %s", token_copy);
+    } else {
+        internal_log_write("WARNING", "IgnorePlugins: failed to allocate memory for plugin path: %.*s", (int)token.length, token.data);
     }
+}
+
+/**
+ * @brief 应用入口配置的键值对 / Apply entry configuration key-value pair / Einstiegs-Konfigurations-Schlüssel-Wert-Paar anwenden
+ */
+static void apply_entry_key_value(pointer_transfer_context_t* ctx, const config_key_value_t* item) {
+    config_span_t value = item->value;
+    size_t line_number = item->line_number;
+    long long number = 0;
     
-    size_t line_number = 0;
-    while (fgets(line_buffer, (int)line_buffer_size, fp) != NULL) {
-        line_number++;
-        char* trimmed_line = line_buffer;
-        size_t len = strlen(trimmed_line);
-        
-        /* 检查行是否被截断 / Check if line was truncated / Prüfen, ob Zeile abgeschnitten wurde */
-        if (len == line_buffer_size - 1 && line_buffer[len - 1] != '\n') {
-            internal_log_write("WARNING", "parse_entry_plugin_config: line %zu exceeds buffer size (%zu), may be truncated", 
-                line_number, line_buffer_size);
+    switch (item->key_id) {
+        case CONFIG_KEY_PLUGIN_NAME:
+            assign_entry_string(&ctx->entry_plugin_name, value);
+            break;
+        case CONFIG_KEY_PLUGIN_PATH:
+            assign_entry_string(&ctx->entry_plugin_path, value);
+            break;
+        case CONFIG_KEY_NXPT_PATH:
+            assign_entry_string(&ctx->entry_nxpt_path, value);
+            break;
+        case CONFIG_KEY_AUTO_RUN_INTERFACE:
+            assign_entry_string(&ctx->entry_auto_run_interface, value);
+            break;
+        case CONFIG_KEY_DISABLE_INFO_LOG: {
+            int disable_info = parse_entry_boolean(value);
+            ctx->disable_info_log = disable_info;
+            internal_log_write("INFO", "DisableInfoLog configuration: %d (%s)", 
+                              disable_info, disable_info ? "INFO logs disabled" : "INFO logs enabled");
+            break;
         }
-        
-        if (len > 0 && trimmed_line[len - 1] == '\n') {
-            trimmed_line[len - 1] = '\0';
-            len--;
+        case CONFIG_KEY_ENABLE_VALIDATION: {
+            int enable_validation = parse_entry_boolean(value);
+            ctx->enable_validation = enable_validation;
+            internal_log_write("INFO", "EnableValidation configuration: %d (%s)", 
+                              enable_validation, enable_validation ? "validation enabled" : "validation disabled");
+            break;
         }
-        if (len > 0 && trimmed_line[len - 1] == '\r') {
-            trimmed_line[len - 1] = '\0';
-            len--;
+        case CONFIG_KEY_MAX_CALL_DEPTH:
+            if (parse_entry_integer(value, &number) != 0 || number <= 0 || number > INT_MAX) {
+                internal_log_write("WARNING", "Invalid MaxCallDepth value at line %zu: %.*s (using default %d)",
+                                  line_number, (int)value.length, value.data, PT_DEFAULT_MAX_CALL_DEPTH);
+                ctx->max_call_depth = 0;
+            } else {
+                ctx->max_call_depth = (int)number;
+                internal_log_write("INFO", "MaxCallDepth configuration: %d", ctx->max_call_depth);
+            }
+            break;
+        case CONFIG_KEY_MEMO_CACHE_SIZE:
+            if (parse_entry_integer(value, &number) != 0 || number < 0) {
+                internal_log_write("WARNING", "Invalid MemoCacheSize value at line %zu: %.*s (using default %d)",
+                                  line_number, (int)value.length, value.data, PT_DEFAULT_MEMO_CACHE_SIZE);
+                ctx->memo_cache.max_entries = 0;
+                ctx->memo_cache.disabled = 0;
+            } else {
+                /* 0表示禁用记忆化缓存 / 0 disables the memoization cache / 0 deaktiviert den Memoisierungs-Cache */
+                ctx->memo_cache.max_entries = (size_t)number;
+                ctx->memo_cache.disabled = number == 0 ? 1 : 0;
+                internal_log_write("INFO", "MemoCacheSize configuration: %lld%s", number, number == 0 ? " (disabled)" : "");
+            }
+            break;
+        case CONFIG_KEY_MEMO_CACHE_TTL:
+            if (parse_entry_integer(value, &number) != 0 || number < 0) {
+                internal_log_write("WARNING", "Invalid MemoCacheTTL value at line %zu: %.*s (entries will not expire)",
+                                  line_number, (int)value.length, value.data);
+                ctx->memo_cache.ttl_ms = 0;
+            } else {
+                ctx->memo_cache.ttl_ms = (int64_t)number;
+                internal_log_write("INFO", "MemoCacheTTL configuration: %lld ms", number);
+            }
+            break;
+        case CONFIG_KEY_WATCH_RULES: {
+            int watch_rules = parse_entry_boolean(value);
+            ctx->watch_rules = watch_rules;
+            internal_log_write("INFO", "WatchRules configuration: %d (%s)", 
+                              watch_rules, watch_rules ? "rule files reloaded on change" : "rule file watching disabled");
+            break;
         }
-        trim_string(trimmed_line);
-        len = strlen(trimmed_line);
-        
-        if (trimmed_line[0] == '#' || trimmed_line[0] == '\0') {
-            continue;
+        case CONFIG_KEY_WATCH_INTERVAL:
+            if (parse_entry_integer(value, &number) != 0 || number <= 0 || number > (long long)UINT32_MAX) {
+                internal_log_write("WARNING", "Invalid WatchInterval value at line %zu: %.*s (using default %d ms)",
+                                  line_number, (int)value.length, value.data, PT_DEFAULT_WATCH_INTERVAL_MS);
+                ctx->watch_interval_ms = 0;
+            } else {
+                ctx->watch_interval_ms = (uint32_t)number;
+                internal_log_write("INFO", "WatchInterval configuration: %lld ms", number);
+            }
+            break;
+        case CONFIG_KEY_PRELOAD: {
+            int preload = parse_entry_boolean(value);
+            ctx->preload_plugins = preload;
+            internal_log_write("INFO", "Preload configuration: %d (%s)",
+                              preload, preload ? "target plugins loaded in background after rules" : "target plugins loaded on first use");
+            break;
         }
-        
-        if (len >= 2 && trimmed_line[0] == '[' && trimmed_line[len - 1] == ']') {
-            size_t section_len = len - 2;
-            if (section_len >= sizeof(current_section)) {
-                section_len = sizeof(current_section) - 1;
-                internal_log_write("WARNING", "parse_entry_plugin_config: line %zu section name exceeds buffer size (%zu), truncated", 
-                    line_number, sizeof(current_section));
+        case CONFIG_KEY_PRELOAD_BIND_NOW: {
+            int bind_now = parse_entry_boolean(value);
+            ctx->preload_bind_now = bind_now;
+            internal_log_write("INFO", "PreloadBindNow configuration: %d", bind_now);
+            break;
+        }
+        case CONFIG_KEY_MAX_LOADED_PLUGINS:
+            if (parse_entry_integer(value, &number) != 0 || number < 0) {
+                internal_log_write("WARNING", "Invalid MaxLoadedPlugins value at line %zu: %.*s (no limit)",
+                                  line_number, (int)value.length, value.data);
+                ctx->max_loaded_plugins = 0;
+            } else {
+                /* 0表示不限制 / 0 means unlimited / 0 bedeutet unbegrenzt */
+                ctx->max_loaded_plugins = (size_t)number;
+                internal_log_write("INFO", "MaxLoadedPlugins configuration: %lld%s", number, number == 0 ? " (unlimited)" : "");
             }
-            memcpy(current_section, trimmed_line + 1, section_len);
-            current_section[section_len] = '\0';
-            
-            if (strcmp(current_section, "EntryPlugin") == 0) {
-                in_entry_section = 1;
+            break;
+        case CONFIG_KEY_UNLOAD_IDLE_AFTER:
+            if (parse_entry_integer(value, &number) != 0 || number < 0 || number > (long long)UINT32_MAX) {
+                internal_log_write("WARNING", "Invalid UnloadIdleAfter value at line %zu: %.*s (idle plugins stay loaded)",
+                                  line_number, (int)value.length, value.data);
+                ctx->unload_idle_after_ms = 0;
             } else {
-                in_entry_section = 0;
+                ctx->unload_idle_after_ms = (uint32_t)number;
+                internal_log_write("INFO", "UnloadIdleAfter configuration: %lld ms%s", number, number == 0 ? " (disabled)" : "");
             }
-            continue;
+            break;
+        case CONFIG_KEY_WATCH_PLUGINS: {
+            int watch_plugins = parse_entry_boolean(value);
+            ctx->watch_plugins = watch_plugins;
+            internal_log_write("INFO", "WatchPlugins configuration: %d (%s)",
+                              watch_plugins, watch_plugins ? "changed plugin libraries hot-swapped" : "plugin file watching disabled");
+            break;
         }
-        
-        if (in_entry_section) {
-            char key[512];
-            char value[2048];
-            if (parse_key_value_simple(trimmed_line, key, sizeof(key), value, sizeof(value))) {
-                trim_string(key);
-                trim_string(value);
+        case CONFIG_KEY_MANIFEST_MAX_ENTRIES:
+            if (parse_entry_integer(value, &number) != 0 || number < 0) {
+                internal_log_write("WARNING", "Invalid ManifestMaxEntries value at line %zu: %.*s (using default)",
+                                  line_number, (int)value.length, value.data);
+                ctx->manifest_max_entries = 0;
+            } else {
+                /* 0表示使用默认上限 / 0 means the default limit / 0 bedeutet Standardgrenze */
+                ctx->manifest_max_entries = (size_t)number;
+                internal_log_write("INFO", "ManifestMaxEntries configuration: %lld%s", number, number == 0 ? " (default)" : "");
+            }
+            break;
+        case CONFIG_KEY_VALIDATION_PENDING:
+            if (config_span_equals(value, "wait") || config_span_equals(value, "Wait")) {
+                ctx->validation_pending = VALIDATION_PENDING_WAIT;
+            } else if (config_span_equals(value, "skip") || config_span_equals(value, "Skip")) {
+                ctx->validation_pending = VALIDATION_PENDING_SKIP;
+            } else if (config_span_equals(value, "call") || config_span_equals(value, "Call")) {
+                ctx->validation_pending = VALIDATION_PENDING_CALL;
+            } else {
+                internal_log_write("WARNING", "Invalid ValidationPending value at line %zu: %.*s (using wait)",
+                                  line_number, (int)value.length, value.data);
+                ctx->validation_pending = VALIDATION_PENDING_WAIT;
+                break;
+            }
+            internal_log_write("INFO", "ValidationPending configuration: %.*s", (int)value.length, value.data);
+            break;
+        case CONFIG_KEY_TRIAL_CALLS:
+            /* 其余插件只做静态验证 / All other plugins are validated statically only / Alle anderen Plugins werden nur statisch validiert */
+            free(ctx->trial_call_plugins);
+            ctx->trial_call_plugins = copy_config_span(value);
+            internal_log_write("INFO", "TrialCalls configuration: %.*s", (int)value.length, value.data);
+            break;
+        case CONFIG_KEY_CACHE_PLUGIN_METADATA: {
+            int cache_metadata = parse_entry_boolean(value);
+            ctx->disable_metadata_cache = cache_metadata ? 0 : 1;
+            internal_log_write("INFO", "CachePluginMetadata configuration: %d (%s)",
+                              cache_metadata, cache_metadata ? "interface metadata cached in validation database" : "interface metadata queried from plugins");
+            break;
+        }
+        case CONFIG_KEY_IGNORE_PLUGINS: {
+            /* 解析忽略插件列表（逗号分隔） / Parse ignored plugins list (comma-separated) / Liste der ignorierten Plugins parsen (kommagetrennt) */
+            const char* cursor = value.data;
+            const char* end = value.data + value.length;
+            while (cursor < end) {
+                const char* comma = (const char*)memchr(cursor, ',', (size_t)(end - cursor));
+                const char* token_end = comma != NULL ? comma : end;
+                config_span_t token;
+                token.data = cursor;
+                token.length = (size_t)(token_end - cursor);
                 
-                /* 检查键值长度 / Check key/value length / Schlüssel-/Wertlänge prüfen */
-                size_t key_len = strlen(key);
-                size_t value_len = strlen(value);
-                if (key_len >= sizeof(key) - 1) {
-                    internal_log_write("WARNING", "parse_entry_plugin_config: line %zu key exceeds buffer size (%zu), truncated", 
-                        line_number, sizeof(key));
+                /* 去除前后空白字符 / Trim whitespace / Leerzeichen entfernen */
+                while (token.length > 0 && (token.data[0] == ' ' || token.data[0] == '\t')) {
+                    token.data++;
+                    token.length--;
                 }
-                if (value_len >= sizeof(value) - 1) {
-                    internal_log_write("WARNING", "parse_entry_plugin_config: line %zu value exceeds buffer size (%zu), truncated", 
-                        line_number, sizeof(value));
+                while (token.length > 0 && (token.data[token.length - 1] == ' ' || token.data[token.length - 1] == '\t')) {
+                    token.length--;
                 }
-                
-                parse_entry_key_value(ctx, key, value, line_number);
+                if (token.length > 0) {
+                    add_ignored_plugin(ctx, token);
+                }
+                cursor = comma != NULL ? comma + 1 : end;
             }
+            break;
         }
+        default:
+            break;
     }
-    
-    free(line_buffer);
-    fclose(fp);
-    
+}
+
+/**
+ * @brief 检查入口配置是否完整 / Check whether entry configuration is complete / Prüfen, ob die Einstiegskonfiguration vollständig ist
+ * @return 完整返回0，否则返回CONFIG_ERR_INCOMPLETE / Returns 0 if complete, CONFIG_ERR_INCOMPLETE otherwise / Gibt 0 zurück wenn vollständig, sonst CONFIG_ERR_INCOMPLETE
+ */
+static int check_entry_plugin_config(pointer_transfer_context_t* ctx) {
     if (ctx->entry_plugin_name != NULL && ctx->entry_nxpt_path != NULL) {
         internal_log_write("INFO", "Entry plugin config: name=%s, path=%s, nxpt=%s", 
             ctx->entry_plugin_name, 
@@ -225,3 +310,68 @@ int parse_entry_plugin_config(const char* config_path) {
     }
 }
 
+/**
+ * @brief 应用[EntryPlugin]段的键值 / Apply [EntryPlugin] section key-values / Schlüssel-Werte des [EntryPlugin]-Abschnitts anwenden
+ */
+int apply_entry_plugin_items(const char* config_path, const config_key_value_t* items, size_t item_count) {
+    if (config_path == NULL || (items == NULL && item_count > 0)) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "apply_entry_plugin_items: global context is NULL");
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    internal_log_write("INFO", "Applying entry plugin config from: %s", config_path);
+    for (size_t i = 0; i < item_count; i++) {
+        apply_entry_key_value(ctx, &items[i]);
+    }
+    
+    return check_entry_plugin_config(ctx);
+}
+
+/**
+ * @brief 解析入口插件配置 / Parse entry plugin configuration / Einstiegs-Plugin-Konfiguration parsen
+ * @details 只读取[EntryPlugin]段；插件初始化通过load_transfer_rules_with_entry在规则扫描中一并完成 / Reads only the [EntryPlugin] section; plugin initialization does this within the rule pass via load_transfer_rules_with_entry / Liest nur den [EntryPlugin]-Abschnitt; die Plugin-Initialisierung erledigt dies im Regeldurchlauf über load_transfer_rules_with_entry
+ */
+int parse_entry_plugin_config(const char* config_path) {
+    if (config_path == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pt_platform_file_map_t* map = pt_platform_file_map_open(config_path);
+    if (map == NULL) {
+        internal_log_write("WARNING", "Failed to open entry plugin config file: %s", config_path);
+        return CONFIG_ERR_FILE_OPEN;
+    }
+    
+    internal_log_write("INFO", "Parsing entry plugin config file: %s", config_path);
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "parse_entry_plugin_config: global context is NULL");
+        pt_platform_file_map_close(map);
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    config_tokenizer_t tokenizer;
+    config_token_t token;
+    int in_entry_section = 0;
+    config_tokenizer_init(&tokenizer, (const char*)pt_platform_file_map_data(map), pt_platform_file_map_size(map));
+    while (config_tokenizer_next(&tokenizer, &token)) {
+        if (token.type == CONFIG_TOKEN_SECTION) {
+            in_entry_section = config_span_equals(token.name, "EntryPlugin");
+        } else if (in_entry_section && CONFIG_KEY_IS_ENTRY(token.key_id)) {
+            config_key_value_t item;
+            item.key_id = token.key_id;
+            item.value = token.value;
+            item.line_number = token.line_number;
+            apply_entry_key_value(ctx, &item);
+        }
+    }
+    pt_platform_file_map_close(map);
+    
+    return check_entry_plugin_config(ctx);
+}
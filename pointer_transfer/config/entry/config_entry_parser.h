@@ -6,6 +6,9 @@
 #ifndef CONFIG_ENTRY_PARSER_H
 #define CONFIG_ENTRY_PARSER_H
 
+#include "../tokenizer/config_tokenizer.h"
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +20,15 @@ extern "C" {
  */
 int parse_entry_plugin_config(const char* config_path);
 
+/**
+ * @brief 应用[EntryPlugin]段的键值 / Apply [EntryPlugin] section key-values / Schlüssel-Werte des [EntryPlugin]-Abschnitts anwenden
+ * @param config_path 配置文件路径（用于日志） / Configuration file path (for logging) / Konfigurationsdateipfad (für Protokollierung)
+ * @param items 键值数组（值必须在调用期间有效） / Key-value array (values must stay valid during the call) / Schlüssel-Wert-Array (Werte müssen während des Aufrufs gültig bleiben)
+ * @param item_count 键值数量 / Key-value count / Anzahl der Schlüssel-Werte
+ * @return 配置完整返回0，否则返回非0 / Returns 0 if the configuration is complete, non-zero otherwise / Gibt 0 zurück wenn die Konfiguration vollständig ist, sonst ungleich 0
+ */
+int apply_entry_plugin_items(const char* config_path, const config_key_value_t* items, size_t item_count);
+
 #ifdef __cplusplus
 }
 #endif
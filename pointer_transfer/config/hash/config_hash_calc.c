@@ -4,6 +4,7 @@
  */
 
 #include "config_hash_calc.h"
+#include <stddef.h>
 #include <stdint.h>
 
 /**
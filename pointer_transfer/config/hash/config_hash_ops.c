@@ -1,92 +1,27 @@
 /**
  * @file config_hash_ops.c
- * @brief 哈希表操作函数 / Hash Table Operations / Hash-Tabellen-Operationen
+ * @brief .nxpt加载状态操作 / .nxpt Load Status Operations / .nxpt-Ladestatus-Operationen
  */
 
 #include "config_hash_ops.h"
-#include "config_hash_calc.h"
-#include "config_hash_table.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_plugin_loader.h"
 #include "pointer_transfer_types.h"
 #include "pointer_transfer_utils.h"
-#include <stdlib.h>
-#include <string.h>
-#include <limits.h>
 
 /**
- * @brief 清理已加载.nxpt文件哈希表 / Cleanup loaded .nxpt files hash table / Geladene .nxpt-Dateien-Hash-Tabelle bereinigen
- */
-void free_nxpt_hash_table_internal(void) {
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        return;
-    }
-    
-    nxpt_hash_table_t* hash_table = &ctx->nxpt_hash_table;
-    if (hash_table->buckets == NULL) {
-        return;
-    }
-    
-    for (size_t i = 0; i < hash_table->bucket_count; i++) {
-        nxpt_hash_node_t* node = hash_table->buckets[i];
-        while (node != NULL) {
-            nxpt_hash_node_t* next = node->next;
-            free(node);
-            node = next;
-        }
-    }
-    
-    free(hash_table->buckets);
-    hash_table->buckets = NULL;
-    hash_table->bucket_count = 0;
-    hash_table->entry_count = 0;
-}
-
-/**
- * @brief 查询.nxpt文件加载状态（使用哈希表优化）/ Query .nxpt file load status (optimized with hash table) / .nxpt-Datei-Ladestatus abfragen (mit Hash-Tabelle optimiert)
+ * @brief 查询.nxpt文件加载状态（注册表哈希查找）/ Query .nxpt file load status (registry hash lookup) / .nxpt-Datei-Ladestatus abfragen (Registry-Hash-Suche)
  */
 int is_nxpt_loaded(const char* plugin_name) {
     if (plugin_name == NULL) {
         return 0;
     }
     
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        return 0;
-    }
-    
-    /* 如果数组为空，直接返回 / If array is empty, return directly / Wenn Array leer ist, direkt zurückgeben */
-    if (ctx->loaded_nxpt_files == NULL || ctx->loaded_nxpt_count == 0) {
-        return 0;
-    }
-    
-    /* 使用哈希表查找 / Use hash table lookup / Hash-Tabelle-Suche verwenden */
-    nxpt_hash_table_t* hash_table = &ctx->nxpt_hash_table;
-    if (hash_table->buckets != NULL && hash_table->bucket_count > 0) {
-        uint64_t hash_key = hash_plugin_name(plugin_name);
-        size_t bucket = hash_key % hash_table->bucket_count;
-        
-        nxpt_hash_node_t* node = hash_table->buckets[bucket];
-        while (node != NULL) {
-            if (node->hash_key == hash_key && 
-                node->array_index < ctx->loaded_nxpt_count &&
-                ctx->loaded_nxpt_files[node->array_index].plugin_name != NULL &&
-                strcmp(ctx->loaded_nxpt_files[node->array_index].plugin_name, plugin_name) == 0) {
-                return ctx->loaded_nxpt_files[node->array_index].loaded;
-            }
-            node = node->next;
-        }
-    } else {
-        /* 哈希表未初始化，回退到线性搜索 / Hash table not initialized, fall back to linear search / Hash-Tabelle nicht initialisiert, auf lineare Suche zurückgreifen */
-        for (size_t i = 0; i < ctx->loaded_nxpt_count; i++) {
-            if (ctx->loaded_nxpt_files[i].plugin_name != NULL &&
-                strcmp(ctx->loaded_nxpt_files[i].plugin_name, plugin_name) == 0) {
-                return ctx->loaded_nxpt_files[i].loaded;
-            }
-        }
-    }
+    /* 预加载线程会写入注册表 / The preload thread writes the registry / Der Vorladethread schreibt die Registry */
+    wait_for_plugin_preload();
     
-    return 0;
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+    return entry != NULL ? entry->nxpt_loaded : 0;
 }
 
 /**
@@ -100,67 +35,22 @@ int mark_nxpt_loaded(const char* plugin_name, const char* nxpt_path) {
         return -1;
     }
     
-    if (is_nxpt_loaded(plugin_name)) {
-        return 0;
-    }
-    
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        internal_log_write("ERROR", "mark_nxpt_loaded: global context is NULL");
-        return -1;
-    }
-    
-    /* 检查是否需要扩容 / Check if capacity expansion is needed / Prüfen, ob Kapazitätserweiterung erforderlich ist */
-    if (ctx->loaded_nxpt_count >= ctx->loaded_nxpt_capacity) {
-        size_t new_capacity = ctx->loaded_nxpt_capacity == 0 ? 8 : ctx->loaded_nxpt_capacity * 2;
-        
-        /* 检查溢出 / Check overflow / Überlauf prüfen */
-        if (new_capacity > SIZE_MAX / sizeof(loaded_nxpt_info_t)) {
-            internal_log_write("ERROR", "mark_nxpt_loaded: capacity overflow detected (new_capacity=%zu)", new_capacity);
-            return -5;
-        }
-        
-        loaded_nxpt_info_t* new_files = (loaded_nxpt_info_t*)realloc(ctx->loaded_nxpt_files, new_capacity * sizeof(loaded_nxpt_info_t));
-        if (new_files == NULL) {
-            internal_log_write("ERROR", "mark_nxpt_loaded: failed to allocate memory for nxpt files array (new_capacity=%zu)", new_capacity);
-            return -3;
-        }
-        memset(new_files + ctx->loaded_nxpt_count, 0, (new_capacity - ctx->loaded_nxpt_count) * sizeof(loaded_nxpt_info_t));
-        ctx->loaded_nxpt_files = new_files;
-        ctx->loaded_nxpt_capacity = new_capacity;
-    }
-    
-    /* 分配字符串并检查失败 / Allocate strings and check for failures / Zeichenfolgen zuweisen und auf Fehler prüfen */
-    loaded_nxpt_info_t* info = &ctx->loaded_nxpt_files[ctx->loaded_nxpt_count];
-    info->plugin_name = NULL;
-    info->nxpt_path = NULL;
-    info->loaded = 0;
+    wait_for_plugin_preload();
     
-    info->plugin_name = allocate_string(plugin_name);
-    if (info->plugin_name == NULL) {
-        internal_log_write("ERROR", "mark_nxpt_loaded: failed to allocate memory for plugin_name");
+    plugin_registry_entry_t* entry = get_or_create_plugin_registry_entry(plugin_name);
+    if (entry == NULL) {
+        internal_log_write("ERROR", "mark_nxpt_loaded: failed to create registry entry for %s", plugin_name);
         return -3;
     }
+    if (entry->nxpt_loaded) {
+        return 0;
+    }
     
-    info->nxpt_path = allocate_string(nxpt_path);
-    if (info->nxpt_path == NULL) {
+    entry->nxpt_path = intern_plugin_registry_string(nxpt_path);
+    if (entry->nxpt_path == NULL) {
         internal_log_write("ERROR", "mark_nxpt_loaded: failed to allocate memory for nxpt_path");
-        free(info->plugin_name);
-        info->plugin_name = NULL;
         return -3;
     }
-    
-    info->loaded = 1;
-    size_t new_index = ctx->loaded_nxpt_count;
-    ctx->loaded_nxpt_count++;
-    
-    /* 将新条目插入哈希表 / Insert new entry into hash table / Neuen Eintrag in Hash-Tabelle einfügen */
-    uint64_t hash_key = hash_plugin_name(plugin_name);
-    if (insert_into_nxpt_hash_table(&ctx->nxpt_hash_table, hash_key, new_index) != 0) {
-        /* 哈希表插入失败不影响核心功能逻辑，仅记录警告信息 / Hash table insertion failure does not affect core functionality logic, only log warning message / Hash-Tabelle-Einfügung-Fehler beeinflusst Kernfunktionalitätslogik nicht, nur Warnmeldung protokollieren */
-        internal_log_write("WARNING", "mark_nxpt_loaded: failed to insert into hash table, falling back to linear search");
-    }
-    
+    entry->nxpt_loaded = 1;
     return 0;
 }
-
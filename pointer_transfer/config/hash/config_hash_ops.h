@@ -1,6 +1,6 @@
 /**
  * @file config_hash_ops.h
- * @brief 哈希表操作函数接口 / Hash Table Operations Interface / Hash-Tabellen-Operationen-Schnittstelle
+ * @brief .nxpt加载状态操作接口 / .nxpt Load Status Operations Interface / Schnittstelle der .nxpt-Ladestatus-Operationen
  */
 
 #ifndef CONFIG_HASH_OPS_H
@@ -10,11 +10,6 @@
 extern "C" {
 #endif
 
-/**
- * @brief 清理已加载.nxpt文件哈希表 / Cleanup loaded .nxpt files hash table / Geladene .nxpt-Dateien-Hash-Tabelle bereinigen
- */
-void free_nxpt_hash_table_internal(void);
-
 /**
  * @brief 查询.nxpt文件加载状态（使用哈希表优化）/ Query .nxpt file load status (optimized with hash table) / .nxpt-Datei-Ladestatus abfragen (mit Hash-Tabelle optimiert)
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -0,0 +1,77 @@
+/**
+ * @file config_reload.h
+ * @brief 规则热重载内部接口 / Rules Hot Reload Internal Interface / Interne Schnittstelle für Regel-Hot-Reload
+ */
+
+#ifndef CONFIG_RELOAD_H
+#define CONFIG_RELOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/**
+ * @brief 创建规则集锁、规则源锁和目标加载锁 / Create rule set lock, rule source lock and target load lock / Regelsatz-Sperre, Regelquellen-Sperre und Ziel-Lade-Sperre erstellen
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int init_rule_set_lock(void);
+    
+/**
+ * @brief 获取当前线程持有的规则集读锁深度 / Get rule set read lock depth held by current thread / Vom aktuellen Thread gehaltene Regelsatz-Lesesperrtiefe abrufen
+ * @return 读锁深度 / Read lock depth / Lesesperrtiefe
+ */
+int get_rule_set_read_depth(void);
+    
+/**
+ * @brief 获取规则集写锁 / Acquire rule set write lock / Regelsatz-Schreibsperre erwerben
+ */
+void acquire_rule_set_write(void);
+    
+/**
+ * @brief 释放规则集写锁 / Release rule set write lock / Regelsatz-Schreibsperre freigeben
+ */
+void release_rule_set_write(void);
+    
+/**
+ * @brief 锁定规则源列表 / Lock rule source list / Regelquellen-Liste sperren
+ */
+void lock_rule_sources(void);
+    
+/**
+ * @brief 解锁规则源列表 / Unlock rule source list / Regelquellen-Liste entsperren
+ */
+void unlock_rule_sources(void);
+    
+/**
+ * @brief 锁定目标插件加载 / Lock target plugin loading / Ziel-Plugin-Laden sperren
+ * @details 读锁下加载被卸载的目标插件和绑定接口状态时持有 / Held while evicted target plugins are loaded and interface states bound under the read lock / Wird gehalten, während entladene Ziel-Plugins unter der Lesesperre geladen und Schnittstellenstatus gebunden werden
+ */
+void lock_target_loads(void);
+    
+/**
+ * @brief 解锁目标插件加载 / Unlock target plugin loading / Ziel-Plugin-Laden entsperren
+ */
+void unlock_target_loads(void);
+    
+/**
+ * @brief 复制规则源文件路径 / Copy rule source file path / Regelquelldateipfad kopieren
+ * @param index 规则源索引 / Rule source index / Regelquellen-Index
+ * @return 成功返回路径副本（调用者释放），索引越界或失败返回NULL / Returns path copy (caller frees), NULL if out of range or on failure / Gibt Pfadkopie zurück (Aufrufer gibt frei), NULL bei Bereichsüberschreitung oder Fehler
+ */
+char* copy_rule_source_path(size_t index);
+    
+/**
+ * @brief 更新规则源文件时间戳 / Update rule source file timestamp / Regelquelldatei-Zeitstempel aktualisieren
+ * @param path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @param timestamp 修改时间戳 / Modification timestamp / Änderungszeitstempel
+ */
+void update_rule_source_timestamp(const char* path, int64_t timestamp);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_RELOAD_H */
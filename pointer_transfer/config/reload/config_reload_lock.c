@@ -0,0 +1,131 @@
+/**
+ * @file config_reload_lock.c
+ * @brief 规则集读写锁 / Rule Set Read-Write Lock / Regelsatz-Lese-Schreib-Sperre
+ */
+
+#include "config_reload.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stddef.h>
+
+/* 规则集读写锁：调用路径持读锁，重载持写锁 / Rule set read-write lock: call paths hold read, reload holds write / Regelsatz-Lese-Schreib-Sperre: Aufrufpfade halten Lesesperre, Neuladen hält Schreibsperre */
+static pt_platform_rwlock_t* g_rule_set_lock = NULL;
+
+/* 规则源列表互斥锁 / Rule source list mutex / Regelquellen-Listen-Mutex */
+static pt_platform_mutex_t* g_rule_source_lock = NULL;
+
+/* 目标插件加载互斥锁：读锁下重新加载被卸载的插件并重新绑定接口状态 / Target load mutex: reloads evicted plugins and rebinds interface states under the read lock / Ziel-Lade-Mutex: lädt entladene Plugins unter der Lesesperre neu und bindet Schnittstellenstatus neu */
+static pt_platform_mutex_t* g_target_load_lock = NULL;
+
+/* 每线程读锁深度（插件回调会重入CallPlugin） / Per-thread read lock depth (plugin callbacks re-enter CallPlugin) / Thread-lokale Lesesperrtiefe (Plugin-Rückrufe treten erneut in CallPlugin ein) */
+static PT_THREAD_LOCAL int g_rule_set_read_depth = 0;
+
+/**
+ * @brief 创建规则集锁、规则源锁和目标加载锁 / Create rule set lock, rule source lock and target load lock / Regelsatz-Sperre, Regelquellen-Sperre und Ziel-Lade-Sperre erstellen
+ */
+int init_rule_set_lock(void) {
+    if (g_rule_set_lock == NULL) {
+        g_rule_set_lock = pt_platform_rwlock_create();
+    }
+    if (g_rule_source_lock == NULL) {
+        g_rule_source_lock = pt_platform_mutex_create();
+    }
+    if (g_target_load_lock == NULL) {
+        g_target_load_lock = pt_platform_mutex_create();
+    }
+    if (g_rule_set_lock == NULL || g_rule_source_lock == NULL || g_target_load_lock == NULL) {
+        internal_log_write("ERROR", "init_rule_set_lock: failed to create rule set locks");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 释放规则集锁 / Free rule set lock / Regelsatz-Sperre freigeben
+ */
+void free_rule_set_lock(void) {
+    if (g_rule_set_lock != NULL) {
+        pt_platform_rwlock_destroy(g_rule_set_lock);
+        g_rule_set_lock = NULL;
+    }
+    if (g_rule_source_lock != NULL) {
+        pt_platform_mutex_destroy(g_rule_source_lock);
+        g_rule_source_lock = NULL;
+    }
+    if (g_target_load_lock != NULL) {
+        pt_platform_mutex_destroy(g_target_load_lock);
+        g_target_load_lock = NULL;
+    }
+}
+
+/**
+ * @brief 获取规则集读锁（可重入） / Acquire rule set read lock (reentrant) / Regelsatz-Lesesperre erwerben (wiedereintrittsfähig)
+ * @details 仅最外层调用加锁，避免写者等待时嵌套读锁死锁 / Only the outermost call locks, so nested reads cannot deadlock behind a waiting writer / Nur der äußerste Aufruf sperrt, damit verschachtelte Lesezugriffe nicht hinter einem wartenden Schreiber blockieren
+ */
+void acquire_rule_set_read(void) {
+    if (g_rule_set_read_depth++ == 0) {
+        pt_platform_rwlock_read_lock(g_rule_set_lock);
+    }
+}
+
+/**
+ * @brief 释放规则集读锁 / Release rule set read lock / Regelsatz-Lesesperre freigeben
+ */
+void release_rule_set_read(void) {
+    if (g_rule_set_read_depth <= 0) {
+        return;
+    }
+    if (--g_rule_set_read_depth == 0) {
+        pt_platform_rwlock_read_unlock(g_rule_set_lock);
+    }
+}
+
+/**
+ * @brief 获取当前线程持有的规则集读锁深度 / Get rule set read lock depth held by current thread / Vom aktuellen Thread gehaltene Regelsatz-Lesesperrtiefe abrufen
+ */
+int get_rule_set_read_depth(void) {
+    return g_rule_set_read_depth;
+}
+
+/**
+ * @brief 获取规则集写锁 / Acquire rule set write lock / Regelsatz-Schreibsperre erwerben
+ */
+void acquire_rule_set_write(void) {
+    pt_platform_rwlock_write_lock(g_rule_set_lock);
+}
+
+/**
+ * @brief 释放规则集写锁 / Release rule set write lock / Regelsatz-Schreibsperre freigeben
+ */
+void release_rule_set_write(void) {
+    pt_platform_rwlock_write_unlock(g_rule_set_lock);
+}
+
+/**
+ * @brief 锁定规则源列表 / Lock rule source list / Regelquellen-Liste sperren
+ */
+void lock_rule_sources(void) {
+    pt_platform_mutex_lock(g_rule_source_lock);
+}
+
+/**
+ * @brief 解锁规则源列表 / Unlock rule source list / Regelquellen-Liste entsperren
+ */
+void unlock_rule_sources(void) {
+    pt_platform_mutex_unlock(g_rule_source_lock);
+}
+
+/**
+ * @brief 锁定目标插件加载 / Lock target plugin loading / Ziel-Plugin-Laden sperren
+ */
+void lock_target_loads(void) {
+    pt_platform_mutex_lock(g_target_load_lock);
+}
+
+/**
+ * @brief 解锁目标插件加载 / Unlock target plugin loading / Ziel-Plugin-Laden entsperren
+ */
+void unlock_target_loads(void) {
+    pt_platform_mutex_unlock(g_target_load_lock);
+}
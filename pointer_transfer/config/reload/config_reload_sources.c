@@ -0,0 +1,153 @@
+/**
+ * @file config_reload_sources.c
+ * @brief 规则源文件列表 / Rule Source File List / Regelquelldatei-Liste
+ */
+
+#include "config_reload.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 记录规则源文件 / Register rule source file / Regelquelldatei registrieren
+ * @details 已记录的文件只更新时间戳，保持首次加载顺序 / Already registered files only get their timestamp updated, keeping first-load order / Bereits registrierte Dateien erhalten nur einen neuen Zeitstempel, die Reihenfolge des ersten Ladens bleibt erhalten
+ */
+int register_rule_source(const char* config_path) {
+    if (config_path == NULL) {
+        return -1;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    int64_t timestamp = 0;
+    pt_platform_get_file_timestamp(config_path, &timestamp);
+    
+    lock_rule_sources();
+    for (size_t i = 0; i < ctx->rule_source_count; i++) {
+        if (strcmp(ctx->rule_sources[i].path, config_path) == 0) {
+            ctx->rule_sources[i].timestamp = timestamp;
+            unlock_rule_sources();
+            return 0;
+        }
+    }
+    
+    if (ctx->rule_source_count >= ctx->rule_source_capacity) {
+        size_t new_capacity = ctx->rule_source_capacity == 0 ? 4 : ctx->rule_source_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < ctx->rule_source_capacity || new_capacity > SIZE_MAX / sizeof(rule_source_t)) {
+            internal_log_write("ERROR", "register_rule_source: capacity overflow detected (current=%zu)", ctx->rule_source_capacity);
+            unlock_rule_sources();
+            return -1;
+        }
+        rule_source_t* new_sources = (rule_source_t*)realloc(ctx->rule_sources, new_capacity * sizeof(rule_source_t));
+        if (new_sources == NULL) {
+            internal_log_write("ERROR", "register_rule_source: failed to expand rule source list (new_capacity=%zu)", new_capacity);
+            unlock_rule_sources();
+            return -1;
+        }
+        ctx->rule_sources = new_sources;
+        ctx->rule_source_capacity = new_capacity;
+    }
+    
+    char* path_copy = allocate_string(config_path);
+    if (path_copy == NULL) {
+        unlock_rule_sources();
+        return -1;
+    }
+    ctx->rule_sources[ctx->rule_source_count].path = path_copy;
+    ctx->rule_sources[ctx->rule_source_count].timestamp = timestamp;
+    ctx->rule_source_count++;
+    unlock_rule_sources();
+    return 0;
+}
+
+/**
+ * @brief 释放规则源文件列表 / Free rule source file list / Regelquelldatei-Liste freigeben
+ */
+void free_rule_sources(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    lock_rule_sources();
+    if (ctx->rule_sources != NULL) {
+        for (size_t i = 0; i < ctx->rule_source_count; i++) {
+            if (ctx->rule_sources[i].path != NULL) {
+                free(ctx->rule_sources[i].path);
+                ctx->rule_sources[i].path = NULL;
+            }
+        }
+        free(ctx->rule_sources);
+        ctx->rule_sources = NULL;
+    }
+    ctx->rule_source_count = 0;
+    ctx->rule_source_capacity = 0;
+    unlock_rule_sources();
+}
+
+/**
+ * @brief 复制规则源文件路径 / Copy rule source file path / Regelquelldateipfad kopieren
+ */
+char* copy_rule_source_path(size_t index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return NULL;
+    }
+    
+    char* path_copy = NULL;
+    lock_rule_sources();
+    if (index < ctx->rule_source_count) {
+        path_copy = allocate_string(ctx->rule_sources[index].path);
+    }
+    unlock_rule_sources();
+    return path_copy;
+}
+
+/**
+ * @brief 更新规则源文件时间戳 / Update rule source file timestamp / Regelquelldatei-Zeitstempel aktualisieren
+ */
+void update_rule_source_timestamp(const char* path, int64_t timestamp) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || path == NULL) {
+        return;
+    }
+    
+    lock_rule_sources();
+    for (size_t i = 0; i < ctx->rule_source_count; i++) {
+        if (strcmp(ctx->rule_sources[i].path, path) == 0) {
+            ctx->rule_sources[i].timestamp = timestamp;
+            break;
+        }
+    }
+    unlock_rule_sources();
+}
+
+/**
+ * @brief 检查规则源文件是否在上次加载后被修改 / Check whether rule source files changed since last load / Prüfen, ob Regelquelldateien seit dem letzten Laden geändert wurden
+ */
+int rule_sources_changed(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return 0;
+    }
+    
+    int changed = 0;
+    lock_rule_sources();
+    for (size_t i = 0; i < ctx->rule_source_count && !changed; i++) {
+        int64_t timestamp = 0;
+        if (pt_platform_get_file_timestamp(ctx->rule_sources[i].path, &timestamp) == 0 &&
+            timestamp != ctx->rule_sources[i].timestamp) {
+            changed = 1;
+        }
+    }
+    unlock_rule_sources();
+    return changed;
+}
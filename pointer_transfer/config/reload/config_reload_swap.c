@@ -0,0 +1,388 @@
+/**
+ * @file config_reload_swap.c
+ * @brief 规则集重新加载和替换 / Rule Set Reload and Swap / Regelsatz neu laden und austauschen
+ */
+
+#include "config_reload.h"
+#include "../common/config_errors.h"
+#include "../rules/config_rules_loader.h"
+#include "../rules/config_rules_merger.h"
+#include "../compiled/config_compiled.h"
+#include "../arena/config_string_arena.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 暂存规则集结构体 / Staged rule set structure / Bereitgestellter Regelsatz-Struktur
+ */
+typedef struct {
+    pointer_transfer_rule_t* rules; /**< 所有源文件的规则（按源顺序） / Rules of all source files (in source order) / Regeln aller Quelldateien (in Quellreihenfolge) */
+    size_t rule_count;             /**< 规则数量 / Rule count / Regelanzahl */
+    size_t rule_capacity;          /**< 规则数组容量 / Rule array capacity / Regel-Array-Kapazität */
+    char** paths;                  /**< 源文件路径 / Source file paths / Quelldateipfade */
+    int64_t* timestamps;           /**< 解析前的源文件时间戳 / Source file timestamps taken before parsing / Vor dem Parsen erfasste Quelldatei-Zeitstempel */
+    size_t path_count;             /**< 源文件数量 / Source file count / Anzahl der Quelldateien */
+    config_string_arena_t** arenas; /**< 每个源文件的字符串内存区 / String arena of each source file / Zeichenfolgen-Arena jeder Quelldatei */
+} staged_rule_set_t;
+
+/**
+ * @brief 释放暂存规则集 / Free staged rule set / Bereitgestellten Regelsatz freigeben
+ */
+static void free_staged_rule_set(staged_rule_set_t* staged) {
+    free_parsed_transfer_rules(staged->rules, staged->rule_count);
+    if (staged->paths != NULL) {
+        for (size_t i = 0; i < staged->path_count; i++) {
+            if (staged->paths[i] != NULL) {
+                free(staged->paths[i]);
+            }
+        }
+        free(staged->paths);
+    }
+    if (staged->timestamps != NULL) {
+        free(staged->timestamps);
+    }
+    if (staged->arenas != NULL) {
+        for (size_t i = 0; i < staged->path_count; i++) {
+            destroy_config_string_arena(staged->arenas[i]);
+        }
+        free(staged->arenas);
+    }
+    memset(staged, 0, sizeof(staged_rule_set_t));
+}
+
+/**
+ * @brief 将单个文件的规则追加到暂存规则集（转移所有权） / Append one file's rules to staged rule set (transfers ownership) / Regeln einer Datei an bereitgestellten Regelsatz anhängen (überträgt Besitz)
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+static int append_staged_rules(staged_rule_set_t* staged, pointer_transfer_rule_t* rules, size_t rule_count) {
+    if (rule_count == 0) {
+        free_parsed_transfer_rules(rules, rule_count);
+        return CONFIG_ERR_SUCCESS;
+    }
+    
+    if (staged->rule_count > SIZE_MAX - rule_count) {
+        free_parsed_transfer_rules(rules, rule_count);
+        return CONFIG_ERR_OVERFLOW;
+    }
+    size_t needed = staged->rule_count + rule_count;
+    if (needed > staged->rule_capacity) {
+        size_t new_capacity = staged->rule_capacity == 0 ? needed : staged->rule_capacity;
+        while (new_capacity < needed) {
+            if (new_capacity > SIZE_MAX / CAPACITY_GROWTH_FACTOR) {
+                free_parsed_transfer_rules(rules, rule_count);
+                return CONFIG_ERR_OVERFLOW;
+            }
+            new_capacity *= CAPACITY_GROWTH_FACTOR;
+        }
+        if (new_capacity > SIZE_MAX / sizeof(pointer_transfer_rule_t)) {
+            free_parsed_transfer_rules(rules, rule_count);
+            return CONFIG_ERR_OVERFLOW;
+        }
+        pointer_transfer_rule_t* new_rules = (pointer_transfer_rule_t*)realloc(staged->rules, new_capacity * sizeof(pointer_transfer_rule_t));
+        if (new_rules == NULL) {
+            free_parsed_transfer_rules(rules, rule_count);
+            return CONFIG_ERR_MEMORY;
+        }
+        staged->rules = new_rules;
+        staged->rule_capacity = new_capacity;
+    }
+    
+    /* 按值移动规则，字符串所有权随之转移 / Move rules by value, string ownership moves with them / Regeln per Wert verschieben, Zeichenfolgenbesitz wandert mit */
+    memcpy(staged->rules + staged->rule_count, rules, rule_count * sizeof(pointer_transfer_rule_t));
+    staged->rule_count = needed;
+    free(rules);
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 在锁外解析所有规则源文件 / Parse all rule source files outside the lock / Alle Regelquelldateien außerhalb der Sperre parsen
+ * @return 成功返回0，任一文件失败返回错误码 / Returns 0 on success, error code if any file fails / Gibt 0 bei Erfolg zurück, Fehlercode wenn eine Datei fehlschlägt
+ */
+static int stage_rule_sources(staged_rule_set_t* staged) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    lock_rule_sources();
+    size_t source_count = ctx->rule_source_count;
+    unlock_rule_sources();
+    if (source_count == 0) {
+        return CONFIG_ERR_SUCCESS;
+    }
+    
+    staged->paths = (char**)calloc(source_count, sizeof(char*));
+    staged->timestamps = (int64_t*)calloc(source_count, sizeof(int64_t));
+    staged->arenas = (config_string_arena_t**)calloc(source_count, sizeof(config_string_arena_t*));
+    if (staged->paths == NULL || staged->timestamps == NULL || staged->arenas == NULL) {
+        return CONFIG_ERR_MEMORY;
+    }
+    
+    for (size_t i = 0; i < source_count; i++) {
+        char* path = copy_rule_source_path(i);
+        if (path == NULL) {
+            return CONFIG_ERR_MEMORY;
+        }
+        staged->paths[i] = path;
+        staged->path_count++;
+        
+        /* 解析前取时间戳，解析期间的修改会触发下一次重载 / Timestamp is taken before parsing, so edits during parsing trigger another reload / Zeitstempel wird vor dem Parsen erfasst, Änderungen während des Parsens lösen ein weiteres Neuladen aus */
+        pt_platform_get_file_timestamp(path, &staged->timestamps[i]);
+        
+        compiled_source_stamp_t stamp;
+        int have_stamp = compute_rule_source_stamp(path, &stamp) == CONFIG_ERR_SUCCESS;
+        
+        parsed_rules_file_t parsed;
+        int result = parse_transfer_rules_file(path, &parsed);
+        if (result != CONFIG_ERR_SUCCESS) {
+            internal_log_write("ERROR", "reload_transfer_rules: failed to parse %s (error %d)", path, result);
+            return result;
+        }
+        
+        apply_config_file_settings(&parsed.settings);
+        
+        /* 刷新编译缓存，下次启动直接映射 / Refresh the compiled cache so the next start maps it directly / Kompilierten Cache auffrischen, damit der nächste Start ihn direkt zuordnet */
+        if (have_stamp) {
+            write_compiled_rules(path, &stamp, &parsed);
+        }
+        
+        pointer_transfer_rule_t* rules = parsed.rules;
+        size_t rule_count = parsed.rule_count;
+        for (size_t j = 0; j < rule_count; j++) {
+            if (rules[j].transfer_mode == 0) {
+                rules[j].transfer_mode = TRANSFER_MODE_UNICAST;
+            }
+        }
+        
+        /* 规则所有权转给暂存集，入口段在重载时不重新应用 / Rule ownership moves to the staged set, the entry section is not reapplied on reload / Regelbesitz geht an den bereitgestellten Satz, der Einstiegsabschnitt wird beim Neuladen nicht erneut angewendet */
+        staged->arenas[i] = parsed.strings;
+        parsed.strings = NULL;
+        parsed.rules = NULL;
+        parsed.rule_count = 0;
+        free_parsed_rules_file(&parsed);
+        result = append_staged_rules(staged, rules, rule_count);
+        if (result != CONFIG_ERR_SUCCESS) {
+            internal_log_write("ERROR", "reload_transfer_rules: failed to stage rules from %s (error %d)", path, result);
+            return result;
+        }
+    }
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 已安装规则集结构体（上下文中随规则一起替换的全部字段） / Installed rule set structure (all context fields swapped together with the rules) / Installierter Regelsatz-Struktur (alle Kontextfelder, die zusammen mit den Regeln ausgetauscht werden)
+ */
+typedef struct {
+    pointer_transfer_rule_t* rules; /**< 规则数组 / Rules array / Regel-Array */
+    size_t rule_count;             /**< 规则数量 / Rule count / Regelanzahl */
+    size_t rule_capacity;          /**< 规则数组容量 / Rule array capacity / Regel-Array-Kapazität */
+    rule_hash_table_t rule_hash_table; /**< 规则哈希表 / Rule hash table / Regel-Hash-Tabelle */
+    size_t* cached_rule_indices;   /**< 缓存的规则索引数组 / Cached rule indices array / Gecachte Regelindex-Array */
+    size_t cached_rule_count;      /**< 缓存的规则数量 / Cached rule count / Anzahl gecachter Regeln */
+    rule_graph_t rule_graph;       /**< 规则图 / Rule graph / Regelgraph */
+    size_t cloned_node_count;      /**< 复制规则图时上下文中的节点数量 / Context node count when the rule graph was cloned / Knotenanzahl im Kontext beim Klonen des Regelgraphen */
+    void** compiled_rule_maps;     /**< .nxptc映射 / .nxptc mappings / .nxptc-Zuordnungen */
+    size_t compiled_rule_map_count; /**< .nxptc映射数量 / .nxptc mapping count / Anzahl der .nxptc-Zuordnungen */
+    size_t compiled_rule_map_capacity; /**< .nxptc映射数组容量 / .nxptc mapping array capacity / Kapazität des .nxptc-Zuordnungs-Arrays */
+    void** string_arenas;          /**< 字符串内存区 / String arenas / Zeichenfolgen-Arenen */
+    size_t string_arena_count;     /**< 字符串内存区数量 / String arena count / Anzahl der Zeichenfolgen-Arenen */
+    size_t string_arena_capacity;  /**< 字符串内存区数组容量 / String arena array capacity / Kapazität des Zeichenfolgen-Arena-Arrays */
+} installed_rule_set_t;
+
+/**
+ * @brief 释放已安装规则集 / Free installed rule set / Installierten Regelsatz freigeben
+ * @details 先释放规则，再关闭规则引用的映射和内存区 / Rules are freed first, then the mappings and arenas they reference / Zuerst werden die Regeln freigegeben, dann die von ihnen referenzierten Zuordnungen und Arenen
+ */
+static void free_installed_rule_set(installed_rule_set_t* set) {
+    free_parsed_transfer_rules(set->rules, set->rule_count);
+    free_hash_table_for_index(&set->rule_hash_table);
+    if (set->cached_rule_indices != NULL) {
+        free(set->cached_rule_indices);
+    }
+    release_rule_graph(&set->rule_graph);
+    for (size_t i = 0; i < set->compiled_rule_map_count; i++) {
+        pt_platform_file_map_close((pt_platform_file_map_t*)set->compiled_rule_maps[i]);
+    }
+    if (set->compiled_rule_maps != NULL) {
+        free(set->compiled_rule_maps);
+    }
+    for (size_t i = 0; i < set->string_arena_count; i++) {
+        destroy_config_string_arena((config_string_arena_t*)set->string_arenas[i]);
+    }
+    if (set->string_arenas != NULL) {
+        free(set->string_arenas);
+    }
+    memset(set, 0, sizeof(installed_rule_set_t));
+}
+
+/**
+ * @brief 在上下文之外构建新规则集的规则图 / Build the new rule set's rule graph outside the context / Regelgraph des neuen Regelsatzes außerhalb des Kontexts erstellen
+ * @details 先复制当前驻留节点，使进行中调用持有的节点ID和记忆化键在替换后仍然有效 / The currently interned nodes are copied first so node IDs and memo keys held by in-flight calls stay valid after the swap / Die aktuell internierten Knoten werden zuerst kopiert, damit Knoten-IDs und Memo-Schlüssel laufender Aufrufe nach dem Austausch gültig bleiben
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+static int build_installed_rule_graph(installed_rule_set_t* set, const rule_graph_t* current) {
+    release_rule_graph(&set->rule_graph);
+    set->cloned_node_count = current->node_count;
+    if (clone_rule_graph_nodes(&set->rule_graph, current) != 0) {
+        return -1;
+    }
+    return build_rule_graph_for_rules(&set->rule_graph, set->rules, set->rule_count);
+}
+
+/**
+ * @brief 将暂存规则集构建为完整的已安装规则集 / Build the staged rule set into a complete installed rule set / Bereitgestellten Regelsatz zu einem vollständigen installierten Regelsatz aufbauen
+ * @details 规则和内存区的所有权从暂存集转移；不触碰上下文中的规则集 / Ownership of rules and arenas moves from the staged set; the rule set in the context is not touched / Besitz von Regeln und Arenen geht vom bereitgestellten Satz über; der Regelsatz im Kontext bleibt unberührt
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+static int build_installed_rule_set(staged_rule_set_t* staged, installed_rule_set_t* set) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    set->rules = staged->rules;
+    set->rule_count = staged->rule_count;
+    set->rule_capacity = staged->rule_capacity;
+    staged->rules = NULL;
+    staged->rule_count = 0;
+    staged->rule_capacity = 0;
+    
+    if (staged->path_count > 0) {
+        set->string_arenas = (void**)calloc(staged->path_count, sizeof(void*));
+        if (set->string_arenas == NULL) {
+            return CONFIG_ERR_MEMORY;
+        }
+        set->string_arena_capacity = staged->path_count;
+        for (size_t i = 0; i < staged->path_count; i++) {
+            if (staged->arenas[i] != NULL) {
+                set->string_arenas[set->string_arena_count++] = staged->arenas[i];
+                staged->arenas[i] = NULL;
+            }
+        }
+    }
+    
+    if (build_rule_hash_table(&set->rule_hash_table, set->rules, set->rule_count) != 0) {
+        return CONFIG_ERR_MEMORY;
+    }
+    if (build_cached_rule_indices(set->rules, set->rule_count, &set->cached_rule_indices, &set->cached_rule_count) != 0) {
+        return CONFIG_ERR_MEMORY;
+    }
+    
+    acquire_rule_set_read();
+    int result = build_installed_rule_graph(set, &ctx->rule_graph);
+    release_rule_set_read();
+    return result == 0 ? CONFIG_ERR_SUCCESS : CONFIG_ERR_MEMORY;
+}
+
+/**
+ * @brief 交换上下文规则集与已安装规则集（调用方持有写锁） / Exchange the context rule set with an installed rule set (caller holds the write lock) / Kontext-Regelsatz mit installiertem Regelsatz tauschen (Aufrufer hält die Schreibsperre)
+ * @details 交换后set持有旧规则集 / After the exchange set holds the old rule set / Nach dem Tausch hält set den alten Regelsatz
+ */
+static void exchange_rule_set(pointer_transfer_context_t* ctx, installed_rule_set_t* set) {
+    installed_rule_set_t old;
+    old.rules = ctx->rules;
+    old.rule_count = ctx->rule_count;
+    old.rule_capacity = ctx->rule_capacity;
+    old.rule_hash_table = ctx->rule_hash_table;
+    old.cached_rule_indices = ctx->cached_rule_indices;
+    old.cached_rule_count = ctx->cached_rule_count;
+    old.rule_graph = ctx->rule_graph;
+    old.cloned_node_count = ctx->rule_graph.node_count;
+    old.compiled_rule_maps = ctx->compiled_rule_maps;
+    old.compiled_rule_map_count = ctx->compiled_rule_map_count;
+    old.compiled_rule_map_capacity = ctx->compiled_rule_map_capacity;
+    old.string_arenas = ctx->string_arenas;
+    old.string_arena_count = ctx->string_arena_count;
+    old.string_arena_capacity = ctx->string_arena_capacity;
+    
+    ctx->rules = set->rules;
+    ctx->rule_count = set->rule_count;
+    ctx->rule_capacity = set->rule_capacity;
+    ctx->rule_hash_table = set->rule_hash_table;
+    ctx->cached_rule_indices = set->cached_rule_indices;
+    ctx->cached_rule_count = set->cached_rule_count;
+    ctx->cached_rule_capacity = set->cached_rule_count;
+    ctx->rule_graph = set->rule_graph;
+    ctx->compiled_rule_maps = set->compiled_rule_maps;
+    ctx->compiled_rule_map_count = set->compiled_rule_map_count;
+    ctx->compiled_rule_map_capacity = set->compiled_rule_map_capacity;
+    ctx->string_arenas = set->string_arenas;
+    ctx->string_arena_count = set->string_arena_count;
+    ctx->string_arena_capacity = set->string_arena_capacity;
+    ctx->rule_graph_stale = 0;
+    pt_platform_atomic_store_int(&ctx->targets_prepared, 0);
+    
+    *set = old;
+}
+
+/**
+ * @brief 重新加载所有规则源文件并原子替换规则集 / Reload all rule source files and swap rule set atomically / Alle Regelquelldateien neu laden und Regelsatz atomar austauschen
+ * @details 新规则集（规则、索引、缓存、规则图和内存区）在锁外完整构建，写锁内只交换指针；任一步失败时保留当前规则集 / The new rule set (rules, index, cache, rule graph and arenas) is fully built outside the lock and only pointers are swapped under the write lock; on any failure the current rule set is kept / Der neue Regelsatz (Regeln, Index, Cache, Regelgraph und Arenen) wird außerhalb der Sperre vollständig aufgebaut, unter der Schreibsperre werden nur Zeiger getauscht; bei jedem Fehler bleibt der aktuelle Regelsatz erhalten
+ */
+int reload_transfer_rules(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "reload_transfer_rules: global context is NULL");
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    /* 调用路径内持有读锁时获取写锁会自锁 / Taking the write lock while holding a read lock on the call path would self-deadlock / Schreibsperre bei gehaltener Lesesperre im Aufrufpfad würde sich selbst blockieren */
+    if (get_rule_set_read_depth() > 0) {
+        internal_log_write("WARNING", "reload_transfer_rules: cannot reload from inside a plugin call, ignoring request");
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    int64_t start_ms = pt_platform_get_monotonic_ms();
+    staged_rule_set_t staged;
+    memset(&staged, 0, sizeof(staged_rule_set_t));
+    installed_rule_set_t set;
+    memset(&set, 0, sizeof(installed_rule_set_t));
+    int result = stage_rule_sources(&staged);
+    if (result == CONFIG_ERR_SUCCESS) {
+        result = build_installed_rule_set(&staged, &set);
+    }
+    if (result != CONFIG_ERR_SUCCESS) {
+        internal_log_write("WARNING", "reload_transfer_rules: keeping current rule set (%zu rules), new rule set failed (error %d)", ctx->rule_count, result);
+        free_installed_rule_set(&set);
+        free_staged_rule_set(&staged);
+        return result;
+    }
+    
+    /* 写锁内只交换指针；接口状态和插件句柄保持不变 / Only pointers are swapped under the write lock; interface states and plugin handles are kept / Unter der Schreibsperre werden nur Zeiger getauscht; Schnittstellenstatus und Plugin-Handles bleiben erhalten */
+    acquire_rule_set_write();
+    if (set.cloned_node_count != ctx->rule_graph.node_count) {
+        /* 构建期间上下文规则图的节点发生了变化，重新复制以保持节点ID / The context rule graph's nodes changed during the build, copy again to keep node IDs / Die Knoten des Kontext-Regelgraphen haben sich während des Aufbaus geändert, erneut kopieren, um Knoten-IDs zu erhalten */
+        if (build_installed_rule_graph(&set, &ctx->rule_graph) != 0) {
+            release_rule_set_write();
+            internal_log_write("WARNING", "reload_transfer_rules: keeping current rule set (%zu rules), failed to build rule graph", ctx->rule_count);
+            free_installed_rule_set(&set);
+            free_staged_rule_set(&staged);
+            return CONFIG_ERR_MEMORY;
+        }
+    }
+    size_t old_rule_count = ctx->rule_count;
+    size_t flag_count = 0;
+    unsigned char* flags = snapshot_rule_graph_flags(&ctx->rule_graph, &flag_count);
+    exchange_rule_set(ctx, &set);
+    
+    /* 节点ID保持不变，只丢弃纯接口或环状态变化的节点的记忆化结果 / Node IDs are unchanged, only nodes whose purity or cycle state changed drop memoized results / Knoten-IDs bleiben gleich, nur Knoten mit geänderter Reinheit oder geändertem Zyklusstatus verwerfen memoisierte Ergebnisse */
+    int memo_result = sync_memo_cache_with_graph(flags, flag_count);
+    free(flags);
+    if (memo_result != 0) {
+        internal_log_write("WARNING", "reload_transfer_rules: failed to initialize memoization cache, pure interfaces will not be memoized");
+    }
+    release_rule_set_write();
+    
+    /* 旧规则集在锁外释放 / The old rule set is freed outside the lock / Der alte Regelsatz wird außerhalb der Sperre freigegeben */
+    free_installed_rule_set(&set);
+    
+    for (size_t i = 0; i < staged.path_count; i++) {
+        update_rule_source_timestamp(staged.paths[i], staged.timestamps[i]);
+    }
+    
+    internal_log_write("INFO", "Reloaded transfer rules from %zu files: %zu -> %zu rules in %lld ms",
+                      staged.path_count, old_rule_count, ctx->rule_count,
+                      (long long)(pt_platform_get_monotonic_ms() - start_ms));
+    free_staged_rule_set(&staged);
+    return CONFIG_ERR_SUCCESS;
+}
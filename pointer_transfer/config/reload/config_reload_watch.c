@@ -0,0 +1,126 @@
+/**
+ * @file config_reload_watch.c
+ * @brief 规则文件监视线程 / Rule File Watcher Thread / Regeldatei-Überwachungsthread
+ */
+
+#include "config_reload.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+/* 监视线程句柄 / Watcher thread handle / Überwachungsthread-Handle */
+static pt_platform_thread_t* g_watch_thread = NULL;
+
+/* 停止标志（仅由主线程写入） / Stop flag (written by main thread only) / Stopp-Flag (nur vom Hauptthread geschrieben) */
+static volatile int g_watch_stop = 0;
+
+/**
+ * @brief 将新记录的规则源文件加入监视器 / Add newly registered rule source files to watcher / Neu registrierte Regelquelldateien zur Überwachung hinzufügen
+ * @details 链式加载可能在运行时追加源文件 / Chain loading may append source files at runtime / Kettenladen kann zur Laufzeit Quelldateien anhängen
+ * @return 成功返回0，监视器无法添加文件返回-1 / Returns 0 on success, -1 if the watcher cannot add a file / Gibt 0 bei Erfolg zurück, -1 wenn die Überwachung eine Datei nicht hinzufügen kann
+ */
+static int sync_watched_sources(pt_platform_watch_t* watch, size_t* watched_count) {
+    for (;;) {
+        char* path = copy_rule_source_path(*watched_count);
+        if (path == NULL) {
+            return 0;
+        }
+        int32_t result = pt_platform_watch_add(watch, path);
+        if (result != 0) {
+            internal_log_write("WARNING", "Rule watcher: cannot watch %s, falling back to polling", path);
+            free(path);
+            return -1;
+        }
+        free(path);
+        (*watched_count)++;
+    }
+}
+
+/**
+ * @brief 监视线程主函数 / Watcher thread main function / Hauptfunktion des Überwachungsthreads
+ * @details 优先使用平台文件通知，不可用时按间隔轮询时间戳；插件库文件每个间隔检查一次 / Uses platform file notifications when available, otherwise polls timestamps at the interval; plugin library files are checked once per interval / Verwendet Plattform-Dateibenachrichtigungen wenn verfügbar, sonst Abfrage der Zeitstempel im Intervall; Plugin-Bibliotheksdateien werden einmal pro Intervall geprüft
+ */
+static void rule_watch_thread_main(void* arg) {
+    uint32_t interval_ms = (uint32_t)(uintptr_t)arg;
+    pointer_transfer_context_t* ctx = get_global_context();
+    int watch_rules = ctx->watch_rules;
+    int watch_plugins = ctx->watch_plugins;
+    pt_platform_watch_t* watch = watch_rules ? pt_platform_watch_create() : NULL;
+    size_t watched_count = 0;
+    
+    internal_log_write("INFO", "Rule watcher started (%s, interval %u ms, rules %s, plugins %s)", watch != NULL ? "notify" : "polling", interval_ms,
+                      watch_rules ? "on" : "off", watch_plugins ? "on" : "off");
+    
+    while (!g_watch_stop) {
+        int changed = 0;
+        if (watch != NULL && sync_watched_sources(watch, &watched_count) != 0) {
+            pt_platform_watch_destroy(watch);
+            watch = NULL;
+        }
+        
+        if (watch != NULL) {
+            int32_t wait_result = pt_platform_watch_wait(watch, interval_ms);
+            if (wait_result < 0) {
+                internal_log_write("WARNING", "Rule watcher: file notification failed, falling back to polling");
+                pt_platform_watch_destroy(watch);
+                watch = NULL;
+                continue;
+            }
+            changed = wait_result > 0;
+        } else {
+            pt_platform_sleep_ms(interval_ms);
+            changed = watch_rules && rule_sources_changed();
+        }
+        
+        if (changed && !g_watch_stop) {
+            internal_log_write("INFO", "Rule watcher: rule file change detected, reloading");
+            reload_transfer_rules();
+        }
+        
+        /* 热替换已改变的插件库 / Hot-swap changed plugin libraries / Geänderte Plugin-Bibliotheken per Hot-Swap austauschen */
+        if (watch_plugins && !g_watch_stop && mark_changed_plugin_files() > 0) {
+            apply_pending_plugin_swaps();
+        }
+    }
+    
+    if (watch != NULL) {
+        pt_platform_watch_destroy(watch);
+    }
+}
+
+/**
+ * @brief 启动规则文件监视线程（WatchRules=1或WatchPlugins=1时） / Start rule file watcher thread (when WatchRules=1 or WatchPlugins=1) / Regeldatei-Überwachungsthread starten (bei WatchRules=1 oder WatchPlugins=1)
+ */
+int start_rule_watcher(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || (!ctx->watch_rules && !ctx->watch_plugins) || g_watch_thread != NULL) {
+        return 0;
+    }
+    
+    uint32_t interval_ms = ctx->watch_interval_ms > 0 ? ctx->watch_interval_ms : PT_DEFAULT_WATCH_INTERVAL_MS;
+    g_watch_stop = 0;
+    g_watch_thread = pt_platform_thread_create(rule_watch_thread_main, (void*)(uintptr_t)interval_ms);
+    if (g_watch_thread == NULL) {
+        internal_log_write("ERROR", "start_rule_watcher: failed to create watcher thread");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 停止规则文件监视线程 / Stop rule file watcher thread / Regeldatei-Überwachungsthread stoppen
+ * @details 最多等待一个监视间隔 / Waits at most one watch interval / Wartet höchstens ein Überwachungsintervall
+ */
+void stop_rule_watcher(void) {
+    if (g_watch_thread == NULL) {
+        return;
+    }
+    
+    g_watch_stop = 1;
+    pt_platform_thread_join(g_watch_thread);
+    g_watch_thread = NULL;
+    internal_log_write("INFO", "Rule watcher stopped");
+}
@@ -7,248 +7,249 @@
 #include "../common/config_errors.h"
 #include "../common/config_parser_common.h"
 #include "config_rules_scanner.h"
+#include "../entry/config_entry_parser.h"
+#include "../tokenizer/config_tokenizer.h"
 #include "config_rules_parser.h"
 #include "config_rules_merger.h"
+#include "../compiled/config_compiled.h"
 #include "pointer_transfer_config.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
 #include "pointer_transfer_utils.h"
 #include "pointer_transfer_types.h"
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 #include <stdint.h>
 
 /**
- * @brief 加载传递规则配置文件 / Load transfer rules configuration file / Übertragungsregel-Konfigurationsdatei laden
+ * @brief 在扫描结果中追加一条默认规则 / Append a default rule to the pass result / Standardregel an das Durchlaufergebnis anhängen
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
  */
-int load_transfer_rules(const char* config_path) {
-    if (config_path == NULL) {
-        return CONFIG_ERR_INVALID_PARAM;
+static int append_parsed_rule(parsed_rules_file_t* parsed) {
+    /* 扩展数组以容纳新规则 / Expand array to accommodate new rule / Array erweitern, um neue Regel aufzunehmen */
+    if (parsed->rule_count >= parsed->rule_capacity) {
+        size_t new_capacity = parsed->rule_capacity == 0 ? 8 : parsed->rule_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < parsed->rule_capacity || new_capacity > SIZE_MAX / sizeof(pointer_transfer_rule_t)) {
+            internal_log_write("ERROR", "Rule array capacity overflow detected");
+            return CONFIG_ERR_OVERFLOW;
+        }
+        
+        pointer_transfer_rule_t* new_rules = (pointer_transfer_rule_t*)realloc(parsed->rules, new_capacity * sizeof(pointer_transfer_rule_t));
+        if (new_rules == NULL) {
+            return CONFIG_ERR_MEMORY;
+        }
+        memset(new_rules + parsed->rule_count, 0, (new_capacity - parsed->rule_count) * sizeof(pointer_transfer_rule_t));
+        parsed->rules = new_rules;
+        parsed->rule_capacity = new_capacity;
     }
     
-    FILE* fp = fopen(config_path, "r");
-    if (fp == NULL) {
-        internal_log_write("WARNING", "Failed to open transfer rules file: %s", config_path);
-        return CONFIG_ERR_FILE_OPEN;
+    /* 初始化新规则 / Initialize new rule / Neue Regel initialisieren */
+    pointer_transfer_rule_t* rule = &parsed->rules[parsed->rule_count];
+    rule->source_param_index = -1;
+    rule->target_param_index = -1;
+    rule->transfer_mode = TRANSFER_MODE_UNICAST;
+    rule->enabled = 1;
+    rule->cache_self = 0;
+    rule->set_group = NULL;
+    rule->ownership = PARAM_OWNERSHIP_COPY;
+    parsed->rule_count++;
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 记录[EntryPlugin]段的键值 / Record an [EntryPlugin] section key-value / Schlüssel-Wert des [EntryPlugin]-Abschnitts erfassen
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+static int append_entry_item(parsed_rules_file_t* parsed, const config_token_t* token) {
+    if (parsed->entry_item_count >= parsed->entry_item_capacity) {
+        size_t new_capacity = parsed->entry_item_capacity == 0 ? 8 : parsed->entry_item_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < parsed->entry_item_capacity || new_capacity > SIZE_MAX / sizeof(config_key_value_t)) {
+            return CONFIG_ERR_OVERFLOW;
+        }
+        
+        config_key_value_t* new_items = (config_key_value_t*)realloc(parsed->entry_items, new_capacity * sizeof(config_key_value_t));
+        if (new_items == NULL) {
+            return CONFIG_ERR_MEMORY;
+        }
+        parsed->entry_items = new_items;
+        parsed->entry_item_capacity = new_capacity;
     }
     
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        internal_log_write("ERROR", "load_transfer_rules: global context is NULL");
-        fclose(fp);
-        return CONFIG_ERR_INVALID_PARAM;
+    config_key_value_t* item = &parsed->entry_items[parsed->entry_item_count];
+    item->key_id = token->key_id;
+    item->value = token->value;
+    item->line_number = token->line_number;
+    parsed->entry_item_count++;
+    
+    /* 日志和校验开关需要在记录规则之前生效 / Logging and validation switches must take effect before rules are logged / Protokollierungs- und Validierungsschalter müssen vor der Regelprotokollierung wirken */
+    if (token->key_id == CONFIG_KEY_DISABLE_INFO_LOG || token->key_id == CONFIG_KEY_ENABLE_VALIDATION) {
+        char buffer[32];
+        int flag = copy_config_span_to_buffer(token->value, buffer, sizeof(buffer)) == 0 ? parse_boolean_value(buffer) : 0;
+        if (token->key_id == CONFIG_KEY_DISABLE_INFO_LOG) {
+            parsed->settings.disable_info_log = flag;
+        } else {
+            parsed->settings.enable_validation = flag;
+        }
+    }
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 解析TransferRule_N段名中的索引 / Parse index of a TransferRule_N section name / Index eines TransferRule_N-Abschnittsnamens parsen
+ * @return 有效索引，否则返回-1 / Valid index, -1 otherwise / Gültiger Index, sonst -1
+ */
+static int parse_rule_section_index(config_span_t section) {
+    static const char prefix[] = "TransferRule_";
+    size_t prefix_len = sizeof(prefix) - 1;
+    if (section.length <= prefix_len || memcmp(section.data, prefix, prefix_len) != 0) {
+        return -1;
     }
     
-    /* 首先快速扫描配置文件，查找DisableInfoLog配置 / First quickly scan config file to find DisableInfoLog configuration / Zuerst Konfigurationsdatei schnell scannen, um DisableInfoLog-Konfiguration zu finden */
-    scan_config_for_settings(fp);
+    config_span_t digits;
+    digits.data = section.data + prefix_len;
+    digits.length = section.length - prefix_len;
+    char buffer[32];
+    if (copy_config_span_to_buffer(digits, buffer, sizeof(buffer)) != 0) {
+        return -1;
+    }
     
-    internal_log_write("INFO", "Opening transfer rules file: %s", config_path);
+    char* endptr = NULL;
+    long parsed_index = strtol(buffer, &endptr, 10);
+    if (endptr == buffer || *endptr != '\0' || parsed_index < 0 || parsed_index > INT_MAX) {
+        return -1;
+    }
+    return (int)parsed_index;
+}
+
+/**
+ * @brief 单次扫描映射的配置文件 / Scan the mapped configuration file once / Zugeordnete Konfigurationsdatei einmal durchsuchen
+ * @details 不修改上下文，入口设置由调用者应用 / Does not touch the context, the caller applies the entry settings / Ändert den Kontext nicht, der Aufrufer wendet die Einstiegseinstellungen an
+ */
+int parse_transfer_rules_file(const char* config_path, parsed_rules_file_t* parsed_out) {
+    if (config_path == NULL || parsed_out == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
     
-    char* line_buffer = NULL;
-    size_t line_buffer_size = 4096;
-    char current_section[512] = {0};
-    int current_rule_index = -1;
-    int in_entry_section = 0;
-    size_t line_count = 0;
+    memset(parsed_out, 0, sizeof(parsed_rules_file_t));
+    parsed_out->max_seen_index = -1;
+    parsed_out->settings.disable_info_log = -1;
+    parsed_out->settings.enable_validation = -1;
     
-    line_buffer = (char*)malloc(line_buffer_size);
-    if (line_buffer == NULL) {
-        fclose(fp);
-        return CONFIG_ERR_MEMORY;
+    pt_platform_file_map_t* map = pt_platform_file_map_open(config_path);
+    if (map == NULL) {
+        internal_log_write("WARNING", "Failed to open transfer rules file: %s", config_path);
+        return CONFIG_ERR_FILE_OPEN;
     }
+    parsed_out->source_map = map;
     
-    /* 动态数组用于临时存储规则 / Dynamic array for temporary rule storage / Dynamisches Array zur temporären Regelspeicherung */
-    size_t temp_rules_capacity = 0;
-    size_t temp_rules_count = 0;
-    pointer_transfer_rule_t* temp_rules = NULL;
+    /* 插件名和路径在规则间大量重复，驻留到本次加载的内存区 / Plugin names and paths repeat heavily across rules, so they are interned into this load's arena / Plugin-Namen und -Pfade wiederholen sich stark und werden in die Arena dieses Ladevorgangs interniert */
+    parsed_out->strings = create_config_string_arena();
+    if (parsed_out->strings == NULL) {
+        free_parsed_rules_file(parsed_out);
+        return CONFIG_ERR_MEMORY;
+    }
     
     /* 用于验证段索引连续性和一致性 / For validating section index continuity and consistency / Zur Validierung der Abschnittsindex-Kontinuität und -Konsistenz */
-    int max_seen_index = -1;
+    int current_rule_index = -1;
     int expected_next_index = 0;
+    int in_entry_section = 0;
+    int result = CONFIG_ERR_SUCCESS;
     
-    /* 一次扫描解析规则配置 / Single pass parsing of rule configuration / Einmaliges Parsen der Regelkonfiguration */
-    while (fgets(line_buffer, (int)line_buffer_size, fp) != NULL) {
-        line_count++;
-        char* trimmed_line = line_buffer;
-        size_t len = strlen(trimmed_line);
-        
-        /* 检查行是否被截断 / Check if line was truncated / Prüfen, ob Zeile abgeschnitten wurde */
-        if (len == line_buffer_size - 1 && line_buffer[len - 1] != '\n') {
-            internal_log_write("WARNING", "load_transfer_rules: line %zu exceeds buffer size (%zu), may be truncated", 
-                line_count, line_buffer_size);
-        }
-        
-        if (len > 0 && trimmed_line[len - 1] == '\n') {
-            trimmed_line[len - 1] = '\0';
-            len--;
-        }
-        if (len > 0 && trimmed_line[len - 1] == '\r') {
-            trimmed_line[len - 1] = '\0';
-            len--;
-        }
-        trim_string(trimmed_line);
-        len = strlen(trimmed_line);
-        
-        if (trimmed_line[0] == '#' || trimmed_line[0] == '\0') {
-            continue;
-        }
-        
-        if (len >= 2 && trimmed_line[0] == '[' && trimmed_line[len - 1] == ']') {
-            size_t section_len = len - 2;
-            if (section_len >= sizeof(current_section)) {
-                section_len = sizeof(current_section) - 1;
-                internal_log_write("WARNING", "load_transfer_rules: line %zu section name exceeds buffer size (%zu), truncated", 
-                    line_count, sizeof(current_section));
+    /* 一次扫描同时得到入口段和规则段 / A single pass yields both the entry section and the rule sections / Ein einziger Durchlauf liefert Einstiegs- und Regelabschnitte */
+    config_tokenizer_t tokenizer;
+    config_token_t token;
+    config_tokenizer_init(&tokenizer, (const char*)pt_platform_file_map_data(map), pt_platform_file_map_size(map));
+    while (result == CONFIG_ERR_SUCCESS && config_tokenizer_next(&tokenizer, &token)) {
+        if (token.type == CONFIG_TOKEN_SECTION) {
+            in_entry_section = config_span_equals(token.name, "EntryPlugin");
+            current_rule_index = parse_rule_section_index(token.name);
+            if (current_rule_index < 0) {
+                continue;
             }
-            memcpy(current_section, trimmed_line + 1, section_len);
-            current_section[section_len] = '\0';
             
-            /* 检查是否是EntryPlugin段 / Check if it's EntryPlugin section / Prüfen, ob es EntryPlugin-Abschnitt ist */
-            if (strcmp(current_section, "EntryPlugin") == 0) {
-                in_entry_section = 1;
-                current_rule_index = -1;
-            } else {
-                in_entry_section = 0;
+            /* 验证段索引连续性和一致性 / Validate section index continuity and consistency / Abschnittsindex-Kontinuität und -Konsistenz validieren */
+            if (current_rule_index < expected_next_index) {
+                internal_log_write("WARNING", "load_transfer_rules: line %zu section index %d is less than expected next index %d, may indicate duplicate or out-of-order sections", 
+                    token.line_number, current_rule_index, expected_next_index);
+            } else if (current_rule_index > expected_next_index) {
+                internal_log_write("WARNING", "load_transfer_rules: line %zu section index %d skips expected index %d, missing sections detected", 
+                    token.line_number, current_rule_index, expected_next_index);
             }
             
-            if (strncmp(current_section, "TransferRule_", 13) == 0) {
-                char* endptr = NULL;
-                long parsed_index = strtol(current_section + 13, &endptr, 10);
-                if (endptr != NULL && *endptr == '\0' && parsed_index >= 0 && parsed_index <= INT_MAX) {
-                    current_rule_index = (int)parsed_index;
-                    
-                    /* 验证段索引连续性和一致性 / Validate section index continuity and consistency / Abschnittsindex-Kontinuität und -Konsistenz validieren */
-                    if (current_rule_index < expected_next_index) {
-                        internal_log_write("WARNING", "load_transfer_rules: line %zu section index %d is less than expected next index %d, may indicate duplicate or out-of-order sections", 
-                            line_count, current_rule_index, expected_next_index);
-                    } else if (current_rule_index > expected_next_index) {
-                        internal_log_write("WARNING", "load_transfer_rules: line %zu section index %d skips expected index %d, missing sections detected", 
-                            line_count, current_rule_index, expected_next_index);
-                    }
-                    
-                    if (current_rule_index > max_seen_index) {
-                        max_seen_index = current_rule_index;
-                    }
-                    expected_next_index = current_rule_index + 1;
-                    
-                    /* 扩展数组以容纳新规则 / Expand array to accommodate new rule / Array erweitern, um neue Regel aufzunehmen */
-                    if (temp_rules_count >= temp_rules_capacity) {
-                        size_t new_capacity = temp_rules_capacity == 0 ? 8 : temp_rules_capacity * 2;
-                        if (new_capacity > SIZE_MAX / sizeof(pointer_transfer_rule_t)) {
-                            internal_log_write("ERROR", "Rule array capacity overflow detected");
-                            free(line_buffer);
-                            fclose(fp);
-                            if (temp_rules != NULL) {
-                                for (size_t i = 0; i < temp_rules_count; i++) {
-                                    free_single_rule(&temp_rules[i]);
-                                }
-                                free(temp_rules);
-                            }
-                            return CONFIG_ERR_OVERFLOW;
-                        }
-                        
-                        pointer_transfer_rule_t* new_rules = (pointer_transfer_rule_t*)realloc(temp_rules, new_capacity * sizeof(pointer_transfer_rule_t));
-                        if (new_rules == NULL) {
-                            free(line_buffer);
-                            fclose(fp);
-                            if (temp_rules != NULL) {
-                                for (size_t i = 0; i < temp_rules_count; i++) {
-                                    free_single_rule(&temp_rules[i]);
-                                }
-                                free(temp_rules);
-                            }
-                            return CONFIG_ERR_MEMORY;
-                        }
-                        memset(new_rules + temp_rules_count, 0, (new_capacity - temp_rules_count) * sizeof(pointer_transfer_rule_t));
-                        temp_rules = new_rules;
-                        temp_rules_capacity = new_capacity;
-                    }
-                    
-                    /* 初始化新规则 / Initialize new rule / Neue Regel initialisieren */
-                    temp_rules[temp_rules_count].source_param_index = -1;
-                    temp_rules[temp_rules_count].target_param_index = -1;
-                    temp_rules[temp_rules_count].transfer_mode = TRANSFER_MODE_UNICAST;
-                    temp_rules[temp_rules_count].enabled = 1;
-                    temp_rules[temp_rules_count].cache_self = 0;
-                    temp_rules[temp_rules_count].set_group = NULL;
-                    temp_rules_count++;
-                } else {
-                    current_rule_index = -1;
-                }
-            } else {
-                current_rule_index = -1;
+            if (current_rule_index > parsed_out->max_seen_index) {
+                parsed_out->max_seen_index = current_rule_index;
             }
-            continue;
-        }
-        
-        /* 如果在EntryPlugin段中，解析DisableInfoLog配置 / If in EntryPlugin section, parse DisableInfoLog configuration / Wenn im EntryPlugin-Abschnitt, DisableInfoLog-Konfiguration parsen */
-        if (in_entry_section) {
-            char key[512];
-            char value[2048];
-            if (parse_key_value_simple(trimmed_line, key, sizeof(key), value, sizeof(value))) {
-                trim_string(key);
-                trim_string(value);
-                
-                if (strcmp(key, "DisableInfoLog") == 0) {
-                    ctx->disable_info_log = parse_boolean_value(value);
-                    internal_log_write("INFO", "DisableInfoLog configuration: %d (%s)", 
-                                      ctx->disable_info_log, ctx->disable_info_log ? "INFO logs disabled" : "INFO logs enabled");
-                }
+            expected_next_index = current_rule_index + 1;
+            result = append_parsed_rule(parsed_out);
+        } else if (in_entry_section) {
+            if (CONFIG_KEY_IS_ENTRY(token.key_id)) {
+                result = append_entry_item(parsed_out, &token);
             }
-            continue;
-        }
-        
-        if (current_rule_index >= 0 && temp_rules_count > 0) {
-            char key[512];
-            char value[2048];
-            if (parse_key_value_simple(trimmed_line, key, sizeof(key), value, sizeof(value))) {
-                trim_string(key);
-                trim_string(value);
-                
-                /* 检查键值长度 / Check key/value length / Schlüssel-/Wertlänge prüfen */
-                size_t key_len = strlen(key);
-                size_t value_len = strlen(value);
-                if (key_len >= sizeof(key) - 1) {
-                    internal_log_write("WARNING", "load_transfer_rules: line %zu key exceeds buffer size (%zu), truncated", 
-                        line_count, sizeof(key));
-                }
-                if (value_len >= sizeof(value) - 1) {
-                    internal_log_write("WARNING", "load_transfer_rules: line %zu value exceeds buffer size (%zu), truncated", 
-                        line_count, sizeof(value));
-                }
-                
-                pointer_transfer_rule_t* rule = &temp_rules[temp_rules_count - 1];
-                parse_rule_key_value(rule, key, value);
-                
-                if (strcmp(key, "SetGroup") == 0) {
-                    internal_log_write("INFO", "Parsed SetGroup=%s for rule index %d (temp_rules_count=%zu)", 
-                        value, current_rule_index, temp_rules_count);
-                }
+        } else if (current_rule_index >= 0 && parsed_out->rule_count > 0) {
+            apply_rule_key_span(&parsed_out->rules[parsed_out->rule_count - 1], token.key_id, token.value, parsed_out->strings);
+            
+            if (token.key_id == CONFIG_KEY_SET_GROUP) {
+                internal_log_write("INFO", "Parsed SetGroup=%.*s for rule index %d (rule_count=%zu)", 
+                    (int)token.value.length, token.value.data, current_rule_index, parsed_out->rule_count);
             }
         }
     }
     
-    free(line_buffer);
-    fclose(fp);
-    
-    /* 合并规则到上下文 / Merge rules to context / Regeln in Kontext zusammenführen */
-    int merge_result = merge_rules_to_context(temp_rules, temp_rules_count, max_seen_index);
+    if (result != CONFIG_ERR_SUCCESS) {
+        free_parsed_rules_file(parsed_out);
+        return result;
+    }
     
-    if (temp_rules != NULL) {
-        for (size_t i = 0; i < temp_rules_count; i++) {
-            free_single_rule(&temp_rules[i]);
-        }
-        free(temp_rules);
+    parsed_out->line_count = tokenizer.line_number;
+    internal_log_write("INFO", "Scanned transfer rules file: %s (%zu strings, %zu unique, %zu bytes)", config_path,
+                      parsed_out->strings->request_count, parsed_out->strings->unique_count, parsed_out->strings->bytes_used);
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 释放单次扫描结果 / Free single pass result / Ergebnis des Einzeldurchlaufs freigeben
+ */
+void free_parsed_rules_file(parsed_rules_file_t* parsed) {
+    if (parsed == NULL) {
+        return;
     }
     
-    if (merge_result != CONFIG_ERR_SUCCESS) {
-        return merge_result;
+    free_parsed_transfer_rules(parsed->rules, parsed->rule_count);
+    if (parsed->entry_items != NULL) {
+        free(parsed->entry_items);
+    }
+    if (parsed->source_map != NULL) {
+        pt_platform_file_map_close((pt_platform_file_map_t*)parsed->source_map);
+    }
+    destroy_config_string_arena(parsed->strings);
+    memset(parsed, 0, sizeof(parsed_rules_file_t));
+    parsed->max_seen_index = -1;
+}
+
+/**
+ * @brief 释放临时规则数组 / Free temporary rule array / Temporäres Regel-Array freigeben
+ */
+void free_parsed_transfer_rules(pointer_transfer_rule_t* rules, size_t rule_count) {
+    if (rules == NULL) {
+        return;
     }
     
-    internal_log_write("INFO", "Parsed %zu lines, found %zu rules, total rules: %zu", line_count, temp_rules_count, ctx->rule_count);
+    for (size_t i = 0; i < rule_count; i++) {
+        free_single_rule(&rules[i]);
+    }
+    free(rules);
+}
+
+/**
+ * @brief 记录新加载的规则 / Log newly loaded rules / Neu geladene Regeln protokollieren
+ */
+static void log_loaded_rules(size_t start_rule_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
     
-    size_t start_rule_index = ctx->rule_count - temp_rules_count;
     for (size_t i = start_rule_index; i < ctx->rule_count; i++) {
         pointer_transfer_rule_t* rule = &ctx->rules[i];
         if (rule->transfer_mode == 0) {
@@ -269,8 +270,145 @@ int load_transfer_rules(const char* config_path) {
                 mode_str, (int)rule->transfer_mode);
         }
     }
+}
+
+/**
+ * @brief 暂存规则文件 / Stage rules file / Regeldatei bereitstellen
+ * @details 优先映射有效的.nxptc编译缓存，否则单次扫描文本并重新生成缓存 / Maps a valid .nxptc compiled cache first, otherwise scans the text once and regenerates the cache / Ordnet zuerst einen gültigen kompilierten .nxptc-Cache zu, sonst wird der Text einmal durchsucht und der Cache neu erzeugt
+ */
+int stage_transfer_rules_file(const char* config_path, staged_rules_file_t* staged_out) {
+    if (config_path == NULL || staged_out == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    memset(staged_out, 0, sizeof(staged_rules_file_t));
+    staged_out->parsed.max_seen_index = -1;
+    
+    /* 标识在解析前计算，解析期间的修改会使缓存在下次启动时失效 / The stamp is computed before parsing, so edits during parsing invalidate the cache on next start / Der Stempel wird vor dem Parsen berechnet, Änderungen während des Parsens machen den Cache beim nächsten Start ungültig */
+    staged_out->have_stamp = compute_rule_source_stamp(config_path, &staged_out->stamp) == CONFIG_ERR_SUCCESS;
+    if (staged_out->have_stamp && open_compiled_rules(config_path, &staged_out->stamp, &staged_out->compiled) == CONFIG_ERR_SUCCESS) {
+        staged_out->use_compiled = 1;
+        return CONFIG_ERR_SUCCESS;
+    }
+    
+    int parse_result = parse_transfer_rules_file(config_path, &staged_out->parsed);
+    if (parse_result != CONFIG_ERR_SUCCESS) {
+        return parse_result;
+    }
+    if (staged_out->have_stamp) {
+        write_compiled_rules(config_path, &staged_out->stamp, &staged_out->parsed);
+    }
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 释放未提交的暂存文件 / Free uncommitted staged file / Nicht übernommene bereitgestellte Datei freigeben
+ */
+void free_staged_rules_file(staged_rules_file_t* staged) {
+    if (staged == NULL) {
+        return;
+    }
+    
+    close_compiled_rules(&staged->compiled);
+    free_parsed_rules_file(&staged->parsed);
+    staged->use_compiled = 0;
+}
+
+/**
+ * @brief 将暂存文件合并到上下文并登记为规则源 / Merge staged file into context and register it as rule source / Bereitgestellte Datei in Kontext zusammenführen und als Regelquelle registrieren
+ */
+int commit_staged_rules_file(const char* config_path, staged_rules_file_t* staged, int* entry_result_out) {
+    if (entry_result_out != NULL) {
+        *entry_result_out = CONFIG_ERR_INCOMPLETE;
+    }
+    if (config_path == NULL || staged == NULL) {
+        free_staged_rules_file(staged);
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "load_transfer_rules: global context is NULL");
+        free_staged_rules_file(staged);
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    size_t start_rule_index = ctx->rule_count;
+    size_t loaded_count = 0;
+    size_t line_count = 0;
+    if (staged->use_compiled) {
+        staged->use_compiled = 0;
+        int install_result = install_compiled_rules(config_path, &staged->compiled, &loaded_count, &line_count, entry_result_out);
+        free_staged_rules_file(staged);
+        if (install_result != CONFIG_ERR_SUCCESS) {
+            return install_result;
+        }
+        internal_log_write("INFO", "Used compiled cache for %zu lines, found %zu rules, total rules: %zu", line_count, loaded_count, ctx->rule_count);
+    } else {
+        parsed_rules_file_t* parsed = &staged->parsed;
+        apply_config_file_settings(&parsed->settings);
+        
+        /* 合并规则到上下文，内存区先交给上下文 / Merge rules to context, the arena is handed to the context first / Regeln in Kontext zusammenführen, die Arena geht zuerst an den Kontext */
+        loaded_count = parsed->rule_count;
+        line_count = parsed->line_count;
+        int merge_result = CONFIG_ERR_SUCCESS;
+        if (parsed->rule_count > 0 && parsed->strings != NULL) {
+            merge_result = retain_config_string_arena(parsed->strings);
+            if (merge_result == CONFIG_ERR_SUCCESS) {
+                parsed->strings = NULL;
+            }
+        }
+        if (merge_result == CONFIG_ERR_SUCCESS) {
+            merge_result = merge_rules_to_context(parsed->rules, parsed->rule_count, parsed->max_seen_index);
+        }
+        
+        /* 入口键值指向源文件映射，须在释放前应用 / Entry key-values point into the source mapping and must be applied before it is released / Einstiegs-Schlüssel-Werte zeigen in die Quellzuordnung und müssen vor deren Freigabe angewendet werden */
+        if (entry_result_out != NULL) {
+            *entry_result_out = apply_entry_plugin_items(config_path, parsed->entry_items, parsed->entry_item_count);
+        }
+        free_staged_rules_file(staged);
+        
+        if (merge_result != CONFIG_ERR_SUCCESS) {
+            return merge_result;
+        }
+        
+        internal_log_write("INFO", "Parsed %zu lines, found %zu rules, total rules: %zu", line_count, loaded_count, ctx->rule_count);
+    }
     
-    internal_log_write("INFO", "Loaded %zu transfer rules from %s", temp_rules_count, config_path);
+    log_loaded_rules(start_rule_index);
+    
+    /* 记录规则源文件以便热重载 / Record rule source file for hot reload / Regelquelldatei für Hot-Reload erfassen */
+    register_rule_source(config_path);
+    
+    internal_log_write("INFO", "Loaded %zu transfer rules from %s", loaded_count, config_path);
     return CONFIG_ERR_SUCCESS;
 }
 
+/**
+ * @brief 加载传递规则配置文件并应用其[EntryPlugin]段 / Load transfer rules configuration file and apply its [EntryPlugin] section / Übertragungsregel-Konfigurationsdatei laden und ihren [EntryPlugin]-Abschnitt anwenden
+ */
+int load_transfer_rules_with_entry(const char* config_path, int* entry_result_out) {
+    if (entry_result_out != NULL) {
+        *entry_result_out = CONFIG_ERR_INCOMPLETE;
+    }
+    if (config_path == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    staged_rules_file_t staged;
+    int stage_result = stage_transfer_rules_file(config_path, &staged);
+    if (stage_result != CONFIG_ERR_SUCCESS) {
+        if (entry_result_out != NULL) {
+            *entry_result_out = stage_result;
+        }
+        return stage_result;
+    }
+    return commit_staged_rules_file(config_path, &staged, entry_result_out);
+}
+
+/**
+ * @brief 加载传递规则配置文件 / Load transfer rules configuration file / Übertragungsregel-Konfigurationsdatei laden
+ */
+int load_transfer_rules(const char* config_path) {
+    return load_transfer_rules_with_entry(config_path, NULL);
+}
@@ -6,17 +6,85 @@
 #ifndef CONFIG_RULES_LOADER_H
 #define CONFIG_RULES_LOADER_H
 
+#include "pointer_transfer_types.h"
+#include "config_rules_parsed.h"
+#include "../compiled/config_compiled.h"
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
+/**
+ * @brief 暂存的规则文件（编译缓存视图或文本扫描结果） / Staged rules file (compiled cache view or text pass result) / Bereitgestellte Regeldatei (kompilierte Cache-Ansicht oder Textdurchlaufergebnis)
+ */
+typedef struct {
+    compiled_source_stamp_t stamp; /**< 源文件标识 / Source file stamp / Quelldatei-Stempel */
+    int have_stamp;                /**< 标识是否有效 / Whether the stamp is valid / Ob der Stempel gültig ist */
+    int use_compiled;              /**< 是否使用编译缓存 / Whether the compiled cache is used / Ob der kompilierte Cache verwendet wird */
+    compiled_rules_view_t compiled; /**< 编译缓存视图 / Compiled cache view / Kompilierte Cache-Ansicht */
+    parsed_rules_file_t parsed;    /**< 文本扫描结果 / Text pass result / Textdurchlaufergebnis */
+} staged_rules_file_t;
+    
 /**
  * @brief 加载传递规则配置文件 / Load transfer rules configuration file / Übertragungsregel-Konfigurationsdatei laden
  * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int load_transfer_rules(const char* config_path);
-
+    
+/**
+ * @brief 暂存规则文件：校验编译缓存或扫描文本并刷新缓存，不修改上下文（可在工作线程调用） / Stage rules file: validate the compiled cache or scan the text and refresh the cache, without touching the context (callable from worker threads) / Regeldatei bereitstellen: kompilierten Cache validieren oder Text durchsuchen und Cache auffrischen, ohne den Kontext zu ändern (aus Arbeitsthreads aufrufbar)
+ * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
+ * @param staged_out 输出暂存文件（通过commit_staged_rules_file或free_staged_rules_file释放） / Output staged file (released by commit_staged_rules_file or free_staged_rules_file) / Ausgabe bereitgestellte Datei (freigegeben durch commit_staged_rules_file oder free_staged_rules_file)
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int stage_transfer_rules_file(const char* config_path, staged_rules_file_t* staged_out);
+    
+/**
+ * @brief 将暂存文件合并到上下文并登记为规则源 / Merge staged file into context and register it as rule source / Bereitgestellte Datei in Kontext zusammenführen und als Regelquelle registrieren
+ * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
+ * @param staged 暂存文件（总是被释放） / Staged file (always released) / Bereitgestellte Datei (wird immer freigegeben)
+ * @param entry_result_out 输出入口配置结果（可为NULL，此时不应用入口段） / Output entry configuration result (may be NULL, then the entry section is not applied) / Ausgabe des Einstiegskonfigurationsergebnisses (kann NULL sein, dann wird der Einstiegsabschnitt nicht angewendet)
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int commit_staged_rules_file(const char* config_path, staged_rules_file_t* staged, int* entry_result_out);
+    
+/**
+ * @brief 释放未提交的暂存文件 / Free uncommitted staged file / Nicht übernommene bereitgestellte Datei freigeben
+ * @param staged 暂存文件 / Staged file / Bereitgestellte Datei
+ */
+void free_staged_rules_file(staged_rules_file_t* staged);
+    
+/**
+ * @brief 加载传递规则配置文件并应用其[EntryPlugin]段 / Load transfer rules configuration file and apply its [EntryPlugin] section / Übertragungsregel-Konfigurationsdatei laden und ihren [EntryPlugin]-Abschnitt anwenden
+ * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
+ * @param entry_result_out 输出入口配置结果（可为NULL，此时不应用入口段） / Output entry configuration result (may be NULL, then the entry section is not applied) / Ausgabe des Einstiegskonfigurationsergebnisses (kann NULL sein, dann wird der Einstiegsabschnitt nicht angewendet)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int load_transfer_rules_with_entry(const char* config_path, int* entry_result_out);
+    
+/**
+ * @brief 单次扫描映射的配置文件，得到规则、入口设置和入口键值（不修改上下文中的规则） / Scan the mapped configuration file once for rules, entry settings and entry key-values (does not modify rules in context) / Zugeordnete Konfigurationsdatei einmal nach Regeln, Einstiegseinstellungen und Einstiegs-Schlüssel-Werten durchsuchen (ändert Regeln im Kontext nicht)
+ * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
+ * @param parsed_out 输出结果（调用者通过free_parsed_rules_file释放） / Output result (caller frees via free_parsed_rules_file) / Ausgabeergebnis (Aufrufer gibt über free_parsed_rules_file frei)
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int parse_transfer_rules_file(const char* config_path, parsed_rules_file_t* parsed_out);
+    
+/**
+ * @brief 释放单次扫描结果（rules置NULL表示所有权已转移） / Free single pass result (rules set to NULL means ownership was taken) / Ergebnis des Einzeldurchlaufs freigeben (rules auf NULL bedeutet, dass der Besitz übernommen wurde)
+ * @param parsed 扫描结果 / Pass result / Durchlaufergebnis
+ */
+void free_parsed_rules_file(parsed_rules_file_t* parsed);
+    
+/**
+ * @brief 释放临时规则数组 / Free temporary rule array / Temporäres Regel-Array freigeben
+ * @param rules 临时规则数组 / Temporary rules array / Temporäres Regeln-Array
+ * @param rule_count 规则数量 / Rule count / Regelanzahl
+ */
+void free_parsed_transfer_rules(pointer_transfer_rule_t* rules, size_t rule_count);
+    
 #ifdef __cplusplus
 }
 #endif
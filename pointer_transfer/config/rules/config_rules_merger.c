@@ -6,11 +6,13 @@
 #include "config_rules_merger.h"
 #include "../common/config_errors.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
 #include "pointer_transfer_types.h"
 #include "pointer_transfer_utils.h"
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <stdint.h>
 
 /**
  * @brief 合并规则到上下文 / Merge rules to context / Regeln in Kontext zusammenführen
@@ -46,62 +48,33 @@ int merge_rules_to_context(pointer_transfer_rule_t* temp_rules, size_t temp_rule
         }
     }
     
-    for (size_t i = 0; i < temp_rules_count; i++) {
-        size_t new_index = start_rule_index + i;
-        if (new_index < ctx->rule_capacity) {
-            pointer_transfer_rule_t* src_rule = &temp_rules[i];
-            pointer_transfer_rule_t* dst_rule = &ctx->rules[new_index];
-            memset(dst_rule, 0, sizeof(pointer_transfer_rule_t));
-            
-            dst_rule->source_param_index = src_rule->source_param_index;
-            dst_rule->target_param_index = src_rule->target_param_index;
-            dst_rule->transfer_mode = src_rule->transfer_mode;
-            dst_rule->enabled = src_rule->enabled;
-            
-            if (src_rule->source_plugin != NULL) {
-                dst_rule->source_plugin = allocate_string(src_rule->source_plugin);
-            }
-            if (src_rule->source_interface != NULL) {
-                dst_rule->source_interface = allocate_string(src_rule->source_interface);
-            }
-            if (src_rule->target_plugin != NULL) {
-                dst_rule->target_plugin = allocate_string(src_rule->target_plugin);
-            }
-            if (src_rule->target_plugin_path != NULL) {
-                dst_rule->target_plugin_path = allocate_string(src_rule->target_plugin_path);
-            }
-            if (src_rule->target_interface != NULL) {
-                dst_rule->target_interface = allocate_string(src_rule->target_interface);
-            }
-            if (src_rule->target_param_value != NULL) {
-                dst_rule->target_param_value = allocate_string(src_rule->target_param_value);
-            }
-            if (src_rule->description != NULL) {
-                dst_rule->description = allocate_string(src_rule->description);
-            }
-            if (src_rule->multicast_group != NULL) {
-                dst_rule->multicast_group = allocate_string(src_rule->multicast_group);
-            }
-            if (src_rule->condition != NULL) {
-                dst_rule->condition = allocate_string(src_rule->condition);
-            }
-            if (src_rule->set_group != NULL) {
-                dst_rule->set_group = allocate_string(src_rule->set_group);
-            }
-            dst_rule->cache_self = src_rule->cache_self;
-        }
+    /* 按值移动规则，字符串不再复制；临时规则被清空 / Move rules by value without copying strings; temporary rules are cleared / Regeln per Wert verschieben, ohne Zeichenfolgen zu kopieren; temporäre Regeln werden geleert */
+    if (temp_rules_count > 0) {
+        memcpy(&ctx->rules[start_rule_index], temp_rules, temp_rules_count * sizeof(pointer_transfer_rule_t));
+        memset(temp_rules, 0, temp_rules_count * sizeof(pointer_transfer_rule_t));
     }
     
     ctx->rule_count = new_rule_count;
+    commit_appended_rules(start_rule_index, NULL);
     
-    /* 构建规则索引 / Build rule index / Regelindex erstellen */
-    if (build_rule_index() != 0) {
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 提交追加到上下文的规则 / Commit rules appended to context / An den Kontext angehängte Regeln übernehmen
+ */
+void commit_appended_rules(size_t start_rule_index, const uint64_t* hash_keys) {
+    /* 增量更新规则索引和缓存 / Update rule index and cache incrementally / Regelindex und Cache inkrementell aktualisieren */
+    if (index_appended_rules(start_rule_index, hash_keys) != 0) {
         internal_log_write("WARNING", "Failed to build rule index, falling back to linear search");
     }
+    append_rule_cache(start_rule_index);
     
-    /* 构建规则缓存 / Build rule cache / Regel-Cache erstellen */
-    build_rule_cache();
+    /* 增量更新规则图（批量合并期间延迟到批量结束） / Update rule graph incrementally (deferred to batch end during batch merge) / Regelgraph inkrementell aktualisieren (während Stapelzusammenführung bis Stapelende verzögert) */
+    update_rule_graph_appended(start_rule_index);
     
-    return CONFIG_ERR_SUCCESS;
+    /* 新规则的目标需在下次调用前重新准备 / Targets of the new rules must be prepared again before the next call / Ziele der neuen Regeln müssen vor dem nächsten Aufruf erneut vorbereitet werden */
+    pointer_transfer_context_t* ctx = get_global_context();
+    pt_platform_atomic_store_int(&ctx->targets_prepared, 0);
 }
 
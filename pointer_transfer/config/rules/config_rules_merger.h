@@ -8,13 +8,15 @@
 
 #include "pointer_transfer_types.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
  * @brief 合并规则到上下文 / Merge rules to context / Regeln in Kontext zusammenführen
+ * @details 成功时规则及其字符串移入上下文，临时规则被清空 / On success the rules and their strings move into the context and the temporary rules are cleared / Bei Erfolg wandern die Regeln samt Zeichenfolgen in den Kontext, die temporären Regeln werden geleert
  * @param temp_rules 临时规则数组 / Temporary rules array / Temporäres Regeln-Array
  * @param temp_rules_count 临时规则数量 / Temporary rules count / Anzahl der temporären Regeln
  * @param max_seen_index 最大看到的索引 / Maximum seen index / Maximaler gesehener Index
@@ -22,7 +24,14 @@ extern "C" {
  */
 int merge_rules_to_context(pointer_transfer_rule_t* temp_rules, size_t temp_rules_count, 
                            int max_seen_index);
-
+    
+/**
+ * @brief 提交追加到上下文的规则（更新索引、缓存和规则图） / Commit rules appended to context (updates index, cache and rule graph) / An den Kontext angehängte Regeln übernehmen (aktualisiert Index, Cache und Regelgraph)
+ * @param start_rule_index 第一条新规则的索引 / Index of first new rule / Index der ersten neuen Regel
+ * @param hash_keys 新规则的预计算哈希键（可为NULL） / Precomputed hash keys of new rules (may be NULL) / Vorberechnete Hash-Schlüssel der neuen Regeln (kann NULL sein)
+ */
+void commit_appended_rules(size_t start_rule_index, const uint64_t* hash_keys);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,163 @@
+/**
+ * @file config_rules_mutate.c
+ * @brief 运行时规则增删和启用切换 / Runtime Rule Addition, Removal and Enable Toggling / Laufzeit-Regelhinzufügung, -entfernung und Aktivierungsumschaltung
+ */
+
+#include "config_rules_parser.h"
+#include "config_rules_merger.h"
+#include "../common/config_errors.h"
+#include "../reload/config_reload.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 解析规则描述文本到临时规则 / Parse rule specification text into temporary rule / Regelbeschreibungstext in temporäre Regel parsen
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+static int parse_rule_spec(const char* rule_spec, pointer_transfer_rule_t* rule) {
+    memset(rule, 0, sizeof(pointer_transfer_rule_t));
+    rule->source_param_index = -1;
+    rule->target_param_index = -1;
+    rule->transfer_mode = TRANSFER_MODE_UNICAST;
+    rule->enabled = 1;
+    
+    /* 与.nxpt文件共用分词器，段标题被忽略 / Shares the tokenizer with .nxpt files, section headers are ignored / Teilt den Tokenizer mit .nxpt-Dateien, Abschnittsköpfe werden ignoriert */
+    config_tokenizer_t tokenizer;
+    config_token_t token;
+    config_tokenizer_init(&tokenizer, rule_spec, strlen(rule_spec));
+    while (config_tokenizer_next(&tokenizer, &token)) {
+        if (token.type == CONFIG_TOKEN_KEY_VALUE) {
+            apply_rule_key_span(rule, token.key_id, token.value, NULL);
+        }
+    }
+    
+    if (rule->source_plugin == NULL || rule->source_interface == NULL ||
+        rule->target_plugin == NULL || rule->target_interface == NULL) {
+        internal_log_write("WARNING", "parse_rule_spec: SourcePlugin, SourceInterface, TargetPlugin and TargetInterface are required");
+        free_single_rule(rule);
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 运行时添加传递规则 / Add transfer rule at runtime / Übertragungsregel zur Laufzeit hinzufügen
+ * @param rule_spec 规则描述（与[TransferRule_N]段相同的Key=Value行） / Rule specification (Key=Value lines as in a [TransferRule_N] section) / Regelbeschreibung (Key=Value-Zeilen wie in einem [TransferRule_N]-Abschnitt)
+ * @param rule_index_out 输出新规则索引 / Output new rule index / Ausgabe neuer Regelindex
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int add_transfer_rule(const char* rule_spec, size_t* rule_index_out) {
+    if (rule_spec == NULL || rule_index_out == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    /* 追加可能移动规则数组，调用路径内不允许 / Appending may move the rules array, so it is not allowed on a call path / Anhängen kann das Regel-Array verschieben und ist daher im Aufrufpfad nicht erlaubt */
+    if (get_rule_set_read_depth() > 0) {
+        internal_log_write("WARNING", "add_transfer_rule: cannot add rules from inside a plugin call");
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_rule_t rule;
+    int result = parse_rule_spec(rule_spec, &rule);
+    if (result != CONFIG_ERR_SUCCESS) {
+        return result;
+    }
+    
+    acquire_rule_set_write();
+    result = merge_rules_to_context(&rule, 1, -1);
+    size_t rule_index = ctx->rule_count - 1;
+    if (result == CONFIG_ERR_SUCCESS) {
+        const pointer_transfer_rule_t* added = &ctx->rules[rule_index];
+        internal_log_write("INFO", "Added rule %zu: %s.%s[%d] -> %s.%s[%d]", rule_index,
+                          added->source_plugin, added->source_interface, added->source_param_index,
+                          added->target_plugin, added->target_interface, added->target_param_index);
+        *rule_index_out = rule_index;
+    }
+    release_rule_set_write();
+    
+    /* 合并成功后规则已移入上下文，此处只释放失败时的字符串 / After a successful merge the rule has moved into the context, this only frees strings on failure / Nach erfolgreicher Zusammenführung ist die Regel im Kontext, hier werden nur bei Fehler Zeichenfolgen freigegeben */
+    free_single_rule(&rule);
+    return result;
+}
+
+/**
+ * @brief 运行时移除传递规则 / Remove transfer rule at runtime / Übertragungsregel zur Laufzeit entfernen
+ * @details 槽位保留为空规则，其余规则索引保持不变 / The slot is kept as an empty rule so other rule indices stay stable / Der Slot bleibt als leere Regel erhalten, damit andere Regelindizes stabil bleiben
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int remove_transfer_rule(size_t rule_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    if (get_rule_set_read_depth() > 0) {
+        internal_log_write("WARNING", "remove_transfer_rule: cannot remove rules from inside a plugin call");
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    acquire_rule_set_write();
+    if (rule_index >= ctx->rule_count || ctx->rules[rule_index].source_plugin == NULL) {
+        release_rule_set_write();
+        internal_log_write("WARNING", "remove_transfer_rule: no rule at index %zu", rule_index);
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pointer_transfer_rule_t* rule = &ctx->rules[rule_index];
+    int cache_self = rule->cache_self;
+    unindex_rule(rule_index);
+    remove_rule_from_cache(rule_index);
+    free_single_rule(rule);
+    memset(rule, 0, sizeof(pointer_transfer_rule_t));
+    rule->source_param_index = -1;
+    rule->target_param_index = -1;
+    
+    /* 只移除该规则的边并更新其所在分量 / Only this rule's edge is removed and its component updated / Nur die Kante dieser Regel wird entfernt und ihre Komponente aktualisiert */
+    update_rule_graph_removed(rule_index, cache_self);
+    release_rule_set_write();
+    
+    internal_log_write("INFO", "Removed rule %zu", rule_index);
+    return CONFIG_ERR_SUCCESS;
+}
+
+/**
+ * @brief 设置规则启用状态 / Set rule enabled state / Aktivierungsstatus der Regel setzen
+ * @details 索引和规则图包含禁用的规则，因此只需原子翻转标志；可在插件调用中使用，启用的规则目标在下一次最外层调用时准备 / Index and rule graph include disabled rules, so only the flag is flipped atomically; usable from inside plugin calls, the target of an enabled rule is prepared by the next outermost call / Index und Regelgraph enthalten deaktivierte Regeln, daher wird nur das Flag atomar umgeschaltet; auch innerhalb von Plugin-Aufrufen verwendbar, das Ziel einer aktivierten Regel wird beim nächsten äußersten Aufruf vorbereitet
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param enabled 启用标志 / Enabled flag / Aktivierungsflag
+ * @return 成功返回0，失败返回错误码 / Returns 0 on success, error code on failure / Gibt 0 bei Erfolg zurück, Fehlercode bei Fehler
+ */
+int set_transfer_rule_enabled(size_t rule_index, int enabled) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    acquire_rule_set_read();
+    if (rule_index >= ctx->rule_count || ctx->rules[rule_index].source_plugin == NULL) {
+        release_rule_set_read();
+        internal_log_write("WARNING", "set_transfer_rule_enabled: no rule at index %zu", rule_index);
+        return CONFIG_ERR_INVALID_PARAM;
+    }
+    
+    pt_platform_atomic_store_int((volatile int*)&ctx->rules[rule_index].enabled, enabled ? 1 : 0);
+    if (enabled) {
+        /* 准备阶段跳过了禁用规则的目标 / Preparation skipped the targets of disabled rules / Die Vorbereitung hat die Ziele deaktivierter Regeln übersprungen */
+        pt_platform_atomic_store_int(&ctx->targets_prepared, 0);
+    }
+    release_rule_set_read();
+    
+    internal_log_write("INFO", "Rule %zu %s", rule_index, enabled ? "enabled" : "disabled");
+    return CONFIG_ERR_SUCCESS;
+}
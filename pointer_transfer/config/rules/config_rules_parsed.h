@@ -0,0 +1,40 @@
+/**
+ * @file config_rules_parsed.h
+ * @brief 规则文件扫描结果 / Rules File Pass Result / Ergebnis des Regeldatei-Durchlaufs
+ */
+
+#ifndef CONFIG_RULES_PARSED_H
+#define CONFIG_RULES_PARSED_H
+
+#include "pointer_transfer_types.h"
+#include "config_rules_scanner.h"
+#include "../tokenizer/config_tokenizer.h"
+#include "../arena/config_string_arena.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/**
+ * @brief 单次扫描.nxpt文件的结果 / Result of a single .nxpt pass / Ergebnis eines einzelnen .nxpt-Durchlaufs
+ */
+typedef struct {
+    pointer_transfer_rule_t* rules; /**< [TransferRule_N]段的规则 / Rules of [TransferRule_N] sections / Regeln der [TransferRule_N]-Abschnitte */
+    size_t rule_count;             /**< 规则数量 / Rule count / Regelanzahl */
+    size_t rule_capacity;          /**< 规则数组容量 / Rule array capacity / Regel-Array-Kapazität */
+    int max_seen_index;            /**< 最大段索引 / Maximum section index / Maximaler Abschnittsindex */
+    size_t line_count;             /**< 源文件行数 / Source line count / Zeilenanzahl der Quelle */
+    config_file_settings_t settings; /**< 入口设置 / Entry settings / Einstiegseinstellungen */
+    config_key_value_t* entry_items; /**< [EntryPlugin]段的键值（指向映射） / [EntryPlugin] key-values (point into the mapping) / [EntryPlugin]-Schlüssel-Werte (zeigen in die Zuordnung) */
+    size_t entry_item_count;       /**< 入口键值数量 / Entry key-value count / Anzahl der Einstiegs-Schlüssel-Werte */
+    size_t entry_item_capacity;    /**< 入口键值容量 / Entry key-value capacity / Kapazität der Einstiegs-Schlüssel-Werte */
+    void* source_map;              /**< 源文件映射，保持entry_items有效 / Source mapping keeping entry_items valid / Quellzuordnung, hält entry_items gültig */
+    config_string_arena_t* strings; /**< 规则字符串所在的内存区 / Arena holding the rule strings / Arena mit den Regel-Zeichenfolgen */
+} parsed_rules_file_t;
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_RULES_PARSED_H */
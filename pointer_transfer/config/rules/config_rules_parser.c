@@ -10,6 +10,114 @@
 #include <string.h>
 #include <limits.h>
 
+/**
+ * @brief 用片段替换规则字符串字段 / Replace rule string field with span / Regel-Zeichenfolgenfeld durch Abschnitt ersetzen
+ * @details 有内存区时驻留到内存区，否则单独分配 / Interned into the arena when one is given, allocated individually otherwise / Mit Arena dort interniert, sonst einzeln zugewiesen
+ */
+static void assign_rule_string(pointer_transfer_rule_t* rule, char** field, config_span_t value, config_string_arena_t* arena) {
+    if (arena != NULL) {
+        *field = intern_config_string(arena, value.data, value.length);
+        rule->strings_shared = 1;
+        return;
+    }
+    
+    if (*field != NULL) {
+        free(*field);
+    }
+    *field = copy_config_span(value);
+}
+
+/**
+ * @brief 解析参数索引值 / Parse parameter index value / Parameterindexwert parsen
+ */
+static void assign_rule_index(int* field, config_span_t value) {
+    char buffer[32];
+    if (copy_config_span_to_buffer(value, buffer, sizeof(buffer)) != 0) {
+        return;
+    }
+    
+    char* endptr = NULL;
+    long parsed_val = strtol(buffer, &endptr, 10);
+    if (endptr != NULL && *endptr == '\0' && parsed_val >= INT_MIN && parsed_val <= INT_MAX) {
+        *field = (int)parsed_val;
+    }
+}
+
+/**
+ * @brief 按键标识应用规则键值 / Apply rule key-value by key identifier / Regel-Schlüssel-Wert nach Schlüsselkennung anwenden
+ */
+void apply_rule_key_span(pointer_transfer_rule_t* rule, config_key_id_t key_id, config_span_t value, config_string_arena_t* arena) {
+    if (rule == NULL) {
+        return;
+    }
+    
+    /* 同一规则的字符串不能混用两种所有权 / Strings of one rule must not mix both ownerships / Zeichenfolgen einer Regel dürfen beide Besitzarten nicht mischen */
+    if (arena == NULL && rule->strings_shared) {
+        return;
+    }
+    
+    switch (key_id) {
+        case CONFIG_KEY_SOURCE_PLUGIN:
+            assign_rule_string(rule, &rule->source_plugin, value, arena);
+            break;
+        case CONFIG_KEY_SOURCE_INTERFACE:
+            assign_rule_string(rule, &rule->source_interface, value, arena);
+            break;
+        case CONFIG_KEY_SOURCE_PARAM_INDEX:
+            assign_rule_index(&rule->source_param_index, value);
+            break;
+        case CONFIG_KEY_TARGET_PLUGIN:
+            assign_rule_string(rule, &rule->target_plugin, value, arena);
+            break;
+        case CONFIG_KEY_TARGET_PLUGIN_PATH:
+            assign_rule_string(rule, &rule->target_plugin_path, value, arena);
+            break;
+        case CONFIG_KEY_TARGET_INTERFACE:
+            assign_rule_string(rule, &rule->target_interface, value, arena);
+            break;
+        case CONFIG_KEY_TARGET_PARAM_INDEX:
+            assign_rule_index(&rule->target_param_index, value);
+            break;
+        case CONFIG_KEY_TARGET_PARAM_VALUE:
+            assign_rule_string(rule, &rule->target_param_value, value, arena);
+            break;
+        case CONFIG_KEY_DESCRIPTION:
+            assign_rule_string(rule, &rule->description, value, arena);
+            break;
+        case CONFIG_KEY_MULTICAST_GROUP:
+            assign_rule_string(rule, &rule->multicast_group, value, arena);
+            break;
+        case CONFIG_KEY_TRANSFER_MODE:
+            if (config_span_equals(value, "broadcast") || config_span_equals(value, "Broadcast")) {
+                rule->transfer_mode = TRANSFER_MODE_BROADCAST;
+            } else if (config_span_equals(value, "multicast") || config_span_equals(value, "Multicast")) {
+                rule->transfer_mode = TRANSFER_MODE_MULTICAST;
+            } else {
+                rule->transfer_mode = TRANSFER_MODE_UNICAST;
+            }
+            break;
+        case CONFIG_KEY_ENABLED:
+            rule->enabled = (config_span_equals(value, "true") || config_span_equals(value, "1")) ? 1 : 0;
+            break;
+        case CONFIG_KEY_CONDITION:
+            assign_rule_string(rule, &rule->condition, value, arena);
+            break;
+        case CONFIG_KEY_CACHE_SELF:
+            rule->cache_self = (config_span_equals(value, "true") || config_span_equals(value, "1")) ? 1 : 0;
+            break;
+        case CONFIG_KEY_SET_GROUP:
+            assign_rule_string(rule, &rule->set_group, value, arena);
+            break;
+        case CONFIG_KEY_OWNERSHIP:
+            rule->ownership = (config_span_equals(value, "borrow") || config_span_equals(value, "Borrow")) ?
+                              PARAM_OWNERSHIP_BORROW : PARAM_OWNERSHIP_COPY;
+            break;
+        default:
+            /* 入口段键和未知键不属于规则 / Entry section keys and unknown keys do not belong to rules / Einstiegsabschnitts- und unbekannte Schlüssel gehören nicht zu Regeln */
+            break;
+    }
+}
+
 /**
  * @brief 解析规则键值对 / Parse rule key-value pair / Regel-Schlüssel-Wert-Paar parsen
  */
@@ -18,50 +126,8 @@ void parse_rule_key_value(pointer_transfer_rule_t* rule, const char* key, const
         return;
     }
     
-    if (strcmp(key, "SourcePlugin") == 0) {
-        rule->source_plugin = allocate_string(value);
-    } else if (strcmp(key, "SourceInterface") == 0) {
-        rule->source_interface = allocate_string(value);
-    } else if (strcmp(key, "SourceParamIndex") == 0) {
-        char* endptr = NULL;
-        long parsed_val = strtol(value, &endptr, 10);
-        if (endptr != NULL && *endptr == '\0' && parsed_val >= INT_MIN && parsed_val <= INT_MAX) {
-            rule->source_param_index = (int)parsed_val;
-        }
-    } else if (strcmp(key, "TargetPlugin") == 0) {
-        rule->target_plugin = allocate_string(value);
-    } else if (strcmp(key, "TargetPluginPath") == 0) {
-        rule->target_plugin_path = allocate_string(value);
-    } else if (strcmp(key, "TargetInterface") == 0) {
-        rule->target_interface = allocate_string(value);
-    } else if (strcmp(key, "TargetParamIndex") == 0) {
-        char* endptr = NULL;
-        long parsed_val = strtol(value, &endptr, 10);
-        if (endptr != NULL && *endptr == '\0' && parsed_val >= INT_MIN && parsed_val <= INT_MAX) {
-            rule->target_param_index = (int)parsed_val;
-        }
-    } else if (strcmp(key, "TargetParamValue") == 0) {
-        rule->target_param_value = allocate_string(value);
-    } else if (strcmp(key, "Description") == 0) {
-        rule->description = allocate_string(value);
-    } else if (strcmp(key, "MulticastGroup") == 0) {
-        rule->multicast_group = allocate_string(value);
-    } else if (strcmp(key, "TransferMode") == 0) {
-        if (strcmp(value, "broadcast") == 0 || strcmp(value, "Broadcast") == 0) {
-            rule->transfer_mode = TRANSFER_MODE_BROADCAST;
-        } else if (strcmp(value, "multicast") == 0 || strcmp(value, "Multicast") == 0) {
-            rule->transfer_mode = TRANSFER_MODE_MULTICAST;
-        } else {
-            rule->transfer_mode = TRANSFER_MODE_UNICAST;
-        }
-    } else if (strcmp(key, "Enabled") == 0) {
-        rule->enabled = (strcmp(value, "true") == 0 || strcmp(value, "1") == 0) ? 1 : 0;
-    } else if (strcmp(key, "Condition") == 0) {
-        rule->condition = allocate_string(value);
-    } else if (strcmp(key, "CacheSelf") == 0) {
-        rule->cache_self = (strcmp(value, "true") == 0 || strcmp(value, "1") == 0) ? 1 : 0;
-    } else if (strcmp(key, "SetGroup") == 0) {
-        rule->set_group = allocate_string(value);
-    }
+    config_span_t value_span;
+    value_span.data = value;
+    value_span.length = strlen(value);
+    apply_rule_key_span(rule, lookup_config_key(key, strlen(key)), value_span, NULL);
 }
-
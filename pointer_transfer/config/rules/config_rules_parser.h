@@ -7,11 +7,13 @@
 #define CONFIG_RULES_PARSER_H
 
 #include "pointer_transfer_types.h"
+#include "../tokenizer/config_tokenizer.h"
+#include "../arena/config_string_arena.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
  * @brief 解析规则键值对 / Parse rule key-value pair / Regel-Schlüssel-Wert-Paar parsen
  * @param rule 规则结构体指针 / Rule structure pointer / Regelstruktur-Zeiger
@@ -19,7 +21,16 @@ extern "C" {
  * @param value 值 / Value / Wert
  */
 void parse_rule_key_value(pointer_transfer_rule_t* rule, const char* key, const char* value);
-
+    
+/**
+ * @brief 按键标识应用规则键值（值从片段复制） / Apply rule key-value by key identifier (value copied from span) / Regel-Schlüssel-Wert nach Schlüsselkennung anwenden (Wert aus Abschnitt kopiert)
+ * @param rule 规则结构体指针 / Rule structure pointer / Regelstruktur-Zeiger
+ * @param key_id 键标识 / Key identifier / Schlüsselkennung
+ * @param value 值片段 / Value span / Wertabschnitt
+ * @param arena 字符串内存区，NULL时单独分配 / String arena, NULL allocates individually / Zeichenfolgen-Arena, NULL weist einzeln zu
+ */
+void apply_rule_key_span(pointer_transfer_rule_t* rule, config_key_id_t key_id, config_span_t value, config_string_arena_t* arena);
+    
 #ifdef __cplusplus
 }
 #endif
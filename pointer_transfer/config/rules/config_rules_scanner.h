@@ -6,18 +6,24 @@
 #ifndef CONFIG_RULES_SCANNER_H
 #define CONFIG_RULES_SCANNER_H
 
-#include <stdio.h>
-
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
- * @brief 扫描配置文件查找设置 / Scan config file for settings / Konfigurationsdatei nach Einstellungen scannen
- * @param fp 文件指针 / File pointer / Dateizeiger
+ * @brief 规则文件中的入口设置（-1表示未设置） / Entry settings found in a rules file (-1 means not set) / Einstiegseinstellungen in einer Regeldatei (-1 bedeutet nicht gesetzt)
  */
-void scan_config_for_settings(FILE* fp);
-
+typedef struct {
+    int disable_info_log;         /**< DisableInfoLog值 / DisableInfoLog value / DisableInfoLog-Wert */
+    int enable_validation;        /**< EnableValidation值 / EnableValidation value / EnableValidation-Wert */
+} config_file_settings_t;
+    
+/**
+ * @brief 将扫描到的设置应用到上下文 / Apply scanned settings to context / Gescannte Einstellungen auf Kontext anwenden
+ * @param settings 设置 / Settings / Einstellungen
+ */
+void apply_config_file_settings(const config_file_settings_t* settings);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,121 @@
+/**
+ * @file config_keys.c
+ * @brief 配置键完美哈希表 / Configuration Key Perfect Hash Table / Perfekte Hash-Tabelle der Konfigurationsschlüssel
+ */
+
+#include "config_tokenizer.h"
+#include "pointer_transfer_utils.h"
+#include <string.h>
+
+/* 哈希表大小（2的幂） / Hash table size (power of two) / Hash-Tabellengröße (Zweierpotenz) */
+#define CONFIG_KEY_TABLE_SIZE 64
+
+/**
+ * @brief 完美哈希函数：长度、首字符、末字符和中间字符 / Perfect hash function: length, first, last and middle character / Perfekte Hash-Funktion: Länge, erstes, letztes und mittleres Zeichen
+ * @details 系数使所有已知键落入不同槽位；新增键时需重新选择系数 / The coefficients put every known key into its own slot; pick new ones when adding keys / Die Koeffizienten legen jeden bekannten Schlüssel in einen eigenen Slot; beim Hinzufügen neu wählen
+ */
+static size_t hash_config_key(const unsigned char* key, size_t length) {
+    return (length + (size_t)key[0] * 18 + (size_t)key[length - 1] * 12 + (size_t)key[length / 2] * 29) & (CONFIG_KEY_TABLE_SIZE - 1);
+}
+
+/**
+ * @brief 键槽位 / Key slot / Schlüssel-Slot
+ */
+typedef struct {
+    const char* name;              /**< 键名（空槽为NULL） / Key name (NULL for empty slots) / Schlüsselname (NULL für leere Slots) */
+    size_t length;                 /**< 键名长度 / Key name length / Länge des Schlüsselnamens */
+    config_key_id_t id;            /**< 键标识 / Key identifier / Schlüsselkennung */
+} config_key_slot_t;
+
+/* 按hash_config_key预先排好的槽位 / Slots laid out in advance by hash_config_key / Durch hash_config_key vorab angeordnete Slots */
+static const config_key_slot_t config_key_table[CONFIG_KEY_TABLE_SIZE] = {
+    [0]  = {"PluginPath", 10, CONFIG_KEY_PLUGIN_PATH},
+    [1]  = {"Ownership", 9, CONFIG_KEY_OWNERSHIP},
+    [2]  = {"TargetParamIndex", 16, CONFIG_KEY_TARGET_PARAM_INDEX},
+    [4]  = {"ValidationPending", 17, CONFIG_KEY_VALIDATION_PENDING},
+    [8]  = {"SetGroup", 8, CONFIG_KEY_SET_GROUP},
+    [10] = {"WatchPlugins", 12, CONFIG_KEY_WATCH_PLUGINS},
+    [12] = {"Condition", 9, CONFIG_KEY_CONDITION},
+    [14] = {"EnableValidation", 16, CONFIG_KEY_ENABLE_VALIDATION},
+    [18] = {"MaxCallDepth", 12, CONFIG_KEY_MAX_CALL_DEPTH},
+    [19] = {"Preload", 7, CONFIG_KEY_PRELOAD},
+    [20] = {"AutoRunInterface", 16, CONFIG_KEY_AUTO_RUN_INTERFACE},
+    [22] = {"WatchRules", 10, CONFIG_KEY_WATCH_RULES},
+    [23] = {"SourceInterface", 15, CONFIG_KEY_SOURCE_INTERFACE},
+    [25] = {"TargetPluginPath", 16, CONFIG_KEY_TARGET_PLUGIN_PATH},
+    [26] = {"SourcePlugin", 12, CONFIG_KEY_SOURCE_PLUGIN},
+    [28] = {"PluginName", 10, CONFIG_KEY_PLUGIN_NAME},
+    [29] = {"ManifestMaxEntries", 18, CONFIG_KEY_MANIFEST_MAX_ENTRIES},
+    [30] = {"TargetParamValue", 16, CONFIG_KEY_TARGET_PARAM_VALUE},
+    [32] = {"Description", 11, CONFIG_KEY_DESCRIPTION},
+    [33] = {"TransferMode", 12, CONFIG_KEY_TRANSFER_MODE},
+    [35] = {"IgnorePlugins", 13, CONFIG_KEY_IGNORE_PLUGINS},
+    [41] = {"TargetInterface", 15, CONFIG_KEY_TARGET_INTERFACE},
+    [42] = {"MemoCacheSize", 13, CONFIG_KEY_MEMO_CACHE_SIZE},
+    [43] = {"Enabled", 7, CONFIG_KEY_ENABLED},
+    [44] = {"TargetPlugin", 12, CONFIG_KEY_TARGET_PLUGIN},
+    [45] = {"TrialCalls", 10, CONFIG_KEY_TRIAL_CALLS},
+    [47] = {"DisableInfoLog", 14, CONFIG_KEY_DISABLE_INFO_LOG},
+    [48] = {"SourceParamIndex", 16, CONFIG_KEY_SOURCE_PARAM_INDEX},
+    [49] = {"WatchInterval", 13, CONFIG_KEY_WATCH_INTERVAL},
+    [50] = {"MaxLoadedPlugins", 16, CONFIG_KEY_MAX_LOADED_PLUGINS},
+    [52] = {"NxptPath", 8, CONFIG_KEY_NXPT_PATH},
+    [53] = {"UnloadIdleAfter", 15, CONFIG_KEY_UNLOAD_IDLE_AFTER},
+    [56] = {"CacheSelf", 9, CONFIG_KEY_CACHE_SELF},
+    [58] = {"CachePluginMetadata", 19, CONFIG_KEY_CACHE_PLUGIN_METADATA},
+    [60] = {"PreloadBindNow", 14, CONFIG_KEY_PRELOAD_BIND_NOW},
+    [61] = {"MemoCacheTTL", 12, CONFIG_KEY_MEMO_CACHE_TTL},
+    [63] = {"MulticastGroup", 14, CONFIG_KEY_MULTICAST_GROUP},
+};
+
+/**
+ * @brief 通过编译期完美哈希查找键 / Look up key through compile-time perfect hash / Schlüssel über kompilierzeitlichen perfekten Hash nachschlagen
+ * @details 一次哈希和一次比较，代替逐个strcmp / One hash and one comparison instead of a strcmp chain / Ein Hash und ein Vergleich statt einer strcmp-Kette
+ */
+config_key_id_t lookup_config_key(const char* key, size_t length) {
+    if (key == NULL || length == 0) {
+        return CONFIG_KEY_UNKNOWN;
+    }
+    
+    const config_key_slot_t* slot = &config_key_table[hash_config_key((const unsigned char*)key, length)];
+    if (slot->name != NULL && slot->length == length && memcmp(slot->name, key, length) == 0) {
+        return slot->id;
+    }
+    return CONFIG_KEY_UNKNOWN;
+}
+
+/**
+ * @brief 校验完美哈希表 / Verify the perfect hash table / Perfekte Hash-Tabelle prüfen
+ * @details 每个键必须落在自己的槽位且每个键标识恰好出现一次；新增键与已有键冲突时指定初始化器会静默覆盖旧键，此处使其在初始化时报错 / Every key must hash to its own slot and every key identifier must appear exactly once; a new key colliding with an existing one silently overrides it in the designated initializers, this makes it fail at init / Jeder Schlüssel muss in seinen eigenen Slot hashen und jede Schlüsselkennung genau einmal vorkommen; ein neuer Schlüssel, der mit einem vorhandenen kollidiert, überschreibt ihn still in den Designated Initializers, hier schlägt das bei der Initialisierung fehl
+ */
+int verify_config_key_table(void) {
+    unsigned char seen[CONFIG_KEY_COUNT];
+    memset(seen, 0, sizeof(seen));
+    int result = 0;
+    
+    for (size_t i = 0; i < CONFIG_KEY_TABLE_SIZE; i++) {
+        const config_key_slot_t* slot = &config_key_table[i];
+        if (slot->name == NULL) {
+            continue;
+        }
+        if (slot->length == 0 || slot->length != strlen(slot->name) ||
+            hash_config_key((const unsigned char*)slot->name, slot->length) != i) {
+            internal_log_write("ERROR", "Config key %s is not in its hash slot %zu", slot->name, i);
+            result = -1;
+        }
+        if (slot->id <= CONFIG_KEY_UNKNOWN || slot->id >= CONFIG_KEY_COUNT || seen[slot->id]) {
+            internal_log_write("ERROR", "Config key %s has an invalid or duplicate identifier %d", slot->name, (int)slot->id);
+            result = -1;
+            continue;
+        }
+        seen[slot->id] = 1;
+    }
+    
+    for (int id = CONFIG_KEY_UNKNOWN + 1; id < CONFIG_KEY_COUNT; id++) {
+        if (!seen[id]) {
+            internal_log_write("ERROR", "Config key identifier %d has no hash slot, the key hash collides and needs new coefficients", id);
+            result = -1;
+        }
+    }
+    return result;
+}
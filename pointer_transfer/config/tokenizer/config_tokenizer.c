@@ -0,0 +1,136 @@
+/**
+ * @file config_tokenizer.c
+ * @brief .nxpt零拷贝分词器 / Zero-Copy .nxpt Tokenizer / Kopierfreier .nxpt-Tokenizer
+ */
+
+#include "config_tokenizer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 去除片段两端的空白 / Trim whitespace at both ends of span / Leerzeichen an beiden Enden des Abschnitts entfernen
+ */
+static config_span_t trim_config_span(const char* start, const char* end) {
+    while (start < end && (*start == ' ' || *start == '\t')) {
+        start++;
+    }
+    while (end > start && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) {
+        end--;
+    }
+    
+    config_span_t span;
+    span.data = start;
+    span.length = (size_t)(end - start);
+    return span;
+}
+
+/**
+ * @brief 初始化分词器 / Initialize tokenizer / Tokenizer initialisieren
+ */
+void config_tokenizer_init(config_tokenizer_t* tokenizer, const char* data, size_t size) {
+    if (tokenizer == NULL) {
+        return;
+    }
+    
+    tokenizer->cursor = data;
+    tokenizer->end = data != NULL ? data + size : NULL;
+    tokenizer->line_number = 0;
+    
+    /* 跳过UTF-8 BOM / Skip UTF-8 BOM / UTF-8-BOM überspringen */
+    if (data != NULL && size >= 3 && (unsigned char)data[0] == 0xEF && (unsigned char)data[1] == 0xBB && (unsigned char)data[2] == 0xBF) {
+        tokenizer->cursor = data + 3;
+    }
+}
+
+/**
+ * @brief 读取下一个词法单元 / Read next token / Nächstes Token lesen
+ */
+int config_tokenizer_next(config_tokenizer_t* tokenizer, config_token_t* token_out) {
+    if (tokenizer == NULL || token_out == NULL) {
+        return 0;
+    }
+    
+    memset(token_out, 0, sizeof(config_token_t));
+    while (tokenizer->cursor != NULL && tokenizer->cursor < tokenizer->end) {
+        const char* line_start = tokenizer->cursor;
+        const char* line_end = (const char*)memchr(line_start, '\n', (size_t)(tokenizer->end - line_start));
+        if (line_end == NULL) {
+            line_end = tokenizer->end;
+            tokenizer->cursor = tokenizer->end;
+        } else {
+            tokenizer->cursor = line_end + 1;
+        }
+        tokenizer->line_number++;
+        
+        config_span_t line = trim_config_span(line_start, line_end);
+        if (line.length == 0 || line.data[0] == '#') {
+            continue;
+        }
+        
+        token_out->line_number = tokenizer->line_number;
+        if (line.length >= 2 && line.data[0] == '[' && line.data[line.length - 1] == ']') {
+            token_out->type = CONFIG_TOKEN_SECTION;
+            token_out->name.data = line.data + 1;
+            token_out->name.length = line.length - 2;
+            return 1;
+        }
+        
+        /* 没有'='的行不是键值对，与原解析器一样忽略 / Lines without '=' are not key-value pairs and are ignored as before / Zeilen ohne '=' sind keine Schlüssel-Wert-Paare und werden wie bisher ignoriert */
+        const char* eq_pos = (const char*)memchr(line.data, '=', line.length);
+        if (eq_pos == NULL) {
+            continue;
+        }
+        
+        token_out->type = CONFIG_TOKEN_KEY_VALUE;
+        token_out->name = trim_config_span(line.data, eq_pos);
+        token_out->value = trim_config_span(eq_pos + 1, line.data + line.length);
+        token_out->key_id = lookup_config_key(token_out->name.data, token_out->name.length);
+        return 1;
+    }
+    
+    token_out->type = CONFIG_TOKEN_END;
+    return 0;
+}
+
+/**
+ * @brief 比较片段与字符串 / Compare span with string / Abschnitt mit Zeichenfolge vergleichen
+ */
+int config_span_equals(config_span_t span, const char* text) {
+    if (text == NULL) {
+        return 0;
+    }
+    
+    size_t text_len = strlen(text);
+    return text_len == span.length && (text_len == 0 || memcmp(span.data, text, text_len) == 0);
+}
+
+/**
+ * @brief 复制片段为新分配的字符串 / Copy span into newly allocated string / Abschnitt in neu zugewiesene Zeichenfolge kopieren
+ */
+char* copy_config_span(config_span_t span) {
+    char* result = (char*)malloc(span.length + 1);
+    if (result == NULL) {
+        return NULL;
+    }
+    
+    if (span.length > 0) {
+        memcpy(result, span.data, span.length);
+    }
+    result[span.length] = '\0';
+    return result;
+}
+
+/**
+ * @brief 复制片段到调用者缓冲区 / Copy span into caller buffer / Abschnitt in Aufruferpuffer kopieren
+ */
+int copy_config_span_to_buffer(config_span_t span, char* buffer, size_t buffer_size) {
+    if (buffer == NULL || buffer_size == 0 || span.length >= buffer_size) {
+        return -1;
+    }
+    
+    if (span.length > 0) {
+        memcpy(buffer, span.data, span.length);
+    }
+    buffer[span.length] = '\0';
+    return 0;
+}
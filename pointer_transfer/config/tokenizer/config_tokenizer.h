@@ -0,0 +1,171 @@
+/**
+ * @file config_tokenizer.h
+ * @brief .nxpt零拷贝分词器接口 / Zero-Copy .nxpt Tokenizer Interface / Schnittstelle des kopierfreien .nxpt-Tokenizers
+ */
+
+#ifndef CONFIG_TOKENIZER_H
+#define CONFIG_TOKENIZER_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/**
+ * @brief 指向源缓冲区的字符串片段（不以NUL结尾） / String span pointing into the source buffer (not NUL-terminated) / Zeichenfolgenabschnitt im Quellpuffer (nicht NUL-terminiert)
+ */
+typedef struct {
+    const char* data;              /**< 起始地址 / Start address / Startadresse */
+    size_t length;                 /**< 长度 / Length / Länge */
+} config_span_t;
+    
+/**
+ * @brief 已知配置键标识 / Known configuration key identifiers / Bekannte Konfigurationsschlüssel-Kennungen
+ * @details 数值写入.nxptc文件，只能在末尾追加 / Values are written to .nxptc files, append only / Werte werden in .nxptc-Dateien geschrieben, nur am Ende anhängen
+ */
+typedef enum {
+    CONFIG_KEY_UNKNOWN = 0,
+    /* [TransferRule_N]段的键 / Keys of [TransferRule_N] sections / Schlüssel der [TransferRule_N]-Abschnitte */
+    CONFIG_KEY_SOURCE_PLUGIN,
+    CONFIG_KEY_SOURCE_INTERFACE,
+    CONFIG_KEY_SOURCE_PARAM_INDEX,
+    CONFIG_KEY_TARGET_PLUGIN,
+    CONFIG_KEY_TARGET_PLUGIN_PATH,
+    CONFIG_KEY_TARGET_INTERFACE,
+    CONFIG_KEY_TARGET_PARAM_INDEX,
+    CONFIG_KEY_TARGET_PARAM_VALUE,
+    CONFIG_KEY_DESCRIPTION,
+    CONFIG_KEY_MULTICAST_GROUP,
+    CONFIG_KEY_TRANSFER_MODE,
+    CONFIG_KEY_ENABLED,
+    CONFIG_KEY_CONDITION,
+    CONFIG_KEY_CACHE_SELF,
+    CONFIG_KEY_SET_GROUP,
+    /* [EntryPlugin]段的键 / Keys of the [EntryPlugin] section / Schlüssel des [EntryPlugin]-Abschnitts */
+    CONFIG_KEY_PLUGIN_NAME,
+    CONFIG_KEY_PLUGIN_PATH,
+    CONFIG_KEY_NXPT_PATH,
+    CONFIG_KEY_AUTO_RUN_INTERFACE,
+    CONFIG_KEY_DISABLE_INFO_LOG,
+    CONFIG_KEY_ENABLE_VALIDATION,
+    CONFIG_KEY_MAX_CALL_DEPTH,
+    CONFIG_KEY_MEMO_CACHE_SIZE,
+    CONFIG_KEY_MEMO_CACHE_TTL,
+    CONFIG_KEY_WATCH_RULES,
+    CONFIG_KEY_WATCH_INTERVAL,
+    CONFIG_KEY_IGNORE_PLUGINS,
+    CONFIG_KEY_PRELOAD,
+    CONFIG_KEY_PRELOAD_BIND_NOW,
+    CONFIG_KEY_MAX_LOADED_PLUGINS,
+    CONFIG_KEY_UNLOAD_IDLE_AFTER,
+    CONFIG_KEY_WATCH_PLUGINS,
+    CONFIG_KEY_MANIFEST_MAX_ENTRIES,
+    CONFIG_KEY_VALIDATION_PENDING,
+    CONFIG_KEY_TRIAL_CALLS,
+    CONFIG_KEY_CACHE_PLUGIN_METADATA,
+    /* 入口段键之后追加的规则键 / Rule keys appended after the entry section keys / Nach den Einstiegsabschnittsschlüsseln angehängte Regelschlüssel */
+    CONFIG_KEY_OWNERSHIP,
+    CONFIG_KEY_COUNT
+} config_key_id_t;
+    
+/* 第一个入口段键 / First entry section key / Erster Schlüssel des Einstiegsabschnitts */
+#define CONFIG_KEY_FIRST_ENTRY CONFIG_KEY_PLUGIN_NAME
+    
+/* 最后一个入口段键 / Last entry section key / Letzter Schlüssel des Einstiegsabschnitts */
+#define CONFIG_KEY_LAST_ENTRY CONFIG_KEY_CACHE_PLUGIN_METADATA
+    
+/* 是否为入口段键 / Whether a key belongs to the entry section / Ob ein Schlüssel zum Einstiegsabschnitt gehört */
+#define CONFIG_KEY_IS_ENTRY(key_id) ((key_id) >= CONFIG_KEY_FIRST_ENTRY && (key_id) <= CONFIG_KEY_LAST_ENTRY)
+    
+/**
+ * @brief 词法单元类型 / Token type / Token-Typ
+ */
+typedef enum {
+    CONFIG_TOKEN_END = 0,          /**< 输入结束 / End of input / Ende der Eingabe */
+    CONFIG_TOKEN_SECTION,          /**< [段名] / [section] / [Abschnitt] */
+    CONFIG_TOKEN_KEY_VALUE         /**< 键=值 / key=value / Schlüssel=Wert */
+} config_token_type_t;
+    
+/**
+ * @brief 词法单元 / Token / Token
+ */
+typedef struct {
+    config_token_type_t type;      /**< 类型 / Type / Typ */
+    config_span_t name;            /**< 段名或键名 / Section name or key / Abschnittsname oder Schlüssel */
+    config_span_t value;           /**< 值（仅键值对） / Value (key-value only) / Wert (nur Schlüssel-Wert) */
+    config_key_id_t key_id;        /**< 键标识（仅键值对） / Key identifier (key-value only) / Schlüsselkennung (nur Schlüssel-Wert) */
+    size_t line_number;            /**< 行号（从1开始） / Line number (1-based) / Zeilennummer (ab 1) */
+} config_token_t;
+    
+/**
+ * @brief 分词器状态 / Tokenizer state / Tokenizer-Zustand
+ */
+typedef struct {
+    const char* cursor;            /**< 当前位置 / Current position / Aktuelle Position */
+    const char* end;               /**< 缓冲区末尾 / Buffer end / Pufferende */
+    size_t line_number;            /**< 已读行数 / Lines read / Gelesene Zeilen */
+} config_tokenizer_t;
+    
+/**
+ * @brief 已识别的键值对（值指向源缓冲区） / Recognized key-value pair (value points into the source buffer) / Erkanntes Schlüssel-Wert-Paar (Wert zeigt in den Quellpuffer)
+ */
+typedef struct {
+    config_key_id_t key_id;        /**< 键标识 / Key identifier / Schlüsselkennung */
+    config_span_t value;           /**< 值 / Value / Wert */
+    size_t line_number;            /**< 行号 / Line number / Zeilennummer */
+} config_key_value_t;
+    
+/**
+ * @brief 初始化分词器 / Initialize tokenizer / Tokenizer initialisieren
+ * @param tokenizer 分词器 / Tokenizer / Tokenizer
+ * @param data 输入缓冲区（可为NULL当size为0） / Input buffer (may be NULL when size is 0) / Eingabepuffer (kann NULL sein, wenn size 0 ist)
+ * @param size 输入大小 / Input size / Eingabegröße
+ */
+void config_tokenizer_init(config_tokenizer_t* tokenizer, const char* data, size_t size);
+    
+/**
+ * @brief 读取下一个词法单元，跳过空行、注释和无法识别的行 / Read next token, skipping blank, comment and unrecognized lines / Nächstes Token lesen, leere, Kommentar- und unbekannte Zeilen überspringen
+ * @param tokenizer 分词器 / Tokenizer / Tokenizer
+ * @param token_out 输出词法单元 / Output token / Ausgabe-Token
+ * @return 读到词法单元返回1，输入结束返回0 / Returns 1 for a token, 0 at end of input / Gibt 1 für ein Token zurück, 0 am Ende der Eingabe
+ */
+int config_tokenizer_next(config_tokenizer_t* tokenizer, config_token_t* token_out);
+    
+/**
+ * @brief 通过编译期完美哈希查找键 / Look up key through compile-time perfect hash / Schlüssel über kompilierzeitlichen perfekten Hash nachschlagen
+ * @param key 键名 / Key name / Schlüsselname
+ * @param length 键名长度 / Key name length / Länge des Schlüsselnamens
+ * @return 键标识，未知键返回CONFIG_KEY_UNKNOWN / Key identifier, CONFIG_KEY_UNKNOWN for unknown keys / Schlüsselkennung, CONFIG_KEY_UNKNOWN für unbekannte Schlüssel
+ */
+config_key_id_t lookup_config_key(const char* key, size_t length);
+    
+/**
+ * @brief 校验配置键完美哈希表（每个键独占槽位） / Verify the configuration key perfect hash table (each key owns its slot) / Perfekte Hash-Tabelle der Konfigurationsschlüssel prüfen (jeder Schlüssel besitzt seinen Slot)
+ * @return 表一致返回0，存在冲突或缺失的键返回-1 / Returns 0 if the table is consistent, -1 if a key collides or is missing / Gibt 0 zurück, wenn die Tabelle konsistent ist, -1 bei kollidierendem oder fehlendem Schlüssel
+ */
+int verify_config_key_table(void);
+    
+/**
+ * @brief 比较片段与字符串 / Compare span with string / Abschnitt mit Zeichenfolge vergleichen
+ * @return 相等返回1，否则返回0 / Returns 1 if equal, 0 otherwise / Gibt 1 zurück wenn gleich, sonst 0
+ */
+int config_span_equals(config_span_t span, const char* text);
+    
+/**
+ * @brief 复制片段为新分配的字符串 / Copy span into newly allocated string / Abschnitt in neu zugewiesene Zeichenfolge kopieren
+ * @return 新字符串（调用者释放），失败返回NULL / New string (caller frees), NULL on failure / Neue Zeichenfolge (Aufrufer gibt frei), NULL bei Fehler
+ */
+char* copy_config_span(config_span_t span);
+    
+/**
+ * @brief 复制片段到调用者缓冲区（用于数值转换） / Copy span into caller buffer (for numeric conversion) / Abschnitt in Aufruferpuffer kopieren (für Zahlenumwandlung)
+ * @return 成功返回0，缓冲区不足返回-1 / Returns 0 on success, -1 if the buffer is too small / Gibt 0 bei Erfolg zurück, -1 wenn der Puffer zu klein ist
+ */
+int copy_config_span_to_buffer(config_span_t span, char* buffer, size_t buffer_size);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONFIG_TOKENIZER_H */
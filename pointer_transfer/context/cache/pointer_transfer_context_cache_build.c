@@ -11,33 +11,29 @@
 #include <limits.h>
 
 /**
- * @brief 构建规则缓存 / Build rule cache / Regel-Cache erstellen
+ * @brief 收集规则数组中CacheSelf规则的索引 / Collect indices of CacheSelf rules in a rules array / Indizes der CacheSelf-Regeln eines Regel-Arrays sammeln
+ * @param rules 规则数组 / Rules array / Regel-Array
+ * @param rule_count 规则数量 / Rule count / Regelanzahl
+ * @param indices_out 输出索引数组（无CacheSelf规则时为NULL） / Output index array (NULL without CacheSelf rules) / Ausgabe-Index-Array (NULL ohne CacheSelf-Regeln)
+ * @param count_out 输出索引数量 / Output index count / Ausgabe-Indexanzahl
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
-int build_rule_cache(void) {
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        internal_log_write("ERROR", "build_rule_cache: global context is NULL");
+int build_cached_rule_indices(const pointer_transfer_rule_t* rules, size_t rule_count, size_t** indices_out, size_t* count_out) {
+    if (indices_out == NULL || count_out == NULL) {
         return -1;
     }
+    *indices_out = NULL;
+    *count_out = 0;
     
-    /* 释放旧缓存 / Free old cache / Alten Cache freigeben */
-    if (ctx->cached_rule_indices != NULL) {
-        free(ctx->cached_rule_indices);
-        ctx->cached_rule_indices = NULL;
-        ctx->cached_rule_count = 0;
-        ctx->cached_rule_capacity = 0;
-    }
-    
-    if (ctx->rule_count == 0 || ctx->rules == NULL) {
-        internal_log_write("INFO", "build_rule_cache: no rules to cache (rule_count=%zu)", ctx->rule_count);
+    if (rule_count == 0 || rules == NULL) {
+        internal_log_write("INFO", "build_rule_cache: no rules to cache (rule_count=%zu)", rule_count);
         return 0;
     }
     
     /* 统计需要缓存的规则数量 / Count rules that require caching / Regeln zählen, die gecacht werden müssen */
     size_t cache_count = 0;
-    for (size_t i = 0; i < ctx->rule_count; i++) {
-        if (ctx->rules[i].cache_self && ctx->rules[i].enabled) {
+    for (size_t i = 0; i < rule_count; i++) {
+        if (rules[i].cache_self) {
             cache_count++;
         }
     }
@@ -54,24 +50,50 @@ int build_rule_cache(void) {
     }
     
     /* 分配缓存数组 / Allocate cache array / Cache-Array zuweisen */
-    ctx->cached_rule_indices = (size_t*)malloc(cache_count * sizeof(size_t));
-    if (ctx->cached_rule_indices == NULL) {
+    size_t* indices = (size_t*)malloc(cache_count * sizeof(size_t));
+    if (indices == NULL) {
         internal_log_write("ERROR", "build_rule_cache: failed to allocate memory for cache array (cache_count=%zu)", cache_count);
         return -1;
     }
     
     /* 填充缓存数组 / Fill cache array / Cache-Array füllen */
     size_t cache_index = 0;
-    for (size_t i = 0; i < ctx->rule_count; i++) {
-        if (ctx->rules[i].cache_self && ctx->rules[i].enabled) {
-            ctx->cached_rule_indices[cache_index++] = i;
+    for (size_t i = 0; i < rule_count; i++) {
+        if (rules[i].cache_self) {
+            indices[cache_index++] = i;
         }
     }
     
-    ctx->cached_rule_count = cache_count;
-    ctx->cached_rule_capacity = cache_count;
-    
+    *indices_out = indices;
+    *count_out = cache_count;
     internal_log_write("INFO", "Built rule cache with %zu cached rules", cache_count);
     return 0;
 }
 
+/**
+ * @brief 构建规则缓存 / Build rule cache / Regel-Cache erstellen
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_cache(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "build_rule_cache: global context is NULL");
+        return -1;
+    }
+    
+    /* 释放旧缓存 / Free old cache / Alten Cache freigeben */
+    if (ctx->cached_rule_indices != NULL) {
+        free(ctx->cached_rule_indices);
+        ctx->cached_rule_indices = NULL;
+        ctx->cached_rule_count = 0;
+        ctx->cached_rule_capacity = 0;
+    }
+    
+    size_t cache_count = 0;
+    if (build_cached_rule_indices(ctx->rules, ctx->rule_count, &ctx->cached_rule_indices, &cache_count) != 0) {
+        return -1;
+    }
+    ctx->cached_rule_count = cache_count;
+    ctx->cached_rule_capacity = cache_count;
+    return 0;
+}
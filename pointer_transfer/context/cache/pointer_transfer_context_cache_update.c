@@ -0,0 +1,70 @@
+/**
+ * @file pointer_transfer_context_cache_update.c
+ * @brief 规则缓存增量更新 / Rule Cache Incremental Update / Inkrementelle Regel-Cache-Aktualisierung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 将追加的CacheSelf规则加入缓存 / Add appended CacheSelf rules to cache / Angehängte CacheSelf-Regeln zum Cache hinzufügen
+ * @param start_index 第一条新规则的索引 / Index of first new rule / Index der ersten neuen Regel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int append_rule_cache(size_t start_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "append_rule_cache: global context is NULL");
+        return -1;
+    }
+    
+    if (start_index == 0) {
+        return build_rule_cache();
+    }
+    
+    for (size_t i = start_index; i < ctx->rule_count; i++) {
+        if (!ctx->rules[i].cache_self) {
+            continue;
+        }
+        
+        if (ctx->cached_rule_count >= ctx->cached_rule_capacity) {
+            size_t new_capacity = ctx->cached_rule_capacity == 0 ? 8 : ctx->cached_rule_capacity * CAPACITY_GROWTH_FACTOR;
+            if (new_capacity < ctx->cached_rule_capacity || new_capacity > SIZE_MAX / sizeof(size_t)) {
+                internal_log_write("ERROR", "append_rule_cache: capacity overflow detected (current=%zu)", ctx->cached_rule_capacity);
+                return -1;
+            }
+            size_t* new_indices = (size_t*)realloc(ctx->cached_rule_indices, new_capacity * sizeof(size_t));
+            if (new_indices == NULL) {
+                internal_log_write("ERROR", "append_rule_cache: failed to expand cache array (new_capacity=%zu)", new_capacity);
+                return -1;
+            }
+            ctx->cached_rule_indices = new_indices;
+            ctx->cached_rule_capacity = new_capacity;
+        }
+        ctx->cached_rule_indices[ctx->cached_rule_count++] = i;
+    }
+    return 0;
+}
+
+/**
+ * @brief 从缓存移除规则 / Remove rule from cache / Regel aus Cache entfernen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ */
+void remove_rule_from_cache(size_t rule_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->cached_rule_indices == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < ctx->cached_rule_count; i++) {
+        if (ctx->cached_rule_indices[i] == rule_index) {
+            memmove(&ctx->cached_rule_indices[i], &ctx->cached_rule_indices[i + 1],
+                    (ctx->cached_rule_count - i - 1) * sizeof(size_t));
+            ctx->cached_rule_count--;
+            return;
+        }
+    }
+}
@@ -7,6 +7,9 @@
 #include "pointer_transfer_utils.h"
 #include "pointer_transfer_platform.h"
 #include "pointer_transfer_config.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_currying.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -19,6 +22,18 @@ void cleanup_context(void) {
         return;
     }
     
+    /* 等待后台初始化和自动运行结束，它们会启动监视线程和预加载 / Wait for background initialization and auto-run, which start the watcher thread and preloading / Auf Hintergrundinitialisierung und Autostart warten, die Überwachungsthread und Vorladen starten */
+    finish_plugin_init();
+    
+    /* 先停止监视线程，避免清理期间重载 / Stop watcher thread first so no reload runs during cleanup / Überwachungsthread zuerst stoppen, damit während der Bereinigung kein Neuladen läuft */
+    stop_rule_watcher();
+    
+    /* 等待预加载完成，它会写入已加载插件和接口状态 / Wait for preloading, which writes loaded plugins and interface states / Auf das Vorladen warten, das geladene Plugins und Schnittstellenstatus schreibt */
+    wait_for_plugin_preload();
+    
+    /* 后台验证会调用插件函数，需在释放接口状态和卸载插件前结束 / Background validation calls plugin functions and must finish before interface states are freed and plugins unloaded / Die Hintergrundvalidierung ruft Plugin-Funktionen auf und muss vor dem Freigeben der Schnittstellenstatus und dem Entladen der Plugins enden */
+    free_interface_validation();
+    
     if (ctx->stored_type_name != NULL) {
         free(ctx->stored_type_name);
         ctx->stored_type_name = NULL;
@@ -62,33 +77,22 @@ void cleanup_context(void) {
                 free(state->param_float_values);
                 state->param_float_values = NULL;
             }
+            if (state->param_borrowed != NULL) {
+                free(state->param_borrowed);
+                state->param_borrowed = NULL;
+            }
         }
         free(ctx->interface_states);
         ctx->interface_states = NULL;
         ctx->interface_state_count = 0;
         ctx->interface_state_capacity = 0;
     }
-    if (ctx->loaded_plugins != NULL) {
-        for (size_t i = 0; i < ctx->loaded_plugin_count; i++) {
-            if (ctx->loaded_plugins[i].plugin_name != NULL) {
-                free(ctx->loaded_plugins[i].plugin_name);
-                ctx->loaded_plugins[i].plugin_name = NULL;
-            }
-            if (ctx->loaded_plugins[i].plugin_path != NULL) {
-                free(ctx->loaded_plugins[i].plugin_path);
-                ctx->loaded_plugins[i].plugin_path = NULL;
-            }
-            if (ctx->loaded_plugins[i].handle != NULL) {
-                pt_platform_close_library(ctx->loaded_plugins[i].handle);
-                ctx->loaded_plugins[i].handle = NULL;
-            }
-        }
-        free(ctx->loaded_plugins);
-        ctx->loaded_plugins = NULL;
-        ctx->loaded_plugin_count = 0;
-        ctx->loaded_plugin_capacity = 0;
-    }
+    free_plugin_registry();
     free_transfer_rules();
+    ctx->targets_prepared = 0;
+    /* 规则释放后才能解除映射和内存区 / Mappings and arenas are released only after the rules / Zuordnungen und Arenen erst nach den Regeln freigeben */
+    release_compiled_rule_maps();
+    release_config_string_arenas();
     
     /* 清理规则哈希表（手动清理，因为 free_hash_table 是静态的）/ Cleanup rule hash table (manual cleanup, since free_hash_table is static) / Regel-Hash-Tabelle bereinigen (manuelle Bereinigung, da free_hash_table statisch ist) */
     if (ctx->rule_hash_table.buckets != NULL) {
@@ -106,6 +110,12 @@ void cleanup_context(void) {
     ctx->rule_hash_table.bucket_count = 0;
     ctx->rule_hash_table.entry_count = 0;
     
+    free_memo_cache();
+    free_rule_graph();
+    free_call_cycle_marks();
+    free_call_frame_pool();
+    free_memo_key_buffer();
+    
     if (ctx->cached_rule_indices != NULL) {
         free(ctx->cached_rule_indices);
         ctx->cached_rule_indices = NULL;
@@ -128,26 +138,26 @@ void cleanup_context(void) {
         free(ctx->entry_auto_run_interface);
         ctx->entry_auto_run_interface = NULL;
     }
-    if (ctx->loaded_nxpt_files != NULL) {
-        for (size_t i = 0; i < ctx->loaded_nxpt_count; i++) {
-            if (ctx->loaded_nxpt_files[i].plugin_name != NULL) {
-                free(ctx->loaded_nxpt_files[i].plugin_name);
-                ctx->loaded_nxpt_files[i].plugin_name = NULL;
-            }
-            if (ctx->loaded_nxpt_files[i].nxpt_path != NULL) {
-                free(ctx->loaded_nxpt_files[i].nxpt_path);
-                ctx->loaded_nxpt_files[i].nxpt_path = NULL;
-            }
-        }
-        free(ctx->loaded_nxpt_files);
-        ctx->loaded_nxpt_files = NULL;
-        ctx->loaded_nxpt_count = 0;
-        ctx->loaded_nxpt_capacity = 0;
-    }
-    free_nxpt_hash_table_internal();
+    free_rule_sources();
+    free_rule_set_lock();
+    close_validation_databases();
     
     int saved_disable_info_log = ctx->disable_info_log;
     int saved_enable_validation = ctx->enable_validation;
+    int saved_max_call_depth = ctx->max_call_depth;
+    size_t saved_memo_max_entries = ctx->memo_cache.max_entries;
+    int saved_memo_disabled = ctx->memo_cache.disabled;
+    int64_t saved_memo_ttl_ms = ctx->memo_cache.ttl_ms;
+    int saved_watch_rules = ctx->watch_rules;
+    uint32_t saved_watch_interval_ms = ctx->watch_interval_ms;
+    int saved_preload_plugins = ctx->preload_plugins;
+    int saved_preload_bind_now = ctx->preload_bind_now;
+    size_t saved_max_loaded_plugins = ctx->max_loaded_plugins;
+    uint32_t saved_unload_idle_after_ms = ctx->unload_idle_after_ms;
+    int saved_watch_plugins = ctx->watch_plugins;
+    size_t saved_manifest_max_entries = ctx->manifest_max_entries;
+    validation_pending_policy_t saved_validation_pending = ctx->validation_pending;
+    int saved_disable_metadata_cache = ctx->disable_metadata_cache;
     
     /* 释放忽略插件列表 / Free ignored plugins list / Liste der ignorierten Plugins freigeben */
     if (ctx->ignore_plugins != NULL) {
@@ -163,11 +173,29 @@ void cleanup_context(void) {
         ctx->ignore_plugin_capacity = 0;
     }
     
+    /* 释放试调用插件列表 / Free trial call plugin list / Liste der Probeaufruf-Plugins freigeben */
+    free(ctx->trial_call_plugins);
+    ctx->trial_call_plugins = NULL;
+    
     /* 重置所有字段 / Reset all fields / Alle Felder zurücksetzen */
     memset(ctx, 0, sizeof(pointer_transfer_context_t));
     ctx->stored_type = NXLD_PARAM_TYPE_UNKNOWN;
     ctx->disable_info_log = saved_disable_info_log;  /* 恢复日志配置状态 / Restore log configuration state / Protokollkonfigurationsstatus wiederherstellen */
     ctx->enable_validation = saved_enable_validation;  /* 恢复验证配置状态 / Restore validation configuration state / Validierungskonfigurationsstatus wiederherstellen */
+    ctx->max_call_depth = saved_max_call_depth;  /* 恢复调用深度配置 / Restore call depth configuration / Aufruftiefen-Konfiguration wiederherstellen */
+    ctx->memo_cache.max_entries = saved_memo_max_entries;  /* 恢复记忆化缓存配置 / Restore memoization cache configuration / Memoisierungs-Cache-Konfiguration wiederherstellen */
+    ctx->memo_cache.disabled = saved_memo_disabled;
+    ctx->memo_cache.ttl_ms = saved_memo_ttl_ms;
+    ctx->watch_rules = saved_watch_rules;  /* 恢复规则监视配置 / Restore rule watch configuration / Regelüberwachungs-Konfiguration wiederherstellen */
+    ctx->watch_interval_ms = saved_watch_interval_ms;
+    ctx->preload_plugins = saved_preload_plugins;  /* 恢复预加载配置 / Restore preload configuration / Vorlade-Konfiguration wiederherstellen */
+    ctx->preload_bind_now = saved_preload_bind_now;
+    ctx->max_loaded_plugins = saved_max_loaded_plugins;  /* 恢复插件驻留策略 / Restore plugin residency policy / Plugin-Residenzrichtlinie wiederherstellen */
+    ctx->unload_idle_after_ms = saved_unload_idle_after_ms;
+    ctx->watch_plugins = saved_watch_plugins;  /* 恢复插件文件监视配置 / Restore plugin file watch configuration / Plugin-Dateiüberwachungs-Konfiguration wiederherstellen */
+    ctx->manifest_max_entries = saved_manifest_max_entries;  /* 恢复目录清单上限 / Restore directory manifest limit / Verzeichnismanifest-Grenze wiederherstellen */
+    ctx->validation_pending = saved_validation_pending;  /* 恢复验证等待策略 / Restore validation pending policy / Strategie für ausstehende Validierung wiederherstellen */
+    ctx->disable_metadata_cache = saved_disable_metadata_cache;  /* 恢复元数据缓存配置 / Restore metadata cache configuration / Metadaten-Cache-Konfiguration wiederherstellen */
     
     internal_log_write("INFO", "Context cleaned up successfully");
 }
@@ -0,0 +1,197 @@
+/**
+ * @file pointer_transfer_context_graph_sync.c
+ * @brief 规则图与记忆化缓存同步及规则批处理 / Rule Graph and Memo Cache Synchronization, Rule Batching / Synchronisierung von Regelgraph und Memo-Cache, Regel-Stapelverarbeitung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+
+/* 节点状态位：纯接口、位于环中 / Node state bits: pure, part of a cycle / Knotenstatus-Bits: rein, Teil eines Zyklus */
+#define RULE_GRAPH_FLAG_MEMOIZABLE 0x01
+#define RULE_GRAPH_FLAG_CYCLIC 0x02
+
+/**
+ * @brief 获取节点的记忆化相关状态位 / Get a node's memoization-relevant state bits / Memoisierungsrelevante Statusbits eines Knotens abrufen
+ */
+static unsigned char get_rule_graph_node_flags(const rule_graph_node_t* node) {
+    return (unsigned char)((node->memoizable != 0 ? RULE_GRAPH_FLAG_MEMOIZABLE : 0) |
+                           (node->cyclic ? RULE_GRAPH_FLAG_CYCLIC : 0));
+}
+
+/**
+ * @brief 记录规则图所有节点的状态位 / Record state bits of all rule graph nodes / Statusbits aller Regelgraph-Knoten festhalten
+ * @param graph 规则图 / Rule graph / Regelgraph
+ * @param count_out 输出节点数量 / Output node count / Ausgabe Knotenanzahl
+ * @return 状态位数组（调用方释放），无节点或失败返回NULL（失败时count_out仍为节点数量） / State bit array (caller frees), NULL without nodes or on failure (count_out still holds the node count on failure) / Statusbit-Array (Aufrufer gibt frei), NULL ohne Knoten oder bei Fehler (count_out enthält bei Fehler trotzdem die Knotenanzahl)
+ */
+unsigned char* snapshot_rule_graph_flags(const rule_graph_t* graph, size_t* count_out) {
+    *count_out = graph != NULL ? graph->node_count : 0;
+    if (graph == NULL || graph->node_count == 0) {
+        return NULL;
+    }
+    
+    unsigned char* flags = (unsigned char*)malloc(graph->node_count);
+    if (flags == NULL) {
+        return NULL;
+    }
+    for (size_t i = 0; i < graph->node_count; i++) {
+        flags[i] = get_rule_graph_node_flags(&graph->nodes[i]);
+    }
+    return flags;
+}
+
+/**
+ * @brief 按规则图状态变化同步记忆化缓存 / Synchronize memoization cache with rule graph state changes / Memoisierungs-Cache mit Zustandsänderungen des Regelgraphen abgleichen
+ * @details 只丢弃纯接口或环状态相对快照发生变化的节点的条目；快照不可用时清空整个缓存 / Only entries of nodes whose purity or cycle state differs from the snapshot are dropped; without a usable snapshot the whole cache is flushed / Nur Einträge von Knoten, deren Reinheit oder Zyklusstatus vom Schnappschuss abweicht, werden verworfen; ohne brauchbaren Schnappschuss wird der ganze Cache geleert
+ * @param flags 变化前的状态位（snapshot_rule_graph_flags的结果） / State bits before the change (result of snapshot_rule_graph_flags) / Statusbits vor der Änderung (Ergebnis von snapshot_rule_graph_flags)
+ * @param flag_count 变化前的节点数量 / Node count before the change / Knotenanzahl vor der Änderung
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int sync_memo_cache_with_graph(const unsigned char* flags, size_t flag_count) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    if (flags == NULL && flag_count > 0) {
+        return init_memo_cache();
+    }
+    
+    /* 新节点没有记忆化条目，只需比较已有节点 / New nodes have no memoized entries, only existing nodes are compared / Neue Knoten haben keine memoisierten Einträge, nur vorhandene Knoten werden verglichen */
+    const rule_graph_t* graph = &ctx->rule_graph;
+    size_t compare_count = flag_count < graph->node_count ? flag_count : graph->node_count;
+    size_t* changed = compare_count > 0 ? (size_t*)malloc(compare_count * sizeof(size_t)) : NULL;
+    if (compare_count > 0 && changed == NULL) {
+        return init_memo_cache();
+    }
+    size_t changed_count = 0;
+    for (size_t i = 0; i < compare_count; i++) {
+        if (flags[i] != get_rule_graph_node_flags(&graph->nodes[i])) {
+            changed[changed_count++] = i;
+        }
+    }
+    /* 收缩的图中消失的节点同样丢弃 / Nodes missing from a shrunken graph are dropped as well / In einem geschrumpften Graphen fehlende Knoten werden ebenfalls verworfen */
+    if (flag_count > graph->node_count) {
+        free(changed);
+        return init_memo_cache();
+    }
+    if (changed_count > 0) {
+        invalidate_memo_cache_nodes(changed, changed_count);
+    }
+    free(changed);
+    return ensure_memo_cache();
+}
+
+/**
+ * @brief 完整重建规则图并同步记忆化缓存 / Fully rebuild rule graph and synchronize memoization cache / Regelgraph vollständig neu aufbauen und Memoisierungs-Cache abgleichen
+ * @details 批量合并期间只标记过期，批量结束时统一重建；节点ID保持稳定，只有状态变化的节点丢弃记忆化结果 / During a batch merge the graph is only marked stale and rebuilt once when the batch ends; node IDs stay stable and only nodes whose state changed drop memoized results / Während einer Stapelzusammenführung wird der Graph nur als veraltet markiert und am Stapelende einmal neu aufgebaut; Knoten-IDs bleiben stabil und nur Knoten mit geändertem Status verwerfen memoisierte Ergebnisse
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int refresh_rule_graph(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    if (ctx->rule_batch_depth > 0) {
+        ctx->rule_graph_stale = 1;
+        return 0;
+    }
+    
+    size_t flag_count = 0;
+    unsigned char* flags = snapshot_rule_graph_flags(&ctx->rule_graph, &flag_count);
+    
+    int result = 0;
+    /* 构建静态规则图 / Build static rule graph / Statischen Regelgraphen erstellen */
+    if (build_rule_graph() != 0) {
+        internal_log_write("WARNING", "Failed to build rule graph, runtime cycle detection unavailable for new rules");
+        result = -1;
+    }
+    
+    if (sync_memo_cache_with_graph(flags, flag_count) != 0) {
+        internal_log_write("WARNING", "Failed to initialize memoization cache, pure interfaces will not be memoized");
+        result = -1;
+    }
+    free(flags);
+    
+    ctx->rule_graph_stale = 0;
+    return result;
+}
+
+/**
+ * @brief 把追加的规则增量加入规则图 / Add appended rules to the rule graph incrementally / Angehängte Regeln inkrementell in den Regelgraphen aufnehmen
+ * @details 批量合并期间延迟到批量结束；增量更新失败时完整重建 / Deferred to batch end during a batch merge; falls back to a full rebuild when the incremental update fails / Während einer Stapelzusammenführung bis zum Stapelende verzögert; bei fehlgeschlagener inkrementeller Aktualisierung vollständiger Neuaufbau
+ * @param start_rule_index 第一条追加规则的索引 / Index of the first appended rule / Index der ersten angehängten Regel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int update_rule_graph_appended(size_t start_rule_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    if (ctx->rule_batch_depth > 0 || ctx->rule_graph_stale) {
+        return refresh_rule_graph();
+    }
+    
+    if (add_rule_graph_rules(start_rule_index) != 0) {
+        internal_log_write("WARNING", "Incremental rule graph update failed, rebuilding rule graph");
+        return refresh_rule_graph();
+    }
+    if (ensure_memo_cache() != 0) {
+        internal_log_write("WARNING", "Failed to initialize memoization cache, pure interfaces will not be memoized");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 把移除的规则增量移出规则图 / Remove a removed rule from the rule graph incrementally / Entfernte Regel inkrementell aus dem Regelgraphen nehmen
+ * @details 规则槽位已清空时调用；增量更新失败时完整重建 / Called after the rule slot has been cleared; falls back to a full rebuild when the incremental update fails / Wird aufgerufen, nachdem der Regel-Slot geleert wurde; bei fehlgeschlagener inkrementeller Aktualisierung vollständiger Neuaufbau
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param cache_self 被移除规则的CacheSelf标志 / CacheSelf flag of the removed rule / CacheSelf-Flag der entfernten Regel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int update_rule_graph_removed(size_t rule_index, int cache_self) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    if (ctx->rule_batch_depth > 0 || ctx->rule_graph_stale) {
+        return refresh_rule_graph();
+    }
+    
+    if (remove_rule_graph_rule(rule_index, cache_self) != 0) {
+        internal_log_write("WARNING", "Incremental rule graph update failed, rebuilding rule graph");
+        return refresh_rule_graph();
+    }
+    return 0;
+}
+
+/**
+ * @brief 开始批量合并规则 / Begin batch rule merge / Stapel-Regelzusammenführung beginnen
+ */
+void begin_rule_batch(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    ctx->rule_batch_depth++;
+}
+
+/**
+ * @brief 结束批量合并规则，必要时重建规则图 / End batch rule merge, rebuilding rule graph if needed / Stapel-Regelzusammenführung beenden, Regelgraph bei Bedarf neu aufbauen
+ */
+void end_rule_batch(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->rule_batch_depth <= 0) {
+        return;
+    }
+    
+    if (--ctx->rule_batch_depth == 0 && ctx->rule_graph_stale) {
+        refresh_rule_graph();
+    }
+}
@@ -17,7 +17,7 @@ void init_context(void) {
     }
     
     /* 清理旧数据 / Cleanup old data / Alte Daten bereinigen */
-    if (ctx->rules != NULL || ctx->loaded_plugins != NULL || ctx->interface_states != NULL ||
+    if (ctx->rules != NULL || ctx->plugin_registry.count != 0 || ctx->interface_states != NULL ||
         ctx->stored_type_name != NULL || ctx->plugin_dll_path != NULL) {
         cleanup_context();
     }
@@ -29,10 +29,5 @@ void init_context(void) {
     ctx->rule_hash_table.buckets = NULL;
     ctx->rule_hash_table.bucket_count = 0;
     ctx->rule_hash_table.entry_count = 0;
-    
-    /* 初始化.nxpt哈希表结构 / Initialize .nxpt hash table structure / .nxpt-Hash-Tabellen-Struktur initialisieren */
-    ctx->nxpt_hash_table.buckets = NULL;
-    ctx->nxpt_hash_table.bucket_count = 0;
-    ctx->nxpt_hash_table.entry_count = 0;
 }
 
@@ -37,22 +37,5 @@ void free_transfer_rules(void) {
     ctx->rule_hash_table.buckets = NULL;
     ctx->rule_hash_table.bucket_count = 0;
     ctx->rule_hash_table.entry_count = 0;
-    
-    if (ctx->path_cache != NULL) {
-        for (size_t i = 0; i < ctx->path_cache_count; i++) {
-            if (ctx->path_cache[i].plugin_name != NULL) {
-                free(ctx->path_cache[i].plugin_name);
-                ctx->path_cache[i].plugin_name = NULL;
-            }
-            if (ctx->path_cache[i].plugin_path != NULL) {
-                free(ctx->path_cache[i].plugin_path);
-                ctx->path_cache[i].plugin_path = NULL;
-            }
-        }
-        free(ctx->path_cache);
-        ctx->path_cache = NULL;
-        ctx->path_cache_count = 0;
-        ctx->path_cache_capacity = 0;
-    }
 }
 
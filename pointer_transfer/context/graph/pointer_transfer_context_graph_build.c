@@ -0,0 +1,272 @@
+/**
+ * @file pointer_transfer_context_graph_build.c
+ * @brief 静态规则图构建和查询 / Static Rule Graph Building and Querying / Statischer Regelgraph-Aufbau und -Abfrage
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+
+/**
+ * @brief 释放规则图边和规则映射（保留驻留的节点） / Free rule graph edges and rule mappings (keep interned nodes) / Regelgraph-Kanten und Regelzuordnungen freigeben (internierte Knoten behalten)
+ */
+static void free_rule_graph_edges(rule_graph_t* graph) {
+    if (graph->edges != NULL) {
+        free(graph->edges);
+        graph->edges = NULL;
+    }
+    if (graph->rule_source_nodes != NULL) {
+        free(graph->rule_source_nodes);
+        graph->rule_source_nodes = NULL;
+    }
+    if (graph->rule_target_nodes != NULL) {
+        free(graph->rule_target_nodes);
+        graph->rule_target_nodes = NULL;
+    }
+    graph->edge_count = 0;
+    graph->edge_slot_count = 0;
+    graph->edge_capacity = 0;
+    graph->rule_node_count = 0;
+    graph->scc_count = 0;
+    graph->rank_limit = 0;
+    graph->cyclic_node_count = 0;
+}
+
+/**
+ * @brief 释放规则图的全部数据 / Free all data of a rule graph / Alle Daten eines Regelgraphen freigeben
+ */
+void release_rule_graph(rule_graph_t* graph) {
+    if (graph == NULL) {
+        return;
+    }
+    
+    free_rule_graph_edges(graph);
+    if (graph->nodes != NULL) {
+        for (size_t i = 0; i < graph->node_count; i++) {
+            if (graph->nodes[i].plugin_name != NULL) {
+                free(graph->nodes[i].plugin_name);
+                graph->nodes[i].plugin_name = NULL;
+            }
+            if (graph->nodes[i].interface_name != NULL) {
+                free(graph->nodes[i].interface_name);
+                graph->nodes[i].interface_name = NULL;
+            }
+        }
+        free(graph->nodes);
+        graph->nodes = NULL;
+    }
+    if (graph->node_buckets != NULL) {
+        free(graph->node_buckets);
+        graph->node_buckets = NULL;
+    }
+    graph->node_count = 0;
+    graph->node_capacity = 0;
+    graph->bucket_count = 0;
+}
+
+/**
+ * @brief 释放静态规则图 / Free static rule graph / Statischen Regelgraphen freigeben
+ */
+void free_rule_graph(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    release_rule_graph(&ctx->rule_graph);
+}
+
+/**
+ * @brief 为规则数组构建规则图 / Build rule graph for a rules array / Regelgraph für ein Regel-Array erstellen
+ * @details 节点ID只追加不重排，重建期间进行中的调用持有的ID仍然有效；禁用的规则也会建边，以便启用状态切换无需重建 / Node IDs are append-only and never renumbered, so IDs held by in-flight calls stay valid across rebuilds; disabled rules also contribute edges so enable flips need no rebuild / Knoten-IDs werden nur angehängt und nie neu nummeriert, sodass IDs laufender Aufrufe über Neuaufbauten gültig bleiben; deaktivierte Regeln tragen ebenfalls Kanten bei, damit Aktivierungswechsel keinen Neuaufbau erfordern
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_graph_for_rules(rule_graph_t* graph, const pointer_transfer_rule_t* rules, size_t rule_count) {
+    if (graph == NULL) {
+        return -1;
+    }
+    
+    free_rule_graph_edges(graph);
+    
+    if (rule_count == 0 || rules == NULL) {
+        /* 保留的节点不再有边，也不再是纯接口 / Kept nodes no longer have edges and are no longer pure / Erhaltene Knoten haben keine Kanten mehr und sind nicht mehr rein */
+        for (size_t i = 0; i < graph->node_count; i++) {
+            graph->nodes[i].edge_start = 0;
+            graph->nodes[i].edge_count = 0;
+            graph->nodes[i].memoizable = 0;
+        }
+        return compute_rule_graph_scc(graph);
+    }
+    
+    if (rule_count > SIZE_MAX / sizeof(size_t)) {
+        internal_log_write("ERROR", "build_rule_graph: rule count overflow detected (rule_count=%zu)", rule_count);
+        return -1;
+    }
+    
+    graph->rule_source_nodes = (size_t*)malloc(rule_count * sizeof(size_t));
+    graph->rule_target_nodes = (size_t*)malloc(rule_count * sizeof(size_t));
+    if (graph->rule_source_nodes == NULL || graph->rule_target_nodes == NULL) {
+        internal_log_write("ERROR", "build_rule_graph: failed to allocate rule node mappings (rule_count=%zu)", rule_count);
+        free_rule_graph_edges(graph);
+        return -1;
+    }
+    graph->rule_node_count = rule_count;
+    
+    /* 驻留接口标识并统计出度 / Intern interface identifiers and count out-degrees / Schnittstellenbezeichner internieren und Ausgangsgrade zählen */
+    size_t edge_total = 0;
+    for (size_t i = 0; i < rule_count; i++) {
+        const pointer_transfer_rule_t* rule = &rules[i];
+        graph->rule_source_nodes[i] = intern_rule_graph_node(graph, rule->source_plugin, rule->source_interface);
+        graph->rule_target_nodes[i] = intern_rule_graph_node(graph, rule->target_plugin, rule->target_interface);
+        if (graph->rule_source_nodes[i] != RULE_GRAPH_INVALID_NODE && graph->rule_target_nodes[i] != RULE_GRAPH_INVALID_NODE) {
+            edge_total++;
+        }
+    }
+    
+    for (size_t i = 0; i < graph->node_count; i++) {
+        graph->nodes[i].edge_start = 0;
+        graph->nodes[i].edge_count = 0;
+        graph->nodes[i].scc_id = RULE_GRAPH_INVALID_NODE;
+        graph->nodes[i].topo_rank = 0;
+        graph->nodes[i].cyclic = 0;
+        graph->nodes[i].memoizable = 0;
+    }
+    
+    /* CacheSelf规则声明其目标接口为纯接口（与启用状态无关） / CacheSelf rules declare their target interface pure (regardless of enabled state) / CacheSelf-Regeln deklarieren ihre Zielschnittstelle als rein (unabhängig vom Aktivierungsstatus) */
+    size_t memoizable_count = 0;
+    for (size_t i = 0; i < rule_count; i++) {
+        size_t dst = graph->rule_target_nodes[i];
+        if (rules[i].cache_self && dst != RULE_GRAPH_INVALID_NODE && graph->nodes[dst].memoizable++ == 0) {
+            memoizable_count++;
+        }
+    }
+    
+    if (edge_total > 0) {
+        graph->edges = (size_t*)malloc(edge_total * sizeof(size_t));
+        if (graph->edges == NULL) {
+            internal_log_write("ERROR", "build_rule_graph: failed to allocate edge array (edge_count=%zu)", edge_total);
+            free_rule_graph_edges(graph);
+            return -1;
+        }
+    }
+    
+    /* 按源节点填充CSR邻接表 / Fill CSR adjacency by source node / CSR-Adjazenz nach Quellknoten füllen */
+    for (size_t i = 0; i < rule_count; i++) {
+        if (graph->rule_source_nodes[i] != RULE_GRAPH_INVALID_NODE && graph->rule_target_nodes[i] != RULE_GRAPH_INVALID_NODE) {
+            graph->nodes[graph->rule_source_nodes[i]].edge_count++;
+        }
+    }
+    size_t offset = 0;
+    for (size_t i = 0; i < graph->node_count; i++) {
+        graph->nodes[i].edge_start = offset;
+        offset += graph->nodes[i].edge_count;
+        graph->nodes[i].edge_count = 0;
+    }
+    for (size_t i = 0; i < rule_count; i++) {
+        size_t src = graph->rule_source_nodes[i];
+        size_t dst = graph->rule_target_nodes[i];
+        if (src != RULE_GRAPH_INVALID_NODE && dst != RULE_GRAPH_INVALID_NODE) {
+            rule_graph_node_t* node = &graph->nodes[src];
+            graph->edges[node->edge_start + node->edge_count] = dst;
+            node->edge_count++;
+        }
+    }
+    graph->edge_count = edge_total;
+    graph->edge_slot_count = edge_total;
+    graph->edge_capacity = edge_total;
+    
+    if (compute_rule_graph_scc(graph) != 0) {
+        internal_log_write("ERROR", "build_rule_graph: failed to compute strongly connected components");
+        free_rule_graph_edges(graph);
+        return -1;
+    }
+    
+    internal_log_write("INFO", "Built rule graph with %zu interfaces, %zu edges, %zu components (%zu interfaces in cycles, %zu pure)",
+                      graph->node_count, graph->edge_count, graph->scc_count, graph->cyclic_node_count, memoizable_count);
+    return 0;
+}
+
+/**
+ * @brief 构建静态规则图 / Build static rule graph / Statischen Regelgraphen erstellen
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_graph(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "build_rule_graph: global context is NULL");
+        return -1;
+    }
+    
+    return build_rule_graph_for_rules(&ctx->rule_graph, ctx->rules, ctx->rule_count);
+}
+
+/**
+ * @brief 获取规则目标接口的规则图节点ID / Get rule graph node ID of rule target interface / Regelgraph-Knoten-ID der Regel-Zielschnittstelle abrufen
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @return 节点ID，未找到返回RULE_GRAPH_INVALID_NODE / Node ID, RULE_GRAPH_INVALID_NODE if not found / Knoten-ID, RULE_GRAPH_INVALID_NODE wenn nicht gefunden
+ */
+size_t get_rule_target_graph_node(const pointer_transfer_rule_t* rule) {
+    if (rule == NULL) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    /* 规则位于规则数组内时直接查表 / Direct lookup when rule lies inside rules array / Direkte Suche, wenn Regel im Regel-Array liegt */
+    const rule_graph_t* graph = &ctx->rule_graph;
+    if (ctx->rules != NULL && graph->rule_target_nodes != NULL &&
+        rule >= ctx->rules && rule < ctx->rules + graph->rule_node_count) {
+        return graph->rule_target_nodes[rule - ctx->rules];
+    }
+    
+    return find_rule_graph_node(rule->target_plugin, rule->target_interface);
+}
+
+/**
+ * @brief 检查规则图节点是否位于环中 / Check if rule graph node is part of a cycle / Prüfen, ob Regelgraph-Knoten Teil eines Zyklus ist
+ * @param node_id 节点ID / Node ID / Knoten-ID
+ * @return 位于环中返回1，否则返回0 / Returns 1 if cyclic, 0 otherwise / Gibt 1 zurück wenn zyklisch, sonst 0
+ */
+int is_rule_graph_node_cyclic(size_t node_id) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || node_id >= ctx->rule_graph.node_count) {
+        return 0;
+    }
+    
+    return ctx->rule_graph.nodes[node_id].cyclic;
+}
+
+/**
+ * @brief 检查规则图节点是否为可记忆化的纯接口 / Check if rule graph node is a memoizable pure interface / Prüfen, ob Regelgraph-Knoten eine memoisierbare reine Schnittstelle ist
+ * @param node_id 节点ID / Node ID / Knoten-ID
+ * @return 可记忆化返回1，否则返回0 / Returns 1 if memoizable, 0 otherwise / Gibt 1 zurück wenn memoisierbar, sonst 0
+ */
+int is_rule_graph_node_memoizable(size_t node_id) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->rule_graph.nodes == NULL || node_id >= ctx->rule_graph.node_count) {
+        return 0;
+    }
+    
+    return ctx->rule_graph.nodes[node_id].memoizable != 0;
+}
+
+/**
+ * @brief 获取规则图节点的拓扑序号 / Get topological rank of rule graph node / Topologischen Rang eines Regelgraph-Knotens abrufen
+ * @param node_id 节点ID / Node ID / Knoten-ID
+ * @return 拓扑序号，无效节点返回RULE_GRAPH_INVALID_NODE / Topological rank, RULE_GRAPH_INVALID_NODE for an invalid node / Topologischer Rang, RULE_GRAPH_INVALID_NODE bei ungültigem Knoten
+ */
+size_t get_rule_graph_node_rank(size_t node_id) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->rule_graph.nodes == NULL || node_id >= ctx->rule_graph.node_count) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    return ctx->rule_graph.nodes[node_id].topo_rank;
+}
@@ -0,0 +1,237 @@
+/**
+ * @file pointer_transfer_context_graph_intern.c
+ * @brief 规则图接口ID驻留 / Rule Graph Interface ID Interning / Regelgraph-Schnittstellen-ID-Internierung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+
+/* 驻留表常量 / Interning table constants / Internierungstabellen-Konstanten */
+#define RULE_GRAPH_INITIAL_BUCKETS 32
+#define RULE_GRAPH_INITIAL_NODES 16
+
+/**
+ * @brief 计算接口标识哈希（FNV-1a，插件与接口名之间插入分隔符）/ Calculate interface identifier hash (FNV-1a, separator between plugin and interface name) / Schnittstellenbezeichner-Hash berechnen (FNV-1a, Trennzeichen zwischen Plugin- und Schnittstellenname)
+ */
+static uint64_t hash_interface_identifier(const char* plugin_name, const char* interface_name) {
+    uint64_t hash = 14695981039346656037ULL; /* FNV偏移基数 / FNV offset basis / FNV-Offset-Basis */
+    const char* p = plugin_name;
+    
+    while (*p != '\0') {
+        hash ^= (uint64_t)(unsigned char)(*p);
+        hash *= 1099511628211ULL; /* FNV质数 / FNV prime / FNV-Primzahl */
+        p++;
+    }
+    hash ^= (uint64_t)'.';
+    hash *= 1099511628211ULL;
+    p = interface_name;
+    while (*p != '\0') {
+        hash ^= (uint64_t)(unsigned char)(*p);
+        hash *= 1099511628211ULL;
+        p++;
+    }
+    
+    return hash;
+}
+
+/**
+ * @brief 在桶中查找节点槽位 / Find node slot in buckets / Knoten-Slot in Buckets suchen
+ * @return 命中返回节点ID，否则返回RULE_GRAPH_INVALID_NODE并输出空槽位 / Returns node ID on hit, otherwise RULE_GRAPH_INVALID_NODE and outputs empty slot / Gibt Knoten-ID bei Treffer zurück, sonst RULE_GRAPH_INVALID_NODE und gibt leeren Slot aus
+ */
+static size_t probe_node_slot(const rule_graph_t* graph, uint64_t hash_key, const char* plugin_name,
+                              const char* interface_name, size_t* empty_slot_out) {
+    size_t mask = graph->bucket_count - 1;
+    size_t slot = (size_t)hash_key & mask;
+    
+    while (graph->node_buckets[slot] != 0) {
+        const rule_graph_node_t* node = &graph->nodes[graph->node_buckets[slot] - 1];
+        if (node->hash_key == hash_key &&
+            strcmp(node->plugin_name, plugin_name) == 0 &&
+            strcmp(node->interface_name, interface_name) == 0) {
+            return graph->node_buckets[slot] - 1;
+        }
+        slot = (slot + 1) & mask;
+    }
+    
+    if (empty_slot_out != NULL) {
+        *empty_slot_out = slot;
+    }
+    return RULE_GRAPH_INVALID_NODE;
+}
+
+/**
+ * @brief 扩展驻留桶并重新散列 / Expand interning buckets and rehash / Internierungs-Buckets erweitern und neu hashen
+ */
+static int expand_node_buckets(rule_graph_t* graph) {
+    size_t new_bucket_count = graph->bucket_count == 0 ? RULE_GRAPH_INITIAL_BUCKETS : graph->bucket_count * 2;
+    if (new_bucket_count < graph->bucket_count || new_bucket_count > SIZE_MAX / sizeof(size_t)) {
+        internal_log_write("ERROR", "expand_node_buckets: bucket count overflow detected (old=%zu)", graph->bucket_count);
+        return -1;
+    }
+    
+    size_t* new_buckets = (size_t*)calloc(new_bucket_count, sizeof(size_t));
+    if (new_buckets == NULL) {
+        internal_log_write("ERROR", "expand_node_buckets: failed to allocate memory for buckets (new_bucket_count=%zu)", new_bucket_count);
+        return -1;
+    }
+    
+    size_t mask = new_bucket_count - 1;
+    for (size_t i = 0; i < graph->node_count; i++) {
+        size_t slot = (size_t)graph->nodes[i].hash_key & mask;
+        while (new_buckets[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        new_buckets[slot] = i + 1;
+    }
+    
+    free(graph->node_buckets);
+    graph->node_buckets = new_buckets;
+    graph->bucket_count = new_bucket_count;
+    return 0;
+}
+
+/**
+ * @brief 扩展节点数组容量 / Expand node array capacity / Knoten-Array-Kapazität erweitern
+ */
+static int expand_node_capacity(rule_graph_t* graph) {
+    size_t new_capacity = graph->node_capacity == 0 ? RULE_GRAPH_INITIAL_NODES : graph->node_capacity * CAPACITY_GROWTH_FACTOR;
+    if (new_capacity < graph->node_capacity || new_capacity > SIZE_MAX / sizeof(rule_graph_node_t)) {
+        internal_log_write("ERROR", "expand_node_capacity: capacity overflow detected (old=%zu)", graph->node_capacity);
+        return -1;
+    }
+    
+    rule_graph_node_t* new_nodes = (rule_graph_node_t*)realloc(graph->nodes, new_capacity * sizeof(rule_graph_node_t));
+    if (new_nodes == NULL) {
+        internal_log_write("ERROR", "expand_node_capacity: failed to allocate memory (new_capacity=%zu)", new_capacity);
+        return -1;
+    }
+    
+    memset(new_nodes + graph->node_capacity, 0, (new_capacity - graph->node_capacity) * sizeof(rule_graph_node_t));
+    graph->nodes = new_nodes;
+    graph->node_capacity = new_capacity;
+    return 0;
+}
+
+/**
+ * @brief 驻留接口标识，返回稳定的节点ID / Intern interface identifier, return stable node ID / Schnittstellenbezeichner internieren, stabile Knoten-ID zurückgeben
+ * @param graph 规则图 / Rule graph / Regelgraph
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @return 节点ID，失败返回RULE_GRAPH_INVALID_NODE / Node ID, RULE_GRAPH_INVALID_NODE on failure / Knoten-ID, RULE_GRAPH_INVALID_NODE bei Fehler
+ */
+size_t intern_rule_graph_node(rule_graph_t* graph, const char* plugin_name, const char* interface_name) {
+    if (graph == NULL || plugin_name == NULL || interface_name == NULL) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    /* 负载因子保持在0.5以下 / Keep load factor below 0.5 / Ladefaktor unter 0,5 halten */
+    if (graph->bucket_count == 0 || (graph->node_count + 1) * 2 > graph->bucket_count) {
+        if (expand_node_buckets(graph) != 0) {
+            return RULE_GRAPH_INVALID_NODE;
+        }
+    }
+    
+    uint64_t hash_key = hash_interface_identifier(plugin_name, interface_name);
+    size_t empty_slot = 0;
+    size_t node_id = probe_node_slot(graph, hash_key, plugin_name, interface_name, &empty_slot);
+    if (node_id != RULE_GRAPH_INVALID_NODE) {
+        return node_id;
+    }
+    
+    if (graph->node_count >= graph->node_capacity) {
+        if (expand_node_capacity(graph) != 0) {
+            return RULE_GRAPH_INVALID_NODE;
+        }
+    }
+    
+    rule_graph_node_t* node = &graph->nodes[graph->node_count];
+    memset(node, 0, sizeof(rule_graph_node_t));
+    node->plugin_name = allocate_string(plugin_name);
+    node->interface_name = allocate_string(interface_name);
+    if (node->plugin_name == NULL || node->interface_name == NULL) {
+        free(node->plugin_name);
+        free(node->interface_name);
+        node->plugin_name = NULL;
+        node->interface_name = NULL;
+        internal_log_write("ERROR", "intern_rule_graph_node: failed to allocate identifier %s.%s", plugin_name, interface_name);
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    node->hash_key = hash_key;
+    node->scc_id = RULE_GRAPH_INVALID_NODE;
+    
+    graph->node_buckets[empty_slot] = graph->node_count + 1;
+    return graph->node_count++;
+}
+
+/**
+ * @brief 复制规则图的驻留节点（保持节点ID） / Copy the interned nodes of a rule graph (keeping node IDs) / Internierte Knoten eines Regelgraphen kopieren (Knoten-IDs bleiben erhalten)
+ * @param dst 目标规则图（必须为空） / Destination rule graph (must be empty) / Ziel-Regelgraph (muss leer sein)
+ * @param src 源规则图 / Source rule graph / Quell-Regelgraph
+ * @return 成功返回0，失败返回非0（dst保持为空） / Returns 0 on success, non-zero on failure (dst stays empty) / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler (dst bleibt leer)
+ */
+int clone_rule_graph_nodes(rule_graph_t* dst, const rule_graph_t* src) {
+    if (dst == NULL || src == NULL) {
+        return -1;
+    }
+    
+    memset(dst, 0, sizeof(rule_graph_t));
+    if (src->node_count == 0 || src->bucket_count == 0) {
+        return 0;
+    }
+    
+    if (src->node_capacity > SIZE_MAX / sizeof(rule_graph_node_t) || src->bucket_count > SIZE_MAX / sizeof(size_t)) {
+        return -1;
+    }
+    dst->nodes = (rule_graph_node_t*)calloc(src->node_capacity, sizeof(rule_graph_node_t));
+    dst->node_buckets = (size_t*)malloc(src->bucket_count * sizeof(size_t));
+    if (dst->nodes == NULL || dst->node_buckets == NULL) {
+        internal_log_write("ERROR", "clone_rule_graph_nodes: failed to allocate %zu nodes", src->node_count);
+        free(dst->nodes);
+        free(dst->node_buckets);
+        memset(dst, 0, sizeof(rule_graph_t));
+        return -1;
+    }
+    dst->node_capacity = src->node_capacity;
+    dst->bucket_count = src->bucket_count;
+    memcpy(dst->node_buckets, src->node_buckets, src->bucket_count * sizeof(size_t));
+    
+    for (size_t i = 0; i < src->node_count; i++) {
+        rule_graph_node_t* node = &dst->nodes[i];
+        node->plugin_name = allocate_string(src->nodes[i].plugin_name);
+        node->interface_name = allocate_string(src->nodes[i].interface_name);
+        node->hash_key = src->nodes[i].hash_key;
+        node->scc_id = RULE_GRAPH_INVALID_NODE;
+        dst->node_count++;
+        if (node->plugin_name == NULL || node->interface_name == NULL) {
+            internal_log_write("ERROR", "clone_rule_graph_nodes: failed to copy identifier of node %zu", i);
+            release_rule_graph(dst);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 查找接口的规则图节点ID / Find rule graph node ID of interface / Regelgraph-Knoten-ID einer Schnittstelle suchen
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @return 节点ID，未找到返回RULE_GRAPH_INVALID_NODE / Node ID, RULE_GRAPH_INVALID_NODE if not found / Knoten-ID, RULE_GRAPH_INVALID_NODE wenn nicht gefunden
+ */
+size_t find_rule_graph_node(const char* plugin_name, const char* interface_name) {
+    if (plugin_name == NULL || interface_name == NULL) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->rule_graph.node_buckets == NULL || ctx->rule_graph.bucket_count == 0) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    uint64_t hash_key = hash_interface_identifier(plugin_name, interface_name);
+    return probe_node_slot(&ctx->rule_graph, hash_key, plugin_name, interface_name, NULL);
+}
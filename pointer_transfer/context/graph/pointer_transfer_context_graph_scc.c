@@ -0,0 +1,222 @@
+/**
+ * @file pointer_transfer_context_graph_scc.c
+ * @brief 规则图强连通分量与拓扑序 / Rule Graph Strongly Connected Components and Topological Order / Regelgraph starke Zusammenhangskomponenten und topologische Ordnung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+
+/**
+ * @brief 在拓扑序号区间内计算强连通分量（迭代式Tarjan算法）/ Compute SCCs within a topological rank range (iterative Tarjan algorithm) / SCCs innerhalb eines topologischen Rangbereichs berechnen (iterativer Tarjan-Algorithmus)
+ * @details 只访问从根节点可达且拓扑序号位于[min_rank, max_rank]内的节点；分量按逆拓扑序产出，成员按分量连续写入members，scc_id暂存分量产出序号；cyclic随之更新 / Only nodes reachable from the roots whose topological rank lies in [min_rank, max_rank] are visited; components are emitted in reverse topological order, members are written contiguously per component into members and scc_id temporarily holds the emission number; cyclic is updated along the way / Nur von den Wurzeln erreichbare Knoten mit topologischem Rang in [min_rank, max_rank] werden besucht; Komponenten werden in umgekehrter topologischer Ordnung geliefert, Mitglieder je Komponente zusammenhängend in members geschrieben und scc_id hält vorübergehend die Liefernummer; cyclic wird dabei aktualisiert
+ * @param graph 规则图（边已构建） / Rule graph (edges built) / Regelgraph (Kanten erstellt)
+ * @param roots 根节点数组（NULL表示所有节点） / Root node array (NULL means all nodes) / Wurzelknoten-Array (NULL bedeutet alle Knoten)
+ * @param root_count 根节点数量 / Root node count / Anzahl der Wurzelknoten
+ * @param min_rank 最小拓扑序号 / Minimum topological rank / Minimaler topologischer Rang
+ * @param max_rank 最大拓扑序号 / Maximum topological rank / Maximaler topologischer Rang
+ * @param members 输出访问到的节点（容量为节点数量） / Output visited nodes (capacity is the node count) / Ausgabe besuchter Knoten (Kapazität ist die Knotenanzahl)
+ * @param member_count_out 输出访问到的节点数量 / Output visited node count / Ausgabe Anzahl besuchter Knoten
+ * @param changed 输出cyclic发生变化的节点（可为NULL，容量为节点数量） / Output nodes whose cyclic flag changed (may be NULL, capacity is the node count) / Ausgabe der Knoten mit geändertem cyclic-Flag (kann NULL sein, Kapazität ist die Knotenanzahl)
+ * @param changed_count_out 输出变化节点数量（可为NULL） / Output changed node count (may be NULL) / Ausgabe Anzahl geänderter Knoten (kann NULL sein)
+ * @return 产出的分量数量，失败返回RULE_GRAPH_INVALID_NODE / Number of emitted components, RULE_GRAPH_INVALID_NODE on failure / Anzahl gelieferter Komponenten, RULE_GRAPH_INVALID_NODE bei Fehler
+ */
+size_t compute_rule_graph_region_scc(rule_graph_t* graph, const size_t* roots, size_t root_count,
+                                     size_t min_rank, size_t max_rank, size_t* members, size_t* member_count_out,
+                                     size_t* changed, size_t* changed_count_out) {
+    if (graph == NULL || members == NULL || member_count_out == NULL) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    *member_count_out = 0;
+    if (changed_count_out != NULL) {
+        *changed_count_out = 0;
+    }
+    
+    size_t n = graph->node_count;
+    if (n == 0) {
+        return 0;
+    }
+    
+    if (n > SIZE_MAX / (sizeof(size_t) * 5)) {
+        internal_log_write("ERROR", "compute_rule_graph_scc: node count overflow detected (node_count=%zu)", n);
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    /* 一次性分配工作数组：index、lowlink、Tarjan栈、DFS栈、DFS边游标 / Allocate working arrays at once: index, lowlink, Tarjan stack, DFS stack, DFS edge cursor / Arbeits-Arrays auf einmal zuweisen: index, lowlink, Tarjan-Stapel, DFS-Stapel, DFS-Kantencursor */
+    size_t* work = (size_t*)malloc(n * 5 * sizeof(size_t));
+    unsigned char* on_stack = (unsigned char*)calloc(n, sizeof(unsigned char));
+    if (work == NULL || on_stack == NULL) {
+        internal_log_write("ERROR", "compute_rule_graph_scc: failed to allocate working arrays (node_count=%zu)", n);
+        free(work);
+        free(on_stack);
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    size_t* index_of = work;
+    size_t* lowlink = work + n;
+    size_t* scc_stack = work + n * 2;
+    size_t* dfs_stack = work + n * 3;
+    size_t* dfs_cursor = work + n * 4;
+    for (size_t i = 0; i < n; i++) {
+        index_of[i] = RULE_GRAPH_INVALID_NODE;
+    }
+    
+    size_t next_index = 0;
+    size_t scc_top = 0;
+    size_t component_count = 0;
+    size_t member_count = 0;
+    size_t changed_count = 0;
+    size_t root_total = roots != NULL ? root_count : n;
+    
+    for (size_t r = 0; r < root_total; r++) {
+        size_t root = roots != NULL ? roots[r] : r;
+        if (root >= n || index_of[root] != RULE_GRAPH_INVALID_NODE ||
+            graph->nodes[root].topo_rank < min_rank || graph->nodes[root].topo_rank > max_rank) {
+            continue;
+        }
+        
+        size_t dfs_top = 0;
+        dfs_stack[dfs_top] = root;
+        dfs_cursor[dfs_top] = 0;
+        dfs_top++;
+        index_of[root] = lowlink[root] = next_index++;
+        scc_stack[scc_top++] = root;
+        on_stack[root] = 1;
+        
+        while (dfs_top > 0) {
+            size_t v = dfs_stack[dfs_top - 1];
+            rule_graph_node_t* node = &graph->nodes[v];
+            
+            if (dfs_cursor[dfs_top - 1] < node->edge_count) {
+                size_t w = graph->edges[node->edge_start + dfs_cursor[dfs_top - 1]];
+                dfs_cursor[dfs_top - 1]++;
+                
+                /* 区间外的节点不可能与区间内节点成环 / Nodes outside the range cannot form a cycle with nodes inside it / Knoten außerhalb des Bereichs können keinen Zyklus mit Knoten darin bilden */
+                if (graph->nodes[w].topo_rank < min_rank || graph->nodes[w].topo_rank > max_rank) {
+                    continue;
+                }
+                
+                if (index_of[w] == RULE_GRAPH_INVALID_NODE) {
+                    index_of[w] = lowlink[w] = next_index++;
+                    scc_stack[scc_top++] = w;
+                    on_stack[w] = 1;
+                    dfs_stack[dfs_top] = w;
+                    dfs_cursor[dfs_top] = 0;
+                    dfs_top++;
+                } else if (on_stack[w] && index_of[w] < lowlink[v]) {
+                    lowlink[v] = index_of[w];
+                }
+                continue;
+            }
+            
+            /* v的所有出边已处理 / All outgoing edges of v processed / Alle ausgehenden Kanten von v verarbeitet */
+            dfs_top--;
+            if (dfs_top > 0) {
+                size_t parent = dfs_stack[dfs_top - 1];
+                if (lowlink[v] < lowlink[parent]) {
+                    lowlink[parent] = lowlink[v];
+                }
+            }
+            
+            if (lowlink[v] != index_of[v]) {
+                continue;
+            }
+            
+            /* v是分量根，弹出整个分量 / v is component root, pop entire component / v ist Komponentenwurzel, gesamte Komponente entfernen */
+            size_t scc_id = component_count++;
+            size_t member_start = scc_top;
+            size_t w;
+            do {
+                w = scc_stack[--scc_top];
+                on_stack[w] = 0;
+                graph->nodes[w].scc_id = scc_id;
+            } while (w != v);
+            
+            int cyclic = (member_start - scc_top) > 1;
+            if (!cyclic) {
+                /* 单节点分量仅在存在自环时成环 / Single-node component is cyclic only with a self-loop / Einzelknoten-Komponente ist nur mit Selbstschleife zyklisch */
+                for (size_t e = 0; e < node->edge_count; e++) {
+                    if (graph->edges[node->edge_start + e] == v) {
+                        cyclic = 1;
+                        break;
+                    }
+                }
+            }
+            for (size_t k = scc_top; k < member_start; k++) {
+                rule_graph_node_t* member = &graph->nodes[scc_stack[k]];
+                if (member->cyclic != cyclic) {
+                    if (cyclic) {
+                        graph->cyclic_node_count++;
+                    } else {
+                        graph->cyclic_node_count--;
+                    }
+                    member->cyclic = cyclic;
+                    if (changed != NULL) {
+                        changed[changed_count++] = scc_stack[k];
+                    }
+                }
+                members[member_count++] = scc_stack[k];
+            }
+        }
+    }
+    
+    *member_count_out = member_count;
+    if (changed_count_out != NULL) {
+        *changed_count_out = changed_count;
+    }
+    free(work);
+    free(on_stack);
+    return component_count;
+}
+
+/**
+ * @brief 计算强连通分量和拓扑序（迭代式Tarjan算法）/ Compute SCCs and topological order (iterative Tarjan algorithm) / SCCs und topologische Ordnung berechnen (iterativer Tarjan-Algorithmus)
+ * @param graph 规则图（边已构建） / Rule graph (edges built) / Regelgraph (Kanten erstellt)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int compute_rule_graph_scc(rule_graph_t* graph) {
+    if (graph == NULL) {
+        return -1;
+    }
+    
+    graph->scc_count = 0;
+    graph->rank_limit = 0;
+    graph->cyclic_node_count = 0;
+    
+    size_t n = graph->node_count;
+    if (n == 0) {
+        return 0;
+    }
+    
+    /* 所有节点置于同一序号区间，一次遍历整张图 / Put all nodes into one rank range and walk the whole graph once / Alle Knoten in einen Rangbereich legen und den ganzen Graphen einmal durchlaufen */
+    for (size_t i = 0; i < n; i++) {
+        graph->nodes[i].topo_rank = 0;
+        graph->nodes[i].cyclic = 0;
+    }
+    
+    size_t* members = (size_t*)malloc(n * sizeof(size_t));
+    if (members == NULL) {
+        internal_log_write("ERROR", "compute_rule_graph_scc: failed to allocate member array (node_count=%zu)", n);
+        return -1;
+    }
+    size_t member_count = 0;
+    size_t component_count = compute_rule_graph_region_scc(graph, NULL, 0, 0, 0, members, &member_count, NULL, NULL);
+    free(members);
+    if (component_count == RULE_GRAPH_INVALID_NODE) {
+        return -1;
+    }
+    
+    /* Tarjan按逆拓扑序产出分量，反转得到拓扑序号；分量编号取其拓扑序号 / Tarjan emits components in reverse topological order, invert to get topological rank; the component ID is its topological rank / Tarjan liefert Komponenten in umgekehrter topologischer Ordnung, umkehren ergibt topologischen Rang; die Komponenten-ID ist ihr topologischer Rang */
+    for (size_t i = 0; i < n; i++) {
+        graph->nodes[i].topo_rank = component_count - 1 - graph->nodes[i].scc_id;
+        graph->nodes[i].scc_id = graph->nodes[i].topo_rank;
+    }
+    graph->scc_count = component_count;
+    graph->rank_limit = component_count;
+    return 0;
+}
@@ -0,0 +1,367 @@
+/**
+ * @file pointer_transfer_context_graph_update.c
+ * @brief 规则图增量更新 / Incremental Rule Graph Update / Inkrementelle Regelgraph-Aktualisierung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+
+/* 空洞超过有效边且超过此数量时压缩边数组 / Compact the edge array once holes exceed live edges and this count / Kanten-Array verdichten, sobald Lücken die gültigen Kanten und diese Anzahl übersteigen */
+#define RULE_GRAPH_EDGE_COMPACT_SLACK 64
+
+/**
+ * @brief 比较拓扑序号 / Compare topological ranks / Topologische Ränge vergleichen
+ */
+static int compare_ranks(const void* a, const void* b) {
+    size_t lhs = *(const size_t*)a;
+    size_t rhs = *(const size_t*)b;
+    return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+/**
+ * @brief 压缩边数组，去掉移动边表留下的空洞 / Compact edge array, dropping holes left by moved edge lists / Kanten-Array verdichten, Lücken verschobener Kantenlisten entfernen
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int compact_rule_graph_edges(rule_graph_t* graph) {
+    size_t capacity = graph->edge_count * 2;
+    if (capacity < graph->edge_count || capacity > SIZE_MAX / sizeof(size_t)) {
+        return -1;
+    }
+    size_t* edges = capacity > 0 ? (size_t*)malloc(capacity * sizeof(size_t)) : NULL;
+    if (capacity > 0 && edges == NULL) {
+        return -1;
+    }
+    
+    size_t offset = 0;
+    for (size_t i = 0; i < graph->node_count; i++) {
+        rule_graph_node_t* node = &graph->nodes[i];
+        if (node->edge_count > 0) {
+            memcpy(edges + offset, graph->edges + node->edge_start, node->edge_count * sizeof(size_t));
+        }
+        node->edge_start = offset;
+        offset += node->edge_count;
+    }
+    free(graph->edges);
+    graph->edges = edges;
+    graph->edge_slot_count = offset;
+    graph->edge_capacity = capacity;
+    return 0;
+}
+
+/**
+ * @brief 向节点边表追加一条边，边表不在末尾时移到末尾 / Append an edge to a node's edge list, moving the list to the end when it is not there / Kante an die Kantenliste eines Knotens anhängen, Liste ans Ende verschieben, wenn sie nicht dort liegt
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int append_rule_graph_edge(rule_graph_t* graph, size_t src, size_t dst) {
+    rule_graph_node_t* node = &graph->nodes[src];
+    int at_end = node->edge_count > 0 && node->edge_start + node->edge_count == graph->edge_slot_count;
+    size_t needed = at_end ? 1 : node->edge_count + 1;
+    if (graph->edge_slot_count > SIZE_MAX - needed) {
+        return -1;
+    }
+    
+    if (graph->edge_slot_count + needed > graph->edge_capacity) {
+        size_t new_capacity = graph->edge_capacity == 0 ? RULE_GRAPH_EDGE_COMPACT_SLACK : graph->edge_capacity;
+        while (new_capacity < graph->edge_slot_count + needed) {
+            if (new_capacity > SIZE_MAX / CAPACITY_GROWTH_FACTOR) {
+                return -1;
+            }
+            new_capacity *= CAPACITY_GROWTH_FACTOR;
+        }
+        if (new_capacity > SIZE_MAX / sizeof(size_t)) {
+            return -1;
+        }
+        size_t* new_edges = (size_t*)realloc(graph->edges, new_capacity * sizeof(size_t));
+        if (new_edges == NULL) {
+            internal_log_write("ERROR", "append_rule_graph_edge: failed to expand edge array (capacity=%zu)", new_capacity);
+            return -1;
+        }
+        graph->edges = new_edges;
+        graph->edge_capacity = new_capacity;
+    }
+    
+    if (!at_end) {
+        if (node->edge_count > 0) {
+            memmove(graph->edges + graph->edge_slot_count, graph->edges + node->edge_start, node->edge_count * sizeof(size_t));
+        }
+        node->edge_start = graph->edge_slot_count;
+        graph->edge_slot_count += node->edge_count;
+    }
+    graph->edges[node->edge_start + node->edge_count] = dst;
+    node->edge_count++;
+    graph->edge_slot_count++;
+    graph->edge_count++;
+    
+    if (graph->edge_slot_count > graph->edge_count * 2 + RULE_GRAPH_EDGE_COMPACT_SLACK) {
+        /* 压缩失败时保留空洞，边表仍然正确 / On compaction failure the holes are kept, edge lists stay correct / Bei fehlgeschlagener Verdichtung bleiben die Lücken, Kantenlisten bleiben korrekt */
+        compact_rule_graph_edges(graph);
+    }
+    return 0;
+}
+
+/**
+ * @brief 从节点边表移除一条边（重复边只移除一条） / Remove one edge from a node's edge list (only one of duplicate edges) / Eine Kante aus der Kantenliste eines Knotens entfernen (bei Duplikaten nur eine)
+ */
+static void remove_rule_graph_edge(rule_graph_t* graph, size_t src, size_t dst) {
+    rule_graph_node_t* node = &graph->nodes[src];
+    for (size_t e = 0; e < node->edge_count; e++) {
+        if (graph->edges[node->edge_start + e] == dst) {
+            graph->edges[node->edge_start + e] = graph->edges[node->edge_start + node->edge_count - 1];
+            node->edge_count--;
+            graph->edge_count--;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 为重新计算的区域分配拓扑序号 / Assign topological ranks to a recomputed region / Einer neu berechneten Region topologische Ränge zuweisen
+ * @details 区域外序号不小于shift_from的节点后移shift_by，区域分量按拓扑序占用base_rank起的序号 / Nodes outside the region with rank not below shift_from move up by shift_by, region components take ranks from base_rank in topological order / Knoten außerhalb der Region mit Rang nicht unter shift_from rücken um shift_by auf, Regionskomponenten belegen Ränge ab base_rank in topologischer Ordnung
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int place_region_components(rule_graph_t* graph, const size_t* members, size_t member_count, size_t component_count,
+                                   size_t base_rank, size_t shift_from, size_t shift_by) {
+    /* 统计区域原有分量数（区域总是包含完整的旧分量） / Count the region's previous components (a region always holds whole old components) / Frühere Komponenten der Region zählen (eine Region enthält immer ganze alte Komponenten) */
+    size_t* ranks = (size_t*)malloc(member_count * sizeof(size_t));
+    if (ranks == NULL) {
+        internal_log_write("ERROR", "place_region_components: failed to allocate rank array (member_count=%zu)", member_count);
+        return -1;
+    }
+    for (size_t i = 0; i < member_count; i++) {
+        ranks[i] = graph->nodes[members[i]].topo_rank;
+    }
+    qsort(ranks, member_count, sizeof(size_t), compare_ranks);
+    size_t previous_count = 0;
+    for (size_t i = 0; i < member_count; i++) {
+        if (i == 0 || ranks[i] != ranks[i - 1]) {
+            previous_count++;
+        }
+    }
+    free(ranks);
+    
+    for (size_t i = 0; i < member_count; i++) {
+        graph->nodes[members[i]].topo_rank = RULE_GRAPH_INVALID_NODE;
+    }
+    if (shift_by > 0) {
+        for (size_t i = 0; i < graph->node_count; i++) {
+            rule_graph_node_t* node = &graph->nodes[i];
+            if (node->topo_rank != RULE_GRAPH_INVALID_NODE && node->topo_rank >= shift_from) {
+                node->topo_rank += shift_by;
+                node->scc_id = node->topo_rank;
+            }
+        }
+        graph->rank_limit += shift_by;
+    }
+    
+    /* 区域内分量按逆拓扑序产出 / Region components were emitted in reverse topological order / Regionskomponenten wurden in umgekehrter topologischer Ordnung geliefert */
+    for (size_t i = 0; i < member_count; i++) {
+        rule_graph_node_t* node = &graph->nodes[members[i]];
+        node->topo_rank = base_rank + (component_count - 1 - node->scc_id);
+        node->scc_id = node->topo_rank;
+    }
+    graph->scc_count = graph->scc_count - previous_count + component_count;
+    return 0;
+}
+
+/**
+ * @brief 在区间内重新计算强连通分量并丢弃环状态变化节点的记忆化结果 / Recompute SCCs within a range and drop memoized results of nodes whose cycle state changed / SCCs in einem Bereich neu berechnen und memoisierte Ergebnisse von Knoten mit geändertem Zyklusstatus verwerfen
+ * @param roots 根节点 / Root nodes / Wurzelknoten
+ * @param root_count 根节点数量 / Root node count / Anzahl der Wurzelknoten
+ * @param min_rank 最小拓扑序号 / Minimum topological rank / Minimaler topologischer Rang
+ * @param max_rank 最大拓扑序号 / Maximum topological rank / Maximaler topologischer Rang
+ * @param split 1表示拆分单个分量（删除边），0表示把可达区域放到max_rank之后（添加边） / 1 splits a single component (edge removal), 0 places the reachable region after max_rank (edge addition) / 1 teilt eine einzelne Komponente (Kante entfernt), 0 legt die erreichbare Region hinter max_rank (Kante hinzugefügt)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int recompute_region(rule_graph_t* graph, const size_t* roots, size_t root_count, size_t min_rank, size_t max_rank, int split) {
+    size_t n = graph->node_count;
+    if (n > SIZE_MAX / (sizeof(size_t) * 2)) {
+        return -1;
+    }
+    size_t* scratch = (size_t*)malloc(n * 2 * sizeof(size_t));
+    if (scratch == NULL) {
+        internal_log_write("ERROR", "recompute_region: failed to allocate working arrays (node_count=%zu)", n);
+        return -1;
+    }
+    size_t* members = scratch;
+    size_t* changed = scratch + n;
+    size_t member_count = 0;
+    size_t changed_count = 0;
+    
+    size_t component_count = compute_rule_graph_region_scc(graph, roots, root_count, min_rank, max_rank,
+                                                           members, &member_count, changed, &changed_count);
+    int result = 0;
+    if (component_count == RULE_GRAPH_INVALID_NODE) {
+        result = -1;
+    } else if (component_count > 0) {
+        if (split) {
+            result = place_region_components(graph, members, member_count, component_count,
+                                             min_rank, min_rank + 1, component_count - 1);
+        } else {
+            result = place_region_components(graph, members, member_count, component_count,
+                                             max_rank + 1, max_rank + 1, component_count);
+        }
+    }
+    
+    if (changed_count > 0) {
+        invalidate_memo_cache_nodes(changed, changed_count);
+    }
+    free(scratch);
+    return result;
+}
+
+/**
+ * @brief 为新边更新强连通分量和拓扑序 / Update SCCs and topological order for a new edge / SCCs und topologische Ordnung für eine neue Kante aktualisieren
+ * @details 只有目标序号不大于源序号时才可能成环，此时只重新计算从目标出发、序号不超过源的区域 / A cycle is only possible when the target rank does not exceed the source rank; then only the region reachable from the target with ranks up to the source is recomputed / Ein Zyklus ist nur möglich, wenn der Zielrang den Quellrang nicht übersteigt; dann wird nur die vom Ziel erreichbare Region mit Rängen bis zur Quelle neu berechnet
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int link_rule_graph_nodes(rule_graph_t* graph, size_t src, size_t dst) {
+    if (append_rule_graph_edge(graph, src, dst) != 0) {
+        return -1;
+    }
+    
+    rule_graph_node_t* source = &graph->nodes[src];
+    if (src == dst) {
+        if (!source->cyclic) {
+            source->cyclic = 1;
+            graph->cyclic_node_count++;
+            invalidate_memo_cache_nodes(&src, 1);
+        }
+        return 0;
+    }
+    
+    size_t source_rank = source->topo_rank;
+    size_t target_rank = graph->nodes[dst].topo_rank;
+    if (target_rank >= source_rank) {
+        /* 拓扑序仍然成立，或两端已在同一分量 / Topological order still holds, or both ends already share a component / Topologische Ordnung gilt weiterhin, oder beide Enden teilen bereits eine Komponente */
+        return 0;
+    }
+    return recompute_region(graph, &dst, 1, target_rank, source_rank, 0);
+}
+
+/**
+ * @brief 为删除的边更新强连通分量和拓扑序 / Update SCCs and topological order for a removed edge / SCCs und topologische Ordnung für eine entfernte Kante aktualisieren
+ * @details 两端不在同一分量时什么都不变，否则只重新计算该分量 / Nothing changes when the ends are in different components, otherwise only that component is recomputed / Liegen die Enden in verschiedenen Komponenten, ändert sich nichts, sonst wird nur diese Komponente neu berechnet
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int unlink_rule_graph_nodes(rule_graph_t* graph, size_t src, size_t dst) {
+    remove_rule_graph_edge(graph, src, dst);
+    
+    size_t rank = graph->nodes[src].topo_rank;
+    if (graph->nodes[dst].topo_rank != rank || !graph->nodes[src].cyclic) {
+        return 0;
+    }
+    
+    /* 旧分量的每个成员都可从源或目标到达 / Every member of the old component is reachable from the source or the target / Jedes Mitglied der alten Komponente ist von Quelle oder Ziel erreichbar */
+    size_t roots[2];
+    roots[0] = src;
+    roots[1] = dst;
+    return recompute_region(graph, roots, 2, rank, rank, 1);
+}
+
+/**
+ * @brief 把追加的规则加入规则图 / Add appended rules to the rule graph / Angehängte Regeln in den Regelgraphen aufnehmen
+ * @details 只驻留新规则的端点、追加其边并更新受影响的分量；纯接口或环状态变化的节点丢弃其记忆化结果 / Only the new rules' endpoints are interned, their edges appended and the affected components updated; nodes whose purity or cycle state changes drop their memoized results / Nur die Endpunkte der neuen Regeln werden interniert, ihre Kanten angehängt und die betroffenen Komponenten aktualisiert; Knoten mit geänderter Reinheit oder geändertem Zyklusstatus verwerfen ihre memoisierten Ergebnisse
+ * @param start_rule_index 第一条追加规则的索引 / Index of the first appended rule / Index der ersten angehängten Regel
+ * @return 成功返回0，失败返回-1（调用方需完整重建） / Returns 0 on success, -1 on failure (caller must rebuild fully) / Gibt 0 bei Erfolg zurück, -1 bei Fehler (Aufrufer muss vollständig neu aufbauen)
+ */
+int add_rule_graph_rules(size_t start_rule_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    rule_graph_t* graph = &ctx->rule_graph;
+    if (graph->rule_node_count != start_rule_index || ctx->rule_count < start_rule_index) {
+        return -1;
+    }
+    if (ctx->rule_count == start_rule_index) {
+        return 0;
+    }
+    if (ctx->rule_count > SIZE_MAX / sizeof(size_t)) {
+        return -1;
+    }
+    
+    size_t* source_nodes = (size_t*)realloc(graph->rule_source_nodes, ctx->rule_count * sizeof(size_t));
+    if (source_nodes == NULL) {
+        return -1;
+    }
+    graph->rule_source_nodes = source_nodes;
+    size_t* target_nodes = (size_t*)realloc(graph->rule_target_nodes, ctx->rule_count * sizeof(size_t));
+    if (target_nodes == NULL) {
+        return -1;
+    }
+    graph->rule_target_nodes = target_nodes;
+    
+    for (size_t i = start_rule_index; i < ctx->rule_count; i++) {
+        const pointer_transfer_rule_t* rule = &ctx->rules[i];
+        size_t first_new_node = graph->node_count;
+        size_t src = intern_rule_graph_node(graph, rule->source_plugin, rule->source_interface);
+        size_t dst = intern_rule_graph_node(graph, rule->target_plugin, rule->target_interface);
+        if ((src == RULE_GRAPH_INVALID_NODE && rule->source_plugin != NULL && rule->source_interface != NULL) ||
+            (dst == RULE_GRAPH_INVALID_NODE && rule->target_plugin != NULL && rule->target_interface != NULL)) {
+            return -1;
+        }
+        
+        /* 新节点各自成为末尾的单节点分量 / New nodes each become a single-node component at the end / Neue Knoten werden jeweils zu einer Einzelknoten-Komponente am Ende */
+        for (size_t node_id = first_new_node; node_id < graph->node_count; node_id++) {
+            rule_graph_node_t* node = &graph->nodes[node_id];
+            node->edge_start = 0;
+            node->edge_count = 0;
+            node->topo_rank = graph->rank_limit++;
+            node->scc_id = node->topo_rank;
+            graph->scc_count++;
+        }
+        
+        graph->rule_source_nodes[i] = src;
+        graph->rule_target_nodes[i] = dst;
+        graph->rule_node_count = i + 1;
+        if (src == RULE_GRAPH_INVALID_NODE || dst == RULE_GRAPH_INVALID_NODE) {
+            continue;
+        }
+        
+        if (rule->cache_self && graph->nodes[dst].memoizable++ == 0) {
+            invalidate_memo_cache_nodes(&dst, 1);
+        }
+        if (link_rule_graph_nodes(graph, src, dst) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 从规则图移除规则 / Remove a rule from the rule graph / Regel aus dem Regelgraphen entfernen
+ * @details 节点保留（ID稳定），只删除该规则的边并更新其所在分量 / Nodes are kept (IDs stay stable), only the rule's edge is removed and its component updated / Knoten bleiben erhalten (IDs stabil), nur die Kante der Regel wird entfernt und ihre Komponente aktualisiert
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param cache_self 被移除规则的CacheSelf标志 / CacheSelf flag of the removed rule / CacheSelf-Flag der entfernten Regel
+ * @return 成功返回0，失败返回-1（调用方需完整重建） / Returns 0 on success, -1 on failure (caller must rebuild fully) / Gibt 0 bei Erfolg zurück, -1 bei Fehler (Aufrufer muss vollständig neu aufbauen)
+ */
+int remove_rule_graph_rule(size_t rule_index, int cache_self) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    rule_graph_t* graph = &ctx->rule_graph;
+    if (rule_index >= graph->rule_node_count || graph->rule_node_count != ctx->rule_count) {
+        return -1;
+    }
+    
+    size_t src = graph->rule_source_nodes[rule_index];
+    size_t dst = graph->rule_target_nodes[rule_index];
+    graph->rule_source_nodes[rule_index] = RULE_GRAPH_INVALID_NODE;
+    graph->rule_target_nodes[rule_index] = RULE_GRAPH_INVALID_NODE;
+    if (src == RULE_GRAPH_INVALID_NODE || dst == RULE_GRAPH_INVALID_NODE) {
+        return 0;
+    }
+    
+    if (cache_self && graph->nodes[dst].memoizable > 0 && --graph->nodes[dst].memoizable == 0) {
+        invalidate_memo_cache_nodes(&dst, 1);
+    }
+    return unlink_rule_graph_nodes(graph, src, dst);
+}
@@ -175,6 +175,28 @@ static int insert_rule_into_hash_table(rule_hash_table_t* hash_table, uint64_t h
     return 0;
 }
 
+/**
+ * @brief 从哈希表移除规则 / Remove rule from hash table / Regel aus Hash-Tabelle entfernen
+ */
+static int remove_rule_from_hash_table(rule_hash_table_t* hash_table, uint64_t hash_key, size_t rule_index) {
+    if (hash_table == NULL || hash_table->buckets == NULL || hash_table->bucket_count == 0) {
+        return -1;
+    }
+    
+    rule_hash_node_t** link = &hash_table->buckets[hash_key % hash_table->bucket_count];
+    while (*link != NULL) {
+        rule_hash_node_t* node = *link;
+        if (node->hash_key == hash_key && node->rule_index == rule_index) {
+            *link = node->next;
+            free(node);
+            hash_table->entry_count--;
+            return 0;
+        }
+        link = &node->next;
+    }
+    return -1;
+}
+
 /* 导出给 index.c 使用的函数 / Functions exported for use by index.c / Für index.c exportierte Funktionen */
 uint64_t calculate_rule_hash_key_for_index(const char* source_plugin, const char* source_interface, int source_param_index) {
     return calculate_rule_hash_key(source_plugin, source_interface, source_param_index);
@@ -192,6 +214,10 @@ int expand_hash_table_for_index(rule_hash_table_t* hash_table) {
     return expand_hash_table(hash_table);
 }
 
+int remove_rule_from_hash_table_for_index(rule_hash_table_t* hash_table, uint64_t hash_key, size_t rule_index) {
+    return remove_rule_from_hash_table(hash_table, hash_key, rule_index);
+}
+
 size_t get_hash_table_initial_size(void) {
     return HASH_TABLE_INITIAL_SIZE;
 }
@@ -13,52 +13,49 @@
 
 /* 从 hash.c 导入函数 / Import functions from hash.c / Funktionen aus hash.c importieren */
 extern uint64_t calculate_rule_hash_key_for_index(const char* source_plugin, const char* source_interface, int source_param_index);
-extern void free_hash_table_for_index(rule_hash_table_t* hash_table);
 extern int insert_rule_into_hash_table_for_index(rule_hash_table_t* hash_table, uint64_t hash_key, size_t rule_index);
 extern int expand_hash_table_for_index(rule_hash_table_t* hash_table);
 extern size_t get_hash_table_initial_size(void);
 
 /**
- * @brief 构建规则索引（哈希表）/ Build rule index (hash table) / Regelindex erstellen (Hash-Tabelle)
- * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ * @brief 为规则数组构建哈希表 / Build hash table for a rules array / Hash-Tabelle für ein Regel-Array erstellen
  */
-int build_rule_index(void) {
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (ctx == NULL) {
-        internal_log_write("ERROR", "build_rule_index: global context is NULL");
+int build_rule_hash_table(rule_hash_table_t* hash_table, const pointer_transfer_rule_t* rules, size_t rule_count) {
+    if (hash_table == NULL) {
         return -1;
     }
     
     /* 释放旧哈希表 / Free old hash table / Alte Hash-Tabelle freigeben */
-    free_hash_table_for_index(&ctx->rule_hash_table);
+    free_hash_table_for_index(hash_table);
     
-    if (ctx->rule_count == 0 || ctx->rules == NULL) {
-        internal_log_write("INFO", "build_rule_index: no rules to index (rule_count=%zu)", ctx->rule_count);
+    if (rule_count == 0 || rules == NULL) {
+        internal_log_write("INFO", "build_rule_index: no rules to index (rule_count=%zu)", rule_count);
         return 0;
     }
     
     /* 初始化哈希表 / Initialize hash table / Hash-Tabelle initialisieren */
-    ctx->rule_hash_table.bucket_count = get_hash_table_initial_size();
-    ctx->rule_hash_table.entry_count = 0;
-    ctx->rule_hash_table.buckets = (rule_hash_node_t**)calloc(ctx->rule_hash_table.bucket_count, sizeof(rule_hash_node_t*));
-    if (ctx->rule_hash_table.buckets == NULL) {
+    hash_table->bucket_count = get_hash_table_initial_size();
+    hash_table->entry_count = 0;
+    hash_table->buckets = (rule_hash_node_t**)calloc(hash_table->bucket_count, sizeof(rule_hash_node_t*));
+    if (hash_table->buckets == NULL) {
         internal_log_write("ERROR", "build_rule_index: failed to allocate memory for hash table buckets");
         return -1;
     }
     
     /* 构建索引项 / Build index entries / Indexeinträge erstellen */
     size_t indexed_count = 0;
-    for (size_t i = 0; i < ctx->rule_count; i++) {
-        pointer_transfer_rule_t* rule = &ctx->rules[i];
-        if (!rule->enabled || rule->source_plugin == NULL || rule->source_interface == NULL) {
+    for (size_t i = 0; i < rule_count; i++) {
+        const pointer_transfer_rule_t* rule = &rules[i];
+        /* 禁用的规则也建索引，启用状态在分发时检查 / Disabled rules are indexed too, enabled state is checked at dispatch / Deaktivierte Regeln werden ebenfalls indiziert, der Aktivierungsstatus wird beim Verteilen geprüft */
+        if (rule->source_plugin == NULL || rule->source_interface == NULL) {
             continue;
         }
         
         uint64_t hash_key = calculate_rule_hash_key_for_index(rule->source_plugin, rule->source_interface, rule->source_param_index);
         if (hash_key != 0) {
-            if (insert_rule_into_hash_table_for_index(&ctx->rule_hash_table, hash_key, i) != 0) {
+            if (insert_rule_into_hash_table_for_index(hash_table, hash_key, i) != 0) {
                 internal_log_write("ERROR", "build_rule_index: failed to insert rule %zu into hash table", i);
-                free_hash_table_for_index(&ctx->rule_hash_table);
+                free_hash_table_for_index(hash_table);
                 return -1;
             }
             indexed_count++;
@@ -72,10 +69,24 @@ int build_rule_index(void) {
     }
     
     internal_log_write("INFO", "Built rule hash table with %zu entries in %zu buckets (indexed %zu/%zu rules)", 
-                      ctx->rule_hash_table.entry_count, ctx->rule_hash_table.bucket_count, indexed_count, ctx->rule_count);
+                      hash_table->entry_count, hash_table->bucket_count, indexed_count, rule_count);
     return 0;
 }
 
+/**
+ * @brief 构建规则索引（哈希表）/ Build rule index (hash table) / Regelindex erstellen (Hash-Tabelle)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_index(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "build_rule_index: global context is NULL");
+        return -1;
+    }
+    
+    return build_rule_hash_table(&ctx->rule_hash_table, ctx->rules, ctx->rule_count);
+}
+
 /**
  * @brief 查找规则索引范围（哈希表）/ Find rule index range (hash table) / Regelindex-Bereich suchen (Hash-Tabelle)
  * @param source_plugin 源插件名称 / Source plugin name / Quell-Plugin-Name
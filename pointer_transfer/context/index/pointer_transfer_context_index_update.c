@@ -0,0 +1,98 @@
+/**
+ * @file pointer_transfer_context_index_update.c
+ * @brief 规则索引增量更新 / Rule Index Incremental Update / Inkrementelle Regelindex-Aktualisierung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+/* 从 hash.c 导入函数 / Import functions from hash.c / Funktionen aus hash.c importieren */
+extern uint64_t calculate_rule_hash_key_for_index(const char* source_plugin, const char* source_interface, int source_param_index);
+extern int insert_rule_into_hash_table_for_index(rule_hash_table_t* hash_table, uint64_t hash_key, size_t rule_index);
+extern int expand_hash_table_for_index(rule_hash_table_t* hash_table);
+extern int remove_rule_from_hash_table_for_index(rule_hash_table_t* hash_table, uint64_t hash_key, size_t rule_index);
+
+/**
+ * @brief 将追加的规则加入索引 / Add appended rules to index / Angehängte Regeln zum Index hinzufügen
+ * @details 无预计算键时从头开始或索引不存在则完整构建；有预计算键时预分配桶并直接插入 / Without precomputed keys, builds from scratch when starting at 0 or without an index; with precomputed keys, presizes buckets and inserts directly / Ohne vorberechnete Schlüssel vollständiger Aufbau bei Start ab 0 oder ohne Index; mit vorberechneten Schlüsseln werden Buckets vorab dimensioniert und direkt eingefügt
+ * @param start_index 第一条新规则的索引 / Index of first new rule / Index der ersten neuen Regel
+ * @param hash_keys 新规则的预计算哈希键（可为NULL，0表示不建索引） / Precomputed hash keys of new rules (may be NULL, 0 means not indexed) / Vorberechnete Hash-Schlüssel der neuen Regeln (kann NULL sein, 0 bedeutet nicht indiziert)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int index_appended_rules(size_t start_index, const uint64_t* hash_keys) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "index_appended_rules: global context is NULL");
+        return -1;
+    }
+    
+    if (hash_keys == NULL && (start_index == 0 || ctx->rule_hash_table.buckets == NULL)) {
+        return build_rule_index();
+    }
+    
+    rule_hash_table_t* table = &ctx->rule_hash_table;
+    if (start_index == 0) {
+        free_hash_table_for_index(table);
+    }
+    
+    /* 按最终条目数预分配桶，避免逐步重新哈希 / Presize buckets for the final entry count to avoid incremental rehashing / Buckets für die endgültige Eintragsanzahl vorab dimensionieren, um schrittweises Neuhashen zu vermeiden */
+    if (hash_keys != NULL) {
+        size_t final_count = table->entry_count + (ctx->rule_count - start_index);
+        while (table->bucket_count == 0 || final_count > table->bucket_count / 4 * 3) {
+            if (expand_hash_table_for_index(table) != 0) {
+                internal_log_write("ERROR", "index_appended_rules: failed to presize hash table, rebuilding index");
+                return build_rule_index();
+            }
+        }
+    }
+    
+    size_t indexed_count = 0;
+    for (size_t i = start_index; i < ctx->rule_count; i++) {
+        pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (rule->source_plugin == NULL || rule->source_interface == NULL) {
+            continue;
+        }
+        
+        uint64_t hash_key = hash_keys != NULL ? hash_keys[i - start_index] :
+            calculate_rule_hash_key_for_index(rule->source_plugin, rule->source_interface, rule->source_param_index);
+        if (hash_key == 0) {
+            internal_log_write("WARNING", "index_appended_rules: failed to calculate hash key for rule %zu", i);
+            continue;
+        }
+        if (insert_rule_into_hash_table_for_index(table, hash_key, i) != 0) {
+            internal_log_write("ERROR", "index_appended_rules: failed to insert rule %zu, rebuilding index", i);
+            return build_rule_index();
+        }
+        indexed_count++;
+    }
+    
+    internal_log_write("INFO", "Indexed %zu new rules (hash table: %zu entries in %zu buckets)", 
+                      indexed_count, table->entry_count, table->bucket_count);
+    return 0;
+}
+
+/**
+ * @brief 从索引移除规则 / Remove rule from index / Regel aus Index entfernen
+ * @param rule_index 规则索引（规则字符串必须仍然有效） / Rule index (rule strings must still be valid) / Regelindex (Regel-Zeichenfolgen müssen noch gültig sein)
+ * @return 成功返回0，未找到返回-1 / Returns 0 on success, -1 if not found / Gibt 0 bei Erfolg zurück, -1 wenn nicht gefunden
+ */
+int unindex_rule(size_t rule_index) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || rule_index >= ctx->rule_count) {
+        return -1;
+    }
+    
+    pointer_transfer_rule_t* rule = &ctx->rules[rule_index];
+    if (rule->source_plugin == NULL || rule->source_interface == NULL) {
+        return -1;
+    }
+    
+    uint64_t hash_key = calculate_rule_hash_key_for_index(rule->source_plugin, rule->source_interface, rule->source_param_index);
+    if (hash_key == 0) {
+        return -1;
+    }
+    return remove_rule_from_hash_table_for_index(&ctx->rule_hash_table, hash_key, rule_index);
+}
@@ -0,0 +1,300 @@
+/**
+ * @file pointer_transfer_context_memo_access.c
+ * @brief 记忆化缓存查找和存储（分片、CLOCK淘汰、TTL） / Memoization Cache Lookup and Store (sharded, CLOCK eviction, TTL) / Memoisierungs-Cache-Suche und -Speicherung (geshardet, CLOCK-Verdrängung, TTL)
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 未找到条目 / Entry not found / Eintrag nicht gefunden */
+#define MEMO_CACHE_NO_ENTRY SIZE_MAX
+
+/**
+ * @brief 按哈希高位选择分片 / Select shard by high hash bits / Shard anhand hoher Hash-Bits auswählen
+ */
+static memo_cache_shard_t* select_memo_cache_shard(memo_cache_t* cache, uint64_t hash_key) {
+    return &cache->shards[(size_t)(hash_key >> 32) & (cache->shard_count - 1)];
+}
+
+/**
+ * @brief 在分片内查找条目 / Find entry within shard / Eintrag im Shard suchen
+ * @return 条目索引，未找到返回MEMO_CACHE_NO_ENTRY / Entry index, MEMO_CACHE_NO_ENTRY if not found / Eintragsindex, MEMO_CACHE_NO_ENTRY wenn nicht gefunden
+ */
+static size_t find_memo_cache_entry(const memo_cache_shard_t* shard, uint64_t hash_key, size_t node_id,
+                                    const unsigned char* key_data, size_t key_size) {
+    size_t link = shard->buckets[(size_t)hash_key & (shard->bucket_count - 1)];
+    while (link != 0) {
+        const memo_cache_entry_t* entry = &shard->entries[link - 1];
+        if (entry->hash_key == hash_key && entry->node_id == node_id && entry->key_size == key_size &&
+            (key_size == 0 || memcmp(entry->key_data, key_data, key_size) == 0)) {
+            return link - 1;
+        }
+        link = entry->next;
+    }
+    return MEMO_CACHE_NO_ENTRY;
+}
+
+/**
+ * @brief 从桶链移除条目并释放其数据 / Unlink entry from bucket chain and free its data / Eintrag aus Bucket-Kette lösen und Daten freigeben
+ */
+static void remove_memo_cache_entry(memo_cache_shard_t* shard, size_t index) {
+    memo_cache_entry_t* entry = &shard->entries[index];
+    size_t* link = &shard->buckets[(size_t)entry->hash_key & (shard->bucket_count - 1)];
+    while (*link != 0) {
+        if (*link - 1 == index) {
+            *link = entry->next;
+            break;
+        }
+        link = &shard->entries[*link - 1].next;
+    }
+    
+    if (entry->key_data != NULL) {
+        free(entry->key_data);
+    }
+    if (entry->value_data != NULL) {
+        free(entry->value_data);
+    }
+    memset(entry, 0, sizeof(memo_cache_entry_t));
+    shard->count--;
+}
+
+/**
+ * @brief 分配空闲槽位，满时按CLOCK算法淘汰 / Allocate free slot, evicting by CLOCK when full / Freien Slot zuweisen, bei Vollbelegung per CLOCK verdrängen
+ * @return 槽位索引 / Slot index / Slot-Index
+ */
+static size_t allocate_memo_cache_slot(memo_cache_shard_t* shard) {
+    if (shard->used < shard->capacity) {
+        return shard->used++;
+    }
+    
+    /* 第二次扫描时所有引用位已清除，必然找到槽位 / All reference bits are cleared by the second sweep, so a slot is always found / Beim zweiten Durchlauf sind alle Referenzbits gelöscht, daher wird immer ein Slot gefunden */
+    for (;;) {
+        size_t index = shard->clock_hand;
+        shard->clock_hand = (shard->clock_hand + 1) % shard->capacity;
+        memo_cache_entry_t* entry = &shard->entries[index];
+        if (!entry->occupied) {
+            return index;
+        }
+        if (entry->referenced) {
+            entry->referenced = 0;
+            continue;
+        }
+        remove_memo_cache_entry(shard, index);
+        shard->evictions++;
+        return index;
+    }
+}
+
+/**
+ * @brief 查找记忆化结果 / Look up memoized result / Memoisiertes Ergebnis suchen
+ * @param hash_key 参数包哈希 / Parameter pack hash / Parameterpaket-Hash
+ * @param node_id 目标接口节点ID / Target interface node ID / Zielschnittstellen-Knoten-ID
+ * @param key_data 序列化的键 / Serialized key / Serialisierter Schlüssel
+ * @param key_size 键大小 / Key size / Schlüsselgröße
+ * @param return_type_out 输出返回值类型 / Output return type / Ausgabe-Rückgabetyp
+ * @param result_int_out 输出整数结果 / Output integer result / Ausgabe-Ganzzahlergebnis
+ * @param result_float_out 输出浮点数结果 / Output float result / Ausgabe-Gleitkommaergebnis
+ * @param value_out 输出结果副本（调用者释放，可为NULL） / Output result copy (caller frees, may be NULL) / Ausgabe-Ergebniskopie (Aufrufer gibt frei, kann NULL sein)
+ * @param value_size_out 输出结果副本大小 / Output result copy size / Ausgabe-Größe der Ergebniskopie
+ * @return 命中返回0，未命中返回-1 / Returns 0 on hit, -1 on miss / Gibt 0 bei Treffer zurück, -1 bei Fehltreffer
+ */
+int memo_cache_lookup(uint64_t hash_key, size_t node_id, const unsigned char* key_data, size_t key_size,
+                      pt_return_type_t* return_type_out, int64_t* result_int_out, double* result_float_out,
+                      void** value_out, size_t* value_size_out) {
+    if ((key_data == NULL && key_size > 0) || return_type_out == NULL || result_int_out == NULL ||
+        result_float_out == NULL || value_out == NULL || value_size_out == NULL) {
+        return -1;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->memo_cache.shards == NULL) {
+        return -1;
+    }
+    
+    memo_cache_t* cache = &ctx->memo_cache;
+    memo_cache_shard_t* shard = select_memo_cache_shard(cache, hash_key);
+    int64_t now_ms = cache->ttl_ms > 0 ? pt_platform_get_monotonic_ms() : 0;
+    
+    pt_platform_mutex_lock((pt_platform_mutex_t*)shard->lock);
+    size_t index = find_memo_cache_entry(shard, hash_key, node_id, key_data, key_size);
+    if (index == MEMO_CACHE_NO_ENTRY) {
+        shard->misses++;
+        pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+        return -1;
+    }
+    
+    memo_cache_entry_t* entry = &shard->entries[index];
+    if (entry->expire_ms != 0 && now_ms >= entry->expire_ms) {
+        remove_memo_cache_entry(shard, index);
+        shard->expirations++;
+        shard->misses++;
+        pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+        return -1;
+    }
+    
+    void* value_copy = NULL;
+    if (entry->value_data != NULL && entry->value_size > 0) {
+        value_copy = malloc(entry->value_size);
+        if (value_copy == NULL) {
+            shard->misses++;
+            pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+            return -1;
+        }
+        memcpy(value_copy, entry->value_data, entry->value_size);
+    }
+    
+    entry->referenced = 1;
+    shard->hits++;
+    *return_type_out = entry->return_type;
+    *result_int_out = entry->result_int;
+    *result_float_out = entry->result_float;
+    *value_out = value_copy;
+    *value_size_out = value_copy != NULL ? entry->value_size : 0;
+    pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+    return 0;
+}
+
+/**
+ * @brief 存储记忆化结果 / Store memoized result / Memoisiertes Ergebnis speichern
+ * @param hash_key 参数包哈希 / Parameter pack hash / Parameterpaket-Hash
+ * @param node_id 目标接口节点ID / Target interface node ID / Zielschnittstellen-Knoten-ID
+ * @param key_data 序列化的键 / Serialized key / Serialisierter Schlüssel
+ * @param key_size 键大小 / Key size / Schlüsselgröße
+ * @param return_type 返回值类型 / Return type / Rückgabetyp
+ * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
+ * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
+ * @param value_data 结构体或字符串结果（可为NULL） / Struct or string result (may be NULL) / Struktur- oder Zeichenfolgenergebnis (kann NULL sein)
+ * @param value_size 结果大小 / Result size / Ergebnisgröße
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int memo_cache_store(uint64_t hash_key, size_t node_id, const unsigned char* key_data, size_t key_size,
+                     pt_return_type_t return_type, int64_t result_int, double result_float,
+                     const void* value_data, size_t value_size) {
+    if ((key_data == NULL && key_size > 0) || (value_data == NULL && value_size > 0)) {
+        return -1;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->memo_cache.shards == NULL) {
+        return -1;
+    }
+    
+    /* 在锁外复制键和值 / Copy key and value outside the lock / Schlüssel und Wert außerhalb der Sperre kopieren */
+    unsigned char* key_copy = NULL;
+    unsigned char* value_copy = NULL;
+    if (key_size > 0) {
+        key_copy = (unsigned char*)malloc(key_size);
+        if (key_copy == NULL) {
+            return -1;
+        }
+        memcpy(key_copy, key_data, key_size);
+    }
+    if (value_size > 0) {
+        value_copy = (unsigned char*)malloc(value_size);
+        if (value_copy == NULL) {
+            if (key_copy != NULL) {
+                free(key_copy);
+            }
+            return -1;
+        }
+        memcpy(value_copy, value_data, value_size);
+    }
+    
+    memo_cache_t* cache = &ctx->memo_cache;
+    memo_cache_shard_t* shard = select_memo_cache_shard(cache, hash_key);
+    int64_t expire_ms = cache->ttl_ms > 0 ? pt_platform_get_monotonic_ms() + cache->ttl_ms : 0;
+    
+    pt_platform_mutex_lock((pt_platform_mutex_t*)shard->lock);
+    size_t index = find_memo_cache_entry(shard, hash_key, node_id, key_data, key_size);
+    if (index != MEMO_CACHE_NO_ENTRY) {
+        remove_memo_cache_entry(shard, index);
+    } else {
+        index = allocate_memo_cache_slot(shard);
+    }
+    
+    memo_cache_entry_t* entry = &shard->entries[index];
+    entry->hash_key = hash_key;
+    entry->node_id = node_id;
+    entry->key_data = key_copy;
+    entry->key_size = key_size;
+    entry->return_type = return_type;
+    entry->result_int = result_int;
+    entry->result_float = result_float;
+    entry->value_data = value_copy;
+    entry->value_size = value_size;
+    entry->expire_ms = expire_ms;
+    entry->referenced = 0;
+    entry->occupied = 1;
+    
+    size_t* bucket = &shard->buckets[(size_t)hash_key & (shard->bucket_count - 1)];
+    entry->next = *bucket;
+    *bucket = index + 1;
+    shard->count++;
+    pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+    return 0;
+}
+
+/**
+ * @brief 丢弃某插件接口的记忆化结果 / Drop memoized results of a plugin's interfaces / Memoisierte Ergebnisse der Schnittstellen eines Plugins verwerfen
+ * @details 插件热替换后旧版本的结果可能不再正确，其他插件的条目保持有效 / Results of the old version may be wrong after a hot swap, entries of other plugins stay valid / Ergebnisse der alten Version können nach einem Hot-Swap falsch sein, Einträge anderer Plugins bleiben gültig
+ */
+size_t invalidate_memo_cache_plugin(const char* plugin_name) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || plugin_name == NULL || ctx->memo_cache.shards == NULL) {
+        return 0;
+    }
+    
+    memo_cache_t* cache = &ctx->memo_cache;
+    size_t removed = 0;
+    for (size_t i = 0; i < cache->shard_count; i++) {
+        memo_cache_shard_t* shard = &cache->shards[i];
+        pt_platform_mutex_lock((pt_platform_mutex_t*)shard->lock);
+        for (size_t j = 0; j < shard->used; j++) {
+            memo_cache_entry_t* entry = &shard->entries[j];
+            if (entry->occupied && entry->node_id < ctx->rule_graph.node_count &&
+                strcmp(ctx->rule_graph.nodes[entry->node_id].plugin_name, plugin_name) == 0) {
+                remove_memo_cache_entry(shard, j);
+                removed++;
+            }
+        }
+        pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+    }
+    return removed;
+}
+
+/**
+ * @brief 丢弃指定规则图节点的记忆化结果 / Drop memoized results of the given rule graph nodes / Memoisierte Ergebnisse der angegebenen Regelgraph-Knoten verwerfen
+ * @details 规则增删只改变少数节点的纯接口或环状态，其余节点的条目保持有效 / Rule additions and removals change purity or cycle state of only a few nodes, entries of the other nodes stay valid / Regelhinzufügungen und -entfernungen ändern Reinheit oder Zyklusstatus nur weniger Knoten, Einträge der übrigen Knoten bleiben gültig
+ */
+size_t invalidate_memo_cache_nodes(const size_t* node_ids, size_t node_count) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || node_ids == NULL || node_count == 0 || ctx->memo_cache.shards == NULL) {
+        return 0;
+    }
+    
+    memo_cache_t* cache = &ctx->memo_cache;
+    size_t removed = 0;
+    for (size_t i = 0; i < cache->shard_count; i++) {
+        memo_cache_shard_t* shard = &cache->shards[i];
+        pt_platform_mutex_lock((pt_platform_mutex_t*)shard->lock);
+        for (size_t j = 0; j < shard->used; j++) {
+            memo_cache_entry_t* entry = &shard->entries[j];
+            if (!entry->occupied) {
+                continue;
+            }
+            for (size_t k = 0; k < node_count; k++) {
+                if (entry->node_id == node_ids[k]) {
+                    remove_memo_cache_entry(shard, j);
+                    removed++;
+                    break;
+                }
+            }
+        }
+        pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+    }
+    return removed;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file pointer_transfer_context_memo_table.c
+ * @brief 记忆化缓存表管理 / Memoization Cache Table Management / Memoisierungs-Cache-Tabellenverwaltung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 释放记忆化缓存 / Free memoization cache / Memoisierungs-Cache freigeben
+ * @details 保留MemoCacheSize和MemoCacheTTL配置 / Keeps MemoCacheSize and MemoCacheTTL configuration / Behält MemoCacheSize- und MemoCacheTTL-Konfiguration
+ */
+void free_memo_cache(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    memo_cache_t* cache = &ctx->memo_cache;
+    if (cache->shards != NULL) {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t expirations = 0;
+        size_t entries = 0;
+        get_memo_cache_stats(&hits, &misses, &evictions, &expirations, &entries);
+        internal_log_write("INFO", "Releasing memoization cache: %zu entries, %llu hits, %llu misses, %llu evictions, %llu expirations",
+                          entries, (unsigned long long)hits, (unsigned long long)misses,
+                          (unsigned long long)evictions, (unsigned long long)expirations);
+        
+        for (size_t i = 0; i < cache->shard_count; i++) {
+            memo_cache_shard_t* shard = &cache->shards[i];
+            if (shard->entries != NULL) {
+                for (size_t j = 0; j < shard->used; j++) {
+                    if (shard->entries[j].key_data != NULL) {
+                        free(shard->entries[j].key_data);
+                    }
+                    if (shard->entries[j].value_data != NULL) {
+                        free(shard->entries[j].value_data);
+                    }
+                }
+                free(shard->entries);
+            }
+            if (shard->buckets != NULL) {
+                free(shard->buckets);
+            }
+            if (shard->lock != NULL) {
+                pt_platform_mutex_destroy((pt_platform_mutex_t*)shard->lock);
+            }
+        }
+        free(cache->shards);
+    }
+    cache->shards = NULL;
+    cache->shard_count = 0;
+}
+
+/**
+ * @brief 初始化记忆化缓存（清空已有条目） / Initialize memoization cache (flushes existing entries) / Memoisierungs-Cache initialisieren (leert vorhandene Einträge)
+ * @details 规则变化时只丢弃受影响节点的条目（见sync_memo_cache_with_graph），此函数仅在无法确定受影响节点时使用；没有纯接口时不分配 / Rule changes only drop entries of affected nodes (see sync_memo_cache_with_graph), this is only used when the affected nodes cannot be determined; nothing is allocated without pure interfaces / Regeländerungen verwerfen nur Einträge betroffener Knoten (siehe sync_memo_cache_with_graph), dies wird nur verwendet, wenn die betroffenen Knoten nicht bestimmbar sind; ohne reine Schnittstellen wird nichts zugewiesen
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int init_memo_cache(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        internal_log_write("ERROR", "init_memo_cache: global context is NULL");
+        return -1;
+    }
+    
+    free_memo_cache();
+    memo_cache_t* cache = &ctx->memo_cache;
+    if (cache->disabled) {
+        internal_log_write("INFO", "Memoization cache disabled by configuration");
+        return 0;
+    }
+    
+    size_t pure_count = 0;
+    for (size_t i = 0; i < ctx->rule_graph.node_count; i++) {
+        if (ctx->rule_graph.nodes[i].memoizable) {
+            pure_count++;
+        }
+    }
+    if (pure_count == 0) {
+        return 0;
+    }
+    
+    size_t max_entries = cache->max_entries > 0 ? cache->max_entries : PT_DEFAULT_MEMO_CACHE_SIZE;
+    size_t shard_count = PT_MEMO_CACHE_SHARD_COUNT;
+    while (shard_count > 1 && max_entries / shard_count == 0) {
+        shard_count /= 2;
+    }
+    size_t shard_capacity = max_entries / shard_count + (max_entries % shard_count != 0 ? 1 : 0);
+    
+    /* 桶数量取不小于两倍容量的2的幂 / Bucket count is the power of two not below twice the capacity / Bucket-Anzahl ist die Zweierpotenz nicht unter doppelter Kapazität */
+    size_t bucket_count = 2;
+    while (bucket_count < shard_capacity * 2) {
+        if (bucket_count > SIZE_MAX / 2) {
+            internal_log_write("ERROR", "init_memo_cache: bucket count overflow detected (max_entries=%zu)", max_entries);
+            return -1;
+        }
+        bucket_count *= 2;
+    }
+    if (shard_capacity > SIZE_MAX / sizeof(memo_cache_entry_t) || bucket_count > SIZE_MAX / sizeof(size_t)) {
+        internal_log_write("ERROR", "init_memo_cache: capacity overflow detected (max_entries=%zu)", max_entries);
+        return -1;
+    }
+    
+    cache->shards = (memo_cache_shard_t*)calloc(shard_count, sizeof(memo_cache_shard_t));
+    if (cache->shards == NULL) {
+        internal_log_write("ERROR", "init_memo_cache: failed to allocate shards (shard_count=%zu)", shard_count);
+        return -1;
+    }
+    cache->shard_count = shard_count;
+    
+    for (size_t i = 0; i < shard_count; i++) {
+        memo_cache_shard_t* shard = &cache->shards[i];
+        shard->entries = (memo_cache_entry_t*)calloc(shard_capacity, sizeof(memo_cache_entry_t));
+        shard->buckets = (size_t*)calloc(bucket_count, sizeof(size_t));
+        shard->lock = pt_platform_mutex_create();
+        if (shard->entries == NULL || shard->buckets == NULL || shard->lock == NULL) {
+            internal_log_write("ERROR", "init_memo_cache: failed to allocate shard %zu (capacity=%zu)", i, shard_capacity);
+            free_memo_cache();
+            return -1;
+        }
+        shard->capacity = shard_capacity;
+        shard->bucket_count = bucket_count;
+    }
+    
+    internal_log_write("INFO", "Initialized memoization cache for %zu pure interfaces: %zu entries in %zu shards (TTL %lld ms)",
+                      pure_count, shard_capacity * shard_count, shard_count, (long long)cache->ttl_ms);
+    return 0;
+}
+
+/**
+ * @brief 出现纯接口时按需分配记忆化缓存（不清空已有条目） / Allocate memoization cache on demand once pure interfaces exist (keeps existing entries) / Memoisierungs-Cache bei Bedarf zuweisen, sobald reine Schnittstellen existieren (behält vorhandene Einträge)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int ensure_memo_cache(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    
+    if (ctx->memo_cache.shards != NULL || ctx->memo_cache.disabled) {
+        return 0;
+    }
+    return init_memo_cache();
+}
+
+/**
+ * @brief 获取记忆化缓存统计 / Get memoization cache statistics / Memoisierungs-Cache-Statistiken abrufen
+ * @param hits_out 输出命中次数 / Output hit count / Ausgabe-Trefferanzahl
+ * @param misses_out 输出未命中次数 / Output miss count / Ausgabe-Fehltrefferanzahl
+ * @param evictions_out 输出淘汰次数 / Output eviction count / Ausgabe-Verdrängungsanzahl
+ * @param expirations_out 输出过期次数 / Output expiration count / Ausgabe-Ablaufanzahl
+ * @param entries_out 输出有效条目数量 / Output live entry count / Ausgabe-Anzahl gültiger Einträge
+ */
+void get_memo_cache_stats(uint64_t* hits_out, uint64_t* misses_out, uint64_t* evictions_out,
+                          uint64_t* expirations_out, size_t* entries_out) {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t expirations = 0;
+    size_t entries = 0;
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx != NULL && ctx->memo_cache.shards != NULL) {
+        for (size_t i = 0; i < ctx->memo_cache.shard_count; i++) {
+            memo_cache_shard_t* shard = &ctx->memo_cache.shards[i];
+            pt_platform_mutex_lock((pt_platform_mutex_t*)shard->lock);
+            hits += shard->hits;
+            misses += shard->misses;
+            evictions += shard->evictions;
+            expirations += shard->expirations;
+            entries += shard->count;
+            pt_platform_mutex_unlock((pt_platform_mutex_t*)shard->lock);
+        }
+    }
+    
+    if (hits_out != NULL) {
+        *hits_out = hits;
+    }
+    if (misses_out != NULL) {
+        *misses_out = misses;
+    }
+    if (evictions_out != NULL) {
+        *evictions_out = evictions;
+    }
+    if (expirations_out != NULL) {
+        *expirations_out = expirations;
+    }
+    if (entries_out != NULL) {
+        *entries_out = entries;
+    }
+}
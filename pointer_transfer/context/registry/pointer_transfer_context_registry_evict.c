@@ -0,0 +1,204 @@
+/**
+ * @file pointer_transfer_context_registry_evict.c
+ * @brief 插件引用计数和空闲卸载 / Plugin Reference Counting and Idle Eviction / Plugin-Referenzzählung und Leerlauf-Entladung
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "config/reload/config_reload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 仅按空闲时间卸载时的最短清扫间隔（微秒） / Minimum sweep interval when only idle time applies (microseconds) / Minimales Bereinigungsintervall, wenn nur die Leerlaufzeit gilt (Mikrosekunden) */
+#define PLUGIN_IDLE_SWEEP_MIN_US 100000
+
+/**
+ * @brief 标记插件调用进行中 / Mark plugin call in flight / Plugin-Aufruf als laufend markieren
+ */
+plugin_registry_entry_t* pin_plugin_registry_entry(const char* plugin_name) {
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+    if (entry == NULL) {
+        return NULL;
+    }
+    
+    pt_platform_atomic_fetch_add_int(&entry->in_flight, 1);
+    entry->last_used_us = pt_platform_get_monotonic_us();
+    return entry;
+}
+
+/**
+ * @brief 结束进行中的插件调用 / End plugin call in flight / Laufenden Plugin-Aufruf beenden
+ */
+void unpin_plugin_registry_entry(plugin_registry_entry_t* entry) {
+    if (entry == NULL) {
+        return;
+    }
+    
+    entry->last_used_us = pt_platform_get_monotonic_us();
+    pt_platform_atomic_fetch_add_int(&entry->in_flight, -1);
+}
+
+/**
+ * @brief 统计规则和接口状态对各插件的引用 / Count rule and interface state references to each plugin / Regel- und Schnittstellenstatus-Referenzen je Plugin zählen
+ */
+static void count_plugin_references(pointer_transfer_context_t* ctx) {
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    for (size_t i = 0; i < registry->count; i++) {
+        registry->entries[i]->rule_refs = 0;
+        registry->entries[i]->state_refs = 0;
+    }
+    
+    for (size_t i = 0; i < ctx->rule_count; i++) {
+        const pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (!rule->enabled || rule->target_plugin == NULL) {
+            continue;
+        }
+        plugin_registry_entry_t* entry = find_plugin_registry_entry(rule->target_plugin);
+        if (entry != NULL) {
+            entry->rule_refs++;
+        }
+    }
+    
+    for (size_t i = 0; i < ctx->interface_state_count; i++) {
+        plugin_registry_entry_t* entry = find_plugin_registry_entry(ctx->interface_states[i].plugin_name);
+        if (entry != NULL) {
+            entry->state_refs++;
+        }
+    }
+}
+
+/**
+ * @brief 卸载插件并断开其接口状态，下次使用时重新加载 / Unload plugin and detach its interface states, reloading on next use / Plugin entladen und Schnittstellenstatus trennen, bei nächster Verwendung neu laden
+ */
+static void unload_plugin_registry_entry(pointer_transfer_context_t* ctx, plugin_registry_entry_t* entry, const char* reason) {
+    if (entry->state_refs > 0) {
+        for (size_t i = 0; i < ctx->interface_state_count; i++) {
+            target_interface_state_t* state = &ctx->interface_states[i];
+            if (state->handle == entry->handle) {
+                state->handle = NULL;
+                state->func_ptr = NULL;
+                state->validation_done = 0;
+            }
+        }
+    }
+    
+    pt_platform_close_library(entry->handle);
+    entry->handle = NULL;
+    if (entry->shadow_path != NULL) {
+        remove(entry->shadow_path);
+        free(entry->shadow_path);
+        entry->shadow_path = NULL;
+    }
+    entry->symbol_count = 0;
+    entry->unload_count++;
+    ctx->plugin_registry.total_unloads++;
+    ctx->plugin_registry.resident_count--;
+    internal_log_write("INFO", "Unloaded plugin %s (%s, %zu rules, %zu states, load #%llu)",
+                      entry->plugin_name, reason, entry->rule_refs, entry->state_refs,
+                      (unsigned long long)entry->load_count);
+}
+
+/**
+ * @brief 检查插件是否可卸载 / Check if plugin can be unloaded / Prüfen, ob Plugin entladen werden kann
+ */
+static int is_plugin_evictable(const pointer_transfer_context_t* ctx, const plugin_registry_entry_t* entry) {
+    if (entry->handle == NULL || pt_platform_atomic_load_int(&entry->in_flight) != 0) {
+        return 0;
+    }
+    /* 入口插件始终驻留 / The entry plugin always stays resident / Das Einstiegs-Plugin bleibt immer resident */
+    return ctx->entry_plugin_name == NULL || strcmp(entry->plugin_name, ctx->entry_plugin_name) != 0;
+}
+
+/**
+ * @brief 按驻留策略卸载空闲插件 / Evict idle plugins according to the residency policy / Leerlaufende Plugins gemäß Residenzrichtlinie entladen
+ * @details 在调用边界执行；持写锁时没有进行中的调用 / Runs at call boundaries; no call is in flight while the write lock is held / Läuft an Aufrufgrenzen; während die Schreibsperre gehalten wird, läuft kein Aufruf
+ */
+size_t evict_idle_plugins(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || (ctx->max_loaded_plugins == 0 && ctx->unload_idle_after_ms == 0)) {
+        return 0;
+    }
+    
+    /* 嵌套在插件调用内时跳过 / Skip when nested inside a plugin call / Überspringen, wenn in einem Plugin-Aufruf verschachtelt */
+    if (get_rule_set_read_depth() > 0) {
+        return 0;
+    }
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    int64_t now_us = pt_platform_get_monotonic_us();
+    int64_t idle_us = (int64_t)ctx->unload_idle_after_ms * 1000;
+    int64_t sweep_interval_us = idle_us / 4 > PLUGIN_IDLE_SWEEP_MIN_US ? idle_us / 4 : PLUGIN_IDLE_SWEEP_MIN_US;
+    int over_limit = ctx->max_loaded_plugins > 0 && registry->resident_count > ctx->max_loaded_plugins;
+    int sweep_due = idle_us > 0 && now_us - registry->last_sweep_us >= sweep_interval_us;
+    if (!over_limit && !sweep_due) {
+        return 0;
+    }
+    
+    wait_for_plugin_preload();
+    /* 后台验证可能正在调用待卸载插件的函数 / Background validation may be calling functions of plugins about to be unloaded / Die Hintergrundvalidierung ruft möglicherweise Funktionen zu entladender Plugins auf */
+    wait_for_interface_validation();
+    acquire_rule_set_write();
+    registry->last_sweep_us = now_us;
+    count_plugin_references(ctx);
+    
+    /* 先卸载无规则引用或空闲超时的插件 / First unload plugins without rule references or past the idle timeout / Zuerst Plugins ohne Regelreferenzen oder nach Leerlauf-Timeout entladen */
+    size_t evicted = 0;
+    for (size_t i = 0; i < registry->count; i++) {
+        plugin_registry_entry_t* entry = registry->entries[i];
+        if (!is_plugin_evictable(ctx, entry)) {
+            continue;
+        }
+        if (entry->rule_refs == 0) {
+            unload_plugin_registry_entry(ctx, entry, "no rules");
+            evicted++;
+        } else if (idle_us > 0 && now_us - entry->last_used_us >= idle_us) {
+            unload_plugin_registry_entry(ctx, entry, "idle");
+            evicted++;
+        }
+    }
+    
+    /* 仍超出上限时按最近最少使用卸载 / Unload least recently used plugins while still over the limit / Am längsten nicht verwendete Plugins entladen, solange das Limit überschritten ist */
+    while (ctx->max_loaded_plugins > 0 && registry->resident_count > ctx->max_loaded_plugins) {
+        plugin_registry_entry_t* victim = NULL;
+        for (size_t i = 0; i < registry->count; i++) {
+            plugin_registry_entry_t* entry = registry->entries[i];
+            if (is_plugin_evictable(ctx, entry) && (victim == NULL || entry->last_used_us < victim->last_used_us)) {
+                victim = entry;
+            }
+        }
+        if (victim == NULL) {
+            break;
+        }
+        unload_plugin_registry_entry(ctx, victim, "least recently used");
+        evicted++;
+    }
+    release_rule_set_write();
+    
+    if (evicted > 0) {
+        internal_log_write("INFO", "Evicted %zu plugins: %zu resident, %llu loads, %llu unloads",
+                          evicted, registry->resident_count,
+                          (unsigned long long)registry->total_loads, (unsigned long long)registry->total_unloads);
+    }
+    return evicted;
+}
+
+/**
+ * @brief 获取插件加载和卸载统计 / Get plugin load and unload statistics / Plugin-Lade- und Entladestatistiken abrufen
+ */
+void get_plugin_residency_stats(uint64_t* loads_out, uint64_t* unloads_out, size_t* resident_out) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (loads_out != NULL) {
+        *loads_out = ctx != NULL ? ctx->plugin_registry.total_loads : 0;
+    }
+    if (unloads_out != NULL) {
+        *unloads_out = ctx != NULL ? ctx->plugin_registry.total_unloads : 0;
+    }
+    if (resident_out != NULL) {
+        *resident_out = ctx != NULL ? ctx->plugin_registry.resident_count : 0;
+    }
+}
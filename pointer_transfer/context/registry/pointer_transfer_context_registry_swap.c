@@ -0,0 +1,340 @@
+/**
+ * @file pointer_transfer_context_registry_swap.c
+ * @brief 插件热替换 / Plugin Hot Swap / Plugin-Hot-Swap
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "config/reload/config_reload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+/* 文件修改后等待稳定的秒数，避免加载写入一半的库 / Seconds a modified file must settle before swapping, avoids loading half-written libraries / Sekunden, die eine geänderte Datei vor dem Austausch ruhen muss, vermeidet halb geschriebene Bibliotheken */
+#define PLUGIN_FILE_SETTLE_SECONDS 1
+
+/**
+ * @brief 复制库文件并从副本加载新版本 / Copy library file and load the new version from the copy / Bibliotheksdatei kopieren und neue Version aus der Kopie laden
+ * @details 同一路径再次加载会返回已加载的旧库，因此通过副本加载 / Loading the same path again returns the already loaded old library, so the copy is loaded instead / Erneutes Laden desselben Pfads liefert die bereits geladene alte Bibliothek, daher wird die Kopie geladen
+ */
+static void* load_plugin_shadow_copy(const plugin_registry_entry_t* entry, char** shadow_path_out) {
+    *shadow_path_out = NULL;
+    size_t path_size = strlen(entry->plugin_path) + 32;
+    char* shadow_path = (char*)malloc(path_size);
+    if (shadow_path == NULL) {
+        internal_log_write("ERROR", "load_plugin_shadow_copy: failed to allocate path for %s", entry->plugin_name);
+        return NULL;
+    }
+    snprintf(shadow_path, path_size, "%s.%lld.swap", entry->plugin_path, (long long)pt_platform_get_monotonic_us());
+    
+    if (pt_platform_copy_file(entry->plugin_path, shadow_path) != 0) {
+        internal_log_write("WARNING", "Hot swap of %s: cannot copy %s", entry->plugin_name, entry->plugin_path);
+        free(shadow_path);
+        return NULL;
+    }
+    
+    void* handle = pt_platform_load_library(shadow_path);
+    if (handle == NULL) {
+        internal_log_write("WARNING", "Hot swap of %s: cannot load new library from %s", entry->plugin_name, entry->plugin_path);
+        remove(shadow_path);
+        free(shadow_path);
+        return NULL;
+    }
+    
+    /* POSIX可立即删除已加载的副本，Windows在旧库退役时删除 / POSIX can delete the loaded copy right away, Windows deletes it when the library is retired / POSIX kann die geladene Kopie sofort löschen, Windows löscht sie bei Stilllegung der Bibliothek */
+    if (remove(shadow_path) == 0) {
+        free(shadow_path);
+        shadow_path = NULL;
+    }
+    *shadow_path_out = shadow_path;
+    return handle;
+}
+
+/**
+ * @brief 关闭旧库并删除其副本 / Close old library and delete its copy / Alte Bibliothek schließen und ihre Kopie löschen
+ */
+static void close_retired_plugin(plugin_retired_handle_t* retired) {
+    pt_platform_close_library(retired->handle);
+    if (retired->shadow_path != NULL) {
+        remove(retired->shadow_path);
+        free(retired->shadow_path);
+    }
+    internal_log_write("INFO", "Retired old library of %s (epoch %llu)",
+                      retired->entry->plugin_name, (unsigned long long)retired->epoch);
+}
+
+/**
+ * @brief 将旧库加入退役列表 / Add old library to the retired list / Alte Bibliothek zur Stilllegungsliste hinzufügen
+ */
+static int retire_plugin_handle(plugin_registry_t* registry, plugin_registry_entry_t* entry, void* handle, char* shadow_path) {
+    if (registry->retired_count >= registry->retired_capacity) {
+        size_t new_capacity = registry->retired_capacity == 0 ? INITIAL_PLUGIN_CAPACITY : registry->retired_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < registry->retired_capacity || new_capacity > SIZE_MAX / sizeof(plugin_retired_handle_t)) {
+            internal_log_write("ERROR", "retire_plugin_handle: capacity overflow detected (current=%zu)", registry->retired_capacity);
+            return -1;
+        }
+        plugin_retired_handle_t* new_retired = (plugin_retired_handle_t*)realloc(registry->retired, new_capacity * sizeof(plugin_retired_handle_t));
+        if (new_retired == NULL) {
+            internal_log_write("ERROR", "retire_plugin_handle: failed to allocate memory (new_capacity=%zu)", new_capacity);
+            return -1;
+        }
+        registry->retired = new_retired;
+        registry->retired_capacity = new_capacity;
+    }
+    
+    plugin_retired_handle_t* retired = &registry->retired[registry->retired_count++];
+    retired->entry = entry;
+    retired->handle = handle;
+    retired->shadow_path = shadow_path;
+    retired->epoch = registry->swap_epoch;
+    return 0;
+}
+
+/**
+ * @brief 关闭已无进行中调用的旧库（须持有规则集写锁） / Close old libraries without calls in flight (rule set write lock held) / Alte Bibliotheken ohne laufende Aufrufe schließen (Regelsatz-Schreibsperre gehalten)
+ * @details 写锁等待了替换前开始的所有调用，剩余的钉住来自未持读锁的调用 / The write lock waited for every call started before the swap, remaining pins come from calls outside the read lock / Die Schreibsperre hat auf alle vor dem Austausch begonnenen Aufrufe gewartet, verbleibende Pins stammen von Aufrufen ohne Lesesperre
+ */
+static size_t reclaim_retired_plugins_locked(plugin_registry_t* registry) {
+    size_t kept = 0;
+    size_t reclaimed = 0;
+    for (size_t i = 0; i < registry->retired_count; i++) {
+        plugin_retired_handle_t* retired = &registry->retired[i];
+        if (pt_platform_atomic_load_int(&retired->entry->in_flight) == 0) {
+            close_retired_plugin(retired);
+            reclaimed++;
+        } else {
+            registry->retired[kept++] = *retired;
+        }
+    }
+    registry->retired_count = kept;
+    return reclaimed;
+}
+
+/**
+ * @brief 发布新库：重新解析符号和元数据并更新接口状态（须持有规则集写锁） / Publish new library: re-resolve symbols and metadata and update interface states (rule set write lock held) / Neue Bibliothek veröffentlichen: Symbole und Metadaten neu auflösen und Schnittstellenstatus aktualisieren (Regelsatz-Schreibsperre gehalten)
+ */
+static int publish_plugin_swap(pointer_transfer_context_t* ctx, plugin_registry_entry_t* entry, void* new_handle, char* shadow_path) {
+    void* old_handle = entry->handle;
+    
+    /* 先检查所有接口状态，任何一个不兼容都保留旧版本 / Check all interface states first, keep the old version if any is incompatible / Zuerst alle Schnittstellenstatus prüfen, bei Inkompatibilität die alte Version behalten */
+    for (size_t i = 0; i < ctx->interface_state_count; i++) {
+        target_interface_state_t* state = &ctx->interface_states[i];
+        if (state->handle == old_handle && rebind_interface_state(state, new_handle, 0) != 0) {
+            return -1;
+        }
+    }
+    if (retire_plugin_handle(&ctx->plugin_registry, entry, old_handle, entry->shadow_path) != 0) {
+        return -1;
+    }
+    
+    for (size_t i = 0; i < ctx->interface_state_count; i++) {
+        target_interface_state_t* state = &ctx->interface_states[i];
+        if (state->handle == old_handle) {
+            rebind_interface_state(state, new_handle, 1);
+        }
+    }
+    
+    /* 重新解析缓存的符号，新版本不再导出的符号被丢弃 / Re-resolve cached symbols, symbols no longer exported are dropped / Gecachte Symbole neu auflösen, nicht mehr exportierte Symbole werden verworfen */
+    size_t kept = 0;
+    for (size_t i = 0; i < entry->symbol_count; i++) {
+        void* func_ptr = pt_platform_get_symbol(new_handle, entry->symbols[i].symbol_name);
+        if (func_ptr != NULL) {
+            entry->symbols[kept] = entry->symbols[i];
+            entry->symbols[kept].func_ptr = func_ptr;
+            kept++;
+        }
+    }
+    entry->symbol_count = kept;
+    
+    size_t invalidated = invalidate_memo_cache_plugin(entry->plugin_name);
+    if (invalidated > 0) {
+        internal_log_write("INFO", "Hot swap of %s: dropped %zu memoized results", entry->plugin_name, invalidated);
+    }
+    
+    entry->handle = new_handle;
+    entry->shadow_path = shadow_path;
+    entry->swap_count++;
+    entry->last_used_us = pt_platform_get_monotonic_us();
+    ctx->plugin_registry.swap_epoch++;
+    return 0;
+}
+
+/**
+ * @brief 热替换插件 / Hot-swap plugin / Plugin per Hot-Swap austauschen
+ * @details 新库在锁外加载，只有发布在规则集写锁内进行 / The new library is loaded outside the lock, only publishing happens under the rule set write lock / Die neue Bibliothek wird außerhalb der Sperre geladen, nur die Veröffentlichung erfolgt unter der Regelsatz-Schreibsperre
+ */
+int hot_swap_plugin(const char* plugin_name) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || plugin_name == NULL) {
+        return -1;
+    }
+    if (ctx->entry_plugin_name != NULL && strcmp(plugin_name, ctx->entry_plugin_name) == 0) {
+        internal_log_write("WARNING", "Hot swap of %s: the entry plugin cannot be swapped", plugin_name);
+        return -1;
+    }
+    
+    wait_for_plugin_preload();
+    /* 后台验证可能正在调用旧库的函数 / Background validation may be calling functions of the old library / Die Hintergrundvalidierung ruft möglicherweise Funktionen der alten Bibliothek auf */
+    wait_for_interface_validation();
+    
+    /* 在插件调用内请求时推迟到调用边界 / Defer to the call boundary when requested inside a plugin call / Bei Anforderung innerhalb eines Plugin-Aufrufs auf die Aufrufgrenze verschieben */
+    if (get_rule_set_read_depth() > 0) {
+        plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+        if (entry == NULL) {
+            internal_log_write("WARNING", "Hot swap of %s: plugin is not registered", plugin_name);
+            return -1;
+        }
+        if (!entry->swap_pending) {
+            entry->swap_pending = 1;
+            pt_platform_atomic_fetch_add_int(&ctx->plugin_registry.swaps_pending, 1);
+        }
+        internal_log_write("INFO", "Hot swap of %s deferred to the call boundary", plugin_name);
+        return 0;
+    }
+    
+    acquire_rule_set_write();
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+    void* old_handle = entry != NULL ? entry->handle : NULL;
+    int64_t timestamp = 0;
+    if (entry != NULL && entry->plugin_path != NULL && pt_platform_get_file_timestamp(entry->plugin_path, &timestamp) == 0) {
+        entry->file_timestamp = timestamp;
+    }
+    release_rule_set_write();
+    
+    if (entry == NULL || entry->plugin_path == NULL) {
+        internal_log_write("WARNING", "Hot swap of %s: plugin path is unknown", plugin_name);
+        return -1;
+    }
+    if (old_handle == NULL) {
+        /* 未驻留的插件下次加载时自然使用新文件 / A non-resident plugin picks up the new file on its next load / Ein nicht residentes Plugin verwendet beim nächsten Laden die neue Datei */
+        internal_log_write("INFO", "Hot swap of %s: not resident, new library is used on next load", plugin_name);
+        return 0;
+    }
+    
+    int64_t start_us = pt_platform_get_monotonic_us();
+    char* shadow_path = NULL;
+    void* new_handle = load_plugin_shadow_copy(entry, &shadow_path);
+    if (new_handle == NULL) {
+        return -1;
+    }
+    
+    acquire_rule_set_write();
+    int result = -1;
+    if (entry->handle != old_handle) {
+        internal_log_write("WARNING", "Hot swap of %s: library changed during swap, keeping current version", plugin_name);
+    } else {
+        result = publish_plugin_swap(ctx, entry, new_handle, shadow_path);
+    }
+    size_t reclaimed = result == 0 ? reclaim_retired_plugins_locked(&ctx->plugin_registry) : 0;
+    release_rule_set_write();
+    
+    if (result != 0) {
+        pt_platform_close_library(new_handle);
+        if (shadow_path != NULL) {
+            remove(shadow_path);
+            free(shadow_path);
+        }
+        internal_log_write("WARNING", "Hot swap of %s failed, keeping current version", plugin_name);
+        return -1;
+    }
+    
+    internal_log_write("INFO", "Hot-swapped plugin %s (swap #%llu, %lld us, old library %s)",
+                      plugin_name, (unsigned long long)entry->swap_count,
+                      (long long)(pt_platform_get_monotonic_us() - start_us), reclaimed > 0 ? "closed" : "retiring");
+    return 0;
+}
+
+/**
+ * @brief 标记库文件已改变的驻留插件等待热替换 / Mark resident plugins whose library file changed for hot swap / Residente Plugins mit geänderter Bibliotheksdatei für Hot-Swap markieren
+ */
+size_t mark_changed_plugin_files(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return 0;
+    }
+    
+    wait_for_plugin_preload();
+    acquire_rule_set_write();
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    int64_t now = (int64_t)time(NULL);
+    size_t marked = 0;
+    for (size_t i = 0; i < registry->count; i++) {
+        plugin_registry_entry_t* entry = registry->entries[i];
+        int64_t timestamp = 0;
+        if (entry->handle == NULL || entry->plugin_path == NULL || entry->swap_pending ||
+            pt_platform_get_file_timestamp(entry->plugin_path, &timestamp) != 0) {
+            continue;
+        }
+        if (timestamp != entry->file_timestamp && now - timestamp >= PLUGIN_FILE_SETTLE_SECONDS) {
+            internal_log_write("INFO", "Plugin watcher: %s changed", entry->plugin_path);
+            entry->swap_pending = 1;
+            pt_platform_atomic_fetch_add_int(&registry->swaps_pending, 1);
+            marked++;
+        }
+    }
+    
+    release_rule_set_write();
+    return marked;
+}
+
+/**
+ * @brief 在调用边界执行推迟的热替换并回收旧库 / Run deferred hot swaps and reclaim old libraries at the call boundary / Verschobene Hot-Swaps ausführen und alte Bibliotheken an der Aufrufgrenze freigeben
+ */
+void apply_pending_plugin_swaps(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    if (pt_platform_atomic_load_int(&registry->swaps_pending) == 0 && registry->retired_count == 0) {
+        return;
+    }
+    if (get_rule_set_read_depth() > 0) {
+        return;
+    }
+    
+    for (;;) {
+        const char* plugin_name = NULL;
+        acquire_rule_set_write();
+        for (size_t i = 0; i < registry->count && plugin_name == NULL; i++) {
+            if (registry->entries[i]->swap_pending) {
+                registry->entries[i]->swap_pending = 0;
+                pt_platform_atomic_fetch_add_int(&registry->swaps_pending, -1);
+                plugin_name = registry->entries[i]->plugin_name;
+            }
+        }
+        if (plugin_name == NULL) {
+            reclaim_retired_plugins_locked(registry);
+        }
+        release_rule_set_write();
+        
+        if (plugin_name == NULL) {
+            return;
+        }
+        hot_swap_plugin(plugin_name);
+    }
+}
+
+/**
+ * @brief 关闭所有退役的旧库（注册表释放时） / Close all retired old libraries (when the registry is freed) / Alle stillgelegten alten Bibliotheken schließen (beim Freigeben der Registry)
+ */
+void free_retired_plugins(plugin_registry_t* registry) {
+    if (registry == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < registry->retired_count; i++) {
+        close_retired_plugin(&registry->retired[i]);
+    }
+    free(registry->retired);
+    registry->retired = NULL;
+    registry->retired_count = 0;
+    registry->retired_capacity = 0;
+}
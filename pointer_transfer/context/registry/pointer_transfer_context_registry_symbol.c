@@ -0,0 +1,88 @@
+/**
+ * @file pointer_transfer_context_registry_symbol.c
+ * @brief 插件注册表符号缓存 / Plugin Registry Symbol Cache / Symbol-Cache der Plugin-Registry
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "config_hash_calc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 在条目中查找已解析的符号 / Find resolved symbol in entry / Aufgelöstes Symbol im Eintrag suchen
+ */
+static plugin_symbol_entry_t* find_cached_plugin_symbol(plugin_registry_entry_t* entry, const char* symbol_name, uint64_t hash) {
+    for (size_t i = 0; i < entry->symbol_count; i++) {
+        if (entry->symbols[i].name_hash == hash && strcmp(entry->symbols[i].symbol_name, symbol_name) == 0) {
+            return &entry->symbols[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 记录已解析的插件符号 / Record resolved plugin symbol / Aufgelöstes Plugin-Symbol speichern
+ */
+int cache_plugin_registry_symbol(plugin_registry_entry_t* entry, const char* symbol_name, void* func_ptr) {
+    if (entry == NULL || symbol_name == NULL || func_ptr == NULL) {
+        return -1;
+    }
+    
+    uint64_t hash = hash_plugin_name(symbol_name);
+    plugin_symbol_entry_t* symbol = find_cached_plugin_symbol(entry, symbol_name, hash);
+    if (symbol != NULL) {
+        symbol->func_ptr = func_ptr;
+        return 0;
+    }
+    
+    if (entry->symbol_count >= entry->symbol_capacity) {
+        size_t new_capacity = entry->symbol_capacity == 0 ? INITIAL_PLUGIN_CAPACITY : entry->symbol_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < entry->symbol_capacity || new_capacity > SIZE_MAX / sizeof(plugin_symbol_entry_t)) {
+            internal_log_write("ERROR", "cache_plugin_registry_symbol: capacity overflow detected (current=%zu)", entry->symbol_capacity);
+            return -1;
+        }
+        plugin_symbol_entry_t* new_symbols = (plugin_symbol_entry_t*)realloc(entry->symbols, new_capacity * sizeof(plugin_symbol_entry_t));
+        if (new_symbols == NULL) {
+            internal_log_write("ERROR", "cache_plugin_registry_symbol: failed to allocate memory (new_capacity=%zu)", new_capacity);
+            return -1;
+        }
+        entry->symbols = new_symbols;
+        entry->symbol_capacity = new_capacity;
+    }
+    
+    const char* interned_name = intern_plugin_registry_string(symbol_name);
+    if (interned_name == NULL) {
+        return -1;
+    }
+    symbol = &entry->symbols[entry->symbol_count];
+    symbol->symbol_name = interned_name;
+    symbol->name_hash = hash;
+    symbol->func_ptr = func_ptr;
+    entry->symbol_count++;
+    return 0;
+}
+
+/**
+ * @brief 解析插件符号（结果缓存在条目中） / Resolve plugin symbol (result cached in the entry) / Plugin-Symbol auflösen (Ergebnis im Eintrag gecacht)
+ * @details 未找到的符号不缓存，下次重新查询 / Missing symbols are not cached and are looked up again next time / Fehlende Symbole werden nicht gecacht und beim nächsten Mal erneut gesucht
+ */
+void* resolve_plugin_registry_symbol(plugin_registry_entry_t* entry, const char* symbol_name) {
+    if (entry == NULL || entry->handle == NULL || symbol_name == NULL) {
+        return NULL;
+    }
+    
+    plugin_symbol_entry_t* symbol = find_cached_plugin_symbol(entry, symbol_name, hash_plugin_name(symbol_name));
+    if (symbol != NULL) {
+        return symbol->func_ptr;
+    }
+    
+    void* func_ptr = pt_platform_get_symbol(entry->handle, symbol_name);
+    if (func_ptr != NULL && cache_plugin_registry_symbol(entry, symbol_name, func_ptr) != 0) {
+        /* 缓存失败不影响调用 / A failed cache insert does not affect the call / Fehlgeschlagenes Cachen beeinflusst den Aufruf nicht */
+        internal_log_write("WARNING", "resolve_plugin_registry_symbol: failed to cache %s of %s", symbol_name, entry->plugin_name);
+    }
+    return func_ptr;
+}
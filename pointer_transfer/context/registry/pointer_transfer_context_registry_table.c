@@ -0,0 +1,197 @@
+/**
+ * @file pointer_transfer_context_registry_table.c
+ * @brief 插件注册表哈希表管理 / Plugin Registry Hash Table Management / Hash-Tabellenverwaltung der Plugin-Registry
+ */
+
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "config_hash_calc.h"
+#include "../../config/arena/config_string_arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 线性探测查找名称所在槽位 / Linear-probe for the slot holding a name / Slot eines Namens per linearer Sondierung suchen
+ * @return 命中的槽位或可插入的空槽位 / Matching slot or the empty slot to insert into / Passender Slot oder leerer Slot zum Einfügen
+ */
+static size_t probe_plugin_registry_slot(const plugin_registry_t* registry, const char* plugin_name, uint64_t hash) {
+    size_t mask = registry->slot_count - 1;
+    size_t slot = (size_t)hash & mask;
+    while (registry->slots[slot] != 0) {
+        const plugin_registry_entry_t* entry = registry->entries[registry->slots[slot] - 1];
+        if (entry->name_hash == hash && strcmp(entry->plugin_name, plugin_name) == 0) {
+            return slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * @brief 扩大槽位表并重新放置所有条目 / Grow slot table and re-place all entries / Slot-Tabelle vergrößern und alle Einträge neu platzieren
+ */
+static int grow_plugin_registry_slots(plugin_registry_t* registry) {
+    size_t new_count = registry->slot_count == 0 ? INITIAL_PLUGIN_CAPACITY * 2 : registry->slot_count * CAPACITY_GROWTH_FACTOR;
+    if (new_count < registry->slot_count || new_count > SIZE_MAX / sizeof(size_t)) {
+        internal_log_write("ERROR", "grow_plugin_registry_slots: capacity overflow detected (current=%zu)", registry->slot_count);
+        return -1;
+    }
+    
+    size_t* new_slots = (size_t*)calloc(new_count, sizeof(size_t));
+    if (new_slots == NULL) {
+        internal_log_write("ERROR", "grow_plugin_registry_slots: failed to allocate %zu slots", new_count);
+        return -1;
+    }
+    
+    size_t mask = new_count - 1;
+    for (size_t i = 0; i < registry->count; i++) {
+        size_t slot = (size_t)registry->entries[i]->name_hash & mask;
+        while (new_slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        new_slots[slot] = i + 1;
+    }
+    
+    free(registry->slots);
+    registry->slots = new_slots;
+    registry->slot_count = new_count;
+    return 0;
+}
+
+/**
+ * @brief 扩展条目指针数组 / Expand entry pointer array / Eintragszeiger-Array erweitern
+ */
+static int grow_plugin_registry_entries(plugin_registry_t* registry) {
+    size_t new_capacity = registry->capacity == 0 ? INITIAL_PLUGIN_CAPACITY : registry->capacity * CAPACITY_GROWTH_FACTOR;
+    if (new_capacity < registry->capacity || new_capacity > SIZE_MAX / sizeof(plugin_registry_entry_t*)) {
+        internal_log_write("ERROR", "grow_plugin_registry_entries: capacity overflow detected (current=%zu)", registry->capacity);
+        return -1;
+    }
+    
+    plugin_registry_entry_t** new_entries = (plugin_registry_entry_t**)realloc(registry->entries, new_capacity * sizeof(plugin_registry_entry_t*));
+    if (new_entries == NULL) {
+        internal_log_write("ERROR", "grow_plugin_registry_entries: failed to allocate memory (new_capacity=%zu)", new_capacity);
+        return -1;
+    }
+    
+    registry->entries = new_entries;
+    registry->capacity = new_capacity;
+    return 0;
+}
+
+/**
+ * @brief 查找插件注册表条目 / Find plugin registry entry / Plugin-Registry-Eintrag suchen
+ */
+plugin_registry_entry_t* find_plugin_registry_entry(const char* plugin_name) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || plugin_name == NULL || ctx->plugin_registry.count == 0) {
+        return NULL;
+    }
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    size_t slot = probe_plugin_registry_slot(registry, plugin_name, hash_plugin_name(plugin_name));
+    return registry->slots[slot] != 0 ? registry->entries[registry->slots[slot] - 1] : NULL;
+}
+
+/**
+ * @brief 在注册表字符串内存区中驻留字符串 / Intern string in the registry string arena / Zeichenfolge in der Zeichenfolgen-Arena der Registry internieren
+ */
+const char* intern_plugin_registry_string(const char* str) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || str == NULL) {
+        return NULL;
+    }
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    if (registry->strings == NULL) {
+        registry->strings = create_config_string_arena();
+        if (registry->strings == NULL) {
+            internal_log_write("ERROR", "intern_plugin_registry_string: failed to create string arena");
+            return NULL;
+        }
+    }
+    return intern_config_string((config_string_arena_t*)registry->strings, str, strlen(str));
+}
+
+/**
+ * @brief 查找或创建插件注册表条目 / Find or create plugin registry entry / Plugin-Registry-Eintrag suchen oder erstellen
+ * @details 条目单独分配，扩容只移动指针数组 / Entries are allocated individually, growth only moves the pointer array / Einträge werden einzeln zugewiesen, Wachstum verschiebt nur das Zeiger-Array
+ */
+plugin_registry_entry_t* get_or_create_plugin_registry_entry(const char* plugin_name) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || plugin_name == NULL) {
+        return NULL;
+    }
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    uint64_t hash = hash_plugin_name(plugin_name);
+    if (registry->slot_count != 0) {
+        size_t slot = probe_plugin_registry_slot(registry, plugin_name, hash);
+        if (registry->slots[slot] != 0) {
+            return registry->entries[registry->slots[slot] - 1];
+        }
+    }
+    
+    /* 负载因子保持在1/2以下 / Keep the load factor below 1/2 / Ladefaktor unter 1/2 halten */
+    if ((registry->count + 1) * 2 > registry->slot_count && grow_plugin_registry_slots(registry) != 0) {
+        return NULL;
+    }
+    if (registry->count >= registry->capacity && grow_plugin_registry_entries(registry) != 0) {
+        return NULL;
+    }
+    
+    plugin_registry_entry_t* entry = (plugin_registry_entry_t*)calloc(1, sizeof(plugin_registry_entry_t));
+    if (entry == NULL) {
+        internal_log_write("ERROR", "get_or_create_plugin_registry_entry: failed to allocate entry for %s", plugin_name);
+        return NULL;
+    }
+    entry->plugin_name = intern_plugin_registry_string(plugin_name);
+    if (entry->plugin_name == NULL) {
+        free(entry);
+        return NULL;
+    }
+    entry->name_hash = hash;
+    
+    size_t slot = probe_plugin_registry_slot(registry, plugin_name, hash);
+    registry->entries[registry->count] = entry;
+    registry->count++;
+    registry->slots[slot] = registry->count;
+    return entry;
+}
+
+/**
+ * @brief 释放插件注册表并关闭已加载的库 / Free plugin registry and close loaded libraries / Plugin-Registry freigeben und geladene Bibliotheken schließen
+ */
+void free_plugin_registry(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return;
+    }
+    
+    plugin_registry_t* registry = &ctx->plugin_registry;
+    if (registry->total_unloads > 0) {
+        internal_log_write("INFO", "Releasing plugin registry: %zu plugins, %zu resident, %llu loads, %llu unloads",
+                          registry->count, registry->resident_count,
+                          (unsigned long long)registry->total_loads, (unsigned long long)registry->total_unloads);
+    }
+    for (size_t i = 0; i < registry->count; i++) {
+        plugin_registry_entry_t* entry = registry->entries[i];
+        if (entry->handle != NULL) {
+            pt_platform_close_library(entry->handle);
+        }
+        if (entry->shadow_path != NULL) {
+            remove(entry->shadow_path);
+            free(entry->shadow_path);
+        }
+        free(entry->symbols);
+        free(entry);
+    }
+    free_retired_plugins(registry);
+    free(registry->entries);
+    free(registry->slots);
+    destroy_config_string_arena((config_string_arena_t*)registry->strings);
+    memset(registry, 0, sizeof(plugin_registry_t));
+}
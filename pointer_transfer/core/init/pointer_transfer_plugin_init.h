@@ -0,0 +1,57 @@
+/**
+ * @file core/init/pointer_transfer_plugin_init.h
+ * @brief 插件初始化内部接口 / Plugin Initialization Internal Interface / Interne Schnittstelle der Plugin-Initialisierung
+ */
+
+#ifndef POINTER_TRANSFER_PLUGIN_INIT_H
+#define POINTER_TRANSFER_PLUGIN_INIT_H
+
+#include "pointer_transfer_plugin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 插件基础初始化（构造函数中执行，只做轻量工作） / Plugin basic setup (runs in the constructor, trivial work only) / Plugin-Grundeinrichtung (läuft im Konstruktor, nur leichte Arbeit)
+ */
+void plugin_setup(void);
+
+/**
+ * @brief 加载插件配置、链式加载规则并启动监视和预加载 / Load plugin config, chain-load rules and start watching and preloading / Plugin-Konfiguration laden, Regeln kettenweise laden sowie Überwachung und Vorladen starten
+ * @param config_path 配置文件路径，NULL时使用库旁的.nxpt文件 / Config file path, NULL uses the .nxpt file next to the library / Konfigurationsdateipfad, NULL verwendet die .nxpt-Datei neben der Bibliothek
+ * @param has_entry_out 输出是否配置了入口插件 / Outputs whether an entry plugin is configured / Gibt aus, ob ein Einstiegs-Plugin konfiguriert ist
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int load_plugin_config(const char* config_path, int* has_entry_out);
+
+/**
+ * @brief 自动运行入口插件接口 / Auto-run entry plugin interface / Einstiegs-Plugin-Schnittstelle automatisch ausführen
+ */
+void run_entry_auto_run(void);
+
+/**
+ * @brief 初始化互斥锁（构造函数中调用） / Initialize the mutex (called from the constructor) / Mutex initialisieren (im Konstruktor aufgerufen)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int init_plugin_init_lock(void);
+
+/**
+ * @brief 开始初始化（幂等） / Start initialization (idempotent) / Initialisierung starten (idempotent)
+ * @param options 初始化选项，NULL使用默认值 / Initialization options, NULL uses defaults / Initialisierungsoptionen, NULL verwendet Standardwerte
+ * @param async 非0在后台线程加载 / Non-zero loads on a background thread / Ungleich 0 lädt in einem Hintergrundthread
+ * @return 同步时返回初始化结果；异步时启动成功返回0 / Returns the initialization result when synchronous; 0 once started when asynchronous / Gibt synchron das Initialisierungsergebnis zurück; asynchron 0 nach dem Start
+ */
+int start_plugin_init(const pointer_transfer_init_options_t* options, int async);
+
+/**
+ * @brief 获取初始化结果 / Get initialization result / Initialisierungsergebnis abrufen
+ * @return 成功返回0，失败或未开始返回-1 / Returns 0 on success, -1 on failure or if not started / Gibt 0 bei Erfolg zurück, -1 bei Fehler oder wenn nicht gestartet
+ */
+int get_plugin_init_result(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POINTER_TRANSFER_PLUGIN_INIT_H */
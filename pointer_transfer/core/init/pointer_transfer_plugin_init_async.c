@@ -0,0 +1,244 @@
+/**
+ * @file pointer_transfer_plugin_init_async.c
+ * @brief 延迟和异步初始化及就绪屏障 / Deferred and Asynchronous Initialization and Readiness Barrier / Verzögerte und asynchrone Initialisierung und Bereitschaftsbarriere
+ */
+
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_plugin_init.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 初始化状态 / Initialization states / Initialisierungszustände */
+#define PLUGIN_INIT_NOT_STARTED 0
+#define PLUGIN_INIT_LOADING     1
+#define PLUGIN_INIT_READY       2
+
+/* 当前初始化状态（调用路径的快速检查） / Current initialization state (fast check on the call path) / Aktueller Initialisierungszustand (schnelle Prüfung im Aufrufpfad) */
+static volatile int g_init_state = PLUGIN_INIT_NOT_STARTED;
+
+/* 初始化结果 / Initialization result / Initialisierungsergebnis */
+static volatile int g_init_result = -1;
+
+/* 后台加载线程 / Background loading thread / Hintergrund-Ladethread */
+static pt_platform_thread_t* g_init_thread = NULL;
+
+/* 自动运行线程（就绪后启动，不阻塞屏障） / Auto-run thread (started once ready, never holds the barrier) / Autostart-Thread (nach Bereitschaft gestartet, hält die Barriere nie auf) */
+static pt_platform_thread_t* g_auto_run_thread = NULL;
+
+/* 保护初始化状态和线程句柄的互斥锁，进程生命周期内保留 / Mutex guarding initialization state and thread handles, kept for the process lifetime / Mutex für Initialisierungszustand und Thread-Handles, bleibt für die Prozesslebensdauer */
+static pt_platform_mutex_t* g_init_mutex = NULL;
+
+/* 初始化选项副本 / Copy of the initialization options / Kopie der Initialisierungsoptionen */
+static char* g_init_config_path = NULL;
+static int g_init_skip_auto_run = 0;
+
+/* 当前线程正在加载（加载期间回调进来的调用不等待自己） / The current thread is loading (calls re-entering during loading do not wait for themselves) / Der aktuelle Thread lädt (während des Ladens wieder eintretende Aufrufe warten nicht auf sich selbst) */
+static PT_THREAD_LOCAL int g_is_loading_thread = 0;
+
+/**
+ * @brief 初始化互斥锁（构造函数中调用） / Initialize the mutex (called from the constructor) / Mutex initialisieren (im Konstruktor aufgerufen)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int init_plugin_init_lock(void) {
+    if (g_init_mutex == NULL) {
+        g_init_mutex = pt_platform_mutex_create();
+    }
+    if (g_init_mutex == NULL) {
+        internal_log_write("ERROR", "init_plugin_init_lock: failed to create initialization lock");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 加载配置并标记就绪 / Load configuration and mark ready / Konfiguration laden und als bereit markieren
+ * @return 需要自动运行返回1，否则返回0 / Returns 1 if auto-run is due, 0 otherwise / Gibt 1 zurück, wenn Autostart fällig ist, sonst 0
+ */
+static int load_and_mark_ready(void) {
+    int64_t start_us = pt_platform_get_monotonic_us();
+    int has_entry = 0;
+    g_is_loading_thread = 1;
+    int result = load_plugin_config(g_init_config_path, &has_entry);
+    g_is_loading_thread = 0;
+    internal_log_write("INFO", "Dispatcher initialization %s in %lld ms", result == 0 ? "finished" : "failed",
+                      (long long)((pt_platform_get_monotonic_us() - start_us) / 1000));
+    
+    pt_platform_atomic_store_int(&g_init_result, result);
+    pt_platform_atomic_store_int(&g_init_state, PLUGIN_INIT_READY);
+    return has_entry && !g_init_skip_auto_run;
+}
+
+/**
+ * @brief 自动运行线程主函数 / Auto-run thread main function / Hauptfunktion des Autostart-Threads
+ */
+static void auto_run_thread_main(void* arg) {
+    (void)arg;
+    run_entry_auto_run();
+}
+
+/**
+ * @brief 加载线程主函数 / Loading thread main function / Hauptfunktion des Ladethreads
+ * @details 自动运行可能持续很久，因此放到独立线程，屏障只等待加载 / Auto-run may last long, so it gets its own thread and the barrier only waits for loading / Der Autostart kann lange dauern, daher bekommt er einen eigenen Thread und die Barriere wartet nur auf das Laden
+ */
+static void init_thread_main(void* arg) {
+    (void)arg;
+    if (!load_and_mark_ready()) {
+        return;
+    }
+    
+    /* 由finish_plugin_init在本线程结束后读取 / Read by finish_plugin_init only after this thread was joined / Wird von finish_plugin_init erst nach dem Beitritt dieses Threads gelesen */
+    g_auto_run_thread = pt_platform_thread_create(auto_run_thread_main, NULL);
+    if (g_auto_run_thread == NULL) {
+        internal_log_write("WARNING", "init_thread_main: failed to create auto-run thread, auto-running on the loading thread");
+        auto_run_thread_main(NULL);
+    }
+}
+
+/**
+ * @brief 开始初始化（幂等） / Start initialization (idempotent) / Initialisierung starten (idempotent)
+ * @param options 初始化选项，NULL使用默认值 / Initialization options, NULL uses defaults / Initialisierungsoptionen, NULL verwendet Standardwerte
+ * @param async 非0在后台线程加载 / Non-zero loads on a background thread / Ungleich 0 lädt in einem Hintergrundthread
+ * @return 同步时返回初始化结果；异步时启动成功返回0 / Returns the initialization result when synchronous; 0 once started when asynchronous / Gibt synchron das Initialisierungsergebnis zurück; asynchron 0 nach dem Start
+ * @details 已开始的初始化保持原有选项 / An initialization already under way keeps its original options / Eine bereits begonnene Initialisierung behält ihre ursprünglichen Optionen
+ */
+int start_plugin_init(const pointer_transfer_init_options_t* options, int async) {
+    if (g_init_mutex == NULL && init_plugin_init_lock() != 0) {
+        return -1;
+    }
+    if (options != NULL && options->struct_size < sizeof(pointer_transfer_init_options_t)) {
+        internal_log_write("ERROR", "start_plugin_init: unsupported options structure size %zu", options->struct_size);
+        return -1;
+    }
+    
+    pt_platform_mutex_lock(g_init_mutex);
+    if (pt_platform_atomic_load_int(&g_init_state) != PLUGIN_INIT_NOT_STARTED) {
+        pt_platform_mutex_unlock(g_init_mutex);
+        if (options != NULL) {
+            internal_log_write("WARNING", "start_plugin_init: already initialized, options ignored");
+        }
+        if (async) {
+            return 0;
+        }
+        wait_for_plugin_init();
+        return pt_platform_atomic_load_int(&g_init_result);
+    }
+    
+    if (options != NULL && options->config_path != NULL) {
+        g_init_config_path = allocate_string(options->config_path);
+        if (g_init_config_path == NULL) {
+            pt_platform_mutex_unlock(g_init_mutex);
+            return -1;
+        }
+    }
+    g_init_skip_auto_run = options != NULL && options->skip_auto_run;
+    pt_platform_atomic_store_int(&g_init_state, PLUGIN_INIT_LOADING);
+    
+    if (async) {
+        g_init_thread = pt_platform_thread_create(init_thread_main, NULL);
+        if (g_init_thread != NULL) {
+            pt_platform_mutex_unlock(g_init_mutex);
+            return 0;
+        }
+        internal_log_write("WARNING", "start_plugin_init: failed to create initialization thread, initializing synchronously");
+    }
+    
+    /* 同步加载期间持锁，并发调用在屏障处等待 / Hold the lock while loading synchronously so concurrent calls wait at the barrier / Sperre beim synchronen Laden halten, damit gleichzeitige Aufrufe an der Barriere warten */
+    int auto_run = load_and_mark_ready();
+    pt_platform_mutex_unlock(g_init_mutex);
+    if (auto_run) {
+        auto_run_thread_main(NULL);
+    }
+    return async ? 0 : pt_platform_atomic_load_int(&g_init_result);
+}
+
+/**
+ * @brief 等待初始化加载完成（就绪屏障） / Wait for initialization loading to finish (readiness barrier) / Auf Abschluss des Initialisierungsladens warten (Bereitschaftsbarriere)
+ * @details 未在加载时只做一次原子读取；不等待自动运行 / Costs a single atomic read when nothing is loading; does not wait for auto-run / Kostet nur einen atomaren Lesezugriff, wenn nichts geladen wird; wartet nicht auf den Autostart
+ */
+void wait_for_plugin_init(void) {
+    if (pt_platform_atomic_load_int(&g_init_state) != PLUGIN_INIT_LOADING || g_is_loading_thread) {
+        return;
+    }
+    
+    pt_platform_mutex_lock(g_init_mutex);
+    if (g_init_thread != NULL) {
+        pt_platform_thread_join(g_init_thread);
+        g_init_thread = NULL;
+    }
+    pt_platform_mutex_unlock(g_init_mutex);
+}
+
+/**
+ * @brief 确保已初始化（导出接口入口处调用） / Ensure initialization (called at exported entry points) / Initialisierung sicherstellen (an exportierten Einstiegspunkten aufgerufen)
+ * @details 宿主延迟初始化但未调用PointerTransferInitialize时按默认选项同步初始化 / Initializes synchronously with default options when the host deferred initialization but never called PointerTransferInitialize / Initialisiert synchron mit Standardoptionen, wenn der Host die Initialisierung verzögert, aber PointerTransferInitialize nie aufgerufen hat
+ */
+void ensure_plugin_init(void) {
+    int state = pt_platform_atomic_load_int(&g_init_state);
+    if (state == PLUGIN_INIT_READY) {
+        return;
+    }
+    if (state == PLUGIN_INIT_NOT_STARTED) {
+        start_plugin_init(NULL, 0);
+        return;
+    }
+    wait_for_plugin_init();
+}
+
+/**
+ * @brief 获取初始化结果 / Get initialization result / Initialisierungsergebnis abrufen
+ * @return 成功返回0，失败或未开始返回-1 / Returns 0 on success, -1 on failure or if not started / Gibt 0 bei Erfolg zurück, -1 bei Fehler oder wenn nicht gestartet
+ */
+int get_plugin_init_result(void) {
+    if (pt_platform_atomic_load_int(&g_init_state) != PLUGIN_INIT_READY) {
+        return -1;
+    }
+    return pt_platform_atomic_load_int(&g_init_result);
+}
+
+/**
+ * @brief 结束初始化线程（清理前调用） / Finish initialization threads (called before cleanup) / Initialisierungsthreads beenden (vor der Bereinigung aufgerufen)
+ * @details 等待加载线程和自动运行线程 / Waits for the loading thread and the auto-run thread / Wartet auf den Ladethread und den Autostart-Thread
+ */
+void finish_plugin_init(void) {
+    if (g_init_mutex == NULL) {
+        return;
+    }
+    
+    pt_platform_mutex_lock(g_init_mutex);
+    if (g_init_thread != NULL) {
+        pt_platform_thread_join(g_init_thread);
+        g_init_thread = NULL;
+    }
+    if (g_auto_run_thread != NULL) {
+        pt_platform_thread_join(g_auto_run_thread);
+        g_auto_run_thread = NULL;
+    }
+    free(g_init_config_path);
+    g_init_config_path = NULL;
+    pt_platform_mutex_unlock(g_init_mutex);
+}
+
+/**
+ * @brief 检查宿主是否要求延迟初始化 / Check whether the host asked for deferred initialization / Prüfen, ob der Host eine verzögerte Initialisierung verlangt
+ * @details 设置POINTER_TRANSFER_DEFER_INIT=1后构造函数不开始加载 / With POINTER_TRANSFER_DEFER_INIT=1 the constructor does not start loading / Mit POINTER_TRANSFER_DEFER_INIT=1 startet der Konstruktor das Laden nicht
+ */
+static int is_plugin_init_deferred(void) {
+    const char* value = getenv("POINTER_TRANSFER_DEFER_INIT");
+    return value != NULL && value[0] != '\0' && strcmp(value, "0") != 0;
+}
+
+/**
+ * @brief 插件初始化函数（库加载时调用） / Plugin initialization function (called when the library is loaded) / Plugin-Initialisierungsfunktion (beim Laden der Bibliothek aufgerufen)
+ * @details 只做轻量设置并启动后台加载，不在加载器锁下等待 / Does trivial setup and starts background loading only, never waiting under the loader lock / Erledigt nur leichte Einrichtung und startet das Hintergrundladen, ohne unter der Loader-Sperre zu warten
+ */
+void plugin_init(void) {
+    plugin_setup();
+    if (is_plugin_init_deferred()) {
+        internal_log_write("INFO", "Dispatcher initialization deferred until PointerTransferInitialize");
+        return;
+    }
+    start_plugin_init(NULL, 1);
+}
@@ -9,6 +9,12 @@
 #include "pointer_transfer_plugin.h"
 #include "pointer_transfer_utils.h"
 #include "pointer_transfer_platform.h"
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_plugin_init.h"
+#include "pointer_transfer_interface.h"
+#include "config/reload/config_reload.h"
+#include "config/tokenizer/config_tokenizer.h"
+#include "config/common/config_errors.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -19,10 +25,14 @@
 #endif
 
 /**
- * @brief 插件初始化函数 / Plugin initialization function / Plugin-Initialisierungsfunktion
+ * @brief 插件基础初始化（构造函数中执行，只做轻量工作） / Plugin basic setup (runs in the constructor, trivial work only) / Plugin-Grundeinrichtung (läuft im Konstruktor, nur leichte Arbeit)
  */
-void plugin_init(void) {
+void plugin_setup(void) {
     init_context();
+    init_rule_set_lock();
+    init_validation_db_lock();
+    init_plugin_init_lock();
+    init_call_frame_pool_lock();
     
     size_t dll_path_size = 4096;
     char* dll_path = (char*)malloc(dll_path_size);
@@ -39,54 +49,104 @@ void plugin_init(void) {
     ctx->plugin_dll_path = allocate_string(dll_path);
     if (ctx->plugin_dll_path == NULL) {
         internal_log_write("ERROR", "Failed to allocate memory for plugin DLL path");
-        free(dll_path);
-        return;
+    }
+    free(dll_path);
+}
+
+/**
+ * @brief 加载插件配置、链式加载规则并启动监视和预加载 / Load plugin config, chain-load rules and start watching and preloading / Plugin-Konfiguration laden, Regeln kettenweise laden sowie Überwachung und Vorladen starten
+ * @param config_path 配置文件路径，NULL时使用库旁的.nxpt文件 / Config file path, NULL uses the .nxpt file next to the library / Konfigurationsdateipfad, NULL verwendet die .nxpt-Datei neben der Bibliothek
+ * @param has_entry_out 输出是否配置了入口插件 / Outputs whether an entry plugin is configured / Gibt aus, ob ein Einstiegs-Plugin konfiguriert ist
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int load_plugin_config(const char* config_path, int* has_entry_out) {
+    if (has_entry_out != NULL) {
+        *has_entry_out = 0;
+    }
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || (config_path == NULL && ctx->plugin_dll_path == NULL)) {
+        return -1;
+    }
+    
+    /* 键哈希冲突会让配置键被静默忽略，加载前报错 / A key hash collision would silently ignore a config key, fail before loading / Eine Schlüssel-Hash-Kollision würde einen Konfigurationsschlüssel still ignorieren, vor dem Laden abbrechen */
+    if (verify_config_key_table() != 0) {
+        internal_log_write("ERROR", "Config key hash table is inconsistent, refusing to load configuration");
+        return -1;
+    }
+    
+    char* nxpt_path = NULL;
+    if (config_path != NULL) {
+        nxpt_path = allocate_string(config_path);
+    } else {
+        size_t nxpt_path_size = strlen(ctx->plugin_dll_path) + 10;
+        nxpt_path = (char*)malloc(nxpt_path_size);
+        if (nxpt_path != NULL && build_nxpt_path(ctx->plugin_dll_path, nxpt_path, nxpt_path_size) != 0) {
+            free(nxpt_path);
+            nxpt_path = NULL;
+        }
+    }
+    if (nxpt_path == NULL) {
+        return -1;
     }
     
-    size_t nxpt_path_size = strlen(dll_path) + 10;
-    char* nxpt_path = (char*)malloc(nxpt_path_size);
-    if (nxpt_path != NULL) {
-        if (build_nxpt_path(dll_path, nxpt_path, nxpt_path_size) == 0) {
-            /* 加载插件配置文件本身的规则 / Load plugin config file's own rules / Eigene Regeln der Plugin-Konfigurationsdatei laden */
-            load_transfer_rules(nxpt_path);
+    /* 初始加载期间只在最后构建一次规则图 / Build the rule graph only once at the end of initial loading / Regelgraph beim initialen Laden nur einmal am Ende aufbauen */
+    begin_rule_batch();
+    
+    /* 单次扫描加载插件配置文件本身的规则和入口配置 / Load plugin config file's own rules and entry configuration in a single pass / Eigene Regeln und Einstiegskonfiguration der Plugin-Konfigurationsdatei in einem Durchlauf laden */
+    int entry_result = CONFIG_ERR_INCOMPLETE;
+    int result = load_transfer_rules_with_entry(nxpt_path, &entry_result);
+    if (entry_result == 0 && ctx->entry_nxpt_path != NULL) {
+        internal_log_write("INFO", "Loading entry plugin .nxpt file: %s", ctx->entry_nxpt_path);
+        if (load_transfer_rules(ctx->entry_nxpt_path) == 0) {
+            mark_nxpt_loaded(ctx->entry_plugin_name, ctx->entry_nxpt_path);
             
-            if (parse_entry_plugin_config(nxpt_path) == 0) {
-                if (ctx->entry_nxpt_path != NULL) {
-                    internal_log_write("INFO", "Loading entry plugin .nxpt file: %s", ctx->entry_nxpt_path);
-                    if (load_transfer_rules(ctx->entry_nxpt_path) == 0) {
-                        mark_nxpt_loaded(ctx->entry_plugin_name, ctx->entry_nxpt_path);
-                        
-                        size_t entry_rule_count = ctx->rule_count;
-                        for (size_t i = 0; i < entry_rule_count; i++) {
-                            pointer_transfer_rule_t* rule = &ctx->rules[i];
-                            if (rule->enabled && rule->target_plugin != NULL && rule->target_plugin_path != NULL) {
-                                if (!is_nxpt_loaded(rule->target_plugin)) {
-                                    chain_load_plugin_nxpt(rule->target_plugin, rule->target_plugin_path);
-                                }
-                            }
-                        }
-                    }
-                }
-                
-                /* 自动运行入口插件接口 / Auto-run entry plugin interface / Einstiegs-Plugin-Schnittstelle automatisch ausführen */
-                if (ctx->entry_plugin_name != NULL && ctx->entry_plugin_path != NULL && ctx->entry_auto_run_interface != NULL) {
-                    void* entry_handle = load_target_plugin(ctx->entry_plugin_name, ctx->entry_plugin_path);
-                    if (entry_handle != NULL) {
-                        void* auto_run_func = pt_platform_get_symbol(entry_handle, ctx->entry_auto_run_interface);
-                        if (auto_run_func != NULL) {
-                            typedef int32_t (NXLD_PLUGIN_CALL *AutoRunFunc)(void*);
-                            AutoRunFunc auto_run = (AutoRunFunc)auto_run_func;
-                            int32_t return_value = auto_run(NULL);
-                            
-                            CallPlugin(ctx->entry_plugin_name, ctx->entry_auto_run_interface, -1, &return_value);
-                        }
+            size_t entry_rule_count = ctx->rule_count;
+            for (size_t i = 0; i < entry_rule_count; i++) {
+                pointer_transfer_rule_t* rule = &ctx->rules[i];
+                if (rule->enabled && rule->target_plugin != NULL && rule->target_plugin_path != NULL) {
+                    if (!is_nxpt_loaded(rule->target_plugin)) {
+                        chain_load_plugin_nxpt(rule->target_plugin, rule->target_plugin_path);
                     }
                 }
             }
         }
-        free(nxpt_path);
     }
+    end_rule_batch();
+    free(nxpt_path);
     
-    free(dll_path);
+    if (entry_result == 0) {
+        /* 链式加载完成后开始监视规则文件 / Start watching rule files once chain loading is done / Überwachung der Regeldateien nach Abschluss des Kettenladens starten */
+        start_rule_watcher();
+        
+        /* 后台预加载目标插件，首次调用在就绪屏障处等待 / Preload target plugins in background, the first call waits at the readiness barrier / Ziel-Plugins im Hintergrund vorladen, der erste Aufruf wartet an der Bereitschaftsbarriere */
+        start_plugin_preload();
+        
+        if (has_entry_out != NULL) {
+            *has_entry_out = 1;
+        }
+    }
+    return result == 0 ? 0 : -1;
 }
 
+/**
+ * @brief 自动运行入口插件接口 / Auto-run entry plugin interface / Einstiegs-Plugin-Schnittstelle automatisch ausführen
+ */
+void run_entry_auto_run(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->entry_plugin_name == NULL || ctx->entry_plugin_path == NULL || ctx->entry_auto_run_interface == NULL) {
+        return;
+    }
+    
+    void* entry_handle = load_target_plugin(ctx->entry_plugin_name, ctx->entry_plugin_path);
+    if (entry_handle == NULL) {
+        return;
+    }
+    void* auto_run_func = pt_platform_get_symbol(entry_handle, ctx->entry_auto_run_interface);
+    if (auto_run_func != NULL) {
+        typedef int32_t (NXLD_PLUGIN_CALL *AutoRunFunc)(void*);
+        AutoRunFunc auto_run = (AutoRunFunc)auto_run_func;
+        int32_t return_value = auto_run(NULL);
+        
+        CallPlugin(ctx->entry_plugin_name, ctx->entry_auto_run_interface, -1, &return_value);
+    }
+}
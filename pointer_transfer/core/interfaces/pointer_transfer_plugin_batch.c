@@ -0,0 +1,130 @@
+/**
+ * @file pointer_transfer_plugin_batch.c
+ * @brief 批量传递接口实现 / Batch Transfer Interface Implementation / Implementierung der Batch-Übertragungsschnittstelle
+ */
+
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_types.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_interface.h"
+#include "rules/core/pointer_transfer_rule_matcher.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 按规则分发一批传递值 / Dispatch a batch of transfer values by rules / Einen Stapel von Übertragungswerten nach Regeln verteilen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param values 传递的值数组 / Transferred value array / Array der übertragenen Werte
+ * @param count 值数量 / Value count / Anzahl der Werte
+ */
+static void dispatch_transfer_batch(const char* source_plugin_name, const char* source_interface_name,
+                                    int source_param_index, const pt_typed_value_t* values, size_t count) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    acquire_prepared_rule_set();
+    if (ctx->rule_count > 0 && ctx->rules != NULL) {
+        size_t success_count = 0;
+        size_t start_index = 0;
+        size_t end_index = 0;
+        int use_index = find_rule_index_range(source_plugin_name, source_interface_name, source_param_index, &start_index, &end_index);
+        
+        size_t matched_count = apply_matched_rules_batch(source_plugin_name, source_interface_name, source_param_index,
+                                                         values, count, use_index, start_index, end_index, &success_count);
+        if (matched_count > 0) {
+            internal_log_write("INFO", "Processed %zu rule rows for %zu values, %zu successful", matched_count, count, success_count);
+        }
+    }
+    release_rule_set_read();
+    apply_pending_plugin_swaps();
+    evict_idle_plugins();
+}
+
+/**
+ * @brief 检查批量传递参数 / Check batch transfer arguments / Batch-Übertragungsargumente prüfen
+ */
+static int check_batch_arguments(const char* function_name, const char* source_plugin_name, const char* source_interface_name,
+                                 const void* values, size_t count) {
+    if (source_plugin_name == NULL || source_interface_name == NULL) {
+        internal_log_write("WARNING", "%s: received NULL source plugin or interface name", function_name);
+        return 0;
+    }
+    if (values == NULL && count > 0) {
+        internal_log_write("WARNING", "%s: received NULL values for %zu items", function_name, count);
+        return 0;
+    }
+    if (count > SIZE_MAX / sizeof(pt_typed_value_t)) {
+        internal_log_write("WARNING", "%s: batch of %zu items is too large", function_name, count);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief 批量按值传递64位整数 / Transfer a batch of 64-bit integers by value / Einen Stapel von 64-Bit-Ganzzahlen als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param values 整数数组 / Integer array / Ganzzahl-Array
+ * @param count 数量 / Count / Anzahl
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferInt64Batch(const char* source_plugin_name, const char* source_interface_name, int source_param_index, const int64_t* values, size_t count) {
+    if (!check_batch_arguments("TransferInt64Batch", source_plugin_name, source_interface_name, values, count)) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    
+    ensure_plugin_init();
+    
+    pt_typed_value_t* typed_values = (pt_typed_value_t*)malloc(count * sizeof(pt_typed_value_t));
+    if (typed_values == NULL) {
+        internal_log_write("ERROR", "TransferInt64Batch: failed to allocate %zu values", count);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        typed_values[i] = make_int64_value(values[i]);
+    }
+    
+    dispatch_transfer_batch(source_plugin_name, source_interface_name, source_param_index, typed_values, count);
+    free(typed_values);
+    return 0;
+}
+
+/**
+ * @brief 批量按值传递双精度浮点数 / Transfer a batch of doubles by value / Einen Stapel von Doubles als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param values 浮点数组 / Floating-point array / Gleitkomma-Array
+ * @param count 数量 / Count / Anzahl
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferDoubleBatch(const char* source_plugin_name, const char* source_interface_name, int source_param_index, const double* values, size_t count) {
+    if (!check_batch_arguments("TransferDoubleBatch", source_plugin_name, source_interface_name, values, count)) {
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    
+    ensure_plugin_init();
+    
+    pt_typed_value_t* typed_values = (pt_typed_value_t*)malloc(count * sizeof(pt_typed_value_t));
+    if (typed_values == NULL) {
+        internal_log_write("ERROR", "TransferDoubleBatch: failed to allocate %zu values", count);
+        return -1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        typed_values[i] = make_double_value(values[i]);
+    }
+    
+    dispatch_transfer_batch(source_plugin_name, source_interface_name, source_param_index, typed_values, count);
+    free(typed_values);
+    return 0;
+}
@@ -6,7 +6,10 @@
 #include "pointer_transfer_plugin.h"
 #include "pointer_transfer_types.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
 #include "pointer_transfer_utils.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_interface.h"
 #include "rules/core/pointer_transfer_rule_matcher.h"
 #include <stdlib.h>
 #include <string.h>
@@ -28,16 +31,25 @@ POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL CallPlugin(const
     internal_log_write("INFO", "CallPlugin: called with source_plugin=%s, source_interface=%s, param_index=%d", 
                   source_plugin_name, source_interface_name, param_index);
     
+    /* 调度器就绪前等待初始化 / Wait for initialization until the dispatcher is ready / Bis zur Bereitschaft des Dispatchers auf die Initialisierung warten */
+    ensure_plugin_init();
+    
+    /* 首次调用在预加载就绪后才访问接口状态 / The first call touches interface states only once preloading is ready / Der erste Aufruf greift erst nach Abschluss des Vorladens auf Schnittstellenstatus zu */
+    wait_for_plugin_preload();
+    
     pointer_transfer_context_t* ctx = get_global_context();
     
+    /* 目标在写锁下准备，随后持读锁查找状态和应用规则，防止规则集或状态数组在调用过程中被替换 / Targets are prepared under the write lock, then states are looked up and rules applied under read lock so neither the rule set nor the state array is replaced mid-call / Ziele werden unter der Schreibsperre vorbereitet, dann werden Status unter Lesesperre gesucht und Regeln angewendet, damit weder Regelsatz noch Status-Array während des Aufrufs ersetzt werden */
+    acquire_prepared_rule_set();
+    
     /* 如果param_index >= 0，尝试从已调用接口的参数状态中获取值 / If param_index >= 0, try to get value from parameter state of already called interface / Wenn param_index >= 0, versuche Wert aus Parameterstatus der bereits aufgerufenen Schnittstelle zu erhalten */
-    void* actual_param_value = param_value;
+    pt_typed_value_t actual_param_value = make_pointer_value(param_value, NXLD_PARAM_TYPE_UNKNOWN, 0);
     if (param_index >= 0) {
         target_interface_state_t* source_state = find_interface_state(source_plugin_name, source_interface_name);
         if (source_state != NULL && source_state->param_ready != NULL && 
             param_index < source_state->param_count && source_state->param_ready[param_index] &&
             source_state->param_values != NULL && source_state->param_values[param_index] != NULL) {
-            actual_param_value = source_state->param_values[param_index];
+            actual_param_value = get_parameter_typed_value((struct target_interface_state_s*)source_state, param_index);
             internal_log_write("INFO", "CallPlugin: got parameter %d value from interface state for %s.%s", 
                           param_index, source_plugin_name, source_interface_name);
         } else {
@@ -48,7 +60,6 @@ POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL CallPlugin(const
     
     size_t matched_count = 0;
     size_t success_count = 0;
-    
     if (ctx->rule_count > 0 && ctx->rules != NULL) {
         /* 使用索引定位匹配规则 / Use index to locate matching rules / Index verwenden, um übereinstimmende Regeln zu lokalisieren */
         size_t start_index = 0;
@@ -57,12 +68,17 @@ POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL CallPlugin(const
         
         if (use_index) {
             matched_count = apply_matched_rules_indexed(source_plugin_name, source_interface_name, 
-                                                         param_index, actual_param_value, start_index, end_index, &success_count);
+                                                         param_index, &actual_param_value, start_index, end_index, &success_count);
         } else {
             matched_count = apply_matched_rules_linear(source_plugin_name, source_interface_name, 
-                                                        param_index, actual_param_value, &success_count);
+                                                        param_index, &actual_param_value, &success_count);
         }
     }
+    release_rule_set_read();
+    
+    /* 调用边界上执行推迟的热替换并按驻留策略卸载空闲插件 / Run deferred hot swaps and evict idle plugins per residency policy at the call boundary / Verschobene Hot-Swaps ausführen und leerlaufende Plugins an der Aufrufgrenze gemäß Residenzrichtlinie entladen */
+    apply_pending_plugin_swaps();
+    evict_idle_plugins();
     
     if (matched_count == 0) {
         internal_log_write("WARNING", "CallPlugin: no matching rule found for %s.%s[%d]. Transfer rules must be configured in .nxpt file", source_plugin_name, source_interface_name, param_index);
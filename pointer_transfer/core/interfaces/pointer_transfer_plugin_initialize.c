@@ -0,0 +1,41 @@
+/**
+ * @file pointer_transfer_plugin_initialize.c
+ * @brief 显式初始化接口实现 / Explicit Initialization Interface Implementation / Implementierung der expliziten Initialisierungsschnittstelle
+ */
+
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+
+/**
+ * @brief 同步初始化调度器（幂等） / Initialize the dispatcher synchronously (idempotent) / Dispatcher synchron initialisieren (idempotent)
+ * @param options 初始化选项，NULL使用默认值 / Initialization options, NULL uses defaults / Initialisierungsoptionen, NULL verwendet Standardwerte
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL PointerTransferInitialize(const pointer_transfer_init_options_t* options) {
+    return start_plugin_init(options, 0) == 0 ? 0 : -1;
+}
+
+/**
+ * @brief 在后台线程初始化调度器（幂等） / Initialize the dispatcher on a background thread (idempotent) / Dispatcher in einem Hintergrundthread initialisieren (idempotent)
+ * @param options 初始化选项，NULL使用默认值 / Initialization options, NULL uses defaults / Initialisierungsoptionen, NULL verwendet Standardwerte
+ * @return 已开始返回0，失败返回-1 / Returns 0 once started, -1 on failure / Gibt 0 nach dem Start zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL PointerTransferInitializeAsync(const pointer_transfer_init_options_t* options) {
+    return start_plugin_init(options, 1) == 0 ? 0 : -1;
+}
+
+/**
+ * @brief 等待调度器就绪 / Wait until the dispatcher is ready / Warten, bis der Dispatcher bereit ist
+ * @return 初始化成功返回0，失败或未开始返回-1 / Returns 0 if initialization succeeded, -1 if it failed or was never started / Gibt 0 zurück, wenn die Initialisierung erfolgreich war, -1 bei Fehler oder wenn sie nie gestartet wurde
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL PointerTransferWaitReady(void) {
+    wait_for_plugin_init();
+    
+    int result = get_plugin_init_result();
+    if (result != 0) {
+        internal_log_write("WARNING", "PointerTransferWaitReady: dispatcher is not ready");
+    }
+    return result;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file pointer_transfer_plugin_reload.c
+ * @brief 规则重载和插件热替换接口实现 / Rule Reload and Plugin Hot Swap Interface Implementation / Implementierung der Schnittstellen für Regel-Neuladen und Plugin-Hot-Swap
+ */
+
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+
+/**
+ * @brief 重新加载传递规则 / Reload transfer rules / Übertragungsregeln neu laden
+ * @details 重新解析所有已加载的.nxpt文件并替换规则集；解析失败时保留当前规则 / Re-parses all loaded .nxpt files and swaps the rule set; keeps current rules if parsing fails / Parst alle geladenen .nxpt-Dateien neu und tauscht den Regelsatz aus; behält aktuelle Regeln bei Parse-Fehler
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL ReloadRules(void) {
+    internal_log_write("INFO", "ReloadRules: reload requested");
+    
+    ensure_plugin_init();
+    
+    if (reload_transfer_rules() != 0) {
+        internal_log_write("WARNING", "ReloadRules: reload failed");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 热替换目标插件库 / Hot-swap target plugin library / Ziel-Plugin-Bibliothek per Hot-Swap austauschen
+ * @details 从插件路径加载新版本并发布新的函数指针；进行中的调用继续使用旧库直到结束 / Loads the new version from the plugin path and publishes new function pointers; calls in flight keep using the old library until they finish / Lädt die neue Version vom Plugin-Pfad und veröffentlicht neue Funktionszeiger; laufende Aufrufe verwenden die alte Bibliothek bis zu ihrem Ende
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL ReloadPlugin(const char* plugin_name) {
+    if (plugin_name == NULL) {
+        internal_log_write("WARNING", "ReloadPlugin: plugin name is NULL");
+        return -1;
+    }
+    
+    internal_log_write("INFO", "ReloadPlugin: hot swap of %s requested", plugin_name);
+    ensure_plugin_init();
+    
+    if (hot_swap_plugin(plugin_name) != 0) {
+        internal_log_write("WARNING", "ReloadPlugin: hot swap of %s failed", plugin_name);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file pointer_transfer_plugin_rules.c
+ * @brief 运行时规则管理接口实现 / Runtime Rule Management Interface Implementation / Laufzeit-Regelverwaltungs-Schnittstellenimplementierung
+ */
+
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include <stddef.h>
+#include <limits.h>
+
+/**
+ * @brief 运行时添加传递规则 / Add transfer rule at runtime / Übertragungsregel zur Laufzeit hinzufügen
+ * @details 规则描述与.nxpt中[TransferRule_N]段的Key=Value行相同，以换行分隔；重载规则时不保留 / The specification uses the Key=Value lines of a [TransferRule_N] section in .nxpt, separated by newlines; not kept across ReloadRules / Die Beschreibung verwendet die Key=Value-Zeilen eines [TransferRule_N]-Abschnitts in .nxpt, durch Zeilenumbrüche getrennt; bleibt bei ReloadRules nicht erhalten
+ * @param rule_spec 规则描述 / Rule specification / Regelbeschreibung
+ * @return 成功返回新规则索引，失败返回-1 / Returns new rule index on success, -1 on failure / Gibt neuen Regelindex bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL AddTransferRule(const char* rule_spec) {
+    if (rule_spec == NULL) {
+        internal_log_write("WARNING", "AddTransferRule: rule_spec is NULL");
+        return -1;
+    }
+    
+    ensure_plugin_init();
+    
+    size_t rule_index = 0;
+    if (add_transfer_rule(rule_spec, &rule_index) != 0) {
+        internal_log_write("WARNING", "AddTransferRule: failed to add rule");
+        return -1;
+    }
+    if (rule_index > (size_t)INT_MAX) {
+        internal_log_write("WARNING", "AddTransferRule: rule index %zu exceeds int range", rule_index);
+        return -1;
+    }
+    return (int)rule_index;
+}
+
+/**
+ * @brief 运行时移除传递规则 / Remove transfer rule at runtime / Übertragungsregel zur Laufzeit entfernen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL RemoveTransferRule(int rule_index) {
+    if (rule_index < 0) {
+        internal_log_write("WARNING", "RemoveTransferRule: invalid rule index %d", rule_index);
+        return -1;
+    }
+    
+    ensure_plugin_init();
+    
+    return remove_transfer_rule((size_t)rule_index) == 0 ? 0 : -1;
+}
+
+/**
+ * @brief 设置规则启用状态 / Set rule enabled state / Aktivierungsstatus der Regel setzen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param enabled 非0启用，0禁用 / Non-zero enables, 0 disables / Ungleich 0 aktiviert, 0 deaktiviert
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL SetRuleEnabled(int rule_index, int enabled) {
+    if (rule_index < 0) {
+        internal_log_write("WARNING", "SetRuleEnabled: invalid rule index %d", rule_index);
+        return -1;
+    }
+    
+    ensure_plugin_init();
+    
+    return set_transfer_rule_enabled((size_t)rule_index, enabled) == 0 ? 0 : -1;
+}
@@ -6,11 +6,52 @@
 #include "pointer_transfer_plugin.h"
 #include "pointer_transfer_types.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
 #include "pointer_transfer_utils.h"
+#include "pointer_transfer_interface.h"
 #include "rules/core/pointer_transfer_rule_matcher.h"
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * @brief 按规则分发传递值 / Dispatch transfer value by rules / Übertragungswert nach Regeln verteilen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param value 传递的值 / Transferred value / Übertragener Wert
+ */
+static void dispatch_transfer_value(const char* source_plugin_name, const char* source_interface_name,
+                                    int source_param_index, const pt_typed_value_t* value) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 目标在写锁下准备，随后持读锁应用规则，防止规则集在传递过程中被重载替换 / Targets are prepared under the write lock, then rules are applied under read lock so the rule set cannot be swapped by a reload mid-transfer / Ziele werden unter der Schreibsperre vorbereitet, dann werden Regeln unter Lesesperre angewendet, damit der Regelsatz nicht während der Übertragung durch Neuladen ersetzt wird */
+    acquire_prepared_rule_set();
+    if (ctx->rule_count > 0 && ctx->rules != NULL) {
+        size_t matched_count = 0;
+        size_t success_count = 0;
+        
+        /* 使用索引查找匹配规则 / Use index to find matching rules / Index verwenden, um übereinstimmende Regeln zu finden */
+        size_t start_index = 0;
+        size_t end_index = 0;
+        int use_index = find_rule_index_range(source_plugin_name, source_interface_name, source_param_index, &start_index, &end_index);
+        
+        if (use_index) {
+            matched_count = apply_matched_rules_indexed(source_plugin_name, source_interface_name, 
+                                                         source_param_index, value, start_index, end_index, &success_count);
+        } else {
+            matched_count = apply_matched_rules_linear(source_plugin_name, source_interface_name, 
+                                                        source_param_index, value, &success_count);
+        }
+        
+        if (matched_count > 0) {
+            internal_log_write("INFO", "Processed %zu rules, %zu successful", matched_count, success_count);
+        }
+    }
+    release_rule_set_read();
+    apply_pending_plugin_swaps();
+    evict_idle_plugins();
+}
+
 /**
  * @brief 传递指针 / Transfer pointer / Zeiger übertragen
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
@@ -38,6 +79,8 @@ POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferPointer(
         return -1;
     }
     
+    ensure_plugin_init();
+    
     pointer_transfer_context_t* ctx = get_global_context();
     int type_mismatch = 0;
     
@@ -89,28 +132,86 @@ POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferPointer(
     internal_log_write("INFO", "TransferPointer: pointer transferred successfully - source_plugin=%s, source_interface=%s, source_param_index=%d, type: %s (%s), size: %zu", 
                   source_plugin_name, source_interface_name, source_param_index, get_type_name_string(expected_type), type_name != NULL ? type_name : "unknown", data_size);
     
-    if (ctx->rule_count > 0 && ctx->rules != NULL) {
-        size_t matched_count = 0;
-        size_t success_count = 0;
-        
-        /* 使用索引查找匹配规则 / Use index to find matching rules / Index verwenden, um übereinstimmende Regeln zu finden */
-        size_t start_index = 0;
-        size_t end_index = 0;
-        int use_index = find_rule_index_range(source_plugin_name, source_interface_name, source_param_index, &start_index, &end_index);
-        
-        if (use_index) {
-            matched_count = apply_matched_rules_indexed(source_plugin_name, source_interface_name, 
-                                                         source_param_index, ptr, start_index, end_index, &success_count);
-        } else {
-            matched_count = apply_matched_rules_linear(source_plugin_name, source_interface_name, 
-                                                        source_param_index, ptr, &success_count);
-        }
-        
-        if (matched_count > 0) {
-            internal_log_write("INFO", "Processed %zu rules, %zu successful", matched_count, success_count);
-        }
+    pt_typed_value_t value = make_pointer_value(ptr, expected_type, data_size);
+    dispatch_transfer_value(source_plugin_name, source_interface_name, source_param_index, &value);
+    
+    return 0;
+}
+
+
+/**
+ * @brief 检查源参数 / Check source arguments / Quellargumente prüfen
+ */
+static int check_transfer_source(const char* function_name, const char* source_plugin_name, const char* source_interface_name) {
+    if (source_plugin_name == NULL || source_interface_name == NULL) {
+        internal_log_write("WARNING", "%s: received NULL source plugin or interface name", function_name);
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief 按值传递64位整数 / Transfer 64-bit integer by value / 64-Bit-Ganzzahl als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param value 整数值 / Integer value / Ganzzahlwert
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferInt64(const char* source_plugin_name, const char* source_interface_name, int source_param_index, int64_t value) {
+    if (!check_transfer_source("TransferInt64", source_plugin_name, source_interface_name)) {
+        return -1;
     }
     
+    ensure_plugin_init();
+    
+    pt_typed_value_t typed_value = make_int64_value(value);
+    dispatch_transfer_value(source_plugin_name, source_interface_name, source_param_index, &typed_value);
     return 0;
 }
 
+/**
+ * @brief 按值传递双精度浮点数 / Transfer double by value / Double als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param value 浮点值 / Floating-point value / Gleitkommawert
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferDouble(const char* source_plugin_name, const char* source_interface_name, int source_param_index, double value) {
+    if (!check_transfer_source("TransferDouble", source_plugin_name, source_interface_name)) {
+        return -1;
+    }
+    
+    ensure_plugin_init();
+    
+    pt_typed_value_t typed_value = make_double_value(value);
+    dispatch_transfer_value(source_plugin_name, source_interface_name, source_param_index, &typed_value);
+    return 0;
+}
+
+/**
+ * @brief 传递字节缓冲区 / Transfer byte buffer / Bytepuffer übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param data 数据指针 / Data pointer / Datenzeiger
+ * @param size 数据大小 / Data size / Datengröße
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferBytes(const char* source_plugin_name, const char* source_interface_name, int source_param_index, const void* data, size_t size) {
+    if (!check_transfer_source("TransferBytes", source_plugin_name, source_interface_name)) {
+        return -1;
+    }
+    
+    if (data == NULL && size > 0) {
+        internal_log_write("WARNING", "TransferBytes: received NULL data with size %zu", size);
+        return -1;
+    }
+    
+    ensure_plugin_init();
+    
+    pt_typed_value_t typed_value = make_pointer_value((void*)data, NXLD_PARAM_TYPE_POINTER, size);
+    dispatch_transfer_value(source_plugin_name, source_interface_name, source_param_index, &typed_value);
+    return 0;
+}
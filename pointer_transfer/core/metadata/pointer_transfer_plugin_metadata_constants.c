@@ -9,7 +9,7 @@
 /* 插件常量定义 / Plugin constant definitions / Plugin-Konstantendefinitionen */
 #define PLUGIN_NAME "PointerTransferPlugin"
 #define PLUGIN_VERSION "1.2.0"
-#define INTERFACE_COUNT 2
+#define INTERFACE_COUNT 7
 
 /* 接口名称和描述 / Interface names and descriptions / Schnittstellennamen und -beschreibungen */
 const char* get_plugin_name(void) {
@@ -27,7 +27,12 @@ size_t get_interface_count(void) {
 const char* get_interface_name(size_t index) {
     static const char* interface_names[] = {
         "TransferPointer",
-        "CallPlugin"
+        "CallPlugin",
+        "ReloadRules",
+        "AddTransferRule",
+        "RemoveTransferRule",
+        "SetRuleEnabled",
+        "ReloadPlugin"
     };
     if (index >= INTERFACE_COUNT) {
         return NULL;
@@ -38,7 +43,12 @@ const char* get_interface_name(size_t index) {
 const char* get_interface_description(size_t index) {
     static const char* interface_descriptions[] = {
         "传递指针 / Transfer pointer / Zeiger übertragen",
-        "调用目标插件接口 / Call target plugin interface / Ziel-Plugin-Schnittstelle aufrufen"
+        "调用目标插件接口 / Call target plugin interface / Ziel-Plugin-Schnittstelle aufrufen",
+        "重新加载传递规则 / Reload transfer rules / Übertragungsregeln neu laden",
+        "运行时添加传递规则 / Add transfer rule at runtime / Übertragungsregel zur Laufzeit hinzufügen",
+        "运行时移除传递规则 / Remove transfer rule at runtime / Übertragungsregel zur Laufzeit entfernen",
+        "设置规则启用状态 / Set rule enabled state / Aktivierungsstatus der Regel setzen",
+        "热替换目标插件库 / Hot-swap target plugin library / Ziel-Plugin-Bibliothek per Hot-Swap austauschen"
     };
     if (index >= INTERFACE_COUNT) {
         return NULL;
@@ -48,6 +58,11 @@ const char* get_interface_description(size_t index) {
 
 const char* get_interface_version(size_t index) {
     static const char* interface_versions[] = {
+        "1.2.0",
+        "1.2.0",
+        "1.2.0",
+        "1.2.0",
+        "1.2.0",
         "1.2.0",
         "1.2.0"
     };
@@ -152,3 +167,55 @@ const char* get_callplugin_param_type_name(int32_t param_index) {
     return callplugin_param_type_names[param_index];
 }
 
+
+/* 规则和插件管理接口参数信息（AddTransferRule、RemoveTransferRule、SetRuleEnabled、ReloadPlugin） / Rule and plugin management interface parameter information (AddTransferRule, RemoveTransferRule, SetRuleEnabled, ReloadPlugin) / Parameterinformationen der Regel- und Plugin-Verwaltungsschnittstellen (AddTransferRule, RemoveTransferRule, SetRuleEnabled, ReloadPlugin) */
+#define RULE_INTERFACE_FIRST_INDEX 3
+#define RULE_INTERFACE_COUNT 4
+#define RULE_INTERFACE_MAX_PARAMS 2
+
+size_t get_rule_interface_param_count(size_t index) {
+    static const size_t rule_interface_param_counts[] = { 1, 1, 2, 1 };
+    if (index < RULE_INTERFACE_FIRST_INDEX || index >= RULE_INTERFACE_FIRST_INDEX + RULE_INTERFACE_COUNT) {
+        return 0;
+    }
+    return rule_interface_param_counts[index - RULE_INTERFACE_FIRST_INDEX];
+}
+
+const char* get_rule_interface_param_name(size_t index, int32_t param_index) {
+    static const char* rule_interface_param_names[RULE_INTERFACE_COUNT][RULE_INTERFACE_MAX_PARAMS] = {
+        { "rule_spec", NULL },
+        { "rule_index", NULL },
+        { "rule_index", "enabled" },
+        { "plugin_name", NULL }
+    };
+    if (param_index < 0 || (size_t)param_index >= get_rule_interface_param_count(index)) {
+        return NULL;
+    }
+    return rule_interface_param_names[index - RULE_INTERFACE_FIRST_INDEX][param_index];
+}
+
+nxld_param_type_t get_rule_interface_param_type(size_t index, int32_t param_index) {
+    static const nxld_param_type_t rule_interface_param_types[RULE_INTERFACE_COUNT][RULE_INTERFACE_MAX_PARAMS] = {
+        { NXLD_PARAM_TYPE_STRING, NXLD_PARAM_TYPE_VOID },
+        { NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_VOID },
+        { NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_INT32 },
+        { NXLD_PARAM_TYPE_STRING, NXLD_PARAM_TYPE_VOID }
+    };
+    if (param_index < 0 || (size_t)param_index >= get_rule_interface_param_count(index)) {
+        return 0;
+    }
+    return rule_interface_param_types[index - RULE_INTERFACE_FIRST_INDEX][param_index];
+}
+
+const char* get_rule_interface_param_type_name(size_t index, int32_t param_index) {
+    static const char* rule_interface_param_type_names[RULE_INTERFACE_COUNT][RULE_INTERFACE_MAX_PARAMS] = {
+        { "const char*", NULL },
+        { "int", NULL },
+        { "int", "int" },
+        { "const char*", NULL }
+    };
+    if (param_index < 0 || (size_t)param_index >= get_rule_interface_param_count(index)) {
+        return NULL;
+    }
+    return rule_interface_param_type_names[index - RULE_INTERFACE_FIRST_INDEX][param_index];
+}
@@ -15,6 +15,7 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_coun
                                                                int32_t* min_count, int32_t* max_count) {
     extern size_t get_interface_count(void);
     extern size_t get_transferpointer_param_count(void);
+    extern size_t get_rule_interface_param_count(size_t index);
     
     if (index >= get_interface_count() || count_type == NULL || min_count == NULL || max_count == NULL) {
         return -1;
@@ -28,6 +29,14 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_coun
         *count_type = NXLD_PARAM_COUNT_FIXED;
         *min_count = 4;
         *max_count = 4;
+    } else if (index == 2) {
+        *count_type = NXLD_PARAM_COUNT_FIXED;
+        *min_count = 0;
+        *max_count = 0;
+    } else if (index >= 3 && index <= 6) {
+        *count_type = NXLD_PARAM_COUNT_FIXED;
+        *min_count = (int32_t)get_rule_interface_param_count(index);
+        *max_count = (int32_t)get_rule_interface_param_count(index);
     } else {
         return -1;
     }
@@ -24,6 +24,10 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_info
     extern const char* get_callplugin_param_name(int32_t param_index);
     extern nxld_param_type_t get_callplugin_param_type(int32_t param_index);
     extern const char* get_callplugin_param_type_name(int32_t param_index);
+    extern size_t get_rule_interface_param_count(size_t index);
+    extern const char* get_rule_interface_param_name(size_t index, int32_t param_index);
+    extern nxld_param_type_t get_rule_interface_param_type(size_t index, int32_t param_index);
+    extern const char* get_rule_interface_param_type_name(size_t index, int32_t param_index);
     
     if (index >= get_interface_count() || param_name == NULL || name_size == 0 || param_type == NULL) {
         return -1;
@@ -85,6 +89,34 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_info
                 type_name[len] = '\0';
             }
         }
+    } else if (index >= 3 && index <= 6) {
+        if (param_index < 0 || param_index >= (int32_t)get_rule_interface_param_count(index)) {
+            return -1;
+        }
+        
+        const char* name = get_rule_interface_param_name(index, param_index);
+        if (name != NULL) {
+            size_t len = strlen(name);
+            if (len >= name_size) {
+                len = name_size - 1;
+            }
+            memcpy(param_name, name, len);
+            param_name[len] = '\0';
+        }
+        
+        *param_type = get_rule_interface_param_type(index, param_index);
+        
+        if (type_name != NULL && type_name_size > 0) {
+            const char* type = get_rule_interface_param_type_name(index, param_index);
+            if (type != NULL) {
+                size_t len = strlen(type);
+                if (len >= type_name_size) {
+                    len = type_name_size - 1;
+                }
+                memcpy(type_name, type, len);
+                type_name[len] = '\0';
+            }
+        }
     } else {
         return -1;
     }
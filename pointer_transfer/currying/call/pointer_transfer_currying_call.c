@@ -12,7 +12,7 @@
 /**
  * @brief 柯里化调用函数 / Call function using currying / Funktion mit Currying aufrufen
  */
-int32_t pt_call_with_currying(void* func_ptr, pt_param_pack_t* pack, 
+int32_t pt_call_with_currying(void* func_ptr, pt_param_pack_t* pack, const int* param_borrowed, uint32_t pack_version,
                                pt_return_type_t return_type, size_t return_size,
                                int64_t* result_int, double* result_float, void* result_struct) {
     if (func_ptr == NULL || pack == NULL || result_int == NULL || result_float == NULL) {
@@ -25,14 +25,15 @@ int32_t pt_call_with_currying(void* func_ptr, pt_param_pack_t* pack,
     }
     
     /* 序列化参数包为连续内存块，确保数据自包含和安全性 / Serialize parameter pack to contiguous memory block to ensure data self-containment and safety / Parameterpaket in zusammenhängenden Speicherblock serialisieren, um Daten-Selbständigkeit und Sicherheit zu gewährleisten */
-    void* serialized_data = pt_serialize_param_pack(pack);
+    int use_v2 = pack_version >= NXLD_PACK_VERSION_2;
+    void* serialized_data = use_v2 ? pt_serialize_param_pack_v2(pack, param_borrowed) : pt_serialize_param_pack(pack, param_borrowed);
     if (serialized_data == NULL) {
         internal_log_write("ERROR", "Call with currying failed: failed to serialize parameter pack");
         return -1;
     }
     
-    /* 序列化后的数据格式与pt_param_pack_t兼容，可直接作为参数包使用 / Serialized data format is compatible with pt_param_pack_t and can be used directly as parameter pack / Serialisiertes Datenformat ist mit pt_param_pack_t kompatibel und kann direkt als Parameterpaket verwendet werden */
-    pt_param_pack_t* serialized_pack = pt_deserialize_param_pack(serialized_data);
+    /* 版本1数据与pt_param_pack_t兼容，版本2块直接传给插件 / Version 1 data is compatible with pt_param_pack_t, version 2 blocks are passed to the plugin as they are / Daten der Version 1 sind mit pt_param_pack_t kompatibel, Blöcke der Version 2 werden unverändert an das Plugin übergeben */
+    void* serialized_pack = use_v2 ? serialized_data : (void*)pt_deserialize_param_pack(serialized_data);
     if (serialized_pack == NULL) {
         internal_log_write("ERROR", "Call with currying failed: failed to deserialize parameter pack");
         pt_free_serialized_param_pack(serialized_data);
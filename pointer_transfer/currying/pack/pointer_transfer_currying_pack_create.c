@@ -4,7 +4,6 @@
  */
 
 #include "pointer_transfer_currying.h"
-#include "pointer_transfer_utils.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
@@ -16,6 +15,7 @@
  * @param param_values 参数值数组 / Parameter values array / Parameterwerte-Array
  * @param param_sizes 参数大小数组 / Parameter sizes array / Parametergrößen-Array
  * @return 成功返回参数包指针，失败返回NULL / Returns parameter pack pointer on success, NULL on failure / Gibt Parameterpaket-Zeiger bei Erfolg zurück, NULL bei Fehler
+ * @note 参数包引用param_values中的数据，须在其失效前释放 / The pack references the data in param_values and must be freed before that data goes away / Das Paket referenziert die Daten in param_values und muss freigegeben werden, bevor diese ungültig werden
  */
 pt_param_pack_t* pt_create_param_pack(int param_count, nxld_param_type_t* param_types, void** param_values, size_t* param_sizes) {
     if (param_count < 0 || param_types == NULL || param_values == NULL) {
@@ -63,28 +63,9 @@ pt_param_pack_t* pt_create_param_pack(int param_count, nxld_param_type_t* param_
                 case NXLD_PARAM_TYPE_CHAR:
                     pack->params[i].value.char_val = *(char*)value_ptr;
                     break;
-                case NXLD_PARAM_TYPE_POINTER:
-                case NXLD_PARAM_TYPE_STRING:
-                case NXLD_PARAM_TYPE_VARIADIC:
-                case NXLD_PARAM_TYPE_ANY:
-                case NXLD_PARAM_TYPE_UNKNOWN:
-                    pack->params[i].value.ptr_val = value_ptr;
-                    break;
                 default:
-                    if (param_sizes != NULL && param_sizes[i] > 0) {
-                        void* struct_data = malloc(param_sizes[i]);
-                        if (struct_data != NULL) {
-                            memcpy(struct_data, value_ptr, param_sizes[i]);
-                            pack->params[i].value.ptr_val = struct_data;
-                        } else {
-                            /* 内存分配失败，回退到直接使用指针 / Memory allocation failed, fallback to direct pointer / Speicherzuweisung fehlgeschlagen, Fallback auf direkten Zeiger */
-                            internal_log_write("WARNING", "Failed to allocate memory for struct parameter %d (size=%zu), using pointer directly", i, param_sizes[i]);
-                            pack->params[i].value.ptr_val = value_ptr;
-                            pack->params[i].size = 0; /* 标记为未分配 / Mark as not allocated / Als nicht zugewiesen markieren */
-                        }
-                    } else {
-                        pack->params[i].value.ptr_val = value_ptr;
-                    }
+                    /* 指针和结构体数据只被引用，参数包只在一次调用内存在；序列化时按需复制 / Pointer and struct data is only referenced, the pack lives for a single call; serialization copies it where needed / Zeiger- und Strukturdaten werden nur referenziert, das Paket existiert nur für einen Aufruf; die Serialisierung kopiert sie bei Bedarf */
+                    pack->params[i].value.ptr_val = value_ptr;
                     break;
             }
         }
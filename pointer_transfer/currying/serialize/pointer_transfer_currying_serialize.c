@@ -8,12 +8,28 @@
 #include <string.h>
 #include <stdint.h>
 
+/**
+ * @brief 检查参数是否需要复制结构体数据 / Check if a parameter needs its struct data copied / Prüfen, ob die Strukturdaten eines Parameters kopiert werden müssen
+ * @param param 参数 / Parameter / Parameter
+ * @param borrowed 参数借用标志 / Parameter borrow flag / Parameter-Ausleih-Flag
+ * @note 结构体参数（VOID类型）的数据在参数包中只是引用，不论大小都在此复制 / The data of struct parameters (VOID type) is only referenced by the pack and is copied here whatever its size / Die Daten von Strukturparametern (Typ VOID) werden im Paket nur referenziert und hier unabhängig von ihrer Größe kopiert
+ */
+static int param_has_struct_data(const pt_curried_param_t* param, int borrowed) {
+    if (borrowed || param->value.ptr_val == NULL ||
+        param->type == NXLD_PARAM_TYPE_POINTER || param->type == NXLD_PARAM_TYPE_STRING) {
+        return 0;
+    }
+    return param->size > sizeof(void*) || (param->type == NXLD_PARAM_TYPE_VOID && param->size > 0);
+}
+
 /**
  * @brief 序列化参数包为单个指针 / Serialize parameter pack to single pointer / Parameterpaket in einzelnen Zeiger serialisieren
  * @param pack 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
+ * @param param_borrowed 参数借用标志数组，可为NULL / Parameter borrow flags array, can be NULL / Parameter-Ausleih-Flag-Array, kann NULL sein
  * @return 成功返回序列化后的指针，失败返回NULL / Returns serialized pointer on success, NULL on failure / Gibt serialisierten Zeiger bei Erfolg zurück, NULL bei Fehler
+ * @note 借用的参数保留原指针，调用方保证其在调用期间有效 / Borrowed parameters keep the original pointer, the caller guarantees it stays valid for the duration of the call / Ausgeliehene Parameter behalten den Originalzeiger, der Aufrufer garantiert seine Gültigkeit für die Dauer des Aufrufs
  */
-void* pt_serialize_param_pack(pt_param_pack_t* pack) {
+void* pt_serialize_param_pack(pt_param_pack_t* pack, const int* param_borrowed) {
     if (pack == NULL) {
         return NULL;
     }
@@ -26,10 +42,7 @@ void* pt_serialize_param_pack(pt_param_pack_t* pack) {
     size_t struct_data_size = 0;
     if (pack->params != NULL) {
         for (int i = 0; i < pack->param_count; i++) {
-            if (pack->params[i].size > sizeof(void*) && 
-                pack->params[i].value.ptr_val != NULL &&
-                pack->params[i].type != NXLD_PARAM_TYPE_POINTER &&
-                pack->params[i].type != NXLD_PARAM_TYPE_STRING) {
+            if (param_has_struct_data(&pack->params[i], param_borrowed != NULL && param_borrowed[i])) {
                 struct_data_size += pack->params[i].size;
             }
         }
@@ -52,10 +65,7 @@ void* pt_serialize_param_pack(pt_param_pack_t* pack) {
         for (int i = 0; i < pack->param_count; i++) {
             serialized_pack->params[i] = pack->params[i];
             
-            if (pack->params[i].size > sizeof(void*) && 
-                pack->params[i].value.ptr_val != NULL &&
-                pack->params[i].type != NXLD_PARAM_TYPE_POINTER &&
-                pack->params[i].type != NXLD_PARAM_TYPE_STRING) {
+            if (param_has_struct_data(&pack->params[i], param_borrowed != NULL && param_borrowed[i])) {
                 memcpy(current_ptr, pack->params[i].value.ptr_val, pack->params[i].size);
                 serialized_pack->params[i].value.ptr_val = current_ptr;
                 current_ptr += pack->params[i].size;
@@ -0,0 +1,106 @@
+/**
+ * @file pointer_transfer_currying_serialize_v2.c
+ * @brief 版本2参数包序列化 / Version 2 Parameter Pack Serialization / Serialisierung von Parameterpaketen der Version 2
+ * @details 布局：头 | values[n] | sizes[n]（可选） | types[n] | 结构体数据 / Layout: header | values[n] | sizes[n] (optional) | types[n] | struct data / Layout: Kopf | values[n] | sizes[n] (optional) | types[n] | Strukturdaten
+ */
+
+#include "pointer_transfer_currying.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 结构体数据的对齐 / Alignment of struct data / Ausrichtung der Strukturdaten */
+#define PACK_V2_DATA_ALIGN 8
+
+/**
+ * @brief 取参数类型的自然大小 / Get the natural size of a parameter type / Natürliche Größe eines Parametertyps abrufen
+ * @note 与pointer_transfer_plugin_types.h中pt_pack_param_size的默认值一致 / Matches the defaults of pt_pack_param_size in pointer_transfer_plugin_types.h / Entspricht den Standardwerten von pt_pack_param_size in pointer_transfer_plugin_types.h
+ */
+static size_t natural_param_size(nxld_param_type_t type) {
+    switch (type) {
+        case NXLD_PARAM_TYPE_INT32:
+            return sizeof(int32_t);
+        case NXLD_PARAM_TYPE_FLOAT:
+            return sizeof(float);
+        case NXLD_PARAM_TYPE_INT64:
+            return sizeof(int64_t);
+        case NXLD_PARAM_TYPE_DOUBLE:
+            return sizeof(double);
+        case NXLD_PARAM_TYPE_CHAR:
+            return sizeof(char);
+        default:
+            return sizeof(void*);
+    }
+}
+
+/**
+ * @brief 检查参数是否需要复制结构体数据 / Check if a parameter needs its struct data copied / Prüfen, ob die Strukturdaten eines Parameters kopiert werden müssen
+ * @note 规则与版本1序列化相同 / Same rule as the version 1 serializer / Gleiche Regel wie bei der Serialisierung der Version 1
+ */
+static int param_has_struct_data(const pt_curried_param_t* param, int borrowed) {
+    if (borrowed || param->value.ptr_val == NULL ||
+        param->type == NXLD_PARAM_TYPE_POINTER || param->type == NXLD_PARAM_TYPE_STRING) {
+        return 0;
+    }
+    return param->size > sizeof(void*) || (param->type == NXLD_PARAM_TYPE_VOID && param->size > 0);
+}
+
+/**
+ * @brief 将参数包序列化为版本2布局 / Serialize parameter pack into the version 2 layout / Parameterpaket in das Layout der Version 2 serialisieren
+ */
+void* pt_serialize_param_pack_v2(const pt_param_pack_t* pack, const int* param_borrowed) {
+    if (pack == NULL || pack->param_count < 0 || pack->param_count > 256 ||
+        (pack->param_count > 0 && pack->params == NULL)) {
+        return NULL;
+    }
+    
+    size_t count = (size_t)pack->param_count;
+    int need_sizes = 0;
+    size_t struct_data_size = 0;
+    for (size_t i = 0; i < count; i++) {
+        const pt_curried_param_t* param = &pack->params[i];
+        if (param->size != natural_param_size(param->type)) {
+            need_sizes = 1;
+        }
+        if (param_has_struct_data(param, param_borrowed != NULL && param_borrowed[i])) {
+            struct_data_size += (param->size + PACK_V2_DATA_ALIGN - 1) & ~(size_t)(PACK_V2_DATA_ALIGN - 1);
+        }
+    }
+    
+    size_t values_offset = sizeof(pt_param_pack_v2_t);
+    size_t sizes_offset = values_offset + count * sizeof(uint64_t);
+    size_t types_offset = sizes_offset + (need_sizes ? count * sizeof(size_t) : 0);
+    size_t data_offset = (types_offset + count + PACK_V2_DATA_ALIGN - 1) & ~(size_t)(PACK_V2_DATA_ALIGN - 1);
+    
+    uint8_t* data = (uint8_t*)malloc(data_offset + struct_data_size);
+    if (data == NULL) {
+        return NULL;
+    }
+    
+    uint64_t* values = (uint64_t*)(data + values_offset);
+    size_t* sizes = need_sizes ? (size_t*)(data + sizes_offset) : NULL;
+    uint8_t* types = data + types_offset;
+    uint8_t* current_ptr = data + data_offset;
+    for (size_t i = 0; i < count; i++) {
+        const pt_curried_param_t* param = &pack->params[i];
+        memcpy(&values[i], &param->value, sizeof(uint64_t));
+        types[i] = (uint8_t)param->type;
+        if (sizes != NULL) {
+            sizes[i] = param->size;
+        }
+        if (param_has_struct_data(param, param_borrowed != NULL && param_borrowed[i])) {
+            memcpy(current_ptr, param->value.ptr_val, param->size);
+            void* copied = current_ptr;
+            memcpy(&values[i], &copied, sizeof(void*));
+            current_ptr += (param->size + PACK_V2_DATA_ALIGN - 1) & ~(size_t)(PACK_V2_DATA_ALIGN - 1);
+        }
+    }
+    
+    pt_param_pack_v2_t* header = (pt_param_pack_v2_t*)data;
+    header->magic = PT_PARAM_PACK_V2_MAGIC;
+    header->param_count = (uint32_t)count;
+    header->values = values;
+    header->sizes = sizes;
+    header->types = types;
+    return data;
+}
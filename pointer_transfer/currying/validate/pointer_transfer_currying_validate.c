@@ -7,12 +7,57 @@
 #include "pointer_transfer_utils.h"
 #include "pointer_transfer_context.h"
 #include "pointer_transfer_platform.h"
+#include "pointer_transfer_interface.h"
 #include <stdint.h>
 
+/**
+ * @brief 用测试参数包试调用插件函数 / Trial-call plugin function with a test parameter pack / Plugin-Funktion mit einem Testparameterpaket probeweise aufrufen
+ * @details 只用于声明允许试调用的插件或无库句柄的调用者 / Only used for plugins that opt in and for callers without a library handle / Nur für zustimmende Plugins und für Aufrufer ohne Bibliotheks-Handle
+ */
+static int32_t run_trial_call(void* func_ptr, uint32_t pack_version, const char* plugin_path, const char* interface_name,
+                              int expected_param_count, pt_return_type_t return_type) {
+    pt_param_pack_t* test_pack = NULL;
+    int32_t validation_result = 0;
+    
+    /* 创建测试参数包 / Create test parameter pack / Testparameterpaket erstellen */
+    test_pack = pt_create_test_param_pack(expected_param_count);
+    if (test_pack == NULL) {
+        internal_log_write("ERROR", "Plugin function validation failed: failed to create test param pack (%d params)", expected_param_count);
+        return -1;
+    }
+    
+    if (pt_validate_param_pack(test_pack) != 0) {
+        internal_log_write("ERROR", "Plugin function validation failed: test param pack validation failed");
+        pt_free_param_pack(test_pack);
+        return -1;
+    }
+    
+    int64_t test_result_int = 0;
+    double test_result_float = 0.0;
+    void* test_result_struct = NULL;
+    
+    /* 执行实际调用测试以验证函数兼容性 / Execute actual call test to verify function compatibility / Tatsächlichen Aufruftest ausführen, um Funktionskompatibilität zu überprüfen */
+    int32_t call_result = pt_call_with_currying(func_ptr, test_pack, NULL, pack_version, return_type, 0, 
+                                                 &test_result_int, &test_result_float, test_result_struct);
+    
+    if (call_result != 0) {
+        internal_log_write("ERROR", "Plugin function validation failed: test call returned error code %d (plugin=%s, interface=%s, param_count=%d)", 
+                         call_result, plugin_path != NULL ? plugin_path : "unknown", interface_name != NULL ? interface_name : "unknown", expected_param_count);
+        validation_result = -1;
+    } else {
+        internal_log_write("INFO", "Plugin function validation passed: test call succeeded (plugin=%s, interface=%s, param_count=%d)", 
+                         plugin_path != NULL ? plugin_path : "unknown", interface_name != NULL ? interface_name : "unknown", expected_param_count);
+        validation_result = 0;
+    }
+    
+    pt_free_param_pack(test_pack);
+    return validation_result;
+}
+
 /**
  * @brief 验证插件函数兼容性（完整检查）/ Validate plugin function compatibility (full check) / Plugin-Funktionskompatibilität validieren (vollständige Prüfung)
  */
-int32_t pt_validate_plugin_function(void* func_ptr, const char* plugin_path, const char* interface_name, int expected_param_count, pt_return_type_t return_type) {
+int32_t pt_validate_plugin_function(void* handle, void* func_ptr, const char* plugin_path, const char* interface_name, int expected_param_count, pt_return_type_t return_type) {
     if (func_ptr == NULL) {
         internal_log_write("ERROR", "Plugin function validation failed: func_ptr is NULL");
         return -1;
@@ -37,70 +82,39 @@ int32_t pt_validate_plugin_function(void* func_ptr, const char* plugin_path, con
         return 0;
     }
     
-    /* 处理目录中其他DLL文件的验证文件生成 / Handle validation file generation for other DLL files in directory / Validierungsdatei-Generierung für andere DLL-Dateien im Verzeichnis behandeln */
+    /* 首次验证时对照数据库检查目录中的所有DLL文件 / On first validation check all DLL files in the directory against the database / Bei der ersten Validierung alle DLL-Dateien im Verzeichnis mit der Datenbank abgleichen */
     if (plugin_path != NULL) {
         pt_process_directory_dll_validation(plugin_path);
     }
     
     /* 检查验证缓存是否有效 / Check if validation cache is valid / Prüfen, ob Validierungs-Cache gültig ist */
-    if (plugin_path != NULL) {
+    if (plugin_path != NULL && interface_name != NULL) {
         int cache_valid = 0;
-        if (pt_check_validation_cache(plugin_path, &cache_valid) == 0 && cache_valid) {
-            internal_log_write("INFO", "Plugin function validation skipped: cached validation is valid and timestamp unchanged (plugin=%s, interface=%s, param_count=%d)", 
-                             plugin_path != NULL ? plugin_path : "unknown", interface_name != NULL ? interface_name : "unknown", expected_param_count);
+        if (pt_check_validation_cache(plugin_path, interface_name, expected_param_count, return_type, &cache_valid) == 0 && cache_valid) {
+            internal_log_write("INFO", "Plugin function validation skipped: cached validation is valid and plugin unchanged (plugin=%s, interface=%s, param_count=%d)", 
+                             plugin_path, interface_name, expected_param_count);
             return 0;
         }
     }
     
-    pt_param_pack_t* test_pack = NULL;
+    /* 未声明允许试调用的插件只做静态检查 / Plugins that do not opt into trial calls are only checked statically / Plugins ohne Zustimmung zu Probeaufrufen werden nur statisch geprüft */
     int32_t validation_result = 0;
-    
-    /* 创建测试参数包 / Create test parameter pack / Testparameterpaket erstellen */
-    test_pack = pt_create_test_param_pack(expected_param_count);
-    if (test_pack == NULL) {
-        internal_log_write("ERROR", "Plugin function validation failed: failed to create test param pack (%d params)", expected_param_count);
-        return -1;
-    }
-    
-    if (pt_validate_param_pack(test_pack) != 0) {
-        internal_log_write("ERROR", "Plugin function validation failed: test param pack validation failed");
-        pt_free_param_pack(test_pack);
-        return -1;
-    }
-    
-    int64_t test_result_int = 0;
-    double test_result_float = 0.0;
-    void* test_result_struct = NULL;
-    
-    /* 执行实际调用测试以验证函数兼容性 / Execute actual call test to verify function compatibility / Tatsächlichen Aufruftest ausführen, um Funktionskompatibilität zu überprüfen */
-    int32_t call_result = pt_call_with_currying(func_ptr, test_pack, return_type, 0, 
-                                                 &test_result_int, &test_result_float, test_result_struct);
-    
-    if (call_result != 0) {
-        internal_log_write("ERROR", "Plugin function validation failed: test call returned error code %d (plugin=%s, interface=%s, param_count=%d)", 
-                         call_result, plugin_path != NULL ? plugin_path : "unknown", interface_name != NULL ? interface_name : "unknown", expected_param_count);
-        validation_result = -1;
+    if (handle != NULL && plugin_path != NULL && interface_name != NULL && !pt_plugin_allows_trial_call(plugin_path)) {
+        validation_result = pt_validate_plugin_static(handle, func_ptr, plugin_path, interface_name, expected_param_count, return_type);
     } else {
-        internal_log_write("INFO", "Plugin function validation passed: test call succeeded (plugin=%s, interface=%s, param_count=%d)", 
-                         plugin_path != NULL ? plugin_path : "unknown", interface_name != NULL ? interface_name : "unknown", expected_param_count);
-        validation_result = 0;
+        /* 试调用使用插件实际会收到的参数包布局 / Trial calls use the pack layout the plugin will actually receive / Probeaufrufe verwenden das Paketlayout, das das Plugin tatsächlich erhält */
+        validation_result = run_trial_call(func_ptr, get_plugin_pack_version(handle), plugin_path, interface_name,
+                                           expected_param_count, return_type);
     }
     
-    pt_free_param_pack(test_pack);
-    
-    /* 生成.nxpv验证文件，记录时间戳和验证结果 / Generate .nxpv validation file, record timestamp and validation result / .nxpv-Validierungsdatei generieren, Zeitstempel und Validierungsergebnis aufzeichnen */
-    if (plugin_path != NULL) {
-        int64_t current_timestamp = 0;
-        if (pt_platform_get_file_timestamp(plugin_path, &current_timestamp) == 0) {
-            int is_valid = (validation_result == 0) ? 1 : 0;
-            if (pt_generate_nxpv_file(plugin_path, current_timestamp, is_valid) == 0) {
-                internal_log_write("INFO", "Generated .nxpv validation file for plugin: %s (timestamp=%lld, valid=%d)", 
-                                 plugin_path, (long long)current_timestamp, is_valid);
-            } else {
-                internal_log_write("WARNING", "Failed to generate .nxpv validation file for plugin: %s", plugin_path);
-            }
+    /* 在验证数据库中记录接口结果和元数据 / Record interface result and metadata in the validation database / Schnittstellenergebnis und Metadaten in der Validierungsdatenbank speichern */
+    if (plugin_path != NULL && interface_name != NULL) {
+        int is_valid = (validation_result == 0) ? 1 : 0;
+        if (pt_record_validation_result(plugin_path, interface_name, expected_param_count, return_type, is_valid) == 0) {
+            internal_log_write("INFO", "Recorded validation result for plugin: %s (interface=%s, valid=%d)", 
+                             plugin_path, interface_name, is_valid);
         } else {
-            internal_log_write("WARNING", "Failed to get file timestamp for plugin: %s", plugin_path);
+            internal_log_write("WARNING", "Failed to record validation result for plugin: %s", plugin_path);
         }
     }
     
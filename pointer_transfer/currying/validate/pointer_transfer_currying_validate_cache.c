@@ -4,48 +4,250 @@
  */
 
 #include "pointer_transfer_currying.h"
+#include "pointer_transfer_currying_validate_db.h"
 #include "pointer_transfer_utils.h"
 #include "pointer_transfer_context.h"
 #include "pointer_transfer_platform.h"
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 
+/**
+ * @brief 比较插件文件与数据库记录 / Compare plugin file with database record / Plugin-Datei mit Datenbankeintrag vergleichen
+ * @details 修改时间取自受监视的目录清单（不可用时stat）；修改时间未变时不读文件；修改时间变化但大小和内容哈希相同则保留验证结果 / The mtime comes from the watched directory manifest (stat when unavailable); the file is not read while the mtime is unchanged; a changed mtime with equal size and content hash keeps the results / Die Änderungszeit stammt aus dem überwachten Verzeichnismanifest (stat, wenn nicht verfügbar); bei unveränderter Änderungszeit wird die Datei nicht gelesen; geänderte Änderungszeit bei gleicher Größe und gleichem Inhalts-Hash behält die Ergebnisse
+ * @return 记录有效返回0，需要更新返回1（输出新标识），失败返回-1 / Returns 0 if the record is current, 1 if it needs an update (outputs the new stamp), -1 on failure / Gibt 0 zurück wenn der Datensatz aktuell ist, 1 wenn er aktualisiert werden muss (gibt den neuen Stempel aus), -1 bei Fehler
+ */
+static int check_validation_db_stamp(validation_db_t* db, const validation_db_plugin_record_t* record, const char* plugin_path,
+                                     validation_db_stamp_t* stamp_out, int* keep_results_out) {
+    int64_t mtime = 0;
+    const plugin_manifest_entry_t* entry = db->manifest.watch != NULL ? find_plugin_manifest_entry(db, plugin_path) : NULL;
+    if (entry != NULL && entry->present) {
+        mtime = entry->mtime;
+    } else if (pt_platform_get_file_timestamp(plugin_path, &mtime) != 0) {
+        return -1;
+    }
+    if (record != NULL && record->stamp.mtime == mtime) {
+        return 0;
+    }
+    
+    if (compute_validation_db_stamp(plugin_path, stamp_out) != 0) {
+        return -1;
+    }
+    *keep_results_out = record != NULL && record->stamp.size == stamp_out->size && record->stamp.hash == stamp_out->hash;
+    if (*keep_results_out) {
+        internal_log_write("INFO", "Plugin timestamp changed but content is identical, keeping validation results: %s", plugin_path);
+    }
+    return 1;
+}
+
 /**
  * @brief 检查验证缓存是否有效 / Check if validation cache is valid / Prüfen, ob Validierungs-Cache gültig ist
  */
-int32_t pt_check_validation_cache(const char* plugin_path, int* cache_valid) {
-    if (plugin_path == NULL || cache_valid == NULL) {
+int32_t pt_check_validation_cache(const char* plugin_path, const char* interface_name, int param_count,
+                                  pt_return_type_t return_type, int* cache_valid) {
+    if (plugin_path == NULL || interface_name == NULL || cache_valid == NULL) {
         return -1;
     }
     
     *cache_valid = 0;
     
-    char nxpv_path[1024];
-    if (pt_build_nxpv_path(plugin_path, nxpv_path, sizeof(nxpv_path)) != 0) {
+    validation_db_t* db = acquire_validation_db(plugin_path);
+    if (db == NULL) {
         return -1;
     }
     
-    int64_t cached_timestamp = 0;
-    int cached_valid = 0;
+    refresh_plugin_manifest(db);
     
-    /* 读取缓存的验证信息 / Read cached validation info / Gecachte Validierungsinformationen lesen */
-    if (pt_read_validation_from_nxpv(nxpv_path, &cached_timestamp, &cached_valid) == 0) {
-        /* 获取当前DLL文件的修改时间戳 / Get current DLL file modification timestamp / Aktuellen DLL-Dateiänderungszeitstempel abrufen */
-        int64_t current_timestamp = 0;
-        if (pt_platform_get_file_timestamp(plugin_path, &current_timestamp) == 0) {
-            /* 如果时间戳匹配且验证结果为合规，则缓存有效 / If timestamp matches and validation result is valid, cache is valid / Wenn Zeitstempel übereinstimmt und Validierungsergebnis gültig ist, ist Cache gültig */
-            if (current_timestamp == cached_timestamp && cached_valid == 1) {
-                *cache_valid = 1;
-                return 0;
-            }
+    /* 文件变化时先更新标识（内容变化会清除旧结果） / Update the stamp first when the file changed (changed content clears old results) / Bei Dateiänderung zuerst den Stempel aktualisieren (geänderter Inhalt löscht alte Ergebnisse) */
+    const validation_db_plugin_record_t* record = find_validation_db_plugin(db, plugin_path);
+    validation_db_stamp_t stamp;
+    int keep_results = 0;
+    int status = check_validation_db_stamp(db, record, plugin_path, &stamp, &keep_results);
+    if (status < 0) {
+        release_validation_db(db);
+        return -1;
+    }
+    if (status > 0) {
+        validation_db_edit_t* edit = begin_validation_db_edit(db);
+        if (edit == NULL || set_validation_db_stamp(edit, plugin_path, &stamp, keep_results) != 0 ||
+            commit_validation_db_edit(db, edit) != 0) {
+            /* 无法持久化时视为未验证 / Treat as not validated when it cannot be persisted / Als nicht validiert behandeln, wenn nicht gespeichert werden kann */
+            release_validation_db(db);
+            return 0;
+        }
+        record = find_validation_db_plugin(db, plugin_path);
+    }
+    
+    /* 接口结果必须与当前参数数量和返回类型一致 / The interface result must match the current parameter count and return type / Das Schnittstellenergebnis muss zur aktuellen Parameteranzahl und zum Rückgabetyp passen */
+    const validation_db_interface_record_t* result = find_validation_db_interface(db, record, interface_name);
+    if (result != NULL && result->valid == 1 && result->param_count == (int32_t)param_count &&
+        result->return_type == (int32_t)return_type) {
+        *cache_valid = 1;
+    }
+    release_validation_db(db);
+    return 0;
+}
+
+/**
+ * @brief 记录接口验证结果 / Record interface validation result / Schnittstellen-Validierungsergebnis speichern
+ */
+int32_t pt_record_validation_result(const char* plugin_path, const char* interface_name, int param_count,
+                                    pt_return_type_t return_type, int is_valid) {
+    if (plugin_path == NULL || interface_name == NULL) {
+        return -1;
+    }
+    
+    validation_db_t* db = acquire_validation_db(plugin_path);
+    if (db == NULL) {
+        return -1;
+    }
+    
+    refresh_plugin_manifest(db);
+    const validation_db_plugin_record_t* record = find_validation_db_plugin(db, plugin_path);
+    validation_db_stamp_t stamp;
+    int keep_results = 0;
+    int status = check_validation_db_stamp(db, record, plugin_path, &stamp, &keep_results);
+    validation_db_edit_t* edit = status >= 0 ? begin_validation_db_edit(db) : NULL;
+    if (edit == NULL || (status > 0 && set_validation_db_stamp(edit, plugin_path, &stamp, keep_results) != 0) ||
+        set_validation_db_interface(edit, plugin_path, interface_name, param_count, return_type, is_valid) != 0) {
+        discard_validation_db_edit(edit);
+        release_validation_db(db);
+        return -1;
+    }
+    
+    int32_t result = commit_validation_db_edit(db, edit) == 0 ? 0 : -1;
+    release_validation_db(db);
+    return result;
+}
+
+/**
+ * @brief 从验证数据库读取接口元数据 / Load interface metadata from the validation database / Schnittstellen-Metadaten aus der Validierungsdatenbank laden
+ * @details 与验证结果共用文件标识，库内容变化时元数据随之失效 / Shares the file stamp with the validation results, so metadata is invalidated when the library content changes / Teilt den Dateistempel mit den Validierungsergebnissen, daher werden Metadaten bei geändertem Bibliotheksinhalt ungültig
+ */
+int32_t pt_load_cached_metadata(const char* plugin_path, const char* interface_name, pt_cached_metadata_t* metadata_out) {
+    if (plugin_path == NULL || interface_name == NULL || metadata_out == NULL) {
+        return -1;
+    }
+    
+    memset(metadata_out, 0, sizeof(pt_cached_metadata_t));
+    validation_db_t* db = acquire_validation_db(plugin_path);
+    if (db == NULL) {
+        return -1;
+    }
+    
+    refresh_plugin_manifest(db);
+    const validation_db_plugin_record_t* record = find_validation_db_plugin(db, plugin_path);
+    if (record == NULL || record->metadata_count == 0) {
+        release_validation_db(db);
+        return -1;
+    }
+    validation_db_stamp_t stamp;
+    int keep_results = 0;
+    int status = check_validation_db_stamp(db, record, plugin_path, &stamp, &keep_results);
+    if (status < 0 || (status > 0 && !keep_results)) {
+        release_validation_db(db);
+        return -1;
+    }
+    if (status > 0) {
+        /* 只有时间变化时刷新标识，下次不再计算哈希 / Only the time changed: refresh the stamp so the hash is not computed again / Nur die Zeit hat sich geändert: Stempel auffrischen, damit der Hash nicht erneut berechnet wird */
+        validation_db_edit_t* edit = begin_validation_db_edit(db);
+        if (edit != NULL && set_validation_db_stamp(edit, plugin_path, &stamp, 1) == 0) {
+            commit_validation_db_edit(db, edit);
+        } else {
+            discard_validation_db_edit(edit);
         }
+        record = find_validation_db_plugin(db, plugin_path);
     }
     
+    const validation_db_metadata_record_t* cached = find_validation_db_metadata(db, record, interface_name);
+    const int32_t* param_types = get_validation_db_param_types(db, cached);
+    if (cached == NULL || (cached->param_type_count > 0 && param_types == NULL)) {
+        release_validation_db(db);
+        return -1;
+    }
+    if (cached->param_type_count > 0) {
+        metadata_out->param_types = (nxld_param_type_t*)malloc((size_t)cached->param_type_count * sizeof(nxld_param_type_t));
+        if (metadata_out->param_types == NULL) {
+            release_validation_db(db);
+            return -1;
+        }
+        for (uint32_t i = 0; i < cached->param_type_count; i++) {
+            metadata_out->param_types[i] = (nxld_param_type_t)param_types[i];
+        }
+    }
+    metadata_out->param_type_count = (int)cached->param_type_count;
+    metadata_out->interface_index = (size_t)cached->interface_index;
+    metadata_out->return_type = (pt_return_type_t)cached->return_type;
+    metadata_out->return_size = (size_t)cached->return_size;
+    metadata_out->param_count_type = (nxld_param_count_type_t)cached->param_count_type;
+    metadata_out->min_count = cached->min_count;
+    metadata_out->max_count = cached->max_count;
+    metadata_out->call_convention = (nxld_call_convention_t)cached->call_convention;
+    metadata_out->native_return_type = (nxld_return_type_t)cached->native_return_type;
+    release_validation_db(db);
     return 0;
 }
 
 /**
- * @brief 处理目录中其他DLL文件的验证文件生成 / Handle validation file generation for other DLL files in directory / Validierungsdatei-Generierung für andere DLL-Dateien im Verzeichnis behandeln
+ * @brief 将接口元数据写入验证数据库 / Record interface metadata in the validation database / Schnittstellen-Metadaten in der Validierungsdatenbank speichern
+ */
+int32_t pt_record_cached_metadata(const char* plugin_path, const char* interface_name, const pt_cached_metadata_t* metadata) {
+    if (plugin_path == NULL || interface_name == NULL || metadata == NULL || metadata->param_type_count < 0 ||
+        (metadata->param_type_count > 0 && metadata->param_types == NULL)) {
+        return -1;
+    }
+    
+    int32_t* param_types = NULL;
+    if (metadata->param_type_count > 0) {
+        param_types = (int32_t*)malloc((size_t)metadata->param_type_count * sizeof(int32_t));
+        if (param_types == NULL) {
+            return -1;
+        }
+        for (int i = 0; i < metadata->param_type_count; i++) {
+            param_types[i] = (int32_t)metadata->param_types[i];
+        }
+    }
+    validation_db_metadata_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.return_type = (int32_t)metadata->return_type;
+    record.return_size = (uint64_t)metadata->return_size;
+    record.interface_index = (uint64_t)metadata->interface_index;
+    record.param_count_type = (int32_t)metadata->param_count_type;
+    record.min_count = metadata->min_count;
+    record.max_count = metadata->max_count;
+    record.param_type_count = (uint32_t)metadata->param_type_count;
+    record.call_convention = (uint16_t)metadata->call_convention;
+    record.native_return_type = (uint16_t)metadata->native_return_type;
+    
+    validation_db_t* db = acquire_validation_db(plugin_path);
+    if (db == NULL) {
+        free(param_types);
+        return -1;
+    }
+    
+    refresh_plugin_manifest(db);
+    const validation_db_plugin_record_t* plugin = find_validation_db_plugin(db, plugin_path);
+    validation_db_stamp_t stamp;
+    int keep_results = 0;
+    int status = check_validation_db_stamp(db, plugin, plugin_path, &stamp, &keep_results);
+    validation_db_edit_t* edit = status >= 0 ? begin_validation_db_edit(db) : NULL;
+    if (edit == NULL || (status > 0 && set_validation_db_stamp(edit, plugin_path, &stamp, keep_results) != 0) ||
+        set_validation_db_metadata(edit, plugin_path, interface_name, &record, param_types) != 0) {
+        discard_validation_db_edit(edit);
+        release_validation_db(db);
+        free(param_types);
+        return -1;
+    }
+    
+    int32_t result = commit_validation_db_edit(db, edit) == 0 ? 0 : -1;
+    release_validation_db(db);
+    free(param_types);
+    return result;
+}
+
+/**
+ * @brief 处理目录中其他DLL文件的验证记录 / Handle validation records for other DLL files in directory / Validierungsdatensätze für andere DLL-Dateien im Verzeichnis behandeln
+ * @details 目录只在首次扫描，之后由目录监视更新清单；只核对新增或变化的库，合并为一次数据库写入 / The directory is scanned only the first time, afterwards the directory watcher updates the manifest; only new or changed libraries are checked and merged into a single database write / Das Verzeichnis wird nur beim ersten Mal gescannt, danach aktualisiert die Verzeichnisüberwachung das Manifest; nur neue oder geänderte Bibliotheken werden geprüft und zu einem Datenbank-Schreibvorgang zusammengefasst
  */
 int32_t pt_process_directory_dll_validation(const char* plugin_path) {
     if (plugin_path == NULL) {
@@ -57,45 +259,71 @@ int32_t pt_process_directory_dll_validation(const char* plugin_path) {
         return 0;
     }
     
-    /* 递归查找同目录下的所有DLL文件并为它们生成.nxpv文件（仅在启用验证时）/ Recursively find all DLL files in the same directory and generate .nxpv files for them (only when validation is enabled) / Alle DLL-Dateien im selben Verzeichnis rekursiv finden und .nxpv-Dateien für sie generieren (nur wenn Validierung aktiviert ist) */
-    char dll_files[256][1024];
-    int file_count = 0;
-    if (pt_platform_find_all_dll_files(plugin_path, dll_files, 256, &file_count) == 0 && file_count > 0) {
-        internal_log_write("INFO", "Found %d DLL files in directory, generating .nxpv files", file_count);
-        for (int i = 0; i < file_count; i++) {
-            /* 跳过当前插件文件（后续处理）/ Skip current plugin file (processed subsequently) / Aktuelle Plugin-Datei überspringen (wird anschließend verarbeitet) */
-            if (strcmp(dll_files[i], plugin_path) == 0) {
-                continue;
-            }
-            
-            /* 检查DLL文件是否在忽略列表中 / Check if DLL file is in ignore list / Prüfen, ob DLL-Datei in Ignorierliste ist */
-            if (is_plugin_ignored(dll_files[i])) {
-                internal_log_write("INFO", "Skipping ignored plugin DLL: %s", dll_files[i]);
-                continue;
-            }
-            
-            /* 检查.nxpv文件是否已存在且时间戳匹配 / Check if .nxpv file already exists and timestamp matches / Prüfen, ob .nxpv-Datei bereits existiert und Zeitstempel übereinstimmt */
-            char nxpv_path[1024];
-            if (pt_build_nxpv_path(dll_files[i], nxpv_path, sizeof(nxpv_path)) == 0) {
-                int64_t cached_timestamp = 0;
-                int cached_valid = 0;
-                
-                int64_t dll_timestamp = 0;
-                if (pt_platform_get_file_timestamp(dll_files[i], &dll_timestamp) == 0) {
-                    /* 如果.nxpv文件不存在或时间戳不匹配，生成新的验证文件 / If .nxpv file doesn't exist or timestamp doesn't match, generate new validation file / Wenn .nxpv-Datei nicht existiert oder Zeitstempel nicht übereinstimmt, neue Validierungsdatei generieren */
-                    if (pt_read_validation_from_nxpv(nxpv_path, &cached_timestamp, &cached_valid) != 0 || 
-                        cached_timestamp != dll_timestamp) {
-                        /* 为DLL文件生成.nxpv文件，标记为未验证（Valid=0），等待实际验证 / Generate .nxpv file for DLL file, mark as unvalidated (Valid=0), pending actual validation / .nxpv-Datei für DLL-Datei generieren, als nicht validiert markieren (Valid=0), wartet auf tatsächliche Validierung */
-                        if (pt_generate_nxpv_file(dll_files[i], dll_timestamp, 0) == 0) {
-                            internal_log_write("INFO", "Generated .nxpv validation file for DLL: %s (timestamp=%lld, valid=0, not validated)", 
-                                             dll_files[i], (long long)dll_timestamp);
-                        }
-                    }
-                }
+    validation_db_t* db = acquire_validation_db(plugin_path);
+    if (db == NULL) {
+        return -1;
+    }
+    if (refresh_plugin_manifest(db) != 0) {
+        release_validation_db(db);
+        return -1;
+    }
+    
+    /* 对照已映射的数据库核对清单中未核对的库 / Check the manifest's unchecked libraries against the mapped database / Nicht abgeglichene Bibliotheken des Manifests mit der zugeordneten Datenbank abgleichen */
+    plugin_manifest_t* manifest = &db->manifest;
+    validation_db_edit_t* edit = NULL;
+    size_t changed_count = 0;
+    for (size_t i = 0; i < manifest->count; i++) {
+        plugin_manifest_entry_t* entry = &manifest->entries[i];
+        if (entry->synced) {
+            continue;
+        }
+        
+        /* 已删除的库保留记录，重新出现且内容相同时无需重新验证 / Deleted libraries keep their record so a reappearing identical file needs no revalidation / Gelöschte Bibliotheken behalten ihren Datensatz, damit eine identisch wiederkehrende Datei keine Neuvalidierung braucht */
+        if (!entry->present) {
+            entry->synced = 1;
+            continue;
+        }
+        
+        /* 检查DLL文件是否在忽略列表中 / Check if DLL file is in ignore list / Prüfen, ob DLL-Datei in Ignorierliste ist */
+        if (is_plugin_ignored(entry->path)) {
+            internal_log_write("INFO", "Skipping ignored plugin DLL: %s", entry->path);
+            entry->synced = 1;
+            continue;
+        }
+        
+        /* 新增或变化的库登记为未验证，等待实际验证 / New or changed libraries are registered as not validated, pending actual validation / Neue oder geänderte Bibliotheken werden als nicht validiert registriert und warten auf die tatsächliche Validierung */
+        validation_db_stamp_t stamp;
+        int keep_results = 0;
+        int status = check_validation_db_stamp(db, find_validation_db_plugin(db, entry->path), entry->path, &stamp, &keep_results);
+        if (status == 0) {
+            entry->synced = 1;
+            continue;
+        }
+        if (status < 0) {
+            continue;
+        }
+        if (edit == NULL) {
+            edit = begin_validation_db_edit(db);
+            if (edit == NULL) {
+                break;
             }
         }
+        if (set_validation_db_stamp(edit, entry->path, &stamp, keep_results) == 0) {
+            changed_count++;
+        }
     }
     
+    /* 只有记录已写入的库才标记为已核对，其余下次重试 / Only libraries whose record was written are marked checked, the rest are retried next time / Nur Bibliotheken mit geschriebenem Datensatz werden als abgeglichen markiert, der Rest wird beim nächsten Mal erneut versucht */
+    if (edit != NULL && commit_validation_db_edit(db, edit) == 0) {
+        for (size_t i = 0; i < manifest->count; i++) {
+            plugin_manifest_entry_t* entry = &manifest->entries[i];
+            const validation_db_plugin_record_t* record = entry->synced ? NULL : find_validation_db_plugin(db, entry->path);
+            if (record != NULL && record->stamp.mtime == entry->mtime) {
+                entry->synced = 1;
+            }
+        }
+        internal_log_write("INFO", "Registered %zu new or changed DLL files in validation database", changed_count);
+    }
+    release_validation_db(db);
     return 0;
 }
-
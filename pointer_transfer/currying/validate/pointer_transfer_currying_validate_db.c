@@ -0,0 +1,489 @@
+/**
+ * @file pointer_transfer_currying_validate_db.c
+ * @brief 插件验证数据库映射和查询 / Plugin Validation Database Mapping and Lookup / Zuordnung und Abfrage der Plugin-Validierungsdatenbank
+ */
+
+#include "pointer_transfer_currying_validate_db.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* XXH64常量 / XXH64 constants / XXH64-Konstanten */
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+/* 已打开的数据库（每个插件目录一个） / Open databases (one per plugin directory) / Geöffnete Datenbanken (eine pro Plugin-Verzeichnis) */
+static validation_db_t* g_validation_dbs = NULL;
+
+/* 数据库列表和映射互斥锁 / Database list and mapping mutex / Mutex für Datenbankliste und Zuordnungen */
+static pt_platform_mutex_t* g_validation_db_lock = NULL;
+
+/**
+ * @brief 循环左移 / Rotate left / Links rotieren
+ */
+static uint64_t rotl64(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * @brief 读取小端64位值（不要求对齐） / Read little-endian 64-bit value (unaligned) / Little-Endian-64-Bit-Wert lesen (nicht ausgerichtet)
+ */
+static uint64_t read_u64(const unsigned char* p) {
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+/**
+ * @brief 读取小端32位值（不要求对齐） / Read little-endian 32-bit value (unaligned) / Little-Endian-32-Bit-Wert lesen (nicht ausgerichtet)
+ */
+static uint64_t read_u32(const unsigned char* p) {
+    return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24);
+}
+
+/**
+ * @brief XXH64累加轮 / XXH64 accumulator round / XXH64-Akkumulatorrunde
+ */
+static uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+/**
+ * @brief XXH64合并累加器 / XXH64 merge accumulator / XXH64-Akkumulator zusammenführen
+ */
+static uint64_t xxh64_merge(uint64_t acc, uint64_t value) {
+    acc ^= xxh64_round(0, value);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/**
+ * @brief 计算XXH64内容哈希（种子0） / Compute XXH64 content hash (seed 0) / XXH64-Inhalts-Hash berechnen (Seed 0)
+ * @details 每轮处理32字节，比逐字节的FNV-1a快一个数量级，适合大型库文件 / Processes 32 bytes per round, an order of magnitude faster than byte-wise FNV-1a, suited to large library files / Verarbeitet 32 Bytes pro Runde, eine Größenordnung schneller als byteweises FNV-1a, geeignet für große Bibliotheksdateien
+ */
+static uint64_t hash_validation_db_content(const unsigned char* data, size_t size) {
+    const unsigned char* p = data;
+    const unsigned char* end = data + size;
+    uint64_t hash;
+    
+    if (size >= 32) {
+        uint64_t v1 = XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = XXH_PRIME64_2;
+        uint64_t v3 = 0;
+        uint64_t v4 = 0 - XXH_PRIME64_1;
+        do {
+            v1 = xxh64_round(v1, read_u64(p));
+            v2 = xxh64_round(v2, read_u64(p + 8));
+            v3 = xxh64_round(v3, read_u64(p + 16));
+            v4 = xxh64_round(v4, read_u64(p + 24));
+            p += 32;
+        } while ((size_t)(end - p) >= 32);
+        hash = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        hash = xxh64_merge(hash, v1);
+        hash = xxh64_merge(hash, v2);
+        hash = xxh64_merge(hash, v3);
+        hash = xxh64_merge(hash, v4);
+    } else {
+        hash = XXH_PRIME64_5;
+    }
+    hash += (uint64_t)size;
+    
+    while ((size_t)(end - p) >= 8) {
+        hash ^= xxh64_round(0, read_u64(p));
+        hash = rotl64(hash, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        p += 8;
+    }
+    if ((size_t)(end - p) >= 4) {
+        hash ^= read_u32(p) * XXH_PRIME64_1;
+        hash = rotl64(hash, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    while (p < end) {
+        hash ^= (uint64_t)(*p) * XXH_PRIME64_5;
+        hash = rotl64(hash, 11) * XXH_PRIME64_1;
+        p++;
+    }
+    
+    hash ^= hash >> 33;
+    hash *= XXH_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= XXH_PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/**
+ * @brief 计算路径哈希（FNV-1a，写入文件） / Compute path hash (FNV-1a, stored in the file) / Pfad-Hash berechnen (FNV-1a, in der Datei gespeichert)
+ */
+uint64_t hash_validation_db_path(const char* plugin_path) {
+    uint64_t hash = 14695981039346656037ULL;
+    if (plugin_path == NULL) {
+        return hash;
+    }
+    
+    for (const unsigned char* p = (const unsigned char*)plugin_path; *p != '\0'; p++) {
+        hash ^= (uint64_t)*p;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief 计算插件文件标识 / Compute plugin file stamp / Plugin-Dateistempel berechnen
+ */
+int compute_validation_db_stamp(const char* plugin_path, validation_db_stamp_t* stamp_out) {
+    if (plugin_path == NULL || stamp_out == NULL) {
+        return -1;
+    }
+    
+    memset(stamp_out, 0, sizeof(validation_db_stamp_t));
+    if (pt_platform_get_file_timestamp(plugin_path, &stamp_out->mtime) != 0) {
+        return -1;
+    }
+    
+    pt_platform_file_map_t* map = pt_platform_file_map_open(plugin_path);
+    if (map == NULL) {
+        return -1;
+    }
+    const unsigned char* data = (const unsigned char*)pt_platform_file_map_data(map);
+    size_t size = pt_platform_file_map_size(map);
+    stamp_out->size = (uint64_t)size;
+    stamp_out->hash = hash_validation_db_content(data != NULL ? data : (const unsigned char*)"", data != NULL ? size : 0);
+    pt_platform_file_map_close(map);
+    return 0;
+}
+
+/**
+ * @brief 校验.nxpvdb文件头和记录 / Validate .nxpvdb header and records / .nxpvdb-Kopf und Datensätze validieren
+ * @return 有效返回0，否则返回-1 / Returns 0 if valid, -1 otherwise / Gibt 0 zurück wenn gültig, sonst -1
+ */
+static int validate_validation_db(const unsigned char* data, size_t size, const validation_db_header_t* header) {
+    if (header->magic != VALIDATION_DB_MAGIC || header->version != VALIDATION_DB_VERSION ||
+        header->header_size != sizeof(validation_db_header_t) ||
+        header->record_size != sizeof(validation_db_plugin_record_t) ||
+        header->interface_record_size != sizeof(validation_db_interface_record_t) ||
+        header->metadata_record_size != sizeof(validation_db_metadata_record_t) ||
+        header->file_size != (uint64_t)size) {
+        return -1;
+    }
+    
+    /* 各段必须首尾相接且在文件内（参数类型数组补齐到8字节） / Sections must be contiguous and inside the file (the parameter type array is padded to 8 bytes) / Abschnitte müssen zusammenhängend und innerhalb der Datei liegen (das Parametertyp-Array wird auf 8 Bytes aufgefüllt) */
+    uint64_t plugin_count = header->plugin_count;
+    uint64_t interface_count = header->interface_count;
+    uint64_t metadata_count = header->metadata_count;
+    uint64_t param_type_count = header->param_type_count;
+    if (plugin_count > (uint64_t)size / sizeof(validation_db_plugin_record_t) ||
+        interface_count > (uint64_t)size / sizeof(validation_db_interface_record_t) ||
+        metadata_count > (uint64_t)size / sizeof(validation_db_metadata_record_t) ||
+        param_type_count > (uint64_t)size / sizeof(int32_t)) {
+        return -1;
+    }
+    uint64_t param_types_size = (param_type_count * sizeof(int32_t) + 7) & ~(uint64_t)7;
+    if (header->plugins_offset != sizeof(validation_db_header_t) ||
+        header->interfaces_offset != header->plugins_offset + plugin_count * sizeof(validation_db_plugin_record_t) ||
+        header->metadata_offset != header->interfaces_offset + interface_count * sizeof(validation_db_interface_record_t) ||
+        header->param_types_offset != header->metadata_offset + metadata_count * sizeof(validation_db_metadata_record_t) ||
+        header->pool_offset != header->param_types_offset + param_types_size ||
+        header->pool_offset > (uint64_t)size ||
+        header->pool_size > (uint64_t)size - header->pool_offset) {
+        return -1;
+    }
+    
+    /* 池以NUL结尾，所有偏移在池内即可保证字符串终止 / The pool ends with NUL, so in-pool offsets guarantee termination / Der Pool endet mit NUL, daher garantieren Offsets im Pool die Terminierung */
+    const char* pool = (const char*)(data + header->pool_offset);
+    if (header->pool_size > 0 && pool[header->pool_size - 1] != '\0') {
+        return -1;
+    }
+    
+    /* 记录必须按路径哈希排序，查找才能二分 / Records must be sorted by path hash for binary search / Datensätze müssen für die binäre Suche nach Pfad-Hash sortiert sein */
+    const validation_db_plugin_record_t* plugins = (const validation_db_plugin_record_t*)(data + header->plugins_offset);
+    for (uint64_t i = 0; i < plugin_count; i++) {
+        if ((uint64_t)plugins[i].path >= header->pool_size ||
+            (uint64_t)plugins[i].interface_first > interface_count ||
+            (uint64_t)plugins[i].interface_count > interface_count - plugins[i].interface_first ||
+            (uint64_t)plugins[i].metadata_first > metadata_count ||
+            (uint64_t)plugins[i].metadata_count > metadata_count - plugins[i].metadata_first ||
+            (i > 0 && plugins[i - 1].path_hash > plugins[i].path_hash)) {
+            return -1;
+        }
+    }
+    
+    const validation_db_interface_record_t* interfaces = (const validation_db_interface_record_t*)(data + header->interfaces_offset);
+    for (uint64_t i = 0; i < interface_count; i++) {
+        if ((uint64_t)interfaces[i].name >= header->pool_size) {
+            return -1;
+        }
+    }
+    
+    const validation_db_metadata_record_t* metadata = (const validation_db_metadata_record_t*)(data + header->metadata_offset);
+    for (uint64_t i = 0; i < metadata_count; i++) {
+        if ((uint64_t)metadata[i].name >= header->pool_size ||
+            (uint64_t)metadata[i].param_type_first > param_type_count ||
+            (uint64_t)metadata[i].param_type_count > param_type_count - metadata[i].param_type_first) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 映射并校验数据库文件，替换当前映射 / Map and validate the database file, replacing the current mapping / Datenbankdatei zuordnen und validieren, aktuelle Zuordnung ersetzen
+ */
+int map_validation_db(validation_db_t* db) {
+    if (db == NULL) {
+        return -1;
+    }
+    
+    if (db->map != NULL) {
+        pt_platform_file_map_close((pt_platform_file_map_t*)db->map);
+    }
+    db->map = NULL;
+    db->data = NULL;
+    memset(&db->header, 0, sizeof(validation_db_header_t));
+    
+    pt_platform_file_map_t* map = pt_platform_file_map_open(db->db_path);
+    if (map == NULL) {
+        return -1;
+    }
+    
+    const unsigned char* data = (const unsigned char*)pt_platform_file_map_data(map);
+    size_t size = pt_platform_file_map_size(map);
+    validation_db_header_t header;
+    if (data == NULL || size < sizeof(validation_db_header_t)) {
+        pt_platform_file_map_close(map);
+        internal_log_write("WARNING", "Ignoring truncated validation database %s", db->db_path);
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (validate_validation_db(data, size, &header) != 0) {
+        pt_platform_file_map_close(map);
+        internal_log_write("WARNING", "Ignoring invalid validation database %s", db->db_path);
+        return -1;
+    }
+    
+    db->map = map;
+    db->data = data;
+    db->header = header;
+    return 0;
+}
+
+/**
+ * @brief 从插件路径取目录 / Take directory from plugin path / Verzeichnis aus Plugin-Pfad nehmen
+ * @return 新分配的目录（调用者释放），失败返回NULL / Newly allocated directory (caller frees), NULL on failure / Neu zugewiesenes Verzeichnis (Aufrufer gibt frei), NULL bei Fehler
+ */
+static char* copy_plugin_directory(const char* plugin_path) {
+    const char* last_slash = strrchr(plugin_path, '/');
+#ifdef _WIN32
+    const char* last_backslash = strrchr(plugin_path, '\\');
+    if (last_backslash != NULL && (last_slash == NULL || last_backslash > last_slash)) {
+        last_slash = last_backslash;
+    }
+#endif
+    
+    size_t dir_len = last_slash != NULL ? (size_t)(last_slash - plugin_path) : 1;
+    char* dir_path = (char*)malloc(dir_len + 1);
+    if (dir_path == NULL) {
+        return NULL;
+    }
+    if (last_slash != NULL) {
+        memcpy(dir_path, plugin_path, dir_len);
+    } else {
+        dir_path[0] = '.';
+    }
+    dir_path[dir_len] = '\0';
+    return dir_path;
+}
+
+/**
+ * @brief 打开目录的数据库（不存在时映射为空） / Open the directory's database (empty when the file is missing) / Datenbank des Verzeichnisses öffnen (leer, wenn die Datei fehlt)
+ */
+static validation_db_t* open_validation_db(char* dir_path) {
+    validation_db_t* db = (validation_db_t*)calloc(1, sizeof(validation_db_t));
+    size_t dir_len = strlen(dir_path);
+    size_t name_len = strlen(VALIDATION_DB_FILE_NAME);
+    char* db_path = (char*)malloc(dir_len + name_len + 2);
+    if (db == NULL || db_path == NULL) {
+        internal_log_write("ERROR", "open_validation_db: failed to allocate database for %s", dir_path);
+        free(db);
+        free(db_path);
+        free(dir_path);
+        return NULL;
+    }
+    memcpy(db_path, dir_path, dir_len);
+    db_path[dir_len] = '/';
+    memcpy(db_path + dir_len + 1, VALIDATION_DB_FILE_NAME, name_len + 1);
+    
+    db->dir_path = dir_path;
+    db->db_path = db_path;
+    if (map_validation_db(db) == 0) {
+        internal_log_write("INFO", "Mapped validation database %s: %llu plugins, %llu interfaces, %llu cached metadata records",
+                          db_path, (unsigned long long)db->header.plugin_count, (unsigned long long)db->header.interface_count,
+                          (unsigned long long)db->header.metadata_count);
+    }
+    return db;
+}
+
+/**
+ * @brief 创建验证数据库锁 / Create validation database lock / Sperre der Validierungsdatenbank erstellen
+ */
+int init_validation_db_lock(void) {
+    if (g_validation_db_lock == NULL) {
+        g_validation_db_lock = pt_platform_mutex_create();
+    }
+    if (g_validation_db_lock == NULL) {
+        internal_log_write("ERROR", "init_validation_db_lock: failed to create validation database lock");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 关闭所有验证数据库并释放锁 / Close all validation databases and free the lock / Alle Validierungsdatenbanken schließen und Sperre freigeben
+ */
+void close_validation_databases(void) {
+    validation_db_t* db = g_validation_dbs;
+    while (db != NULL) {
+        validation_db_t* next = db->next;
+        if (db->map != NULL) {
+            pt_platform_file_map_close((pt_platform_file_map_t*)db->map);
+        }
+        free_plugin_manifest(&db->manifest);
+        free(db->dir_path);
+        free(db->db_path);
+        free(db);
+        db = next;
+    }
+    g_validation_dbs = NULL;
+    
+    if (g_validation_db_lock != NULL) {
+        pt_platform_mutex_destroy(g_validation_db_lock);
+        g_validation_db_lock = NULL;
+    }
+}
+
+/**
+ * @brief 获取插件所在目录的验证数据库并加锁 / Get and lock the validation database of the plugin's directory / Validierungsdatenbank des Plugin-Verzeichnisses abrufen und sperren
+ */
+validation_db_t* acquire_validation_db(const char* plugin_path) {
+    if (plugin_path == NULL || g_validation_db_lock == NULL) {
+        return NULL;
+    }
+    
+    char* dir_path = copy_plugin_directory(plugin_path);
+    if (dir_path == NULL) {
+        return NULL;
+    }
+    
+    pt_platform_mutex_lock(g_validation_db_lock);
+    for (validation_db_t* db = g_validation_dbs; db != NULL; db = db->next) {
+        if (strcmp(db->dir_path, dir_path) == 0) {
+            free(dir_path);
+            return db;
+        }
+    }
+    
+    validation_db_t* db = open_validation_db(dir_path);
+    if (db == NULL) {
+        pt_platform_mutex_unlock(g_validation_db_lock);
+        return NULL;
+    }
+    db->next = g_validation_dbs;
+    g_validation_dbs = db;
+    return db;
+}
+
+/**
+ * @brief 解锁验证数据库 / Unlock validation database / Validierungsdatenbank entsperren
+ */
+void release_validation_db(validation_db_t* db) {
+    if (db == NULL || g_validation_db_lock == NULL) {
+        return;
+    }
+    
+    pt_platform_mutex_unlock(g_validation_db_lock);
+}
+
+/**
+ * @brief 在映射中查找插件记录 / Look up plugin record in the mapping / Plugin-Datensatz in der Zuordnung suchen
+ * @details 按路径哈希二分查找，哈希相同时比较路径 / Binary search by path hash, comparing paths on equal hashes / Binäre Suche nach Pfad-Hash, bei gleichem Hash werden Pfade verglichen
+ */
+const validation_db_plugin_record_t* find_validation_db_plugin(const validation_db_t* db, const char* plugin_path) {
+    if (db == NULL || db->data == NULL || plugin_path == NULL || db->header.plugin_count == 0) {
+        return NULL;
+    }
+    
+    const validation_db_plugin_record_t* plugins = (const validation_db_plugin_record_t*)(db->data + db->header.plugins_offset);
+    const char* pool = (const char*)(db->data + db->header.pool_offset);
+    uint64_t hash = hash_validation_db_path(plugin_path);
+    size_t low = 0;
+    size_t high = (size_t)db->header.plugin_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (plugins[mid].path_hash < hash) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    
+    for (size_t i = low; i < (size_t)db->header.plugin_count && plugins[i].path_hash == hash; i++) {
+        if (strcmp(pool + plugins[i].path, plugin_path) == 0) {
+            return &plugins[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 在插件记录中查找接口记录 / Look up interface record in plugin record / Schnittstellendatensatz im Plugin-Datensatz suchen
+ */
+const validation_db_interface_record_t* find_validation_db_interface(const validation_db_t* db, const validation_db_plugin_record_t* plugin, const char* interface_name) {
+    if (db == NULL || db->data == NULL || plugin == NULL || interface_name == NULL) {
+        return NULL;
+    }
+    
+    const validation_db_interface_record_t* interfaces = (const validation_db_interface_record_t*)(db->data + db->header.interfaces_offset);
+    const char* pool = (const char*)(db->data + db->header.pool_offset);
+    for (uint32_t i = 0; i < plugin->interface_count; i++) {
+        const validation_db_interface_record_t* record = &interfaces[plugin->interface_first + i];
+        if (strcmp(pool + record->name, interface_name) == 0) {
+            return record;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 在插件记录中查找元数据记录 / Look up metadata record in plugin record / Metadatendatensatz im Plugin-Datensatz suchen
+ */
+const validation_db_metadata_record_t* find_validation_db_metadata(const validation_db_t* db, const validation_db_plugin_record_t* plugin, const char* interface_name) {
+    if (db == NULL || db->data == NULL || plugin == NULL || interface_name == NULL) {
+        return NULL;
+    }
+    
+    const validation_db_metadata_record_t* metadata = (const validation_db_metadata_record_t*)(db->data + db->header.metadata_offset);
+    const char* pool = (const char*)(db->data + db->header.pool_offset);
+    for (uint32_t i = 0; i < plugin->metadata_count; i++) {
+        const validation_db_metadata_record_t* record = &metadata[plugin->metadata_first + i];
+        if (strcmp(pool + record->name, interface_name) == 0) {
+            return record;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 取元数据记录的参数类型 / Get parameter types of a metadata record / Parametertypen eines Metadatendatensatzes abrufen
+ */
+const int32_t* get_validation_db_param_types(const validation_db_t* db, const validation_db_metadata_record_t* record) {
+    if (db == NULL || db->data == NULL || record == NULL || record->param_type_count == 0) {
+        return NULL;
+    }
+    
+    return (const int32_t*)(db->data + db->header.param_types_offset) + record->param_type_first;
+}
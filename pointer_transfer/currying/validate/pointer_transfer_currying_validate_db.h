@@ -0,0 +1,293 @@
+/**
+ * @file pointer_transfer_currying_validate_db.h
+ * @brief 插件验证数据库（.nxpvdb）接口 / Plugin Validation Database (.nxpvdb) Interface / Schnittstelle der Plugin-Validierungsdatenbank (.nxpvdb)
+ */
+
+#ifndef POINTER_TRANSFER_CURRYING_VALIDATE_DB_H
+#define POINTER_TRANSFER_CURRYING_VALIDATE_DB_H
+
+#include "pointer_transfer_types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/* .nxpvdb文件格式常量 / .nxpvdb file format constants / .nxpvdb-Dateiformatkonstanten */
+#define VALIDATION_DB_MAGIC 0x4256504EU        /* "NPVB" 小端 / little-endian / Little-Endian */
+#define VALIDATION_DB_VERSION 2U
+#define VALIDATION_DB_FILE_NAME "plugins.nxpvdb"
+    
+/* 目录清单默认库数量上限 / Default library limit of a directory manifest / Standardmäßige Bibliotheksgrenze eines Verzeichnismanifests */
+#define PLUGIN_MANIFEST_DEFAULT_MAX_ENTRIES 4096
+    
+/**
+ * @brief 插件文件标识（大小、修改时间、内容哈希） / Plugin file stamp (size, mtime, content hash) / Plugin-Dateistempel (Größe, Änderungszeit, Inhalts-Hash)
+ */
+typedef struct {
+    uint64_t size;                 /**< 文件大小 / File size / Dateigröße */
+    int64_t mtime;                 /**< 修改时间 / Modification time / Änderungszeit */
+    uint64_t hash;                 /**< 内容XXH64哈希 / Content XXH64 hash / XXH64-Hash des Inhalts */
+} validation_db_stamp_t;
+    
+/**
+ * @brief .nxpvdb文件头 / .nxpvdb file header / .nxpvdb-Dateikopf
+ * @details 布局：文件头、按路径哈希排序的插件记录、接口记录、元数据记录、参数类型数组、字符串池；偏移量均为8字节对齐 / Layout: header, plugin records sorted by path hash, interface records, metadata records, parameter type array, string pool; offsets are 8-byte aligned / Aufbau: Kopf, nach Pfad-Hash sortierte Plugin-Datensätze, Schnittstellendatensätze, Metadatendatensätze, Parametertyp-Array, Zeichenfolgenpool; Offsets sind 8-Byte-ausgerichtet
+ */
+typedef struct {
+    uint32_t magic;                /**< 魔数 / Magic number / Magische Zahl */
+    uint32_t version;              /**< 格式版本 / Format version / Formatversion */
+    uint32_t header_size;          /**< 文件头大小 / Header size / Kopfgröße */
+    uint32_t record_size;          /**< 插件记录大小 / Plugin record size / Plugin-Datensatzgröße */
+    uint32_t interface_record_size; /**< 接口记录大小 / Interface record size / Schnittstellendatensatzgröße */
+    uint32_t metadata_record_size; /**< 元数据记录大小 / Metadata record size / Metadatendatensatzgröße */
+    uint64_t file_size;            /**< 整个文件大小（检测截断） / Whole file size (detects truncation) / Gesamte Dateigröße (erkennt Abschneiden) */
+    uint64_t plugin_count;         /**< 插件记录数量 / Plugin record count / Anzahl der Plugin-Datensätze */
+    uint64_t plugins_offset;       /**< 插件记录偏移 / Plugin records offset / Offset der Plugin-Datensätze */
+    uint64_t interface_count;      /**< 接口记录数量 / Interface record count / Anzahl der Schnittstellendatensätze */
+    uint64_t interfaces_offset;    /**< 接口记录偏移 / Interface records offset / Offset der Schnittstellendatensätze */
+    uint64_t metadata_count;       /**< 元数据记录数量 / Metadata record count / Anzahl der Metadatendatensätze */
+    uint64_t metadata_offset;      /**< 元数据记录偏移 / Metadata records offset / Offset der Metadatendatensätze */
+    uint64_t param_type_count;     /**< 参数类型数量 / Parameter type count / Anzahl der Parametertypen */
+    uint64_t param_types_offset;   /**< 参数类型数组偏移 / Parameter type array offset / Offset des Parametertyp-Arrays */
+    uint64_t pool_offset;          /**< 字符串池偏移 / String pool offset / Offset des Zeichenfolgenpools */
+    uint64_t pool_size;            /**< 字符串池大小 / String pool size / Größe des Zeichenfolgenpools */
+} validation_db_header_t;
+    
+/**
+ * @brief .nxpvdb插件记录 / .nxpvdb plugin record / .nxpvdb-Plugin-Datensatz
+ */
+typedef struct {
+    uint64_t path_hash;            /**< 路径哈希（排序键） / Path hash (sort key) / Pfad-Hash (Sortierschlüssel) */
+    validation_db_stamp_t stamp;   /**< 验证时的文件标识 / File stamp at validation time / Dateistempel zum Validierungszeitpunkt */
+    uint32_t path;                 /**< 路径的字符串池偏移 / String pool offset of the path / Zeichenfolgenpool-Offset des Pfads */
+    uint32_t interface_first;      /**< 第一个接口记录序号 / First interface record number / Nummer des ersten Schnittstellendatensatzes */
+    uint32_t interface_count;      /**< 接口记录数量（0=尚未验证） / Interface record count (0=not validated yet) / Anzahl der Schnittstellendatensätze (0=noch nicht validiert) */
+    uint32_t metadata_first;       /**< 第一个元数据记录序号 / First metadata record number / Nummer des ersten Metadatendatensatzes */
+    uint32_t metadata_count;       /**< 元数据记录数量 / Metadata record count / Anzahl der Metadatendatensätze */
+    uint32_t reserved;             /**< 保留 / Reserved / Reserviert */
+} validation_db_plugin_record_t;
+    
+/**
+ * @brief .nxpvdb接口记录（验证结果和元数据） / .nxpvdb interface record (validation result and metadata) / .nxpvdb-Schnittstellendatensatz (Validierungsergebnis und Metadaten)
+ */
+typedef struct {
+    uint32_t name;                 /**< 接口名的字符串池偏移 / String pool offset of the interface name / Zeichenfolgenpool-Offset des Schnittstellennamens */
+    int32_t param_count;           /**< 参数数量 / Parameter count / Parameteranzahl */
+    int32_t return_type;           /**< 返回值类型（pt_return_type_t） / Return type (pt_return_type_t) / Rückgabetyp (pt_return_type_t) */
+    int32_t valid;                 /**< 验证结果（1=通过，0=失败） / Validation result (1=passed, 0=failed) / Validierungsergebnis (1=bestanden, 0=fehlgeschlagen) */
+} validation_db_interface_record_t;
+    
+/**
+ * @brief .nxpvdb元数据记录（创建接口状态所需的已解析元数据） / .nxpvdb metadata record (resolved metadata needed to create an interface state) / .nxpvdb-Metadatendatensatz (aufgelöste Metadaten zum Erstellen eines Schnittstellenstatus)
+ */
+typedef struct {
+    uint32_t name;                 /**< 接口名的字符串池偏移 / String pool offset of the interface name / Zeichenfolgenpool-Offset des Schnittstellennamens */
+    int32_t return_type;           /**< 推断的返回值类型（pt_return_type_t） / Inferred return type (pt_return_type_t) / Abgeleiteter Rückgabetyp (pt_return_type_t) */
+    uint64_t return_size;          /**< 返回值大小（仅描述符结构体非0） / Return size (non-zero only for descriptor structs) / Rückgabegröße (nur bei Deskriptor-Strukturen ungleich 0) */
+    uint64_t interface_index;      /**< 插件中的接口索引 / Interface index in the plugin / Schnittstellenindex im Plugin */
+    int32_t param_count_type;      /**< 参数数量类型（nxld_param_count_type_t） / Parameter count type (nxld_param_count_type_t) / Parameteranzahl-Typ (nxld_param_count_type_t) */
+    int32_t min_count;             /**< 最小参数数量 / Minimum parameter count / Mindestparameteranzahl */
+    int32_t max_count;             /**< 最大参数数量 / Maximum parameter count / Maximalparameteranzahl */
+    uint32_t param_type_first;     /**< 第一个参数类型序号 / First parameter type number / Nummer des ersten Parametertyps */
+    uint32_t param_type_count;     /**< 参数类型数量 / Parameter type count / Anzahl der Parametertypen */
+    uint16_t call_convention;      /**< 调用约定（nxld_call_convention_t，旧记录为0即参数包） / Calling convention (nxld_call_convention_t, 0 in older records means pack) / Aufrufkonvention (nxld_call_convention_t, 0 in älteren Datensätzen bedeutet Paket) */
+    uint16_t native_return_type;   /**< 声明的返回值类型（nxld_return_type_t） / Declared return type (nxld_return_type_t) / Deklarierter Rückgabetyp (nxld_return_type_t) */
+} validation_db_metadata_record_t;
+    
+/**
+ * @brief 目录清单中的库 / Library in a directory manifest / Bibliothek in einem Verzeichnismanifest
+ */
+typedef struct {
+    char* path;                    /**< 库路径 / Library path / Bibliothekspfad */
+    uint64_t path_hash;            /**< 路径哈希 / Path hash / Pfad-Hash */
+    uint64_t size;                 /**< 文件大小 / File size / Dateigröße */
+    int64_t mtime;                 /**< 修改时间 / Modification time / Änderungszeit */
+    int present;                   /**< 文件存在标志（删除后保留条目） / File present flag (entries stay after deletion) / Flag für vorhandene Datei (Einträge bleiben nach dem Löschen) */
+    int synced;                    /**< 已与数据库记录核对 / Checked against the database record / Mit dem Datenbankeintrag abgeglichen */
+    uint32_t scan_generation;      /**< 最后一次出现的扫描轮次 / Scan round that last saw the file / Scan-Durchlauf, der die Datei zuletzt gesehen hat */
+} plugin_manifest_entry_t;
+    
+/**
+ * @brief 插件目录清单（一次扫描，之后由目录监视增量更新） / Plugin directory manifest (scanned once, then updated incrementally by the directory watcher) / Plugin-Verzeichnismanifest (einmal gescannt, danach inkrementell durch die Verzeichnisüberwachung aktualisiert)
+ */
+typedef struct {
+    plugin_manifest_entry_t* entries; /**< 条目数组 / Entry array / Eintrags-Array */
+    size_t count;                  /**< 条目数量 / Entry count / Eintragsanzahl */
+    size_t capacity;               /**< 条目容量 / Entry capacity / Eintragskapazität */
+    size_t* slots;                 /**< 开放寻址索引（条目序号+1，0=空） / Open addressing index (entry number+1, 0=empty) / Offene Adressierungsindex (Eintragsnummer+1, 0=leer) */
+    size_t slot_count;             /**< 槽位数量（2的幂） / Slot count (power of two) / Slot-Anzahl (Zweierpotenz) */
+    size_t max_entries;            /**< 条目上限 / Entry limit / Eintragsgrenze */
+    uint32_t scan_generation;      /**< 当前扫描轮次 / Current scan round / Aktueller Scan-Durchlauf */
+    int built;                     /**< 已扫描标志 / Scanned flag / Flag für gescannt */
+    int needs_rescan;              /**< 监视器要求重新扫描 / Watcher requested a rescan / Überwachung hat einen Neuscan angefordert */
+    int limit_reported;            /**< 已报告超出上限 / Limit overflow already reported / Überschreitung der Grenze bereits gemeldet */
+    void* watch;                   /**< 目录监视器（不可用时为NULL） / Directory watcher (NULL when unavailable) / Verzeichnisüberwachung (NULL, wenn nicht verfügbar) */
+} plugin_manifest_t;
+    
+/**
+ * @brief 一个插件目录的已映射验证数据库 / Mapped validation database of one plugin directory / Zugeordnete Validierungsdatenbank eines Plugin-Verzeichnisses
+ */
+typedef struct validation_db_s {
+    char* dir_path;                /**< 插件目录 / Plugin directory / Plugin-Verzeichnis */
+    char* db_path;                 /**< .nxpvdb路径 / .nxpvdb path / .nxpvdb-Pfad */
+    void* map;                     /**< 文件映射（文件不存在或无效时为NULL） / File mapping (NULL when the file is missing or invalid) / Dateizuordnung (NULL, wenn die Datei fehlt oder ungültig ist) */
+    const unsigned char* data;     /**< 映射数据 / Mapped data / Zugeordnete Daten */
+    validation_db_header_t header; /**< 文件头副本（无映射时全为0） / Header copy (all zero without mapping) / Kopie des Dateikopfs (ohne Zuordnung alles 0) */
+    plugin_manifest_t manifest;    /**< 目录清单 / Directory manifest / Verzeichnismanifest */
+    struct validation_db_s* next;  /**< 下一个数据库 / Next database / Nächste Datenbank */
+} validation_db_t;
+    
+/**
+ * @brief 验证数据库修改事务（不透明类型） / Validation database edit transaction (opaque type) / Änderungstransaktion der Validierungsdatenbank (opaker Typ)
+ */
+typedef struct validation_db_edit_s validation_db_edit_t;
+    
+/**
+ * @brief 计算路径哈希（FNV-1a，写入文件） / Compute path hash (FNV-1a, stored in the file) / Pfad-Hash berechnen (FNV-1a, in der Datei gespeichert)
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @return 哈希值 / Hash value / Hash-Wert
+ */
+uint64_t hash_validation_db_path(const char* plugin_path);
+    
+/**
+ * @brief 计算插件文件标识 / Compute plugin file stamp / Plugin-Dateistempel berechnen
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @param stamp_out 输出标识 / Output stamp / Ausgabe-Stempel
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int compute_validation_db_stamp(const char* plugin_path, validation_db_stamp_t* stamp_out);
+    
+/**
+ * @brief 获取插件所在目录的验证数据库并加锁 / Get and lock the validation database of the plugin's directory / Validierungsdatenbank des Plugin-Verzeichnisses abrufen und sperren
+ * @details 首次使用时映射文件，之后所有查询直接读取映射；必须用release_validation_db解锁 / Maps the file on first use, later lookups read the mapping directly; must be unlocked with release_validation_db / Bildet die Datei bei der ersten Verwendung ab, spätere Abfragen lesen die Zuordnung direkt; muss mit release_validation_db entsperrt werden
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @return 数据库（文件不存在时为空数据库），失败返回NULL且不加锁 / Database (empty when the file does not exist), NULL without lock on failure / Datenbank (leer, wenn die Datei nicht existiert), NULL ohne Sperre bei Fehler
+ */
+validation_db_t* acquire_validation_db(const char* plugin_path);
+    
+/**
+ * @brief 解锁验证数据库 / Unlock validation database / Validierungsdatenbank entsperren
+ * @param db 数据库 / Database / Datenbank
+ */
+void release_validation_db(validation_db_t* db);
+    
+/**
+ * @brief 映射并校验数据库文件，替换当前映射 / Map and validate the database file, replacing the current mapping / Datenbankdatei zuordnen und validieren, aktuelle Zuordnung ersetzen
+ * @param db 已加锁的数据库 / Locked database / Gesperrte Datenbank
+ * @return 映射有效返回0，文件缺失或无效返回-1（数据库视为空） / Returns 0 for a valid mapping, -1 if the file is missing or invalid (database treated as empty) / Gibt 0 bei gültiger Zuordnung zurück, -1 wenn die Datei fehlt oder ungültig ist (Datenbank gilt als leer)
+ */
+int map_validation_db(validation_db_t* db);
+    
+    
+/**
+ * @brief 更新目录清单 / Refresh directory manifest / Verzeichnismanifest aktualisieren
+ * @details 首次调用扫描目录并开始监视，之后只取出监视器的变化，不再扫描 / The first call scans the directory and starts watching, later calls only drain the watcher and never rescan / Der erste Aufruf scannt das Verzeichnis und startet die Überwachung, spätere Aufrufe holen nur die Änderungen der Überwachung ab und scannen nie erneut
+ * @param db 已加锁的数据库 / Locked database / Gesperrte Datenbank
+ * @return 成功返回0，无法扫描目录返回-1 / Returns 0 on success, -1 if the directory cannot be scanned / Gibt 0 bei Erfolg zurück, -1 wenn das Verzeichnis nicht gescannt werden kann
+ */
+int refresh_plugin_manifest(validation_db_t* db);
+    
+/**
+ * @brief 在目录清单中查找库 / Find library in directory manifest / Bibliothek im Verzeichnismanifest suchen
+ * @param db 已加锁的数据库 / Locked database / Gesperrte Datenbank
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @return 条目，未找到返回NULL / Entry, NULL if not found / Eintrag, NULL wenn nicht gefunden
+ */
+plugin_manifest_entry_t* find_plugin_manifest_entry(validation_db_t* db, const char* plugin_path);
+    
+/**
+ * @brief 释放目录清单 / Free directory manifest / Verzeichnismanifest freigeben
+ * @param manifest 目录清单 / Directory manifest / Verzeichnismanifest
+ */
+void free_plugin_manifest(plugin_manifest_t* manifest);
+    
+/**
+ * @brief 在映射中查找插件记录 / Look up plugin record in the mapping / Plugin-Datensatz in der Zuordnung suchen
+ * @param db 数据库 / Database / Datenbank
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @return 记录指针（指向映射，下次提交前有效），未找到返回NULL / Record pointer (into the mapping, valid until the next commit), NULL if not found / Datensatzzeiger (in die Zuordnung, gültig bis zum nächsten Commit), NULL wenn nicht gefunden
+ */
+const validation_db_plugin_record_t* find_validation_db_plugin(const validation_db_t* db, const char* plugin_path);
+    
+/**
+ * @brief 在插件记录中查找接口记录 / Look up interface record in plugin record / Schnittstellendatensatz im Plugin-Datensatz suchen
+ * @return 记录指针，未找到返回NULL / Record pointer, NULL if not found / Datensatzzeiger, NULL wenn nicht gefunden
+ */
+const validation_db_interface_record_t* find_validation_db_interface(const validation_db_t* db, const validation_db_plugin_record_t* plugin, const char* interface_name);
+    
+/**
+ * @brief 在插件记录中查找元数据记录 / Look up metadata record in plugin record / Metadatendatensatz im Plugin-Datensatz suchen
+ * @return 记录指针，未找到返回NULL / Record pointer, NULL if not found / Datensatzzeiger, NULL wenn nicht gefunden
+ */
+const validation_db_metadata_record_t* find_validation_db_metadata(const validation_db_t* db, const validation_db_plugin_record_t* plugin, const char* interface_name);
+    
+/**
+ * @brief 取元数据记录的参数类型 / Get parameter types of a metadata record / Parametertypen eines Metadatendatensatzes abrufen
+ * @return 参数类型数组（nxld_param_type_t值，指向映射），无参数返回NULL / Parameter type array (nxld_param_type_t values, into the mapping), NULL without parameters / Parametertyp-Array (nxld_param_type_t-Werte, in die Zuordnung), NULL ohne Parameter
+ */
+const int32_t* get_validation_db_param_types(const validation_db_t* db, const validation_db_metadata_record_t* record);
+    
+/**
+ * @brief 开始修改事务（复制当前所有记录） / Begin edit transaction (copies all current records) / Änderungstransaktion beginnen (kopiert alle aktuellen Datensätze)
+ * @param db 已加锁的数据库 / Locked database / Gesperrte Datenbank
+ * @return 事务，失败返回NULL / Transaction, NULL on failure / Transaktion, NULL bei Fehler
+ */
+validation_db_edit_t* begin_validation_db_edit(const validation_db_t* db);
+    
+/**
+ * @brief 在事务中设置插件标识 / Set plugin stamp in transaction / Plugin-Stempel in der Transaktion setzen
+ * @param edit 事务 / Transaction / Transaktion
+ * @param plugin_path 插件路径（不存在时新建记录） / Plugin path (creates the record if missing) / Plugin-Pfad (erstellt den Datensatz, falls er fehlt)
+ * @param stamp 新标识 / New stamp / Neuer Stempel
+ * @param keep_results 非0时保留已有接口结果和元数据（内容未变） / Non-zero keeps existing interface results and metadata (content unchanged) / Ungleich 0 behält vorhandene Schnittstellenergebnisse und Metadaten (Inhalt unverändert)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int set_validation_db_stamp(validation_db_edit_t* edit, const char* plugin_path, const validation_db_stamp_t* stamp, int keep_results);
+    
+/**
+ * @brief 在事务中记录接口验证结果 / Record interface validation result in transaction / Schnittstellen-Validierungsergebnis in der Transaktion speichern
+ * @param edit 事务 / Transaction / Transaktion
+ * @param plugin_path 插件路径（必须已有记录） / Plugin path (record must exist) / Plugin-Pfad (Datensatz muss existieren)
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @param param_count 参数数量 / Parameter count / Parameteranzahl
+ * @param return_type 返回值类型 / Return type / Rückgabetyp
+ * @param valid 验证结果 / Validation result / Validierungsergebnis
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int set_validation_db_interface(validation_db_edit_t* edit, const char* plugin_path, const char* interface_name,
+                                int param_count, pt_return_type_t return_type, int valid);
+    
+/**
+ * @brief 在事务中记录接口元数据 / Record interface metadata in transaction / Schnittstellen-Metadaten in der Transaktion speichern
+ * @param edit 事务 / Transaction / Transaktion
+ * @param plugin_path 插件路径（必须已有记录） / Plugin path (record must exist) / Plugin-Pfad (Datensatz muss existieren)
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @param metadata 元数据（忽略name和param_type_first） / Metadata (name and param_type_first are ignored) / Metadaten (name und param_type_first werden ignoriert)
+ * @param param_types 参数类型（metadata->param_type_count个） / Parameter types (metadata->param_type_count entries) / Parametertypen (metadata->param_type_count Einträge)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int set_validation_db_metadata(validation_db_edit_t* edit, const char* plugin_path, const char* interface_name,
+                               const validation_db_metadata_record_t* metadata, const int32_t* param_types);
+    
+/**
+ * @brief 提交事务：写临时文件、原子替换并重新映射 / Commit transaction: write temporary file, replace atomically and remap / Transaktion festschreiben: temporäre Datei schreiben, atomar ersetzen und neu zuordnen
+ * @details 事务总是被消耗；失败时数据库保持原状 / The transaction is always consumed; on failure the database is left unchanged / Die Transaktion wird immer verbraucht; bei Fehler bleibt die Datenbank unverändert
+ * @param db 已加锁的数据库 / Locked database / Gesperrte Datenbank
+ * @param edit 事务 / Transaction / Transaktion
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int commit_validation_db_edit(validation_db_t* db, validation_db_edit_t* edit);
+    
+/**
+ * @brief 放弃事务 / Discard transaction / Transaktion verwerfen
+ * @param edit 事务 / Transaction / Transaktion
+ */
+void discard_validation_db_edit(validation_db_edit_t* edit);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POINTER_TRANSFER_CURRYING_VALIDATE_DB_H */
@@ -0,0 +1,555 @@
+/**
+ * @file pointer_transfer_currying_validate_db_write.c
+ * @brief 插件验证数据库事务写入 / Plugin Validation Database Transactional Writer / Transaktionaler Schreiber der Plugin-Validierungsdatenbank
+ */
+
+#include "pointer_transfer_currying_validate_db.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 事务中的接口结果 / Interface result in a transaction / Schnittstellenergebnis in einer Transaktion
+ */
+typedef struct {
+    char* name;                    /**< 接口名称 / Interface name / Schnittstellenname */
+    int32_t param_count;           /**< 参数数量 / Parameter count / Parameteranzahl */
+    int32_t return_type;           /**< 返回值类型 / Return type / Rückgabetyp */
+    int32_t valid;                 /**< 验证结果 / Validation result / Validierungsergebnis */
+} validation_db_edit_interface_t;
+
+/**
+ * @brief 事务中的接口元数据 / Interface metadata in a transaction / Schnittstellen-Metadaten in einer Transaktion
+ */
+typedef struct {
+    char* name;                    /**< 接口名称 / Interface name / Schnittstellenname */
+    validation_db_metadata_record_t record; /**< 元数据（name和param_type_first写入时填写） / Metadata (name and param_type_first are filled in on write) / Metadaten (name und param_type_first werden beim Schreiben gesetzt) */
+    int32_t* param_types;          /**< 参数类型 / Parameter types / Parametertypen */
+} validation_db_edit_metadata_t;
+
+/**
+ * @brief 事务中的插件 / Plugin in a transaction / Plugin in einer Transaktion
+ */
+typedef struct {
+    char* path;                    /**< 插件路径 / Plugin path / Plugin-Pfad */
+    uint64_t path_hash;            /**< 路径哈希 / Path hash / Pfad-Hash */
+    validation_db_stamp_t stamp;   /**< 文件标识 / File stamp / Dateistempel */
+    validation_db_edit_interface_t* interfaces; /**< 接口结果 / Interface results / Schnittstellenergebnisse */
+    size_t interface_count;        /**< 接口数量 / Interface count / Schnittstellenanzahl */
+    size_t interface_capacity;     /**< 接口容量 / Interface capacity / Schnittstellenkapazität */
+    validation_db_edit_metadata_t* metadata; /**< 接口元数据 / Interface metadata / Schnittstellen-Metadaten */
+    size_t metadata_count;         /**< 元数据数量 / Metadata count / Metadatenanzahl */
+    size_t metadata_capacity;      /**< 元数据容量 / Metadata capacity / Metadatenkapazität */
+} validation_db_edit_plugin_t;
+
+/**
+ * @brief 验证数据库修改事务 / Validation database edit transaction / Änderungstransaktion der Validierungsdatenbank
+ */
+struct validation_db_edit_s {
+    validation_db_edit_plugin_t* plugins; /**< 插件 / Plugins / Plugins */
+    size_t plugin_count;           /**< 插件数量 / Plugin count / Plugin-Anzahl */
+    size_t plugin_capacity;        /**< 插件容量 / Plugin capacity / Plugin-Kapazität */
+    int changed;                   /**< 有修改标志（无修改时提交不写文件） / Changed flag (commit writes nothing without changes) / Änderungsflag (Commit schreibt ohne Änderungen nichts) */
+};
+
+/**
+ * @brief 确保数组容量 / Ensure array capacity / Array-Kapazität sicherstellen
+ */
+static int grow_edit_array(void** items, size_t* capacity, size_t count, size_t item_size) {
+    if (count < *capacity) {
+        return 0;
+    }
+    
+    size_t new_capacity = *capacity == 0 ? INITIAL_PLUGIN_CAPACITY : *capacity * CAPACITY_GROWTH_FACTOR;
+    if (new_capacity < *capacity || new_capacity > SIZE_MAX / item_size) {
+        internal_log_write("ERROR", "grow_edit_array: capacity overflow detected (current=%zu)", *capacity);
+        return -1;
+    }
+    void* new_items = realloc(*items, new_capacity * item_size);
+    if (new_items == NULL) {
+        internal_log_write("ERROR", "grow_edit_array: failed to allocate memory (new_capacity=%zu)", new_capacity);
+        return -1;
+    }
+    *items = new_items;
+    *capacity = new_capacity;
+    return 0;
+}
+
+/**
+ * @brief 清空插件的接口结果 / Clear plugin's interface results / Schnittstellenergebnisse des Plugins leeren
+ */
+static void clear_edit_interfaces(validation_db_edit_plugin_t* plugin) {
+    for (size_t i = 0; i < plugin->interface_count; i++) {
+        free(plugin->interfaces[i].name);
+    }
+    plugin->interface_count = 0;
+}
+
+/**
+ * @brief 清空插件的接口元数据 / Clear plugin's interface metadata / Schnittstellen-Metadaten des Plugins leeren
+ */
+static void clear_edit_metadata(validation_db_edit_plugin_t* plugin) {
+    for (size_t i = 0; i < plugin->metadata_count; i++) {
+        free(plugin->metadata[i].name);
+        free(plugin->metadata[i].param_types);
+    }
+    plugin->metadata_count = 0;
+}
+
+/**
+ * @brief 在事务中查找插件 / Find plugin in transaction / Plugin in der Transaktion suchen
+ */
+static validation_db_edit_plugin_t* find_edit_plugin(validation_db_edit_t* edit, const char* plugin_path, uint64_t hash) {
+    for (size_t i = 0; i < edit->plugin_count; i++) {
+        if (edit->plugins[i].path_hash == hash && strcmp(edit->plugins[i].path, plugin_path) == 0) {
+            return &edit->plugins[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 在事务中添加插件 / Add plugin to transaction / Plugin zur Transaktion hinzufügen
+ */
+static validation_db_edit_plugin_t* add_edit_plugin(validation_db_edit_t* edit, const char* plugin_path, uint64_t hash) {
+    if (grow_edit_array((void**)&edit->plugins, &edit->plugin_capacity, edit->plugin_count, sizeof(validation_db_edit_plugin_t)) != 0) {
+        return NULL;
+    }
+    
+    validation_db_edit_plugin_t* plugin = &edit->plugins[edit->plugin_count];
+    memset(plugin, 0, sizeof(validation_db_edit_plugin_t));
+    plugin->path = allocate_string(plugin_path);
+    if (plugin->path == NULL) {
+        return NULL;
+    }
+    plugin->path_hash = hash;
+    edit->plugin_count++;
+    return plugin;
+}
+
+/**
+ * @brief 在插件中添加接口结果 / Add interface result to plugin / Schnittstellenergebnis zum Plugin hinzufügen
+ */
+static validation_db_edit_interface_t* add_edit_interface(validation_db_edit_plugin_t* plugin, const char* interface_name) {
+    if (grow_edit_array((void**)&plugin->interfaces, &plugin->interface_capacity, plugin->interface_count, sizeof(validation_db_edit_interface_t)) != 0) {
+        return NULL;
+    }
+    
+    validation_db_edit_interface_t* record = &plugin->interfaces[plugin->interface_count];
+    memset(record, 0, sizeof(validation_db_edit_interface_t));
+    record->name = allocate_string(interface_name);
+    if (record->name == NULL) {
+        return NULL;
+    }
+    plugin->interface_count++;
+    return record;
+}
+
+/**
+ * @brief 在插件中添加或替换接口元数据 / Add or replace interface metadata in plugin / Schnittstellen-Metadaten im Plugin hinzufügen oder ersetzen
+ * @details 参数类型被复制 / The parameter types are copied / Die Parametertypen werden kopiert
+ */
+static int put_edit_metadata(validation_db_edit_plugin_t* plugin, const char* interface_name,
+                             const validation_db_metadata_record_t* source, const int32_t* param_types) {
+    int32_t* types_copy = NULL;
+    if (source->param_type_count > 0) {
+        if (param_types == NULL) {
+            return -1;
+        }
+        types_copy = (int32_t*)malloc((size_t)source->param_type_count * sizeof(int32_t));
+        if (types_copy == NULL) {
+            return -1;
+        }
+        memcpy(types_copy, param_types, (size_t)source->param_type_count * sizeof(int32_t));
+    }
+    
+    validation_db_edit_metadata_t* entry = NULL;
+    for (size_t i = 0; i < plugin->metadata_count; i++) {
+        if (strcmp(plugin->metadata[i].name, interface_name) == 0) {
+            entry = &plugin->metadata[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        if (grow_edit_array((void**)&plugin->metadata, &plugin->metadata_capacity, plugin->metadata_count, sizeof(validation_db_edit_metadata_t)) != 0) {
+            free(types_copy);
+            return -1;
+        }
+        entry = &plugin->metadata[plugin->metadata_count];
+        memset(entry, 0, sizeof(validation_db_edit_metadata_t));
+        entry->name = allocate_string(interface_name);
+        if (entry->name == NULL) {
+            free(types_copy);
+            return -1;
+        }
+        plugin->metadata_count++;
+    }
+    
+    free(entry->param_types);
+    entry->record = *source;
+    entry->record.name = 0;
+    entry->record.param_type_first = 0;
+    entry->param_types = types_copy;
+    return 0;
+}
+
+/**
+ * @brief 放弃事务 / Discard transaction / Transaktion verwerfen
+ */
+void discard_validation_db_edit(validation_db_edit_t* edit) {
+    if (edit == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < edit->plugin_count; i++) {
+        clear_edit_interfaces(&edit->plugins[i]);
+        clear_edit_metadata(&edit->plugins[i]);
+        free(edit->plugins[i].interfaces);
+        free(edit->plugins[i].metadata);
+        free(edit->plugins[i].path);
+    }
+    free(edit->plugins);
+    free(edit);
+}
+
+/**
+ * @brief 开始修改事务（复制当前所有记录） / Begin edit transaction (copies all current records) / Änderungstransaktion beginnen (kopiert alle aktuellen Datensätze)
+ * @details 复制字符串，提交时可先解除旧映射再替换文件 / Strings are copied so commit can unmap the old file before replacing it / Zeichenfolgen werden kopiert, damit der Commit die alte Datei vor dem Ersetzen freigeben kann
+ */
+validation_db_edit_t* begin_validation_db_edit(const validation_db_t* db) {
+    if (db == NULL) {
+        return NULL;
+    }
+    
+    validation_db_edit_t* edit = (validation_db_edit_t*)calloc(1, sizeof(validation_db_edit_t));
+    if (edit == NULL) {
+        internal_log_write("ERROR", "begin_validation_db_edit: failed to allocate transaction");
+        return NULL;
+    }
+    if (db->data == NULL) {
+        return edit;
+    }
+    
+    const validation_db_plugin_record_t* plugins = (const validation_db_plugin_record_t*)(db->data + db->header.plugins_offset);
+    const validation_db_interface_record_t* interfaces = (const validation_db_interface_record_t*)(db->data + db->header.interfaces_offset);
+    const validation_db_metadata_record_t* metadata = (const validation_db_metadata_record_t*)(db->data + db->header.metadata_offset);
+    const char* pool = (const char*)(db->data + db->header.pool_offset);
+    for (size_t i = 0; i < (size_t)db->header.plugin_count; i++) {
+        validation_db_edit_plugin_t* plugin = add_edit_plugin(edit, pool + plugins[i].path, plugins[i].path_hash);
+        if (plugin == NULL) {
+            discard_validation_db_edit(edit);
+            return NULL;
+        }
+        plugin->stamp = plugins[i].stamp;
+        for (uint32_t j = 0; j < plugins[i].interface_count; j++) {
+            const validation_db_interface_record_t* source = &interfaces[plugins[i].interface_first + j];
+            validation_db_edit_interface_t* record = add_edit_interface(plugin, pool + source->name);
+            if (record == NULL) {
+                discard_validation_db_edit(edit);
+                return NULL;
+            }
+            record->param_count = source->param_count;
+            record->return_type = source->return_type;
+            record->valid = source->valid;
+        }
+        for (uint32_t j = 0; j < plugins[i].metadata_count; j++) {
+            const validation_db_metadata_record_t* source = &metadata[plugins[i].metadata_first + j];
+            if (put_edit_metadata(plugin, pool + source->name, source, get_validation_db_param_types(db, source)) != 0) {
+                discard_validation_db_edit(edit);
+                return NULL;
+            }
+        }
+    }
+    return edit;
+}
+
+/**
+ * @brief 在事务中设置插件标识 / Set plugin stamp in transaction / Plugin-Stempel in der Transaktion setzen
+ */
+int set_validation_db_stamp(validation_db_edit_t* edit, const char* plugin_path, const validation_db_stamp_t* stamp, int keep_results) {
+    if (edit == NULL || plugin_path == NULL || stamp == NULL) {
+        return -1;
+    }
+    
+    uint64_t hash = hash_validation_db_path(plugin_path);
+    validation_db_edit_plugin_t* plugin = find_edit_plugin(edit, plugin_path, hash);
+    if (plugin == NULL) {
+        plugin = add_edit_plugin(edit, plugin_path, hash);
+        if (plugin == NULL) {
+            return -1;
+        }
+    }
+    
+    plugin->stamp = *stamp;
+    if (!keep_results) {
+        clear_edit_interfaces(plugin);
+        clear_edit_metadata(plugin);
+    }
+    edit->changed = 1;
+    return 0;
+}
+
+/**
+ * @brief 在事务中记录接口验证结果 / Record interface validation result in transaction / Schnittstellen-Validierungsergebnis in der Transaktion speichern
+ */
+int set_validation_db_interface(validation_db_edit_t* edit, const char* plugin_path, const char* interface_name,
+                                int param_count, pt_return_type_t return_type, int valid) {
+    if (edit == NULL || plugin_path == NULL || interface_name == NULL) {
+        return -1;
+    }
+    
+    validation_db_edit_plugin_t* plugin = find_edit_plugin(edit, plugin_path, hash_validation_db_path(plugin_path));
+    if (plugin == NULL) {
+        return -1;
+    }
+    
+    validation_db_edit_interface_t* record = NULL;
+    for (size_t i = 0; i < plugin->interface_count; i++) {
+        if (strcmp(plugin->interfaces[i].name, interface_name) == 0) {
+            record = &plugin->interfaces[i];
+            break;
+        }
+    }
+    if (record == NULL) {
+        record = add_edit_interface(plugin, interface_name);
+        if (record == NULL) {
+            return -1;
+        }
+    }
+    
+    record->param_count = (int32_t)param_count;
+    record->return_type = (int32_t)return_type;
+    record->valid = valid ? 1 : 0;
+    edit->changed = 1;
+    return 0;
+}
+
+/**
+ * @brief 在事务中记录接口元数据 / Record interface metadata in transaction / Schnittstellen-Metadaten in der Transaktion speichern
+ */
+int set_validation_db_metadata(validation_db_edit_t* edit, const char* plugin_path, const char* interface_name,
+                               const validation_db_metadata_record_t* metadata, const int32_t* param_types) {
+    if (edit == NULL || plugin_path == NULL || interface_name == NULL || metadata == NULL) {
+        return -1;
+    }
+    
+    validation_db_edit_plugin_t* plugin = find_edit_plugin(edit, plugin_path, hash_validation_db_path(plugin_path));
+    if (plugin == NULL || put_edit_metadata(plugin, interface_name, metadata, param_types) != 0) {
+        return -1;
+    }
+    edit->changed = 1;
+    return 0;
+}
+
+/**
+ * @brief 按路径哈希排序插件 / Sort plugins by path hash / Plugins nach Pfad-Hash sortieren
+ */
+static int compare_edit_plugins(const void* a, const void* b) {
+    const validation_db_edit_plugin_t* left = (const validation_db_edit_plugin_t*)a;
+    const validation_db_edit_plugin_t* right = (const validation_db_edit_plugin_t*)b;
+    if (left->path_hash != right->path_hash) {
+        return left->path_hash < right->path_hash ? -1 : 1;
+    }
+    return strcmp(left->path, right->path);
+}
+
+/**
+ * @brief 将字符串追加到池 / Append string to pool / Zeichenfolge an Pool anhängen
+ */
+static void append_pool_string(char* pool, size_t* pool_size, const char* str, uint32_t* offset_out) {
+    size_t len = strlen(str);
+    memcpy(pool + *pool_size, str, len + 1);
+    *offset_out = (uint32_t)*pool_size;
+    *pool_size += len + 1;
+}
+
+/**
+ * @brief 写入整个缓冲区 / Write whole buffer / Gesamten Puffer schreiben
+ */
+static int write_block(FILE* fp, const void* data, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    return fwrite(data, 1, size, fp) == size ? 0 : -1;
+}
+
+/**
+ * @brief 将事务编码为文件内容并写入临时文件 / Encode transaction as file content and write the temporary file / Transaktion als Dateiinhalt kodieren und temporäre Datei schreiben
+ */
+static int write_validation_db_file(const validation_db_edit_t* edit, const char* temp_path) {
+    size_t plugin_count = edit->plugin_count;
+    size_t interface_count = 0;
+    size_t metadata_count = 0;
+    size_t param_type_count = 0;
+    size_t pool_bound = 0;
+    for (size_t i = 0; i < plugin_count; i++) {
+        const validation_db_edit_plugin_t* plugin = &edit->plugins[i];
+        interface_count += plugin->interface_count;
+        metadata_count += plugin->metadata_count;
+        pool_bound += strlen(plugin->path) + 1;
+        for (size_t j = 0; j < plugin->interface_count; j++) {
+            pool_bound += strlen(plugin->interfaces[j].name) + 1;
+        }
+        for (size_t j = 0; j < plugin->metadata_count; j++) {
+            pool_bound += strlen(plugin->metadata[j].name) + 1;
+            param_type_count += plugin->metadata[j].record.param_type_count;
+        }
+    }
+    /* 偏移量必须能放入uint32 / Offsets must fit uint32 / Offsets müssen in uint32 passen */
+    if (pool_bound >= (size_t)UINT32_MAX || interface_count >= (size_t)UINT32_MAX ||
+        metadata_count >= (size_t)UINT32_MAX || param_type_count >= (size_t)UINT32_MAX / sizeof(int32_t)) {
+        internal_log_write("WARNING", "write_validation_db_file: database exceeds 4 GiB, not writing");
+        return -1;
+    }
+    
+    size_t pool_padded = (pool_bound + 7) & ~(size_t)7;
+    validation_db_plugin_record_t* plugins = (validation_db_plugin_record_t*)calloc(plugin_count > 0 ? plugin_count : 1, sizeof(validation_db_plugin_record_t));
+    validation_db_interface_record_t* interfaces = (validation_db_interface_record_t*)calloc(interface_count > 0 ? interface_count : 1, sizeof(validation_db_interface_record_t));
+    validation_db_metadata_record_t* metadata = (validation_db_metadata_record_t*)calloc(metadata_count > 0 ? metadata_count : 1, sizeof(validation_db_metadata_record_t));
+    size_t param_types_padded = ((param_type_count * sizeof(int32_t)) + 7) & ~(size_t)7;
+    int32_t* param_types = (int32_t*)calloc(param_types_padded > 0 ? param_types_padded : 1, 1);
+    char* pool = (char*)calloc(pool_padded > 0 ? pool_padded : 1, 1);
+    int result = 0;
+    if (plugins == NULL || interfaces == NULL || metadata == NULL || param_types == NULL || pool == NULL) {
+        result = -1;
+    }
+    
+    size_t pool_size = 0;
+    size_t interface_index = 0;
+    size_t metadata_index = 0;
+    size_t param_type_index = 0;
+    for (size_t i = 0; i < plugin_count && result == 0; i++) {
+        const validation_db_edit_plugin_t* plugin = &edit->plugins[i];
+        plugins[i].path_hash = plugin->path_hash;
+        plugins[i].stamp = plugin->stamp;
+        plugins[i].interface_first = (uint32_t)interface_index;
+        plugins[i].interface_count = (uint32_t)plugin->interface_count;
+        plugins[i].metadata_first = (uint32_t)metadata_index;
+        plugins[i].metadata_count = (uint32_t)plugin->metadata_count;
+        append_pool_string(pool, &pool_size, plugin->path, &plugins[i].path);
+        for (size_t j = 0; j < plugin->interface_count; j++) {
+            validation_db_interface_record_t* record = &interfaces[interface_index++];
+            append_pool_string(pool, &pool_size, plugin->interfaces[j].name, &record->name);
+            record->param_count = plugin->interfaces[j].param_count;
+            record->return_type = plugin->interfaces[j].return_type;
+            record->valid = plugin->interfaces[j].valid;
+        }
+        for (size_t j = 0; j < plugin->metadata_count; j++) {
+            const validation_db_edit_metadata_t* source = &plugin->metadata[j];
+            validation_db_metadata_record_t* record = &metadata[metadata_index++];
+            *record = source->record;
+            append_pool_string(pool, &pool_size, source->name, &record->name);
+            record->param_type_first = (uint32_t)param_type_index;
+            if (source->record.param_type_count > 0) {
+                memcpy(param_types + param_type_index, source->param_types, (size_t)source->record.param_type_count * sizeof(int32_t));
+                param_type_index += source->record.param_type_count;
+            }
+        }
+    }
+    
+    if (result == 0) {
+        validation_db_header_t header;
+        memset(&header, 0, sizeof(header));
+        header.magic = VALIDATION_DB_MAGIC;
+        header.version = VALIDATION_DB_VERSION;
+        header.header_size = (uint32_t)sizeof(validation_db_header_t);
+        header.record_size = (uint32_t)sizeof(validation_db_plugin_record_t);
+        header.interface_record_size = (uint32_t)sizeof(validation_db_interface_record_t);
+        header.metadata_record_size = (uint32_t)sizeof(validation_db_metadata_record_t);
+        header.plugin_count = (uint64_t)plugin_count;
+        header.plugins_offset = (uint64_t)sizeof(validation_db_header_t);
+        header.interface_count = (uint64_t)interface_count;
+        header.interfaces_offset = header.plugins_offset + (uint64_t)plugin_count * sizeof(validation_db_plugin_record_t);
+        header.metadata_count = (uint64_t)metadata_count;
+        header.metadata_offset = header.interfaces_offset + (uint64_t)interface_count * sizeof(validation_db_interface_record_t);
+        header.param_type_count = (uint64_t)param_type_count;
+        header.param_types_offset = header.metadata_offset + (uint64_t)metadata_count * sizeof(validation_db_metadata_record_t);
+        header.pool_offset = header.param_types_offset + (uint64_t)param_types_padded;
+        header.pool_size = (uint64_t)pool_size;
+        header.file_size = header.pool_offset + (uint64_t)pool_padded;
+        
+        FILE* fp = fopen(temp_path, "wb");
+        if (fp == NULL) {
+            result = -1;
+        } else {
+            if (write_block(fp, &header, sizeof(header)) != 0 ||
+                write_block(fp, plugins, plugin_count * sizeof(validation_db_plugin_record_t)) != 0 ||
+                write_block(fp, interfaces, interface_count * sizeof(validation_db_interface_record_t)) != 0 ||
+                write_block(fp, metadata, metadata_count * sizeof(validation_db_metadata_record_t)) != 0 ||
+                write_block(fp, param_types, param_types_padded) != 0 ||
+                write_block(fp, pool, pool_padded) != 0) {
+                result = -1;
+            }
+            if (fclose(fp) != 0) {
+                result = -1;
+            }
+            if (result != 0) {
+                remove(temp_path);
+            }
+        }
+    }
+    
+    free(plugins);
+    free(interfaces);
+    free(metadata);
+    free(param_types);
+    free(pool);
+    return result;
+}
+
+/**
+ * @brief 提交事务：写临时文件、原子替换并重新映射 / Commit transaction: write temporary file, replace atomically and remap / Transaktion festschreiben: temporäre Datei schreiben, atomar ersetzen und neu zuordnen
+ * @details 先写临时文件再替换，其他进程不会看到写了一半的数据库 / Writes a temporary file and replaces, so other processes never see a half-written database / Schreibt eine temporäre Datei und ersetzt, andere Prozesse sehen nie eine halb geschriebene Datenbank
+ */
+int commit_validation_db_edit(validation_db_t* db, validation_db_edit_t* edit) {
+    if (db == NULL || edit == NULL) {
+        discard_validation_db_edit(edit);
+        return -1;
+    }
+    if (!edit->changed) {
+        discard_validation_db_edit(edit);
+        return 0;
+    }
+    
+    if (edit->plugin_count > 1) {
+        qsort(edit->plugins, edit->plugin_count, sizeof(validation_db_edit_plugin_t), compare_edit_plugins);
+    }
+    
+    /* 临时文件名带序号，同一进程的多个目录互不覆盖 / The temporary name carries a sequence number so directories of one process do not clobber each other / Der temporäre Name trägt eine Sequenznummer, damit sich Verzeichnisse eines Prozesses nicht überschreiben */
+    static volatile int temp_sequence = 0;
+    size_t temp_size = strlen(db->db_path) + 32;
+    char* temp_path = (char*)malloc(temp_size);
+    if (temp_path == NULL) {
+        discard_validation_db_edit(edit);
+        return -1;
+    }
+    snprintf(temp_path, temp_size, "%s.%d.tmp", db->db_path, pt_platform_atomic_fetch_add_int(&temp_sequence, 1));
+    
+    int result = write_validation_db_file(edit, temp_path);
+    if (result == 0) {
+        /* 替换前解除映射（Windows不能替换已映射的文件） / Unmap before replacing (Windows cannot replace a mapped file) / Vor dem Ersetzen Zuordnung aufheben (Windows kann zugeordnete Dateien nicht ersetzen) */
+        if (db->map != NULL) {
+            pt_platform_file_map_close((pt_platform_file_map_t*)db->map);
+            db->map = NULL;
+            db->data = NULL;
+        }
+        if (pt_platform_replace_file(temp_path, db->db_path) != 0) {
+            remove(temp_path);
+            result = -1;
+        }
+        map_validation_db(db);
+    }
+    
+    if (result == 0) {
+        internal_log_write("INFO", "Wrote validation database %s: %zu plugins", db->db_path, edit->plugin_count);
+    } else {
+        internal_log_write("WARNING", "commit_validation_db_edit: failed to write %s", db->db_path);
+    }
+    free(temp_path);
+    discard_validation_db_edit(edit);
+    return result;
+}
@@ -0,0 +1,273 @@
+/**
+ * @file pointer_transfer_currying_validate_manifest.c
+ * @brief 插件目录清单 / Plugin directory manifest / Plugin-Verzeichnismanifest
+ */
+
+#include "pointer_transfer_currying_validate_db.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 取清单条目上限 / Get manifest entry limit / Manifest-Eintragsgrenze abrufen
+ */
+static size_t get_manifest_max_entries(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx != NULL && ctx->manifest_max_entries > 0) {
+        return ctx->manifest_max_entries;
+    }
+    return PLUGIN_MANIFEST_DEFAULT_MAX_ENTRIES;
+}
+
+/**
+ * @brief 在索引中查找路径 / Look up path in the index / Pfad im Index suchen
+ * @return 条目序号，未找到返回SIZE_MAX（slot_out输出空槽位） / Entry number, SIZE_MAX if not found (slot_out outputs the free slot) / Eintragsnummer, SIZE_MAX wenn nicht gefunden (slot_out gibt den freien Slot aus)
+ */
+static size_t lookup_manifest_slot(const plugin_manifest_t* manifest, const char* path, uint64_t path_hash, size_t* slot_out) {
+    if (manifest->slot_count == 0) {
+        return SIZE_MAX;
+    }
+    
+    size_t mask = manifest->slot_count - 1;
+    for (size_t slot = (size_t)path_hash & mask; ; slot = (slot + 1) & mask) {
+        size_t index = manifest->slots[slot];
+        if (index == 0) {
+            if (slot_out != NULL) {
+                *slot_out = slot;
+            }
+            return SIZE_MAX;
+        }
+        const plugin_manifest_entry_t* entry = &manifest->entries[index - 1];
+        if (entry->path_hash == path_hash && strcmp(entry->path, path) == 0) {
+            return index - 1;
+        }
+    }
+}
+
+/**
+ * @brief 扩容条目数组和索引（索引保持至多半满） / Grow entry array and index (the index stays at most half full) / Eintrags-Array und Index vergrößern (der Index bleibt höchstens halb voll)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int grow_plugin_manifest(plugin_manifest_t* manifest) {
+    size_t new_capacity = manifest->capacity == 0 ? INITIAL_PLUGIN_CAPACITY : manifest->capacity * CAPACITY_GROWTH_FACTOR;
+    if (new_capacity < manifest->capacity || new_capacity > SIZE_MAX / (2 * sizeof(size_t)) ||
+        new_capacity > SIZE_MAX / sizeof(plugin_manifest_entry_t)) {
+        return -1;
+    }
+    
+    size_t new_slot_count = new_capacity * 2;
+    size_t* new_slots = (size_t*)calloc(new_slot_count, sizeof(size_t));
+    if (new_slots == NULL) {
+        return -1;
+    }
+    plugin_manifest_entry_t* new_entries = (plugin_manifest_entry_t*)realloc(manifest->entries, new_capacity * sizeof(plugin_manifest_entry_t));
+    if (new_entries == NULL) {
+        free(new_slots);
+        return -1;
+    }
+    manifest->entries = new_entries;
+    manifest->capacity = new_capacity;
+    
+    free(manifest->slots);
+    manifest->slots = new_slots;
+    manifest->slot_count = new_slot_count;
+    for (size_t i = 0; i < manifest->count; i++) {
+        size_t slot = 0;
+        lookup_manifest_slot(manifest, manifest->entries[i].path, manifest->entries[i].path_hash, &slot);
+        manifest->slots[slot] = i + 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 更新或添加清单条目 / Update or add manifest entry / Manifesteintrag aktualisieren oder hinzufügen
+ * @details 大小、时间或存在状态变化时条目标记为未核对 / The entry is marked unchecked when size, time or presence changed / Der Eintrag wird als nicht abgeglichen markiert, wenn sich Größe, Zeit oder Vorhandensein geändert haben
+ * @return 条目，未登记返回NULL / Entry, NULL if not registered / Eintrag, NULL wenn nicht registriert
+ */
+static plugin_manifest_entry_t* update_manifest_entry(plugin_manifest_t* manifest, const char* path, int present, uint64_t size, int64_t mtime) {
+    uint64_t path_hash = hash_validation_db_path(path);
+    size_t slot = 0;
+    size_t index = lookup_manifest_slot(manifest, path, path_hash, &slot);
+    if (index != SIZE_MAX) {
+        plugin_manifest_entry_t* entry = &manifest->entries[index];
+        if (entry->present != present || entry->size != size || entry->mtime != mtime) {
+            entry->present = present;
+            entry->size = size;
+            entry->mtime = mtime;
+            entry->synced = 0;
+        }
+        return entry;
+    }
+    if (!present) {
+        return NULL;
+    }
+    
+    /* 超出上限的库不进入清单，验证时按需检查 / Libraries beyond the limit stay out of the manifest and are checked on demand / Bibliotheken über der Grenze bleiben außerhalb des Manifests und werden bei Bedarf geprüft */
+    if (manifest->count >= manifest->max_entries) {
+        if (!manifest->limit_reported) {
+            internal_log_write("WARNING", "Plugin manifest limit of %zu libraries reached, further libraries are checked on demand", manifest->max_entries);
+            manifest->limit_reported = 1;
+        }
+        return NULL;
+    }
+    if (manifest->count == manifest->capacity) {
+        if (grow_plugin_manifest(manifest) != 0) {
+            internal_log_write("ERROR", "update_manifest_entry: failed to grow plugin manifest");
+            return NULL;
+        }
+        lookup_manifest_slot(manifest, path, path_hash, &slot);
+    }
+    
+    size_t path_len = strlen(path);
+    char* path_copy = (char*)malloc(path_len + 1);
+    if (path_copy == NULL) {
+        return NULL;
+    }
+    memcpy(path_copy, path, path_len + 1);
+    
+    plugin_manifest_entry_t* entry = &manifest->entries[manifest->count];
+    entry->path = path_copy;
+    entry->path_hash = path_hash;
+    entry->size = size;
+    entry->mtime = mtime;
+    entry->present = 1;
+    entry->synced = 0;
+    manifest->slots[slot] = ++manifest->count;
+    return entry;
+}
+
+/**
+ * @brief 扫描回调：登记库并记录本轮扫描 / Scan callback: register library and record the current scan / Scan-Rückruf: Bibliothek registrieren und aktuellen Scan vermerken
+ */
+static int register_scanned_library(const char* file_path, uint64_t size, int64_t timestamp, void* user_data) {
+    plugin_manifest_t* manifest = (plugin_manifest_t*)user_data;
+    plugin_manifest_entry_t* entry = update_manifest_entry(manifest, file_path, 1, size, timestamp);
+    if (entry != NULL) {
+        entry->scan_generation = manifest->scan_generation;
+    }
+    return 0;
+}
+
+/**
+ * @brief 扫描整个目录（本轮未出现的库标记为不存在） / Scan the whole directory (libraries missing from this scan are marked absent) / Das ganze Verzeichnis scannen (in diesem Scan fehlende Bibliotheken werden als nicht vorhanden markiert)
+ */
+static int scan_plugin_manifest(validation_db_t* db) {
+    plugin_manifest_t* manifest = &db->manifest;
+    manifest->scan_generation++;
+    if (pt_platform_scan_library_dir(db->dir_path, register_scanned_library, manifest) != 0) {
+        return -1;
+    }
+    
+    for (size_t i = 0; i < manifest->count; i++) {
+        plugin_manifest_entry_t* entry = &manifest->entries[i];
+        if (entry->present && entry->scan_generation != manifest->scan_generation) {
+            entry->present = 0;
+            entry->synced = 0;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 监视回调：重新检查单个文件 / Watch callback: recheck a single file / Überwachungs-Rückruf: einzelne Datei erneut prüfen
+ */
+static void handle_manifest_change(const char* file_name, void* user_data) {
+    validation_db_t* db = (validation_db_t*)user_data;
+    if (file_name == NULL) {
+        db->manifest.needs_rescan = 1;
+        return;
+    }
+    if (!pt_platform_is_library_name(file_name)) {
+        return;
+    }
+    
+    size_t dir_len = strlen(db->dir_path);
+    size_t name_len = strlen(file_name);
+    char* path = (char*)malloc(dir_len + name_len + 2);
+    if (path == NULL) {
+        db->manifest.needs_rescan = 1;
+        return;
+    }
+    memcpy(path, db->dir_path, dir_len);
+    path[dir_len] = '/';
+    memcpy(path + dir_len + 1, file_name, name_len + 1);
+    
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    int present = pt_platform_get_file_stat(path, &size, &mtime) == 0;
+    update_manifest_entry(&db->manifest, path, present, present ? size : 0, present ? mtime : 0);
+    free(path);
+}
+
+/**
+ * @brief 更新目录清单 / Refresh directory manifest / Verzeichnismanifest aktualisieren
+ */
+int refresh_plugin_manifest(validation_db_t* db) {
+    if (db == NULL) {
+        return -1;
+    }
+    
+    plugin_manifest_t* manifest = &db->manifest;
+    if (!manifest->built) {
+        manifest->max_entries = get_manifest_max_entries();
+        /* 先开始监视再扫描，扫描期间的变化不会丢失 / Start watching before scanning so changes during the scan are not lost / Überwachung vor dem Scan starten, damit Änderungen während des Scans nicht verloren gehen */
+        manifest->watch = pt_platform_dir_watch_create(db->dir_path);
+        if (manifest->watch == NULL) {
+            internal_log_write("WARNING", "Cannot watch plugin directory %s, manifest entries are rechecked on demand", db->dir_path);
+        }
+        if (scan_plugin_manifest(db) != 0) {
+            internal_log_write("WARNING", "Failed to scan plugin directory %s", db->dir_path);
+            return -1;
+        }
+        manifest->built = 1;
+        internal_log_write("INFO", "Built plugin manifest for %s: %zu libraries", db->dir_path, manifest->count);
+        return 0;
+    }
+    
+    if (manifest->watch != NULL &&
+        pt_platform_dir_watch_poll((pt_platform_dir_watch_t*)manifest->watch, handle_manifest_change, db) < 0) {
+        manifest->needs_rescan = 1;
+    }
+    if (manifest->needs_rescan) {
+        manifest->needs_rescan = 0;
+        if (scan_plugin_manifest(db) != 0) {
+            manifest->needs_rescan = 1;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 在目录清单中查找库 / Find library in directory manifest / Bibliothek im Verzeichnismanifest suchen
+ */
+plugin_manifest_entry_t* find_plugin_manifest_entry(validation_db_t* db, const char* plugin_path) {
+    if (db == NULL || plugin_path == NULL) {
+        return NULL;
+    }
+    
+    size_t index = lookup_manifest_slot(&db->manifest, plugin_path, hash_validation_db_path(plugin_path), NULL);
+    return index != SIZE_MAX ? &db->manifest.entries[index] : NULL;
+}
+
+/**
+ * @brief 释放目录清单 / Free directory manifest / Verzeichnismanifest freigeben
+ */
+void free_plugin_manifest(plugin_manifest_t* manifest) {
+    if (manifest == NULL) {
+        return;
+    }
+    
+    if (manifest->watch != NULL) {
+        pt_platform_dir_watch_destroy((pt_platform_dir_watch_t*)manifest->watch);
+    }
+    for (size_t i = 0; i < manifest->count; i++) {
+        free(manifest->entries[i].path);
+    }
+    free(manifest->entries);
+    free(manifest->slots);
+    memset(manifest, 0, sizeof(plugin_manifest_t));
+}
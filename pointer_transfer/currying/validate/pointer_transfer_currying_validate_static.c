@@ -0,0 +1,229 @@
+/**
+ * @file pointer_transfer_currying_validate_static.c
+ * @brief 无副作用的静态插件验证 / Side-effect-free static plugin validation / Nebenwirkungsfreie statische Plugin-Validierung
+ */
+
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 静态验证要求的导出符号（接口名称放在下标0） / Exports required by static validation (the interface name goes into index 0) / Für die statische Validierung erforderliche Exporte (Schnittstellenname an Index 0) */
+#define STATIC_VALIDATION_SYMBOL_COUNT 5
+
+/**
+ * @brief 检查插件是否允许试调用验证 / Check if plugin opts into trial call validation / Prüfen, ob Plugin der Validierung per Probeaufruf zustimmt
+ * @details 按文件名匹配TrialCalls列表 / Matches the file name against the TrialCalls list / Vergleicht den Dateinamen mit der TrialCalls-Liste
+ */
+int pt_plugin_allows_trial_call(const char* plugin_path) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (plugin_path == NULL || ctx == NULL || ctx->trial_call_plugins == NULL) {
+        return 0;
+    }
+    
+    const char* file_name = plugin_path;
+    for (const char* cursor = plugin_path; *cursor != '\0'; cursor++) {
+        if (*cursor == '/' || *cursor == '\\') {
+            file_name = cursor + 1;
+        }
+    }
+    size_t name_len = strlen(file_name);
+    
+    const char* item = ctx->trial_call_plugins;
+    while (*item != '\0') {
+        const char* item_end = strchr(item, ',');
+        size_t item_len = item_end != NULL ? (size_t)(item_end - item) : strlen(item);
+        const char* start = item;
+        while (item_len > 0 && (*start == ' ' || *start == '\t')) {
+            start++;
+            item_len--;
+        }
+        while (item_len > 0 && (start[item_len - 1] == ' ' || start[item_len - 1] == '\t')) {
+            item_len--;
+        }
+        if (item_len == name_len && memcmp(start, file_name, name_len) == 0) {
+            return 1;
+        }
+        if (item_end == NULL) {
+            break;
+        }
+        item = item_end + 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 确认接口和元数据函数已导出 / Confirm the interface and metadata functions are exported / Bestätigen, dass Schnittstelle und Metadatenfunktionen exportiert sind
+ * @details 优先读取库文件的动态符号表；格式不支持时通过已加载句柄解析（不调用） / Reads the library file's dynamic symbol table first; resolves through the loaded handle (without calling) when the format is unsupported / Liest zuerst die Dynamiksymboltabelle der Bibliotheksdatei; löst bei nicht unterstütztem Format über das geladene Handle auf (ohne Aufruf)
+ */
+static int check_static_exports(void* handle, const char* plugin_path, const char* interface_name) {
+    const char* symbol_names[STATIC_VALIDATION_SYMBOL_COUNT] = {
+        interface_name,
+        "nxld_plugin_get_interface_count",
+        "nxld_plugin_get_interface_info",
+        "nxld_plugin_get_interface_param_count",
+        "nxld_plugin_get_interface_param_info"
+    };
+    int found[STATIC_VALIDATION_SYMBOL_COUNT];
+    if (pt_platform_check_library_exports(plugin_path, symbol_names, STATIC_VALIDATION_SYMBOL_COUNT, found) != 0) {
+        for (size_t i = 0; i < STATIC_VALIDATION_SYMBOL_COUNT; i++) {
+            found[i] = pt_platform_get_symbol(handle, symbol_names[i]) != NULL;
+        }
+    }
+    
+    for (size_t i = 0; i < STATIC_VALIDATION_SYMBOL_COUNT; i++) {
+        if (!found[i]) {
+            internal_log_write("ERROR", "Static validation failed: %s does not export %s", plugin_path, symbol_names[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 检查常量参数能否按参数类型解析 / Check if a constant parameter parses as the parameter type / Prüfen, ob ein konstanter Parameter als Parametertyp geparst werden kann
+ */
+static int constant_matches_param_type(const char* value, nxld_param_type_t param_type) {
+    char* end_ptr = NULL;
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_INT64:
+            (void)strtoll(value, &end_ptr, 0);
+            return end_ptr != value && *end_ptr == '\0';
+        case NXLD_PARAM_TYPE_FLOAT:
+        case NXLD_PARAM_TYPE_DOUBLE:
+            (void)strtod(value, &end_ptr);
+            return end_ptr != value && *end_ptr == '\0';
+        default:
+            return 1;
+    }
+}
+
+/**
+ * @brief 对照规则集检查参数索引和常量 / Cross-check parameter indices and constants against the rule set / Parameterindizes und Konstanten mit dem Regelsatz abgleichen
+ */
+static int check_static_rules(const char* plugin_path, const char* interface_name, int param_count,
+                              const nxld_param_type_t* param_types, int typed_count) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return 0;
+    }
+    
+    acquire_rule_set_read();
+    int result = 0;
+    for (size_t i = 0; i < ctx->rule_count && result == 0; i++) {
+        const pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (!rule->enabled || rule->target_interface == NULL || rule->target_plugin_path == NULL ||
+            strcmp(rule->target_interface, interface_name) != 0 || strcmp(rule->target_plugin_path, plugin_path) != 0) {
+            continue;
+        }
+        if (rule->target_param_index < 0 || rule->target_param_index >= param_count) {
+            internal_log_write("ERROR", "Static validation failed: rule targets parameter %d of %s, which takes %d parameters",
+                              rule->target_param_index, interface_name, param_count);
+            result = -1;
+        } else if (rule->target_param_value != NULL && rule->target_param_index < typed_count &&
+                   !constant_matches_param_type(rule->target_param_value, param_types[rule->target_param_index])) {
+            internal_log_write("ERROR", "Static validation failed: constant '%s' does not match the type of parameter %d of %s",
+                              rule->target_param_value, rule->target_param_index, interface_name);
+            result = -1;
+        }
+    }
+    release_rule_set_read();
+    return result;
+}
+
+/**
+ * @brief 静态验证插件函数（不调用插件函数） / Validate plugin function statically (without calling it) / Plugin-Funktion statisch validieren (ohne sie aufzurufen)
+ * @details 检查导出符号、函数指针、nxld_plugin_get_interface_*元数据中的参数数量、类型和返回类型，以及规则集的参数索引和常量 / Checks the exported symbols, the function pointer, the parameter count, types and return type in the nxld_plugin_get_interface_* metadata, and the rule set's parameter indices and constants / Prüft exportierte Symbole, Funktionszeiger, Parameteranzahl, -typen und Rückgabetyp in den nxld_plugin_get_interface_*-Metadaten sowie Parameterindizes und Konstanten des Regelsatzes
+ */
+int32_t pt_validate_plugin_static(void* handle, void* func_ptr, const char* plugin_path, const char* interface_name,
+                                  int expected_param_count, pt_return_type_t return_type) {
+    if (handle == NULL || func_ptr == NULL || plugin_path == NULL || interface_name == NULL) {
+        return -1;
+    }
+    
+    if (check_static_exports(handle, plugin_path, interface_name) != 0) {
+        return -1;
+    }
+    if (pt_platform_get_symbol(handle, interface_name) != func_ptr) {
+        internal_log_write("ERROR", "Static validation failed: %s does not resolve to the loaded function in %s", interface_name, plugin_path);
+        return -1;
+    }
+    
+    void* get_interface_count = NULL;
+    void* get_interface_info = NULL;
+    void* get_param_count = NULL;
+    void* get_param_info = NULL;
+    size_t interface_index = 0;
+    pt_return_type_t declared_return_type = PT_RETURN_TYPE_INTEGER;
+    char* description = NULL;
+    if (get_plugin_interface_functions(handle, &get_interface_count, &get_interface_info, &get_param_count, &get_param_info) != 0 ||
+        find_interface_index(get_interface_count, get_interface_info, interface_name, &interface_index, &declared_return_type, &description) != 0) {
+        internal_log_write("ERROR", "Static validation failed: %s is not described by the metadata of %s", interface_name, plugin_path);
+        return -1;
+    }
+    free(description);
+    if (declared_return_type != return_type) {
+        internal_log_write("ERROR", "Static validation failed: %s declares return type %d, rules expect %d", interface_name, declared_return_type, return_type);
+        return -1;
+    }
+    
+    /* 参数数量必须落在元数据声明的范围内 / The parameter count must lie inside the range declared by the metadata / Die Parameteranzahl muss im von den Metadaten deklarierten Bereich liegen */
+    nxld_param_count_type_t count_type = NXLD_PARAM_COUNT_UNKNOWN;
+    int32_t min_count = 0;
+    int32_t max_count = 0;
+    if (get_parameter_count_info(get_param_count, interface_index, &count_type, &min_count, &max_count) != 0) {
+        internal_log_write("ERROR", "Static validation failed: parameter count of %s is not available", interface_name);
+        return -1;
+    }
+    if ((count_type == NXLD_PARAM_COUNT_FIXED && expected_param_count != min_count) ||
+        (count_type == NXLD_PARAM_COUNT_VARIABLE && (expected_param_count < min_count || (max_count >= 0 && expected_param_count > max_count)))) {
+        internal_log_write("ERROR", "Static validation failed: %s called with %d parameters, metadata declares %d..%d",
+                          interface_name, expected_param_count, min_count, max_count);
+        return -1;
+    }
+    
+    /* 声明的参数必须有已知类型 / Declared parameters must have a known type / Deklarierte Parameter müssen einen bekannten Typ haben */
+    int typed_count = count_type == NXLD_PARAM_COUNT_FIXED ? min_count : expected_param_count;
+    if (typed_count > expected_param_count) {
+        typed_count = expected_param_count;
+    }
+    nxld_param_type_t* param_types = typed_count > 0 ? (nxld_param_type_t*)calloc((size_t)typed_count, sizeof(nxld_param_type_t)) : NULL;
+    if (typed_count > 0 && param_types == NULL) {
+        return -1;
+    }
+    typedef int32_t (NXLD_PLUGIN_CALL *get_interface_param_info_func)(size_t, int32_t, char*, size_t, nxld_param_type_t*, char*, size_t);
+    get_interface_param_info_func info_func = (get_interface_param_info_func)get_param_info;
+    char param_name[256];
+    char type_name[256];
+    int32_t result = 0;
+    for (int i = 0; i < typed_count && result == 0; i++) {
+        if (info_func(interface_index, i, param_name, sizeof(param_name), &param_types[i], type_name, sizeof(type_name)) != 0) {
+            /* 可变参数部分可以没有逐项描述 / The variadic part may lack per-parameter descriptions / Der variable Teil darf ohne Einzelbeschreibungen sein */
+            if (count_type == NXLD_PARAM_COUNT_VARIABLE && i >= min_count) {
+                param_types[i] = NXLD_PARAM_TYPE_ANY;
+                continue;
+            }
+            internal_log_write("ERROR", "Static validation failed: parameter %d of %s is not described", i, interface_name);
+            result = -1;
+        } else if (param_types[i] == NXLD_PARAM_TYPE_VOID || param_types[i] == NXLD_PARAM_TYPE_UNKNOWN) {
+            internal_log_write("ERROR", "Static validation failed: parameter %d of %s has no usable type", i, interface_name);
+            result = -1;
+        }
+    }
+    
+    if (result == 0) {
+        result = check_static_rules(plugin_path, interface_name, expected_param_count, param_types, typed_count);
+    }
+    free(param_types);
+    
+    if (result == 0) {
+        internal_log_write("INFO", "Static validation passed: %s in %s (%d parameters)", interface_name, plugin_path, expected_param_count);
+    }
+    return result;
+}
@@ -0,0 +1,351 @@
+/**
+ * @file pointer_transfer_interface_batch.c
+ * @brief 批量（<Interface>_Vec）接口调用 / Batch (<Interface>_Vec) Interface Call / Batch-Schnittstellenaufruf (<Interface>_Vec)
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 批量函数名缓冲区大小 / Batch function name buffer size / Puffergröße für Batch-Funktionsnamen */
+#define BATCH_FUNC_NAME_SIZE 256
+
+/**
+ * @brief 检查参数是否由常量规则提供 / Check whether a parameter is supplied by a constant rule / Prüfen, ob ein Parameter durch eine Konstantenregel geliefert wird
+ * @details 常量参数在每次调用后都会重新设置，因此每行取值相同 / Constant parameters are set again after every call, so every row sees the same value / Konstante Parameter werden nach jedem Aufruf neu gesetzt, daher sieht jede Zeile denselben Wert
+ */
+static int is_constant_parameter(const pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* rule, int param_index) {
+    for (size_t i = 0; i < ctx->rule_count; i++) {
+        const pointer_transfer_rule_t* const_rule = &ctx->rules[i];
+        if (const_rule->enabled && const_rule->target_param_index == param_index &&
+            const_rule->target_param_value != NULL && const_rule->target_param_value[0] != '\0' &&
+            const_rule->target_plugin != NULL && const_rule->target_interface != NULL &&
+            strcmp(const_rule->target_plugin, rule->target_plugin) == 0 &&
+            strcmp(const_rule->target_interface, rule->target_interface) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 检查除目标参数外的参数均为就绪的常量 / Check that every parameter except the target one is a ready constant / Prüfen, dass jeder Parameter außer dem Zielparameter eine bereite Konstante ist
+ * @details 由先前传递设置的参数只供下一次调用使用，逐行调用时第二行起将不再就绪 / Parameters set by earlier transfers serve only the next call, row-by-row calls would find them unready from the second row on / Durch frühere Übertragungen gesetzte Parameter dienen nur dem nächsten Aufruf, zeilenweise Aufrufe fänden sie ab der zweiten Zeile nicht bereit
+ */
+static int other_parameters_are_constant(const pointer_transfer_rule_t* rule, const target_interface_state_t* state,
+                                         int actual_param_count) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    for (int i = 0; i < actual_param_count; i++) {
+        if (i == rule->target_param_index) {
+            continue;
+        }
+        if (!state->param_ready[i] || !is_constant_parameter(ctx, rule, i)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief 将已设置的参数值写入值槽（与创建参数包的规则相同） / Write a stored parameter value into a value slot (same rules as building a parameter pack) / Gespeicherten Parameterwert in einen Wert-Slot schreiben (gleiche Regeln wie beim Erstellen eines Parameterpakets)
+ */
+static void store_parameter_slot(nxld_param_type_t type, const void* value_ptr, uint64_t* slot) {
+    *slot = 0;
+    if (value_ptr == NULL) {
+        return;
+    }
+    
+    switch (type) {
+        case NXLD_PARAM_TYPE_INT32:
+            memcpy(slot, value_ptr, sizeof(int32_t));
+            break;
+        case NXLD_PARAM_TYPE_INT64:
+            memcpy(slot, value_ptr, sizeof(int64_t));
+            break;
+        case NXLD_PARAM_TYPE_FLOAT:
+            memcpy(slot, value_ptr, sizeof(float));
+            break;
+        case NXLD_PARAM_TYPE_DOUBLE:
+            memcpy(slot, value_ptr, sizeof(double));
+            break;
+        case NXLD_PARAM_TYPE_CHAR:
+            memcpy(slot, value_ptr, sizeof(char));
+            break;
+        default:
+            memcpy(slot, &value_ptr, sizeof(void*));
+            break;
+    }
+}
+
+/**
+ * @brief 将传递值按参数类型转换后写入值槽 / Convert a transferred value to the parameter type and write it into a value slot / Übertragenen Wert in den Parametertyp konvertieren und in einen Wert-Slot schreiben
+ * @details 标量转换与set_parameter_value_from_typed相同；非标量参数的直接值保留自身类型，使插件无需经由参数槽指针读取 / Scalar conversion matches set_parameter_value_from_typed; immediate values for non-scalar parameters keep their own type so the plugin does not read through a parameter slot pointer / Skalare Konvertierung wie in set_parameter_value_from_typed; Direktwerte für nicht skalare Parameter behalten ihren eigenen Typ, sodass das Plugin nicht über einen Parameter-Slot-Zeiger liest
+ */
+static void store_value_slot(nxld_param_type_t param_type, const pt_typed_value_t* value, uint64_t* slot) {
+    int64_t int_value = 0;
+    double float_value = 0.0;
+    int is_float = 0;
+    *slot = 0;
+    
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_INT64:
+        case NXLD_PARAM_TYPE_CHAR:
+            is_float = read_typed_value_number(value, param_type, &int_value, &float_value);
+            if (is_float == 1) {
+                int_value = (int64_t)float_value;
+            }
+            if (param_type == NXLD_PARAM_TYPE_INT32) {
+                int32_t narrow = (int32_t)int_value;
+                memcpy(slot, &narrow, sizeof(int32_t));
+            } else if (param_type == NXLD_PARAM_TYPE_CHAR) {
+                char narrow = (char)int_value;
+                memcpy(slot, &narrow, sizeof(char));
+            } else {
+                memcpy(slot, &int_value, sizeof(int64_t));
+            }
+            break;
+        case NXLD_PARAM_TYPE_FLOAT:
+        case NXLD_PARAM_TYPE_DOUBLE:
+            is_float = read_typed_value_number(value, param_type, &int_value, &float_value);
+            if (is_float == 0) {
+                float_value = (double)int_value;
+            }
+            if (param_type == NXLD_PARAM_TYPE_FLOAT) {
+                float narrow = (float)float_value;
+                memcpy(slot, &narrow, sizeof(float));
+            } else {
+                memcpy(slot, &float_value, sizeof(double));
+            }
+            break;
+        default:
+            if (is_immediate_value(value)) {
+                memcpy(slot, &value->as, sizeof(int64_t));
+            } else {
+                memcpy(slot, &value->as.ptr, sizeof(void*));
+            }
+            break;
+    }
+}
+
+/**
+ * @brief 确定目标列的类型和大小 / Determine type and size of the target column / Typ und Größe der Zielspalte bestimmen
+ * @return 所有行形状相同返回0，否则返回-1 / Returns 0 if all rows have the same shape, -1 otherwise / Gibt 0 zurück, wenn alle Zeilen dieselbe Form haben, sonst -1
+ */
+static int get_target_column_shape(nxld_param_type_t param_type, const pt_typed_value_t* values, size_t count,
+                                   uint8_t* type_out, size_t* size_out) {
+    for (size_t i = 1; i < count; i++) {
+        if (values[i].type != values[0].type || values[i].flags != values[0].flags || values[i].size != values[0].size) {
+            return -1;
+        }
+    }
+    
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_FLOAT:
+            *size_out = 4;
+            break;
+        case NXLD_PARAM_TYPE_INT64:
+        case NXLD_PARAM_TYPE_DOUBLE:
+            *size_out = 8;
+            break;
+        case NXLD_PARAM_TYPE_CHAR:
+            *size_out = 1;
+            break;
+        default:
+            if (is_immediate_value(&values[0])) {
+                *type_out = (uint8_t)values[0].type;
+                *size_out = values[0].size;
+                return 0;
+            }
+            *size_out = values[0].size > 0 ? values[0].size : sizeof(void*);
+            break;
+    }
+    *type_out = (uint8_t)param_type;
+    return 0;
+}
+
+/**
+ * @brief 将批量结果槽转换为调用结果 / Convert a batch result slot to a call result / Batch-Ergebnis-Slot in ein Aufrufergebnis umwandeln
+ */
+static void read_result_slot(pt_return_type_t return_type, const uint64_t* slot, int64_t* result_int, double* result_float) {
+    *result_int = 0;
+    *result_float = 0.0;
+    if (return_type == PT_RETURN_TYPE_FLOAT) {
+        float narrow = 0.0f;
+        memcpy(&narrow, slot, sizeof(float));
+        *result_float = (double)narrow;
+    } else if (return_type == PT_RETURN_TYPE_DOUBLE) {
+        memcpy(result_float, slot, sizeof(double));
+    } else if (return_type == PT_RETURN_TYPE_STRUCT_PTR) {
+        void* ptr = NULL;
+        memcpy(&ptr, slot, sizeof(void*));
+        *result_int = (int64_t)(intptr_t)ptr;
+    } else {
+        memcpy(result_int, slot, sizeof(int64_t));
+    }
+}
+
+/**
+ * @brief 以一次<Interface>_Vec调用执行多行目标接口调用 / Execute several rows of a target interface call with one <Interface>_Vec call / Mehrere Zeilen eines Zielschnittstellenaufrufs mit einem <Interface>_Vec-Aufruf ausführen
+ * @details 每行的结果随后按正常调用的方式设置参数并执行返回值规则 / Each row's result then sets parameters and runs return value rules just like a regular call / Das Ergebnis jeder Zeile setzt danach Parameter und führt Rückgabewertregeln wie ein regulärer Aufruf aus
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param values 每行要传递的值 / Value to transfer for each row / Zu übertragender Wert je Zeile
+ * @param count 行数 / Row count / Zeilenanzahl
+ * @param success_count 累加成功的行数 / Accumulates successful rows / Summiert erfolgreiche Zeilen
+ * @param row_done 输出每行是否已执行 / Outputs whether each row has run / Gibt aus, ob jede Zeile ausgeführt wurde
+ * @return 全部行已批量执行返回0，不适用或部分失败返回-1 / Returns 0 when all rows ran as a batch, -1 when not applicable or partly failed / Gibt 0 zurück, wenn alle Zeilen als Batch liefen, -1 wenn nicht anwendbar oder teilweise fehlgeschlagen
+ */
+int call_target_plugin_interface_batch(const pointer_transfer_rule_t* rule, const pt_typed_value_t* values, size_t count,
+                                       size_t* success_count, uint8_t* row_done) {
+    if (row_done == NULL) {
+        return -1;
+    }
+    memset(row_done, 0, count);
+    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL || values == NULL ||
+        success_count == NULL || count < 2 || count > UINT32_MAX) {
+        return -1;
+    }
+    
+    /* 常量规则忽略传递值，逐行调用即可 / Constant rules ignore the transferred value, row-by-row calls suffice / Konstantenregeln ignorieren den übertragenen Wert, zeilenweise Aufrufe genügen */
+    if (rule->target_param_value != NULL && rule->target_param_value[0] != '\0') {
+        return -1;
+    }
+    
+    target_interface_state_t* state = get_target_interface_state(rule);
+    if (state == NULL) {
+        return -1;
+    }
+    
+    char vec_name[BATCH_FUNC_NAME_SIZE];
+    size_t name_len = strlen(rule->target_interface);
+    if (name_len + sizeof(PT_BATCH_INTERFACE_SUFFIX) > sizeof(vec_name)) {
+        return -1;
+    }
+    memcpy(vec_name, rule->target_interface, name_len);
+    memcpy(vec_name + name_len, PT_BATCH_INTERFACE_SUFFIX, sizeof(PT_BATCH_INTERFACE_SUFFIX));
+    void* vec_func = pt_platform_get_symbol(state->handle, vec_name);
+    if (vec_func == NULL) {
+        return -1;
+    }
+    
+    if (state->param_types == NULL || state->param_values == NULL || state->param_ready == NULL ||
+        rule->target_param_index < 0 || rule->target_param_index >= state->param_count) {
+        return -1;
+    }
+    
+    /* 用第一行设置参数以检查就绪状态，逐行回退时会重新设置 / Set parameters from the first row to check readiness, a row-by-row fallback sets them again / Parameter aus der ersten Zeile setzen, um die Bereitschaft zu prüfen; ein zeilenweiser Fallback setzt sie erneut */
+    if (validate_and_set_parameter(rule, state, &values[0]) != 0) {
+        return -1;
+    }
+    int ready = state->is_variadic ? calculate_variadic_ready_count(state) >= state->min_param_count
+                                   : calculate_variadic_ready_count(state) == state->param_count;
+    if (!ready) {
+        return -1;
+    }
+    
+    int actual_param_count = calculate_actual_param_count(rule, state);
+    if (actual_param_count <= rule->target_param_index || !other_parameters_are_constant(rule, state, actual_param_count)) {
+        return -1;
+    }
+    
+    pt_return_type_t return_type;
+    size_t return_size;
+    void* struct_buffer = NULL;
+    if (prepare_return_type_and_buffer(state, &return_type, &return_size, &struct_buffer) != 0) {
+        return -1;
+    }
+    if (struct_buffer != NULL || return_type == PT_RETURN_TYPE_STRUCT_VAL) {
+        free(struct_buffer);
+        return -1;
+    }
+    
+    if (validate_plugin_function(state, rule->target_plugin_path, rule->target_interface, actual_param_count, return_type) != 0) {
+        return -1;
+    }
+    
+    size_t param_count = (size_t)actual_param_count;
+    uint8_t* types = (uint8_t*)malloc(param_count > 0 ? param_count : 1);
+    size_t* sizes = (size_t*)malloc((param_count > 0 ? param_count : 1) * sizeof(size_t));
+    uint64_t** columns = (uint64_t**)calloc(param_count > 0 ? param_count : 1, sizeof(uint64_t*));
+    uint64_t* slots = (uint64_t*)malloc((param_count + 1) * count * sizeof(uint64_t));
+    if (types == NULL || sizes == NULL || columns == NULL || slots == NULL) {
+        free(types);
+        free(sizes);
+        free(columns);
+        free(slots);
+        return -1;
+    }
+    
+    int result = 0;
+    int target_index = rule->target_param_index;
+    for (size_t p = 0; p < param_count && result == 0; p++) {
+        columns[p] = slots + p * count;
+        if ((int)p == target_index) {
+            result = get_target_column_shape(state->param_types[p], values, count, &types[p], &sizes[p]);
+            for (size_t i = 0; i < count && result == 0; i++) {
+                store_value_slot(state->param_types[p], &values[i], &columns[p][i]);
+            }
+        } else {
+            types[p] = (uint8_t)state->param_types[p];
+            sizes[p] = state->param_sizes != NULL ? state->param_sizes[p] : 0;
+            store_parameter_slot(state->param_types[p], state->param_values[p], &columns[p][0]);
+            for (size_t i = 1; i < count; i++) {
+                columns[p][i] = columns[p][0];
+            }
+        }
+    }
+    
+    uint64_t* results = slots + param_count * count;
+    memset(results, 0, count * sizeof(uint64_t));
+    pt_batch_t batch;
+    batch.count = (uint32_t)count;
+    batch.param_count = (uint32_t)param_count;
+    batch.types = types;
+    batch.sizes = sizes;
+    batch.columns = (const uint64_t* const*)columns;
+    batch.results = results;
+    batch.row_done = row_done;
+    
+    int called = 0;
+    if (result == 0) {
+        internal_log_write("INFO", "Calling %s.%s for %zu rows", rule->target_plugin, vec_name, count);
+        plugin_registry_entry_t* entry = pin_plugin_registry_entry(rule->target_plugin);
+        int32_t call_result = pt_platform_vector_call(vec_func, &batch);
+        unpin_plugin_registry_entry(entry);
+        called = 1;
+        if (call_result == 0) {
+            memset(row_done, 1, count);
+        } else {
+            /* 只有插件标记为完成的行保留，其余行由调用者逐行重新调用 / Only rows the plugin marked as done are kept, the caller calls the rest again row by row / Nur vom Plugin als erledigt markierte Zeilen bleiben, den Rest ruft der Aufrufer zeilenweise erneut auf */
+            internal_log_write("WARNING", "%s.%s failed (error=%d), calling incomplete rows row by row", rule->target_plugin, vec_name, call_result);
+            result = -1;
+        }
+    }
+    
+    if (called) {
+        /* 逐行分发结果，参数设置和下游规则与单次调用相同 / Scatter results row by row, parameter setting and downstream rules match a single call / Ergebnisse zeilenweise verteilen, Parametersetzung und nachgelagerte Regeln wie bei einem Einzelaufruf */
+        for (size_t i = 0; i < count; i++) {
+            if (!row_done[i]) {
+                continue;
+            }
+            int64_t result_int = 0;
+            double result_float = 0.0;
+            read_result_slot(return_type, &results[i], &result_int, &result_float);
+            if (call_target_plugin_interface_with_result(rule, &values[i], result_int, result_float) == 0) {
+                (*success_count)++;
+            }
+        }
+    }
+    
+    free(types);
+    free(sizes);
+    free(columns);
+    free(slots);
+    return result;
+}
@@ -22,6 +22,9 @@ void cleanup_interface_state_parameters(target_interface_state_t* state) {
         for (int i = 0; i < state->param_count; i++) {
             state->param_ready[i] = 0;
             state->param_values[i] = NULL;
+            if (state->param_borrowed != NULL) {
+                state->param_borrowed[i] = 0;
+            }
         }
     }
 }
@@ -43,6 +46,9 @@ void cleanup_setgroup_target_interface_parameters(pointer_transfer_context_t* ct
         for (int i = 0; i < target_state->param_count; i++) {
             target_state->param_ready[i] = 0;
             target_state->param_values[i] = NULL;
+            if (target_state->param_borrowed != NULL) {
+                target_state->param_borrowed[i] = 0;
+            }
         }
         internal_log_write("INFO", "Cleaned up parameter state for SetGroup target interface %s.%s", 
                       plugin_name, interface_name);
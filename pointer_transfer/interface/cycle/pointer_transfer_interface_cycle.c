@@ -4,44 +4,130 @@
  */
 
 #include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include <stdlib.h>
 #include <string.h>
-#include <stdio.h>
+#include <stdint.h>
 #include "pointer_transfer_utils.h"
 
+/* 每线程活动接口位图（按规则图节点ID索引） / Per-thread active interface bitset (indexed by rule graph node ID) / Thread-lokales Bitset aktiver Schnittstellen (nach Regelgraph-Knoten-ID indiziert) */
+static PT_THREAD_LOCAL uint64_t* g_active_node_bits = NULL;
+static PT_THREAD_LOCAL size_t g_active_node_word_count = 0;
+
+/**
+ * @brief 确保位图可容纳节点ID / Ensure bitset can hold node ID / Sicherstellen, dass Bitset Knoten-ID aufnehmen kann
+ */
+static int ensure_active_node_bits(size_t node_id) {
+    size_t word = node_id / 64;
+    if (word < g_active_node_word_count) {
+        return 0;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    size_t needed = (ctx->rule_graph.node_count + 63) / 64;
+    if (needed <= word) {
+        needed = word + 1;
+    }
+    
+    uint64_t* new_bits = (uint64_t*)realloc(g_active_node_bits, needed * sizeof(uint64_t));
+    if (new_bits == NULL) {
+        internal_log_write("ERROR", "ensure_active_node_bits: failed to allocate bitset (words=%zu)", needed);
+        return -1;
+    }
+    memset(new_bits + g_active_node_word_count, 0, (needed - g_active_node_word_count) * sizeof(uint64_t));
+    g_active_node_bits = new_bits;
+    g_active_node_word_count = needed;
+    return 0;
+}
+
+/**
+ * @brief 标记环上节点为活动 / Mark a node on a cycle as active / Knoten auf einem Zyklus als aktiv markieren
+ * @return 已标记返回1，节点已经活动返回0，失败返回-1 / Returns 1 if marked, 0 if the node is already active, -1 on failure / Gibt 1 zurück, wenn markiert, 0 wenn der Knoten bereits aktiv ist, -1 bei Fehler
+ */
+static int mark_active_node(size_t node_id) {
+    if (ensure_active_node_bits(node_id) != 0) {
+        return -1;
+    }
+    
+    uint64_t mask = (uint64_t)1 << (node_id % 64);
+    if (g_active_node_bits[node_id / 64] & mask) {
+        return 0;
+    }
+    g_active_node_bits[node_id / 64] |= mask;
+    return 1;
+}
+
 /**
  * @brief 检测调用循环 / Detect call cycle / Aufrufzyklus erkennen
+ * @details 目标接口不在规则图环中时跳过检测；否则检查并标记每线程活动位图 / Skips the check when the target interface is not in a rule graph cycle; otherwise tests and marks the per-thread active bitset / Überspringt die Prüfung, wenn die Zielschnittstelle in keinem Regelgraph-Zyklus liegt; sonst wird das thread-lokale Aktiv-Bitset geprüft und markiert
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
+ * @param mark_out 输出已标记的节点ID（未标记为RULE_GRAPH_INVALID_NODE） / Output marked node ID (RULE_GRAPH_INVALID_NODE if not marked) / Ausgabe markierte Knoten-ID (RULE_GRAPH_INVALID_NODE wenn nicht markiert)
  * @return 检测到循环返回-1，否则返回0 / Returns -1 if cycle detected, 0 otherwise / Gibt -1 zurück, wenn Zyklus erkannt, sonst 0
  */
-int detect_call_cycle(const pointer_transfer_rule_t* rule, const char* call_chain[], size_t call_chain_size) {
-    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL) {
+int detect_call_cycle(const pointer_transfer_rule_t* rule, size_t* mark_out) {
+    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL || mark_out == NULL) {
         return -1;
     }
     
-    char current_call[512];
-    snprintf(current_call, sizeof(current_call), "%s.%s", rule->target_plugin, rule->target_interface);
+    *mark_out = RULE_GRAPH_INVALID_NODE;
     
-    if (call_chain_size > 0) {
-        for (size_t i = 0; i < call_chain_size; i++) {
-            if (call_chain[i] != NULL && strcmp(call_chain[i], current_call) == 0) {
-                internal_log_write("WARNING", "Call cycle detected: %s -> ... -> %s", call_chain[0] != NULL ? call_chain[0] : "unknown", current_call);
-                return -1;
-            }
-        }
+    size_t node_id = get_rule_target_graph_node(rule);
+    if (node_id == RULE_GRAPH_INVALID_NODE || !is_rule_graph_node_cyclic(node_id)) {
+        return 0;
     }
     
+    int marked = mark_active_node(node_id);
+    if (marked < 0) {
+        return -1;
+    }
+    if (marked == 0) {
+        internal_log_write("WARNING", "Call cycle detected: %s.%s is already active on this call path", rule->target_plugin, rule->target_interface);
+        return -1;
+    }
+    
+    *mark_out = node_id;
     return 0;
 }
 
 /**
- * @brief 检查递归深度 / Check recursion depth / Rekursionstiefe prüfen
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
+ * @brief 在遍历目标前标记源接口 / Mark the source interface before its targets are walked / Quellschnittstelle markieren, bevor ihre Ziele durchlaufen werden
+ * @details 源接口正在执行（它调用了传递函数），因此回到它的规则也是循环 / The source interface is running (it called the transfer function), so a rule leading back to it is a cycle too / Die Quellschnittstelle läuft (sie hat die Übertragungsfunktion aufgerufen), daher ist auch eine zu ihr zurückführende Regel ein Zyklus
+ * @param plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @return 已标记的节点ID；不在环中或已由外层帧标记时返回RULE_GRAPH_INVALID_NODE / Marked node ID; RULE_GRAPH_INVALID_NODE if not on a cycle or already marked by an enclosing frame / Markierte Knoten-ID; RULE_GRAPH_INVALID_NODE, wenn nicht auf einem Zyklus oder bereits von einem umgebenden Rahmen markiert
+ */
+size_t mark_call_cycle_source(const char* plugin_name, const char* interface_name) {
+    if (plugin_name == NULL || interface_name == NULL) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    
+    size_t node_id = find_rule_graph_node(plugin_name, interface_name);
+    if (node_id == RULE_GRAPH_INVALID_NODE || !is_rule_graph_node_cyclic(node_id) || mark_active_node(node_id) != 1) {
+        return RULE_GRAPH_INVALID_NODE;
+    }
+    return node_id;
+}
+
+/**
+ * @brief 清除调用循环标记 / Clear call cycle mark / Aufrufzyklus-Markierung löschen
+ * @param node_id detect_call_cycle输出的节点ID / Node ID output by detect_call_cycle / Von detect_call_cycle ausgegebene Knoten-ID
  */
-void check_recursion_depth(int recursion_depth) {
-    if (recursion_depth > 32) {
-        internal_log_write("WARNING", "High recursion depth detected in call_target_plugin_interface (depth=%d)", recursion_depth);
+void release_call_cycle_mark(size_t node_id) {
+    if (node_id == RULE_GRAPH_INVALID_NODE || node_id / 64 >= g_active_node_word_count) {
+        return;
     }
+    
+    g_active_node_bits[node_id / 64] &= ~((uint64_t)1 << (node_id % 64));
 }
 
+/**
+ * @brief 释放当前线程的调用循环位图 / Free call cycle bitset of current thread / Aufrufzyklus-Bitset des aktuellen Threads freigeben
+ */
+void free_call_cycle_marks(void) {
+    if (g_active_node_bits != NULL) {
+        free(g_active_node_bits);
+        g_active_node_bits = NULL;
+    }
+    g_active_node_word_count = 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file pointer_transfer_interface_engine_pool.c
+ * @brief 每线程调用帧池 / Per-Thread Call Frame Pool / Thread-lokaler Aufrufrahmen-Pool
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "pointer_transfer_utils.h"
+
+/* 空闲链表保留的最大帧数，超出部分直接释放 / Maximum frames kept on free list, excess frames are freed directly / Maximale Rahmen in der Freiliste, überschüssige Rahmen werden direkt freigegeben */
+#define PT_FRAME_POOL_MAX_CACHED 64
+
+/**
+ * @brief 单个线程的帧池 / Frame pool of one thread / Rahmenpool eines Threads
+ */
+typedef struct pt_frame_pool_s {
+    pt_call_frame_t* free_frames;  /**< 空闲帧链表 / Free frame list / Freirahmen-Liste */
+    size_t free_count;             /**< 空闲帧数量 / Free frame count / Anzahl freier Rahmen */
+    struct pt_frame_pool_s* next;  /**< 全局帧池列表中的下一个 / Next in the global pool list / Nächster in der globalen Pool-Liste */
+} pt_frame_pool_t;
+
+/* 所有线程的帧池，清理时由任意线程统一释放 / Pools of all threads, freed together by whichever thread cleans up / Pools aller Threads, werden von dem bereinigenden Thread gemeinsam freigegeben */
+static pt_platform_mutex_t* g_frame_pool_lock = NULL;
+static pt_frame_pool_t* g_frame_pools = NULL;
+
+/* 每次释放全部帧池时递增，使其他线程缓存的帧池指针失效 / Incremented whenever all pools are freed, invalidating pool pointers cached by other threads / Wird bei jeder Freigabe aller Pools erhöht und macht von anderen Threads gecachte Pool-Zeiger ungültig */
+static volatile int g_frame_pool_generation = 0;
+
+/* 当前线程的帧池及其所属代 / Current thread's pool and its generation / Pool des aktuellen Threads und seine Generation */
+static PT_THREAD_LOCAL pt_frame_pool_t* g_thread_frame_pool = NULL;
+static PT_THREAD_LOCAL int g_thread_frame_pool_generation = 0;
+
+/**
+ * @brief 创建帧池列表锁 / Create frame pool list lock / Sperre der Rahmenpool-Liste erstellen
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int init_call_frame_pool_lock(void) {
+    if (g_frame_pool_lock == NULL) {
+        g_frame_pool_lock = pt_platform_mutex_create();
+    }
+    if (g_frame_pool_lock == NULL) {
+        internal_log_write("ERROR", "init_call_frame_pool_lock: failed to create frame pool lock");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 获取当前线程的帧池，首次使用时注册 / Get current thread's pool, registering it on first use / Pool des aktuellen Threads abrufen, bei erster Verwendung registrieren
+ * @return 帧池，锁未创建或分配失败返回NULL（帧不再缓存） / Frame pool, NULL if the lock was not created or allocation failed (frames are then not cached) / Rahmenpool, NULL wenn die Sperre nicht erstellt wurde oder die Zuweisung fehlschlug (Rahmen werden dann nicht gecacht)
+ */
+static pt_frame_pool_t* get_thread_frame_pool(void) {
+    if (g_thread_frame_pool != NULL &&
+        g_thread_frame_pool_generation == pt_platform_atomic_load_int(&g_frame_pool_generation)) {
+        return g_thread_frame_pool;
+    }
+    g_thread_frame_pool = NULL;
+    if (g_frame_pool_lock == NULL) {
+        return NULL;
+    }
+    
+    pt_frame_pool_t* pool = (pt_frame_pool_t*)calloc(1, sizeof(pt_frame_pool_t));
+    if (pool == NULL) {
+        return NULL;
+    }
+    pt_platform_mutex_lock(g_frame_pool_lock);
+    pool->next = g_frame_pools;
+    g_frame_pools = pool;
+    g_thread_frame_pool_generation = pt_platform_atomic_load_int(&g_frame_pool_generation);
+    pt_platform_mutex_unlock(g_frame_pool_lock);
+    g_thread_frame_pool = pool;
+    return pool;
+}
+
+/**
+ * @brief 从当前线程帧池获取调用帧 / Acquire call frame from current thread frame pool / Aufrufrahmen aus Rahmenpool des aktuellen Threads abrufen
+ * @return 成功返回帧指针，失败返回NULL / Returns frame pointer on success, NULL on failure / Gibt Rahmenzeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_call_frame_t* acquire_call_frame(void) {
+    pt_frame_pool_t* pool = get_thread_frame_pool();
+    pt_call_frame_t* frame = pool != NULL ? pool->free_frames : NULL;
+    if (frame != NULL) {
+        pool->free_frames = frame->next_free;
+        pool->free_count--;
+        frame->next_free = NULL;
+        return frame;
+    }
+    
+    frame = (pt_call_frame_t*)malloc(sizeof(pt_call_frame_t));
+    if (frame == NULL) {
+        internal_log_write("ERROR", "acquire_call_frame: failed to allocate call frame (size=%zu)", sizeof(pt_call_frame_t));
+        return NULL;
+    }
+    frame->next_free = NULL;
+    return frame;
+}
+
+/**
+ * @brief 将调用帧归还当前线程帧池 / Return call frame to current thread frame pool / Aufrufrahmen an Rahmenpool des aktuellen Threads zurückgeben
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ */
+void release_call_frame(pt_call_frame_t* frame) {
+    if (frame == NULL) {
+        return;
+    }
+    
+    pt_frame_pool_t* pool = get_thread_frame_pool();
+    if (pool == NULL || pool->free_count >= PT_FRAME_POOL_MAX_CACHED) {
+        free(frame);
+        return;
+    }
+    
+    frame->next_free = pool->free_frames;
+    pool->free_frames = frame;
+    pool->free_count++;
+}
+
+/**
+ * @brief 释放所有线程的帧池 / Free frame pools of all threads / Rahmenpools aller Threads freigeben
+ * @details 在没有进行中调用时执行；其他线程下次获取帧时按新的代重新注册帧池 / Runs while no call is in flight; other threads register a new pool for the new generation on their next acquire / Läuft, während kein Aufruf aktiv ist; andere Threads registrieren beim nächsten Abruf einen neuen Pool für die neue Generation
+ */
+void free_call_frame_pool(void) {
+    if (g_frame_pool_lock == NULL) {
+        return;
+    }
+    
+    pt_platform_mutex_lock(g_frame_pool_lock);
+    pt_frame_pool_t* pool = g_frame_pools;
+    g_frame_pools = NULL;
+    pt_platform_atomic_fetch_add_int(&g_frame_pool_generation, 1);
+    pt_platform_mutex_unlock(g_frame_pool_lock);
+    
+    while (pool != NULL) {
+        pt_frame_pool_t* next_pool = pool->next;
+        while (pool->free_frames != NULL) {
+            pt_call_frame_t* next = pool->free_frames->next_free;
+            free(pool->free_frames);
+            pool->free_frames = next;
+        }
+        free(pool);
+        pool = next_pool;
+    }
+    g_thread_frame_pool = NULL;
+}
+
+/**
+ * @brief 初始化调用帧 / Initialize call frame / Aufrufrahmen initialisieren
+ * @details 规则位于ctx->rules内时仅记录索引，子调用期间规则数组扩容不会使帧失效 / Records only the index when rule lies inside ctx->rules, so rules array growth during child calls does not invalidate the frame / Speichert nur den Index, wenn die Regel in ctx->rules liegt, sodass Wachstum des Regel-Arrays während Kindaufrufen den Rahmen nicht ungültig macht
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param value 要传递的值（NULL为空指针） / Value to transfer (NULL for a null pointer) / Zu übertragender Wert (NULL für einen Nullzeiger)
+ * @param parent 父帧（根帧为NULL） / Parent frame (NULL for root) / Elternrahmen (NULL für Wurzel)
+ */
+void init_call_frame(pt_call_frame_t* frame, const pointer_transfer_rule_t* rule, const pt_typed_value_t* value, pt_call_frame_t* parent) {
+    if (frame == NULL) {
+        return;
+    }
+    
+    /* 只重置标量字段，匹配数组由各阶段按需填充 / Reset scalar fields only, match arrays are filled by stages on demand / Nur skalare Felder zurücksetzen, Treffer-Arrays werden von den Phasen bei Bedarf gefüllt */
+    frame->parent = parent;
+    frame->next_free = NULL;
+    frame->rule_index = SIZE_MAX;
+    frame->external_rule = rule;
+    frame->value = value != NULL ? *value : make_pointer_value(NULL, NXLD_PARAM_TYPE_POINTER, 0);
+    frame->depth = parent != NULL ? parent->depth + 1 : 0;
+    frame->skip_param_cleanup = 0;
+    frame->stage = PT_FRAME_STAGE_ENTER;
+    frame->result = -1;
+    frame->child_result = 0;
+    frame->cycle_mark = RULE_GRAPH_INVALID_NODE;
+    frame->prepared = 0;
+    frame->state = NULL;
+    frame->plugin_entry = NULL;
+    frame->state_base = NULL;
+    frame->actual_param_count = 0;
+    frame->return_type = PT_RETURN_TYPE_INTEGER;
+    frame->return_size = 0;
+    frame->struct_buffer = NULL;
+    frame->result_int = 0;
+    frame->result_float = 0.0;
+    frame->matched_count = 0;
+    frame->match_idx = 0;
+    frame->active_rule_idx = 0;
+    frame->group_count = 0;
+    frame->group_idx = 0;
+    frame->param_rule_idx = 0;
+    frame->memo_pending = 0;
+    frame->memo_buffer = NULL;
+    frame->has_batch_result = 0;
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (rule != NULL && ctx != NULL && ctx->rules != NULL &&
+        rule >= ctx->rules && rule < ctx->rules + ctx->rule_count) {
+        frame->rule_index = (size_t)(rule - ctx->rules);
+        frame->external_rule = NULL;
+    }
+}
+
+/**
+ * @brief 获取调用帧的规则 / Get rule of call frame / Regel des Aufrufrahmens abrufen
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @return 规则指针，失败返回NULL / Rule pointer, NULL on failure / Regelzeiger, NULL bei Fehler
+ */
+const pointer_transfer_rule_t* get_call_frame_rule(const pt_call_frame_t* frame) {
+    if (frame == NULL) {
+        return NULL;
+    }
+    
+    if (frame->rule_index == SIZE_MAX) {
+        return frame->external_rule;
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->rules == NULL || frame->rule_index >= ctx->rule_count) {
+        return NULL;
+    }
+    return &ctx->rules[frame->rule_index];
+}
@@ -0,0 +1,99 @@
+/**
+ * @file pointer_transfer_interface_engine_queue.c
+ * @brief 待执行调用的重排与批量执行 / Reordering and Batched Execution of Pending Calls / Umordnung und Batch-Ausführung ausstehender Aufrufe
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 比较两个待执行调用（拓扑序号、规则、提交顺序） / Compare two pending calls (topological rank, rule, submission order) / Zwei ausstehende Aufrufe vergleichen (topologischer Rang, Regel, Einreichungsreihenfolge)
+ * @details 提交顺序作为最后的键，使qsort的结果稳定 / Submission order is the last key, which makes the qsort result stable / Die Einreichungsreihenfolge ist der letzte Schlüssel, wodurch das qsort-Ergebnis stabil wird
+ */
+static int compare_pending_calls(const void* a, const void* b) {
+    const pt_pending_call_t* left = (const pt_pending_call_t*)a;
+    const pt_pending_call_t* right = (const pt_pending_call_t*)b;
+    
+    if (left->rank != right->rank) {
+        return left->rank < right->rank ? -1 : 1;
+    }
+    
+    uintptr_t left_rule = (uintptr_t)left->rule;
+    uintptr_t right_rule = (uintptr_t)right->rule;
+    if (left_rule != right_rule) {
+        return left_rule < right_rule ? -1 : 1;
+    }
+    
+    if (left->order != right->order) {
+        return left->order < right->order ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 重排并执行一组相互独立的待执行调用 / Reorder and execute a set of independent pending calls / Eine Menge unabhängiger ausstehender Aufrufe umordnen und ausführen
+ * @details 上游目标先执行，使其传递出的值在下游目标被调用前就绪；无图节点的调用排在最后 / Upstream targets run first so the values they transfer are ready before downstream targets are called; calls without a graph node go last / Vorgelagerte Ziele laufen zuerst, damit ihre übertragenen Werte bereit sind, bevor nachgelagerte Ziele aufgerufen werden; Aufrufe ohne Graphknoten kommen zuletzt
+ */
+int run_pending_calls(pt_pending_call_t* calls, size_t count, size_t* success_count) {
+    if (calls == NULL || success_count == NULL) {
+        return -1;
+    }
+    
+    if (count == 0) {
+        return 0;
+    }
+    
+    pt_typed_value_t* rows = (pt_typed_value_t*)malloc(count * sizeof(pt_typed_value_t));
+    uint8_t* row_done = (uint8_t*)malloc(count);
+    if (rows == NULL || row_done == NULL) {
+        internal_log_write("ERROR", "run_pending_calls: failed to allocate row buffer (count=%zu)", count);
+        free(rows);
+        free(row_done);
+        return -1;
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        calls[i].rank = get_rule_graph_node_rank(get_rule_target_graph_node(calls[i].rule));
+        calls[i].order = i;
+    }
+    qsort(calls, count, sizeof(pt_pending_call_t), compare_pending_calls);
+    
+    size_t i = 0;
+    while (i < count) {
+        const pointer_transfer_rule_t* rule = calls[i].rule;
+        size_t end = i + 1;
+        while (end < count && calls[end].rule == rule) {
+            end++;
+        }
+        
+        /* 同一规则的连续调用合并为一次批量调用 / Consecutive calls of the same rule are merged into one batch call / Aufeinanderfolgende Aufrufe derselben Regel werden zu einem Batch-Aufruf zusammengefasst */
+        for (size_t k = i; k < end; k++) {
+            rows[k - i] = calls[k].value;
+        }
+        if (call_target_plugin_interface_batch(rule, rows, end - i, success_count, row_done) == 0) {
+            i = end;
+            continue;
+        }
+        
+        /* 批量函数已执行的行不再重复调用 / Rows the batch function already ran are not called again / Von der Batch-Funktion bereits ausgeführte Zeilen werden nicht erneut aufgerufen */
+        for (size_t start = i; i < end; i++) {
+            if (row_done[i - start]) {
+                continue;
+            }
+            int call_result = call_target_plugin_interface(rule, &calls[i].value);
+            if (call_result == 0) {
+                (*success_count)++;
+            } else {
+                internal_log_write("WARNING", "Failed to call target plugin interface (error=%d)", call_result);
+            }
+        }
+    }
+    
+    free(rows);
+    free(row_done);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file pointer_transfer_interface_engine_step.c
+ * @brief 调用帧状态机 / Call Frame State Machine / Aufrufrahmen-Zustandsautomat
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_types.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 获取最大调用深度 / Get maximum call depth / Maximale Aufruftiefe abrufen
+ * @return 最大调用深度 / Maximum call depth / Maximale Aufruftiefe
+ */
+int get_max_call_depth(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->max_call_depth <= 0) {
+        return PT_DEFAULT_MAX_CALL_DEPTH;
+    }
+    return ctx->max_call_depth;
+}
+
+/**
+ * @brief 刷新帧的接口状态指针 / Refresh interface state pointer of frame / Schnittstellenstatus-Zeiger des Rahmens aktualisieren
+ * @details 子调用可能扩容状态数组；状态只追加不删除，按偏移重新定位 / Child calls may grow the states array; states are append-only, so relocate by offset / Kindaufrufe können das Status-Array vergrößern; Status werden nur angehängt, daher per Offset neu verorten
+ */
+static void refresh_call_frame_state(pointer_transfer_context_t* ctx, pt_call_frame_t* frame) {
+    if (frame->state == NULL || frame->state_base == ctx->interface_states) {
+        return;
+    }
+    
+    frame->state = ctx->interface_states + (frame->state - frame->state_base);
+    frame->state_base = ctx->interface_states;
+}
+
+/**
+ * @brief 进入阶段：准备并调用目标接口 / Enter stage: prepare and call target interface / Eintrittsphase: Zielschnittstelle vorbereiten und aufrufen
+ */
+static pt_frame_action_t step_call_frame_enter(pointer_transfer_context_t* ctx, pt_call_frame_t* frame) {
+    const pointer_transfer_rule_t* rule = get_call_frame_rule(frame);
+    frame->stage = PT_FRAME_STAGE_EXIT;
+    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL) {
+        internal_log_write("ERROR", "Invalid parameters for call_target_plugin_interface");
+        return PT_FRAME_ACTION_CONTINUE;
+    }
+    
+    if (detect_call_cycle(rule, &frame->cycle_mark) != 0) {
+        return PT_FRAME_ACTION_CONTINUE;
+    }
+    
+    if (prepare_interface_call(rule, &frame->value, &frame->state, &frame->actual_param_count,
+                               &frame->return_type, &frame->return_size, &frame->struct_buffer) != 0) {
+        return PT_FRAME_ACTION_CONTINUE;
+    }
+    frame->prepared = 1;
+    frame->state_base = ctx->interface_states;
+    frame->plugin_entry = pin_plugin_registry_entry(rule->target_plugin);
+    
+    /* 批量调用已给出结果或纯接口命中记忆化缓存时跳过插件调用 / Skip plugin call when a batch call produced the result or a pure interface hits the memoization cache / Plugin-Aufruf überspringen, wenn ein Batch-Aufruf das Ergebnis lieferte oder eine reine Schnittstelle den Memoisierungs-Cache trifft */
+    if (!frame->has_batch_result && lookup_memoized_result(rule, frame) != 0) {
+        if (execute_interface_call(frame->state, rule, frame->actual_param_count, frame->return_type, frame->return_size,
+                                   frame->struct_buffer, &frame->result_int, &frame->result_float) != 0) {
+            return PT_FRAME_ACTION_CONTINUE;
+        }
+        store_memoized_result(rule, frame);
+    }
+    
+    frame->result = 0;
+    if (ctx->rules == NULL) {
+        return PT_FRAME_ACTION_CONTINUE;
+    }
+    
+    frame->matched_count = collect_matching_return_value_rules(ctx, rule->target_plugin, rule->target_interface,
+                                                               frame->matched_rules, PT_FRAME_MAX_MATCHED_RULES);
+    memset(frame->processed, 0, sizeof(frame->processed));
+    frame->match_idx = 0;
+    frame->stage = PT_FRAME_STAGE_RETURN_RULES;
+    return PT_FRAME_ACTION_CONTINUE;
+}
+
+/**
+ * @brief 退出阶段：释放调用资源和循环标记 / Exit stage: release call resources and cycle mark / Austrittsphase: Aufrufressourcen und Zyklusmarkierung freigeben
+ */
+static pt_frame_action_t step_call_frame_exit(pointer_transfer_context_t* ctx, pt_call_frame_t* frame) {
+    if (frame->prepared) {
+        refresh_call_frame_state(ctx, frame);
+        cleanup_interface_call_resources(frame->return_type, frame->struct_buffer, frame->state, frame->skip_param_cleanup);
+        frame->struct_buffer = NULL;
+        frame->prepared = 0;
+        unpin_plugin_registry_entry(frame->plugin_entry);
+        frame->plugin_entry = NULL;
+    }
+    
+    if (frame->memo_buffer != NULL) {
+        free(frame->memo_buffer);
+        frame->memo_buffer = NULL;
+    }
+    
+    release_call_cycle_mark(frame->cycle_mark);
+    frame->cycle_mark = RULE_GRAPH_INVALID_NODE;
+    return PT_FRAME_ACTION_POP;
+}
+
+/**
+ * @brief 执行调用帧的一步 / Execute one step of call frame / Einen Schritt des Aufrufrahmens ausführen
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t step_call_frame(pt_call_frame_t* frame, pt_call_frame_t** child_out) {
+    if (frame == NULL || child_out == NULL) {
+        return PT_FRAME_ACTION_POP;
+    }
+    
+    *child_out = NULL;
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    switch (frame->stage) {
+        case PT_FRAME_STAGE_ENTER:
+            return step_call_frame_enter(ctx, frame);
+        case PT_FRAME_STAGE_RETURN_RULES:
+            return step_return_value_rules(ctx, frame, child_out);
+        case PT_FRAME_STAGE_RETURN_RULE_RESUME:
+            return resume_non_setgroup_rule(ctx, frame);
+        case PT_FRAME_STAGE_SETGROUP:
+            return step_setgroup_rule_group(ctx, frame, child_out);
+        case PT_FRAME_STAGE_SETGROUP_RESUME:
+            return resume_setgroup_rule(ctx, frame);
+        case PT_FRAME_STAGE_PARAM_RULES:
+            refresh_call_frame_state(ctx, frame);
+            return step_parameter_value_rules(ctx, frame, child_out);
+        case PT_FRAME_STAGE_PARAM_RULE_RESUME:
+            return resume_parameter_value_rule(ctx, frame);
+        case PT_FRAME_STAGE_EXIT:
+        default:
+            return step_call_frame_exit(ctx, frame);
+    }
+}
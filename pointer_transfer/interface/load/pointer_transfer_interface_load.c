@@ -9,6 +9,7 @@
 #include "pointer_transfer_plugin_loader.h"
 #include "pointer_transfer_platform.h"
 #include "pointer_transfer_utils.h"
+#include "config/reload/config_reload.h"
 #include <string.h>
 
 /**
@@ -29,11 +30,6 @@ int load_plugin_and_get_function(const pointer_transfer_rule_t* rule, void** han
         return -1;
     }
     
-    pointer_transfer_context_t* ctx = get_global_context();
-    if (!is_nxpt_loaded(rule->target_plugin)) {
-        chain_load_plugin_nxpt(rule->target_plugin, rule->target_plugin_path);
-    }
-    
     const char* plugin_path = rule->target_plugin_path;
     internal_log_write("INFO", "Using configured plugin path for %s: %s", rule->target_plugin, plugin_path);
     
@@ -43,7 +39,11 @@ int load_plugin_and_get_function(const pointer_transfer_rule_t* rule, void** han
         return -1;
     }
     
-    void* func_ptr = pt_platform_get_symbol(handle, rule->target_interface);
+    /* 符号解析结果缓存在注册表条目中 / Symbol lookups are cached in the registry entry / Symbolauflösungen werden im Registry-Eintrag gecacht */
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(rule->target_plugin);
+    void* func_ptr = entry != NULL && entry->handle == handle
+                     ? resolve_plugin_registry_symbol(entry, rule->target_interface)
+                     : pt_platform_get_symbol(handle, rule->target_interface);
     if (func_ptr == NULL) {
         internal_log_write("ERROR", "Function %s not found in plugin %s", rule->target_interface, rule->target_plugin);
         internal_log_write("ERROR", "Plugin %s does not export required function %s", 
@@ -56,3 +56,30 @@ int load_plugin_and_get_function(const pointer_transfer_rule_t* rule, void** han
     return 0;
 }
 
+/**
+ * @brief 获取规则目标的接口状态（调用路径，持读锁） / Get interface state of a rule target (call path, read lock held) / Schnittstellenstatus eines Regelziels abrufen (Aufrufpfad, Lesesperre gehalten)
+ * @details 只绑定准备阶段创建的状态；被卸载的插件在目标加载锁内重新加载，不会增长注册表或接口状态数组 / Only binds states created by the preparation pass; evicted plugins are reloaded under the target load lock, so neither the registry nor the interface state array grows / Bindet nur in der Vorbereitung erstellte Status; entladene Plugins werden unter der Ziel-Lade-Sperre neu geladen, sodass weder Registry noch Schnittstellenstatus-Array wachsen
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @return 成功返回接口状态，未准备或加载失败返回NULL / Returns interface state on success, NULL if not prepared or loading failed / Gibt Schnittstellenstatus bei Erfolg zurück, NULL wenn nicht vorbereitet oder Laden fehlgeschlagen
+ */
+target_interface_state_t* get_target_interface_state(const pointer_transfer_rule_t* rule) {
+    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL) {
+        return NULL;
+    }
+    
+    target_interface_state_t* state = find_interface_state(rule->target_plugin, rule->target_interface);
+    if (state == NULL) {
+        internal_log_write("ERROR", "Interface %s.%s was not prepared for dispatch", rule->target_plugin, rule->target_interface);
+        return NULL;
+    }
+    
+    void* handle = NULL;
+    void* func_ptr = NULL;
+    lock_target_loads();
+    int result = load_plugin_and_get_function(rule, &handle, &func_ptr);
+    if (result == 0) {
+        bind_interface_state(state, handle, func_ptr);
+    }
+    unlock_target_loads();
+    return result == 0 ? state : NULL;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file pointer_transfer_interface_load_prepare.c
+ * @brief 规则目标准备 / Rule Target Preparation / Regelziel-Vorbereitung
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include "config/reload/config_reload.h"
+#include <string.h>
+
+/**
+ * @brief 在写锁下准备所有启用规则的目标 / Prepare the targets of all enabled rules under the write lock / Ziele aller aktivierten Regeln unter der Schreibsperre vorbereiten
+ * @details 链式加载会追加规则并移动规则数组，接口状态创建会移动状态数组，因此都不能在读锁下进行；准备失败的目标在规则集下次变化时重试 / Chain loading appends rules and moves the rules array, creating interface states moves the state array, so neither may run under the read lock; targets that fail to prepare are retried when the rule set changes next / Kettenladen hängt Regeln an und verschiebt das Regel-Array, das Erstellen von Schnittstellenstatus verschiebt das Status-Array, daher darf beides nicht unter der Lesesperre laufen; fehlgeschlagene Ziele werden bei der nächsten Änderung des Regelsatzes erneut versucht
+ */
+static void prepare_transfer_targets(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 预加载线程写入同样的表 / The preload thread writes the same tables / Der Vorladethread schreibt dieselben Tabellen */
+    wait_for_plugin_preload();
+    acquire_rule_set_write();
+    if (pt_platform_atomic_load_int(&ctx->targets_prepared)) {
+        release_rule_set_write();
+        return;
+    }
+    
+    /* 链式加载会追加规则，每次迭代重新读取规则数组和数量 / Chain loading appends rules, so the rules array and count are re-read each iteration / Kettenladen hängt Regeln an, daher werden Regel-Array und Anzahl in jeder Iteration neu gelesen */
+    for (size_t i = 0; i < ctx->rule_count; i++) {
+        const pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (!rule->enabled || rule->target_plugin == NULL || rule->target_interface == NULL ||
+            rule->target_plugin_path == NULL || rule->target_plugin_path[0] == '\0') {
+            continue;
+        }
+        if (!is_nxpt_loaded(rule->target_plugin)) {
+            chain_load_plugin_nxpt(rule->target_plugin, rule->target_plugin_path);
+            rule = &ctx->rules[i];
+        }
+        if (find_interface_state(rule->target_plugin, rule->target_interface) != NULL) {
+            continue;
+        }
+        
+        void* handle = NULL;
+        void* func_ptr = NULL;
+        if (load_plugin_and_get_function(rule, &handle, &func_ptr) != 0 ||
+            find_or_create_interface_state(rule->target_plugin, rule->target_interface, handle, func_ptr) == NULL) {
+            internal_log_write("WARNING", "Failed to prepare target %s.%s, its rules will fail until the rule set changes",
+                              rule->target_plugin, rule->target_interface);
+        }
+    }
+    pt_platform_atomic_store_int(&ctx->targets_prepared, 1);
+    release_rule_set_write();
+}
+
+/**
+ * @brief 准备规则目标并获取规则集读锁 / Prepare rule targets and acquire the rule set read lock / Regelziele vorbereiten und Regelsatz-Lesesperre erwerben
+ */
+void acquire_prepared_rule_set(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 嵌套调用已持有读锁，规则集在此期间不会变化 / Nested calls already hold the read lock, the rule set cannot change meanwhile / Verschachtelte Aufrufe halten bereits die Lesesperre, der Regelsatz kann sich währenddessen nicht ändern */
+    if (get_rule_set_read_depth() > 0) {
+        acquire_rule_set_read();
+        return;
+    }
+    
+    /* 准备与获取读锁之间规则集可能再次变化，获取后重新检查 / The rule set may change again between preparing and taking the read lock, so it is re-checked afterwards / Der Regelsatz kann sich zwischen Vorbereitung und Erwerb der Lesesperre erneut ändern, daher wird danach erneut geprüft */
+    for (;;) {
+        if (!pt_platform_atomic_load_int(&ctx->targets_prepared)) {
+            prepare_transfer_targets();
+        }
+        acquire_rule_set_read();
+        if (pt_platform_atomic_load_int(&ctx->targets_prepared)) {
+            return;
+        }
+        release_rule_set_read();
+    }
+}
@@ -0,0 +1,296 @@
+/**
+ * @file pointer_transfer_interface_memo.c
+ * @brief 纯接口结果记忆化 / Pure Interface Result Memoization / Memoisierung von Ergebnissen reiner Schnittstellen
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_types.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 键缓冲区初始容量 / Initial key buffer capacity / Anfangskapazität des Schlüsselpuffers */
+#define MEMO_KEY_INITIAL_CAPACITY 256
+
+/* 每线程键缓冲区，避免每次调用分配 / Per-thread key buffer, avoids allocation per call / Thread-lokaler Schlüsselpuffer, vermeidet Zuweisung pro Aufruf */
+static PT_THREAD_LOCAL unsigned char* g_memo_key_buffer = NULL;
+static PT_THREAD_LOCAL size_t g_memo_key_capacity = 0;
+
+/**
+ * @brief 向键缓冲区追加字节 / Append bytes to key buffer / Bytes an Schlüsselpuffer anhängen
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int append_memo_key_bytes(size_t* key_size, const void* data, size_t length) {
+    if (length == 0) {
+        return 0;
+    }
+    if (length > SIZE_MAX - *key_size) {
+        return -1;
+    }
+    
+    size_t required = *key_size + length;
+    if (required > g_memo_key_capacity) {
+        size_t new_capacity = g_memo_key_capacity == 0 ? MEMO_KEY_INITIAL_CAPACITY : g_memo_key_capacity;
+        while (new_capacity < required) {
+            if (new_capacity > SIZE_MAX / CAPACITY_GROWTH_FACTOR) {
+                return -1;
+            }
+            new_capacity *= CAPACITY_GROWTH_FACTOR;
+        }
+        unsigned char* new_buffer = (unsigned char*)realloc(g_memo_key_buffer, new_capacity);
+        if (new_buffer == NULL) {
+            return -1;
+        }
+        g_memo_key_buffer = new_buffer;
+        g_memo_key_capacity = new_capacity;
+    }
+    
+    memcpy(g_memo_key_buffer + *key_size, data, length);
+    *key_size = required;
+    return 0;
+}
+
+/**
+ * @brief 将组装好的参数包序列化为键 / Serialize assembled parameter pack into key / Zusammengestelltes Parameterpaket in Schlüssel serialisieren
+ * @details 按pt_create_param_pack的读取方式序列化：标量按值，字符串按内容，指针按地址，结构体按字节 / Serialized the way pt_create_param_pack reads values: scalars by value, strings by content, pointers by address, structs by bytes / Serialisiert wie pt_create_param_pack Werte liest: Skalare nach Wert, Zeichenfolgen nach Inhalt, Zeiger nach Adresse, Strukturen nach Bytes
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int build_memo_key(const target_interface_state_t* state, int actual_param_count, size_t node_id, size_t* key_size_out) {
+    size_t key_size = 0;
+    int32_t count = (int32_t)actual_param_count;
+    if (append_memo_key_bytes(&key_size, &node_id, sizeof(node_id)) != 0 ||
+        append_memo_key_bytes(&key_size, &count, sizeof(count)) != 0) {
+        return -1;
+    }
+    
+    for (int i = 0; i < actual_param_count && i < state->param_count; i++) {
+        int32_t type = (int32_t)state->param_types[i];
+        const void* value = state->param_values[i];
+        unsigned char present = value != NULL ? 1 : 0;
+        if (append_memo_key_bytes(&key_size, &type, sizeof(type)) != 0 ||
+            append_memo_key_bytes(&key_size, &present, sizeof(present)) != 0) {
+            return -1;
+        }
+        if (value == NULL) {
+            continue;
+        }
+        
+        int result = 0;
+        switch (state->param_types[i]) {
+            case NXLD_PARAM_TYPE_INT32:
+                result = append_memo_key_bytes(&key_size, value, sizeof(int32_t));
+                break;
+            case NXLD_PARAM_TYPE_INT64:
+                result = append_memo_key_bytes(&key_size, value, sizeof(int64_t));
+                break;
+            case NXLD_PARAM_TYPE_FLOAT:
+                result = append_memo_key_bytes(&key_size, value, sizeof(float));
+                break;
+            case NXLD_PARAM_TYPE_DOUBLE:
+                result = append_memo_key_bytes(&key_size, value, sizeof(double));
+                break;
+            case NXLD_PARAM_TYPE_CHAR:
+                result = append_memo_key_bytes(&key_size, value, sizeof(char));
+                break;
+            case NXLD_PARAM_TYPE_STRING: {
+                size_t length = strlen((const char*)value);
+                result = append_memo_key_bytes(&key_size, &length, sizeof(length));
+                if (result == 0) {
+                    result = append_memo_key_bytes(&key_size, value, length);
+                }
+                break;
+            }
+            case NXLD_PARAM_TYPE_POINTER:
+            case NXLD_PARAM_TYPE_VARIADIC:
+            case NXLD_PARAM_TYPE_ANY:
+            case NXLD_PARAM_TYPE_UNKNOWN: {
+                uintptr_t address = (uintptr_t)value;
+                result = append_memo_key_bytes(&key_size, &address, sizeof(address));
+                break;
+            }
+            default: {
+                size_t size = state->param_sizes != NULL ? state->param_sizes[i] : 0;
+                result = append_memo_key_bytes(&key_size, &size, sizeof(size));
+                if (result == 0) {
+                    result = append_memo_key_bytes(&key_size, value, size);
+                }
+                break;
+            }
+        }
+        if (result != 0) {
+            return -1;
+        }
+    }
+    
+    *key_size_out = key_size;
+    return 0;
+}
+
+/**
+ * @brief 计算键哈希（FNV-1a） / Calculate key hash (FNV-1a) / Schlüssel-Hash berechnen (FNV-1a)
+ */
+static uint64_t hash_memo_key(const unsigned char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL; /* FNV偏移基数 / FNV offset basis / FNV-Offset-Basis */
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint64_t)data[i];
+        hash *= 1099511628211ULL; /* FNV质数 / FNV prime / FNV-Primzahl */
+    }
+    return hash;
+}
+
+/**
+ * @brief 检查帧的返回值能否记忆化 / Check if frame return value can be memoized / Prüfen, ob Rückgabewert des Rahmens memoisiert werden kann
+ * @details 指针返回值只在接口声明了大小或字符串返回类型时按内容缓存，其余指针的指向长度未知，不缓存 / Pointer returns are cached by content only when the interface declares a size or a string return type; other pointers point to data of unknown length and are not cached / Zeiger-Rückgaben werden nur nach Inhalt gecacht, wenn die Schnittstelle eine Größe oder einen Zeichenfolgen-Rückgabetyp deklariert; andere Zeiger verweisen auf Daten unbekannter Länge und werden nicht gecacht
+ */
+static int is_memoizable_return(const pt_call_frame_t* frame) {
+    switch (frame->return_type) {
+        case PT_RETURN_TYPE_INTEGER:
+        case PT_RETURN_TYPE_FLOAT:
+        case PT_RETURN_TYPE_DOUBLE:
+            return 1;
+        case PT_RETURN_TYPE_STRUCT_VAL:
+            return frame->struct_buffer != NULL && frame->return_size > 0;
+        case PT_RETURN_TYPE_STRUCT_PTR:
+            return frame->return_size > 0 || (frame->state != NULL && frame->state->return_is_string);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief 获取可记忆化调用的键 / Get key of memoizable call / Schlüssel eines memoisierbaren Aufrufs abrufen
+ * @return 成功返回0，不可记忆化或失败返回-1 / Returns 0 on success, -1 if not memoizable or on failure / Gibt 0 bei Erfolg zurück, -1 wenn nicht memoisierbar oder bei Fehler
+ */
+static int get_memo_call_key(const pointer_transfer_rule_t* rule, const pt_call_frame_t* frame,
+                             size_t* node_id_out, size_t* key_size_out, uint64_t* hash_key_out) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->memo_cache.shards == NULL || frame->state == NULL ||
+        frame->state->param_types == NULL || frame->state->param_values == NULL) {
+        return -1;
+    }
+    
+    size_t node_id = get_rule_target_graph_node(rule);
+    if (!is_rule_graph_node_memoizable(node_id) || !is_memoizable_return(frame)) {
+        return -1;
+    }
+    
+    size_t key_size = 0;
+    if (build_memo_key(frame->state, frame->actual_param_count, node_id, &key_size) != 0) {
+        return -1;
+    }
+    
+    *node_id_out = node_id;
+    *key_size_out = key_size;
+    *hash_key_out = hash_memo_key(g_memo_key_buffer, key_size);
+    return 0;
+}
+
+/**
+ * @brief 查找纯接口调用的记忆化结果 / Look up memoized result of pure interface call / Memoisiertes Ergebnis eines reinen Schnittstellenaufrufs suchen
+ * @details 命中时填充帧结果；未命中时标记帧待存储 / Fills frame result on hit; marks frame for store on miss / Füllt Rahmenergebnis bei Treffer; markiert Rahmen bei Fehltreffer zum Speichern
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param frame 已准备的调用帧 / Prepared call frame / Vorbereiteter Aufrufrahmen
+ * @return 命中返回0，否则返回-1 / Returns 0 on hit, -1 otherwise / Gibt 0 bei Treffer zurück, sonst -1
+ */
+int lookup_memoized_result(const pointer_transfer_rule_t* rule, pt_call_frame_t* frame) {
+    if (rule == NULL || frame == NULL) {
+        return -1;
+    }
+    
+    frame->memo_pending = 0;
+    size_t node_id = RULE_GRAPH_INVALID_NODE;
+    size_t key_size = 0;
+    uint64_t hash_key = 0;
+    if (get_memo_call_key(rule, frame, &node_id, &key_size, &hash_key) != 0) {
+        return -1;
+    }
+    
+    pt_return_type_t return_type = PT_RETURN_TYPE_INTEGER;
+    int64_t result_int = 0;
+    double result_float = 0.0;
+    void* value = NULL;
+    size_t value_size = 0;
+    if (memo_cache_lookup(hash_key, node_id, g_memo_key_buffer, key_size,
+                          &return_type, &result_int, &result_float, &value, &value_size) != 0) {
+        frame->memo_pending = 1;
+        return -1;
+    }
+    
+    /* 返回值配置变化时视为未命中 / Treat as miss when return configuration changed / Bei geänderter Rückgabekonfiguration als Fehltreffer behandeln */
+    if (return_type != frame->return_type ||
+        (return_type == PT_RETURN_TYPE_STRUCT_VAL && (value == NULL || value_size != frame->return_size)) ||
+        (return_type == PT_RETURN_TYPE_STRUCT_PTR && frame->return_size > 0 && value != NULL && value_size != frame->return_size)) {
+        if (value != NULL) {
+            free(value);
+        }
+        frame->memo_pending = 1;
+        return -1;
+    }
+    
+    if (return_type == PT_RETURN_TYPE_STRUCT_VAL) {
+        memcpy(frame->struct_buffer, value, value_size);
+        free(value);
+    } else if (return_type == PT_RETURN_TYPE_STRUCT_PTR) {
+        /* 结构体或字符串副本归帧所有，帧退出前对子调用有效 / Struct or string copy is owned by the frame and valid for child calls until frame exit / Struktur- oder Zeichenfolgenkopie gehört dem Rahmen und ist für Kindaufrufe bis zum Rahmenaustritt gültig */
+        frame->memo_buffer = value;
+        result_int = (int64_t)(intptr_t)value;
+    } else if (value != NULL) {
+        free(value);
+    }
+    
+    frame->result_int = result_int;
+    frame->result_float = result_float;
+    internal_log_write("INFO", "Memoized result hit for %s.%s (param_count=%d)",
+                      rule->target_plugin, rule->target_interface, frame->actual_param_count);
+    return 0;
+}
+
+/**
+ * @brief 存储纯接口调用的结果 / Store result of pure interface call / Ergebnis eines reinen Schnittstellenaufrufs speichern
+ * @details 插件可能重入引擎并覆盖键缓冲区，因此重新构建键 / The plugin may re-enter the engine and overwrite the key buffer, so the key is rebuilt / Das Plugin kann die Engine erneut betreten und den Schlüsselpuffer überschreiben, daher wird der Schlüssel neu aufgebaut
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param frame 已执行的调用帧 / Executed call frame / Ausgeführter Aufrufrahmen
+ */
+void store_memoized_result(const pointer_transfer_rule_t* rule, pt_call_frame_t* frame) {
+    if (rule == NULL || frame == NULL || !frame->memo_pending) {
+        return;
+    }
+    
+    frame->memo_pending = 0;
+    size_t node_id = RULE_GRAPH_INVALID_NODE;
+    size_t key_size = 0;
+    uint64_t hash_key = 0;
+    if (get_memo_call_key(rule, frame, &node_id, &key_size, &hash_key) != 0) {
+        return;
+    }
+    
+    const void* value_data = NULL;
+    size_t value_size = 0;
+    if (frame->return_type == PT_RETURN_TYPE_STRUCT_VAL) {
+        value_data = frame->struct_buffer;
+        value_size = frame->return_size;
+    } else if (frame->return_type == PT_RETURN_TYPE_STRUCT_PTR && frame->result_int != 0) {
+        /* 插件常返回静态缓冲区，缓存内容而非地址；长度取声明的大小，字符串取strlen / Plugins often return static buffers, cache contents instead of address; length is the declared size, or strlen for strings / Plugins geben oft statische Puffer zurück, Inhalt statt Adresse cachen; Länge ist die deklarierte Größe, bei Zeichenfolgen strlen */
+        value_data = (const void*)(intptr_t)frame->result_int;
+        value_size = frame->return_size > 0 ? frame->return_size : strlen((const char*)value_data) + 1;
+    }
+    
+    if (memo_cache_store(hash_key, node_id, g_memo_key_buffer, key_size, frame->return_type,
+                         frame->result_int, frame->result_float, value_data, value_size) != 0) {
+        internal_log_write("WARNING", "Failed to memoize result of %s.%s", rule->target_plugin, rule->target_interface);
+    }
+}
+
+/**
+ * @brief 释放当前线程的记忆化键缓冲区 / Free memoization key buffer of current thread / Memoisierungs-Schlüsselpuffer des aktuellen Threads freigeben
+ */
+void free_memo_key_buffer(void) {
+    if (g_memo_key_buffer != NULL) {
+        free(g_memo_key_buffer);
+        g_memo_key_buffer = NULL;
+    }
+    g_memo_key_capacity = 0;
+}
@@ -21,12 +21,12 @@
  * @brief 验证和设置参数值 / Validate and set parameter value / Parameterwert validieren und setzen
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int validate_and_set_parameter(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr) {
+int validate_and_set_parameter(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value) {
     if (rule == NULL || state == NULL) {
         return -1;
     }
     
-    if (validate_parameter_pointer(rule, state, ptr) != 0) {
+    if (validate_parameter_pointer(rule, state, value) != 0) {
         return -1;
     }
     
@@ -40,11 +40,11 @@ int validate_and_set_parameter(const pointer_transfer_rule_t* rule, target_inter
     
     if (state->param_count > 0 && rule->target_param_index < state->param_count) {
         if (rule->target_param_value != NULL && strlen(rule->target_param_value) > 0) {
-            if (set_parameter_from_const_string(rule, state, ptr) != 0) {
+            if (set_parameter_from_const_string(rule, state, value) != 0) {
                 return -1;
             }
         } else {
-            if (set_parameter_from_pointer(rule, state, ptr) != 0) {
+            if (set_parameter_from_value(rule, state, value) != 0) {
                 return -1;
             }
         }
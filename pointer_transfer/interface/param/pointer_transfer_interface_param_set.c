@@ -8,14 +8,26 @@
 #include "pointer_transfer_utils.h"
 #include <string.h>
 
+/**
+ * @brief 记录参数是否借用调用方的数据 / Record whether a parameter borrows the caller's data / Festhalten, ob ein Parameter die Daten des Aufrufers ausleiht
+ * @param state 接口状态 / Interface state / Schnittstellenstatus
+ * @param param_index 参数索引 / Parameter index / Parameterindex
+ * @param borrowed 借用标志 / Borrow flag / Ausleih-Flag
+ */
+static void mark_parameter_ownership(target_interface_state_t* state, int param_index, int borrowed) {
+    if (state->param_borrowed != NULL && param_index >= 0 && param_index < state->param_count) {
+        state->param_borrowed[param_index] = borrowed;
+    }
+}
+
 /**
  * @brief 设置参数值（从常量字符串） / Set parameter value from constant string / Parameterwert aus Konstantenstring setzen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
  * @param state 接口状态 / Interface state / Schnittstellenstatus
- * @param ptr 指针值（用于回退） / Pointer value (for fallback) / Zeigerwert (für Fallback)
+ * @param value 传递的值（用于回退） / Transferred value (for fallback) / Übertragener Wert (für Fallback)
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int set_parameter_from_const_string(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr) {
+int set_parameter_from_const_string(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value) {
     if (rule == NULL || state == NULL) {
         return -1;
     }
@@ -26,35 +38,30 @@ int set_parameter_from_const_string(const pointer_transfer_rule_t* rule, target_
     
     if (!set_parameter_value_from_const_string((struct target_interface_state_s*)state, rule->target_param_index, 
                                                 rule->target_param_value, rule->target_plugin, rule->target_interface)) {
-        internal_log_write("WARNING", "Failed to parse constant value for parameter %d of %s.%s, falling back to pointer", 
+        internal_log_write("WARNING", "Failed to parse constant value for parameter %d of %s.%s, falling back to transferred value", 
                     rule->target_param_index, rule->target_plugin, rule->target_interface);
-        /* 回退到指针设置，确保所有字段一致 / Fallback to pointer setting, ensure all fields are consistent / Fallback auf Zeigereinstellung, sicherstellen, dass alle Felder konsistent sind */
-        pointer_transfer_context_t* ctx = get_global_context();
-        state->param_values[rule->target_param_index] = ptr;
-        state->param_ready[rule->target_param_index] = 1;
-        if (state->param_sizes != NULL) {
-            state->param_sizes[rule->target_param_index] = ctx->stored_size > 0 ? ctx->stored_size : sizeof(void*);
-        }
+        return set_parameter_from_value(rule, state, value);
     }
+    mark_parameter_ownership(state, rule->target_param_index, 0);
     
     return 0;
 }
 
 /**
- * @brief 设置参数值（从指针） / Set parameter value from pointer / Parameterwert aus Zeiger setzen
+ * @brief 设置参数值（从传递的值） / Set parameter value from transferred value / Parameterwert aus übertragenem Wert setzen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
  * @param state 接口状态 / Interface state / Schnittstellenstatus
- * @param ptr 指针值 / Pointer value / Zeigerwert
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int set_parameter_from_pointer(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr) {
+int set_parameter_from_value(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value) {
     if (rule == NULL || state == NULL) {
         return -1;
     }
     
-    pointer_transfer_context_t* ctx = get_global_context();
-    set_parameter_value_from_pointer((struct target_interface_state_s*)state, rule->target_param_index, 
-                                    ptr, ctx->stored_size, rule->target_plugin, rule->target_interface);
+    set_parameter_value_from_typed((struct target_interface_state_s*)state, rule->target_param_index, 
+                                   value, rule->target_plugin, rule->target_interface);
+    mark_parameter_ownership(state, rule->target_param_index, rule->ownership == PARAM_OWNERSHIP_BORROW);
     
     return 0;
 }
@@ -33,16 +33,16 @@ int validate_parameter_index(const pointer_transfer_rule_t* rule, target_interfa
  * @brief 验证参数指针 / Validate parameter pointer / Parameterzeiger validieren
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
  * @param state 接口状态 / Interface state / Schnittstellenstatus
- * @param ptr 指针值 / Pointer value / Zeigerwert
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int validate_parameter_pointer(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr) {
+int validate_parameter_pointer(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value) {
     if (rule == NULL || state == NULL) {
         return -1;
     }
     
     if (state->param_count > 0) {
-        if (ptr == NULL && (rule->target_param_value == NULL || strlen(rule->target_param_value) == 0)) {
+        if ((value == NULL || (!is_immediate_value(value) && value->as.ptr == NULL)) && (rule->target_param_value == NULL || strlen(rule->target_param_value) == 0)) {
             internal_log_write("ERROR", "Invalid NULL pointer for interface %s.%s with %d parameters", 
                           rule->target_plugin, rule->target_interface, state->param_count);
             return -1;
@@ -19,7 +19,7 @@
  * @param struct_buffer_out 输出结构体缓冲区 / Output struct buffer / Ausgabe-Strukturpuffer
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int prepare_interface_call(const pointer_transfer_rule_t* rule, void* ptr,
+int prepare_interface_call(const pointer_transfer_rule_t* rule, const pt_typed_value_t* value,
                            target_interface_state_t** state_out, int* actual_param_count_out,
                            pt_return_type_t* return_type_out, size_t* return_size_out, void** struct_buffer_out) {
     if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL ||
@@ -28,19 +28,12 @@ int prepare_interface_call(const pointer_transfer_rule_t* rule, void* ptr,
         return -1;
     }
     
-    void* handle = NULL;
-    void* func_ptr = NULL;
-    if (load_plugin_and_get_function(rule, &handle, &func_ptr) != 0) {
-        return -1;
-    }
-    
-    target_interface_state_t* state = find_or_create_interface_state(rule->target_plugin, rule->target_interface, handle, func_ptr);
+    target_interface_state_t* state = get_target_interface_state(rule);
     if (state == NULL) {
-        internal_log_write("ERROR", "Failed to create interface state for %s.%s", rule->target_plugin, rule->target_interface);
         return -1;
     }
     
-    if (validate_and_set_parameter(rule, state, ptr) != 0) {
+    if (validate_and_set_parameter(rule, state, value) != 0) {
         return -1;
     }
     
@@ -11,60 +11,55 @@
 #include <string.h>
 
 /**
- * @brief 处理返回值传递规则 / Process return value transfer rules / Rückgabewert-Übertragungsregeln verarbeiten
+ * @brief 分派下一条返回值传递规则 / Dispatch next return value transfer rule / Nächste Rückgabewert-Übertragungsregel verteilen
  * @param ctx 上下文 / Context / Kontext
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param return_type 返回值类型 / Return type / Rückgabetyp
- * @param return_size 返回值大小 / Return size / Rückgabegröße
- * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
- * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
- * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
  */
-int process_return_value_transfer_rules(pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* rule,
-                                         pt_return_type_t return_type, size_t return_size,
-                                         int64_t result_int, double result_float, void* struct_buffer,
-                                         const char* call_chain[], size_t call_chain_size, int recursion_depth) {
-    if (ctx == NULL || ctx->rules == NULL || rule == NULL) {
-        return -1;
+pt_frame_action_t step_return_value_rules(pointer_transfer_context_t* ctx, pt_call_frame_t* frame, pt_call_frame_t** child_out) {
+    if (ctx == NULL || ctx->rules == NULL || frame == NULL || child_out == NULL) {
+        if (frame != NULL) {
+            frame->stage = PT_FRAME_STAGE_EXIT;
+        }
+        return PT_FRAME_ACTION_CONTINUE;
     }
     
-    size_t matched_rules[256];
-    size_t matched_count = collect_matching_return_value_rules(ctx, rule->target_plugin, rule->target_interface,
-                                                                matched_rules, sizeof(matched_rules) / sizeof(matched_rules[0]));
+    while (frame->match_idx < frame->matched_count && frame->processed[frame->match_idx]) {
+        frame->match_idx++;
+    }
     
-    if (matched_count == 0) {
-        return 0;
+    if (frame->match_idx >= frame->matched_count) {
+        frame->stage = PT_FRAME_STAGE_PARAM_RULES;
+        frame->param_rule_idx = 0;
+        return PT_FRAME_ACTION_CONTINUE;
     }
     
-    int processed[256] = {0};
+    size_t i = frame->matched_rules[frame->match_idx];
+    pointer_transfer_rule_t* active_rule = &ctx->rules[i];
+    frame->active_rule_idx = i;
     
-    for (size_t match_idx = 0; match_idx < matched_count; match_idx++) {
-        if (processed[match_idx]) {
-            continue;
-        }
-        
-        size_t i = matched_rules[match_idx];
-        pointer_transfer_rule_t* active_rule = &ctx->rules[i];
-        
-        if (active_rule->set_group != NULL && strlen(active_rule->set_group) > 0 &&
-            active_rule->target_plugin != NULL && active_rule->target_interface != NULL) {
-            process_setgroup_rule_group(ctx, active_rule, matched_rules, matched_count, processed, rule,
-                                        return_type, return_size, result_int, result_float, struct_buffer,
-                                        call_chain, call_chain_size, recursion_depth);
-        } else {
-            if (process_non_setgroup_rule(active_rule, rule, return_type, return_size,
-                                          result_int, result_float, struct_buffer,
-                                          call_chain, call_chain_size, recursion_depth, i) == 1) {
-                break;
-            }
-        }
+    if (active_rule->set_group != NULL && strlen(active_rule->set_group) > 0 &&
+        active_rule->target_plugin != NULL && active_rule->target_interface != NULL) {
+        frame->group_count = collect_setgroup_rules(ctx, frame->matched_rules, frame->matched_count, frame->processed,
+                                                    active_rule, frame->group_rules, PT_FRAME_MAX_GROUP_RULES);
+        sort_setgroup_rules_by_param_index(ctx, frame->group_rules, frame->group_count);
+        frame->group_idx = 0;
+        frame->stage = PT_FRAME_STAGE_SETGROUP;
+        return PT_FRAME_ACTION_CONTINUE;
+    }
+    
+    frame->stage = PT_FRAME_STAGE_RETURN_RULE_RESUME;
+    pt_call_frame_t* child = acquire_call_frame();
+    if (child == NULL) {
+        frame->child_result = -1;
+        return PT_FRAME_ACTION_CONTINUE;
     }
     
-    return 0;
+    init_call_frame(child, active_rule, NULL, frame);
+    prepare_non_setgroup_rule_call(active_rule, i, frame, child);
+    *child_out = child;
+    return PT_FRAME_ACTION_PUSH;
 }
 
 /**
@@ -63,6 +63,22 @@ int prepare_return_type_and_buffer(target_interface_state_t* state, pt_return_ty
     return 0;
 }
 
+/**
+ * @brief 按接口的调用约定调用接口函数 / Call the interface function with its calling convention / Schnittstellenfunktion mit ihrer Aufrufkonvention aufrufen
+ * @return 成功返回0，错误返回非0 / Returns 0 on success, non-zero on error / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int32_t call_interface_function(const target_interface_state_t* state, int actual_param_count,
+                                pt_return_type_t return_type, size_t return_size,
+                                int64_t* result_int, double* result_float, void* struct_buffer) {
+    if (state->call_convention == NXLD_CALL_CONVENTION_NATIVE) {
+        return pt_platform_native_call(state->func_ptr, &state->native_plan, state->param_types,
+                                       state->param_values, result_int, result_float);
+    }
+    return pt_platform_safe_call(state->func_ptr, actual_param_count, (void*)state->param_types, state->param_values,
+                                 (void*)state->param_sizes, state->param_borrowed, state->pack_version, return_type, return_size,
+                                 result_int, result_float, struct_buffer);
+}
+
 /**
  * @brief 调用函数并获取返回值 / Call function and get return value / Funktion aufrufen und Rückgabewert abrufen
  * @param state 接口状态 / Interface state / Schnittstellenstatus
@@ -89,10 +105,8 @@ int call_function_and_get_result(target_interface_state_t* state, int actual_par
     state->in_use = 1;
     int64_t result_int = 0;
     double result_float = 0.0;
-    int32_t call_result = pt_platform_safe_call(state->func_ptr, actual_param_count, 
-                                                  (void*)state->param_types, state->param_values,
-                                                  (void*)state->param_sizes,
-                                                  return_type, return_size, &result_int, &result_float, struct_buffer);
+    int32_t call_result = call_interface_function(state, actual_param_count, return_type, return_size,
+                                                  &result_int, &result_float, struct_buffer);
     if (call_result != 0) {
         state->in_use = 0;
         internal_log_write("ERROR", "Call to interface failed (error=%d)", call_result);
@@ -130,34 +144,28 @@ void log_return_value(const char* plugin_name, const char* interface_name, pt_re
 }
 
 /**
- * @brief 根据返回值类型选择传递参数 / Select transfer parameter by return type / Übertragungsparameter nach Rückgabetyp auswählen
+ * @brief 将返回值构造为带类型的值 / Build typed value from return value / Typisierten Wert aus Rückgabewert erzeugen
  * @param return_type 返回值类型 / Return type / Rückgabetyp
  * @param return_size 返回值大小 / Return size / Rückgabegröße
  * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
  * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
  * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param ctx 上下文 / Context / Kontext
- * @return 传递参数指针 / Transfer parameter pointer / Übertragungsparameter-Zeiger
+ * @return 传递值 / Transfer value / Übertragungswert
  */
-void* select_transfer_parameter_by_return_type(pt_return_type_t return_type, size_t return_size,
-                                                int64_t result_int, double result_float, void* struct_buffer,
-                                                pointer_transfer_context_t* ctx) {
+pt_typed_value_t make_return_value(pt_return_type_t return_type, size_t return_size,
+                                   int64_t result_int, double result_float, void* struct_buffer) {
     if (return_type == PT_RETURN_TYPE_FLOAT || return_type == PT_RETURN_TYPE_DOUBLE) {
         internal_log_write("INFO", "Using float return value %lf for transfer", result_float);
-        return &result_float;
+        return make_double_value(result_float);
     } else if (return_type == PT_RETURN_TYPE_STRUCT_VAL && struct_buffer != NULL) {
         internal_log_write("INFO", "Using struct return value (size=%zu) for transfer", return_size);
-        return struct_buffer;
+        return make_pointer_value(struct_buffer, NXLD_PARAM_TYPE_POINTER, return_size);
     } else if (return_type == PT_RETURN_TYPE_STRUCT_PTR) {
-        ctx->stored_size = sizeof(void*);
-        ctx->stored_type = NXLD_PARAM_TYPE_STRING;
         internal_log_write("INFO", "Using pointer return value %p for transfer", (void*)(intptr_t)result_int);
-        return (void*)(intptr_t)result_int;
+        return make_pointer_value((void*)(intptr_t)result_int, NXLD_PARAM_TYPE_STRING, sizeof(void*));
     } else {
-        ctx->stored_size = sizeof(int64_t);
-        ctx->stored_type = NXLD_PARAM_TYPE_INT64;
         internal_log_write("INFO", "Using integer/pointer return value %lld for transfer", (long long)result_int);
-        return &result_int;
+        return make_int64_value(result_int);
     }
 }
 
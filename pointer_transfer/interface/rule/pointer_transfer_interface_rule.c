@@ -80,23 +80,29 @@ int check_exact_duplicate_target(const pointer_transfer_context_t* ctx, const po
 }
 
 /**
- * @brief 处理参数值传递规则 / Process parameter value transfer rules / Parameterwert-Übertragungsregeln verarbeiten
+ * @brief 分派下一条参数值传递规则 / Dispatch next parameter value transfer rule / Nächste Parameterwert-Übertragungsregel verteilen
  * @param ctx 上下文 / Context / Kontext
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param state 接口状态 / Interface state / Schnittstellenstatus
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
  */
-int process_parameter_value_transfer_rules(pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* rule,
-                                            target_interface_state_t* state) {
-    if (ctx == NULL || ctx->rules == NULL || rule == NULL || state == NULL) {
-        return -1;
+pt_frame_action_t step_parameter_value_rules(pointer_transfer_context_t* ctx, pt_call_frame_t* frame, pt_call_frame_t** child_out) {
+    if (frame == NULL) {
+        return PT_FRAME_ACTION_POP;
+    }
+    
+    const pointer_transfer_rule_t* rule = get_call_frame_rule(frame);
+    target_interface_state_t* state = frame->state;
+    frame->stage = PT_FRAME_STAGE_EXIT;
+    if (ctx == NULL || ctx->rules == NULL || rule == NULL || state == NULL || child_out == NULL) {
+        return PT_FRAME_ACTION_CONTINUE;
     }
     
     if (rule->target_plugin == NULL || rule->target_interface == NULL) {
-        return -1;
+        return PT_FRAME_ACTION_CONTINUE;
     }
     
-    for (size_t i = 0; i < ctx->rule_count; i++) {
+    for (size_t i = frame->param_rule_idx; i < ctx->rule_count; i++) {
         pointer_transfer_rule_t* param_rule = &ctx->rules[i];
         if (!param_rule->enabled || param_rule->source_plugin == NULL || param_rule->source_interface == NULL) {
             continue;
@@ -110,22 +116,51 @@ int process_parameter_value_transfer_rules(pointer_transfer_context_t* ctx, cons
             state->param_ready[param_rule->source_param_index] &&
             state->param_values[param_rule->source_param_index] != NULL) {
             
-            void* param_value = state->param_values[param_rule->source_param_index];
+            pt_typed_value_t param_value = get_parameter_typed_value((struct target_interface_state_s*)state, param_rule->source_param_index);
             internal_log_write("INFO", "Triggering rule %zu: %s.%s[%d] -> %s.%s[%d] (getting parameter value)", 
                           i, param_rule->source_plugin, param_rule->source_interface, param_rule->source_param_index,
                           param_rule->target_plugin != NULL ? param_rule->target_plugin : "unknown",
                           param_rule->target_interface != NULL ? param_rule->target_interface : "unknown",
                           param_rule->target_param_index);
             
-            int call_result = call_target_plugin_interface(param_rule, param_value);
-            if (call_result == 0) {
-                internal_log_write("INFO", "Successfully triggered rule %zu for parameter %d", i, param_rule->source_param_index);
-            } else {
-                internal_log_write("WARNING", "Failed to trigger rule %zu for parameter %d (error=%d)", i, param_rule->source_param_index, call_result);
+            frame->param_rule_idx = i;
+            frame->stage = PT_FRAME_STAGE_PARAM_RULE_RESUME;
+            pt_call_frame_t* child = acquire_call_frame();
+            if (child == NULL) {
+                frame->child_result = -1;
+                return PT_FRAME_ACTION_CONTINUE;
             }
+            
+            init_call_frame(child, param_rule, &param_value, frame);
+            *child_out = child;
+            return PT_FRAME_ACTION_PUSH;
         }
     }
     
-    return 0;
+    return PT_FRAME_ACTION_CONTINUE;
 }
 
+/**
+ * @brief 参数值规则子调用完成后继续 / Resume after parameter value rule child call / Nach Parameterwert-Regel-Kindaufruf fortsetzen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t resume_parameter_value_rule(pointer_transfer_context_t* ctx, pt_call_frame_t* frame) {
+    if (frame == NULL) {
+        return PT_FRAME_ACTION_POP;
+    }
+    
+    frame->stage = PT_FRAME_STAGE_PARAM_RULES;
+    if (ctx != NULL && ctx->rules != NULL && frame->param_rule_idx < ctx->rule_count) {
+        const pointer_transfer_rule_t* param_rule = &ctx->rules[frame->param_rule_idx];
+        if (frame->child_result == 0) {
+            internal_log_write("INFO", "Successfully triggered rule %zu for parameter %d", frame->param_rule_idx, param_rule->source_param_index);
+        } else {
+            internal_log_write("WARNING", "Failed to trigger rule %zu for parameter %d (error=%d)", frame->param_rule_idx, param_rule->source_param_index, frame->child_result);
+        }
+    }
+    
+    frame->param_rule_idx++;
+    return PT_FRAME_ACTION_CONTINUE;
+}
@@ -7,6 +7,7 @@
 #include "pointer_transfer_context.h"
 #include "pointer_transfer_types.h"
 #include "pointer_transfer_platform.h"
+#include "pointer_transfer_plugin_loader.h"
 #include "pointer_transfer_utils.h"
 #include <stdlib.h>
 #include <string.h>
@@ -77,6 +78,28 @@ void sort_setgroup_rules_by_param_index(pointer_transfer_context_t* ctx, size_t*
     }
 }
 
+/**
+ * @brief 为已卸载插件的接口状态重新加载插件 / Reload plugin for interface state of an unloaded plugin / Plugin für Schnittstellenstatus eines entladenen Plugins neu laden
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int reattach_interface_state(target_interface_state_t* state) {
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(state->plugin_name);
+    if (entry == NULL || entry->plugin_path == NULL) {
+        return -1;
+    }
+    
+    void* handle = load_target_plugin(state->plugin_name, entry->plugin_path);
+    void* func_ptr = handle != NULL ? resolve_plugin_registry_symbol(entry, state->interface_name) : NULL;
+    if (func_ptr == NULL) {
+        return -1;
+    }
+    
+    state->handle = handle;
+    state->func_ptr = func_ptr;
+    state->validation_done = 0;
+    return 0;
+}
+
 /**
  * @brief 重新调用源接口获取新的返回值 / Re-call source interface to get new return value / Quellschnittstelle neu aufrufen, um neuen Rückgabewert zu erhalten
  * @param group_rule SetGroup规则 / SetGroup rule / SetGroup-Regel
@@ -101,7 +124,10 @@ int recall_source_interface_for_setgroup(const pointer_transfer_rule_t* group_ru
     }
     
     target_interface_state_t* source_state = find_interface_state(group_rule->source_plugin, group_rule->source_interface);
-    if (source_state == NULL || source_state->func_ptr == NULL) {
+    if (source_state == NULL) {
+        return -1;
+    }
+    if (source_state->func_ptr == NULL && reattach_interface_state(source_state) != 0) {
         return -1;
     }
     
@@ -145,10 +171,11 @@ int recall_source_interface_for_setgroup(const pointer_transfer_rule_t* group_ru
     if (source_state->param_types != NULL && source_state->param_values != NULL) {
         int64_t temp_result_int = 0;
         double temp_result_float = 0.0;
-        int32_t source_call_result = pt_platform_safe_call(source_state->func_ptr, source_actual_param_count,
-                                                          (void*)source_state->param_types, source_state->param_values,
-                                                          (void*)source_state->param_sizes,
-                                                          source_return_type, source_return_size, &temp_result_int, &temp_result_float, group_struct_buffer);
+        plugin_registry_entry_t* source_entry = pin_plugin_registry_entry(group_rule->source_plugin);
+        int32_t source_call_result = call_interface_function(source_state, source_actual_param_count,
+                                                             source_return_type, source_return_size,
+                                                             &temp_result_int, &temp_result_float, group_struct_buffer);
+        unpin_plugin_registry_entry(source_entry);
         if (source_call_result == 0) {
             *result_int_out = temp_result_int;
             *result_float_out = temp_result_float;
@@ -6,6 +6,8 @@
  * - pointer_transfer_interface_state_find.c: 接口状态查找
  * - pointer_transfer_interface_state_info.c: 接口信息获取
  * - pointer_transfer_interface_state_create.c: 接口状态创建
+ * - pointer_transfer_interface_state_descriptor.c: 插件描述符读取
+ * 解析出的元数据缓存在验证数据库中（pointer_transfer_currying_validate_cache.c）
  */
 
 #include "pointer_transfer_interface.h"
@@ -13,6 +15,7 @@
 #include "pointer_transfer_utils.h"
 #include "pointer_transfer_types.h"
 #include "pointer_transfer_platform.h"
+#include "pointer_transfer_currying.h"
 #include "nxld_plugin_interface.h"
 #include <stdlib.h>
 #include <string.h>
@@ -21,110 +24,216 @@
 #include <limits.h>
 
 /**
- * @brief 查找或创建目标接口状态 / Find or create target interface state / Ziel-Schnittstellenstatus suchen oder erstellen
+ * @brief 接口元数据（来自缓存、描述符或逐项查询） / Interface metadata (from the cache, the descriptor or per-item queries) / Schnittstellen-Metadaten (aus dem Cache, dem Deskriptor oder Einzelabfragen)
  */
-target_interface_state_t* find_or_create_interface_state(const char* plugin_name, const char* interface_name, void* handle, void* func_ptr) {
-    if (plugin_name == NULL || interface_name == NULL || handle == NULL || func_ptr == NULL) {
+typedef struct {
+    const nxld_interface_descriptor_t* descriptor; /**< 插件描述符项，未导出时为NULL / Plugin descriptor entry, NULL if not exported / Plugin-Deskriptoreintrag, NULL wenn nicht exportiert */
+    void* get_param_info;          /**< 参数信息函数（无描述符时） / Parameter info function (without descriptor) / Parameter-Info-Funktion (ohne Deskriptor) */
+    size_t interface_index;        /**< 接口索引（无描述符时） / Interface index (without descriptor) / Schnittstellenindex (ohne Deskriptor) */
+    pt_return_type_t return_type;  /**< 返回值类型 / Return type / Rückgabetyp */
+    size_t return_size;            /**< 返回值大小 / Return size / Rückgabegröße */
+    nxld_param_count_type_t param_count_type; /**< 参数数量类型 / Parameter count type / Parameteranzahl-Typ */
+    int32_t min_count;             /**< 最小参数数量 / Minimum parameter count / Mindestparameteranzahl */
+    int32_t max_count;             /**< 最大参数数量 / Maximum parameter count / Maximalparameteranzahl */
+    int from_cache;                /**< 来自元数据缓存 / Loaded from the metadata cache / Aus dem Metadaten-Cache geladen */
+    nxld_param_type_t* cached_param_types; /**< 缓存的参数类型（仅缓存命中时） / Cached parameter types (cache hits only) / Zwischengespeicherte Parametertypen (nur bei Cache-Treffern) */
+    int cached_param_type_count;   /**< 缓存的参数类型数量 / Cached parameter type count / Anzahl zwischengespeicherter Parametertypen */
+    nxld_call_convention_t call_convention; /**< 调用约定（无描述符时为参数包） / Calling convention (pack without descriptor) / Aufrufkonvention (Paket ohne Deskriptor) */
+    nxld_return_type_t native_return_type; /**< 描述符声明的返回值类型 / Return type declared by the descriptor / Vom Deskriptor deklarierter Rückgabetyp */
+} interface_metadata_t;
+
+/**
+ * @brief 取元数据缓存使用的插件文件路径 / Get the plugin file path used by the metadata cache / Vom Metadaten-Cache verwendeten Plugin-Dateipfad abrufen
+ * @return 插件路径，缓存禁用或路径未知时返回NULL / Plugin path, NULL if the cache is disabled or the path is unknown / Plugin-Pfad, NULL wenn der Cache deaktiviert oder der Pfad unbekannt ist
+ */
+static const char* get_metadata_cache_path(const char* plugin_name) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || ctx->disable_metadata_cache) {
         return NULL;
     }
     
-    /* 首先尝试查找已存在的接口状态 / First try to find existing interface state / Zuerst versuchen, vorhandenen Schnittstellenstatus zu finden */
-    target_interface_state_t* existing_state = find_interface_state(plugin_name, interface_name);
-    if (existing_state != NULL) {
-        return existing_state;
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+    return entry != NULL ? entry->plugin_path : NULL;
+}
+
+/**
+ * @brief 读取接口元数据 / Read interface metadata / Schnittstellen-Metadaten lesen
+ * @details 库文件未变时直接使用验证数据库中缓存的元数据，不调用插件；否则优先一次调用nxld_plugin_get_descriptor，未导出时逐项调用nxld_plugin_get_interface_*并从描述推断返回类型 / Uses the metadata cached in the validation database without calling the plugin while the library file is unchanged; otherwise prefers a single nxld_plugin_get_descriptor call, and without it queries nxld_plugin_get_interface_* one by one and infers the return type from the description / Verwendet bei unveränderter Bibliotheksdatei die in der Validierungsdatenbank zwischengespeicherten Metadaten ohne Plugin-Aufruf; sonst wird ein einziger nxld_plugin_get_descriptor-Aufruf bevorzugt, ohne ihn werden nxld_plugin_get_interface_* einzeln abgefragt und der Rückgabetyp aus der Beschreibung abgeleitet
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int load_interface_metadata(void* handle, void* func_ptr, const char* plugin_name, const char* interface_name,
+                                   interface_metadata_t* metadata) {
+    memset(metadata, 0, sizeof(interface_metadata_t));
+    const char* cache_path = get_metadata_cache_path(plugin_name);
+    pt_cached_metadata_t cached;
+    if (cache_path != NULL && pt_load_cached_metadata(cache_path, interface_name, &cached) == 0) {
+        metadata->from_cache = 1;
+        metadata->interface_index = cached.interface_index;
+        metadata->return_type = cached.return_type;
+        metadata->return_size = cached.return_size;
+        metadata->param_count_type = cached.param_count_type;
+        metadata->min_count = cached.min_count;
+        metadata->max_count = cached.max_count;
+        metadata->cached_param_types = cached.param_types;
+        metadata->cached_param_type_count = cached.param_type_count;
+        metadata->call_convention = cached.call_convention;
+        metadata->native_return_type = cached.native_return_type;
+        return 0;
     }
     
-    pointer_transfer_context_t* ctx = get_global_context();
+    metadata->descriptor = find_interface_descriptor(handle, interface_name, func_ptr, &metadata->call_convention);
+    if (metadata->descriptor != NULL) {
+        metadata->return_type = map_descriptor_return_type(metadata->descriptor, &metadata->return_size);
+        metadata->native_return_type = metadata->descriptor->return_type;
+        metadata->param_count_type = metadata->descriptor->param_count_type;
+        metadata->min_count = metadata->descriptor->min_param_count;
+        metadata->max_count = metadata->descriptor->max_param_count;
+        return 0;
+    }
     
     void* get_interface_count = NULL;
     void* get_interface_info = NULL;
     void* get_param_count = NULL;
-    void* get_param_info = NULL;
-    
     if (get_plugin_interface_functions(handle, &get_interface_count, &get_interface_info,
-                                       &get_param_count, &get_param_info) != 0) {
+                                       &get_param_count, &metadata->get_param_info) != 0) {
         internal_log_write("WARNING", "Failed to get plugin interface functions for %s", plugin_name);
-        return NULL;
+        return -1;
     }
     
-    size_t target_interface_index = SIZE_MAX;
-    pt_return_type_t inferred_return_type = PT_RETURN_TYPE_INTEGER;
     char* saved_desc_buf = NULL;
-    
-    if (find_interface_index(get_interface_count, get_interface_info, interface_name,
-                             &target_interface_index, &inferred_return_type, &saved_desc_buf) != 0) {
-        if (saved_desc_buf != NULL) {
-            free(saved_desc_buf);
-        }
+    metadata->interface_index = SIZE_MAX;
+    metadata->return_type = PT_RETURN_TYPE_INTEGER;
+    int find_result = find_interface_index(get_interface_count, get_interface_info, interface_name,
+                                           &metadata->interface_index, &metadata->return_type, &saved_desc_buf);
+    if (saved_desc_buf != NULL) {
+        free(saved_desc_buf);
+    }
+    if (find_result != 0) {
         internal_log_write("WARNING", "Interface %s not found in plugin %s", interface_name, plugin_name);
-        return NULL;
+        return -1;
     }
     
-    nxld_param_count_type_t param_count_type;
-    int32_t min_count = 0;
-    int32_t max_count = 0;
-    if (get_parameter_count_info(get_param_count, target_interface_index,
-                                  &param_count_type, &min_count, &max_count) != 0) {
-        if (saved_desc_buf != NULL) {
-            free(saved_desc_buf);
+    return get_parameter_count_info(get_param_count, metadata->interface_index,
+                                    &metadata->param_count_type, &metadata->min_count, &metadata->max_count);
+}
+
+/**
+ * @brief 按元数据来源初始化参数类型 / Initialize parameter types from the metadata source / Parametertypen aus der Metadatenquelle initialisieren
+ */
+static int initialize_metadata_parameter_types(target_interface_state_t* state, const interface_metadata_t* metadata, int param_count) {
+    if (metadata->from_cache) {
+        if (state->param_types != NULL && metadata->cached_param_types != NULL) {
+            int count = metadata->cached_param_type_count < param_count ? metadata->cached_param_type_count : param_count;
+            memcpy(state->param_types, metadata->cached_param_types, (size_t)count * sizeof(nxld_param_type_t));
         }
-        return NULL;
+        return 0;
+    }
+    if (metadata->descriptor != NULL) {
+        apply_descriptor_parameter_types(state, metadata->descriptor, param_count);
+        return 0;
+    }
+    return initialize_parameter_types(state, metadata->get_param_info, metadata->interface_index, param_count);
+}
+
+/**
+ * @brief 将从插件读取的元数据写入缓存 / Write metadata read from the plugin to the cache / Aus dem Plugin gelesene Metadaten in den Cache schreiben
+ */
+static void store_interface_metadata(const target_interface_state_t* state, const interface_metadata_t* metadata) {
+    if (metadata->from_cache) {
+        return;
+    }
+    const char* cache_path = get_metadata_cache_path(state->plugin_name);
+    if (cache_path == NULL) {
+        return;
+    }
+    
+    pt_cached_metadata_t cached;
+    cached.interface_index = metadata->interface_index;
+    cached.return_type = metadata->return_type;
+    cached.return_size = metadata->return_size;
+    cached.param_count_type = metadata->param_count_type;
+    cached.min_count = metadata->min_count;
+    cached.max_count = metadata->max_count;
+    cached.param_types = state->param_types;
+    cached.param_type_count = state->param_types != NULL ? state->param_count : 0;
+    cached.call_convention = metadata->call_convention;
+    cached.native_return_type = metadata->native_return_type;
+    if (pt_record_cached_metadata(cache_path, state->interface_name, &cached) != 0) {
+        internal_log_write("WARNING", "Failed to cache metadata of %s.%s", state->plugin_name, state->interface_name);
     }
+}
+
+/**
+ * @brief 应用元数据声明的调用约定 / Apply the calling convention declared by the metadata / Von den Metadaten deklarierte Aufrufkonvention anwenden
+ * @details 参数包约定的接口按插件导出的版本选择参数包布局 / Pack-convention interfaces pick the pack layout from the version the plugin exports / Schnittstellen mit Paketkonvention wählen das Paketlayout nach der vom Plugin exportierten Version
+ * @details 原生接口不能退回参数包调用，签名不受支持时保留无效计划，调用和验证都会失败 / Native interfaces cannot fall back to pack calls, so an unsupported signature keeps an invalid plan and both calls and validation fail / Native Schnittstellen können nicht auf Paketaufrufe ausweichen, daher bleibt bei nicht unterstützter Signatur ein ungültiger Plan und Aufrufe wie Validierung schlagen fehl
+ */
+static void apply_call_convention(target_interface_state_t* state, const interface_metadata_t* metadata) {
+    state->call_convention = metadata->call_convention;
+    memset(&state->native_plan, 0, sizeof(state->native_plan));
+    if (metadata->call_convention != NXLD_CALL_CONVENTION_NATIVE) {
+        state->pack_version = get_plugin_pack_version(state->handle);
+        return;
+    }
+    
+    if (state->is_variadic) {
+        internal_log_write("ERROR", "Interface %s.%s declares a native signature that cannot be called on this platform",
+                          state->plugin_name, state->interface_name);
+        return;
+    }
+    int32_t prepare_result = pt_platform_prepare_native_call(state->param_count, state->param_types,
+                                                             metadata->native_return_type, &state->native_plan);
+    if (prepare_result == PT_NATIVE_CALL_STACK_OVERFLOW) {
+        internal_log_write("ERROR", "Interface %s.%s passes more stack arguments than native calls support, refusing to call it",
+                          state->plugin_name, state->interface_name);
+    } else if (prepare_result != 0) {
+        internal_log_write("ERROR", "Interface %s.%s declares a native signature that cannot be called on this platform",
+                          state->plugin_name, state->interface_name);
+    }
+}
+
+/**
+ * @brief 按已读取的元数据创建接口状态 / Create interface state from loaded metadata / Schnittstellenstatus aus geladenen Metadaten erstellen
+ */
+static target_interface_state_t* create_interface_state(const char* plugin_name, const char* interface_name, void* handle, void* func_ptr,
+                                                        const interface_metadata_t* metadata) {
+    pointer_transfer_context_t* ctx = get_global_context();
     
     int is_variadic = 0;
-    int param_count = calculate_param_count(param_count_type, min_count, max_count, &is_variadic);
+    int param_count = calculate_param_count(metadata->param_count_type, metadata->min_count, metadata->max_count, &is_variadic);
     if (is_variadic) {
         internal_log_write("INFO", "Interface %s.%s has variadic parameters (min=%d, max=%d)", 
-                      plugin_name, interface_name, min_count, max_count);
+                      plugin_name, interface_name, metadata->min_count, metadata->max_count);
     }
     
     if (ctx->interface_state_count >= ctx->interface_state_capacity) {
         if (expand_interface_states_capacity() != 0) {
             internal_log_write("ERROR", "Failed to expand interface states capacity");
-            if (saved_desc_buf != NULL) {
-                free(saved_desc_buf);
-            }
             return NULL;
         }
     }
     
     if (ctx->interface_states == NULL) {
         internal_log_write("ERROR", "Interface states array is NULL after capacity expansion");
-        if (saved_desc_buf != NULL) {
-            free(saved_desc_buf);
-        }
         return NULL;
     }
     
     target_interface_state_t* state = &ctx->interface_states[ctx->interface_state_count];
-    int min_param_count = is_variadic ? (int)min_count : param_count;
+    int min_param_count = is_variadic ? (int)metadata->min_count : param_count;
     
     if (initialize_interface_state_basic(state, plugin_name, interface_name, handle, func_ptr,
-                                         param_count, is_variadic, min_param_count, inferred_return_type) != 0) {
-        if (saved_desc_buf != NULL) {
-            free(saved_desc_buf);
-        }
+                                         param_count, is_variadic, min_param_count, metadata->return_type) != 0) {
         return NULL;
     }
+    state->return_size = metadata->return_size;
+    state->return_is_string = metadata->native_return_type == NXLD_RETURN_TYPE_STRING;
     
     if (param_count > 0) {
-        if (allocate_parameter_arrays(state, param_count) != 0) {
-            if (state->plugin_name != NULL) free(state->plugin_name);
-            if (state->interface_name != NULL) free(state->interface_name);
-            free_parameter_arrays(state);
-            if (saved_desc_buf != NULL) {
-                free(saved_desc_buf);
-            }
-            return NULL;
-        }
-        
-        if (initialize_parameter_types(state, get_param_info, target_interface_index, param_count) != 0) {
+        if (allocate_parameter_arrays(state, param_count) != 0 ||
+            initialize_metadata_parameter_types(state, metadata, param_count) != 0) {
             if (state->plugin_name != NULL) free(state->plugin_name);
             if (state->interface_name != NULL) free(state->interface_name);
             free_parameter_arrays(state);
-            if (saved_desc_buf != NULL) {
-                free(saved_desc_buf);
-            }
             return NULL;
         }
     } else {
@@ -134,16 +243,16 @@ target_interface_state_t* find_or_create_interface_state(const char* plugin_name
         state->param_sizes = NULL;
         state->param_int_values = NULL;
         state->param_float_values = NULL;
+        state->param_borrowed = NULL;
     }
     
+    apply_call_convention(state, metadata);
     ctx->interface_state_count++;
+    store_interface_metadata(state, metadata);
     
     if (state->return_type == PT_RETURN_TYPE_STRUCT_PTR) {
-        internal_log_write("INFO", "Struct return type detected for %s.%s from description, return type set to pointer", plugin_name, interface_name);
-    }
-    
-    if (saved_desc_buf != NULL) {
-        free(saved_desc_buf);
+        internal_log_write("INFO", "Struct return type detected for %s.%s from %s, return type set to pointer",
+                      plugin_name, interface_name, metadata->from_cache ? "cache" : (metadata->descriptor != NULL ? "descriptor" : "description"));
     }
     
     internal_log_write("INFO", "Created interface state for %s.%s with %d parameters, return_type=%d", 
@@ -152,3 +261,91 @@ target_interface_state_t* find_or_create_interface_state(const char* plugin_name
     return state;
 }
 
+/**
+ * @brief 将已存在的接口状态绑定到当前加载的库 / Bind an existing interface state to the currently loaded library / Vorhandenen Schnittstellenstatus an die aktuell geladene Bibliothek binden
+ */
+void bind_interface_state(target_interface_state_t* state, void* handle, void* func_ptr) {
+    if (state == NULL || handle == NULL || func_ptr == NULL) {
+        return;
+    }
+    
+    /* 插件被卸载并重新加载后更新句柄和函数指针 / Update handle and function pointer after the plugin was unloaded and reloaded / Handle und Funktionszeiger aktualisieren, nachdem das Plugin entladen und neu geladen wurde */
+    if (state->handle != handle || state->func_ptr != func_ptr) {
+        state->handle = handle;
+        state->func_ptr = func_ptr;
+        state->validation_done = 0;
+        if (state->call_convention == NXLD_CALL_CONVENTION_PACK) {
+            state->pack_version = get_plugin_pack_version(handle);
+        }
+    }
+}
+
+/**
+ * @brief 查找或创建目标接口状态 / Find or create target interface state / Ziel-Schnittstellenstatus suchen oder erstellen
+ * @details 创建会移动接口状态数组，调用方须持有写锁或在调度开始前运行 / Creating moves the interface state array, callers must hold the write lock or run before dispatch starts / Das Erstellen verschiebt das Schnittstellenstatus-Array, Aufrufer müssen die Schreibsperre halten oder vor Beginn der Verteilung laufen
+ */
+target_interface_state_t* find_or_create_interface_state(const char* plugin_name, const char* interface_name, void* handle, void* func_ptr) {
+    if (plugin_name == NULL || interface_name == NULL || handle == NULL || func_ptr == NULL) {
+        return NULL;
+    }
+    
+    /* 首先尝试查找已存在的接口状态 / First try to find existing interface state / Zuerst versuchen, vorhandenen Schnittstellenstatus zu finden */
+    target_interface_state_t* existing_state = find_interface_state(plugin_name, interface_name);
+    if (existing_state != NULL) {
+        bind_interface_state(existing_state, handle, func_ptr);
+        return existing_state;
+    }
+    
+    interface_metadata_t metadata;
+    if (load_interface_metadata(handle, func_ptr, plugin_name, interface_name, &metadata) != 0) {
+        return NULL;
+    }
+    target_interface_state_t* state = create_interface_state(plugin_name, interface_name, handle, func_ptr, &metadata);
+    free(metadata.cached_param_types);
+    return state;
+}
+
+
+/**
+ * @brief 将接口状态重新绑定到新版本的库 / Rebind interface state to a new version of the library / Schnittstellenstatus an eine neue Version der Bibliothek binden
+ * @details 参数数组和已就绪的参数保持不变，因此参数数量必须相同 / Parameter arrays and ready parameters are kept, so the parameter count must match / Parameter-Arrays und bereite Parameter bleiben erhalten, daher muss die Parameteranzahl übereinstimmen
+ */
+int rebind_interface_state(target_interface_state_t* state, void* handle, int apply) {
+    if (state == NULL || handle == NULL) {
+        return -1;
+    }
+    
+    void* func_ptr = pt_platform_get_symbol(handle, state->interface_name);
+    if (func_ptr == NULL) {
+        internal_log_write("WARNING", "rebind_interface_state: %s.%s not exported by new library", state->plugin_name, state->interface_name);
+        return -1;
+    }
+    
+    interface_metadata_t metadata;
+    if (load_interface_metadata(handle, func_ptr, state->plugin_name, state->interface_name, &metadata) != 0) {
+        internal_log_write("WARNING", "rebind_interface_state: no metadata for %s.%s in new library", state->plugin_name, state->interface_name);
+        return -1;
+    }
+    
+    int is_variadic = 0;
+    int param_count = calculate_param_count(metadata.param_count_type, metadata.min_count, metadata.max_count, &is_variadic);
+    if (param_count != state->param_count || is_variadic != state->is_variadic) {
+        internal_log_write("WARNING", "rebind_interface_state: %s.%s changed from %d to %d parameters",
+                          state->plugin_name, state->interface_name, state->param_count, param_count);
+        free(metadata.cached_param_types);
+        return -1;
+    }
+    
+    if (apply) {
+        state->handle = handle;
+        state->func_ptr = func_ptr;
+        state->return_type = metadata.return_type;
+        state->return_size = metadata.return_size;
+        state->validation_done = 0;
+        initialize_metadata_parameter_types(state, &metadata, param_count);
+        apply_call_convention(state, &metadata);
+        store_interface_metadata(state, &metadata);
+    }
+    free(metadata.cached_param_types);
+    return 0;
+}
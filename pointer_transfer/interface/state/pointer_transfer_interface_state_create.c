@@ -57,10 +57,12 @@ int allocate_parameter_arrays(target_interface_state_t* state, int param_count)
     state->param_sizes = (size_t*)calloc(param_count, sizeof(size_t));
     state->param_int_values = (int64_t*)calloc(param_count, sizeof(int64_t));
     state->param_float_values = (double*)calloc(param_count, sizeof(double));
+    state->param_borrowed = (int*)calloc(param_count, sizeof(int));
     
     if (state->param_ready == NULL || state->param_values == NULL ||
         state->param_types == NULL || state->param_sizes == NULL || 
-        state->param_int_values == NULL || state->param_float_values == NULL) {
+        state->param_int_values == NULL || state->param_float_values == NULL ||
+        state->param_borrowed == NULL) {
         return -1;
     }
     
@@ -100,6 +102,10 @@ void free_parameter_arrays(target_interface_state_t* state) {
         free(state->param_float_values);
         state->param_float_values = NULL;
     }
+    if (state->param_borrowed != NULL) {
+        free(state->param_borrowed);
+        state->param_borrowed = NULL;
+    }
 }
 
 /**
@@ -180,6 +186,10 @@ int initialize_interface_state_basic(target_interface_state_t* state,
     state->actual_param_count = param_count;
     state->return_type = return_type;
     state->return_size = 0;
+    state->return_is_string = 0;
+    state->call_convention = NXLD_CALL_CONVENTION_PACK;
+    state->pack_version = NXLD_PACK_VERSION_1;
+    memset(&state->native_plan, 0, sizeof(state->native_plan));
     state->in_use = 0;
     state->validation_done = 0;
     
@@ -191,6 +201,9 @@ int initialize_interface_state_basic(target_interface_state_t* state,
         for (int i = 0; i < param_count; i++) {
             state->param_ready[i] = 0;
             state->param_values[i] = NULL;
+            if (state->param_borrowed != NULL) {
+                state->param_borrowed[i] = 0;
+            }
         }
     }
     
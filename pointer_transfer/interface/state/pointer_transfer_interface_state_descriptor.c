@@ -0,0 +1,160 @@
+/**
+ * @file pointer_transfer_interface_state_descriptor.c
+ * @brief 插件描述符读取 / Plugin Descriptor Reading / Plugin-Deskriptor-Auswertung
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_utils.h"
+#include "nxld_plugin_interface.h"
+#include "pointer_transfer_platform.h"
+#include <string.h>
+#include <stddef.h>
+
+/* 描述符中单个接口允许的最大参数数量 / Maximum parameter count accepted for one descriptor interface / Maximale Parameteranzahl für eine Deskriptor-Schnittstelle */
+#define DESCRIPTOR_MAX_PARAM_COUNT 256
+
+/**
+ * @brief 检查接口描述符是否完整 / Check if interface descriptor is complete / Prüfen, ob Schnittstellendeskriptor vollständig ist
+ */
+static int is_interface_descriptor_valid(const nxld_interface_descriptor_t* descriptor) {
+    if (descriptor->min_param_count < 0 || descriptor->min_param_count > DESCRIPTOR_MAX_PARAM_COUNT ||
+        descriptor->max_param_count > DESCRIPTOR_MAX_PARAM_COUNT || descriptor->return_type > NXLD_RETURN_TYPE_STRUCT ||
+        descriptor->param_count_type > NXLD_PARAM_COUNT_UNKNOWN) {
+        return 0;
+    }
+    if (descriptor->return_type == NXLD_RETURN_TYPE_STRUCT && descriptor->return_size == 0) {
+        return 0;
+    }
+    
+    int is_variadic = 0;
+    int param_count = calculate_param_count(descriptor->param_count_type, descriptor->min_param_count,
+                                            descriptor->max_param_count, &is_variadic);
+    return param_count <= 0 || descriptor->param_types != NULL;
+}
+
+/**
+ * @brief 在插件描述符中查找接口 / Find interface in plugin descriptor / Schnittstelle im Plugin-Deskriptor suchen
+ * @param handle 插件句柄 / Plugin handle / Plugin-Handle
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @param func_ptr 已解析的接口函数指针 / Resolved interface function pointer / Aufgelöster Schnittstellen-Funktionszeiger
+ * @param call_convention_out 输出插件的调用约定，可为NULL / Outputs the plugin's calling convention, can be NULL / Gibt die Aufrufkonvention des Plugins aus, kann NULL sein
+ * @return 接口描述符，插件未导出描述符、接口不在其中或描述符与导出不一致时返回NULL / Interface descriptor, NULL if the plugin exports no descriptor, the interface is not listed or the descriptor disagrees with the export / Schnittstellendeskriptor, NULL wenn das Plugin keinen Deskriptor exportiert, die Schnittstelle fehlt oder der Deskriptor dem Export widerspricht
+ */
+const nxld_interface_descriptor_t* find_interface_descriptor(void* handle, const char* interface_name, void* func_ptr,
+                                                              nxld_call_convention_t* call_convention_out) {
+    if (call_convention_out != NULL) {
+        *call_convention_out = NXLD_CALL_CONVENTION_PACK;
+    }
+    if (handle == NULL || interface_name == NULL) {
+        return NULL;
+    }
+    
+    typedef const nxld_plugin_descriptor_t* (NXLD_PLUGIN_CALL *get_descriptor_func)(void);
+    get_descriptor_func get_descriptor = (get_descriptor_func)pt_platform_get_symbol(handle, "nxld_plugin_get_descriptor");
+    if (get_descriptor == NULL) {
+        return NULL;
+    }
+    
+    const nxld_plugin_descriptor_t* plugin = get_descriptor();
+    if (plugin == NULL || plugin->interfaces == NULL) {
+        return NULL;
+    }
+    if (plugin->descriptor_version < 1 || plugin->descriptor_version > NXLD_PLUGIN_DESCRIPTOR_VERSION) {
+        internal_log_write("WARNING", "Plugin descriptor version %u is not supported, using interface metadata functions", plugin->descriptor_version);
+        return NULL;
+    }
+    /* 版本1的描述符在interfaces之后结束，不能读取call_convention / Version 1 descriptors end after interfaces, call_convention must not be read / Deskriptoren der Version 1 enden nach interfaces, call_convention darf nicht gelesen werden */
+    nxld_call_convention_t call_convention = NXLD_CALL_CONVENTION_PACK;
+    if (plugin->descriptor_version >= 2) {
+        call_convention = plugin->call_convention;
+        if (call_convention != NXLD_CALL_CONVENTION_PACK && call_convention != NXLD_CALL_CONVENTION_NATIVE) {
+            internal_log_write("WARNING", "Plugin descriptor declares unknown calling convention %d, using interface metadata functions", (int)call_convention);
+            return NULL;
+        }
+    }
+    
+    for (size_t i = 0; i < plugin->interface_count; i++) {
+        const nxld_interface_descriptor_t* descriptor = &plugin->interfaces[i];
+        if (descriptor->name == NULL || strcmp(descriptor->name, interface_name) != 0) {
+            continue;
+        }
+        if (!is_interface_descriptor_valid(descriptor)) {
+            internal_log_write("WARNING", "Descriptor of interface %s is malformed, using interface metadata functions", interface_name);
+            return NULL;
+        }
+        if (descriptor->func_ptr != NULL && func_ptr != NULL && descriptor->func_ptr != func_ptr) {
+            internal_log_write("WARNING", "Descriptor of interface %s does not match the exported function, using interface metadata functions", interface_name);
+            return NULL;
+        }
+        if (call_convention_out != NULL) {
+            *call_convention_out = call_convention;
+        }
+        return descriptor;
+    }
+    return NULL;
+}
+
+/**
+ * @brief 读取插件接受的参数包版本 / Read the parameter pack version accepted by the plugin / Vom Plugin akzeptierte Parameterpaket-Version lesen
+ * @param handle 插件句柄 / Plugin handle / Plugin-Handle
+ * @return 插件导出的版本（超出已知范围时取最高已知版本），未导出时返回NXLD_PACK_VERSION_1 / Version exported by the plugin (clamped to the highest known version), NXLD_PACK_VERSION_1 if not exported / Vom Plugin exportierte Version (auf die höchste bekannte Version begrenzt), NXLD_PACK_VERSION_1 ohne Export
+ * @note 读取的是数据符号，不执行插件代码 / Reads a data symbol, no plugin code runs / Liest ein Datensymbol, es wird kein Plugin-Code ausgeführt
+ */
+uint32_t get_plugin_pack_version(void* handle) {
+    if (handle == NULL) {
+        return NXLD_PACK_VERSION_1;
+    }
+    
+    const uint32_t* version = (const uint32_t*)pt_platform_get_symbol(handle, NXLD_PLUGIN_PACK_VERSION_SYMBOL);
+    if (version == NULL || *version < NXLD_PACK_VERSION_2) {
+        return NXLD_PACK_VERSION_1;
+    }
+    return NXLD_PACK_VERSION_2;
+}
+
+/**
+ * @brief 将描述符返回值类型映射为调用返回值类型 / Map descriptor return type to call return type / Deskriptor-Rückgabetyp auf Aufruf-Rückgabetyp abbilden
+ * @param descriptor 接口描述符 / Interface descriptor / Schnittstellendeskriptor
+ * @param return_size_out 输出返回值大小（仅结构体非0） / Output return size (non-zero only for structs) / Ausgabe-Rückgabegröße (nur bei Strukturen ungleich 0)
+ * @return 调用返回值类型 / Call return type / Aufruf-Rückgabetyp
+ * @note 字符串和指针与描述推断一致按STRUCT_PTR处理 / Strings and pointers map to STRUCT_PTR, as description inference does / Zeichenfolgen und Zeiger werden wie bei der Beschreibungsableitung auf STRUCT_PTR abgebildet
+ */
+pt_return_type_t map_descriptor_return_type(const nxld_interface_descriptor_t* descriptor, size_t* return_size_out) {
+    if (return_size_out != NULL) {
+        *return_size_out = 0;
+    }
+    if (descriptor == NULL) {
+        return PT_RETURN_TYPE_INTEGER;
+    }
+    
+    switch (descriptor->return_type) {
+        case NXLD_RETURN_TYPE_FLOAT:
+            return PT_RETURN_TYPE_FLOAT;
+        case NXLD_RETURN_TYPE_DOUBLE:
+            return PT_RETURN_TYPE_DOUBLE;
+        case NXLD_RETURN_TYPE_POINTER:
+        case NXLD_RETURN_TYPE_STRING:
+            return PT_RETURN_TYPE_STRUCT_PTR;
+        case NXLD_RETURN_TYPE_STRUCT:
+            if (return_size_out != NULL) {
+                *return_size_out = descriptor->return_size;
+            }
+            return PT_RETURN_TYPE_STRUCT_PTR;
+        default:
+            return PT_RETURN_TYPE_INTEGER;
+    }
+}
+
+/**
+ * @brief 从描述符复制参数类型 / Copy parameter types from descriptor / Parametertypen aus Deskriptor kopieren
+ * @param state 接口状态 / Interface state / Schnittstellenstatus
+ * @param descriptor 接口描述符 / Interface descriptor / Schnittstellendeskriptor
+ * @param param_count 参数数量 / Parameter count / Parameteranzahl
+ */
+void apply_descriptor_parameter_types(target_interface_state_t* state, const nxld_interface_descriptor_t* descriptor, int param_count) {
+    if (state == NULL || descriptor == NULL || state->param_types == NULL || descriptor->param_types == NULL || param_count <= 0) {
+        return;
+    }
+    
+    memcpy(state->param_types, descriptor->param_types, (size_t)param_count * sizeof(nxld_param_type_t));
+}
@@ -52,7 +52,43 @@ int validate_plugin_function(target_interface_state_t* state, const char* plugin
         return 0;
     }
     
-    int32_t validation_result = pt_validate_plugin_function(state->func_ptr, plugin_path, 
+    /* 原生接口不接收参数包，不能试调用；签名已在创建调用计划时检查 / Native interfaces take no parameter pack and cannot be trial-called; their signature was checked when the call plan was built / Native Schnittstellen erhalten kein Parameterpaket und können nicht probeweise aufgerufen werden; ihre Signatur wurde beim Erstellen des Aufrufplans geprüft */
+    if (state->call_convention == NXLD_CALL_CONVENTION_NATIVE) {
+        if (!state->native_plan.valid) {
+            internal_log_write("ERROR", "Plugin function validation failed: %s has no usable native call plan", interface_name);
+            return -1;
+        }
+        state->validation_done = 1;
+        return 0;
+    }
+    
+    /* 后台验证覆盖的接口只查询结果，未完成时按ValidationPending策略处理 / Interfaces covered by background validation only query the result and follow the ValidationPending policy while it is pending / Von der Hintergrundvalidierung abgedeckte Schnittstellen fragen nur das Ergebnis ab und folgen bei ausstehender Validierung der ValidationPending-Strategie */
+    pointer_transfer_context_t* ctx = get_global_context();
+    validation_pending_policy_t policy = ctx != NULL ? ctx->validation_pending : VALIDATION_PENDING_WAIT;
+    int background_result = get_interface_validation_result(state, actual_param_count, return_type);
+    if (background_result == INTERFACE_VALIDATION_PENDING && policy == VALIDATION_PENDING_SKIP) {
+        internal_log_write("WARNING", "Skipping call to %s: background validation still pending", interface_name);
+        return -1;
+    }
+    
+    /* 首次调用前结束该插件的试调用，试调用不会与本次调用并发；CALL策略撤回未开始的任务而不是等待它们 / Settle the plugin's trial calls before the first call so none runs concurrently with it; the CALL policy withdraws jobs not yet started instead of waiting for them / Vor dem ersten Aufruf die Probeaufrufe des Plugins abschließen, damit keiner gleichzeitig läuft; die CALL-Strategie zieht noch nicht gestartete Aufträge zurück, statt auf sie zu warten */
+    settle_plugin_validation(state->handle, policy == VALIDATION_PENDING_CALL);
+    if (background_result == INTERFACE_VALIDATION_PENDING && policy == VALIDATION_PENDING_CALL) {
+        internal_log_write("INFO", "Calling %s before background validation finished", interface_name);
+        return 0;
+    }
+    background_result = get_interface_validation_result(state, actual_param_count, return_type);
+    if (background_result == INTERFACE_VALIDATION_PASSED) {
+        state->validation_done = 1;
+        return 0;
+    }
+    if (background_result == INTERFACE_VALIDATION_FAILED) {
+        internal_log_write("ERROR", "Plugin function validation failed: background validation rejected %s", interface_name);
+        return -1;
+    }
+    
+    /* 不在后台计划中的接口（未预加载、可变参数数量不同或已热替换）同步验证 / Interfaces outside the background plan (not preloaded, different variadic count or hot-swapped) are validated synchronously / Schnittstellen außerhalb des Hintergrundplans (nicht vorgeladen, abweichende variable Anzahl oder per Hot-Swap ersetzt) werden synchron validiert */
+    int32_t validation_result = pt_validate_plugin_function(state->handle, state->func_ptr, plugin_path, 
                                                              interface_name, actual_param_count, return_type);
     if (validation_result != 0) {
         internal_log_write("ERROR", "Plugin function validation failed: function validation returned error");
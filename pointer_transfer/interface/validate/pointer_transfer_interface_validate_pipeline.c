@@ -0,0 +1,295 @@
+/**
+ * @file pointer_transfer_interface_validate_pipeline.c
+ * @brief 启动时后台并行接口验证 / Background Parallel Interface Validation at Startup / Parallele Hintergrund-Schnittstellenvalidierung beim Start
+ */
+
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 验证最大工作线程数 / Maximum validation worker threads / Maximale Validierungs-Arbeitsthreads */
+#define VALIDATION_MAX_WORKERS 8
+
+/**
+ * @brief 验证任务 / Validation job / Validierungsauftrag
+ */
+typedef struct {
+    char* plugin_path;             /**< 插件路径 / Plugin path / Plugin-Pfad */
+    char* interface_name;          /**< 接口名称 / Interface name / Schnittstellenname */
+    void* handle;                  /**< 插件库句柄 / Plugin library handle / Plugin-Bibliotheks-Handle */
+    void* func_ptr;                /**< 被验证的函数指针 / Validated function pointer / Validierter Funktionszeiger */
+    int param_count;               /**< 参数数量 / Parameter count / Parameteranzahl */
+    pt_return_type_t return_type;  /**< 返回值类型 / Return type / Rückgabetyp */
+    volatile int claimed;          /**< 已被工作线程或调用路径领取（非0） / Claimed by a worker or the call path (non-zero) / Von einem Arbeitsthread oder dem Aufrufpfad beansprucht (ungleich 0) */
+    volatile int result;           /**< INTERFACE_VALIDATION_NONE/PENDING/PASSED/FAILED */
+} validation_job_t;
+
+/**
+ * @brief 验证计划（启动后只有任务结果会变化） / Validation plan (only job results change once started) / Validierungsplan (nach dem Start ändern sich nur die Auftragsergebnisse)
+ */
+typedef struct {
+    validation_job_t* jobs;        /**< 任务数组 / Job array / Auftrags-Array */
+    size_t count;                  /**< 任务数量 / Job count / Auftragsanzahl */
+    size_t capacity;               /**< 任务数组容量 / Job array capacity / Kapazität des Auftrags-Arrays */
+    volatile int next;             /**< 下一个待领取的任务 / Next job to claim / Nächster zu beanspruchender Auftrag */
+    int64_t start_us;              /**< 开始时间 / Start time / Startzeit */
+} validation_plan_t;
+
+/* 验证协调线程 / Validation coordinator thread / Validierungs-Koordinationsthread */
+static pt_platform_thread_t* g_validation_thread = NULL;
+
+/* 验证进行中标志 / Validation in progress flag / Validierung-läuft-Flag */
+static volatile int g_validation_active = 0;
+
+/* 保护协调线程句柄的互斥锁，进程生命周期内保留 / Mutex guarding the coordinator handle, kept for the process lifetime / Mutex für das Koordinations-Handle, bleibt für die Prozesslebensdauer */
+static pt_platform_mutex_t* g_validation_mutex = NULL;
+
+/* 当前验证计划，清理前保留供调用路径查询 / Current validation plan, kept for call path lookups until cleanup / Aktueller Validierungsplan, bleibt bis zur Bereinigung für Abfragen im Aufrufpfad */
+static validation_plan_t g_validation_plan;
+
+/**
+ * @brief 领取任务，每个任务只有一方能领取 / Claim a job, only one party can claim each job / Auftrag beanspruchen, jeden Auftrag kann nur eine Seite beanspruchen
+ * @return 领取成功返回1，已被领取返回0 / Returns 1 if claimed, 0 if already claimed / Gibt 1 zurück, wenn beansprucht, 0 wenn bereits beansprucht
+ */
+static int claim_validation_job(validation_job_t* job) {
+    return pt_platform_atomic_fetch_add_int(&job->claimed, 1) == 0;
+}
+
+/**
+ * @brief 试调用已领取的任务并发布结果 / Trial-call a claimed job and publish the result / Beanspruchten Auftrag probeweise aufrufen und Ergebnis veröffentlichen
+ * @details 结果由pt_validate_plugin_function写入验证数据库 / Results are persisted to the validation database by pt_validate_plugin_function / Ergebnisse werden von pt_validate_plugin_function in der Validierungsdatenbank gespeichert
+ */
+static void run_validation_job(validation_job_t* job) {
+    int32_t result = pt_validate_plugin_function(job->handle, job->func_ptr, job->plugin_path, job->interface_name,
+                                                 job->param_count, job->return_type);
+    pt_platform_atomic_store_int(&job->result, result == 0 ? INTERFACE_VALIDATION_PASSED : INTERFACE_VALIDATION_FAILED);
+}
+
+/**
+ * @brief 工作线程：领取任务直到计划完成 / Worker thread: claim jobs until the plan is done / Arbeitsthread: Aufträge beanspruchen, bis der Plan fertig ist
+ */
+static void validation_worker(void* arg) {
+    validation_plan_t* plan = (validation_plan_t*)arg;
+    for (;;) {
+        int index = pt_platform_atomic_fetch_add_int(&plan->next, 1);
+        if (index < 0 || (size_t)index >= plan->count) {
+            break;
+        }
+        validation_job_t* job = &plan->jobs[index];
+        if (pt_platform_atomic_load_int(&job->result) != INTERFACE_VALIDATION_PENDING || !claim_validation_job(job)) {
+            continue;
+        }
+        run_validation_job(job);
+    }
+}
+
+/**
+ * @brief 协调线程主函数：在线程池中执行所有任务 / Coordinator thread main function: run all jobs on the pool / Hauptfunktion des Koordinationsthreads: alle Aufträge im Pool ausführen
+ */
+static void validation_thread_main(void* arg) {
+    validation_plan_t* plan = (validation_plan_t*)arg;
+    size_t worker_count = (size_t)pt_platform_get_cpu_count();
+    if (worker_count > VALIDATION_MAX_WORKERS) {
+        worker_count = VALIDATION_MAX_WORKERS;
+    }
+    if (worker_count > plan->count) {
+        worker_count = plan->count;
+    }
+    
+    pt_platform_thread_t* threads[VALIDATION_MAX_WORKERS];
+    size_t started = 0;
+    for (size_t i = 1; i < worker_count; i++) {
+        threads[started] = pt_platform_thread_create(validation_worker, plan);
+        if (threads[started] == NULL) {
+            break;
+        }
+        started++;
+    }
+    validation_worker(plan);
+    for (size_t i = 0; i < started; i++) {
+        pt_platform_thread_join(threads[i]);
+    }
+    
+    size_t passed_count = 0;
+    for (size_t i = 0; i < plan->count; i++) {
+        passed_count += plan->jobs[i].result == INTERFACE_VALIDATION_PASSED ? 1 : 0;
+    }
+    internal_log_write("INFO", "Background validation finished: %zu/%zu interfaces passed in %lld ms with %zu threads",
+                      passed_count, plan->count, (long long)((pt_platform_get_monotonic_us() - plan->start_us) / 1000), started + 1);
+}
+
+/**
+ * @brief 添加接口验证任务 / Add interface validation job / Schnittstellen-Validierungsauftrag hinzufügen
+ * @details 只在预加载屏障挡住调用时添加，调用路径不会看到扩容中的数组 / Jobs are only added while the preload barrier holds calls off, so the call path never sees the array being grown / Aufträge werden nur hinzugefügt, während die Vorladebarriere Aufrufe zurückhält, daher sieht der Aufrufpfad nie das wachsende Array
+ */
+int add_interface_validation_job(const target_interface_state_t* state, const char* plugin_path) {
+    if (state == NULL || plugin_path == NULL || state->func_ptr == NULL || state->interface_name == NULL) {
+        return -1;
+    }
+    
+    /* 运行中的计划不可修改 / A running plan must not be modified / Ein laufender Plan darf nicht verändert werden */
+    wait_for_interface_validation();
+    
+    validation_plan_t* plan = &g_validation_plan;
+    for (size_t i = 0; i < plan->count; i++) {
+        if (plan->jobs[i].func_ptr == state->func_ptr && plan->jobs[i].param_count == state->param_count &&
+            plan->jobs[i].return_type == state->return_type) {
+            return 0;
+        }
+    }
+    
+    if (plan->count >= plan->capacity) {
+        size_t new_capacity = plan->capacity == 0 ? INITIAL_PLUGIN_CAPACITY : plan->capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < plan->capacity || new_capacity > SIZE_MAX / sizeof(validation_job_t)) {
+            return -1;
+        }
+        validation_job_t* new_jobs = (validation_job_t*)realloc(plan->jobs, new_capacity * sizeof(validation_job_t));
+        if (new_jobs == NULL) {
+            return -1;
+        }
+        plan->jobs = new_jobs;
+        plan->capacity = new_capacity;
+    }
+    
+    validation_job_t* job = &plan->jobs[plan->count];
+    memset(job, 0, sizeof(validation_job_t));
+    job->plugin_path = allocate_string(plugin_path);
+    job->interface_name = allocate_string(state->interface_name);
+    if (job->plugin_path == NULL || job->interface_name == NULL) {
+        free(job->plugin_path);
+        free(job->interface_name);
+        return -1;
+    }
+    job->handle = state->handle;
+    job->func_ptr = state->func_ptr;
+    job->param_count = state->param_count;
+    job->return_type = state->return_type;
+    job->result = INTERFACE_VALIDATION_PENDING;
+    plan->count++;
+    return 0;
+}
+
+/**
+ * @brief 启动后台接口验证 / Start background interface validation / Hintergrund-Schnittstellenvalidierung starten
+ * @details 无法创建线程时同步验证 / Validates synchronously when no thread can be created / Validiert synchron, wenn kein Thread erstellt werden kann
+ */
+int start_interface_validation(void) {
+    validation_plan_t* plan = &g_validation_plan;
+    if (pt_platform_atomic_load_int(&g_validation_active)) {
+        return 0;
+    }
+    size_t pending_count = 0;
+    for (size_t i = 0; i < plan->count; i++) {
+        pending_count += plan->jobs[i].result == INTERFACE_VALIDATION_PENDING ? 1 : 0;
+    }
+    if (pending_count == 0) {
+        return 0;
+    }
+    
+    /* 已完成的任务在领取时跳过 / Finished jobs are skipped when claimed / Abgeschlossene Aufträge werden beim Beanspruchen übersprungen */
+    plan->next = 0;
+    plan->start_us = pt_platform_get_monotonic_us();
+    internal_log_write("INFO", "Validating %zu interfaces in background", pending_count);
+    
+    if (g_validation_mutex == NULL) {
+        g_validation_mutex = pt_platform_mutex_create();
+    }
+    if (g_validation_mutex != NULL) {
+        pt_platform_atomic_store_int(&g_validation_active, 1);
+        g_validation_thread = pt_platform_thread_create(validation_thread_main, plan);
+        if (g_validation_thread != NULL) {
+            return 0;
+        }
+        pt_platform_atomic_store_int(&g_validation_active, 0);
+    }
+    
+    internal_log_write("WARNING", "start_interface_validation: failed to create validation thread, validating synchronously");
+    validation_thread_main(plan);
+    return 0;
+}
+
+/**
+ * @brief 等待后台验证完成 / Wait for background validation to finish / Auf Abschluss der Hintergrundvalidierung warten
+ * @details 未在验证时只做一次原子读取 / Costs a single atomic read when no validation is running / Kostet nur einen atomaren Lesezugriff, wenn keine Validierung läuft
+ */
+void wait_for_interface_validation(void) {
+    if (!pt_platform_atomic_load_int(&g_validation_active)) {
+        return;
+    }
+    
+    pt_platform_mutex_lock(g_validation_mutex);
+    if (g_validation_thread != NULL) {
+        pt_platform_thread_join(g_validation_thread);
+        g_validation_thread = NULL;
+        pt_platform_atomic_store_int(&g_validation_active, 0);
+    }
+    pt_platform_mutex_unlock(g_validation_mutex);
+}
+
+/**
+ * @brief 结束插件的所有后台试调用 / Settle all background trial calls of a plugin / Alle Hintergrund-Probeaufrufe eines Plugins abschließen
+ * @details 在首次真正调用插件前执行，使试调用不会与调度调用并发进入同一插件：未开始的任务在调用线程上执行或被撤回，进行中的任务等待完成 / Runs before the first real call into the plugin so trial calls never enter it concurrently with dispatch calls: jobs not yet started run on the calling thread or are withdrawn, jobs in progress are waited for / Läuft vor dem ersten echten Aufruf des Plugins, damit Probeaufrufe nie gleichzeitig mit Dispatch-Aufrufen in das Plugin gelangen: noch nicht gestartete Aufträge laufen im aufrufenden Thread oder werden zurückgezogen, laufende Aufträge werden abgewartet
+ * @details 撤回的任务结果为INTERFACE_VALIDATION_NONE，其接口在首次调用时同步验证 / Withdrawn jobs end as INTERFACE_VALIDATION_NONE and their interface is validated synchronously on its first call / Zurückgezogene Aufträge enden als INTERFACE_VALIDATION_NONE, ihre Schnittstelle wird beim ersten Aufruf synchron validiert
+ */
+void settle_plugin_validation(void* handle, int withdraw_pending) {
+    if (handle == NULL || !pt_platform_atomic_load_int(&g_validation_active)) {
+        return;
+    }
+    
+    validation_plan_t* plan = &g_validation_plan;
+    for (size_t i = 0; i < plan->count; i++) {
+        validation_job_t* job = &plan->jobs[i];
+        if (job->handle != handle || pt_platform_atomic_load_int(&job->result) != INTERFACE_VALIDATION_PENDING) {
+            continue;
+        }
+        if (claim_validation_job(job)) {
+            if (withdraw_pending) {
+                pt_platform_atomic_store_int(&job->result, INTERFACE_VALIDATION_NONE);
+            } else {
+                run_validation_job(job);
+            }
+            continue;
+        }
+        while (pt_platform_atomic_load_int(&job->result) == INTERFACE_VALIDATION_PENDING) {
+            pt_platform_sleep_ms(1);
+        }
+    }
+}
+
+/**
+ * @brief 查询接口的后台验证结果 / Query background validation result of an interface / Hintergrund-Validierungsergebnis einer Schnittstelle abfragen
+ * @details 按函数指针、参数数量和返回类型匹配，不阻塞 / Matches function pointer, parameter count and return type without blocking / Vergleicht Funktionszeiger, Parameteranzahl und Rückgabetyp ohne zu blockieren
+ */
+int get_interface_validation_result(const target_interface_state_t* state, int param_count, pt_return_type_t return_type) {
+    if (state == NULL || state->func_ptr == NULL) {
+        return INTERFACE_VALIDATION_NONE;
+    }
+    
+    const validation_plan_t* plan = &g_validation_plan;
+    for (size_t i = 0; i < plan->count; i++) {
+        const validation_job_t* job = &plan->jobs[i];
+        if (job->func_ptr == state->func_ptr && job->param_count == param_count && job->return_type == return_type) {
+            return pt_platform_atomic_load_int(&job->result);
+        }
+    }
+    return INTERFACE_VALIDATION_NONE;
+}
+
+/**
+ * @brief 等待并释放后台验证计划 / Wait for and free the background validation plan / Auf den Hintergrund-Validierungsplan warten und ihn freigeben
+ */
+void free_interface_validation(void) {
+    wait_for_interface_validation();
+    
+    validation_plan_t* plan = &g_validation_plan;
+    for (size_t i = 0; i < plan->count; i++) {
+        free(plan->jobs[i].plugin_path);
+        free(plan->jobs[i].interface_name);
+    }
+    free(plan->jobs);
+    memset(plan, 0, sizeof(validation_plan_t));
+}
@@ -0,0 +1,80 @@
+/**
+ * @file loader/chain/pointer_transfer_plugin_loader_chain.h
+ * @brief 并行链式加载内部接口 / Parallel Chain Loading Internal Interface / Interne Schnittstelle des parallelen Kettenladens
+ */
+
+#ifndef POINTER_TRANSFER_PLUGIN_LOADER_CHAIN_H
+#define POINTER_TRANSFER_PLUGIN_LOADER_CHAIN_H
+
+#include "config/rules/config_rules_loader.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/* 根节点的父索引 / Parent index of the root node / Elternindex des Wurzelknotens */
+#define CHAIN_LOAD_NO_PARENT SIZE_MAX
+    
+/* 每层暂存的最大工作线程数 / Maximum worker threads staging one level / Maximale Arbeitsthreads pro Ebene */
+#define CHAIN_LOAD_MAX_WORKERS 8
+    
+/**
+ * @brief 依赖图节点 / Dependency graph node / Knoten des Abhängigkeitsgraphen
+ */
+typedef struct {
+    char* plugin_name;             /**< 插件名称 / Plugin name / Plugin-Name */
+    char* nxpt_path;               /**< .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad */
+    size_t parent;                 /**< 发现该节点的父节点（CHAIN_LOAD_NO_PARENT为根） / Parent that discovered the node (CHAIN_LOAD_NO_PARENT for the root) / Elternknoten, der den Knoten entdeckt hat (CHAIN_LOAD_NO_PARENT für die Wurzel) */
+    staged_rules_file_t staged;    /**< 暂存的规则文件 / Staged rules file / Bereitgestellte Regeldatei */
+    int stage_result;              /**< 暂存结果 / Staging result / Bereitstellungsergebnis */
+} chain_load_node_t;
+    
+/**
+ * @brief 按广度优先顺序排列的依赖图 / Dependency graph in breadth-first order / Abhängigkeitsgraph in Breitensuchreihenfolge
+ */
+typedef struct {
+    chain_load_node_t* nodes;      /**< 节点数组 / Node array / Knoten-Array */
+    size_t count;                  /**< 节点数量 / Node count / Knotenanzahl */
+    size_t capacity;               /**< 节点容量 / Node capacity / Knotenkapazität */
+} chain_load_graph_t;
+    
+/**
+ * @brief 添加节点，已在图中的插件被忽略 / Add node, plugins already in the graph are ignored / Knoten hinzufügen, bereits im Graphen vorhandene Plugins werden ignoriert
+ * @param graph 依赖图 / Dependency graph / Abhängigkeitsgraph
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @param parent 父节点索引 / Parent node index / Elternknotenindex
+ * @return 添加返回0，已存在返回1，失败返回-1 / Returns 0 when added, 1 if already present, -1 on failure / Gibt 0 zurück wenn hinzugefügt, 1 wenn bereits vorhanden, -1 bei Fehler
+ */
+int add_chain_load_node(chain_load_graph_t* graph, const char* plugin_name, const char* plugin_path, size_t parent);
+    
+/**
+ * @brief 释放依赖图 / Free dependency graph / Abhängigkeitsgraph freigeben
+ * @param graph 依赖图 / Dependency graph / Abhängigkeitsgraph
+ */
+void free_chain_load_graph(chain_load_graph_t* graph);
+    
+/**
+ * @brief 检测插件是否是节点自身或其祖先（循环依赖） / Detect whether plugin is the node itself or one of its ancestors (circular dependency) / Erkennen, ob das Plugin der Knoten selbst oder ein Vorfahre ist (zirkuläre Abhängigkeit)
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param graph 依赖图 / Dependency graph / Abhängigkeitsgraph
+ * @param node_index 发现依赖的节点 / Node that found the dependency / Knoten, der die Abhängigkeit gefunden hat
+ * @return 检测到循环返回1，否则返回0 / Returns 1 if cycle detected, 0 otherwise / Gibt 1 zurück, wenn Zyklus erkannt, sonst 0
+ */
+int detect_loading_cycle(const char* plugin_name, const chain_load_graph_t* graph, size_t node_index);
+    
+/**
+ * @brief 并发暂存一层节点 / Stage one level of nodes concurrently / Eine Ebene von Knoten parallel bereitstellen
+ * @param graph 依赖图 / Dependency graph / Abhängigkeitsgraph
+ * @param begin 层首节点 / First node of the level / Erster Knoten der Ebene
+ * @param end 层尾后节点 / One past the last node of the level / Einer nach dem letzten Knoten der Ebene
+ */
+void stage_chain_load_level(chain_load_graph_t* graph, size_t begin, size_t end);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POINTER_TRANSFER_PLUGIN_LOADER_CHAIN_H */
@@ -0,0 +1,85 @@
+/**
+ * @file loader/chain/pointer_transfer_plugin_loader_chain_graph.c
+ * @brief 链式加载依赖图实现 / Chain Loading Dependency Graph Implementation / Kettenlade-Abhängigkeitsgraph-Implementierung
+ */
+
+#include "pointer_transfer_plugin_loader_chain.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 添加节点 / Add node / Knoten hinzufügen
+ */
+int add_chain_load_node(chain_load_graph_t* graph, const char* plugin_name, const char* plugin_path, size_t parent) {
+    if (graph == NULL || plugin_name == NULL || plugin_path == NULL) {
+        return -1;
+    }
+    
+    /* 菱形依赖只加载一次 / Diamond dependencies are loaded once / Rautenabhängigkeiten werden nur einmal geladen */
+    for (size_t i = 0; i < graph->count; i++) {
+        if (strcmp(graph->nodes[i].plugin_name, plugin_name) == 0) {
+            return 1;
+        }
+    }
+    
+    size_t nxpt_path_size = strlen(plugin_path) + 6;
+    char* nxpt_path = (char*)malloc(nxpt_path_size);
+    if (nxpt_path == NULL) {
+        return -1;
+    }
+    if (build_nxpt_path(plugin_path, nxpt_path, nxpt_path_size) != 0) {
+        internal_log_write("WARNING", "Failed to build .nxpt path for plugin %s", plugin_name);
+        free(nxpt_path);
+        return -1;
+    }
+    
+    if (graph->count >= graph->capacity) {
+        size_t new_capacity = graph->capacity == 0 ? 8 : graph->capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < graph->capacity || new_capacity > SIZE_MAX / sizeof(chain_load_node_t)) {
+            free(nxpt_path);
+            return -1;
+        }
+        chain_load_node_t* new_nodes = (chain_load_node_t*)realloc(graph->nodes, new_capacity * sizeof(chain_load_node_t));
+        if (new_nodes == NULL) {
+            free(nxpt_path);
+            return -1;
+        }
+        graph->nodes = new_nodes;
+        graph->capacity = new_capacity;
+    }
+    
+    chain_load_node_t* node = &graph->nodes[graph->count];
+    memset(node, 0, sizeof(chain_load_node_t));
+    node->plugin_name = allocate_string(plugin_name);
+    if (node->plugin_name == NULL) {
+        free(nxpt_path);
+        return -1;
+    }
+    node->nxpt_path = nxpt_path;
+    node->parent = parent;
+    node->staged.parsed.max_seen_index = -1;
+    graph->count++;
+    return 0;
+}
+
+/**
+ * @brief 释放依赖图 / Free dependency graph / Abhängigkeitsgraph freigeben
+ */
+void free_chain_load_graph(chain_load_graph_t* graph) {
+    if (graph == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < graph->count; i++) {
+        chain_load_node_t* node = &graph->nodes[i];
+        free_staged_rules_file(&node->staged);
+        free(node->plugin_name);
+        free(node->nxpt_path);
+    }
+    if (graph->nodes != NULL) {
+        free(graph->nodes);
+    }
+    memset(graph, 0, sizeof(chain_load_graph_t));
+}
@@ -4,21 +4,37 @@
  */
 
 #include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_plugin_loader_chain.h"
 #include "pointer_transfer_context.h"
 #include "pointer_transfer_config.h"
 #include "pointer_transfer_utils.h"
 #include <string.h>
-#include <stdio.h>
 
 /**
- * @brief 链式加载插件.nxpt文件（内部函数） / Chain load plugin .nxpt file (internal function) / Plugin-.nxpt-Datei kettenweise laden (interne Funktion)
+ * @brief 从新合并的规则中发现下一层依赖 / Discover next level dependencies from newly merged rules / Abhängigkeiten der nächsten Ebene aus neu zusammengeführten Regeln ermitteln
+ */
+static void discover_chain_dependencies(chain_load_graph_t* graph, size_t node_index, size_t rule_begin, size_t rule_end) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    for (size_t i = rule_begin; i < rule_end; i++) {
+        pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (!rule->enabled || rule->target_plugin == NULL || rule->target_plugin_path == NULL) {
+            continue;
+        }
+        if (is_nxpt_loaded(rule->target_plugin) || detect_loading_cycle(rule->target_plugin, graph, node_index)) {
+            continue;
+        }
+        add_chain_load_node(graph, rule->target_plugin, rule->target_plugin_path, node_index);
+    }
+}
+
+/**
+ * @brief 链式加载插件的.nxpt文件 / Chain load plugin .nxpt file / Plugin-.nxpt-Datei kettenweise laden
+ * @details 广度优先发现依赖，每层的文件并发暂存，再按发现顺序合并；规则图在全部合并后构建一次 / Dependencies are discovered breadth-first, each level's files are staged concurrently and merged in discovery order; the rule graph is built once after all merges / Abhängigkeiten werden in Breitensuche ermittelt, die Dateien jeder Ebene parallel bereitgestellt und in Entdeckungsreihenfolge zusammengeführt; der Regelgraph wird nach allen Zusammenführungen einmal erstellt
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
  * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
- * @param loading_stack 加载栈数组 / Loading stack array / Ladestapel-Array
- * @param stack_size 加载栈大小 / Loading stack size / Ladestapel-Größe
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
-static int chain_load_plugin_nxpt_internal(const char* plugin_name, const char* plugin_path, const char* loading_stack[], size_t stack_size) {
+int chain_load_plugin_nxpt(const char* plugin_name, const char* plugin_path) {
     if (plugin_name == NULL || plugin_path == NULL) {
         return -1;
     }
@@ -27,64 +43,47 @@ static int chain_load_plugin_nxpt_internal(const char* plugin_name, const char*
         return 0;
     }
     
-    extern int detect_loading_cycle(const char* plugin_name, const char* loading_stack[], size_t stack_size);
-    if (detect_loading_cycle(plugin_name, loading_stack, stack_size)) {
-        return -1;
-    }
-    
-    char nxpt_path[4096];
-    if (build_nxpt_path(plugin_path, nxpt_path, sizeof(nxpt_path)) != 0) {
-        internal_log_write("WARNING", "Failed to build .nxpt path for plugin %s", plugin_name);
+    chain_load_graph_t graph;
+    memset(&graph, 0, sizeof(chain_load_graph_t));
+    if (add_chain_load_node(&graph, plugin_name, plugin_path, CHAIN_LOAD_NO_PARENT) != 0) {
+        free_chain_load_graph(&graph);
         return -1;
     }
     
-    internal_log_write("INFO", "Chain loading .nxpt file for plugin %s: %s", plugin_name, nxpt_path);
-    
     pointer_transfer_context_t* ctx = get_global_context();
-    size_t rule_count_before = ctx->rule_count;
-    
-    if (load_transfer_rules(nxpt_path) == 0) {
-        mark_nxpt_loaded(plugin_name, nxpt_path);
-        
-        extern void build_new_loading_stack(const char* loading_stack[], size_t stack_size, const char* plugin_name,
-                                          const char* new_loading_stack_out[32], size_t* new_stack_size_out);
-        const char* new_loading_stack[32];
-        size_t new_stack_size = 0;
-        build_new_loading_stack(loading_stack, stack_size, plugin_name, new_loading_stack, &new_stack_size);
+    int result = -1;
+    size_t level_begin = 0;
+    begin_rule_batch();
+    while (level_begin < graph.count) {
+        size_t level_end = graph.count;
+        stage_chain_load_level(&graph, level_begin, level_end);
         
-        for (size_t i = rule_count_before; i < ctx->rule_count; i++) {
-            pointer_transfer_rule_t* rule = &ctx->rules[i];
-            if (rule->enabled && rule->target_plugin != NULL && rule->target_plugin_path != NULL) {
-                if (!is_nxpt_loaded(rule->target_plugin)) {
-                    chain_load_plugin_nxpt_internal(rule->target_plugin, rule->target_plugin_path, new_loading_stack, new_stack_size);
-                }
+        /* 按发现顺序合并，结果与线程调度无关 / Merge in discovery order so the result does not depend on thread scheduling / In Entdeckungsreihenfolge zusammenführen, damit das Ergebnis nicht von der Thread-Planung abhängt */
+        for (size_t i = level_begin; i < level_end; i++) {
+            chain_load_node_t* node = &graph.nodes[i];
+            if (node->stage_result != 0) {
+                internal_log_write("WARNING", "Failed to load .nxpt file for plugin %s: %s", node->plugin_name, node->nxpt_path);
+                continue;
             }
+            
+            size_t rule_count_before = ctx->rule_count;
+            if (commit_staged_rules_file(node->nxpt_path, &node->staged, NULL) != 0) {
+                internal_log_write("WARNING", "Failed to load .nxpt file for plugin %s: %s", node->plugin_name, node->nxpt_path);
+                continue;
+            }
+            mark_nxpt_loaded(node->plugin_name, node->nxpt_path);
+            if (i == 0) {
+                result = 0;
+            }
+            discover_chain_dependencies(&graph, i, rule_count_before, ctx->rule_count);
         }
-        
-        return 0;
-    } else {
-        internal_log_write("WARNING", "Failed to load .nxpt file for plugin %s: %s", plugin_name, nxpt_path);
-        return -1;
+        level_begin = level_end;
     }
-}
-
-/**
- * @brief 链式加载插件的.nxpt文件 / Chain load plugin .nxpt file / Plugin-.nxpt-Datei kettenweise laden
- * @param plugin_name 插件名称 / Plugin name / Plugin-Name
- * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
- * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
- */
-int chain_load_plugin_nxpt(const char* plugin_name, const char* plugin_path) {
-    const char* initial_stack[1] = {NULL};
-    size_t initial_stack_size = 0;
+    end_rule_batch();
     
-    if (plugin_name != NULL) {
-        static char initial_plugin_name[256];
-        snprintf(initial_plugin_name, sizeof(initial_plugin_name), "%s", plugin_name);
-        initial_stack[0] = initial_plugin_name;
-        initial_stack_size = 1;
+    if (graph.count > 1) {
+        internal_log_write("INFO", "Chain loaded %zu .nxpt files starting from plugin %s", graph.count, plugin_name);
     }
-    
-    return chain_load_plugin_nxpt_internal(plugin_name, plugin_path, initial_stack, initial_stack_size);
+    free_chain_load_graph(&graph);
+    return result;
 }
-
@@ -0,0 +1,86 @@
+/**
+ * @file loader/chain/pointer_transfer_plugin_loader_chain_parallel.c
+ * @brief 链式加载并行暂存实现 / Chain Loading Parallel Staging Implementation / Kettenlade-Parallelbereitstellung-Implementierung
+ */
+
+#include "pointer_transfer_plugin_loader_chain.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 一层暂存任务 / Staging job of one level / Bereitstellungsauftrag einer Ebene
+ */
+typedef struct {
+    chain_load_graph_t* graph;     /**< 依赖图 / Dependency graph / Abhängigkeitsgraph */
+    size_t begin;                  /**< 层首节点 / First node of the level / Erster Knoten der Ebene */
+    int count;                     /**< 层节点数量 / Node count of the level / Knotenanzahl der Ebene */
+    volatile int next;             /**< 下一个待领取的偏移 / Next offset to claim / Nächster zu beanspruchender Offset */
+} chain_stage_job_t;
+
+/**
+ * @brief 暂存单个节点 / Stage single node / Einzelnen Knoten bereitstellen
+ */
+static void stage_chain_load_node(chain_load_node_t* node) {
+    internal_log_write("INFO", "Chain loading .nxpt file for plugin %s: %s", node->plugin_name, node->nxpt_path);
+    node->stage_result = stage_transfer_rules_file(node->nxpt_path, &node->staged);
+}
+
+/**
+ * @brief 工作线程：领取节点直到本层完成 / Worker thread: claim nodes until the level is done / Arbeitsthread: Knoten beanspruchen, bis die Ebene fertig ist
+ */
+static void chain_stage_worker(void* arg) {
+    chain_stage_job_t* job = (chain_stage_job_t*)arg;
+    for (;;) {
+        int offset = pt_platform_atomic_fetch_add_int(&job->next, 1);
+        if (offset >= job->count) {
+            break;
+        }
+        stage_chain_load_node(&job->graph->nodes[job->begin + (size_t)offset]);
+    }
+}
+
+/**
+ * @brief 并发暂存一层节点 / Stage one level of nodes concurrently / Eine Ebene von Knoten parallel bereitstellen
+ * @details 暂存只做文件映射、校验和分词，不修改上下文；合并由调用线程按顺序完成 / Staging only maps, validates and tokenizes files without touching the context; the calling thread merges in order / Die Bereitstellung ordnet nur Dateien zu, validiert und tokenisiert ohne Kontextänderung; der aufrufende Thread führt sie der Reihe nach zusammen
+ */
+void stage_chain_load_level(chain_load_graph_t* graph, size_t begin, size_t end) {
+    if (graph == NULL || begin >= end || end > graph->count) {
+        return;
+    }
+    
+    size_t level_size = end - begin;
+    size_t worker_count = (size_t)pt_platform_get_cpu_count();
+    if (worker_count > CHAIN_LOAD_MAX_WORKERS) {
+        worker_count = CHAIN_LOAD_MAX_WORKERS;
+    }
+    if (worker_count > level_size) {
+        worker_count = level_size;
+    }
+    
+    chain_stage_job_t job;
+    job.graph = graph;
+    job.begin = begin;
+    job.count = level_size > (size_t)INT32_MAX ? INT32_MAX : (int)level_size;
+    job.next = 0;
+    
+    /* 调用线程也参与，额外线程创建失败时仍能完成 / The calling thread takes part too, so the level completes even if no extra thread starts / Der aufrufende Thread arbeitet mit, daher wird die Ebene auch ohne zusätzliche Threads fertig */
+    pt_platform_thread_t* threads[CHAIN_LOAD_MAX_WORKERS];
+    size_t started = 0;
+    for (size_t i = 1; i < worker_count; i++) {
+        threads[started] = pt_platform_thread_create(chain_stage_worker, &job);
+        if (threads[started] == NULL) {
+            break;
+        }
+        started++;
+    }
+    chain_stage_worker(&job);
+    for (size_t i = 0; i < started; i++) {
+        pt_platform_thread_join(threads[i]);
+    }
+    
+    if (level_size > 1) {
+        internal_log_write("INFO", "Staged %zu .nxpt files with %zu threads", level_size, started + 1);
+    }
+}
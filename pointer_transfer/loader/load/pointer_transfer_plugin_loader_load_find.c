@@ -14,17 +14,10 @@
  * @return 找到返回插件句柄，否则返回NULL / Returns plugin handle if found, NULL otherwise / Gibt Plugin-Handle zurück, wenn gefunden, sonst NULL
  */
 void* find_loaded_plugin(pointer_transfer_context_t* ctx, const char* plugin_name) {
-    if (ctx == NULL || ctx->loaded_plugins == NULL || plugin_name == NULL) {
+    if (ctx == NULL || plugin_name == NULL) {
         return NULL;
     }
     
-    for (size_t i = 0; i < ctx->loaded_plugin_count; i++) {
-        if (ctx->loaded_plugins[i].plugin_name != NULL && 
-            strcmp(ctx->loaded_plugins[i].plugin_name, plugin_name) == 0) {
-            return ctx->loaded_plugins[i].handle;
-        }
-    }
-    
-    return NULL;
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+    return entry != NULL ? entry->handle : NULL;
 }
-
@@ -5,9 +5,8 @@
 
 #include "pointer_transfer_plugin_loader.h"
 #include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
 #include "pointer_transfer_utils.h"
-#include <stdlib.h>
-#include <string.h>
 
 /**
  * @brief 注册已加载的插件 / Register loaded plugin / Geladenes Plugin registrieren
@@ -22,27 +21,31 @@ int register_loaded_plugin(pointer_transfer_context_t* ctx, const char* plugin_n
         return -1;
     }
     
-    if (ctx->loaded_plugin_count >= ctx->loaded_plugin_capacity) {
-        if (expand_loaded_plugins_capacity() != 0) {
-            internal_log_write("ERROR", "Failed to expand loaded plugins capacity");
-            return -1;
-        }
-    }
-    
-    loaded_plugin_info_t* plugin_info = &ctx->loaded_plugins[ctx->loaded_plugin_count];
-    plugin_info->handle = handle;
-    plugin_info->plugin_name = allocate_string(plugin_name);
-    plugin_info->plugin_path = allocate_string(plugin_path);
-    
-    if (plugin_info->plugin_name == NULL || plugin_info->plugin_path == NULL) {
-        if (plugin_info->plugin_name != NULL) free(plugin_info->plugin_name);
-        if (plugin_info->plugin_path != NULL) free(plugin_info->plugin_path);
+    plugin_registry_entry_t* entry = get_or_create_plugin_registry_entry(plugin_name);
+    const char* interned_path = intern_plugin_registry_string(plugin_path);
+    if (entry == NULL || interned_path == NULL) {
         internal_log_write("ERROR", "Failed to allocate memory for plugin info");
         return -1;
     }
+    if (entry->handle != NULL) {
+        internal_log_write("WARNING", "Plugin %s is already loaded from %s", plugin_name, entry->plugin_path);
+        return -1;
+    }
     
-    ctx->loaded_plugin_count++;
-    internal_log_write("INFO", "Loaded target plugin: %s", plugin_name);
+    entry->handle = handle;
+    entry->plugin_path = interned_path;
+    entry->last_used_us = pt_platform_get_monotonic_us();
+    if (pt_platform_get_file_timestamp(plugin_path, &entry->file_timestamp) != 0) {
+        entry->file_timestamp = 0;
+    }
+    entry->load_count++;
+    ctx->plugin_registry.total_loads++;
+    ctx->plugin_registry.resident_count++;
+    if (entry->load_count > 1) {
+        internal_log_write("INFO", "Reloaded target plugin: %s (load #%llu)", plugin_name, (unsigned long long)entry->load_count);
+    } else {
+        internal_log_write("INFO", "Loaded target plugin: %s", plugin_name);
+    }
     
     return 0;
 }
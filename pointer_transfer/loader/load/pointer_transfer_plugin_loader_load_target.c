@@ -6,6 +6,7 @@
 #include "pointer_transfer_plugin_loader.h"
 #include "pointer_transfer_context.h"
 #include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
 
 /**
  * @brief 加载目标插件 / Load target plugin / Ziel-Plugin laden
@@ -18,25 +19,32 @@ void* load_target_plugin(const char* plugin_name, const char* plugin_path) {
         return NULL;
     }
     
+    /* 预加载线程会写入已加载插件表 / The preload thread writes the loaded plugin table / Der Vorladethread schreibt die Tabelle geladener Plugins */
+    wait_for_plugin_preload();
+    
     pointer_transfer_context_t* ctx = get_global_context();
-    extern void* find_loaded_plugin(pointer_transfer_context_t* ctx, const char* plugin_name);
     void* handle = find_loaded_plugin(ctx, plugin_name);
     if (handle != NULL) {
         return handle;
     }
     
+    int64_t start_us = pt_platform_get_monotonic_us();
     handle = pt_platform_load_library(plugin_path);
     if (handle == NULL) {
         internal_log_write("WARNING", "Failed to load target plugin: %s from %s", plugin_name, plugin_path);
         return NULL;
     }
     
-    extern int register_loaded_plugin(pointer_transfer_context_t* ctx, const char* plugin_name, const char* plugin_path, void* handle);
     if (register_loaded_plugin(ctx, plugin_name, plugin_path, handle) != 0) {
         pt_platform_close_library(handle);
         return NULL;
     }
     
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin_name);
+    if (entry != NULL) {
+        entry->load_us = pt_platform_get_monotonic_us() - start_us;
+    }
+    
     return handle;
 }
 
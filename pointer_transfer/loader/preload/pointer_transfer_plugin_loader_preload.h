@@ -0,0 +1,77 @@
+/**
+ * @file loader/preload/pointer_transfer_plugin_loader_preload.h
+ * @brief 插件预加载内部接口 / Plugin Preloading Internal Interface / Interne Schnittstelle des Plugin-Vorladens
+ */
+
+#ifndef POINTER_TRANSFER_PLUGIN_LOADER_PRELOAD_H
+#define POINTER_TRANSFER_PLUGIN_LOADER_PRELOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/* 预加载最大工作线程数 / Maximum preload worker threads / Maximale Vorlade-Arbeitsthreads */
+#define PRELOAD_MAX_WORKERS 8
+    
+/**
+ * @brief 预加载的接口符号 / Preloaded interface symbol / Vorgeladenes Schnittstellensymbol
+ */
+typedef struct {
+    char* interface_name;          /**< 接口名称 / Interface name / Schnittstellenname */
+    void* func_ptr;                /**< 解析出的函数指针 / Resolved function pointer / Aufgelöster Funktionszeiger */
+} preload_symbol_t;
+    
+/**
+ * @brief 预加载的插件 / Preloaded plugin / Vorgeladenes Plugin
+ */
+typedef struct {
+    char* plugin_name;             /**< 插件名称 / Plugin name / Plugin-Name */
+    char* plugin_path;             /**< 插件路径 / Plugin path / Plugin-Pfad */
+    preload_symbol_t* symbols;     /**< 规则引用的接口 / Interfaces referenced by rules / Von Regeln referenzierte Schnittstellen */
+    size_t symbol_count;           /**< 接口数量 / Interface count / Schnittstellenanzahl */
+    size_t symbol_capacity;        /**< 接口数组容量 / Interface array capacity / Kapazität des Schnittstellen-Arrays */
+    void* handle;                  /**< 插件句柄 / Plugin handle / Plugin-Handle */
+    int already_loaded;            /**< 计划时已加载 / Already loaded when planned / Bei der Planung bereits geladen */
+    int64_t load_us;               /**< 加载耗时（微秒） / Load time (microseconds) / Ladezeit (Mikrosekunden) */
+    int64_t resolve_us;            /**< 符号解析耗时（微秒） / Symbol resolution time (microseconds) / Symbolauflösungszeit (Mikrosekunden) */
+} preload_plugin_t;
+    
+/**
+ * @brief 预加载计划 / Preload plan / Vorladeplan
+ */
+typedef struct {
+    preload_plugin_t* plugins;     /**< 待预加载插件（按规则顺序） / Plugins to preload (in rule order) / Vorzuladende Plugins (in Regelreihenfolge) */
+    size_t count;                  /**< 插件数量 / Plugin count / Plugin-Anzahl */
+    size_t capacity;               /**< 插件数组容量 / Plugin array capacity / Kapazität des Plugin-Arrays */
+    int bind_now;                  /**< 立即绑定所有符号 / Bind all symbols immediately / Alle Symbole sofort binden */
+    volatile int next;             /**< 下一个待领取的插件 / Next plugin to claim / Nächstes zu beanspruchendes Plugin */
+    int64_t start_us;              /**< 开始时间 / Start time / Startzeit */
+} preload_plan_t;
+    
+/**
+ * @brief 从当前规则集构建预加载计划（调用线程读取规则） / Build preload plan from the current rule set (rules are read on the calling thread) / Vorladeplan aus dem aktuellen Regelsatz erstellen (Regeln werden im aufrufenden Thread gelesen)
+ * @param plan 输出计划 / Output plan / Ausgabeplan
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int build_preload_plan(preload_plan_t* plan);
+    
+/**
+ * @brief 释放预加载计划 / Free preload plan / Vorladeplan freigeben
+ * @param plan 计划 / Plan / Plan
+ */
+void free_preload_plan(preload_plan_t* plan);
+    
+/**
+ * @brief 执行预加载计划：并发加载和解析，再安装到上下文 / Run preload plan: load and resolve concurrently, then install into the context / Vorladeplan ausführen: parallel laden und auflösen, dann in den Kontext übernehmen
+ * @param plan 计划 / Plan / Plan
+ */
+void run_preload_plan(preload_plan_t* plan);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POINTER_TRANSFER_PLUGIN_LOADER_PRELOAD_H */
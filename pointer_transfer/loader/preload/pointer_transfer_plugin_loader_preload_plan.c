@@ -0,0 +1,137 @@
+/**
+ * @file loader/preload/pointer_transfer_plugin_loader_preload_plan.c
+ * @brief 插件预加载计划实现 / Plugin Preload Plan Implementation / Plugin-Vorladeplan-Implementierung
+ */
+
+#include "pointer_transfer_plugin_loader_preload.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 查找或添加计划中的插件 / Find or add plugin in plan / Plugin im Plan suchen oder hinzufügen
+ */
+static preload_plugin_t* find_or_add_preload_plugin(preload_plan_t* plan, const char* plugin_name, const char* plugin_path) {
+    for (size_t i = 0; i < plan->count; i++) {
+        if (strcmp(plan->plugins[i].plugin_name, plugin_name) == 0) {
+            return &plan->plugins[i];
+        }
+    }
+    
+    if (plan->count >= plan->capacity) {
+        size_t new_capacity = plan->capacity == 0 ? 8 : plan->capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < plan->capacity || new_capacity > SIZE_MAX / sizeof(preload_plugin_t)) {
+            return NULL;
+        }
+        preload_plugin_t* new_plugins = (preload_plugin_t*)realloc(plan->plugins, new_capacity * sizeof(preload_plugin_t));
+        if (new_plugins == NULL) {
+            return NULL;
+        }
+        plan->plugins = new_plugins;
+        plan->capacity = new_capacity;
+    }
+    
+    preload_plugin_t* plugin = &plan->plugins[plan->count];
+    memset(plugin, 0, sizeof(preload_plugin_t));
+    plugin->plugin_name = allocate_string(plugin_name);
+    plugin->plugin_path = allocate_string(plugin_path);
+    if (plugin->plugin_name == NULL || plugin->plugin_path == NULL) {
+        free(plugin->plugin_name);
+        free(plugin->plugin_path);
+        return NULL;
+    }
+    plan->count++;
+    return plugin;
+}
+
+/**
+ * @brief 添加插件接口（去重） / Add plugin interface (deduplicated) / Plugin-Schnittstelle hinzufügen (dedupliziert)
+ */
+static int add_preload_symbol(preload_plugin_t* plugin, const char* interface_name) {
+    for (size_t i = 0; i < plugin->symbol_count; i++) {
+        if (strcmp(plugin->symbols[i].interface_name, interface_name) == 0) {
+            return 0;
+        }
+    }
+    
+    if (plugin->symbol_count >= plugin->symbol_capacity) {
+        size_t new_capacity = plugin->symbol_capacity == 0 ? 4 : plugin->symbol_capacity * CAPACITY_GROWTH_FACTOR;
+        if (new_capacity < plugin->symbol_capacity || new_capacity > SIZE_MAX / sizeof(preload_symbol_t)) {
+            return -1;
+        }
+        preload_symbol_t* new_symbols = (preload_symbol_t*)realloc(plugin->symbols, new_capacity * sizeof(preload_symbol_t));
+        if (new_symbols == NULL) {
+            return -1;
+        }
+        plugin->symbols = new_symbols;
+        plugin->symbol_capacity = new_capacity;
+    }
+    
+    preload_symbol_t* symbol = &plugin->symbols[plugin->symbol_count];
+    symbol->interface_name = allocate_string(interface_name);
+    symbol->func_ptr = NULL;
+    if (symbol->interface_name == NULL) {
+        return -1;
+    }
+    plugin->symbol_count++;
+    return 0;
+}
+
+/**
+ * @brief 从当前规则集构建预加载计划 / Build preload plan from the current rule set / Vorladeplan aus dem aktuellen Regelsatz erstellen
+ * @details 字符串被复制，预加载期间的规则重载不影响计划 / Strings are copied so a rule reload during preloading does not affect the plan / Zeichenfolgen werden kopiert, damit ein Neuladen der Regeln während des Vorladens den Plan nicht beeinflusst
+ */
+int build_preload_plan(preload_plan_t* plan) {
+    if (plan == NULL) {
+        return -1;
+    }
+    
+    memset(plan, 0, sizeof(preload_plan_t));
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL) {
+        return -1;
+    }
+    plan->bind_now = ctx->preload_bind_now;
+    
+    for (size_t i = 0; i < ctx->rule_count; i++) {
+        const pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (!rule->enabled || rule->target_plugin == NULL || rule->target_interface == NULL ||
+            rule->target_plugin_path == NULL || rule->target_plugin_path[0] == '\0') {
+            continue;
+        }
+        
+        preload_plugin_t* plugin = find_or_add_preload_plugin(plan, rule->target_plugin, rule->target_plugin_path);
+        if (plugin == NULL || add_preload_symbol(plugin, rule->target_interface) != 0) {
+            free_preload_plan(plan);
+            return -1;
+        }
+        if (plugin->handle == NULL) {
+            plugin->handle = find_loaded_plugin(ctx, rule->target_plugin);
+            plugin->already_loaded = plugin->handle != NULL;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 释放预加载计划 / Free preload plan / Vorladeplan freigeben
+ */
+void free_preload_plan(preload_plan_t* plan) {
+    if (plan == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < plan->count; i++) {
+        preload_plugin_t* plugin = &plan->plugins[i];
+        for (size_t j = 0; j < plugin->symbol_count; j++) {
+            free(plugin->symbols[j].interface_name);
+        }
+        free(plugin->symbols);
+        free(plugin->plugin_name);
+        free(plugin->plugin_path);
+    }
+    free(plan->plugins);
+    memset(plan, 0, sizeof(preload_plan_t));
+}
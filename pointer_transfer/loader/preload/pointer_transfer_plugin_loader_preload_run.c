@@ -0,0 +1,145 @@
+/**
+ * @file loader/preload/pointer_transfer_plugin_loader_preload_run.c
+ * @brief 插件预加载执行实现 / Plugin Preload Execution Implementation / Plugin-Vorlade-Ausführung-Implementierung
+ */
+
+#include "pointer_transfer_plugin_loader_preload.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+
+/**
+ * @brief 加载单个插件并解析其接口符号 / Load single plugin and resolve its interface symbols / Einzelnes Plugin laden und seine Schnittstellensymbole auflösen
+ * @details 只调用线程安全的平台函数，不访问上下文 / Only calls thread-safe platform functions and does not touch the context / Ruft nur threadsichere Plattformfunktionen auf und greift nicht auf den Kontext zu
+ */
+static void preload_single_plugin(preload_plugin_t* plugin, int bind_now) {
+    int64_t start_us = pt_platform_get_monotonic_us();
+    if (plugin->handle == NULL) {
+        plugin->handle = bind_now ? pt_platform_load_library_bind_now(plugin->plugin_path)
+                                  : pt_platform_load_library(plugin->plugin_path);
+    }
+    int64_t loaded_us = pt_platform_get_monotonic_us();
+    plugin->load_us = loaded_us - start_us;
+    if (plugin->handle == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < plugin->symbol_count; i++) {
+        plugin->symbols[i].func_ptr = pt_platform_get_symbol(plugin->handle, plugin->symbols[i].interface_name);
+    }
+    plugin->resolve_us = pt_platform_get_monotonic_us() - loaded_us;
+}
+
+/**
+ * @brief 工作线程：领取插件直到计划完成 / Worker thread: claim plugins until the plan is done / Arbeitsthread: Plugins beanspruchen, bis der Plan fertig ist
+ */
+static void preload_worker(void* arg) {
+    preload_plan_t* plan = (preload_plan_t*)arg;
+    for (;;) {
+        int index = pt_platform_atomic_fetch_add_int(&plan->next, 1);
+        if (index < 0 || (size_t)index >= plan->count) {
+            break;
+        }
+        preload_single_plugin(&plan->plugins[index], plan->bind_now);
+    }
+}
+
+/**
+ * @brief 注册插件并构建接口状态，输出计时报告 / Register plugin and build interface states, report timing / Plugin registrieren, Schnittstellenstatus aufbauen und Zeiten melden
+ * @return 插件可用返回1，否则返回0 / Returns 1 if the plugin is usable, 0 otherwise / Gibt 1 zurück, wenn das Plugin nutzbar ist, sonst 0
+ */
+static int install_preloaded_plugin(pointer_transfer_context_t* ctx, preload_plugin_t* plugin) {
+    if (plugin->handle == NULL) {
+        internal_log_write("WARNING", "Preload: failed to load target plugin %s from %s", plugin->plugin_name, plugin->plugin_path);
+        return 0;
+    }
+    
+    int64_t start_us = pt_platform_get_monotonic_us();
+    if (!plugin->already_loaded) {
+        if (register_loaded_plugin(ctx, plugin->plugin_name, plugin->plugin_path, plugin->handle) != 0) {
+            pt_platform_close_library(plugin->handle);
+            plugin->handle = NULL;
+            return 0;
+        }
+    }
+    
+    plugin_registry_entry_t* entry = find_plugin_registry_entry(plugin->plugin_name);
+    if (entry != NULL && !plugin->already_loaded) {
+        entry->load_us = plugin->load_us;
+    }
+    
+    size_t resolved_count = 0;
+    size_t state_count = 0;
+    for (size_t i = 0; i < plugin->symbol_count; i++) {
+        preload_symbol_t* symbol = &plugin->symbols[i];
+        if (symbol->func_ptr == NULL) {
+            internal_log_write("WARNING", "Preload: function %s not found in plugin %s", symbol->interface_name, plugin->plugin_name);
+            continue;
+        }
+        resolved_count++;
+        cache_plugin_registry_symbol(entry, symbol->interface_name, symbol->func_ptr);
+        target_interface_state_t* state = find_or_create_interface_state(plugin->plugin_name, symbol->interface_name, plugin->handle, symbol->func_ptr);
+        if (state != NULL) {
+            state_count++;
+            /* 引用的接口进入后台验证计划，原生接口只需检查调用计划 / Referenced interfaces join the background validation plan, native interfaces only need their call plan checked / Referenzierte Schnittstellen kommen in den Hintergrund-Validierungsplan, native Schnittstellen brauchen nur die Prüfung ihres Aufrufplans */
+            if (ctx->enable_validation && !state->validation_done && state->call_convention != NXLD_CALL_CONVENTION_NATIVE) {
+                add_interface_validation_job(state, plugin->plugin_path);
+            }
+        }
+    }
+    
+    internal_log_write("INFO", "Preloaded plugin %s: load %lld us%s, resolve %lld us, states %lld us, %zu/%zu symbols, %zu interface states",
+                      plugin->plugin_name, (long long)plugin->load_us, plugin->already_loaded ? " (already loaded)" : "",
+                      (long long)plugin->resolve_us, (long long)(pt_platform_get_monotonic_us() - start_us),
+                      resolved_count, plugin->symbol_count, state_count);
+    return 1;
+}
+
+/**
+ * @brief 执行预加载计划 / Run preload plan / Vorladeplan ausführen
+ * @details 加载和符号解析在线程池中并发进行；注册和接口状态在本线程按规则顺序构建 / Loading and symbol resolution run concurrently on the pool; registration and interface states are built on this thread in rule order / Laden und Symbolauflösung laufen parallel im Pool; Registrierung und Schnittstellenstatus werden in diesem Thread in Regelreihenfolge aufgebaut
+ */
+void run_preload_plan(preload_plan_t* plan) {
+    if (plan == NULL || plan->count == 0) {
+        return;
+    }
+    
+    size_t worker_count = (size_t)pt_platform_get_cpu_count();
+    if (worker_count > PRELOAD_MAX_WORKERS) {
+        worker_count = PRELOAD_MAX_WORKERS;
+    }
+    if (worker_count > plan->count) {
+        worker_count = plan->count;
+    }
+    
+    pt_platform_thread_t* threads[PRELOAD_MAX_WORKERS];
+    size_t started = 0;
+    for (size_t i = 1; i < worker_count; i++) {
+        threads[started] = pt_platform_thread_create(preload_worker, plan);
+        if (threads[started] == NULL) {
+            break;
+        }
+        started++;
+    }
+    preload_worker(plan);
+    for (size_t i = 0; i < started; i++) {
+        pt_platform_thread_join(threads[i]);
+    }
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    size_t ready_count = 0;
+    for (size_t i = 0; i < plan->count; i++) {
+        ready_count += (size_t)install_preloaded_plugin(ctx, &plan->plugins[i]);
+    }
+    
+    internal_log_write("INFO", "Plugin preload ready: %zu/%zu plugins in %lld ms with %zu threads%s",
+                      ready_count, plan->count, (long long)((pt_platform_get_monotonic_us() - plan->start_us) / 1000),
+                      started + 1, plan->bind_now ? ", symbols bound immediately" : "");
+    
+    /* 预加载就绪后验证在后台继续，不阻塞调用 / Validation continues in the background after preloading is ready and does not block calls / Die Validierung läuft nach dem Vorladen im Hintergrund weiter und blockiert keine Aufrufe */
+    if (ctx->enable_validation) {
+        start_interface_validation();
+    }
+}
@@ -0,0 +1,91 @@
+/**
+ * @file loader/preload/pointer_transfer_plugin_loader_preload_start.c
+ * @brief 后台插件预加载启动和就绪屏障 / Background Plugin Preload Start and Readiness Barrier / Start des Hintergrund-Vorladens und Bereitschaftsbarriere
+ */
+
+#include "pointer_transfer_plugin_loader_preload.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "pointer_transfer_utils.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 预加载协调线程 / Preload coordinator thread / Vorlade-Koordinationsthread */
+static pt_platform_thread_t* g_preload_thread = NULL;
+
+/* 预加载进行中标志（调用路径的快速检查） / Preload in progress flag (fast check on the call path) / Vorladen-läuft-Flag (schnelle Prüfung im Aufrufpfad) */
+static volatile int g_preload_active = 0;
+
+/* 保护协调线程句柄的互斥锁，进程生命周期内保留 / Mutex guarding the coordinator handle, kept for the process lifetime / Mutex für das Koordinations-Handle, bleibt für die Prozesslebensdauer */
+static pt_platform_mutex_t* g_preload_mutex = NULL;
+
+/* 正在执行的计划 / Plan being executed / Ausgeführter Plan */
+static preload_plan_t g_preload_plan;
+
+/**
+ * @brief 协调线程主函数 / Coordinator thread main function / Hauptfunktion des Koordinationsthreads
+ */
+static void preload_thread_main(void* arg) {
+    run_preload_plan((preload_plan_t*)arg);
+}
+
+/**
+ * @brief 启动后台插件预加载（Preload=1时） / Start background plugin preloading (when Preload=1) / Hintergrund-Plugin-Vorladen starten (bei Preload=1)
+ * @details 在规则加载完成后调用；计划在调用线程构建 / Call after rules are loaded; the plan is built on the calling thread / Nach dem Laden der Regeln aufrufen; der Plan wird im aufrufenden Thread erstellt
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int start_plugin_preload(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    if (ctx == NULL || !ctx->preload_plugins || pt_platform_atomic_load_int(&g_preload_active)) {
+        return 0;
+    }
+    
+    if (build_preload_plan(&g_preload_plan) != 0) {
+        internal_log_write("ERROR", "start_plugin_preload: failed to build preload plan");
+        return -1;
+    }
+    if (g_preload_plan.count == 0) {
+        free_preload_plan(&g_preload_plan);
+        return 0;
+    }
+    g_preload_plan.start_us = pt_platform_get_monotonic_us();
+    internal_log_write("INFO", "Preloading %zu target plugins in background", g_preload_plan.count);
+    
+    if (g_preload_mutex == NULL) {
+        g_preload_mutex = pt_platform_mutex_create();
+    }
+    if (g_preload_mutex != NULL) {
+        pt_platform_atomic_store_int(&g_preload_active, 1);
+        g_preload_thread = pt_platform_thread_create(preload_thread_main, &g_preload_plan);
+        if (g_preload_thread != NULL) {
+            return 0;
+        }
+        pt_platform_atomic_store_int(&g_preload_active, 0);
+    }
+    
+    /* 无法启动后台线程时同步预加载 / Preload synchronously when no background thread can be started / Synchron vorladen, wenn kein Hintergrundthread gestartet werden kann */
+    internal_log_write("WARNING", "start_plugin_preload: failed to create preload thread, preloading synchronously");
+    run_preload_plan(&g_preload_plan);
+    free_preload_plan(&g_preload_plan);
+    return 0;
+}
+
+/**
+ * @brief 等待预加载完成（就绪屏障） / Wait for preloading to finish (readiness barrier) / Auf Abschluss des Vorladens warten (Bereitschaftsbarriere)
+ * @details 未在预加载时只做一次原子读取 / Costs a single atomic read when no preload is running / Kostet nur einen atomaren Lesezugriff, wenn kein Vorladen läuft
+ */
+void wait_for_plugin_preload(void) {
+    if (!pt_platform_atomic_load_int(&g_preload_active)) {
+        return;
+    }
+    
+    pt_platform_mutex_lock(g_preload_mutex);
+    if (g_preload_thread != NULL) {
+        pt_platform_thread_join(g_preload_thread);
+        g_preload_thread = NULL;
+        free_preload_plan(&g_preload_plan);
+        pt_platform_atomic_store_int(&g_preload_active, 0);
+    }
+    pt_platform_mutex_unlock(g_preload_mutex);
+}
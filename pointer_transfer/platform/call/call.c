@@ -13,13 +13,13 @@ extern int32_t pt_call_validate_params(void* func_ptr, int param_count, nxld_par
                                         pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct);
 
 extern int32_t pt_call_execute_function(void* func_ptr, int param_count, nxld_param_type_t* param_types, void** param_values, size_t* param_sizes,
-                                         pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct);
+                                         const int* param_borrowed, uint32_t pack_version, pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct);
 
 /**
  * @brief 平台函数调用 / Platform function call / Plattform-Funktionsaufruf
  */
 int32_t pt_platform_safe_call(void* func_ptr, int param_count, void* param_types, void** param_values, void* param_sizes,
-                               pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct) {
+                               const int* param_borrowed, uint32_t pack_version, pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct) {
     nxld_param_type_t* types = (nxld_param_type_t*)param_types;
     size_t* sizes = (size_t*)param_sizes;
     
@@ -29,6 +29,17 @@ int32_t pt_platform_safe_call(void* func_ptr, int param_count, void* param_types
     }
     
     return pt_call_execute_function(func_ptr, param_count, types, param_values, sizes,
-                                    return_type, return_size, result_int, result_float, result_struct);
+                                    param_borrowed, pack_version, return_type, return_size, result_int, result_float, result_struct);
 }
 
+/**
+ * @brief 调用批量接口 / Call batch interface / Batch-Schnittstelle aufrufen
+ */
+int32_t pt_platform_vector_call(void* func_ptr, const void* batch) {
+    if (func_ptr == NULL || batch == NULL) {
+        return -1;
+    }
+    
+    typedef int32_t (NXLD_PLUGIN_CALL *vector_call_func)(const void*);
+    return ((vector_call_func)func_ptr)(batch);
+}
@@ -17,6 +17,8 @@
  * @param param_types 参数类型数组 / Parameter types array / Parametertyp-Array
  * @param param_values 参数值数组 / Parameter values array / Parameterwerte-Array
  * @param param_sizes 参数大小数组 / Parameter sizes array / Parametergrößen-Array
+ * @param param_borrowed 参数借用标志数组，可为NULL；置位的结构体参数直接传递原指针 / Parameter borrow flags array, can be NULL; flagged struct parameters pass the original pointer / Parameter-Ausleih-Flag-Array, kann NULL sein; markierte Strukturparameter übergeben den Originalzeiger
+ * @param pack_version 插件接受的参数包版本 / Parameter pack version accepted by the plugin / Vom Plugin akzeptierte Parameterpaket-Version
  * @param return_type 返回值类型 / Return value type / Rückgabewerttyp
  * @param return_size 返回值大小 / Return value size / Rückgabewertgröße
  * @param result_int 输出整数返回值指针 / Output integer return value pointer / Ausgabe-Integer-Rückgabewert-Zeiger
@@ -25,7 +27,7 @@
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
 int32_t pt_call_execute_function(void* func_ptr, int param_count, nxld_param_type_t* param_types, void** param_values, size_t* param_sizes,
-                                 pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct) {
+                                 const int* param_borrowed, uint32_t pack_version, pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct) {
     pt_param_pack_t* pack = pt_create_param_pack(param_count, param_types, param_values, param_sizes);
     if (pack == NULL) {
         return -1;
@@ -36,7 +38,7 @@ int32_t pt_call_execute_function(void* func_ptr, int param_count, nxld_param_typ
         return -1;
     }
     
-    int32_t result = pt_call_with_currying(func_ptr, pack, return_type, return_size, result_int, result_float, result_struct);
+    int32_t result = pt_call_with_currying(func_ptr, pack, param_borrowed, pack_version, return_type, return_size, result_int, result_float, result_struct);
     
     pt_free_param_pack(pack);
     return result;
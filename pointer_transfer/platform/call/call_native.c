@@ -0,0 +1,231 @@
+/**
+ * @file call_native.c
+ * @brief 按原生C签名调用插件接口 / Call plugin interfaces with their native C signature / Plugin-Schnittstellen mit ihrer nativen C-Signatur aufrufen
+ * @details 参数直接装入寄存器和栈槽，不创建参数包 / Arguments go straight into registers and stack slots, no parameter pack is built / Argumente werden direkt in Register und Stack-Slots geladen, es wird kein Parameterpaket erstellt
+ */
+
+#include "pointer_transfer_platform.h"
+#include "nxld_plugin_interface.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* System V x86-64 ABI的参数寄存器数量 / Argument register counts of the System V x86-64 ABI / Anzahl der Argumentregister im System-V-x86-64-ABI */
+#define NATIVE_INT_REGISTERS 6
+#define NATIVE_SSE_REGISTERS 8
+#define NATIVE_STACK_SLOTS (PT_NATIVE_CALL_MAX_PARAMS - NATIVE_INT_REGISTERS - NATIVE_SSE_REGISTERS)
+
+/**
+ * @brief 取参数的寄存器类别 / Get the register class of a parameter / Registerklasse eines Parameters abrufen
+ * @return 整数类返回PT_NATIVE_ARG_INT，浮点类返回PT_NATIVE_ARG_SSE，无法原生传递返回-1 / Returns PT_NATIVE_ARG_INT for the integer class, PT_NATIVE_ARG_SSE for the floating-point class, -1 if it cannot be passed natively / Gibt PT_NATIVE_ARG_INT für die Ganzzahlklasse, PT_NATIVE_ARG_SSE für die Gleitkommaklasse zurück, -1 wenn nicht nativ übergebbar
+ */
+static int native_param_class(nxld_param_type_t param_type) {
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_INT64:
+        case NXLD_PARAM_TYPE_CHAR:
+        case NXLD_PARAM_TYPE_POINTER:
+        case NXLD_PARAM_TYPE_STRING:
+            return PT_NATIVE_ARG_INT;
+        case NXLD_PARAM_TYPE_FLOAT:
+        case NXLD_PARAM_TYPE_DOUBLE:
+            return PT_NATIVE_ARG_SSE;
+        default:
+            return -1;
+    }
+}
+
+/**
+ * @brief 按声明的签名计算原生调用计划 / Compute the native call plan from the declared signature / Plan für native Aufrufe aus der deklarierten Signatur berechnen
+ * @param param_count 参数数量 / Parameter count / Parameteranzahl
+ * @param param_types 参数类型数组 / Parameter types array / Parametertyp-Array
+ * @param return_type 声明的返回值类型 / Declared return type / Deklarierter Rückgabetyp
+ * @param plan 输出调用计划 / Output call plan / Ausgabe-Aufrufplan
+ * @return 可原生调用返回0，平台或签名不支持返回-1，所需栈槽超过原型可传递的数量返回PT_NATIVE_CALL_STACK_OVERFLOW / Returns 0 if the signature can be called natively, -1 if the platform or signature is unsupported, PT_NATIVE_CALL_STACK_OVERFLOW if it needs more stack slots than the prototype passes / Gibt 0 zurück, wenn die Signatur nativ aufrufbar ist, -1 wenn Plattform oder Signatur nicht unterstützt werden, PT_NATIVE_CALL_STACK_OVERFLOW wenn sie mehr Stack-Slots braucht als der Prototyp übergibt
+ * @note 仅支持标量、指针和字符串参数；可变参数、按值结构体返回不支持 / Only scalar, pointer and string parameters are supported; variadic parameters and struct-by-value returns are not / Nur Skalar-, Zeiger- und Zeichenfolgenparameter werden unterstützt; variable Parameter und Strukturrückgaben per Wert nicht
+ */
+int32_t pt_platform_prepare_native_call(int param_count, const nxld_param_type_t* param_types, nxld_return_type_t return_type,
+                                        pt_native_call_plan_t* plan) {
+    if (plan == NULL) {
+        return -1;
+    }
+    memset(plan, 0, sizeof(pt_native_call_plan_t));
+#if defined(__x86_64__) && !defined(_WIN32)
+    if (param_count < 0 || param_count > PT_NATIVE_CALL_MAX_PARAMS || (param_count > 0 && param_types == NULL) ||
+        return_type == NXLD_RETURN_TYPE_STRUCT || return_type > NXLD_RETURN_TYPE_STRUCT) {
+        return -1;
+    }
+    
+    /* 先按整个签名统计所需栈槽，超出时拒绝调用，不能截断多余参数 / Count the stack slots the whole signature needs first and refuse the call when they exceed the limit, extra arguments must never be truncated / Zuerst die von der ganzen Signatur benötigten Stack-Slots zählen und den Aufruf bei Überschreitung ablehnen, überzählige Argumente dürfen nie abgeschnitten werden */
+    int int_count = 0;
+    int sse_count = 0;
+    for (int i = 0; i < param_count; i++) {
+        int arg_class = native_param_class(param_types[i]);
+        if (arg_class < 0) {
+            return -1;
+        }
+        if (arg_class == PT_NATIVE_ARG_INT) {
+            int_count++;
+        } else {
+            sse_count++;
+        }
+    }
+    int stack_needed = (int_count > NATIVE_INT_REGISTERS ? int_count - NATIVE_INT_REGISTERS : 0) +
+                       (sse_count > NATIVE_SSE_REGISTERS ? sse_count - NATIVE_SSE_REGISTERS : 0);
+    if (stack_needed > NATIVE_STACK_SLOTS) {
+        return PT_NATIVE_CALL_STACK_OVERFLOW;
+    }
+    
+    int int_used = 0;
+    int sse_used = 0;
+    int stack_used = 0;
+    for (int i = 0; i < param_count; i++) {
+        int arg_class = native_param_class(param_types[i]);
+        /* 寄存器用完后两类参数都按参数顺序溢出到栈 / Once registers run out both classes spill to the stack in parameter order / Sind die Register belegt, laufen beide Klassen in Parameterreihenfolge auf den Stack über */
+        if (arg_class == PT_NATIVE_ARG_INT && int_used < NATIVE_INT_REGISTERS) {
+            plan->arg_slot[i] = (uint8_t)int_used++;
+        } else if (arg_class == PT_NATIVE_ARG_SSE && sse_used < NATIVE_SSE_REGISTERS) {
+            plan->arg_slot[i] = (uint8_t)sse_used++;
+        } else {
+            arg_class = PT_NATIVE_ARG_STACK;
+            plan->arg_slot[i] = (uint8_t)stack_used++;
+        }
+        plan->arg_class[i] = (uint8_t)arg_class;
+    }
+    
+    plan->param_count = param_count;
+    plan->return_type = return_type;
+    plan->valid = 1;
+    return 0;
+#else
+    /* 其他ABI尚未实现，接口改用参数包约定 / Other ABIs are not implemented, interfaces must use the pack convention / Andere ABIs sind nicht implementiert, Schnittstellen müssen die Paketkonvention verwenden */
+    (void)param_count;
+    (void)param_types;
+    (void)return_type;
+    return -1;
+#endif
+}
+
+#if defined(__x86_64__) && !defined(_WIN32)
+/*
+ * 每种返回类别一个通用原型：6个整数寄存器、8个SSE寄存器、8个栈槽全部传递。
+ * System V ABI中调用者清理栈且被调用者忽略多余的寄存器和栈参数，所以任何受支持的签名都可以用同一原型调用。
+ * One universal prototype per return class passes all 6 integer registers, 8 SSE registers and 8 stack slots.
+ * Under the System V ABI the caller cleans the stack and the callee ignores surplus registers and stack arguments, so every supported signature can be called through the same prototype.
+ * Ein universeller Prototyp je Rückgabeklasse übergibt alle 6 Ganzzahlregister, 8 SSE-Register und 8 Stack-Slots.
+ * Im System-V-ABI räumt der Aufrufer den Stack auf und der Aufgerufene ignoriert überzählige Register und Stack-Argumente, daher lässt sich jede unterstützte Signatur über denselben Prototyp aufrufen.
+ */
+#define NATIVE_PROTOTYPE_ARGS int64_t, int64_t, int64_t, int64_t, int64_t, int64_t, \
+                              double, double, double, double, double, double, double, double, \
+                              int64_t, int64_t, int64_t, int64_t, int64_t, int64_t, int64_t, int64_t
+#define NATIVE_CALL_ARGS(i, d, s) i[0], i[1], i[2], i[3], i[4], i[5], \
+                                  d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7], \
+                                  s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7]
+
+typedef int64_t (*native_int_func_t)(NATIVE_PROTOTYPE_ARGS);
+typedef double (*native_double_func_t)(NATIVE_PROTOTYPE_ARGS);
+typedef float (*native_float_func_t)(NATIVE_PROTOTYPE_ARGS);
+
+/**
+ * @brief 读取参数的64位原始位模式 / Read the 64-bit raw bit pattern of a parameter / 64-Bit-Rohbitmuster eines Parameters lesen
+ * @details float只占低32位，SSE寄存器和栈槽都按此读取 / A float only occupies the low 32 bits, as both SSE registers and stack slots read it / Ein float belegt nur die unteren 32 Bits, so lesen ihn SSE-Register und Stack-Slots
+ */
+static int64_t read_native_arg_bits(nxld_param_type_t param_type, const void* value) {
+    int64_t bits = 0;
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+            return value != NULL ? (int64_t)*(const int32_t*)value : 0;
+        case NXLD_PARAM_TYPE_INT64:
+            return value != NULL ? *(const int64_t*)value : 0;
+        case NXLD_PARAM_TYPE_CHAR:
+            return value != NULL ? (int64_t)*(const char*)value : 0;
+        case NXLD_PARAM_TYPE_FLOAT:
+            if (value != NULL) {
+                memcpy(&bits, value, sizeof(float));
+            }
+            return bits;
+        case NXLD_PARAM_TYPE_DOUBLE:
+            if (value != NULL) {
+                memcpy(&bits, value, sizeof(double));
+            }
+            return bits;
+        default:
+            /* 指针和字符串按地址本身传递 / Pointers and strings pass the address itself / Zeiger und Zeichenfolgen übergeben die Adresse selbst */
+            return (int64_t)(intptr_t)value;
+    }
+}
+#endif
+
+/**
+ * @brief 按原生调用计划调用函数 / Call a function through its native call plan / Funktion über ihren Plan für native Aufrufe aufrufen
+ * @param func_ptr 函数指针 / Function pointer / Funktionszeiger
+ * @param plan 调用计划 / Call plan / Aufrufplan
+ * @param param_types 参数类型数组 / Parameter types array / Parametertyp-Array
+ * @param param_values 参数值数组（标量指向值，指针和字符串即值本身） / Parameter values array (scalars point to the value, pointers and strings are the value) / Parameterwerte-Array (Skalare zeigen auf den Wert, Zeiger und Zeichenfolgen sind der Wert)
+ * @param result_int 输出整数返回值指针 / Output integer return value pointer / Ausgabe-Integer-Rückgabewert-Zeiger
+ * @param result_float 输出浮点返回值指针 / Output floating-point return value pointer / Ausgabe-Gleitkomma-Rückgabewert-Zeiger
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_native_call(void* func_ptr, const pt_native_call_plan_t* plan, const nxld_param_type_t* param_types,
+                                void* const* param_values, int64_t* result_int, double* result_float) {
+    if (func_ptr == NULL || plan == NULL || !plan->valid || result_int == NULL || result_float == NULL ||
+        (plan->param_count > 0 && (param_types == NULL || param_values == NULL))) {
+        return -1;
+    }
+    *result_int = 0;
+    *result_float = 0.0;
+#if defined(__x86_64__) && !defined(_WIN32)
+    int64_t int_args[NATIVE_INT_REGISTERS] = {0};
+    double sse_args[NATIVE_SSE_REGISTERS] = {0.0};
+    int64_t stack_args[NATIVE_STACK_SLOTS] = {0};
+    if (plan->param_count < 0 || plan->param_count > PT_NATIVE_CALL_MAX_PARAMS) {
+        return -1;
+    }
+    for (int i = 0; i < plan->param_count; i++) {
+        int64_t bits = read_native_arg_bits(param_types[i], param_values[i]);
+        /* 越界的槽位说明计划已损坏，拒绝调用而不是丢弃参数 / An out-of-range slot means the plan is corrupt, refuse the call instead of dropping the argument / Ein Slot außerhalb des Bereichs bedeutet einen beschädigten Plan, Aufruf ablehnen statt das Argument zu verwerfen */
+        switch (plan->arg_class[i]) {
+            case PT_NATIVE_ARG_INT:
+                if (plan->arg_slot[i] >= NATIVE_INT_REGISTERS) {
+                    return -1;
+                }
+                int_args[plan->arg_slot[i]] = bits;
+                break;
+            case PT_NATIVE_ARG_SSE:
+                if (plan->arg_slot[i] >= NATIVE_SSE_REGISTERS) {
+                    return -1;
+                }
+                memcpy(&sse_args[plan->arg_slot[i]], &bits, sizeof(double));
+                break;
+            default:
+                if (plan->arg_slot[i] >= NATIVE_STACK_SLOTS) {
+                    return -1;
+                }
+                stack_args[plan->arg_slot[i]] = bits;
+                break;
+        }
+    }
+    
+    switch (plan->return_type) {
+        case NXLD_RETURN_TYPE_FLOAT:
+            *result_float = (double)((native_float_func_t)func_ptr)(NATIVE_CALL_ARGS(int_args, sse_args, stack_args));
+            break;
+        case NXLD_RETURN_TYPE_DOUBLE:
+            *result_float = ((native_double_func_t)func_ptr)(NATIVE_CALL_ARGS(int_args, sse_args, stack_args));
+            break;
+        case NXLD_RETURN_TYPE_INT32:
+            /* int32返回值时RAX高32位未定义 / The upper 32 bits of RAX are undefined for int32 returns / Bei int32-Rückgaben sind die oberen 32 Bits von RAX undefiniert */
+            *result_int = (int64_t)(int32_t)((native_int_func_t)func_ptr)(NATIVE_CALL_ARGS(int_args, sse_args, stack_args));
+            break;
+        case NXLD_RETURN_TYPE_VOID:
+            ((native_int_func_t)func_ptr)(NATIVE_CALL_ARGS(int_args, sse_args, stack_args));
+            break;
+        default:
+            *result_int = ((native_int_func_t)func_ptr)(NATIVE_CALL_ARGS(int_args, sse_args, stack_args));
+            break;
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
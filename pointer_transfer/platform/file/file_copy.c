@@ -0,0 +1,74 @@
+/**
+ * @file file_copy.c
+ * @brief 文件复制 / File copy / Datei kopieren
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/* 复制缓冲区大小 / Copy buffer size / Größe des Kopierpuffers */
+#define PT_FILE_COPY_BUFFER_SIZE 65536
+
+/**
+ * @brief 复制文件，覆盖已存在的目标 / Copy file, overwriting an existing target / Datei kopieren, vorhandenes Ziel überschreiben
+ * @param source_path 源文件路径 / Source file path / Quelldateipfad
+ * @param target_path 目标文件路径 / Target file path / Zieldateipfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_copy_file(const char* source_path, const char* target_path) {
+    if (source_path == NULL || target_path == NULL) {
+        return -1;
+    }
+    
+#ifdef _WIN32
+    if (!CopyFileA(source_path, target_path, FALSE)) {
+        return -1;
+    }
+    return 0;
+#else
+    char* buffer = (char*)malloc(PT_FILE_COPY_BUFFER_SIZE);
+    if (buffer == NULL) {
+        return -1;
+    }
+    FILE* source = fopen(source_path, "rb");
+    if (source == NULL) {
+        free(buffer);
+        return -1;
+    }
+    FILE* target = fopen(target_path, "wb");
+    if (target == NULL) {
+        fclose(source);
+        free(buffer);
+        return -1;
+    }
+    
+    int32_t result = 0;
+    size_t read_size;
+    while ((read_size = fread(buffer, 1, PT_FILE_COPY_BUFFER_SIZE, source)) > 0) {
+        if (fwrite(buffer, 1, read_size, target) != read_size) {
+            result = -1;
+            break;
+        }
+    }
+    if (ferror(source)) {
+        result = -1;
+    }
+    
+    free(buffer);
+    fclose(source);
+    if (fclose(target) != 0) {
+        result = -1;
+    }
+    if (result != 0) {
+        remove(target_path);
+    }
+    return result;
+#endif
+}
@@ -0,0 +1,156 @@
+/**
+ * @file file_map.c
+ * @brief 只读文件映射 / Read-only file mapping / Schreibgeschützte Dateizuordnung
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief 平台文件映射结构体 / Platform file mapping structure / Plattform-Dateizuordnungsstruktur
+ */
+struct pt_platform_file_map_s {
+    const void* data;              /**< 映射数据（空文件为NULL） / Mapped data (NULL for empty files) / Zugeordnete Daten (NULL bei leeren Dateien) */
+    size_t size;                   /**< 映射大小 / Mapped size / Zuordnungsgröße */
+#ifdef _WIN32
+    HANDLE file;                   /**< 文件句柄 / File handle / Dateihandle */
+    HANDLE mapping;                /**< 映射句柄 / Mapping handle / Zuordnungshandle */
+#endif
+};
+
+/**
+ * @brief 以只读方式映射整个文件 / Map whole file read-only / Gesamte Datei schreibgeschützt zuordnen
+ * @param file_path 文件路径 / File path / Dateipfad
+ * @return 成功返回映射指针，失败返回NULL / Returns mapping pointer on success, NULL on failure / Gibt Zuordnungszeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_file_map_t* pt_platform_file_map_open(const char* file_path) {
+    if (file_path == NULL) {
+        return NULL;
+    }
+    
+    pt_platform_file_map_t* map = (pt_platform_file_map_t*)calloc(1, sizeof(pt_platform_file_map_t));
+    if (map == NULL) {
+        return NULL;
+    }
+    
+#ifdef _WIN32
+    map->file = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (map->file == INVALID_HANDLE_VALUE) {
+        free(map);
+        return NULL;
+    }
+    
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(map->file, &file_size) || (uint64_t)file_size.QuadPart > (uint64_t)SIZE_MAX) {
+        CloseHandle(map->file);
+        free(map);
+        return NULL;
+    }
+    map->size = (size_t)file_size.QuadPart;
+    if (map->size == 0) {
+        return map;
+    }
+    
+    map->mapping = CreateFileMappingA(map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (map->mapping == NULL) {
+        CloseHandle(map->file);
+        free(map);
+        return NULL;
+    }
+    map->data = MapViewOfFile(map->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (map->data == NULL) {
+        CloseHandle(map->mapping);
+        CloseHandle(map->file);
+        free(map);
+        return NULL;
+    }
+#else
+    int fd = open(file_path, O_RDONLY);
+    if (fd < 0) {
+        free(map);
+        return NULL;
+    }
+    
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size < 0 || (uint64_t)file_stat.st_size > (uint64_t)SIZE_MAX) {
+        close(fd);
+        free(map);
+        return NULL;
+    }
+    map->size = (size_t)file_stat.st_size;
+    if (map->size == 0) {
+        close(fd);
+        return map;
+    }
+    
+    /* 映射在关闭描述符后仍然有效 / The mapping stays valid after the descriptor is closed / Die Zuordnung bleibt nach dem Schließen des Deskriptors gültig */
+    void* data = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        free(map);
+        return NULL;
+    }
+    map->data = data;
+#endif
+    
+    return map;
+}
+
+/**
+ * @brief 获取映射数据 / Get mapped data / Zugeordnete Daten abrufen
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ * @return 映射数据，空文件返回NULL / Mapped data, NULL for empty files / Zugeordnete Daten, NULL bei leeren Dateien
+ */
+const void* pt_platform_file_map_data(const pt_platform_file_map_t* map) {
+    return map != NULL ? map->data : NULL;
+}
+
+/**
+ * @brief 获取映射大小 / Get mapped size / Zuordnungsgröße abrufen
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ * @return 映射字节数 / Mapped byte count / Anzahl zugeordneter Bytes
+ */
+size_t pt_platform_file_map_size(const pt_platform_file_map_t* map) {
+    return map != NULL ? map->size : 0;
+}
+
+/**
+ * @brief 解除文件映射 / Close file mapping / Dateizuordnung schließen
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ */
+void pt_platform_file_map_close(pt_platform_file_map_t* map) {
+    if (map == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    if (map->data != NULL) {
+        UnmapViewOfFile(map->data);
+    }
+    if (map->mapping != NULL) {
+        CloseHandle(map->mapping);
+    }
+    CloseHandle(map->file);
+#else
+    if (map->data != NULL) {
+        munmap((void*)map->data, map->size);
+    }
+#endif
+    free(map);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file file_replace.c
+ * @brief 文件原子替换 / Atomic file replacement / Atomarer Dateiersatz
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/**
+ * @brief 用临时文件替换目标文件 / Replace target file with temporary file / Zieldatei durch temporäre Datei ersetzen
+ * @details 已映射旧文件的读者继续看到旧内容 / Readers that mapped the old file keep seeing the old contents / Leser, die die alte Datei zugeordnet haben, sehen weiterhin den alten Inhalt
+ * @param temp_path 临时文件路径 / Temporary file path / Temporärer Dateipfad
+ * @param target_path 目标文件路径 / Target file path / Zieldateipfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_replace_file(const char* temp_path, const char* target_path) {
+    if (temp_path == NULL || target_path == NULL) {
+        return -1;
+    }
+    
+#ifdef _WIN32
+    /* 目标仍被映射时替换会失败，调用者保留旧文件 / Replacing fails while the target is still mapped, the caller keeps the old file / Ersetzen schlägt fehl, solange das Ziel zugeordnet ist; der Aufrufer behält die alte Datei */
+    if (!MoveFileExA(temp_path, target_path, MOVEFILE_REPLACE_EXISTING)) {
+        return -1;
+    }
+#else
+    if (rename(temp_path, target_path) != 0) {
+        return -1;
+    }
+#endif
+    
+    return 0;
+}
@@ -3,6 +3,11 @@
  * @brief 文件搜索操作 / File search operations / Dateisuche-Operationen
  */
 
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+#endif
+
 #include "pointer_transfer_platform.h"
 #include <stdlib.h>
 #include <string.h>
@@ -12,127 +17,110 @@
 #else
 #include <sys/stat.h>
 #include <dirent.h>
+#include <fcntl.h>
 #endif
 
 /**
- * @brief 递归查找目录下的所有动态链接库文件 / Recursively find all dynamic library files in directory / Alle dynamischen Bibliotheksdateien im Verzeichnis rekursiv finden
- * @param dir_path 目录路径 / Directory path / Verzeichnispfad
- * @param dll_files 输出DLL文件路径数组 / Output DLL file paths array / Ausgabe-DLL-Dateipfad-Array
- * @param max_files 最大文件数量 / Maximum file count / Maximale Dateianzahl
- * @param file_count 输出找到的文件数量 / Output found file count / Ausgabe gefundene Dateianzahl
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @brief 检查文件名是否为动态链接库 / Check if file name is a dynamic library / Prüfen, ob Dateiname eine dynamische Bibliothek ist
+ * @param file_name 文件名 / File name / Dateiname
+ * @return 是返回1，否则返回0 / Returns 1 if so, 0 otherwise / Gibt 1 zurück wenn ja, sonst 0
  */
-static int find_dll_files_recursive(const char* dir_path, char dll_files[][1024], int max_files, int* file_count) {
-    if (dir_path == NULL || dll_files == NULL || max_files <= 0 || file_count == NULL) {
-        return -1;
+int pt_platform_is_library_name(const char* file_name) {
+    if (file_name == NULL) {
+        return 0;
     }
     
+    size_t name_len = strlen(file_name);
 #ifdef _WIN32
-    char search_path[4096];
+    return name_len >= 4 && _stricmp(file_name + name_len - 4, ".dll") == 0;
+#else
+    return name_len >= 3 && strcmp(file_name + name_len - 3, ".so") == 0;
+#endif
+}
+
+/**
+ * @brief 拼接目录和文件名 / Join directory and file name / Verzeichnis und Dateiname verbinden
+ * @return 成功返回0，缓冲区不足返回-1 / Returns 0 on success, -1 if the buffer is too small / Gibt 0 bei Erfolg zurück, -1 wenn der Puffer zu klein ist
+ */
+static int join_library_path(char* buffer, size_t buffer_size, const char* dir_path, const char* file_name) {
     size_t dir_len = strlen(dir_path);
-    if (dir_len >= sizeof(search_path) - 3) {
+    size_t name_len = strlen(file_name);
+    if (dir_len + name_len + 2 > buffer_size) {
         return -1;
     }
     
-    memcpy(search_path, dir_path, dir_len);
-    if (dir_path[dir_len - 1] != '\\' && dir_path[dir_len - 1] != '/') {
-        search_path[dir_len++] = '\\';
+    memcpy(buffer, dir_path, dir_len);
+    if (dir_len > 0 && dir_path[dir_len - 1] != '/' && dir_path[dir_len - 1] != '\\') {
+        buffer[dir_len++] = '/';
+    }
+    memcpy(buffer + dir_len, file_name, name_len + 1);
+    return 0;
+}
+
+/**
+ * @brief 枚举目录中的动态链接库（不递归） / Enumerate dynamic libraries in a directory (non-recursive) / Dynamische Bibliotheken eines Verzeichnisses aufzählen (nicht rekursiv)
+ * @details POSIX上用d_type跳过非普通文件，用fstatat相对目录句柄取大小和时间，避免逐路径解析 / On POSIX d_type skips non-regular entries and fstatat against the directory handle yields size and time without resolving each path / Unter POSIX überspringt d_type nicht reguläre Einträge und fstatat relativ zum Verzeichnis-Handle liefert Größe und Zeit ohne Pfadauflösung je Eintrag
+ * @param dir_path 目录路径 / Directory path / Verzeichnispfad
+ * @param callback 每个库调用一次，返回非0停止枚举 / Called once per library, non-zero return stops the enumeration / Einmal pro Bibliothek aufgerufen, Rückgabe ungleich 0 beendet die Aufzählung
+ * @param user_data 回调用户数据 / Callback user data / Rückruf-Benutzerdaten
+ * @return 成功返回0，无法打开目录返回-1 / Returns 0 on success, -1 if the directory cannot be opened / Gibt 0 bei Erfolg zurück, -1 wenn das Verzeichnis nicht geöffnet werden kann
+ */
+int32_t pt_platform_scan_library_dir(const char* dir_path, pt_platform_dir_entry_func_t callback, void* user_data) {
+    if (dir_path == NULL || callback == NULL) {
+        return -1;
     }
-    search_path[dir_len++] = '*';
-    search_path[dir_len] = '\0';
     
-    struct _finddata_t file_info;
-    intptr_t handle = _findfirst(search_path, &file_info);
+    char full_path[4096];
+#ifdef _WIN32
+    if (join_library_path(full_path, sizeof(full_path), dir_path, "*.dll") != 0) {
+        return -1;
+    }
+    
+    struct _finddata64_t file_info;
+    intptr_t handle = _findfirst64(full_path, &file_info);
     if (handle == -1) {
         return 0;
     }
     
     do {
-        if (strcmp(file_info.name, ".") == 0 || strcmp(file_info.name, "..") == 0) {
-            continue;
-        }
-        
-        char full_path[4096];
-        size_t path_len = dir_len - 1;
-        if (path_len >= sizeof(full_path)) {
+        if ((file_info.attrib & _A_SUBDIR) || !pt_platform_is_library_name(file_info.name)) {
             continue;
         }
-        memcpy(full_path, search_path, path_len);
-        full_path[path_len] = '\0';
-        
-        size_t name_len = strlen(file_info.name);
-        if (path_len + name_len + 1 >= sizeof(full_path)) {
+        if (join_library_path(full_path, sizeof(full_path), dir_path, file_info.name) != 0) {
             continue;
         }
-        memcpy(full_path + path_len, file_info.name, name_len + 1);
-        
-        if (file_info.attrib & _A_SUBDIR) {
-            if (*file_count < max_files) {
-                find_dll_files_recursive(full_path, dll_files, max_files - *file_count, file_count);
-            }
-        } else {
-            size_t name_len_check = strlen(file_info.name);
-            if (name_len_check >= 4) {
-                const char* ext = file_info.name + name_len_check - 4;
-                if (_stricmp(ext, ".dll") == 0) {
-                    if (*file_count < max_files) {
-                        size_t copy_len = strlen(full_path);
-                        if (copy_len < sizeof(dll_files[*file_count])) {
-                            memcpy(dll_files[*file_count], full_path, copy_len + 1);
-                            (*file_count)++;
-                        }
-                    }
-                }
-            }
+        if (callback(full_path, (uint64_t)file_info.size, (int64_t)file_info.time_write, user_data) != 0) {
+            break;
         }
-    } while (_findnext(handle, &file_info) == 0 && *file_count < max_files);
+    } while (_findnext64(handle, &file_info) == 0);
     
     _findclose(handle);
 #else
     DIR* dir = opendir(dir_path);
     if (dir == NULL) {
-        return 0;
+        return -1;
     }
+    int dir_fd = dirfd(dir);
     
     struct dirent* entry;
-    while ((entry = readdir(dir)) != NULL && *file_count < max_files) {
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+    while ((entry = readdir(dir)) != NULL) {
+        /* 目录、套接字等无需stat即可跳过 / Directories, sockets and the like are skipped without a stat / Verzeichnisse, Sockets usw. werden ohne stat übersprungen */
+        if (entry->d_type != DT_REG && entry->d_type != DT_LNK && entry->d_type != DT_UNKNOWN) {
             continue;
         }
-        
-        char full_path[4096];
-        size_t dir_len = strlen(dir_path);
-        size_t name_len = strlen(entry->d_name);
-        
-        if (dir_len + name_len + 2 >= sizeof(full_path)) {
+        if (!pt_platform_is_library_name(entry->d_name)) {
             continue;
         }
         
-        memcpy(full_path, dir_path, dir_len);
-        if (dir_path[dir_len - 1] != '/') {
-            full_path[dir_len++] = '/';
-        }
-        memcpy(full_path + dir_len, entry->d_name, name_len + 1);
-        
         struct stat st;
-        if (stat(full_path, &st) == 0) {
-            if (S_ISDIR(st.st_mode)) {
-                find_dll_files_recursive(full_path, dll_files, max_files - *file_count, file_count);
-            } else if (S_ISREG(st.st_mode)) {
-                size_t name_len_check = strlen(entry->d_name);
-                if (name_len_check >= 3) {
-                    const char* ext = entry->d_name + name_len_check - 3;
-                    if (strcmp(ext, ".so") == 0) {
-                        if (*file_count < max_files) {
-                            size_t copy_len = strlen(full_path);
-                            if (copy_len < sizeof(dll_files[*file_count])) {
-                                memcpy(dll_files[*file_count], full_path, copy_len + 1);
-                                (*file_count)++;
-                            }
-                        }
-                    }
-                }
-            }
+        if (fstatat(dir_fd, entry->d_name, &st, 0) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+        if (join_library_path(full_path, sizeof(full_path), dir_path, entry->d_name) != 0) {
+            continue;
+        }
+        if (callback(full_path, (uint64_t)st.st_size, (int64_t)st.st_mtime, user_data) != 0) {
+            break;
         }
     }
     
@@ -141,43 +129,3 @@ static int find_dll_files_recursive(const char* dir_path, char dll_files[][1024]
     
     return 0;
 }
-
-/**
- * @brief 从插件路径获取目录并递归查找所有DLL文件 / Get directory from plugin path and recursively find all DLL files / Verzeichnis aus Plugin-Pfad abrufen und alle DLL-Dateien rekursiv finden
- * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
- * @param dll_files 输出DLL文件路径数组 / Output DLL file paths array / Ausgabe-DLL-Dateipfad-Array
- * @param max_files 最大文件数量 / Maximum file count / Maximale Dateianzahl
- * @param file_count 输出找到的文件数量 / Output found file count / Ausgabe gefundene Dateianzahl
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
- */
-int32_t pt_platform_find_all_dll_files(const char* plugin_path, char dll_files[][1024], int max_files, int* file_count) {
-    if (plugin_path == NULL || dll_files == NULL || max_files <= 0 || file_count == NULL) {
-        return -1;
-    }
-    
-    *file_count = 0;
-    
-    char dir_path[4096];
-    const char* last_slash = strrchr(plugin_path, '/');
-#ifdef _WIN32
-    const char* last_backslash = strrchr(plugin_path, '\\');
-    if (last_backslash != NULL && (last_slash == NULL || last_backslash > last_slash)) {
-        last_slash = last_backslash;
-    }
-#endif
-    
-    if (last_slash == NULL) {
-        dir_path[0] = '.';
-        dir_path[1] = '\0';
-    } else {
-        size_t dir_len = last_slash - plugin_path;
-        if (dir_len >= sizeof(dir_path)) {
-            dir_len = sizeof(dir_path) - 1;
-        }
-        memcpy(dir_path, plugin_path, dir_len);
-        dir_path[dir_len] = '\0';
-    }
-    
-    return find_dll_files_recursive(dir_path, dll_files, max_files, file_count);
-}
-
@@ -43,3 +43,32 @@ int32_t pt_platform_get_file_timestamp(const char* file_path, int64_t* timestamp
     return 0;
 }
 
+
+/**
+ * @brief 获取文件大小和修改时间戳 / Get file size and modification timestamp / Dateigröße und Änderungszeitstempel abrufen
+ * @param file_path 文件路径 / File path / Dateipfad
+ * @param size 输出文件大小 / Output file size / Ausgabe-Dateigröße
+ * @param timestamp 输出时间戳 / Output timestamp / Ausgabe-Zeitstempel
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_get_file_stat(const char* file_path, uint64_t* size, int64_t* timestamp) {
+    if (file_path == NULL || size == NULL || timestamp == NULL) {
+        return -1;
+    }
+    
+#ifdef _WIN32
+    struct _stat64 file_stat;
+    if (_stat64(file_path, &file_stat) != 0) {
+        return -1;
+    }
+#else
+    struct stat file_stat;
+    if (stat(file_path, &file_stat) != 0) {
+        return -1;
+    }
+#endif
+    *size = (uint64_t)file_stat.st_size;
+    *timestamp = (int64_t)file_stat.st_mtime;
+    
+    return 0;
+}
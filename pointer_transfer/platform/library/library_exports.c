@@ -0,0 +1,166 @@
+/**
+ * @file library_exports.c
+ * @brief 不加载库检查导出符号 / Check exported symbols without loading the library / Exportierte Symbole prüfen, ohne die Bibliothek zu laden
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <elf.h>
+#endif
+
+#ifndef _WIN32
+/**
+ * @brief 检查映射范围 / Check mapped range / Zugeordneten Bereich prüfen
+ * @return 范围在文件内返回1，否则返回0 / Returns 1 if the range lies inside the file, 0 otherwise / Gibt 1 zurück, wenn der Bereich in der Datei liegt, sonst 0
+ */
+static int elf_range_valid(size_t file_size, uint64_t offset, uint64_t length) {
+    return offset <= file_size && length <= file_size - offset;
+}
+
+/**
+ * @brief 标记一个导出符号 / Mark one exported symbol / Ein exportiertes Symbol markieren
+ */
+static void mark_exported_symbol(const char* strtab, uint64_t strtab_size, uint64_t name_offset,
+                                 const char* const* symbol_names, size_t symbol_count, int* found) {
+    if (name_offset >= strtab_size) {
+        return;
+    }
+    
+    const char* name = strtab + name_offset;
+    size_t max_len = (size_t)(strtab_size - name_offset);
+    for (size_t i = 0; i < symbol_count; i++) {
+        size_t name_len = strlen(symbol_names[i]);
+        if (!found[i] && name_len < max_len && memcmp(name, symbol_names[i], name_len + 1) == 0) {
+            found[i] = 1;
+        }
+    }
+}
+
+/**
+ * @brief 与位数无关的节头 / Section header independent of word size / Abschnittskopf unabhängig von der Wortbreite
+ */
+typedef struct {
+    uint32_t type;                 /**< 节类型 / Section type / Abschnittstyp */
+    uint32_t link;                 /**< 关联节索引 / Linked section index / Index des verknüpften Abschnitts */
+    uint64_t offset;               /**< 文件偏移 / File offset / Dateiversatz */
+    uint64_t size;                 /**< 节大小 / Section size / Abschnittsgröße */
+    uint64_t entry_size;           /**< 表项大小 / Entry size / Eintragsgröße */
+} elf_section_t;
+
+/**
+ * @brief 读取第index个节头 / Read the index-th section header / Den index-ten Abschnittskopf lesen
+ */
+static void read_elf_section(const unsigned char* section_table, int is_64bit, size_t index, elf_section_t* out) {
+    if (is_64bit) {
+        const Elf64_Shdr* shdr = (const Elf64_Shdr*)section_table + index;
+        out->type = shdr->sh_type;
+        out->link = shdr->sh_link;
+        out->offset = shdr->sh_offset;
+        out->size = shdr->sh_size;
+        out->entry_size = shdr->sh_entsize;
+    } else {
+        const Elf32_Shdr* shdr = (const Elf32_Shdr*)section_table + index;
+        out->type = shdr->sh_type;
+        out->link = shdr->sh_link;
+        out->offset = shdr->sh_offset;
+        out->size = shdr->sh_size;
+        out->entry_size = shdr->sh_entsize;
+    }
+}
+
+/**
+ * @brief 解析ELF映射的动态符号表 / Parse the dynamic symbol table of an ELF mapping / Dynamiksymboltabelle einer ELF-Zuordnung parsen
+ */
+static int32_t scan_elf_exports(const unsigned char* data, size_t size,
+                                const char* const* symbol_names, size_t symbol_count, int* found) {
+    if (data == NULL || size < EI_NIDENT || memcmp(data, ELFMAG, SELFMAG) != 0) {
+        return -1;
+    }
+    
+    /* 只解析本机字节序 / Only native byte order is parsed / Nur native Bytereihenfolge wird geparst */
+    const uint16_t byte_order_probe = 1;
+    int host_little_endian = *(const unsigned char*)&byte_order_probe == 1;
+    if (data[EI_DATA] != (host_little_endian ? ELFDATA2LSB : ELFDATA2MSB)) {
+        return -1;
+    }
+    
+    int is_64bit = data[EI_CLASS] == ELFCLASS64;
+    if ((!is_64bit && data[EI_CLASS] != ELFCLASS32) || size < (is_64bit ? sizeof(Elf64_Ehdr) : sizeof(Elf32_Ehdr))) {
+        return -1;
+    }
+    uint64_t section_offset = is_64bit ? ((const Elf64_Ehdr*)data)->e_shoff : ((const Elf32_Ehdr*)data)->e_shoff;
+    size_t section_count = is_64bit ? ((const Elf64_Ehdr*)data)->e_shnum : ((const Elf32_Ehdr*)data)->e_shnum;
+    size_t section_entry_size = is_64bit ? ((const Elf64_Ehdr*)data)->e_shentsize : ((const Elf32_Ehdr*)data)->e_shentsize;
+    size_t symbol_entry_size = is_64bit ? sizeof(Elf64_Sym) : sizeof(Elf32_Sym);
+    if (section_entry_size != (is_64bit ? sizeof(Elf64_Shdr) : sizeof(Elf32_Shdr)) ||
+        !elf_range_valid(size, section_offset, (uint64_t)section_count * section_entry_size)) {
+        return -1;
+    }
+    
+    const unsigned char* section_table = data + section_offset;
+    for (size_t s = 0; s < section_count; s++) {
+        elf_section_t dynsym;
+        read_elf_section(section_table, is_64bit, s, &dynsym);
+        if (dynsym.type != SHT_DYNSYM || dynsym.entry_size != symbol_entry_size || dynsym.link >= section_count) {
+            continue;
+        }
+        elf_section_t strtab;
+        read_elf_section(section_table, is_64bit, dynsym.link, &strtab);
+        if (!elf_range_valid(size, dynsym.offset, dynsym.size) || !elf_range_valid(size, strtab.offset, strtab.size)) {
+            return -1;
+        }
+        
+        const char* names = (const char*)data + strtab.offset;
+        size_t count = (size_t)(dynsym.size / symbol_entry_size);
+        for (size_t i = 0; i < count; i++) {
+            const unsigned char* entry = data + dynsym.offset + i * symbol_entry_size;
+            uint64_t name_offset = is_64bit ? ((const Elf64_Sym*)entry)->st_name : ((const Elf32_Sym*)entry)->st_name;
+            unsigned char info = is_64bit ? ((const Elf64_Sym*)entry)->st_info : ((const Elf32_Sym*)entry)->st_info;
+            uint16_t section_index = is_64bit ? ((const Elf64_Sym*)entry)->st_shndx : ((const Elf32_Sym*)entry)->st_shndx;
+            
+            /* 只接受已定义的全局或弱函数 / Only defined global or weak functions count / Nur definierte globale oder schwache Funktionen zählen */
+            unsigned char bind = ELF64_ST_BIND(info);
+            if (section_index == SHN_UNDEF || ELF64_ST_TYPE(info) != STT_FUNC || (bind != STB_GLOBAL && bind != STB_WEAK)) {
+                continue;
+            }
+            mark_exported_symbol(names, strtab.size, name_offset, symbol_names, symbol_count, found);
+        }
+        return 0;
+    }
+    return -1;
+}
+#endif
+
+/**
+ * @brief 从库文件的动态符号表检查导出函数（不加载、不执行库代码） / Check exported functions in the library file's dynamic symbol table (nothing is loaded or executed) / Exportierte Funktionen in der Dynamiksymboltabelle der Bibliotheksdatei prüfen (nichts wird geladen oder ausgeführt)
+ * @param library_path 库文件路径 / Library file path / Bibliotheksdateipfad
+ * @param symbol_names 要检查的符号名称 / Symbol names to check / Zu prüfende Symbolnamen
+ * @param symbol_count 符号数量 / Symbol count / Symbolanzahl
+ * @param found 输出每个符号是否导出 / Outputs whether each symbol is exported / Gibt aus, ob jedes Symbol exportiert wird
+ * @return 成功返回0，格式不支持或无法解析返回-1 / Returns 0 on success, -1 if the format is unsupported or cannot be parsed / Gibt 0 bei Erfolg zurück, -1 wenn das Format nicht unterstützt wird oder nicht geparst werden kann
+ */
+int32_t pt_platform_check_library_exports(const char* library_path, const char* const* symbol_names, size_t symbol_count, int* found) {
+    if (library_path == NULL || symbol_names == NULL || found == NULL) {
+        return -1;
+    }
+    
+    memset(found, 0, symbol_count * sizeof(int));
+#ifdef _WIN32
+    /* PE导出表未实现，调用者改用已加载句柄解析 / PE export tables are not parsed, callers resolve through the loaded handle instead / PE-Exporttabellen werden nicht geparst, Aufrufer lösen stattdessen über das geladene Handle auf */
+    (void)symbol_count;
+    return -1;
+#else
+    pt_platform_file_map_t* map = pt_platform_file_map_open(library_path);
+    if (map == NULL) {
+        return -1;
+    }
+    int32_t result = scan_elf_exports((const unsigned char*)pt_platform_file_map_data(map), pt_platform_file_map_size(map),
+                                      symbol_names, symbol_count, found);
+    pt_platform_file_map_close(map);
+    return result;
+#endif
+}
@@ -29,3 +29,21 @@ void* pt_platform_load_library(const char* plugin_path) {
 #endif
 }
 
+/**
+ * @brief 加载动态库文件并立即绑定所有符号 / Load dynamic library file and bind all symbols immediately / Dynamische Bibliotheksdatei laden und alle Symbole sofort binden
+ * @details Windows加载时已解析导入表 / Windows resolves the import table at load time anyway / Windows löst die Importtabelle ohnehin beim Laden auf
+ * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
+ * @return 动态库句柄，失败返回NULL / Dynamic library handle, NULL on failure / Dynamisches Bibliothekshandle, NULL bei Fehler
+ */
+void* pt_platform_load_library_bind_now(const char* plugin_path) {
+    if (plugin_path == NULL) {
+        return NULL;
+    }
+    
+#ifdef _WIN32
+    return (void*)LoadLibraryA(plugin_path);
+#else
+    return dlopen(plugin_path, RTLD_NOW);
+#endif
+}
+
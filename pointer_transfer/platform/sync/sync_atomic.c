@@ -0,0 +1,63 @@
+/**
+ * @file sync_atomic.c
+ * @brief 平台原子操作 / Platform atomic operations / Plattform-Atomoperationen
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/**
+ * @brief 原子存储整数（释放语义） / Atomically store integer (release semantics) / Ganzzahl atomar speichern (Release-Semantik)
+ * @param target 目标地址 / Target address / Zieladresse
+ * @param value 新值 / New value / Neuer Wert
+ */
+void pt_platform_atomic_store_int(volatile int* target, int value) {
+    if (target == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    InterlockedExchange((volatile LONG*)target, (LONG)value);
+#else
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ * @brief 原子读取整数（获取语义） / Atomically load integer (acquire semantics) / Ganzzahl atomar laden (Acquire-Semantik)
+ * @param target 目标地址 / Target address / Zieladresse
+ * @return 当前值 / Current value / Aktueller Wert
+ */
+int pt_platform_atomic_load_int(const volatile int* target) {
+    if (target == NULL) {
+        return 0;
+    }
+    
+#ifdef _WIN32
+    return (int)InterlockedCompareExchange((volatile LONG*)target, 0, 0);
+#else
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief 原子加法并返回旧值 / Atomically add and return previous value / Atomar addieren und vorherigen Wert zurückgeben
+ * @param target 目标地址 / Target address / Zieladresse
+ * @param value 增量 / Increment / Inkrement
+ * @return 加法前的值 / Value before the addition / Wert vor der Addition
+ */
+int pt_platform_atomic_fetch_add_int(volatile int* target, int value) {
+    if (target == NULL) {
+        return 0;
+    }
+    
+#ifdef _WIN32
+    return (int)InterlockedExchangeAdd((volatile LONG*)target, (LONG)value);
+#else
+    return __atomic_fetch_add(target, value, __ATOMIC_ACQ_REL);
+#endif
+}
@@ -0,0 +1,96 @@
+/**
+ * @file sync_mutex.c
+ * @brief 平台互斥锁 / Platform mutex / Plattform-Mutex
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/**
+ * @brief 平台互斥锁结构体 / Platform mutex structure / Plattform-Mutex-Struktur
+ */
+struct pt_platform_mutex_s {
+#ifdef _WIN32
+    CRITICAL_SECTION section;      /**< 临界区 / Critical section / Kritischer Abschnitt */
+#else
+    pthread_mutex_t mutex;         /**< POSIX互斥锁 / POSIX mutex / POSIX-Mutex */
+#endif
+};
+
+/**
+ * @brief 创建互斥锁 / Create mutex / Mutex erstellen
+ * @return 成功返回互斥锁指针，失败返回NULL / Returns mutex pointer on success, NULL on failure / Gibt Mutex-Zeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_mutex_t* pt_platform_mutex_create(void) {
+    pt_platform_mutex_t* mutex = (pt_platform_mutex_t*)malloc(sizeof(pt_platform_mutex_t));
+    if (mutex == NULL) {
+        return NULL;
+    }
+    
+#ifdef _WIN32
+    InitializeCriticalSection(&mutex->section);
+#else
+    if (pthread_mutex_init(&mutex->mutex, NULL) != 0) {
+        free(mutex);
+        return NULL;
+    }
+#endif
+    
+    return mutex;
+}
+
+/**
+ * @brief 销毁互斥锁 / Destroy mutex / Mutex zerstören
+ * @param mutex 互斥锁 / Mutex / Mutex
+ */
+void pt_platform_mutex_destroy(pt_platform_mutex_t* mutex) {
+    if (mutex == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    DeleteCriticalSection(&mutex->section);
+#else
+    pthread_mutex_destroy(&mutex->mutex);
+#endif
+    free(mutex);
+}
+
+/**
+ * @brief 加锁 / Lock mutex / Mutex sperren
+ * @param mutex 互斥锁 / Mutex / Mutex
+ */
+void pt_platform_mutex_lock(pt_platform_mutex_t* mutex) {
+    if (mutex == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    EnterCriticalSection(&mutex->section);
+#else
+    pthread_mutex_lock(&mutex->mutex);
+#endif
+}
+
+/**
+ * @brief 解锁 / Unlock mutex / Mutex entsperren
+ * @param mutex 互斥锁 / Mutex / Mutex
+ */
+void pt_platform_mutex_unlock(pt_platform_mutex_t* mutex) {
+    if (mutex == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    LeaveCriticalSection(&mutex->section);
+#else
+    pthread_mutex_unlock(&mutex->mutex);
+#endif
+}
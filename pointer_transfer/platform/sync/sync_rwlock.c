@@ -0,0 +1,130 @@
+/**
+ * @file sync_rwlock.c
+ * @brief 平台读写锁 / Platform read-write lock / Plattform-Lese-Schreib-Sperre
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/**
+ * @brief 平台读写锁结构体 / Platform read-write lock structure / Plattform-Lese-Schreib-Sperren-Struktur
+ */
+struct pt_platform_rwlock_s {
+#ifdef _WIN32
+    SRWLOCK lock;                  /**< 精简读写锁 / Slim reader-writer lock / Schlanke Lese-Schreib-Sperre */
+#else
+    pthread_rwlock_t lock;         /**< POSIX读写锁 / POSIX read-write lock / POSIX-Lese-Schreib-Sperre */
+#endif
+};
+
+/**
+ * @brief 创建读写锁 / Create read-write lock / Lese-Schreib-Sperre erstellen
+ * @return 成功返回读写锁指针，失败返回NULL / Returns read-write lock pointer on success, NULL on failure / Gibt Lese-Schreib-Sperren-Zeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_rwlock_t* pt_platform_rwlock_create(void) {
+    pt_platform_rwlock_t* rwlock = (pt_platform_rwlock_t*)malloc(sizeof(pt_platform_rwlock_t));
+    if (rwlock == NULL) {
+        return NULL;
+    }
+    
+#ifdef _WIN32
+    InitializeSRWLock(&rwlock->lock);
+#else
+    if (pthread_rwlock_init(&rwlock->lock, NULL) != 0) {
+        free(rwlock);
+        return NULL;
+    }
+#endif
+    
+    return rwlock;
+}
+
+/**
+ * @brief 销毁读写锁 / Destroy read-write lock / Lese-Schreib-Sperre zerstören
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_destroy(pt_platform_rwlock_t* rwlock) {
+    if (rwlock == NULL) {
+        return;
+    }
+    
+#ifndef _WIN32
+    pthread_rwlock_destroy(&rwlock->lock);
+#endif
+    free(rwlock);
+}
+
+/**
+ * @brief 获取读锁 / Acquire read lock / Lesesperre erwerben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_read_lock(pt_platform_rwlock_t* rwlock) {
+    if (rwlock == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    AcquireSRWLockShared(&rwlock->lock);
+#else
+    pthread_rwlock_rdlock(&rwlock->lock);
+#endif
+}
+
+/**
+ * @brief 释放读锁 / Release read lock / Lesesperre freigeben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_read_unlock(pt_platform_rwlock_t* rwlock) {
+    if (rwlock == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    ReleaseSRWLockShared(&rwlock->lock);
+#else
+    pthread_rwlock_unlock(&rwlock->lock);
+#endif
+}
+
+/**
+ * @brief 获取写锁 / Acquire write lock / Schreibsperre erwerben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_write_lock(pt_platform_rwlock_t* rwlock) {
+    if (rwlock == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&rwlock->lock);
+#else
+    pthread_rwlock_wrlock(&rwlock->lock);
+#endif
+}
+
+/**
+ * @brief 释放写锁 / Release write lock / Schreibsperre freigeben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_write_unlock(pt_platform_rwlock_t* rwlock) {
+    if (rwlock == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&rwlock->lock);
+#else
+    pthread_rwlock_unlock(&rwlock->lock);
+#endif
+}
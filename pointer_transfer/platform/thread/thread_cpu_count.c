@@ -0,0 +1,33 @@
+/**
+ * @file thread_cpu_count.c
+ * @brief 处理器数量 / Processor count / Prozessoranzahl
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief 获取在线处理器数量 / Get number of online processors / Anzahl der verfügbaren Prozessoren abrufen
+ * @return 处理器数量，无法确定时返回1 / Processor count, 1 if unknown / Prozessoranzahl, 1 wenn unbekannt
+ */
+uint32_t pt_platform_get_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (uint32_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (uint32_t)count : 1;
+#endif
+}
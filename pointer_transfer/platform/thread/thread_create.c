@@ -0,0 +1,118 @@
+/**
+ * @file thread_create.c
+ * @brief 平台线程 / Platform thread / Plattform-Thread
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/**
+ * @brief 平台线程结构体 / Platform thread structure / Plattform-Thread-Struktur
+ */
+struct pt_platform_thread_s {
+#ifdef _WIN32
+    HANDLE handle;                 /**< 线程句柄 / Thread handle / Thread-Handle */
+    HANDLE done_event;             /**< 入口函数完成事件 / Entry function finished event / Ereignis für beendete Einstiegsfunktion */
+#else
+    pthread_t thread;              /**< POSIX线程 / POSIX thread / POSIX-Thread */
+#endif
+    pt_platform_thread_func_t func; /**< 入口函数 / Entry function / Einstiegsfunktion */
+    void* arg;                     /**< 入口函数参数 / Entry function argument / Argument der Einstiegsfunktion */
+};
+
+/**
+ * @brief 线程启动包装 / Thread start trampoline / Thread-Start-Trampolin
+ */
+#ifdef _WIN32
+static DWORD WINAPI platform_thread_start(LPVOID param) {
+    pt_platform_thread_t* thread = (pt_platform_thread_t*)param;
+    thread->func(thread->arg);
+    SetEvent(thread->done_event);
+    return 0;
+}
+#else
+static void* platform_thread_start(void* param) {
+    pt_platform_thread_t* thread = (pt_platform_thread_t*)param;
+    thread->func(thread->arg);
+    return NULL;
+}
+#endif
+
+/**
+ * @brief 创建线程 / Create thread / Thread erstellen
+ * @param func 线程入口函数 / Thread entry function / Thread-Einstiegsfunktion
+ * @param arg 入口函数参数 / Entry function argument / Argument der Einstiegsfunktion
+ * @return 成功返回线程指针，失败返回NULL / Returns thread pointer on success, NULL on failure / Gibt Thread-Zeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_thread_t* pt_platform_thread_create(pt_platform_thread_func_t func, void* arg) {
+    if (func == NULL) {
+        return NULL;
+    }
+    
+    pt_platform_thread_t* thread = (pt_platform_thread_t*)malloc(sizeof(pt_platform_thread_t));
+    if (thread == NULL) {
+        return NULL;
+    }
+    thread->func = func;
+    thread->arg = arg;
+    
+#ifdef _WIN32
+    thread->done_event = CreateEventA(NULL, TRUE, FALSE, NULL);
+    if (thread->done_event == NULL) {
+        free(thread);
+        return NULL;
+    }
+    thread->handle = CreateThread(NULL, 0, platform_thread_start, thread, 0, NULL);
+    if (thread->handle == NULL) {
+        CloseHandle(thread->done_event);
+        free(thread);
+        return NULL;
+    }
+#else
+    if (pthread_create(&thread->thread, NULL, platform_thread_start, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+#endif
+    
+    return thread;
+}
+
+/**
+ * @brief 等待线程结束并释放线程 / Wait for thread to finish and free it / Auf Thread-Ende warten und Thread freigeben
+ * @param thread 线程 / Thread / Thread
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_thread_join(pt_platform_thread_t* thread) {
+    if (thread == NULL) {
+        return -1;
+    }
+    
+    int32_t result = 0;
+#ifdef _WIN32
+    /* DllMain中线程退出需要加载器锁，因此同时等待完成事件 / Thread exit needs the loader lock inside DllMain, so the finished event is waited on as well / Thread-Ende benötigt in DllMain die Loader-Sperre, daher wird zusätzlich auf das Beendigungsereignis gewartet */
+    HANDLE handles[2];
+    handles[0] = thread->done_event;
+    handles[1] = thread->handle;
+    DWORD wait_result = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+    if (wait_result != WAIT_OBJECT_0 && wait_result != WAIT_OBJECT_0 + 1) {
+        result = -1;
+    }
+    CloseHandle(thread->handle);
+    CloseHandle(thread->done_event);
+#else
+    if (pthread_join(thread->thread, NULL) != 0) {
+        result = -1;
+    }
+#endif
+    
+    free(thread);
+    return result;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file time_monotonic.c
+ * @brief 单调时钟 / Monotonic clock / Monotone Uhr
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/**
+ * @brief 获取单调时钟毫秒数 / Get monotonic clock milliseconds / Monotone Uhr in Millisekunden abrufen
+ * @return 单调时钟毫秒数，失败返回0 / Monotonic clock milliseconds, 0 on failure / Monotone Uhr in Millisekunden, 0 bei Fehler
+ */
+int64_t pt_platform_get_monotonic_ms(void) {
+#ifdef _WIN32
+    return (int64_t)GetTickCount64();
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+    return (int64_t)ts.tv_sec * 1000 + (int64_t)(ts.tv_nsec / 1000000);
+#endif
+}
+
+/**
+ * @brief 获取单调时钟微秒数 / Get monotonic clock microseconds / Monotone Uhr in Mikrosekunden abrufen
+ * @return 单调时钟微秒数，失败返回0 / Monotonic clock microseconds, 0 on failure / Monotone Uhr in Mikrosekunden, 0 bei Fehler
+ */
+int64_t pt_platform_get_monotonic_us(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (!QueryPerformanceFrequency(&frequency) || !QueryPerformanceCounter(&counter) || frequency.QuadPart == 0) {
+        return (int64_t)GetTickCount64() * 1000;
+    }
+    return (int64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 +
+           (int64_t)((counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart);
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+    return (int64_t)ts.tv_sec * 1000000 + (int64_t)(ts.tv_nsec / 1000);
+#endif
+}
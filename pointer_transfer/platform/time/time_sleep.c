@@ -0,0 +1,36 @@
+/**
+ * @file time_sleep.c
+ * @brief 线程休眠 / Thread sleep / Thread-Ruhezustand
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#include <errno.h>
+#endif
+
+/**
+ * @brief 休眠指定毫秒数 / Sleep for given milliseconds / Für angegebene Millisekunden schlafen
+ * @param milliseconds 毫秒数 / Milliseconds / Millisekunden
+ */
+void pt_platform_sleep_ms(uint32_t milliseconds) {
+#ifdef _WIN32
+    Sleep((DWORD)milliseconds);
+#else
+    struct timespec request;
+    request.tv_sec = (time_t)(milliseconds / 1000);
+    request.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+    /* 被信号中断时继续休眠剩余时间 / Continue sleeping remaining time when interrupted by signal / Bei Signalunterbrechung verbleibende Zeit weiterschlafen */
+    while (nanosleep(&request, &request) != 0 && errno == EINTR) {
+    }
+#endif
+}
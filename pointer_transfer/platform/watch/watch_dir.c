@@ -0,0 +1,132 @@
+/**
+ * @file watch_dir.c
+ * @brief 目录变化非阻塞监视 / Non-blocking directory change watching / Nicht blockierende Verzeichnisänderungsüberwachung
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+/**
+ * @brief 平台目录监视器结构体 / Platform directory watcher structure / Plattform-Verzeichnisüberwachungsstruktur
+ */
+struct pt_platform_dir_watch_s {
+#ifdef _WIN32
+    HANDLE change_handle;          /**< 目录变化通知句柄 / Directory change notification handle / Verzeichnisänderungs-Benachrichtigungshandle */
+#else
+    int fd;                        /**< 非阻塞inotify文件描述符 / Non-blocking inotify file descriptor / Nicht blockierender inotify-Dateideskriptor */
+#endif
+};
+
+/**
+ * @brief 创建目录监视器 / Create directory watcher / Verzeichnisüberwachung erstellen
+ * @param dir_path 目录路径 / Directory path / Verzeichnispfad
+ * @return 成功返回监视器指针，平台不支持或失败返回NULL / Returns watcher pointer on success, NULL if unsupported or on failure / Gibt Überwachungszeiger bei Erfolg zurück, NULL wenn nicht unterstützt oder bei Fehler
+ */
+pt_platform_dir_watch_t* pt_platform_dir_watch_create(const char* dir_path) {
+    if (dir_path == NULL) {
+        return NULL;
+    }
+    
+    pt_platform_dir_watch_t* watch = (pt_platform_dir_watch_t*)calloc(1, sizeof(pt_platform_dir_watch_t));
+    if (watch == NULL) {
+        return NULL;
+    }
+    
+#ifdef _WIN32
+    watch->change_handle = FindFirstChangeNotificationA(dir_path, FALSE,
+                                                        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE);
+    if (watch->change_handle == INVALID_HANDLE_VALUE) {
+        free(watch);
+        return NULL;
+    }
+#else
+    watch->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watch->fd < 0) {
+        free(watch);
+        return NULL;
+    }
+    if (inotify_add_watch(watch->fd, dir_path, IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ATTRIB) < 0) {
+        close(watch->fd);
+        free(watch);
+        return NULL;
+    }
+#endif
+    
+    return watch;
+}
+
+/**
+ * @brief 取出所有待处理的目录变化（不阻塞） / Drain all pending directory changes (non-blocking) / Alle ausstehenden Verzeichnisänderungen abholen (nicht blockierend)
+ * @details 回调的文件名为NULL表示无法确定具体文件（Windows或事件队列溢出），需要重新扫描整个目录 / A NULL file name in the callback means the file cannot be identified (Windows or event queue overflow) and the whole directory must be rescanned / Ein NULL-Dateiname im Rückruf bedeutet, dass die Datei nicht ermittelt werden kann (Windows oder Überlauf der Ereigniswarteschlange) und das ganze Verzeichnis neu gescannt werden muss
+ * @param watch 目录监视器 / Directory watcher / Verzeichnisüberwachung
+ * @param callback 每个变化的文件名调用一次 / Called once per changed file name / Einmal pro geändertem Dateinamen aufgerufen
+ * @param user_data 回调用户数据 / Callback user data / Rückruf-Benutzerdaten
+ * @return 变化数量，失败返回-1 / Number of changes, -1 on failure / Anzahl der Änderungen, -1 bei Fehler
+ */
+int32_t pt_platform_dir_watch_poll(pt_platform_dir_watch_t* watch, pt_platform_dir_change_func_t callback, void* user_data) {
+    if (watch == NULL || callback == NULL) {
+        return -1;
+    }
+    
+#ifdef _WIN32
+    if (WaitForSingleObject(watch->change_handle, 0) != WAIT_OBJECT_0) {
+        return 0;
+    }
+    FindNextChangeNotification(watch->change_handle);
+    callback(NULL, user_data);
+    return 1;
+#else
+    int32_t change_count = 0;
+    for (;;) {
+        /* 事件缓冲区按inotify_event对齐 / Event buffer aligned for inotify_event / Ereignispuffer für inotify_event ausgerichtet */
+        char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+        ssize_t length = read(watch->fd, buffer, sizeof(buffer));
+        if (length < 0) {
+            return errno == EAGAIN || errno == EINTR ? change_count : -1;
+        }
+        if (length == 0) {
+            return change_count;
+        }
+        
+        for (char* cursor = buffer; cursor < buffer + length; ) {
+            const struct inotify_event* event = (const struct inotify_event*)cursor;
+            if (event->mask & IN_Q_OVERFLOW) {
+                callback(NULL, user_data);
+                change_count++;
+            } else if (event->len > 0) {
+                callback(event->name, user_data);
+                change_count++;
+            }
+            cursor += sizeof(struct inotify_event) + event->len;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief 销毁目录监视器 / Destroy directory watcher / Verzeichnisüberwachung zerstören
+ * @param watch 目录监视器 / Directory watcher / Verzeichnisüberwachung
+ */
+void pt_platform_dir_watch_destroy(pt_platform_dir_watch_t* watch) {
+    if (watch == NULL) {
+        return;
+    }
+    
+#ifdef _WIN32
+    FindCloseChangeNotification(watch->change_handle);
+#else
+    close(watch->fd);
+#endif
+    free(watch);
+}
@@ -0,0 +1,257 @@
+/**
+ * @file watch_file.c
+ * @brief 文件变化监视 / File change watching / Dateiänderungsüberwachung
+ * @details 监视文件所在目录，以便捕获编辑器的"写临时文件再重命名"式保存 / Watches the containing directory so editor saves of the "write temp file then rename" kind are caught / Überwacht das enthaltende Verzeichnis, damit Editor-Speicherungen nach dem Muster "Temporärdatei schreiben, dann umbenennen" erfasst werden
+ */
+
+#include "pointer_transfer_platform.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+/* 最大监视文件数量（Windows等待对象上限） / Maximum watched file count (Windows wait object limit) / Maximale Anzahl überwachter Dateien (Windows-Warteobjekt-Grenze) */
+#define PT_WATCH_MAX_ENTRIES 64
+
+/**
+ * @brief 监视项结构体 / Watch entry structure / Überwachungseintragsstruktur
+ */
+typedef struct {
+#ifdef _WIN32
+    HANDLE change_handle;          /**< 目录变化通知句柄 / Directory change notification handle / Verzeichnisänderungs-Benachrichtigungshandle */
+    char* file_path;               /**< 文件路径 / File path / Dateipfad */
+    int64_t timestamp;             /**< 上次观察到的修改时间戳 / Last observed modification timestamp / Zuletzt beobachteter Änderungszeitstempel */
+#else
+    int wd;                        /**< inotify监视描述符 / inotify watch descriptor / inotify-Überwachungsdeskriptor */
+    char* file_name;               /**< 文件名（不含目录） / File name (without directory) / Dateiname (ohne Verzeichnis) */
+#endif
+} pt_watch_entry_t;
+
+/**
+ * @brief 平台文件监视器结构体 / Platform file watcher structure / Plattform-Dateiüberwachungsstruktur
+ */
+struct pt_platform_watch_s {
+#ifndef _WIN32
+    int fd;                        /**< inotify文件描述符 / inotify file descriptor / inotify-Dateideskriptor */
+#endif
+    pt_watch_entry_t entries[PT_WATCH_MAX_ENTRIES]; /**< 监视项数组 / Watch entries array / Überwachungseintrags-Array */
+    size_t entry_count;            /**< 监视项数量 / Watch entry count / Anzahl der Überwachungseinträge */
+};
+
+/**
+ * @brief 拆分文件路径为目录和文件名 / Split file path into directory and file name / Dateipfad in Verzeichnis und Dateiname aufteilen
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static int split_watch_path(const char* file_path, char** directory_out, const char** file_name_out) {
+    const char* separator = strrchr(file_path, '/');
+#ifdef _WIN32
+    const char* back_separator = strrchr(file_path, '\\');
+    if (back_separator != NULL && (separator == NULL || back_separator > separator)) {
+        separator = back_separator;
+    }
+#endif
+    
+    if (separator == NULL) {
+        *directory_out = (char*)malloc(2);
+        if (*directory_out == NULL) {
+            return -1;
+        }
+        memcpy(*directory_out, ".", 2);
+        *file_name_out = file_path;
+        return 0;
+    }
+    
+    size_t directory_len = separator == file_path ? 1 : (size_t)(separator - file_path);
+    *directory_out = (char*)malloc(directory_len + 1);
+    if (*directory_out == NULL) {
+        return -1;
+    }
+    memcpy(*directory_out, file_path, directory_len);
+    (*directory_out)[directory_len] = '\0';
+    *file_name_out = separator + 1;
+    return 0;
+}
+
+/**
+ * @brief 创建文件监视器 / Create file watcher / Dateiüberwachung erstellen
+ * @return 成功返回监视器指针，平台不支持或失败返回NULL / Returns watcher pointer on success, NULL if unsupported or on failure / Gibt Überwachungszeiger bei Erfolg zurück, NULL wenn nicht unterstützt oder bei Fehler
+ */
+pt_platform_watch_t* pt_platform_watch_create(void) {
+    pt_platform_watch_t* watch = (pt_platform_watch_t*)calloc(1, sizeof(pt_platform_watch_t));
+    if (watch == NULL) {
+        return NULL;
+    }
+    
+#ifndef _WIN32
+    watch->fd = inotify_init();
+    if (watch->fd < 0) {
+        free(watch);
+        return NULL;
+    }
+#endif
+    
+    return watch;
+}
+
+/**
+ * @brief 添加要监视的文件 / Add file to watch / Zu überwachende Datei hinzufügen
+ * @param watch 文件监视器 / File watcher / Dateiüberwachung
+ * @param file_path 文件路径 / File path / Dateipfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_watch_add(pt_platform_watch_t* watch, const char* file_path) {
+    if (watch == NULL || file_path == NULL || watch->entry_count >= PT_WATCH_MAX_ENTRIES) {
+        return -1;
+    }
+    
+    char* directory = NULL;
+    const char* file_name = NULL;
+    if (split_watch_path(file_path, &directory, &file_name) != 0) {
+        return -1;
+    }
+    
+    pt_watch_entry_t* entry = &watch->entries[watch->entry_count];
+#ifdef _WIN32
+    /* 目录通知不区分文件，因此记录时间戳以过滤无关变化 / Directory notifications do not identify the file, so a timestamp is kept to filter unrelated changes / Verzeichnisbenachrichtigungen identifizieren die Datei nicht, daher wird ein Zeitstempel zum Filtern fremder Änderungen gespeichert */
+    (void)file_name;
+    entry->change_handle = FindFirstChangeNotificationA(directory, FALSE,
+                                                        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    free(directory);
+    if (entry->change_handle == INVALID_HANDLE_VALUE) {
+        return -1;
+    }
+    size_t path_len = strlen(file_path);
+    entry->file_path = (char*)malloc(path_len + 1);
+    if (entry->file_path == NULL) {
+        FindCloseChangeNotification(entry->change_handle);
+        return -1;
+    }
+    memcpy(entry->file_path, file_path, path_len + 1);
+    entry->timestamp = 0;
+    pt_platform_get_file_timestamp(file_path, &entry->timestamp);
+#else
+    int wd = inotify_add_watch(watch->fd, directory, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MODIFY);
+    free(directory);
+    if (wd < 0) {
+        return -1;
+    }
+    size_t name_len = strlen(file_name);
+    entry->file_name = (char*)malloc(name_len + 1);
+    if (entry->file_name == NULL) {
+        return -1;
+    }
+    memcpy(entry->file_name, file_name, name_len + 1);
+    entry->wd = wd;
+#endif
+    
+    watch->entry_count++;
+    return 0;
+}
+
+/**
+ * @brief 等待被监视文件变化 / Wait for watched file change / Auf Änderung überwachter Dateien warten
+ * @param watch 文件监视器 / File watcher / Dateiüberwachung
+ * @param timeout_ms 超时毫秒数 / Timeout in milliseconds / Zeitlimit in Millisekunden
+ * @return 被监视文件有变化返回1，超时或无关变化返回0，失败返回-1 / Returns 1 if a watched file changed, 0 on timeout or unrelated change, -1 on failure / Gibt 1 zurück, wenn eine überwachte Datei geändert wurde, 0 bei Zeitüberschreitung oder fremder Änderung, -1 bei Fehler
+ */
+int32_t pt_platform_watch_wait(pt_platform_watch_t* watch, uint32_t timeout_ms) {
+    if (watch == NULL) {
+        return -1;
+    }
+    
+#ifdef _WIN32
+    if (watch->entry_count == 0) {
+        Sleep((DWORD)timeout_ms);
+        return 0;
+    }
+    
+    HANDLE handles[PT_WATCH_MAX_ENTRIES];
+    for (size_t i = 0; i < watch->entry_count; i++) {
+        handles[i] = watch->entries[i].change_handle;
+    }
+    DWORD wait_result = WaitForMultipleObjects((DWORD)watch->entry_count, handles, FALSE, (DWORD)timeout_ms);
+    if (wait_result == WAIT_TIMEOUT) {
+        return 0;
+    }
+    if (wait_result >= WAIT_OBJECT_0 + watch->entry_count) {
+        return -1;
+    }
+    FindNextChangeNotification(handles[wait_result - WAIT_OBJECT_0]);
+    
+    int32_t changed = 0;
+    for (size_t i = 0; i < watch->entry_count; i++) {
+        int64_t timestamp = 0;
+        if (pt_platform_get_file_timestamp(watch->entries[i].file_path, &timestamp) == 0 &&
+            timestamp != watch->entries[i].timestamp) {
+            watch->entries[i].timestamp = timestamp;
+            changed = 1;
+        }
+    }
+    return changed;
+#else
+    struct pollfd poll_fd;
+    poll_fd.fd = watch->fd;
+    poll_fd.events = POLLIN;
+    poll_fd.revents = 0;
+    int poll_result = poll(&poll_fd, 1, (int)timeout_ms);
+    if (poll_result == 0) {
+        return 0;
+    }
+    if (poll_result < 0) {
+        return -1;
+    }
+    
+    /* 事件缓冲区按inotify_event对齐 / Event buffer aligned for inotify_event / Ereignispuffer für inotify_event ausgerichtet */
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    ssize_t length = read(watch->fd, buffer, sizeof(buffer));
+    if (length <= 0) {
+        return -1;
+    }
+    
+    int32_t changed = 0;
+    for (char* cursor = buffer; cursor < buffer + length; ) {
+        const struct inotify_event* event = (const struct inotify_event*)cursor;
+        if (event->len > 0) {
+            for (size_t i = 0; i < watch->entry_count; i++) {
+                if (watch->entries[i].wd == event->wd && strcmp(watch->entries[i].file_name, event->name) == 0) {
+                    changed = 1;
+                    break;
+                }
+            }
+        }
+        cursor += sizeof(struct inotify_event) + event->len;
+    }
+    return changed;
+#endif
+}
+
+/**
+ * @brief 销毁文件监视器 / Destroy file watcher / Dateiüberwachung zerstören
+ * @param watch 文件监视器 / File watcher / Dateiüberwachung
+ */
+void pt_platform_watch_destroy(pt_platform_watch_t* watch) {
+    if (watch == NULL) {
+        return;
+    }
+    
+    for (size_t i = 0; i < watch->entry_count; i++) {
+#ifdef _WIN32
+        FindCloseChangeNotification(watch->entries[i].change_handle);
+        free(watch->entries[i].file_path);
+#else
+        free(watch->entries[i].file_name);
+#endif
+    }
+#ifndef _WIN32
+    close(watch->fd);
+#endif
+    free(watch);
+}
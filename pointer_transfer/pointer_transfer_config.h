@@ -12,28 +12,36 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
  * @brief 解析入口插件配置 / Parse entry plugin configuration / Einstiegs-Plugin-Konfiguration analysieren
  * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int parse_entry_plugin_config(const char* config_path);
-
+    
 /**
  * @brief 加载传递规则配置文件 / Load transfer rules configuration file / Übertragungsregel-Konfigurationsdatei laden
  * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int load_transfer_rules(const char* config_path);
-
+    
+/**
+ * @brief 单次扫描加载传递规则并应用[EntryPlugin]段 / Load transfer rules and apply the [EntryPlugin] section in a single pass / Übertragungsregeln laden und [EntryPlugin]-Abschnitt in einem Durchlauf anwenden
+ * @param config_path 配置文件路径 / Configuration file path / Konfigurationsdateipfad
+ * @param entry_result_out 输出入口配置结果（完整为0） / Output entry configuration result (0 if complete) / Ausgabe des Einstiegskonfigurationsergebnisses (0 wenn vollständig)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int load_transfer_rules_with_entry(const char* config_path, int* entry_result_out);
+    
 /**
  * @brief 检查.nxpt文件是否已加载 / Check if .nxpt file is loaded / Prüfen, ob .nxpt-Datei geladen ist
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
  * @return 已加载返回1，未加载返回0 / Returns 1 if loaded, 0 if not loaded / Gibt 1 zurück, wenn geladen, 0 wenn nicht geladen
  */
 int is_nxpt_loaded(const char* plugin_name);
-
+    
 /**
  * @brief 标记.nxpt文件为已加载 / Mark .nxpt file as loaded / .nxpt-Datei als geladen markieren
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -41,12 +49,94 @@ int is_nxpt_loaded(const char* plugin_name);
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int mark_nxpt_loaded(const char* plugin_name, const char* nxpt_path);
-
+    
+/* 规则文件监视默认间隔（毫秒） / Default rule file watch interval (milliseconds) / Standard-Überwachungsintervall für Regeldateien (Millisekunden) */
+#define PT_DEFAULT_WATCH_INTERVAL_MS 1000
+    
 /**
- * @brief 清理已加载.nxpt文件哈希表 / Cleanup loaded .nxpt files hash table / Geladene .nxpt-Dateien-Hash-Tabelle bereinigen
+ * @brief 记录规则源文件 / Register rule source file / Regelquelldatei registrieren
+ * @param config_path .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
-void free_nxpt_hash_table_internal(void);
-
+int register_rule_source(const char* config_path);
+    
+/**
+ * @brief 释放规则源文件列表 / Free rule source file list / Regelquelldatei-Liste freigeben
+ */
+void free_rule_sources(void);
+    
+/**
+ * @brief 检查规则源文件是否在上次加载后被修改 / Check whether rule source files changed since last load / Prüfen, ob Regelquelldateien seit dem letzten Laden geändert wurden
+ * @return 有修改返回1，否则返回0 / Returns 1 if changed, 0 otherwise / Gibt 1 bei Änderung zurück, sonst 0
+ */
+int rule_sources_changed(void);
+    
+/**
+ * @brief 重新加载所有规则源文件并原子替换规则集 / Reload all rule source files and swap rule set atomically / Alle Regelquelldateien neu laden und Regelsatz atomar austauschen
+ * @details 解析失败时保留旧规则集；插件句柄和接口状态保持不变 / Keeps the old rule set if parsing fails; plugin handles and interface states are kept / Behält den alten Regelsatz bei Parse-Fehler; Plugin-Handles und Schnittstellenstatus bleiben erhalten
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int reload_transfer_rules(void);
+    
+/**
+ * @brief 获取规则集读锁（可重入） / Acquire rule set read lock (reentrant) / Regelsatz-Lesesperre erwerben (wiedereintrittsfähig)
+ */
+void acquire_rule_set_read(void);
+    
+/**
+ * @brief 释放规则集读锁 / Release rule set read lock / Regelsatz-Lesesperre freigeben
+ */
+void release_rule_set_read(void);
+    
+/**
+ * @brief 释放规则集锁 / Free rule set lock / Regelsatz-Sperre freigeben
+ */
+void free_rule_set_lock(void);
+    
+/**
+ * @brief 启动规则文件监视线程（WatchRules=1或WatchPlugins=1时） / Start rule file watcher thread (when WatchRules=1 or WatchPlugins=1) / Regeldatei-Überwachungsthread starten (bei WatchRules=1 oder WatchPlugins=1)
+ * @return 成功或未启用返回0，失败返回非0 / Returns 0 on success or when disabled, non-zero on failure / Gibt 0 bei Erfolg oder wenn deaktiviert zurück, ungleich 0 bei Fehler
+ */
+int start_rule_watcher(void);
+    
+/**
+ * @brief 停止规则文件监视线程 / Stop rule file watcher thread / Regeldatei-Überwachungsthread stoppen
+ */
+void stop_rule_watcher(void);
+    
+/**
+ * @brief 运行时添加传递规则 / Add transfer rule at runtime / Übertragungsregel zur Laufzeit hinzufügen
+ * @param rule_spec 规则描述（与[TransferRule_N]段相同的Key=Value行） / Rule specification (Key=Value lines as in a [TransferRule_N] section) / Regelbeschreibung (Key=Value-Zeilen wie in einem [TransferRule_N]-Abschnitt)
+ * @param rule_index_out 输出新规则索引 / Output new rule index / Ausgabe neuer Regelindex
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int add_transfer_rule(const char* rule_spec, size_t* rule_index_out);
+    
+/**
+ * @brief 运行时移除传递规则 / Remove transfer rule at runtime / Übertragungsregel zur Laufzeit entfernen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int remove_transfer_rule(size_t rule_index);
+    
+/**
+ * @brief 设置规则启用状态 / Set rule enabled state / Aktivierungsstatus der Regel setzen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param enabled 启用标志 / Enabled flag / Aktivierungsflag
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int set_transfer_rule_enabled(size_t rule_index, int enabled);
+    
+/**
+ * @brief 释放所有.nxptc映射（引用它们的规则释放之后调用） / Release all .nxptc mappings (call after the rules referencing them are freed) / Alle .nxptc-Zuordnungen freigeben (nach Freigabe der referenzierenden Regeln aufrufen)
+ */
+void release_compiled_rule_maps(void);
+    
+/**
+ * @brief 释放所有字符串内存区（引用它们的规则释放之后调用） / Release all string arenas (call after the rules referencing them are freed) / Alle Zeichenfolgen-Arenen freigeben (nach Freigabe der referenzierenden Regeln aufrufen)
+ */
+void release_config_string_arenas(void);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -8,6 +8,7 @@
 
 #include "pointer_transfer_types.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,6 +20,13 @@ extern "C" {
 #define INITIAL_INTERFACE_STATE_CAPACITY 8
 #define CAPACITY_GROWTH_FACTOR 2
 
+/* 无效规则图节点ID / Invalid rule graph node ID / Ungültige Regelgraph-Knoten-ID */
+#define RULE_GRAPH_INVALID_NODE SIZE_MAX
+
+/* 记忆化缓存常量 / Memoization cache constants / Memoisierungs-Cache-Konstanten */
+#define PT_DEFAULT_MEMO_CACHE_SIZE 4096
+#define PT_MEMO_CACHE_SHARD_COUNT 16
+
 /**
  * @brief 获取全局上下文指针 / Get global context pointer / Globalen Kontextzeiger abrufen
  * @return 全局上下文指针 / Global context pointer / Globaler Kontextzeiger
@@ -32,10 +40,100 @@ pointer_transfer_context_t* get_global_context(void);
 int expand_rules_capacity(void);
 
 /**
- * @brief 扩展已加载插件数组容量 / Expand loaded plugins array capacity / Geladenes Plugin-Array-Kapazität erweitern
- * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ * @brief 查找插件注册表条目 / Find plugin registry entry / Plugin-Registry-Eintrag suchen
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 条目指针，未找到返回NULL / Entry pointer, NULL if not found / Eintragszeiger, NULL wenn nicht gefunden
+ */
+plugin_registry_entry_t* find_plugin_registry_entry(const char* plugin_name);
+
+/**
+ * @brief 查找或创建插件注册表条目 / Find or create plugin registry entry / Plugin-Registry-Eintrag suchen oder erstellen
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 条目指针（在free_plugin_registry前保持有效），失败返回NULL / Entry pointer (valid until free_plugin_registry), NULL on failure / Eintragszeiger (gültig bis free_plugin_registry), NULL bei Fehler
+ */
+plugin_registry_entry_t* get_or_create_plugin_registry_entry(const char* plugin_name);
+
+/**
+ * @brief 在注册表字符串内存区中驻留字符串 / Intern string in the registry string arena / Zeichenfolge in der Zeichenfolgen-Arena der Registry internieren
+ * @param str 字符串 / String / Zeichenfolge
+ * @return 驻留的字符串，失败返回NULL / Interned string, NULL on failure / Internierte Zeichenfolge, NULL bei Fehler
+ */
+const char* intern_plugin_registry_string(const char* str);
+
+/**
+ * @brief 解析插件符号（结果缓存在条目中） / Resolve plugin symbol (result cached in the entry) / Plugin-Symbol auflösen (Ergebnis im Eintrag gecacht)
+ * @param entry 已加载插件的条目 / Entry of a loaded plugin / Eintrag eines geladenen Plugins
+ * @param symbol_name 符号名称 / Symbol name / Symbolname
+ * @return 函数指针，未找到返回NULL / Function pointer, NULL if not found / Funktionszeiger, NULL wenn nicht gefunden
+ */
+void* resolve_plugin_registry_symbol(plugin_registry_entry_t* entry, const char* symbol_name);
+
+/**
+ * @brief 记录已解析的插件符号 / Record resolved plugin symbol / Aufgelöstes Plugin-Symbol speichern
+ * @param entry 条目 / Entry / Eintrag
+ * @param symbol_name 符号名称 / Symbol name / Symbolname
+ * @param func_ptr 函数指针 / Function pointer / Funktionszeiger
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int cache_plugin_registry_symbol(plugin_registry_entry_t* entry, const char* symbol_name, void* func_ptr);
+
+/**
+ * @brief 标记插件调用进行中（调用期间不会被卸载） / Mark plugin call in flight (not unloaded during the call) / Plugin-Aufruf als laufend markieren (während des Aufrufs nicht entladen)
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 条目指针（传给unpin_plugin_registry_entry），未注册返回NULL / Entry pointer (pass to unpin_plugin_registry_entry), NULL if not registered / Eintragszeiger (an unpin_plugin_registry_entry übergeben), NULL wenn nicht registriert
+ */
+plugin_registry_entry_t* pin_plugin_registry_entry(const char* plugin_name);
+
+/**
+ * @brief 结束进行中的插件调用 / End plugin call in flight / Laufenden Plugin-Aufruf beenden
+ * @param entry pin_plugin_registry_entry返回的条目（可为NULL） / Entry returned by pin_plugin_registry_entry (may be NULL) / Von pin_plugin_registry_entry zurückgegebener Eintrag (kann NULL sein)
+ */
+void unpin_plugin_registry_entry(plugin_registry_entry_t* entry);
+
+/**
+ * @brief 按驻留策略卸载空闲插件（MaxLoadedPlugins/UnloadIdleAfter） / Evict idle plugins according to the residency policy (MaxLoadedPlugins/UnloadIdleAfter) / Leerlaufende Plugins gemäß Residenzrichtlinie entladen (MaxLoadedPlugins/UnloadIdleAfter)
+ * @details 被卸载的插件在下次使用时重新加载 / Evicted plugins are reloaded on next use / Entladene Plugins werden bei der nächsten Verwendung neu geladen
+ * @return 卸载的插件数量 / Number of plugins unloaded / Anzahl entladener Plugins
+ */
+size_t evict_idle_plugins(void);
+
+/**
+ * @brief 获取插件加载和卸载统计 / Get plugin load and unload statistics / Plugin-Lade- und Entladestatistiken abrufen
+ * @param loads_out 输出累计加载次数 / Output total loads / Ausgabe der Gesamtladevorgänge
+ * @param unloads_out 输出累计卸载次数 / Output total unloads / Ausgabe der Gesamtentladevorgänge
+ * @param resident_out 输出当前驻留数量 / Output current resident count / Ausgabe der aktuell residenten Anzahl
+ */
+void get_plugin_residency_stats(uint64_t* loads_out, uint64_t* unloads_out, size_t* resident_out);
+
+/**
+ * @brief 热替换插件：加载新版本库并发布新的函数指针，旧库在进行中的调用结束后关闭 / Hot-swap plugin: load the new library version and publish new function pointers, the old library is closed once calls in flight drain / Plugin per Hot-Swap austauschen: neue Bibliotheksversion laden und neue Funktionszeiger veröffentlichen, die alte Bibliothek wird nach Ende laufender Aufrufe geschlossen
+ * @details 在插件调用内请求时推迟到调用边界 / Deferred to the call boundary when requested inside a plugin call / Bei Anforderung innerhalb eines Plugin-Aufrufs auf die Aufrufgrenze verschoben
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 成功、已推迟或未驻留返回0，失败返回-1（保留当前版本） / Returns 0 on success, when deferred or not resident, -1 on failure (current version kept) / Gibt 0 bei Erfolg, Verschiebung oder nicht resident zurück, -1 bei Fehler (aktuelle Version bleibt)
+ */
+int hot_swap_plugin(const char* plugin_name);
+
+/**
+ * @brief 标记库文件已改变的驻留插件等待热替换（WatchPlugins=1时由监视线程调用） / Mark resident plugins whose library file changed for hot swap (called by the watcher thread when WatchPlugins=1) / Residente Plugins mit geänderter Bibliotheksdatei für Hot-Swap markieren (vom Überwachungsthread bei WatchPlugins=1 aufgerufen)
+ * @return 标记的插件数量 / Number of plugins marked / Anzahl markierter Plugins
  */
-int expand_loaded_plugins_capacity(void);
+size_t mark_changed_plugin_files(void);
+
+/**
+ * @brief 在调用边界执行推迟的热替换并关闭已退役的旧库 / Run deferred hot swaps and close retired old libraries at the call boundary / Verschobene Hot-Swaps ausführen und stillgelegte alte Bibliotheken an der Aufrufgrenze schließen
+ */
+void apply_pending_plugin_swaps(void);
+
+/**
+ * @brief 关闭所有退役的旧库 / Close all retired old libraries / Alle stillgelegten alten Bibliotheken schließen
+ * @param registry 插件注册表 / Plugin registry / Plugin-Registry
+ */
+void free_retired_plugins(plugin_registry_t* registry);
+
+/**
+ * @brief 释放插件注册表并关闭已加载的库 / Free plugin registry and close loaded libraries / Plugin-Registry freigeben und geladene Bibliotheken schließen
+ */
+void free_plugin_registry(void);
 
 /**
  * @brief 扩展接口状态数组容量 / Expand interface states array capacity / Schnittstellen-Status-Array-Kapazität erweitern
@@ -58,12 +156,51 @@ void init_context(void);
  */
 void cleanup_context(void);
 
+/**
+ * @brief 等待初始化加载完成（就绪屏障） / Wait for initialization loading to finish (readiness barrier) / Auf Abschluss des Initialisierungsladens warten (Bereitschaftsbarriere)
+ */
+void wait_for_plugin_init(void);
+
+/**
+ * @brief 确保已初始化，未开始时按默认选项同步初始化 / Ensure initialization, initializing synchronously with default options if not started / Initialisierung sicherstellen, bei nicht gestarteter Initialisierung synchron mit Standardoptionen
+ */
+void ensure_plugin_init(void);
+
+/**
+ * @brief 结束初始化和自动运行线程 / Finish initialization and auto-run threads / Initialisierungs- und Autostart-Threads beenden
+ */
+void finish_plugin_init(void);
+
 /**
  * @brief 构建规则索引 / Build rule index / Regelindex erstellen
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int build_rule_index(void);
 
+/**
+ * @brief 为规则数组构建哈希表（先释放旧表） / Build hash table for a rules array (frees the old table first) / Hash-Tabelle für ein Regel-Array erstellen (alte Tabelle wird zuerst freigegeben)
+ * @param hash_table 哈希表 / Hash table / Hash-Tabelle
+ * @param rules 规则数组 / Rules array / Regel-Array
+ * @param rule_count 规则数量 / Rule count / Regelanzahl
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_hash_table(rule_hash_table_t* hash_table, const pointer_transfer_rule_t* rules, size_t rule_count);
+
+/**
+ * @brief 释放规则哈希表 / Free rule hash table / Regel-Hash-Tabelle freigeben
+ * @param hash_table 哈希表 / Hash table / Hash-Tabelle
+ */
+void free_hash_table_for_index(rule_hash_table_t* hash_table);
+
+/**
+ * @brief 计算规则的源端哈希键 / Compute source-side hash key of a rule / Quellseitigen Hash-Schlüssel einer Regel berechnen
+ * @param source_plugin 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @return 哈希键 / Hash key / Hash-Schlüssel
+ */
+uint64_t calculate_rule_hash_key_for_index(const char* source_plugin, const char* source_interface, int source_param_index);
+
 /**
  * @brief 查找规则索引范围 / Find rule index range / Regelindex-Bereich suchen
  * @param source_plugin 源插件名称 / Source plugin name / Quell-Plugin-Name
@@ -75,12 +212,50 @@ int build_rule_index(void);
  */
 int find_rule_index_range(const char* source_plugin, const char* source_interface, int source_param_index, size_t* start_index, size_t* end_index);
 
+/**
+ * @brief 将追加的规则加入索引 / Add appended rules to index / Angehängte Regeln zum Index hinzufügen
+ * @param start_index 第一条新规则的索引 / Index of first new rule / Index der ersten neuen Regel
+ * @param hash_keys 新规则的预计算哈希键（可为NULL） / Precomputed hash keys of new rules (may be NULL) / Vorberechnete Hash-Schlüssel der neuen Regeln (kann NULL sein)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int index_appended_rules(size_t start_index, const uint64_t* hash_keys);
+
+/**
+ * @brief 从索引移除规则 / Remove rule from index / Regel aus Index entfernen
+ * @param rule_index 规则索引（规则字符串必须仍然有效） / Rule index (rule strings must still be valid) / Regelindex (Regel-Zeichenfolgen müssen noch gültig sein)
+ * @return 成功返回0，未找到返回-1 / Returns 0 on success, -1 if not found / Gibt 0 bei Erfolg zurück, -1 wenn nicht gefunden
+ */
+int unindex_rule(size_t rule_index);
+
 /**
  * @brief 构建规则缓存 / Build rule cache / Regel-Cache erstellen
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int build_rule_cache(void);
 
+/**
+ * @brief 收集规则数组中CacheSelf规则的索引 / Collect indices of CacheSelf rules in a rules array / Indizes der CacheSelf-Regeln eines Regel-Arrays sammeln
+ * @param rules 规则数组 / Rules array / Regel-Array
+ * @param rule_count 规则数量 / Rule count / Regelanzahl
+ * @param indices_out 输出索引数组（无CacheSelf规则时为NULL） / Output index array (NULL without CacheSelf rules) / Ausgabe-Index-Array (NULL ohne CacheSelf-Regeln)
+ * @param count_out 输出索引数量 / Output index count / Ausgabe-Indexanzahl
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_cached_rule_indices(const pointer_transfer_rule_t* rules, size_t rule_count, size_t** indices_out, size_t* count_out);
+
+/**
+ * @brief 将追加的CacheSelf规则加入缓存 / Add appended CacheSelf rules to cache / Angehängte CacheSelf-Regeln zum Cache hinzufügen
+ * @param start_index 第一条新规则的索引 / Index of first new rule / Index der ersten neuen Regel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int append_rule_cache(size_t start_index);
+
+/**
+ * @brief 从缓存移除规则 / Remove rule from cache / Regel aus Cache entfernen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ */
+void remove_rule_from_cache(size_t rule_index);
+
 /**
  * @brief 获取缓存的规则数量 / Get cached rule count / Anzahl gecachter Regeln abrufen
  * @return 缓存的规则数量 / Cached rule count / Anzahl gecachter Regeln
@@ -93,6 +268,248 @@ size_t get_cached_rule_count(void);
  */
 const size_t* get_cached_rule_indices(void);
 
+/**
+ * @brief 构建静态规则图（接口ID驻留、强连通分量和拓扑序） / Build static rule graph (interface ID interning, SCCs and topological order) / Statischen Regelgraphen erstellen (Schnittstellen-ID-Internierung, SCCs und topologische Ordnung)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_graph(void);
+
+/**
+ * @brief 为规则数组构建规则图的边和强连通分量 / Build edges and SCCs of a rule graph for a rules array / Kanten und SCCs eines Regelgraphen für ein Regel-Array erstellen
+ * @param graph 规则图（保留已驻留的节点） / Rule graph (interned nodes are kept) / Regelgraph (internierte Knoten bleiben erhalten)
+ * @param rules 规则数组 / Rules array / Regel-Array
+ * @param rule_count 规则数量 / Rule count / Regelanzahl
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int build_rule_graph_for_rules(rule_graph_t* graph, const pointer_transfer_rule_t* rules, size_t rule_count);
+
+/**
+ * @brief 复制规则图的驻留节点（保持节点ID） / Copy the interned nodes of a rule graph (keeping node IDs) / Internierte Knoten eines Regelgraphen kopieren (Knoten-IDs bleiben erhalten)
+ * @param dst 目标规则图（必须为空） / Destination rule graph (must be empty) / Ziel-Regelgraph (muss leer sein)
+ * @param src 源规则图 / Source rule graph / Quell-Regelgraph
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int clone_rule_graph_nodes(rule_graph_t* dst, const rule_graph_t* src);
+
+/**
+ * @brief 释放规则图的全部数据 / Free all data of a rule graph / Alle Daten eines Regelgraphen freigeben
+ * @param graph 规则图 / Rule graph / Regelgraph
+ */
+void release_rule_graph(rule_graph_t* graph);
+
+/**
+ * @brief 驻留接口标识，返回稳定的节点ID / Intern interface identifier, return stable node ID / Schnittstellenbezeichner internieren, stabile Knoten-ID zurückgeben
+ * @param graph 规则图 / Rule graph / Regelgraph
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @return 节点ID，失败返回RULE_GRAPH_INVALID_NODE / Node ID, RULE_GRAPH_INVALID_NODE on failure / Knoten-ID, RULE_GRAPH_INVALID_NODE bei Fehler
+ */
+size_t intern_rule_graph_node(rule_graph_t* graph, const char* plugin_name, const char* interface_name);
+
+/**
+ * @brief 计算强连通分量和拓扑序 / Compute SCCs and topological order / SCCs und topologische Ordnung berechnen
+ * @param graph 规则图（边已构建） / Rule graph (edges built) / Regelgraph (Kanten erstellt)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int compute_rule_graph_scc(rule_graph_t* graph);
+
+/**
+ * @brief 在拓扑序号区间内计算强连通分量 / Compute SCCs within a topological rank range / SCCs innerhalb eines topologischen Rangbereichs berechnen
+ * @param graph 规则图 / Rule graph / Regelgraph
+ * @param roots 根节点数组（NULL表示所有节点） / Root node array (NULL means all nodes) / Wurzelknoten-Array (NULL bedeutet alle Knoten)
+ * @param root_count 根节点数量 / Root node count / Anzahl der Wurzelknoten
+ * @param min_rank 最小拓扑序号 / Minimum topological rank / Minimaler topologischer Rang
+ * @param max_rank 最大拓扑序号 / Maximum topological rank / Maximaler topologischer Rang
+ * @param members 输出访问到的节点 / Output visited nodes / Ausgabe besuchter Knoten
+ * @param member_count_out 输出访问到的节点数量 / Output visited node count / Ausgabe Anzahl besuchter Knoten
+ * @param changed 输出cyclic发生变化的节点（可为NULL） / Output nodes whose cyclic flag changed (may be NULL) / Ausgabe der Knoten mit geändertem cyclic-Flag (kann NULL sein)
+ * @param changed_count_out 输出变化节点数量（可为NULL） / Output changed node count (may be NULL) / Ausgabe Anzahl geänderter Knoten (kann NULL sein)
+ * @return 产出的分量数量，失败返回RULE_GRAPH_INVALID_NODE / Number of emitted components, RULE_GRAPH_INVALID_NODE on failure / Anzahl gelieferter Komponenten, RULE_GRAPH_INVALID_NODE bei Fehler
+ */
+size_t compute_rule_graph_region_scc(rule_graph_t* graph, const size_t* roots, size_t root_count,
+                                     size_t min_rank, size_t max_rank, size_t* members, size_t* member_count_out,
+                                     size_t* changed, size_t* changed_count_out);
+
+/**
+ * @brief 把追加的规则加入规则图（只更新受影响的边和分量） / Add appended rules to the rule graph (only affected edges and components are updated) / Angehängte Regeln in den Regelgraphen aufnehmen (nur betroffene Kanten und Komponenten werden aktualisiert)
+ * @param start_rule_index 第一条追加规则的索引 / Index of the first appended rule / Index der ersten angehängten Regel
+ * @return 成功返回0，失败返回-1（需完整重建） / Returns 0 on success, -1 on failure (full rebuild needed) / Gibt 0 bei Erfolg zurück, -1 bei Fehler (vollständiger Neuaufbau nötig)
+ */
+int add_rule_graph_rules(size_t start_rule_index);
+
+/**
+ * @brief 从规则图移除规则（只更新受影响的边和分量） / Remove a rule from the rule graph (only affected edges and components are updated) / Regel aus dem Regelgraphen entfernen (nur betroffene Kanten und Komponenten werden aktualisiert)
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param cache_self 被移除规则的CacheSelf标志 / CacheSelf flag of the removed rule / CacheSelf-Flag der entfernten Regel
+ * @return 成功返回0，失败返回-1（需完整重建） / Returns 0 on success, -1 on failure (full rebuild needed) / Gibt 0 bei Erfolg zurück, -1 bei Fehler (vollständiger Neuaufbau nötig)
+ */
+int remove_rule_graph_rule(size_t rule_index, int cache_self);
+
+/**
+ * @brief 完整重建规则图并同步记忆化缓存（批量合并期间延迟） / Fully rebuild rule graph and synchronize memoization cache (deferred during batch merge) / Regelgraph vollständig neu aufbauen und Memoisierungs-Cache abgleichen (während Stapelzusammenführung verzögert)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int refresh_rule_graph(void);
+
+/**
+ * @brief 把追加的规则增量加入规则图（失败时完整重建） / Add appended rules to the rule graph incrementally (full rebuild on failure) / Angehängte Regeln inkrementell in den Regelgraphen aufnehmen (vollständiger Neuaufbau bei Fehler)
+ * @param start_rule_index 第一条追加规则的索引 / Index of the first appended rule / Index der ersten angehängten Regel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int update_rule_graph_appended(size_t start_rule_index);
+
+/**
+ * @brief 把移除的规则增量移出规则图（失败时完整重建） / Remove a removed rule from the rule graph incrementally (full rebuild on failure) / Entfernte Regel inkrementell aus dem Regelgraphen nehmen (vollständiger Neuaufbau bei Fehler)
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param cache_self 被移除规则的CacheSelf标志 / CacheSelf flag of the removed rule / CacheSelf-Flag der entfernten Regel
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int update_rule_graph_removed(size_t rule_index, int cache_self);
+
+/**
+ * @brief 记录规则图所有节点的纯接口和环状态 / Record purity and cycle state of all rule graph nodes / Reinheit und Zyklusstatus aller Regelgraph-Knoten festhalten
+ * @param graph 规则图 / Rule graph / Regelgraph
+ * @param count_out 输出节点数量 / Output node count / Ausgabe Knotenanzahl
+ * @return 状态位数组（调用方释放），无节点或失败返回NULL / State bit array (caller frees), NULL without nodes or on failure / Statusbit-Array (Aufrufer gibt frei), NULL ohne Knoten oder bei Fehler
+ */
+unsigned char* snapshot_rule_graph_flags(const rule_graph_t* graph, size_t* count_out);
+
+/**
+ * @brief 只丢弃状态相对快照变化的节点的记忆化结果 / Drop memoized results only of nodes whose state changed since the snapshot / Memoisierte Ergebnisse nur von Knoten verwerfen, deren Status sich seit dem Schnappschuss geändert hat
+ * @param flags 变化前的状态位 / State bits before the change / Statusbits vor der Änderung
+ * @param flag_count 变化前的节点数量 / Node count before the change / Knotenanzahl vor der Änderung
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int sync_memo_cache_with_graph(const unsigned char* flags, size_t flag_count);
+
+/**
+ * @brief 开始批量合并规则 / Begin batch rule merge / Stapel-Regelzusammenführung beginnen
+ */
+void begin_rule_batch(void);
+
+/**
+ * @brief 结束批量合并规则，必要时重建规则图 / End batch rule merge, rebuilding rule graph if needed / Stapel-Regelzusammenführung beenden, Regelgraph bei Bedarf neu aufbauen
+ */
+void end_rule_batch(void);
+
+/**
+ * @brief 释放静态规则图 / Free static rule graph / Statischen Regelgraphen freigeben
+ */
+void free_rule_graph(void);
+
+/**
+ * @brief 查找接口的规则图节点ID / Find rule graph node ID of interface / Regelgraph-Knoten-ID einer Schnittstelle suchen
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @return 节点ID，未找到返回RULE_GRAPH_INVALID_NODE / Node ID, RULE_GRAPH_INVALID_NODE if not found / Knoten-ID, RULE_GRAPH_INVALID_NODE wenn nicht gefunden
+ */
+size_t find_rule_graph_node(const char* plugin_name, const char* interface_name);
+
+/**
+ * @brief 获取规则目标接口的规则图节点ID / Get rule graph node ID of rule target interface / Regelgraph-Knoten-ID der Regel-Zielschnittstelle abrufen
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @return 节点ID，未找到返回RULE_GRAPH_INVALID_NODE / Node ID, RULE_GRAPH_INVALID_NODE if not found / Knoten-ID, RULE_GRAPH_INVALID_NODE wenn nicht gefunden
+ */
+size_t get_rule_target_graph_node(const pointer_transfer_rule_t* rule);
+
+/**
+ * @brief 检查规则图节点是否位于环中 / Check if rule graph node is part of a cycle / Prüfen, ob Regelgraph-Knoten Teil eines Zyklus ist
+ * @param node_id 节点ID / Node ID / Knoten-ID
+ * @return 位于环中返回1，否则返回0 / Returns 1 if cyclic, 0 otherwise / Gibt 1 zurück wenn zyklisch, sonst 0
+ */
+int is_rule_graph_node_cyclic(size_t node_id);
+
+/**
+ * @brief 检查规则图节点是否为可记忆化的纯接口 / Check if rule graph node is a memoizable pure interface / Prüfen, ob Regelgraph-Knoten eine memoisierbare reine Schnittstelle ist
+ * @param node_id 节点ID / Node ID / Knoten-ID
+ * @return 可记忆化返回1，否则返回0 / Returns 1 if memoizable, 0 otherwise / Gibt 1 zurück wenn memoisierbar, sonst 0
+ */
+int is_rule_graph_node_memoizable(size_t node_id);
+
+/**
+ * @brief 获取规则图节点的拓扑序号 / Get topological rank of rule graph node / Topologischen Rang eines Regelgraph-Knotens abrufen
+ * @param node_id 节点ID / Node ID / Knoten-ID
+ * @return 拓扑序号，无效节点返回RULE_GRAPH_INVALID_NODE / Topological rank, RULE_GRAPH_INVALID_NODE for an invalid node / Topologischer Rang, RULE_GRAPH_INVALID_NODE bei ungültigem Knoten
+ */
+size_t get_rule_graph_node_rank(size_t node_id);
+
+/**
+ * @brief 初始化记忆化缓存（清空已有条目） / Initialize memoization cache (flushes existing entries) / Memoisierungs-Cache initialisieren (leert vorhandene Einträge)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int init_memo_cache(void);
+
+/**
+ * @brief 释放记忆化缓存 / Free memoization cache / Memoisierungs-Cache freigeben
+ */
+void free_memo_cache(void);
+
+/**
+ * @brief 出现纯接口时按需分配记忆化缓存（不清空已有条目） / Allocate memoization cache on demand once pure interfaces exist (keeps existing entries) / Memoisierungs-Cache bei Bedarf zuweisen, sobald reine Schnittstellen existieren (behält vorhandene Einträge)
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int ensure_memo_cache(void);
+
+/**
+ * @brief 查找记忆化结果 / Look up memoized result / Memoisiertes Ergebnis suchen
+ * @param hash_key 参数包哈希 / Parameter pack hash / Parameterpaket-Hash
+ * @param node_id 目标接口节点ID / Target interface node ID / Zielschnittstellen-Knoten-ID
+ * @param key_data 序列化的键 / Serialized key / Serialisierter Schlüssel
+ * @param key_size 键大小 / Key size / Schlüsselgröße
+ * @param return_type_out 输出返回值类型 / Output return type / Ausgabe-Rückgabetyp
+ * @param result_int_out 输出整数结果 / Output integer result / Ausgabe-Ganzzahlergebnis
+ * @param result_float_out 输出浮点数结果 / Output float result / Ausgabe-Gleitkommaergebnis
+ * @param value_out 输出结果副本（调用者释放，可为NULL） / Output result copy (caller frees, may be NULL) / Ausgabe-Ergebniskopie (Aufrufer gibt frei, kann NULL sein)
+ * @param value_size_out 输出结果副本大小 / Output result copy size / Ausgabe-Größe der Ergebniskopie
+ * @return 命中返回0，未命中返回-1 / Returns 0 on hit, -1 on miss / Gibt 0 bei Treffer zurück, -1 bei Fehltreffer
+ */
+int memo_cache_lookup(uint64_t hash_key, size_t node_id, const unsigned char* key_data, size_t key_size,
+                      pt_return_type_t* return_type_out, int64_t* result_int_out, double* result_float_out,
+                      void** value_out, size_t* value_size_out);
+
+/**
+ * @brief 存储记忆化结果 / Store memoized result / Memoisiertes Ergebnis speichern
+ * @param hash_key 参数包哈希 / Parameter pack hash / Parameterpaket-Hash
+ * @param node_id 目标接口节点ID / Target interface node ID / Zielschnittstellen-Knoten-ID
+ * @param key_data 序列化的键 / Serialized key / Serialisierter Schlüssel
+ * @param key_size 键大小 / Key size / Schlüsselgröße
+ * @param return_type 返回值类型 / Return type / Rückgabetyp
+ * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
+ * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
+ * @param value_data 结构体或字符串结果（可为NULL） / Struct or string result (may be NULL) / Struktur- oder Zeichenfolgenergebnis (kann NULL sein)
+ * @param value_size 结果大小 / Result size / Ergebnisgröße
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int memo_cache_store(uint64_t hash_key, size_t node_id, const unsigned char* key_data, size_t key_size,
+                     pt_return_type_t return_type, int64_t result_int, double result_float,
+                     const void* value_data, size_t value_size);
+
+/**
+ * @brief 丢弃某插件接口的记忆化结果 / Drop memoized results of a plugin's interfaces / Memoisierte Ergebnisse der Schnittstellen eines Plugins verwerfen
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 丢弃的条目数量 / Number of entries dropped / Anzahl verworfener Einträge
+ */
+size_t invalidate_memo_cache_plugin(const char* plugin_name);
+
+/**
+ * @brief 丢弃指定规则图节点的记忆化结果 / Drop memoized results of the given rule graph nodes / Memoisierte Ergebnisse der angegebenen Regelgraph-Knoten verwerfen
+ * @param node_ids 节点ID数组 / Node ID array / Knoten-ID-Array
+ * @param node_count 节点数量 / Node count / Knotenanzahl
+ * @return 丢弃的条目数量 / Number of dropped entries / Anzahl verworfener Einträge
+ */
+size_t invalidate_memo_cache_nodes(const size_t* node_ids, size_t node_count);
+
+/**
+ * @brief 获取记忆化缓存统计 / Get memoization cache statistics / Memoisierungs-Cache-Statistiken abrufen
+ * @param hits_out 输出命中次数 / Output hit count / Ausgabe-Trefferanzahl
+ * @param misses_out 输出未命中次数 / Output miss count / Ausgabe-Fehltrefferanzahl
+ * @param evictions_out 输出淘汰次数 / Output eviction count / Ausgabe-Verdrängungsanzahl
+ * @param expirations_out 输出过期次数 / Output expiration count / Ausgabe-Ablaufanzahl
+ * @param entries_out 输出有效条目数量 / Output live entry count / Ausgabe-Anzahl gültiger Einträge
+ */
+void get_memo_cache_stats(uint64_t* hits_out, uint64_t* misses_out, uint64_t* evictions_out,
+                          uint64_t* expirations_out, size_t* entries_out);
+
 /**
  * @brief 检查插件路径是否在忽略列表中 / Check if plugin path is in ignore list / Prüfen, ob Plugin-Pfad in Ignorierliste ist
  * @param plugin_path 插件路径（可以是绝对路径或相对路径） / Plugin path (can be absolute or relative path) / Plugin-Pfad (kann absoluter oder relativer Pfad sein)
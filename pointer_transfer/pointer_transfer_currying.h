@@ -14,7 +14,7 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
  * @brief 柯里化参数结构体 / Curried Parameter Structure / Currying-Parameter-Struktur
  */
@@ -30,7 +30,7 @@ typedef struct {
         void* ptr_val;              /**< 指针值 / Pointer value / Zeigerwert */
     } value;
 } pt_curried_param_t;
-
+    
 /**
  * @brief 参数包结构体 / Parameter Pack Structure / Parameterpaket-Struktur
  */
@@ -38,6 +38,36 @@ typedef struct {
     int param_count;                /**< 参数数量 / Parameter count / Parameteranzahl */
     pt_curried_param_t* params;     /**< 参数数组 / Parameter array / Parameter-Array */
 } pt_param_pack_t;
+    
+/* 版本2参数包的标识（与pointer_transfer_plugin_types.h一致） / Tag of version 2 packs (matches pointer_transfer_plugin_types.h) / Kennung von Paketen der Version 2 (wie in pointer_transfer_plugin_types.h) */
+#define PT_PARAM_PACK_V2_MAGIC 0x32765450u
+    
+/**
+ * @brief 版本2参数包头（结构数组布局） / Version 2 parameter pack header (struct-of-arrays layout) / Kopf des Parameterpakets Version 2 (Struct-of-Arrays-Layout)
+ */
+typedef struct {
+    uint32_t magic;                 /**< PT_PARAM_PACK_V2_MAGIC / PT_PARAM_PACK_V2_MAGIC / PT_PARAM_PACK_V2_MAGIC */
+    uint32_t param_count;           /**< 参数数量 / Parameter count / Parameteranzahl */
+    const uint64_t* values;         /**< 参数值槽（与pt_curried_param_t.value布局相同） / Parameter value slots (same layout as pt_curried_param_t.value) / Parameterwert-Slots (gleiches Layout wie pt_curried_param_t.value) */
+    const size_t* sizes;            /**< 参数大小，均为自然大小时为NULL / Parameter sizes, NULL when all are natural sizes / Parametergrößen, NULL wenn alle natürliche Größen sind */
+    const uint8_t* types;           /**< 参数类型 / Parameter types / Parametertypen */
+} pt_param_pack_v2_t;
+
+/* 批量接口的名称后缀（与pointer_transfer_plugin_types.h一致） / Name suffix of batch interfaces (matches pointer_transfer_plugin_types.h) / Namenssuffix von Batch-Schnittstellen (wie in pointer_transfer_plugin_types.h) */
+#define PT_BATCH_INTERFACE_SUFFIX "_Vec"
+
+/**
+ * @brief 批量调用（列布局，传给<Interface>_Vec） / Batch call (column layout, passed to <Interface>_Vec) / Batch-Aufruf (Spaltenlayout, an <Interface>_Vec übergeben)
+ */
+typedef struct {
+    uint32_t count;                 /**< 行数 / Row count / Zeilenanzahl */
+    uint32_t param_count;           /**< 列数 / Column count / Spaltenanzahl */
+    const uint8_t* types;           /**< 每列的参数类型 / Parameter type of each column / Parametertyp jeder Spalte */
+    const size_t* sizes;            /**< 每列的参数大小 / Parameter size of each column / Parametergröße jeder Spalte */
+    const uint64_t* const* columns; /**< 值槽columns[param][row]（与pt_curried_param_t.value布局相同） / Value slots columns[param][row] (same layout as pt_curried_param_t.value) / Wert-Slots columns[param][row] (gleiches Layout wie pt_curried_param_t.value) */
+    uint64_t* results;              /**< 输出值槽results[row] / Output value slots results[row] / Ausgabe-Wert-Slots results[row] */
+    uint8_t* row_done;              /**< 输出每行完成标志 / Output per-row completion flags / Ausgabe der Abschlussflags je Zeile */
+} pt_batch_t;
 
 /**
  * @brief 创建参数包 / Create parameter pack / Parameterpaket erstellen
@@ -48,20 +78,21 @@ typedef struct {
  * @return 成功返回参数包指针，失败返回NULL / Returns parameter pack pointer on success, NULL on failure / Gibt Parameterpaket-Zeiger bei Erfolg zurück, NULL bei Fehler
  */
 pt_param_pack_t* pt_create_param_pack(int param_count, nxld_param_type_t* param_types, void** param_values, size_t* param_sizes);
-
+    
 /**
  * @brief 释放参数包 / Free parameter pack / Parameterpaket freigeben
  * @param pack 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
  */
 void pt_free_param_pack(pt_param_pack_t* pack);
-
+    
 /**
  * @brief 序列化参数包为单个指针 / Serialize parameter pack to single pointer / Parameterpaket in einzelnen Zeiger serialisieren
  * @param pack 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
+ * @param param_borrowed 参数借用标志数组，可为NULL；置位的结构体参数不复制到内存块中 / Parameter borrow flags array, can be NULL; flagged struct parameters are not copied into the block / Parameter-Ausleih-Flag-Array, kann NULL sein; markierte Strukturparameter werden nicht in den Block kopiert
  * @return 成功返回序列化后的指针，失败返回NULL / Returns serialized pointer on success, NULL on failure / Gibt serialisierten Zeiger bei Erfolg zurück, NULL bei Fehler
  */
-void* pt_serialize_param_pack(pt_param_pack_t* pack);
-
+void* pt_serialize_param_pack(pt_param_pack_t* pack, const int* param_borrowed);
+    
 /**
  * @brief 反序列化指针为参数包 / Deserialize pointer to parameter pack / Zeiger in Parameterpaket deserialisieren
  * @param data 序列化数据指针（由pt_serialize_param_pack返回的连续内存块）/ Serialized data pointer (contiguous memory block returned by pt_serialize_param_pack) / Serialisierter Datenzeiger (zusammenhängender Speicherblock, zurückgegeben von pt_serialize_param_pack)
@@ -69,22 +100,31 @@ void* pt_serialize_param_pack(pt_param_pack_t* pack);
  * @note 序列化后的数据格式与pt_param_pack_t完全兼容，支持直接类型转换。此函数主要用于设置params指针（当其为NULL时）并验证数据有效性。插件可将void*直接转换为pt_param_pack_t*使用 / Serialized data format is fully compatible with pt_param_pack_t and supports direct type casting. This function is primarily used to set params pointer (when NULL) and validate data validity. Plugins may directly cast void* to pt_param_pack_t* / Serialisiertes Datenformat ist vollständig mit pt_param_pack_t kompatibel und unterstützt direkte Typumwandlung. Diese Funktion wird hauptsächlich verwendet, um params-Zeiger zu setzen (wenn NULL) und Datenvalidität zu überprüfen. Plugins können void* direkt in pt_param_pack_t* umwandeln
  */
 pt_param_pack_t* pt_deserialize_param_pack(void* data);
-
+    
 /**
  * @brief 释放序列化的参数包 / Free serialized parameter pack / Serialisiertes Parameterpaket freigeben
  * @param data 序列化数据指针（由pt_serialize_param_pack返回）/ Serialized data pointer (returned by pt_serialize_param_pack) / Serialisierter Datenzeiger (von pt_serialize_param_pack zurückgegeben)
  */
 void pt_free_serialized_param_pack(void* data);
-
+    
+/**
+ * @brief 将参数包序列化为版本2布局 / Serialize parameter pack into the version 2 layout / Parameterpaket in das Layout der Version 2 serialisieren
+ * @param pack 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
+ * @param param_borrowed 参数借用标志数组，可为NULL（同pt_serialize_param_pack） / Parameter borrow flags array, can be NULL (as in pt_serialize_param_pack) / Parameter-Ausleih-Flag-Array, kann NULL sein (wie bei pt_serialize_param_pack)
+ * @return 成功返回连续内存块（用pt_free_serialized_param_pack释放），失败返回NULL / Returns a contiguous memory block (freed with pt_free_serialized_param_pack), NULL on failure / Gibt einen zusammenhängenden Speicherblock zurück (mit pt_free_serialized_param_pack freizugeben), NULL bei Fehler
+ */
+void* pt_serialize_param_pack_v2(const pt_param_pack_t* pack, const int* param_borrowed);
+    
 /**
  * @brief 验证参数包结构符合ABI约定 / Validate parameter pack structure conforms to ABI convention / Parameterpaket-Strukturvalidierung gemäß ABI-Konvention
  * @param pack 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
  * @return 有效返回0，无效返回-1 / Returns 0 if valid, -1 if invalid / Gibt 0 zurück wenn gültig, -1 wenn ungültig
  */
 int32_t pt_validate_param_pack(pt_param_pack_t* pack);
-
+    
 /**
  * @brief 验证插件函数兼容性 / Validate plugin function compatibility / Plugin-Funktionskompatibilität validieren
+ * @param handle 插件库句柄，NULL时只能试调用 / Plugin library handle, only trial calls are possible when NULL / Plugin-Bibliotheks-Handle, bei NULL sind nur Probeaufrufe möglich
  * @param func_ptr 插件函数指针 / Plugin function pointer / Plugin-Funktionszeiger
  * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
  * @param interface_name 接口名称 / Interface name / Schnittstellenname
@@ -93,12 +133,35 @@ int32_t pt_validate_param_pack(pt_param_pack_t* pack);
  * @return 验证通过返回0，失败返回-1 / Returns 0 if validation passes, -1 on failure / Gibt 0 zurück wenn Validierung erfolgreich, -1 bei Fehler
  * @note 当验证已通过且插件文件时间戳未变更时，跳过重复验证 / When validation has passed and plugin file timestamp is unchanged, skip repeated validation / Wenn Validierung erfolgreich war und Plugin-Datei-Zeitstempel unverändert ist, wiederholte Validierung überspringen
  */
-int32_t pt_validate_plugin_function(void* func_ptr, const char* plugin_path, const char* interface_name, int expected_param_count, pt_return_type_t return_type);
-
+int32_t pt_validate_plugin_function(void* handle, void* func_ptr, const char* plugin_path, const char* interface_name, int expected_param_count, pt_return_type_t return_type);
+    
+/**
+ * @brief 静态验证插件函数（不调用插件函数） / Validate plugin function statically (without calling it) / Plugin-Funktion statisch validieren (ohne sie aufzurufen)
+ * @param handle 插件库句柄 / Plugin library handle / Plugin-Bibliotheks-Handle
+ * @param func_ptr 插件函数指针 / Plugin function pointer / Plugin-Funktionszeiger
+ * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @param expected_param_count 期望的参数数量 / Expected parameter count / Erwartete Parameteranzahl
+ * @param return_type 返回值类型 / Return type / Rückgabetyp
+ * @return 验证通过返回0，失败返回-1 / Returns 0 if validation passes, -1 on failure / Gibt 0 zurück wenn Validierung erfolgreich, -1 bei Fehler
+ * @note 检查导出符号、插件元数据和规则集，不执行插件代码（元数据查询函数除外） / Checks exported symbols, plugin metadata and the rule set without running plugin code (apart from the metadata queries) / Prüft exportierte Symbole, Plugin-Metadaten und den Regelsatz, ohne Plugin-Code auszuführen (abgesehen von den Metadatenabfragen)
+ */
+int32_t pt_validate_plugin_static(void* handle, void* func_ptr, const char* plugin_path, const char* interface_name,
+                                  int expected_param_count, pt_return_type_t return_type);
+    
+/**
+ * @brief 检查插件是否允许试调用验证 / Check if plugin opts into trial call validation / Prüfen, ob Plugin der Validierung per Probeaufruf zustimmt
+ * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
+ * @return 文件名在TrialCalls列表中返回1，否则返回0 / Returns 1 if the file name is in the TrialCalls list, 0 otherwise / Gibt 1 zurück, wenn der Dateiname in der TrialCalls-Liste steht, sonst 0
+ */
+int pt_plugin_allows_trial_call(const char* plugin_path);
+    
 /**
  * @brief 柯里化调用函数 / Call function using currying / Funktion mit Currying aufrufen
  * @param func_ptr 函数指针 / Function pointer / Funktionszeiger
  * @param pack 参数包指针 / Parameter pack pointer / Parameterpaket-Zeiger
+ * @param param_borrowed 参数借用标志数组，可为NULL；置位的结构体参数直接传递原指针 / Parameter borrow flags array, can be NULL; flagged struct parameters pass the original pointer / Parameter-Ausleih-Flag-Array, kann NULL sein; markierte Strukturparameter übergeben den Originalzeiger
+ * @param pack_version 插件接受的参数包版本（NXLD_PACK_VERSION_*） / Parameter pack version accepted by the plugin (NXLD_PACK_VERSION_*) / Vom Plugin akzeptierte Parameterpaket-Version (NXLD_PACK_VERSION_*)
  * @param return_type 返回值类型 / Return type / Rückgabetyp
  * @param return_size 返回值大小 / Return size / Rückgabegröße
  * @param result_int 输出整数返回值指针 / Output integer return value pointer / Ausgabe-Integer-Rückgabewert-Zeiger
@@ -106,67 +169,103 @@ int32_t pt_validate_plugin_function(void* func_ptr, const char* plugin_path, con
  * @param result_struct 输出结构体返回值缓冲区 / Output struct return value buffer / Ausgabe-Struktur-Rückgabewert-Puffer
  * @return 成功返回0，失败返回非0值 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
-int32_t pt_call_with_currying(void* func_ptr, pt_param_pack_t* pack, 
+int32_t pt_call_with_currying(void* func_ptr, pt_param_pack_t* pack, const int* param_borrowed, uint32_t pack_version,
                                pt_return_type_t return_type, size_t return_size,
                                int64_t* result_int, double* result_float, void* result_struct);
-
+    
 /* 内部函数声明 / Internal function declarations / Interne Funktionsdeklarationen */
-
+    
 /**
- * @brief 构建.nxpv文件路径 / Build .nxpv file path / .nxpv-Dateipfad erstellen
+ * @brief 检查接口验证缓存是否有效 / Check if interface validation cache is valid / Prüfen, ob der Schnittstellen-Validierungs-Cache gültig ist
  */
-int pt_build_nxpv_path(const char* plugin_path, char* nxpv_path, size_t buffer_size);
-
+int32_t pt_check_validation_cache(const char* plugin_path, const char* interface_name, int param_count,
+                                  pt_return_type_t return_type, int* cache_valid);
+    
 /**
- * @brief 从.nxpv文件读取验证信息 / Read validation info from .nxpv file / Validierungsinformationen aus .nxpv-Datei lesen
+ * @brief 记录接口验证结果 / Record interface validation result / Schnittstellen-Validierungsergebnis speichern
  */
-int32_t pt_read_validation_from_nxpv(const char* nxpv_path, int64_t* timestamp, int* is_valid);
-
+int32_t pt_record_validation_result(const char* plugin_path, const char* interface_name, int param_count,
+                                    pt_return_type_t return_type, int is_valid);
+    
 /**
- * @brief 生成.nxpv验证文件 / Generate .nxpv validation file / .nxpv-Validierungsdatei generieren
+ * @brief 缓存的接口元数据 / Cached interface metadata / Zwischengespeicherte Schnittstellen-Metadaten
  */
-int32_t pt_generate_nxpv_file(const char* plugin_path, int64_t timestamp, int is_valid);
-
+typedef struct {
+    size_t interface_index;        /**< 插件中的接口索引 / Interface index in the plugin / Schnittstellenindex im Plugin */
+    pt_return_type_t return_type;  /**< 推断的返回值类型 / Inferred return type / Abgeleiteter Rückgabetyp */
+    size_t return_size;            /**< 返回值大小 / Return size / Rückgabegröße */
+    nxld_param_count_type_t param_count_type; /**< 参数数量类型 / Parameter count type / Parameteranzahl-Typ */
+    int32_t min_count;             /**< 最小参数数量 / Minimum parameter count / Mindestparameteranzahl */
+    int32_t max_count;             /**< 最大参数数量 / Maximum parameter count / Maximalparameteranzahl */
+    nxld_param_type_t* param_types; /**< 参数类型（读取时新分配，调用者释放） / Parameter types (newly allocated when loaded, caller frees) / Parametertypen (beim Laden neu zugewiesen, Aufrufer gibt frei) */
+    int param_type_count;          /**< 参数类型数量 / Parameter type count / Anzahl der Parametertypen */
+    nxld_call_convention_t call_convention; /**< 插件描述符声明的调用约定 / Calling convention declared by the plugin descriptor / Vom Plugin-Deskriptor deklarierte Aufrufkonvention */
+    nxld_return_type_t native_return_type; /**< 描述符声明的返回值类型（原生调用使用） / Return type declared by the descriptor (used by native calls) / Vom Deskriptor deklarierter Rückgabetyp (für native Aufrufe) */
+} pt_cached_metadata_t;
+    
 /**
- * @brief 检查验证缓存是否有效 / Check if validation cache is valid / Prüfen, ob Validierungs-Cache gültig ist
+ * @brief 从验证数据库读取接口元数据 / Load interface metadata from the validation database / Schnittstellen-Metadaten aus der Validierungsdatenbank laden
+ * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @param metadata_out 输出元数据 / Output metadata / Ausgabe-Metadaten
+ * @return 命中返回0，文件变化或无记录返回-1 / Returns 0 on a hit, -1 if the file changed or no record exists / Gibt 0 bei einem Treffer zurück, -1 wenn sich die Datei geändert hat oder kein Datensatz existiert
  */
-int32_t pt_check_validation_cache(const char* plugin_path, int* cache_valid);
-
+int32_t pt_load_cached_metadata(const char* plugin_path, const char* interface_name, pt_cached_metadata_t* metadata_out);
+    
 /**
- * @brief 处理目录中其他DLL文件的验证文件生成 / Handle validation file generation for other DLL files in directory / Validierungsdatei-Generierung für andere DLL-Dateien im Verzeichnis behandeln
+ * @brief 将接口元数据写入验证数据库 / Record interface metadata in the validation database / Schnittstellen-Metadaten in der Validierungsdatenbank speichern
+ * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @param metadata 元数据 / Metadata / Metadaten
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_record_cached_metadata(const char* plugin_path, const char* interface_name, const pt_cached_metadata_t* metadata);
+    
+/**
+ * @brief 处理目录中其他DLL文件的验证记录 / Handle validation records for other DLL files in directory / Validierungsdatensätze für andere DLL-Dateien im Verzeichnis behandeln
  */
 int32_t pt_process_directory_dll_validation(const char* plugin_path);
-
+    
+/**
+ * @brief 创建验证数据库锁 / Create validation database lock / Sperre der Validierungsdatenbank erstellen
+ */
+int init_validation_db_lock(void);
+    
+/**
+ * @brief 关闭所有验证数据库并释放锁 / Close all validation databases and free the lock / Alle Validierungsdatenbanken schließen und Sperre freigeben
+ */
+void close_validation_databases(void);
+    
 /**
  * @brief 创建测试参数包 / Create test parameter pack / Testparameterpaket erstellen
  */
 pt_param_pack_t* pt_create_test_param_pack(int expected_param_count);
-
+    
 /**
  * @brief 调用返回FLOAT类型的函数 / Call function returning FLOAT type / Funktion aufrufen, die FLOAT-Typ zurückgibt
  */
 int32_t pt_call_curried_func_float(void* func_ptr, void* serialized_pack, double* result_float, int64_t* result_int);
-
+    
 /**
  * @brief 调用返回DOUBLE类型的函数 / Call function returning DOUBLE type / Funktion aufrufen, die DOUBLE-Typ zurückgibt
  */
 int32_t pt_call_curried_func_double(void* func_ptr, void* serialized_pack, double* result_float, int64_t* result_int);
-
+    
 /**
  * @brief 调用返回STRUCT_PTR类型的函数 / Call function returning STRUCT_PTR type / Funktion aufrufen, die STRUCT_PTR-Typ zurückgibt
  */
 int32_t pt_call_curried_func_struct_ptr(void* func_ptr, void* serialized_pack, void* result_struct, size_t return_size, int64_t* result_int, double* result_float);
-
+    
 /**
  * @brief 调用返回STRUCT_VAL类型的函数 / Call function returning STRUCT_VAL type / Funktion aufrufen, die STRUCT_VAL-Typ zurückgibt
  */
 int32_t pt_call_curried_func_struct_val(void* func_ptr, void* serialized_pack, void* result_struct, int64_t* result_int, double* result_float);
-
+    
 /**
  * @brief 调用返回整数类型的函数 / Call function returning integer type / Funktion aufrufen, die Integer-Typ zurückgibt
  */
 int32_t pt_call_curried_func_int(void* func_ptr, void* serialized_pack, int64_t* result_int, double* result_float);
-
+    
 #ifdef __cplusplus
 }
 #endif
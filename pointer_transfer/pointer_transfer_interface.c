@@ -9,7 +9,6 @@
  * - interface/pointer_transfer_interface_load.c: 插件加载和函数获取
  * - interface/pointer_transfer_interface_return.c: 返回值处理和函数调用
  * - interface/pointer_transfer_interface_rule.c: 返回值传递规则匹配
- * - interface/pointer_transfer_interface_chain.c: 调用链管理
  * - interface/pointer_transfer_interface_cleanup.c: 接口状态清理
  * - interface/pointer_transfer_interface_setgroup.c: SetGroup规则处理
  * - interface/pointer_transfer_interface_setgroup_exec.c: SetGroup规则执行
@@ -17,6 +16,10 @@
  * - interface/pointer_transfer_interface_rule_process.c: 返回值传递规则处理
  * - interface/pointer_transfer_interface_prepare.c: 接口调用准备
  * - interface/pointer_transfer_interface_result.c: 接口调用结果处理
+ * - interface/engine/pointer_transfer_interface_engine_step.c: 调用帧状态机
+ * - interface/engine/pointer_transfer_interface_engine_pool.c: 每线程调用帧池
+ * - interface/engine/pointer_transfer_interface_engine_queue.c: 待执行调用的重排与批量执行
+ * - interface/batch/pointer_transfer_interface_batch.c: 批量（_Vec）调用
  * 
  * This file now only contains main call logic, other functionality has been split into:
  * - interface/pointer_transfer_interface_state.c: Interface state management
@@ -25,7 +28,6 @@
  * - interface/pointer_transfer_interface_load.c: Plugin loading and function retrieval
  * - interface/pointer_transfer_interface_return.c: Return value processing and function call
  * - interface/pointer_transfer_interface_rule.c: Return value transfer rule matching
- * - interface/pointer_transfer_interface_chain.c: Call chain management
  * - interface/pointer_transfer_interface_cleanup.c: Interface state cleanup
  * - interface/pointer_transfer_interface_setgroup.c: SetGroup rule processing
  * - interface/pointer_transfer_interface_setgroup_exec.c: SetGroup rule execution
@@ -33,6 +35,10 @@
  * - interface/pointer_transfer_interface_rule_process.c: Return value transfer rule processing
  * - interface/pointer_transfer_interface_prepare.c: Interface call preparation
  * - interface/pointer_transfer_interface_result.c: Interface call result processing
+ * - interface/engine/pointer_transfer_interface_engine_step.c: Call frame state machine
+ * - interface/engine/pointer_transfer_interface_engine_pool.c: Per-thread call frame pool
+ * - interface/engine/pointer_transfer_interface_engine_queue.c: Reordering and batched execution of pending calls
+ * - interface/batch/pointer_transfer_interface_batch.c: Batch (_Vec) calls
  */
 
 #include "pointer_transfer_interface.h"
@@ -52,61 +58,81 @@
 /* call_function_generic已迁移至pointer_transfer_platform.c，替代函数为pt_platform_safe_call / call_function_generic migrated to pointer_transfer_platform.c, replaced by pt_platform_safe_call / call_function_generic nach pointer_transfer_platform.c migriert, ersetzt durch pt_platform_safe_call */
 /* 接口状态管理函数已移至 interface/pointer_transfer_interface_state.c / Interface state management functions moved to interface/pointer_transfer_interface_state.c / Schnittstellenstatus-Verwaltungsfunktionen nach interface/pointer_transfer_interface_state.c verschoben */
  
- /**
-  * @brief 调用目标插件接口（内部实现） / Call target plugin interface (internal implementation) / Ziel-Plugin-Schnittstelle aufrufen (interne Implementierung)
-  */
- int call_target_plugin_interface_internal(const pointer_transfer_rule_t* rule, void* ptr, int recursion_depth, const char* call_chain[], size_t call_chain_size, int skip_param_cleanup) {
-     if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL) {
-         internal_log_write("ERROR", "Invalid parameters for call_target_plugin_interface");
-         return -1;
-     }
-     
-     check_recursion_depth(recursion_depth);
-     
-     if (detect_call_cycle(rule, call_chain, call_chain_size) != 0) {
-         return -1;
-     }
-     
-     pointer_transfer_context_t* ctx = get_global_context();
-     
-     target_interface_state_t* state = NULL;
-     int actual_param_count = 0;
-     pt_return_type_t return_type;
-     size_t return_size;
-     void* struct_buffer = NULL;
-     
-     if (prepare_interface_call(rule, ptr, &state, &actual_param_count, &return_type, &return_size, &struct_buffer) != 0) {
-         return -1;
-     }
-     
-     int64_t result_int = 0;
-     double result_float = 0.0;
-     if (execute_interface_call(state, rule, actual_param_count, return_type, return_size, struct_buffer,
-                                &result_int, &result_float) != 0) {
-         cleanup_interface_call_resources(return_type, struct_buffer, state, skip_param_cleanup);
-         return -1;
-     }
-     
-     if (ctx->rules != NULL) {
-         process_return_value_transfer_rules(ctx, rule, return_type, return_size, result_int, result_float, struct_buffer,
-                                             call_chain, call_chain_size, recursion_depth);
-     }
-     
-     if (ctx->rules != NULL && rule != NULL && rule->target_plugin != NULL && rule->target_interface != NULL && state != NULL) {
-         process_parameter_value_transfer_rules(ctx, rule, state);
-     }
-     
-     cleanup_interface_call_resources(return_type, struct_buffer, state, skip_param_cleanup);
-     
-     return 0;
- }
- 
+/**
+ * @brief 在显式帧栈上执行调用帧直至根帧完成 / Run call frames on the explicit frame stack until the root frame finishes / Aufrufrahmen auf dem expliziten Rahmenstapel ausführen, bis der Wurzelrahmen fertig ist
+ * @param top 根帧 / Root frame / Wurzelrahmen
+ * @return 根帧结果 / Root frame result / Ergebnis des Wurzelrahmens
+ */
+static int run_call_frames(pt_call_frame_t* top) {
+    int max_depth = get_max_call_depth();
+    int root_result = -1;
+    
+    while (top != NULL) {
+        pt_call_frame_t* child = NULL;
+        pt_frame_action_t action = step_call_frame(top, &child);
+        
+        if (action == PT_FRAME_ACTION_PUSH && child != NULL) {
+            if (child->depth > max_depth) {
+                const pointer_transfer_rule_t* child_rule = get_call_frame_rule(child);
+                internal_log_write("ERROR", "Call depth limit %d exceeded, dropping call to %s.%s", max_depth,
+                                  child_rule != NULL && child_rule->target_plugin != NULL ? child_rule->target_plugin : "unknown",
+                                  child_rule != NULL && child_rule->target_interface != NULL ? child_rule->target_interface : "unknown");
+                top->child_result = -1;
+                release_call_frame(child);
+                continue;
+            }
+            top = child;
+        } else if (action == PT_FRAME_ACTION_POP) {
+            pt_call_frame_t* parent = top->parent;
+            if (parent != NULL) {
+                parent->child_result = top->result;
+            } else {
+                root_result = top->result;
+            }
+            release_call_frame(top);
+            top = parent;
+        }
+    }
+    
+    return root_result;
+}
+
 /**
  * @brief 调用目标插件接口 / Call target plugin interface / Ziel-Plugin-Schnittstelle aufrufen
+ * @details 以显式帧栈迭代执行调用及其触发的传递规则，调用深度只受MaxCallDepth限制而不消耗原生栈 / Executes the call and the transfer rules it triggers iteratively on an explicit frame stack, call depth is bounded only by MaxCallDepth and consumes no native stack / Führt den Aufruf und die ausgelösten Übertragungsregeln iterativ auf einem expliziten Rahmenstapel aus, die Aufruftiefe ist nur durch MaxCallDepth begrenzt und verbraucht keinen nativen Stapel
+ */
+int call_target_plugin_interface(const pointer_transfer_rule_t* rule, const pt_typed_value_t* value) {
+    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL) {
+        internal_log_write("ERROR", "Invalid parameters for call_target_plugin_interface");
+        return -1;
+    }
+    
+    pt_call_frame_t* top = acquire_call_frame();
+    if (top == NULL) {
+        return -1;
+    }
+    init_call_frame(top, rule, value, NULL);
+    return run_call_frames(top);
+}
+
+/**
+ * @brief 以已知结果执行目标接口调用的后续规则 / Run the follow-up rules of a target interface call with a known result / Folgeregeln eines Zielschnittstellenaufrufs mit bekanntem Ergebnis ausführen
+ * @details 参数设置和返回值传递与call_target_plugin_interface相同，只跳过插件调用本身 / Parameter setting and return value transfer are the same as in call_target_plugin_interface, only the plugin call itself is skipped / Parametersetzung und Rückgabewertübertragung wie bei call_target_plugin_interface, nur der Plugin-Aufruf selbst entfällt
  */
-int call_target_plugin_interface(const pointer_transfer_rule_t* rule, void* ptr) {
-    const char* initial_call_chain[1] = {NULL};
-    size_t initial_call_chain_size = 0;
+int call_target_plugin_interface_with_result(const pointer_transfer_rule_t* rule, const pt_typed_value_t* value,
+                                             int64_t result_int, double result_float) {
+    if (rule == NULL || rule->target_plugin == NULL || rule->target_interface == NULL) {
+        internal_log_write("ERROR", "Invalid parameters for call_target_plugin_interface_with_result");
+        return -1;
+    }
     
-    return call_target_plugin_interface_internal(rule, ptr, 0, initial_call_chain, initial_call_chain_size, 0);
-}
\ No newline at end of file
+    pt_call_frame_t* top = acquire_call_frame();
+    if (top == NULL) {
+        return -1;
+    }
+    init_call_frame(top, rule, value, NULL);
+    top->has_batch_result = 1;
+    top->result_int = result_int;
+    top->result_float = result_float;
+    return run_call_frames(top);
+}
@@ -14,11 +14,11 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /* NXLD标准调用约定 / NXLD standard calling convention / NXLD-Standard-Aufrufkonvention */
-
+    
 /* call_function_generic位于pointer_transfer_platform.c，替代函数为pt_platform_safe_call / call_function_generic is located in pointer_transfer_platform.c, replacement function is pt_platform_safe_call / call_function_generic befindet sich in pointer_transfer_platform.c, Ersatzfunktion ist pt_platform_safe_call */
-
+    
 /**
  * @brief 查找目标接口状态（不创建）/ Find target interface state (without creating) / Ziel-Schnittstellenstatus suchen (ohne Erstellung)
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -26,7 +26,7 @@ extern "C" {
  * @return 成功返回接口状态指针，不存在返回NULL / Returns interface state pointer on success, NULL if not found / Gibt Schnittstellenstatus-Zeiger bei Erfolg zurück, NULL wenn nicht gefunden
  */
 target_interface_state_t* find_interface_state(const char* plugin_name, const char* interface_name);
-
+    
 /**
  * @brief 查找或创建目标接口状态 / Find or create target interface state / Ziel-Schnittstellenstatus suchen oder erstellen
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -36,7 +36,24 @@ target_interface_state_t* find_interface_state(const char* plugin_name, const ch
  * @return 成功返回接口状态指针，失败返回NULL / Returns interface state pointer on success, NULL on failure / Gibt Schnittstellenstatus-Zeiger bei Erfolg zurück, NULL bei Fehler
  */
 target_interface_state_t* find_or_create_interface_state(const char* plugin_name, const char* interface_name, void* handle, void* func_ptr);
-
+    
+/**
+ * @brief 将已存在的接口状态绑定到当前加载的库 / Bind an existing interface state to the currently loaded library / Vorhandenen Schnittstellenstatus an die aktuell geladene Bibliothek binden
+ * @param state 接口状态 / Interface state / Schnittstellenstatus
+ * @param handle 插件句柄 / Plugin handle / Plugin-Handle
+ * @param func_ptr 函数指针 / Function pointer / Funktionszeiger
+ */
+void bind_interface_state(target_interface_state_t* state, void* handle, void* func_ptr);
+    
+/**
+ * @brief 将接口状态重新绑定到新版本的库 / Rebind interface state to a new version of the library / Schnittstellenstatus an eine neue Version der Bibliothek binden
+ * @param state 接口状态 / Interface state / Schnittstellenstatus
+ * @param handle 新库句柄 / New library handle / Handle der neuen Bibliothek
+ * @param apply 0仅检查兼容性，非0写入新的函数指针和元数据 / 0 only checks compatibility, non-zero writes the new function pointer and metadata / 0 prüft nur die Kompatibilität, ungleich 0 schreibt neuen Funktionszeiger und Metadaten
+ * @return 兼容返回0，接口缺失或参数数量改变返回-1 / Returns 0 if compatible, -1 if the interface is missing or its parameter count changed / Gibt 0 zurück wenn kompatibel, -1 wenn die Schnittstelle fehlt oder sich ihre Parameteranzahl geändert hat
+ */
+int rebind_interface_state(target_interface_state_t* state, void* handle, int apply);
+    
 /* 接口信息获取相关函数 / Interface information retrieval functions / Schnittstelleninformationen-Abruf-Funktionen */
 int get_plugin_interface_functions(void* handle, void** get_interface_count_out, void** get_interface_info_out,
                                     void** get_param_count_out, void** get_param_info_out);
@@ -44,7 +61,14 @@ int find_interface_index(void* get_interface_count, void* get_interface_info, co
                          size_t* interface_index_out, pt_return_type_t* inferred_return_type_out, char** saved_desc_buf_out);
 int get_parameter_count_info(void* get_param_count, size_t interface_index,
                               nxld_param_count_type_t* param_count_type_out, int32_t* min_count_out, int32_t* max_count_out);
-
+    
+/* 插件描述符相关函数 / Plugin descriptor functions / Plugin-Deskriptor-Funktionen */
+const nxld_interface_descriptor_t* find_interface_descriptor(void* handle, const char* interface_name, void* func_ptr,
+                                                              nxld_call_convention_t* call_convention_out);
+pt_return_type_t map_descriptor_return_type(const nxld_interface_descriptor_t* descriptor, size_t* return_size_out);
+uint32_t get_plugin_pack_version(void* handle);
+void apply_descriptor_parameter_types(target_interface_state_t* state, const nxld_interface_descriptor_t* descriptor, int param_count);
+    
 /* 接口状态创建相关函数 / Interface state creation functions / Schnittstellenstatus-Erstellungsfunktionen */
 int calculate_param_count(nxld_param_count_type_t param_count_type, int32_t min_count, int32_t max_count, int* is_variadic_out);
 int allocate_parameter_arrays(target_interface_state_t* state, int param_count);
@@ -52,24 +76,47 @@ void free_parameter_arrays(target_interface_state_t* state);
 int initialize_parameter_types(target_interface_state_t* state, void* get_param_info, size_t interface_index, int param_count);
 int initialize_interface_state_basic(target_interface_state_t* state, const char* plugin_name, const char* interface_name,
                                       void* handle, void* func_ptr, int param_count, int is_variadic, int min_param_count, pt_return_type_t return_type);
-
+    
 /**
  * @brief 调用目标插件接口 / Call target plugin interface / Ziel-Plugin-Schnittstelle aufrufen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
- * @param ptr 要传递的指针 / Pointer to transfer / Zu übertragender Zeiger
+ * @param value 要传递的值 / Value to transfer / Zu übertragender Wert
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
-int call_target_plugin_interface(const pointer_transfer_rule_t* rule, void* ptr);
-
+int call_target_plugin_interface(const pointer_transfer_rule_t* rule, const pt_typed_value_t* value);
+    
+/**
+ * @brief 以已知结果调用目标插件接口（跳过插件调用，只执行参数设置和后续规则） / Call target plugin interface with a known result (skips the plugin call, only sets parameters and runs follow-up rules) / Ziel-Plugin-Schnittstelle mit bekanntem Ergebnis aufrufen (überspringt den Plugin-Aufruf, setzt nur Parameter und führt Folgeregeln aus)
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param value 要传递的值 / Value to transfer / Zu übertragender Wert
+ * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
+ * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
+ * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int call_target_plugin_interface_with_result(const pointer_transfer_rule_t* rule, const pt_typed_value_t* value,
+                                             int64_t result_int, double result_float);
+    
+/**
+ * @brief 以一次<Interface>_Vec调用执行多行目标接口调用 / Execute several rows of a target interface call with one <Interface>_Vec call / Mehrere Zeilen eines Zielschnittstellenaufrufs mit einem <Interface>_Vec-Aufruf ausführen
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param values 每行要传递的值 / Value to transfer for each row / Zu übertragender Wert je Zeile
+ * @param count 行数 / Row count / Zeilenanzahl
+ * @param success_count 累加成功的行数 / Accumulates successful rows / Summiert erfolgreiche Zeilen
+ * @param row_done 输出每行是否已执行（count个元素） / Outputs whether each row has run (count elements) / Gibt aus, ob jede Zeile ausgeführt wurde (count Elemente)
+ * @return 全部行已批量执行返回0；不适用或批量函数失败时返回-1，调用者应逐行调用row_done为0的行 / Returns 0 when all rows ran as a batch; -1 when not applicable or the batch function failed, the caller should then call the rows whose row_done is 0 one by one / Gibt 0 zurück, wenn alle Zeilen als Batch liefen; -1 wenn nicht anwendbar oder die Batch-Funktion fehlschlug, der Aufrufer sollte dann die Zeilen mit row_done 0 einzeln aufrufen
+ */
+int call_target_plugin_interface_batch(const pointer_transfer_rule_t* rule, const pt_typed_value_t* values, size_t count,
+                                       size_t* success_count, uint8_t* row_done);
+    
 /**
  * @brief 验证和设置参数值 / Validate and set parameter value / Parameterwert validieren und setzen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
  * @param state 接口状态 / Interface state / Schnittstellenstatus
- * @param ptr 指针值 / Pointer value / Zeigerwert
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int validate_and_set_parameter(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr);
-
+int validate_and_set_parameter(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value);
+    
 /**
  * @brief 验证参数就绪状态 / Validate parameter readiness / Parameterbereitschaft validieren
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
@@ -77,7 +124,7 @@ int validate_and_set_parameter(const pointer_transfer_rule_t* rule, target_inter
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
 int validate_parameter_readiness(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
-
+    
 /**
  * @brief 计算实际参数数量 / Calculate actual parameter count / Tatsächliche Parameteranzahl berechnen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
@@ -85,45 +132,57 @@ int validate_parameter_readiness(const pointer_transfer_rule_t* rule, target_int
  * @return 实际参数数量 / Actual parameter count / Tatsächliche Parameteranzahl
  */
 int calculate_actual_param_count(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
-
+    
 /* 参数验证相关函数 / Parameter validation functions / Parameter-Validierungsfunktionen */
 int validate_parameter_index(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
-int validate_parameter_pointer(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr);
+int validate_parameter_pointer(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value);
 int validate_parameter_arrays(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
-
+    
 /* 参数设置相关函数 / Parameter setting functions / Parameter-Einstellungsfunktionen */
-int set_parameter_from_const_string(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr);
-int set_parameter_from_pointer(const pointer_transfer_rule_t* rule, target_interface_state_t* state, void* ptr);
+int set_parameter_from_const_string(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value);
+int set_parameter_from_value(const pointer_transfer_rule_t* rule, target_interface_state_t* state, const pt_typed_value_t* value);
 int apply_constant_value_rules(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
-
+    
 /* 参数就绪状态验证相关函数 / Parameter readiness validation functions / Parameterbereitschaft-Validierungsfunktionen */
 int calculate_variadic_ready_count(target_interface_state_t* state);
 void build_unready_params_string(target_interface_state_t* state, int start_index, int end_index,
                                   char* unready_params_out, size_t max_size);
 int validate_variadic_parameter_readiness(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
 int validate_fixed_parameter_readiness(const pointer_transfer_rule_t* rule, target_interface_state_t* state);
-
+    
 /* 参数数量计算相关函数 / Parameter count calculation functions / Parameteranzahl-Berechnungsfunktionen */
 int calculate_variadic_base_ready_count(target_interface_state_t* state);
 int check_intermediate_parameters_ready(target_interface_state_t* state, int start_index, int end_index);
 int update_variadic_count_from_extra_rules(const pointer_transfer_rule_t* rule, target_interface_state_t* state, int base_count);
 void validate_and_log_variadic_count(const pointer_transfer_rule_t* rule, target_interface_state_t* state, int actual_param_count);
-
+    
 /**
  * @brief 检测调用循环 / Detect call cycle / Aufrufzyklus erkennen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
+ * @param mark_out 输出已标记的节点ID（未标记为RULE_GRAPH_INVALID_NODE） / Output marked node ID (RULE_GRAPH_INVALID_NODE if not marked) / Ausgabe markierte Knoten-ID (RULE_GRAPH_INVALID_NODE wenn nicht markiert)
  * @return 检测到循环返回-1，否则返回0 / Returns -1 if cycle detected, 0 otherwise / Gibt -1 zurück, wenn Zyklus erkannt, sonst 0
  */
-int detect_call_cycle(const pointer_transfer_rule_t* rule, const char* call_chain[], size_t call_chain_size);
-
+int detect_call_cycle(const pointer_transfer_rule_t* rule, size_t* mark_out);
+    
 /**
- * @brief 检查递归深度 / Check recursion depth / Rekursionstiefe prüfen
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
+ * @brief 在遍历目标前标记源接口 / Mark the source interface before its targets are walked / Quellschnittstelle markieren, bevor ihre Ziele durchlaufen werden
+ * @param plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @return 已标记的节点ID，交给release_call_cycle_mark释放；未标记为RULE_GRAPH_INVALID_NODE / Marked node ID, to be released with release_call_cycle_mark; RULE_GRAPH_INVALID_NODE if not marked / Markierte Knoten-ID, freizugeben mit release_call_cycle_mark; RULE_GRAPH_INVALID_NODE wenn nicht markiert
  */
-void check_recursion_depth(int recursion_depth);
-
+size_t mark_call_cycle_source(const char* plugin_name, const char* interface_name);
+    
+/**
+ * @brief 清除调用循环标记 / Clear call cycle mark / Aufrufzyklus-Markierung löschen
+ * @param node_id detect_call_cycle或mark_call_cycle_source输出的节点ID / Node ID output by detect_call_cycle or mark_call_cycle_source / Von detect_call_cycle oder mark_call_cycle_source ausgegebene Knoten-ID
+ */
+void release_call_cycle_mark(size_t node_id);
+    
+/**
+ * @brief 释放当前线程的调用循环位图 / Free call cycle bitset of current thread / Aufrufzyklus-Bitset des aktuellen Threads freigeben
+ */
+void free_call_cycle_marks(void);
+    
 /**
  * @brief 加载目标插件并获取函数指针 / Load target plugin and get function pointer / Ziel-Plugin laden und Funktionszeiger abrufen
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
@@ -132,7 +191,20 @@ void check_recursion_depth(int recursion_depth);
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
 int load_plugin_and_get_function(const pointer_transfer_rule_t* rule, void** handle_out, void** func_ptr_out);
-
+    
+/**
+ * @brief 获取规则目标的接口状态（调用路径，持读锁） / Get interface state of a rule target (call path, read lock held) / Schnittstellenstatus eines Regelziels abrufen (Aufrufpfad, Lesesperre gehalten)
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @return 成功返回接口状态，未准备或加载失败返回NULL / Returns interface state on success, NULL if not prepared or loading failed / Gibt Schnittstellenstatus bei Erfolg zurück, NULL wenn nicht vorbereitet oder Laden fehlgeschlagen
+ */
+target_interface_state_t* get_target_interface_state(const pointer_transfer_rule_t* rule);
+    
+/**
+ * @brief 准备规则目标并获取规则集读锁 / Prepare rule targets and acquire the rule set read lock / Regelziele vorbereiten und Regelsatz-Lesesperre erwerben
+ * @details 最外层调用在写锁下链式加载目标.nxpt文件并创建接口状态，随后获取读锁；嵌套调用只获取读锁 / The outermost call chain-loads target .nxpt files and creates interface states under the write lock, then takes the read lock; nested calls only take the read lock / Der äußerste Aufruf lädt Ziel-.nxpt-Dateien kettenweise und erstellt Schnittstellenstatus unter der Schreibsperre und erwirbt dann die Lesesperre; verschachtelte Aufrufe erwerben nur die Lesesperre
+ */
+void acquire_prepared_rule_set(void);
+    
 /**
  * @brief 准备返回值类型和缓冲区 / Prepare return type and buffer / Rückgabetyp und Puffer vorbereiten
  * @param state 接口状态 / Interface state / Schnittstellenstatus
@@ -143,7 +215,7 @@ int load_plugin_and_get_function(const pointer_transfer_rule_t* rule, void** han
  */
 int prepare_return_type_and_buffer(target_interface_state_t* state, pt_return_type_t* return_type_out, 
                                     size_t* return_size_out, void** struct_buffer_out);
-
+    
 /**
  * @brief 调用函数并获取返回值 / Call function and get return value / Funktion aufrufen und Rückgabewert abrufen
  * @param state 接口状态 / Interface state / Schnittstellenstatus
@@ -158,7 +230,22 @@ int prepare_return_type_and_buffer(target_interface_state_t* state, pt_return_ty
 int call_function_and_get_result(target_interface_state_t* state, int actual_param_count,
                                   pt_return_type_t return_type, size_t return_size, void* struct_buffer,
                                   int64_t* result_int_out, double* result_float_out);
-
+    
+/**
+ * @brief 按接口的调用约定调用接口函数 / Call the interface function with its calling convention / Schnittstellenfunktion mit ihrer Aufrufkonvention aufrufen
+ * @param state 接口状态 / Interface state / Schnittstellenstatus
+ * @param actual_param_count 实际参数数量（原生调用使用计划中的数量） / Actual parameter count (native calls use the plan's count) / Tatsächliche Parameteranzahl (native Aufrufe verwenden die Anzahl aus dem Plan)
+ * @param return_type 返回值类型 / Return type / Rückgabetyp
+ * @param return_size 返回值大小 / Return size / Rückgabegröße
+ * @param result_int 输出整数结果 / Output integer result / Ausgabe-Ganzzahlergebnis
+ * @param result_float 输出浮点数结果 / Output float result / Ausgabe-Gleitkommaergebnis
+ * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
+ * @return 成功返回0，错误返回非0 / Returns 0 on success, non-zero on error / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
+ */
+int32_t call_interface_function(const target_interface_state_t* state, int actual_param_count,
+                                pt_return_type_t return_type, size_t return_size,
+                                int64_t* result_int, double* result_float, void* struct_buffer);
+    
 /**
  * @brief 记录返回值 / Log return value / Rückgabewert protokollieren
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -171,21 +258,19 @@ int call_function_and_get_result(target_interface_state_t* state, int actual_par
  */
 void log_return_value(const char* plugin_name, const char* interface_name, pt_return_type_t return_type,
                       size_t return_size, int64_t result_int, double result_float, void* struct_buffer);
-
+    
 /**
- * @brief 根据返回值类型选择传递参数 / Select transfer parameter by return type / Übertragungsparameter nach Rückgabetyp auswählen
+ * @brief 将返回值构造为带类型的值 / Build typed value from return value / Typisierten Wert aus Rückgabewert erzeugen
  * @param return_type 返回值类型 / Return type / Rückgabetyp
  * @param return_size 返回值大小 / Return size / Rückgabegröße
  * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
  * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
  * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param ctx 上下文 / Context / Kontext
- * @return 传递参数指针 / Transfer parameter pointer / Übertragungsparameter-Zeiger
+ * @return 按值返回的传递值，结构体值引用struct_buffer / Transfer value returned by value, struct values reference struct_buffer / Als Wert zurückgegebener Übertragungswert, Strukturwerte verweisen auf struct_buffer
  */
-void* select_transfer_parameter_by_return_type(pt_return_type_t return_type, size_t return_size,
-                                                int64_t result_int, double result_float, void* struct_buffer,
-                                                pointer_transfer_context_t* ctx);
-
+pt_typed_value_t make_return_value(pt_return_type_t return_type, size_t return_size,
+                                   int64_t result_int, double result_float, void* struct_buffer);
+    
 /**
  * @brief 收集匹配的返回值传递规则 / Collect matching return value transfer rules / Passende Rückgabewert-Übertragungsregeln sammeln
  * @param ctx 上下文 / Context / Kontext
@@ -197,7 +282,7 @@ void* select_transfer_parameter_by_return_type(pt_return_type_t return_type, siz
  */
 size_t collect_matching_return_value_rules(pointer_transfer_context_t* ctx, const char* source_plugin, 
                                             const char* source_interface, size_t* matched_rules, size_t max_matched);
-
+    
 /**
  * @brief 检查是否有完全相同的目标位置 / Check if exact duplicate target location exists / Prüfen, ob exakt doppelte Zielposition existiert
  * @param ctx 上下文 / Context / Kontext
@@ -209,36 +294,13 @@ size_t collect_matching_return_value_rules(pointer_transfer_context_t* ctx, cons
  */
 int check_exact_duplicate_target(const pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* rule,
                                   const char* source_plugin, const char* source_interface, size_t start_index);
-
-/**
- * @brief 处理参数值传递规则 / Process parameter value transfer rules / Parameterwert-Übertragungsregeln verarbeiten
- * @param ctx 上下文 / Context / Kontext
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param state 接口状态 / Interface state / Schnittstellenstatus
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
- */
-int process_parameter_value_transfer_rules(pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* rule,
-                                            target_interface_state_t* state);
-
-/**
- * @brief 构建新的调用链 / Build new call chain / Neue Aufrufkette erstellen
- * @param call_chain 原始调用链 / Original call chain / Ursprüngliche Aufrufkette
- * @param call_chain_size 原始调用链大小 / Original call chain size / Ursprüngliche Aufrufketten-Größe
- * @param plugin_name 插件名称 / Plugin name / Plugin-Name
- * @param interface_name 接口名称 / Interface name / Schnittstellenname
- * @param new_call_chain_out 输出新调用链 / Output new call chain / Ausgabe-Neue Aufrufkette
- * @param new_call_chain_size_out 输出新调用链大小 / Output new call chain size / Ausgabe-Neue Aufrufketten-Größe
- */
-void build_new_call_chain(const char* call_chain[], size_t call_chain_size,
-                          const char* plugin_name, const char* interface_name,
-                          const char* new_call_chain_out[64], size_t* new_call_chain_size_out);
-
+    
 /**
  * @brief 清理接口状态参数 / Cleanup interface state parameters / Schnittstellenstatus-Parameter bereinigen
  * @param state 接口状态 / Interface state / Schnittstellenstatus
  */
 void cleanup_interface_state_parameters(target_interface_state_t* state);
-
+    
 /**
  * @brief 清理SetGroup目标接口的参数状态 / Cleanup parameter state of SetGroup target interface / Parameterstatus der SetGroup-Zielschnittstelle bereinigen
  * @param ctx 上下文 / Context / Kontext
@@ -246,7 +308,7 @@ void cleanup_interface_state_parameters(target_interface_state_t* state);
  * @param interface_name 接口名称 / Interface name / Schnittstellenname
  */
 void cleanup_setgroup_target_interface_parameters(pointer_transfer_context_t* ctx, const char* plugin_name, const char* interface_name);
-
+    
 /**
  * @brief 收集同一SetGroup中的所有规则 / Collect all rules in same SetGroup / Alle Regeln in derselben SetGroup sammeln
  * @param ctx 上下文 / Context / Kontext
@@ -261,7 +323,7 @@ void cleanup_setgroup_target_interface_parameters(pointer_transfer_context_t* ct
 size_t collect_setgroup_rules(pointer_transfer_context_t* ctx, const size_t* matched_rules, size_t matched_count,
                                int* processed, const pointer_transfer_rule_t* active_rule,
                                size_t* group_rules_out, size_t max_group_rules);
-
+    
 /**
  * @brief 按target_param_index排序规则 / Sort rules by target_param_index / Regeln nach target_param_index sortieren
  * @param ctx 上下文 / Context / Kontext
@@ -269,7 +331,7 @@ size_t collect_setgroup_rules(pointer_transfer_context_t* ctx, const size_t* mat
  * @param group_count 组规则数量 / Group rule count / Gruppenregelanzahl
  */
 void sort_setgroup_rules_by_param_index(pointer_transfer_context_t* ctx, size_t* group_rules, size_t group_count);
-
+    
 /**
  * @brief 重新调用源接口获取新的返回值 / Re-call source interface to get new return value / Quellschnittstelle neu aufrufen, um neuen Rückgabewert zu erhalten
  * @param group_rule SetGroup规则 / SetGroup rule / SetGroup-Regel
@@ -284,14 +346,14 @@ int recall_source_interface_for_setgroup(const pointer_transfer_rule_t* group_ru
                                           int64_t* result_int_out, double* result_float_out,
                                           pt_return_type_t* return_type_out, size_t* return_size_out,
                                           void** struct_buffer_out);
-
+    
 /**
  * @brief 检查SetGroup参数就绪状态 / Check SetGroup parameter readiness / SetGroup-Parameterbereitschaft prüfen
  * @param group_rule SetGroup规则 / SetGroup rule / SetGroup-Regel
  * @return 可以应用返回1，否则返回0 / Returns 1 if can apply, 0 otherwise / Gibt 1 zurück, wenn anwendbar, sonst 0
  */
 int check_setgroup_parameter_readiness(const pointer_transfer_rule_t* group_rule);
-
+    
 /**
  * @brief 检查SetGroup中是否有更多规则要处理 / Check if there are more rules in SetGroup to process / Prüfen, ob noch weitere Regeln in SetGroup zu verarbeiten sind
  * @param ctx 上下文 / Context / Kontext
@@ -303,7 +365,7 @@ int check_setgroup_parameter_readiness(const pointer_transfer_rule_t* group_rule
  */
 int check_more_rules_in_setgroup(pointer_transfer_context_t* ctx, const size_t* group_rules, size_t group_count,
                                   size_t group_idx, const pointer_transfer_rule_t* group_rule);
-
+    
 /**
  * @brief 检查SetGroup设置组状态 / Check SetGroup set group status / SetGroup-Set-Gruppenstatus prüfen
  * @param ctx 上下文 / Context / Kontext
@@ -315,59 +377,7 @@ int check_more_rules_in_setgroup(pointer_transfer_context_t* ctx, const size_t*
  */
 int check_setgroup_set_group_status(pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* group_rule,
                                      size_t rule_idx, int* should_check_group_out, int* is_min_param_index_out);
-
-/**
- * @brief 调用目标插件接口（内部实现） / Call target plugin interface (internal implementation) / Ziel-Plugin-Schnittstelle aufrufen (interne Implementierung)
- * @param rule 传递规则 / Transfer rule / Übertragungsregel
- * @param ptr 要传递的指针 / Pointer to transfer / Zu übertragender Zeiger
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param skip_param_cleanup 是否跳过参数清理 / Whether to skip parameter cleanup / Ob Parameterbereinigung übersprungen werden soll
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
- */
-int call_target_plugin_interface_internal(const pointer_transfer_rule_t* rule, void* ptr, int recursion_depth, const char* call_chain[], size_t call_chain_size, int skip_param_cleanup);
-
-/**
- * @brief 执行SetGroup规则 / Execute SetGroup rule / SetGroup-Regel ausführen
- * @param group_rule SetGroup规则 / SetGroup rule / SetGroup-Regel
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param group_result_int 组整数结果 / Group integer result / Gruppen-Ganzzahlergebnis
- * @param group_result_float 组浮点数结果 / Group float result / Gruppen-Gleitkommaergebnis
- * @param group_return_type 组返回值类型 / Group return type / Gruppen-Rückgabetyp
- * @param group_return_size 组返回值大小 / Group return size / Gruppen-Rückgabegröße
- * @param group_struct_buffer 组结构体缓冲区 / Group struct buffer / Gruppen-Strukturpuffer
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
- * @param rule_idx 规则索引 / Rule index / Regelindex
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
- */
-int execute_setgroup_rule(const pointer_transfer_rule_t* group_rule, const pointer_transfer_rule_t* rule,
-                          int64_t group_result_int, double group_result_float,
-                          pt_return_type_t group_return_type, size_t group_return_size, void* group_struct_buffer,
-                          const char* call_chain[], size_t call_chain_size, int recursion_depth, size_t rule_idx);
-
-/**
- * @brief 执行非SetGroup规则 / Execute non-SetGroup rule / Nicht-SetGroup-Regel ausführen
- * @param active_rule 活动规则 / Active rule / Aktive Regel
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param return_type 返回值类型 / Return type / Rückgabetyp
- * @param return_size 返回值大小 / Return size / Rückgabegröße
- * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
- * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
- * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
- * @param rule_idx 规则索引 / Rule index / Regelindex
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
- */
-int execute_non_setgroup_rule(const pointer_transfer_rule_t* active_rule, const pointer_transfer_rule_t* rule,
-                               pt_return_type_t return_type, size_t return_size,
-                               int64_t result_int, double result_float, void* struct_buffer,
-                               const char* call_chain[], size_t call_chain_size, int recursion_depth, size_t rule_idx);
-
+    
 /**
  * @brief 验证可变参数接口的最小参数要求 / Validate minimum parameter requirement for variadic interface / Mindestparameteranforderung für variablen Parameter-Interface validieren
  * @param state 接口状态 / Interface state / Schnittstellenstatus
@@ -378,7 +388,7 @@ int execute_non_setgroup_rule(const pointer_transfer_rule_t* active_rule, const
  */
 int validate_variadic_min_param_requirement(target_interface_state_t* state, int actual_param_count,
                                              const char* plugin_name, const char* interface_name);
-
+    
 /**
  * @brief 验证插件函数 / Validate plugin function / Plugin-Funktion validieren
  * @param state 接口状态 / Interface state / Schnittstellenstatus
@@ -390,51 +400,53 @@ int validate_variadic_min_param_requirement(target_interface_state_t* state, int
  */
 int validate_plugin_function(target_interface_state_t* state, const char* plugin_path, const char* interface_name,
                               int actual_param_count, pt_return_type_t return_type);
-
+    
+/* 后台验证结果 / Background validation results / Ergebnisse der Hintergrundvalidierung */
+#define INTERFACE_VALIDATION_NONE 0      /**< 不在后台验证计划中 / Not in the background validation plan / Nicht im Hintergrund-Validierungsplan */
+#define INTERFACE_VALIDATION_PENDING 1   /**< 等待验证 / Validation pending / Validierung ausstehend */
+#define INTERFACE_VALIDATION_PASSED 2    /**< 验证通过 / Validation passed / Validierung bestanden */
+#define INTERFACE_VALIDATION_FAILED 3    /**< 验证失败 / Validation failed / Validierung fehlgeschlagen */
+    
+/**
+ * @brief 添加接口验证任务（在start_interface_validation前调用） / Add interface validation job (call before start_interface_validation) / Schnittstellen-Validierungsauftrag hinzufügen (vor start_interface_validation aufrufen)
+ * @param state 已解析函数的接口状态 / Interface state with resolved function / Schnittstellenstatus mit aufgelöster Funktion
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int add_interface_validation_job(const target_interface_state_t* state, const char* plugin_path);
+    
 /**
- * @brief 处理SetGroup规则组 / Process SetGroup rule group / SetGroup-Regelgruppe verarbeiten
- * @param ctx 上下文 / Context / Kontext
- * @param active_rule 活动规则 / Active rule / Aktive Regel
- * @param matched_rules 匹配的规则索引数组 / Matched rule indices array / Array mit passenden Regelindizes
- * @param matched_count 匹配的规则数量 / Matched rule count / Anzahl der passenden Regeln
- * @param processed 已处理标记数组 / Processed flags array / Array mit Verarbeitungsmarkierungen
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param return_type 返回值类型 / Return type / Rückgabetyp
- * @param return_size 返回值大小 / Return size / Rückgabegröße
- * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
- * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
- * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
+ * @brief 在工作线程上并行验证所有待验证任务 / Validate all pending jobs in parallel on worker threads / Alle ausstehenden Aufträge parallel in Arbeitsthreads validieren
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int process_setgroup_rule_group(pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* active_rule,
-                                 const size_t* matched_rules, size_t matched_count, int* processed,
-                                 const pointer_transfer_rule_t* rule, pt_return_type_t return_type, size_t return_size,
-                                 int64_t result_int, double result_float, void* struct_buffer,
-                                 const char* call_chain[], size_t call_chain_size, int recursion_depth);
-
+int start_interface_validation(void);
+    
 /**
- * @brief 处理非SetGroup规则 / Process non-SetGroup rule / Nicht-SetGroup-Regel verarbeiten
- * @param active_rule 活动规则 / Active rule / Aktive Regel
- * @param rule 当前规则 / Current rule / Aktuelle Regel
+ * @brief 等待后台验证完成 / Wait for background validation to finish / Auf Abschluss der Hintergrundvalidierung warten
+ */
+void wait_for_interface_validation(void);
+    
+/**
+ * @brief 在首次调用插件前结束其后台试调用 / Settle a plugin's background trial calls before its first call / Hintergrund-Probeaufrufe eines Plugins vor seinem ersten Aufruf abschließen
+ * @param handle 插件库句柄 / Plugin library handle / Plugin-Bibliotheks-Handle
+ * @param withdraw_pending 非0时撤回未开始的任务，否则在调用线程上执行它们 / Non-zero withdraws jobs not yet started, otherwise they run on the calling thread / Ungleich 0 zieht noch nicht gestartete Aufträge zurück, sonst laufen sie im aufrufenden Thread
+ */
+void settle_plugin_validation(void* handle, int withdraw_pending);
+    
+/**
+ * @brief 查询接口的后台验证结果（不阻塞） / Query background validation result of an interface (non-blocking) / Hintergrund-Validierungsergebnis einer Schnittstelle abfragen (nicht blockierend)
+ * @param state 接口状态 / Interface state / Schnittstellenstatus
+ * @param param_count 调用的参数数量 / Parameter count of the call / Parameteranzahl des Aufrufs
  * @param return_type 返回值类型 / Return type / Rückgabetyp
- * @param return_size 返回值大小 / Return size / Rückgabegröße
- * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
- * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
- * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
- * @param rule_idx 规则索引 / Rule index / Regelindex
- * @return 成功返回0，需要停止返回1，失败返回-1 / Returns 0 on success, 1 if should stop, -1 on failure / Gibt 0 bei Erfolg zurück, 1 wenn gestoppt werden soll, -1 bei Fehler
+ * @return INTERFACE_VALIDATION_NONE/PENDING/PASSED/FAILED
  */
-int process_non_setgroup_rule(const pointer_transfer_rule_t* active_rule, const pointer_transfer_rule_t* rule,
-                               pt_return_type_t return_type, size_t return_size,
-                               int64_t result_int, double result_float, void* struct_buffer,
-                               const char* call_chain[], size_t call_chain_size, int recursion_depth, size_t rule_idx);
-
+int get_interface_validation_result(const target_interface_state_t* state, int param_count, pt_return_type_t return_type);
+    
+/**
+ * @brief 等待并释放后台验证计划 / Wait for and free the background validation plan / Auf den Hintergrund-Validierungsplan warten und ihn freigeben
+ */
+void free_interface_validation(void);
+    
 /**
  * @brief 准备接口调用 / Prepare interface call / Schnittstellenaufruf vorbereiten
  * @param rule 传递规则 / Transfer rule / Übertragungsregel
@@ -446,10 +458,10 @@ int process_non_setgroup_rule(const pointer_transfer_rule_t* active_rule, const
  * @param struct_buffer_out 输出结构体缓冲区 / Output struct buffer / Ausgabe-Strukturpuffer
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int prepare_interface_call(const pointer_transfer_rule_t* rule, void* ptr,
+int prepare_interface_call(const pointer_transfer_rule_t* rule, const pt_typed_value_t* value,
                            target_interface_state_t** state_out, int* actual_param_count_out,
                            pt_return_type_t* return_type_out, size_t* return_size_out, void** struct_buffer_out);
-
+    
 /**
  * @brief 执行接口调用 / Execute interface call / Schnittstellenaufruf ausführen
  * @param state 接口状态 / Interface state / Schnittstellenstatus
@@ -465,26 +477,7 @@ int prepare_interface_call(const pointer_transfer_rule_t* rule, void* ptr,
 int execute_interface_call(target_interface_state_t* state, const pointer_transfer_rule_t* rule,
                            int actual_param_count, pt_return_type_t return_type, size_t return_size, void* struct_buffer,
                            int64_t* result_int_out, double* result_float_out);
-
-/**
- * @brief 处理返回值传递规则 / Process return value transfer rules / Rückgabewert-Übertragungsregeln verarbeiten
- * @param ctx 上下文 / Context / Kontext
- * @param rule 当前规则 / Current rule / Aktuelle Regel
- * @param return_type 返回值类型 / Return type / Rückgabetyp
- * @param return_size 返回值大小 / Return size / Rückgabegröße
- * @param result_int 整数结果 / Integer result / Ganzzahlergebnis
- * @param result_float 浮点数结果 / Float result / Gleitkommaergebnis
- * @param struct_buffer 结构体缓冲区 / Struct buffer / Strukturpuffer
- * @param call_chain 调用链 / Call chain / Aufrufkette
- * @param call_chain_size 调用链大小 / Call chain size / Aufrufketten-Größe
- * @param recursion_depth 递归深度 / Recursion depth / Rekursionstiefe
- * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
- */
-int process_return_value_transfer_rules(pointer_transfer_context_t* ctx, const pointer_transfer_rule_t* rule,
-                                         pt_return_type_t return_type, size_t return_size,
-                                         int64_t result_int, double result_float, void* struct_buffer,
-                                         const char* call_chain[], size_t call_chain_size, int recursion_depth);
-
+    
 /**
  * @brief 清理接口调用资源 / Cleanup interface call resources / Schnittstellenaufruf-Ressourcen bereinigen
  * @param return_type 返回值类型 / Return type / Rückgabetyp
@@ -494,7 +487,243 @@ int process_return_value_transfer_rules(pointer_transfer_context_t* ctx, const p
  */
 void cleanup_interface_call_resources(pt_return_type_t return_type, void* struct_buffer,
                                       target_interface_state_t* state, int skip_param_cleanup);
-
+    
+/* 调用帧引擎常量 / Call frame engine constants / Aufrufrahmen-Engine-Konstanten */
+#define PT_DEFAULT_MAX_CALL_DEPTH 1024     /**< 默认最大调用深度 / Default maximum call depth / Standardmäßige maximale Aufruftiefe */
+#define PT_FRAME_MAX_MATCHED_RULES 256     /**< 每帧最多匹配的返回值规则数 / Maximum matched return value rules per frame / Maximale passende Rückgabewert-Regeln pro Rahmen */
+#define PT_FRAME_MAX_GROUP_RULES 64        /**< 每帧最多SetGroup规则数 / Maximum SetGroup rules per frame / Maximale SetGroup-Regeln pro Rahmen */
+    
+/**
+ * @brief 调用帧阶段 / Call frame stage / Aufrufrahmen-Phase
+ */
+typedef enum {
+    PT_FRAME_STAGE_ENTER = 0,          /**< 准备并调用目标接口 / Prepare and call target interface / Zielschnittstelle vorbereiten und aufrufen */
+    PT_FRAME_STAGE_RETURN_RULES,       /**< 分派下一条返回值规则 / Dispatch next return value rule / Nächste Rückgabewert-Regel verteilen */
+    PT_FRAME_STAGE_RETURN_RULE_RESUME, /**< 非SetGroup子调用完成后继续 / Resume after non-SetGroup child call / Nach Nicht-SetGroup-Kindaufruf fortsetzen */
+    PT_FRAME_STAGE_SETGROUP,           /**< 分派下一条SetGroup规则 / Dispatch next SetGroup rule / Nächste SetGroup-Regel verteilen */
+    PT_FRAME_STAGE_SETGROUP_RESUME,    /**< SetGroup子调用完成后继续 / Resume after SetGroup child call / Nach SetGroup-Kindaufruf fortsetzen */
+    PT_FRAME_STAGE_PARAM_RULES,        /**< 分派下一条参数值规则 / Dispatch next parameter value rule / Nächste Parameterwert-Regel verteilen */
+    PT_FRAME_STAGE_PARAM_RULE_RESUME,  /**< 参数值子调用完成后继续 / Resume after parameter value child call / Nach Parameterwert-Kindaufruf fortsetzen */
+    PT_FRAME_STAGE_EXIT                /**< 释放资源并弹出 / Release resources and pop / Ressourcen freigeben und entfernen */
+} pt_frame_stage_t;
+    
+/**
+ * @brief 调用帧单步动作 / Call frame step action / Aufrufrahmen-Schrittaktion
+ */
+typedef enum {
+    PT_FRAME_ACTION_CONTINUE = 0,      /**< 继续执行当前帧 / Continue current frame / Aktuellen Rahmen fortsetzen */
+    PT_FRAME_ACTION_PUSH,              /**< 压入子帧 / Push child frame / Kindrahmen ablegen */
+    PT_FRAME_ACTION_POP                /**< 当前帧完成 / Current frame finished / Aktueller Rahmen beendet */
+} pt_frame_action_t;
+    
+/**
+ * @brief 接口调用帧（替代递归调用的显式栈帧） / Interface call frame (explicit stack frame replacing recursive calls) / Schnittstellenaufrufrahmen (expliziter Stapelrahmen anstelle rekursiver Aufrufe)
+ */
+typedef struct pt_call_frame_s {
+    struct pt_call_frame_s* parent;    /**< 父帧（根帧为NULL） / Parent frame (NULL for root) / Elternrahmen (NULL für Wurzel) */
+    struct pt_call_frame_s* next_free; /**< 帧池空闲链表 / Frame pool free list / Rahmenpool-Freiliste */
+    size_t rule_index;                 /**< 规则在ctx->rules中的索引（外部规则为SIZE_MAX） / Rule index in ctx->rules (SIZE_MAX for external rule) / Regelindex in ctx->rules (SIZE_MAX für externe Regel) */
+    const pointer_transfer_rule_t* external_rule; /**< 不在规则数组内的规则 / Rule outside rules array / Regel außerhalb des Regel-Arrays */
+    pt_typed_value_t value;            /**< 要传递的值（按值保存） / Value to transfer (held by value) / Zu übertragender Wert (als Wert gehalten) */
+    int depth;                         /**< 调用深度 / Call depth / Aufruftiefe */
+    int skip_param_cleanup;            /**< 是否跳过参数清理 / Whether to skip parameter cleanup / Ob Parameterbereinigung übersprungen werden soll */
+    pt_frame_stage_t stage;            /**< 当前阶段 / Current stage / Aktuelle Phase */
+    int result;                        /**< 帧结果 / Frame result / Rahmenergebnis */
+    int child_result;                  /**< 最近子帧结果 / Latest child frame result / Ergebnis des letzten Kindrahmens */
+    size_t cycle_mark;                 /**< 调用循环标记 / Call cycle mark / Aufrufzyklus-Markierung */
+    int prepared;                      /**< 调用资源是否已准备 / Whether call resources are prepared / Ob Aufrufressourcen vorbereitet sind */
+    target_interface_state_t* state;   /**< 接口状态 / Interface state / Schnittstellenstatus */
+    plugin_registry_entry_t* plugin_entry; /**< 调用期间固定的目标插件 / Target plugin pinned for the call / Für den Aufruf fixiertes Ziel-Plugin */
+    target_interface_state_t* state_base; /**< 获取state时的状态数组基址 / States array base when state was obtained / Status-Array-Basis beim Abrufen von state */
+    int actual_param_count;            /**< 实际参数数量 / Actual parameter count / Tatsächliche Parameteranzahl */
+    pt_return_type_t return_type;      /**< 返回值类型 / Return type / Rückgabetyp */
+    size_t return_size;                /**< 返回值大小 / Return size / Rückgabegröße */
+    void* struct_buffer;               /**< 结构体缓冲区 / Struct buffer / Strukturpuffer */
+    int64_t result_int;                /**< 整数结果 / Integer result / Ganzzahlergebnis */
+    double result_float;               /**< 浮点数结果 / Float result / Gleitkommaergebnis */
+    size_t matched_rules[PT_FRAME_MAX_MATCHED_RULES]; /**< 匹配的返回值规则索引 / Matched return value rule indices / Passende Rückgabewert-Regelindizes */
+    int processed[PT_FRAME_MAX_MATCHED_RULES];        /**< 已处理标记 / Processed flags / Verarbeitungsmarkierungen */
+    size_t matched_count;              /**< 匹配的规则数量 / Matched rule count / Anzahl passender Regeln */
+    size_t match_idx;                  /**< 当前匹配游标 / Current match cursor / Aktueller Treffer-Cursor */
+    size_t active_rule_idx;            /**< 当前活动规则索引 / Current active rule index / Aktueller aktiver Regelindex */
+    size_t group_rules[PT_FRAME_MAX_GROUP_RULES];     /**< SetGroup规则索引 / SetGroup rule indices / SetGroup-Regelindizes */
+    size_t group_count;                /**< SetGroup规则数量 / SetGroup rule count / Anzahl SetGroup-Regeln */
+    size_t group_idx;                  /**< 当前SetGroup游标 / Current SetGroup cursor / Aktueller SetGroup-Cursor */
+    size_t param_rule_idx;             /**< 当前参数值规则游标 / Current parameter value rule cursor / Aktueller Parameterwert-Regel-Cursor */
+    int memo_pending;                  /**< 未命中后待存储记忆化结果标志 / Memoized result pending store after miss / Memoisiertes Ergebnis nach Fehltreffer zu speichern */
+    void* memo_buffer;                 /**< 命中的指针结果副本（帧退出时释放） / Pointer result copy from hit (freed on frame exit) / Zeigerergebniskopie aus Treffer (bei Rahmenaustritt freigegeben) */
+    int has_batch_result;              /**< 结果已由批量调用给出，跳过插件调用 / Result was produced by a batch call, skip the plugin call / Ergebnis stammt aus einem Batch-Aufruf, Plugin-Aufruf überspringen */
+} pt_call_frame_t;
+    
+/**
+ * @brief 待执行的根调用 / Pending root call / Ausstehender Wurzelaufruf
+ */
+typedef struct {
+    const pointer_transfer_rule_t* rule; /**< 传递规则 / Transfer rule / Übertragungsregel */
+    pt_typed_value_t value;            /**< 要传递的值 / Value to transfer / Zu übertragender Wert */
+    size_t rank;                       /**< 目标接口的拓扑序号（内部使用） / Topological rank of target interface (internal) / Topologischer Rang der Zielschnittstelle (intern) */
+    size_t order;                      /**< 提交顺序（内部使用） / Submission order (internal) / Einreichungsreihenfolge (intern) */
+} pt_pending_call_t;
+    
+/**
+ * @brief 从当前线程帧池获取调用帧 / Acquire call frame from current thread frame pool / Aufrufrahmen aus Rahmenpool des aktuellen Threads abrufen
+ * @return 成功返回帧指针，失败返回NULL / Returns frame pointer on success, NULL on failure / Gibt Rahmenzeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_call_frame_t* acquire_call_frame(void);
+    
+/**
+ * @brief 将调用帧归还当前线程帧池 / Return call frame to current thread frame pool / Aufrufrahmen an Rahmenpool des aktuellen Threads zurückgeben
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ */
+void release_call_frame(pt_call_frame_t* frame);
+    
+/**
+ * @brief 创建帧池列表锁 / Create frame pool list lock / Sperre der Rahmenpool-Liste erstellen
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int init_call_frame_pool_lock(void);
+    
+/**
+ * @brief 释放所有线程的帧池 / Free frame pools of all threads / Rahmenpools aller Threads freigeben
+ */
+void free_call_frame_pool(void);
+    
+/**
+ * @brief 初始化调用帧 / Initialize call frame / Aufrufrahmen initialisieren
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param value 要传递的值，复制到帧内（NULL为空指针） / Value to transfer, copied into the frame (NULL for a null pointer) / Zu übertragender Wert, in den Rahmen kopiert (NULL für einen Nullzeiger)
+ * @param parent 父帧（根帧为NULL） / Parent frame (NULL for root) / Elternrahmen (NULL für Wurzel)
+ */
+void init_call_frame(pt_call_frame_t* frame, const pointer_transfer_rule_t* rule, const pt_typed_value_t* value, pt_call_frame_t* parent);
+    
+/**
+ * @brief 获取调用帧的规则 / Get rule of call frame / Regel des Aufrufrahmens abrufen
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @return 规则指针，失败返回NULL / Rule pointer, NULL on failure / Regelzeiger, NULL bei Fehler
+ */
+const pointer_transfer_rule_t* get_call_frame_rule(const pt_call_frame_t* frame);
+    
+/**
+ * @brief 获取最大调用深度 / Get maximum call depth / Maximale Aufruftiefe abrufen
+ * @return 最大调用深度 / Maximum call depth / Maximale Aufruftiefe
+ */
+int get_max_call_depth(void);
+    
+/**
+ * @brief 执行调用帧的一步 / Execute one step of call frame / Einen Schritt des Aufrufrahmens ausführen
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t step_call_frame(pt_call_frame_t* frame, pt_call_frame_t** child_out);
+    
+/**
+ * @brief 分派下一条返回值传递规则 / Dispatch next return value transfer rule / Nächste Rückgabewert-Übertragungsregel verteilen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t step_return_value_rules(pointer_transfer_context_t* ctx, pt_call_frame_t* frame, pt_call_frame_t** child_out);
+    
+/**
+ * @brief 非SetGroup规则子调用完成后继续 / Resume after non-SetGroup rule child call / Nach Nicht-SetGroup-Regel-Kindaufruf fortsetzen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t resume_non_setgroup_rule(pointer_transfer_context_t* ctx, pt_call_frame_t* frame);
+    
+/**
+ * @brief 分派SetGroup规则组的下一条规则 / Dispatch next rule of SetGroup rule group / Nächste Regel der SetGroup-Regelgruppe verteilen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t step_setgroup_rule_group(pointer_transfer_context_t* ctx, pt_call_frame_t* frame, pt_call_frame_t** child_out);
+    
+/**
+ * @brief SetGroup规则子调用完成后继续 / Resume after SetGroup rule child call / Nach SetGroup-Regel-Kindaufruf fortsetzen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t resume_setgroup_rule(pointer_transfer_context_t* ctx, pt_call_frame_t* frame);
+    
+/**
+ * @brief 分派下一条参数值传递规则 / Dispatch next parameter value transfer rule / Nächste Parameterwert-Übertragungsregel verteilen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @param child_out 输出要压入的子帧 / Output child frame to push / Ausgabe abzulegender Kindrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t step_parameter_value_rules(pointer_transfer_context_t* ctx, pt_call_frame_t* frame, pt_call_frame_t** child_out);
+    
+/**
+ * @brief 参数值规则子调用完成后继续 / Resume after parameter value rule child call / Nach Parameterwert-Regel-Kindaufruf fortsetzen
+ * @param ctx 上下文 / Context / Kontext
+ * @param frame 调用帧 / Call frame / Aufrufrahmen
+ * @return 帧动作 / Frame action / Rahmenaktion
+ */
+pt_frame_action_t resume_parameter_value_rule(pointer_transfer_context_t* ctx, pt_call_frame_t* frame);
+    
+/**
+ * @brief 准备SetGroup规则子帧参数 / Prepare SetGroup rule child frame argument / SetGroup-Regel-Kindrahmen-Argument vorbereiten
+ * @param group_rule SetGroup规则 / SetGroup rule / SetGroup-Regel
+ * @param rule_idx 规则索引 / Rule index / Regelindex
+ * @param group_result_int 组整数结果 / Group integer result / Gruppen-Ganzzahlergebnis
+ * @param group_result_float 组浮点数结果 / Group float result / Gruppen-Gleitkommaergebnis
+ * @param group_return_type 组返回值类型 / Group return type / Gruppen-Rückgabetyp
+ * @param child 已初始化的子帧 / Initialized child frame / Initialisierter Kindrahmen
+ */
+void prepare_setgroup_rule_call(const pointer_transfer_rule_t* group_rule, size_t rule_idx,
+                                int64_t group_result_int, double group_result_float,
+                                pt_return_type_t group_return_type, pt_call_frame_t* child);
+    
+/**
+ * @brief 准备非SetGroup规则子帧参数 / Prepare non-SetGroup rule child frame argument / Nicht-SetGroup-Regel-Kindrahmen-Argument vorbereiten
+ * @param active_rule 活动规则 / Active rule / Aktive Regel
+ * @param rule_idx 规则索引 / Rule index / Regelindex
+ * @param frame 父帧（提供返回值） / Parent frame (provides return value) / Elternrahmen (liefert Rückgabewert)
+ * @param child 已初始化的子帧 / Initialized child frame / Initialisierter Kindrahmen
+ */
+void prepare_non_setgroup_rule_call(const pointer_transfer_rule_t* active_rule, size_t rule_idx,
+                                    const pt_call_frame_t* frame, pt_call_frame_t* child);
+    
+/**
+ * @brief 查找纯接口调用的记忆化结果 / Look up memoized result of pure interface call / Memoisiertes Ergebnis eines reinen Schnittstellenaufrufs suchen
+ * @details 命中时填充帧结果；未命中时标记帧待存储 / Fills frame result on hit; marks frame for store on miss / Füllt Rahmenergebnis bei Treffer; markiert Rahmen bei Fehltreffer zum Speichern
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param frame 已准备的调用帧 / Prepared call frame / Vorbereiteter Aufrufrahmen
+ * @return 命中返回0，否则返回-1 / Returns 0 on hit, -1 otherwise / Gibt 0 bei Treffer zurück, sonst -1
+ */
+int lookup_memoized_result(const pointer_transfer_rule_t* rule, pt_call_frame_t* frame);
+    
+/**
+ * @brief 存储纯接口调用的结果 / Store result of pure interface call / Ergebnis eines reinen Schnittstellenaufrufs speichern
+ * @param rule 传递规则 / Transfer rule / Übertragungsregel
+ * @param frame 已执行的调用帧 / Executed call frame / Ausgeführter Aufrufrahmen
+ */
+void store_memoized_result(const pointer_transfer_rule_t* rule, pt_call_frame_t* frame);
+    
+/**
+ * @brief 释放当前线程的记忆化键缓冲区 / Free memoization key buffer of current thread / Memoisierungs-Schlüsselpuffer des aktuellen Threads freigeben
+ */
+void free_memo_key_buffer(void);
+    
+/**
+ * @brief 重排并执行一组相互独立的待执行调用 / Reorder and execute a set of independent pending calls / Eine Menge unabhängiger ausstehender Aufrufe umordnen und ausführen
+ * @details 按目标接口的拓扑序号稳定排序，同序号内按规则分组；同一规则的连续调用合并为一次<Interface>_Vec调用，不可批量时逐个执行 / Stable-sorts by the topological rank of the target interface and groups by rule within a rank; consecutive calls of the same rule are merged into one <Interface>_Vec call, or run one by one when batching does not apply / Stabil nach dem topologischen Rang der Zielschnittstelle sortiert und innerhalb eines Rangs nach Regel gruppiert; aufeinanderfolgende Aufrufe derselben Regel werden zu einem <Interface>_Vec-Aufruf zusammengefasst oder einzeln ausgeführt, wenn kein Batch möglich ist
+ * @note 不交错执行不同根调用的帧：目标接口的参数槽和调用环标记按接口共享，交错会相互覆盖 / Frames of different root calls are not interleaved: parameter slots and call cycle marks are shared per interface, interleaving would overwrite them / Rahmen verschiedener Wurzelaufrufe werden nicht verschränkt: Parameterslots und Aufrufzyklus-Markierungen werden je Schnittstelle geteilt, Verschränkung würde sie überschreiben
+ * @param calls 待执行调用数组（原地重排） / Pending call array (reordered in place) / Array ausstehender Aufrufe (an Ort und Stelle umgeordnet)
+ * @param count 调用数量 / Call count / Anzahl der Aufrufe
+ * @param success_count 累加成功的调用数 / Accumulates successful calls / Summiert erfolgreiche Aufrufe
+ * @return 成功返回0，内存不足返回-1（此时没有执行任何调用） / Returns 0 on success, -1 when out of memory (no call has run then) / Gibt 0 bei Erfolg zurück, -1 bei Speichermangel (dann wurde kein Aufruf ausgeführt)
+ */
+int run_pending_calls(pt_pending_call_t* calls, size_t count, size_t* success_count);
+    
 #ifdef __cplusplus
 }
 #endif
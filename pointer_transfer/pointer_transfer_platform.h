@@ -14,14 +14,28 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
+/* 线程局部存储限定符 / Thread-local storage qualifier / Thread-lokaler Speicherqualifizierer */
+#ifdef _WIN32
+#define PT_THREAD_LOCAL __declspec(thread)
+#else
+#define PT_THREAD_LOCAL __thread
+#endif
+    
 /**
  * @brief 加载动态库 / Load dynamic library / Dynamische Bibliothek laden
  * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
  * @return 动态库句柄，失败返回NULL / Dynamic library handle, NULL on failure / Dynamisches Bibliothekshandle, NULL bei Fehler
  */
 void* pt_platform_load_library(const char* plugin_path);
-
+    
+/**
+ * @brief 加载动态库并立即绑定所有符号 / Load dynamic library and bind all symbols immediately / Dynamische Bibliothek laden und alle Symbole sofort binden
+ * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
+ * @return 动态库句柄，失败返回NULL / Dynamic library handle, NULL on failure / Dynamisches Bibliothekshandle, NULL bei Fehler
+ */
+void* pt_platform_load_library_bind_now(const char* plugin_path);
+    
 /**
  * @brief 获取动态库符号 / Get dynamic library symbol / Dynamisches Bibliothekssymbol abrufen
  * @param handle 动态库句柄 / Dynamic library handle / Dynamisches Bibliothekshandle
@@ -29,14 +43,24 @@ void* pt_platform_load_library(const char* plugin_path);
  * @return 符号地址，失败返回NULL / Symbol address, NULL on failure / Symboladresse, NULL bei Fehler
  */
 void* pt_platform_get_symbol(void* handle, const char* symbol_name);
-
+    
 /**
  * @brief 关闭动态库 / Close dynamic library / Dynamische Bibliothek schließen
  * @param handle 动态库句柄 / Dynamic library handle / Dynamisches Bibliothekshandle
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int32_t pt_platform_close_library(void* handle);
-
+    
+/**
+ * @brief 从库文件的动态符号表检查导出函数（不加载、不执行库代码） / Check exported functions in the library file's dynamic symbol table (nothing is loaded or executed) / Exportierte Funktionen in der Dynamiksymboltabelle der Bibliotheksdatei prüfen (nichts wird geladen oder ausgeführt)
+ * @param library_path 库文件路径 / Library file path / Bibliotheksdateipfad
+ * @param symbol_names 要检查的符号名称 / Symbol names to check / Zu prüfende Symbolnamen
+ * @param symbol_count 符号数量 / Symbol count / Symbolanzahl
+ * @param found 输出每个符号是否导出 / Outputs whether each symbol is exported / Gibt aus, ob jedes Symbol exportiert wird
+ * @return 成功返回0，格式不支持或无法解析返回-1 / Returns 0 on success, -1 if the format is unsupported or cannot be parsed / Gibt 0 bei Erfolg zurück, -1 wenn das Format nicht unterstützt wird oder nicht geparst werden kann
+ */
+int32_t pt_platform_check_library_exports(const char* library_path, const char* const* symbol_names, size_t symbol_count, int* found);
+    
 /**
  * @brief 平台函数调用 / Platform function call / Plattform-Funktionsaufruf
  * @param func_ptr 函数指针 / Function pointer / Funktionszeiger
@@ -44,6 +68,8 @@ int32_t pt_platform_close_library(void* handle);
  * @param param_types 参数类型数组 / Parameter types array / Parametertyp-Array
  * @param param_values 参数值数组 / Parameter values array / Parameterwerte-Array
  * @param param_sizes 参数大小数组，可为NULL / Parameter sizes array, can be NULL / Parametergrößen-Array, kann NULL sein
+ * @param param_borrowed 参数借用标志数组，可为NULL；置位的结构体参数直接传递原指针 / Parameter borrow flags array, can be NULL; flagged struct parameters pass the original pointer / Parameter-Ausleih-Flag-Array, kann NULL sein; markierte Strukturparameter übergeben den Originalzeiger
+ * @param pack_version 插件接受的参数包版本 / Parameter pack version accepted by the plugin / Vom Plugin akzeptierte Parameterpaket-Version
  * @param return_type 返回值类型 / Return value type / Rückgabewerttyp
  * @param return_size 返回值大小 / Return value size / Rückgabewertgröße
  * @param result_int 输出整数返回值指针 / Output integer return value pointer / Ausgabe-Integer-Rückgabewert-Zeiger
@@ -52,8 +78,40 @@ int32_t pt_platform_close_library(void* handle);
  * @return 成功返回0，错误返回非0 / Returns 0 on success, non-zero on error / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int32_t pt_platform_safe_call(void* func_ptr, int param_count, void* param_types, void** param_values, void* param_sizes,
-                               pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct);
-
+                               const int* param_borrowed, uint32_t pack_version, pt_return_type_t return_type, size_t return_size, int64_t* result_int, double* result_float, void* result_struct);
+    
+/**
+ * @brief 按声明的签名计算原生调用计划 / Compute the native call plan from the declared signature / Plan für native Aufrufe aus der deklarierten Signatur berechnen
+ * @param param_count 参数数量 / Parameter count / Parameteranzahl
+ * @param param_types 参数类型数组 / Parameter types array / Parametertyp-Array
+ * @param return_type 声明的返回值类型 / Declared return type / Deklarierter Rückgabetyp
+ * @param plan 输出调用计划 / Output call plan / Ausgabe-Aufrufplan
+ * @return 可原生调用返回0，所需栈槽超出上限返回PT_NATIVE_CALL_STACK_OVERFLOW，否则返回-1（目前仅支持System V x86-64） / Returns 0 if callable natively, PT_NATIVE_CALL_STACK_OVERFLOW if it needs more stack slots than allowed, -1 otherwise (only System V x86-64 for now) / Gibt 0 zurück, wenn nativ aufrufbar, PT_NATIVE_CALL_STACK_OVERFLOW wenn mehr Stack-Slots als erlaubt nötig sind, sonst -1 (derzeit nur System V x86-64)
+ */
+int32_t pt_platform_prepare_native_call(int param_count, const nxld_param_type_t* param_types, nxld_return_type_t return_type,
+                                        pt_native_call_plan_t* plan);
+    
+/**
+ * @brief 按原生调用计划调用函数（不创建参数包） / Call a function through its native call plan (no parameter pack is built) / Funktion über ihren Plan für native Aufrufe aufrufen (kein Parameterpaket)
+ * @param func_ptr 函数指针 / Function pointer / Funktionszeiger
+ * @param plan 调用计划 / Call plan / Aufrufplan
+ * @param param_types 参数类型数组 / Parameter types array / Parametertyp-Array
+ * @param param_values 参数值数组 / Parameter values array / Parameterwerte-Array
+ * @param result_int 输出整数返回值指针 / Output integer return value pointer / Ausgabe-Integer-Rückgabewert-Zeiger
+ * @param result_float 输出浮点返回值指针 / Output floating-point return value pointer / Ausgabe-Gleitkomma-Rückgabewert-Zeiger
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_native_call(void* func_ptr, const pt_native_call_plan_t* plan, const nxld_param_type_t* param_types,
+                                void* const* param_values, int64_t* result_int, double* result_float);
+    
+/**
+ * @brief 调用批量接口<Interface>_Vec / Call a batch interface <Interface>_Vec / Batch-Schnittstelle <Interface>_Vec aufrufen
+ * @param func_ptr 批量函数指针 / Batch function pointer / Batch-Funktionszeiger
+ * @param batch 列布局的批量调用 / Batch call in column layout / Batch-Aufruf im Spaltenlayout
+ * @return 插件的返回值，0表示成功 / The plugin's return value, 0 means success / Rückgabewert des Plugins, 0 bedeutet Erfolg
+ */
+int32_t pt_platform_vector_call(void* func_ptr, const void* batch);
+    
 /**
  * @brief 获取文件修改时间戳 / Get file modification timestamp / Dateiänderungszeitstempel abrufen
  * @param file_path 文件路径 / File path / Dateipfad
@@ -61,17 +119,293 @@ int32_t pt_platform_safe_call(void* func_ptr, int param_count, void* param_types
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
 int32_t pt_platform_get_file_timestamp(const char* file_path, int64_t* timestamp);
-
+    
 /**
- * @brief 从插件路径获取目录并递归查找所有DLL文件 / Get directory from plugin path and recursively find all DLL files / Verzeichnis aus Plugin-Pfad abrufen und alle DLL-Dateien rekursiv finden
- * @param plugin_path 插件文件路径 / Plugin file path / Plugin-Dateipfad
- * @param dll_files 输出DLL文件路径数组 / Output DLL file paths array / Ausgabe-DLL-Dateipfad-Array
- * @param max_files 最大文件数量 / Maximum file count / Maximale Dateianzahl
- * @param file_count 输出找到的文件数量 / Output found file count / Ausgabe gefundene Dateianzahl
+ * @brief 获取文件大小和修改时间戳 / Get file size and modification timestamp / Dateigröße und Änderungszeitstempel abrufen
+ * @param file_path 文件路径 / File path / Dateipfad
+ * @param size 输出文件大小 / Output file size / Ausgabe-Dateigröße
+ * @param timestamp 输出时间戳 / Output timestamp / Ausgabe-Zeitstempel
  * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
  */
-int32_t pt_platform_find_all_dll_files(const char* plugin_path, char dll_files[][1024], int max_files, int* file_count);
-
+int32_t pt_platform_get_file_stat(const char* file_path, uint64_t* size, int64_t* timestamp);
+    
+/**
+ * @brief 平台只读文件映射类型（不透明） / Platform read-only file mapping type (opaque) / Plattform-Typ für schreibgeschützte Dateizuordnung (undurchsichtig)
+ */
+typedef struct pt_platform_file_map_s pt_platform_file_map_t;
+    
+/**
+ * @brief 以只读方式映射整个文件 / Map whole file read-only / Gesamte Datei schreibgeschützt zuordnen
+ * @param file_path 文件路径 / File path / Dateipfad
+ * @return 成功返回映射指针，失败返回NULL / Returns mapping pointer on success, NULL on failure / Gibt Zuordnungszeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_file_map_t* pt_platform_file_map_open(const char* file_path);
+    
+/**
+ * @brief 获取映射数据 / Get mapped data / Zugeordnete Daten abrufen
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ * @return 映射数据，空文件返回NULL / Mapped data, NULL for empty files / Zugeordnete Daten, NULL bei leeren Dateien
+ */
+const void* pt_platform_file_map_data(const pt_platform_file_map_t* map);
+    
+/**
+ * @brief 获取映射大小 / Get mapped size / Zuordnungsgröße abrufen
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ * @return 映射字节数 / Mapped byte count / Anzahl zugeordneter Bytes
+ */
+size_t pt_platform_file_map_size(const pt_platform_file_map_t* map);
+    
+/**
+ * @brief 解除文件映射 / Close file mapping / Dateizuordnung schließen
+ * @param map 文件映射 / File mapping / Dateizuordnung
+ */
+void pt_platform_file_map_close(pt_platform_file_map_t* map);
+    
+/**
+ * @brief 用临时文件替换目标文件 / Replace target file with temporary file / Zieldatei durch temporäre Datei ersetzen
+ * @param temp_path 临时文件路径 / Temporary file path / Temporärer Dateipfad
+ * @param target_path 目标文件路径 / Target file path / Zieldateipfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_replace_file(const char* temp_path, const char* target_path);
+    
+/**
+ * @brief 复制文件，覆盖已存在的目标 / Copy file, overwriting an existing target / Datei kopieren, vorhandenes Ziel überschreiben
+ * @param source_path 源文件路径 / Source file path / Quelldateipfad
+ * @param target_path 目标文件路径 / Target file path / Zieldateipfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_copy_file(const char* source_path, const char* target_path);
+    
+/**
+ * @brief 检查文件名是否为动态链接库 / Check if file name is a dynamic library / Prüfen, ob Dateiname eine dynamische Bibliothek ist
+ * @param file_name 文件名 / File name / Dateiname
+ * @return 是返回1，否则返回0 / Returns 1 if so, 0 otherwise / Gibt 1 zurück wenn ja, sonst 0
+ */
+int pt_platform_is_library_name(const char* file_name);
+    
+/**
+ * @brief 目录枚举回调 / Directory enumeration callback / Rückruf der Verzeichnisaufzählung
+ * @return 继续返回0，停止枚举返回非0 / Returns 0 to continue, non-zero to stop the enumeration / Gibt 0 zum Fortfahren zurück, ungleich 0 zum Beenden der Aufzählung
+ */
+typedef int (*pt_platform_dir_entry_func_t)(const char* file_path, uint64_t size, int64_t timestamp, void* user_data);
+    
+/**
+ * @brief 枚举目录中的动态链接库（不递归） / Enumerate dynamic libraries in a directory (non-recursive) / Dynamische Bibliotheken eines Verzeichnisses aufzählen (nicht rekursiv)
+ * @param dir_path 目录路径 / Directory path / Verzeichnispfad
+ * @param callback 每个库调用一次，返回非0停止枚举 / Called once per library, non-zero return stops the enumeration / Einmal pro Bibliothek aufgerufen, Rückgabe ungleich 0 beendet die Aufzählung
+ * @param user_data 回调用户数据 / Callback user data / Rückruf-Benutzerdaten
+ * @return 成功返回0，无法打开目录返回-1 / Returns 0 on success, -1 if the directory cannot be opened / Gibt 0 bei Erfolg zurück, -1 wenn das Verzeichnis nicht geöffnet werden kann
+ */
+int32_t pt_platform_scan_library_dir(const char* dir_path, pt_platform_dir_entry_func_t callback, void* user_data);
+    
+/**
+ * @brief 平台互斥锁（不透明类型） / Platform mutex (opaque type) / Plattform-Mutex (opaker Typ)
+ */
+typedef struct pt_platform_mutex_s pt_platform_mutex_t;
+    
+/**
+ * @brief 创建互斥锁 / Create mutex / Mutex erstellen
+ * @return 成功返回互斥锁指针，失败返回NULL / Returns mutex pointer on success, NULL on failure / Gibt Mutex-Zeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_mutex_t* pt_platform_mutex_create(void);
+    
+/**
+ * @brief 销毁互斥锁 / Destroy mutex / Mutex zerstören
+ * @param mutex 互斥锁 / Mutex / Mutex
+ */
+void pt_platform_mutex_destroy(pt_platform_mutex_t* mutex);
+    
+/**
+ * @brief 加锁 / Lock mutex / Mutex sperren
+ * @param mutex 互斥锁 / Mutex / Mutex
+ */
+void pt_platform_mutex_lock(pt_platform_mutex_t* mutex);
+    
+/**
+ * @brief 解锁 / Unlock mutex / Mutex entsperren
+ * @param mutex 互斥锁 / Mutex / Mutex
+ */
+void pt_platform_mutex_unlock(pt_platform_mutex_t* mutex);
+    
+/**
+ * @brief 原子存储整数（释放语义） / Atomically store integer (release semantics) / Ganzzahl atomar speichern (Release-Semantik)
+ * @param target 目标地址 / Target address / Zieladresse
+ * @param value 新值 / New value / Neuer Wert
+ */
+void pt_platform_atomic_store_int(volatile int* target, int value);
+    
+/**
+ * @brief 原子读取整数（获取语义） / Atomically load integer (acquire semantics) / Ganzzahl atomar laden (Acquire-Semantik)
+ * @param target 目标地址 / Target address / Zieladresse
+ * @return 当前值 / Current value / Aktueller Wert
+ */
+int pt_platform_atomic_load_int(const volatile int* target);
+    
+/**
+ * @brief 原子加法并返回旧值 / Atomically add and return previous value / Atomar addieren und vorherigen Wert zurückgeben
+ * @param target 目标地址 / Target address / Zieladresse
+ * @param value 增量 / Increment / Inkrement
+ * @return 加法前的值 / Value before the addition / Wert vor der Addition
+ */
+int pt_platform_atomic_fetch_add_int(volatile int* target, int value);
+    
+/**
+ * @brief 获取单调时钟毫秒数 / Get monotonic clock milliseconds / Monotone Uhr in Millisekunden abrufen
+ * @return 单调时钟毫秒数 / Monotonic clock milliseconds / Monotone Uhr in Millisekunden
+ */
+int64_t pt_platform_get_monotonic_ms(void);
+    
+/**
+ * @brief 获取单调时钟微秒数 / Get monotonic clock microseconds / Monotone Uhr in Mikrosekunden abrufen
+ * @return 单调时钟微秒数 / Monotonic clock microseconds / Monotone Uhr in Mikrosekunden
+ */
+int64_t pt_platform_get_monotonic_us(void);
+    
+/**
+ * @brief 平台读写锁（不透明类型） / Platform read-write lock (opaque type) / Plattform-Lese-Schreib-Sperre (opaker Typ)
+ */
+typedef struct pt_platform_rwlock_s pt_platform_rwlock_t;
+    
+/**
+ * @brief 创建读写锁 / Create read-write lock / Lese-Schreib-Sperre erstellen
+ * @return 成功返回读写锁指针，失败返回NULL / Returns read-write lock pointer on success, NULL on failure / Gibt Lese-Schreib-Sperren-Zeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_rwlock_t* pt_platform_rwlock_create(void);
+    
+/**
+ * @brief 销毁读写锁 / Destroy read-write lock / Lese-Schreib-Sperre zerstören
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_destroy(pt_platform_rwlock_t* rwlock);
+    
+/**
+ * @brief 获取读锁 / Acquire read lock / Lesesperre erwerben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_read_lock(pt_platform_rwlock_t* rwlock);
+    
+/**
+ * @brief 释放读锁 / Release read lock / Lesesperre freigeben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_read_unlock(pt_platform_rwlock_t* rwlock);
+    
+/**
+ * @brief 获取写锁 / Acquire write lock / Schreibsperre erwerben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_write_lock(pt_platform_rwlock_t* rwlock);
+    
+/**
+ * @brief 释放写锁 / Release write lock / Schreibsperre freigeben
+ * @param rwlock 读写锁 / Read-write lock / Lese-Schreib-Sperre
+ */
+void pt_platform_rwlock_write_unlock(pt_platform_rwlock_t* rwlock);
+    
+/**
+ * @brief 平台线程（不透明类型） / Platform thread (opaque type) / Plattform-Thread (opaker Typ)
+ */
+typedef struct pt_platform_thread_s pt_platform_thread_t;
+    
+/**
+ * @brief 线程入口函数类型 / Thread entry function type / Thread-Einstiegsfunktionstyp
+ */
+typedef void (*pt_platform_thread_func_t)(void* arg);
+    
+/**
+ * @brief 创建线程 / Create thread / Thread erstellen
+ * @param func 线程入口函数 / Thread entry function / Thread-Einstiegsfunktion
+ * @param arg 入口函数参数 / Entry function argument / Argument der Einstiegsfunktion
+ * @return 成功返回线程指针，失败返回NULL / Returns thread pointer on success, NULL on failure / Gibt Thread-Zeiger bei Erfolg zurück, NULL bei Fehler
+ */
+pt_platform_thread_t* pt_platform_thread_create(pt_platform_thread_func_t func, void* arg);
+    
+/**
+ * @brief 等待线程结束并释放线程 / Wait for thread to finish and free it / Auf Thread-Ende warten und Thread freigeben
+ * @param thread 线程 / Thread / Thread
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_thread_join(pt_platform_thread_t* thread);
+    
+/**
+ * @brief 获取在线处理器数量 / Get number of online processors / Anzahl der verfügbaren Prozessoren abrufen
+ * @return 处理器数量，无法确定时返回1 / Processor count, 1 if unknown / Prozessoranzahl, 1 wenn unbekannt
+ */
+uint32_t pt_platform_get_cpu_count(void);
+    
+/**
+ * @brief 休眠指定毫秒数 / Sleep for given milliseconds / Für angegebene Millisekunden schlafen
+ * @param milliseconds 毫秒数 / Milliseconds / Millisekunden
+ */
+void pt_platform_sleep_ms(uint32_t milliseconds);
+    
+/**
+ * @brief 平台文件监视器（不透明类型） / Platform file watcher (opaque type) / Plattform-Dateiüberwachung (opaker Typ)
+ */
+typedef struct pt_platform_watch_s pt_platform_watch_t;
+    
+/**
+ * @brief 创建文件监视器 / Create file watcher / Dateiüberwachung erstellen
+ * @return 成功返回监视器指针，平台不支持或失败返回NULL / Returns watcher pointer on success, NULL if unsupported or on failure / Gibt Überwachungszeiger bei Erfolg zurück, NULL wenn nicht unterstützt oder bei Fehler
+ */
+pt_platform_watch_t* pt_platform_watch_create(void);
+    
+/**
+ * @brief 添加要监视的文件 / Add file to watch / Zu überwachende Datei hinzufügen
+ * @param watch 文件监视器 / File watcher / Dateiüberwachung
+ * @param file_path 文件路径 / File path / Dateipfad
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int32_t pt_platform_watch_add(pt_platform_watch_t* watch, const char* file_path);
+    
+/**
+ * @brief 等待被监视文件变化 / Wait for watched file change / Auf Änderung überwachter Dateien warten
+ * @param watch 文件监视器 / File watcher / Dateiüberwachung
+ * @param timeout_ms 超时毫秒数 / Timeout in milliseconds / Zeitlimit in Millisekunden
+ * @return 被监视文件有变化返回1，超时或无关变化返回0，失败返回-1 / Returns 1 if a watched file changed, 0 on timeout or unrelated change, -1 on failure / Gibt 1 zurück, wenn eine überwachte Datei geändert wurde, 0 bei Zeitüberschreitung oder fremder Änderung, -1 bei Fehler
+ */
+int32_t pt_platform_watch_wait(pt_platform_watch_t* watch, uint32_t timeout_ms);
+    
+/**
+ * @brief 销毁文件监视器 / Destroy file watcher / Dateiüberwachung zerstören
+ * @param watch 文件监视器 / File watcher / Dateiüberwachung
+ */
+void pt_platform_watch_destroy(pt_platform_watch_t* watch);
+    
+/**
+ * @brief 平台目录监视器（不透明类型） / Platform directory watcher (opaque type) / Plattform-Verzeichnisüberwachung (opaker Typ)
+ */
+typedef struct pt_platform_dir_watch_s pt_platform_dir_watch_t;
+    
+/**
+ * @brief 目录变化回调 / Directory change callback / Rückruf bei Verzeichnisänderung
+ * @param file_name 变化的文件名（不含目录），NULL表示需要重新扫描整个目录 / Changed file name (without directory), NULL means the whole directory must be rescanned / Geänderter Dateiname (ohne Verzeichnis), NULL bedeutet, dass das ganze Verzeichnis neu gescannt werden muss
+ */
+typedef void (*pt_platform_dir_change_func_t)(const char* file_name, void* user_data);
+    
+/**
+ * @brief 创建目录监视器 / Create directory watcher / Verzeichnisüberwachung erstellen
+ * @param dir_path 目录路径 / Directory path / Verzeichnispfad
+ * @return 成功返回监视器指针，平台不支持或失败返回NULL / Returns watcher pointer on success, NULL if unsupported or on failure / Gibt Überwachungszeiger bei Erfolg zurück, NULL wenn nicht unterstützt oder bei Fehler
+ */
+pt_platform_dir_watch_t* pt_platform_dir_watch_create(const char* dir_path);
+    
+/**
+ * @brief 取出所有待处理的目录变化（不阻塞） / Drain all pending directory changes (non-blocking) / Alle ausstehenden Verzeichnisänderungen abholen (nicht blockierend)
+ * @param watch 目录监视器 / Directory watcher / Verzeichnisüberwachung
+ * @param callback 每个变化的文件名调用一次 / Called once per changed file name / Einmal pro geändertem Dateinamen aufgerufen
+ * @param user_data 回调用户数据 / Callback user data / Rückruf-Benutzerdaten
+ * @return 变化数量，失败返回-1 / Number of changes, -1 on failure / Anzahl der Änderungen, -1 bei Fehler
+ */
+int32_t pt_platform_dir_watch_poll(pt_platform_dir_watch_t* watch, pt_platform_dir_change_func_t callback, void* user_data);
+    
+/**
+ * @brief 销毁目录监视器 / Destroy directory watcher / Verzeichnisüberwachung zerstören
+ * @param watch 目录监视器 / Directory watcher / Verzeichnisüberwachung
+ */
+void pt_platform_dir_watch_destroy(pt_platform_dir_watch_t* watch);
+    
 #ifdef __cplusplus
 }
 #endif
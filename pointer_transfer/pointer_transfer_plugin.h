@@ -8,11 +8,12 @@
 
 #include "nxld_plugin_interface.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 #ifdef _WIN32
 #define POINTER_TRANSFER_PLUGIN_EXPORT __declspec(dllexport)
 #define POINTER_TRANSFER_PLUGIN_CALL __cdecl
@@ -20,7 +21,39 @@ extern "C" {
 #define POINTER_TRANSFER_PLUGIN_EXPORT __attribute__((visibility("default")))
 #define POINTER_TRANSFER_PLUGIN_CALL
 #endif
-
+    
+/**
+ * @brief 初始化选项 / Initialization options / Initialisierungsoptionen
+ */
+typedef struct {
+    size_t struct_size;           /**< 结构体大小，设为sizeof(pointer_transfer_init_options_t) / Structure size, set to sizeof(pointer_transfer_init_options_t) / Strukturgröße, auf sizeof(pointer_transfer_init_options_t) setzen */
+    const char* config_path;      /**< .nxpt配置文件路径，NULL使用库旁的文件 / .nxpt config file path, NULL uses the file next to the library / .nxpt-Konfigurationsdateipfad, NULL verwendet die Datei neben der Bibliothek */
+    int skip_auto_run;            /**< 非0时不自动运行入口插件接口 / Non-zero skips auto-running the entry plugin interface / Ungleich 0 überspringt den Autostart der Einstiegs-Plugin-Schnittstelle */
+} pointer_transfer_init_options_t;
+    
+/**
+ * @brief 同步初始化调度器（幂等） / Initialize the dispatcher synchronously (idempotent) / Dispatcher synchron initialisieren (idempotent)
+ * @param options 初始化选项，NULL使用默认值 / Initialization options, NULL uses defaults / Initialisierungsoptionen, NULL verwendet Standardwerte
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @note 库加载时默认已开始异步初始化；要使用自己的选项，加载前设置环境变量POINTER_TRANSFER_DEFER_INIT=1 / Loading the library starts asynchronous initialization by default; to pass own options, set the environment variable POINTER_TRANSFER_DEFER_INIT=1 before loading / Das Laden der Bibliothek startet standardmäßig die asynchrone Initialisierung; für eigene Optionen vor dem Laden die Umgebungsvariable POINTER_TRANSFER_DEFER_INIT=1 setzen
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL PointerTransferInitialize(const pointer_transfer_init_options_t* options);
+    
+/**
+ * @brief 在后台线程初始化调度器（幂等） / Initialize the dispatcher on a background thread (idempotent) / Dispatcher in einem Hintergrundthread initialisieren (idempotent)
+ * @param options 初始化选项，NULL使用默认值 / Initialization options, NULL uses defaults / Initialisierungsoptionen, NULL verwendet Standardwerte
+ * @return 已开始返回0，失败返回-1 / Returns 0 once started, -1 on failure / Gibt 0 nach dem Start zurück, -1 bei Fehler
+ * @note 其他导出接口在就绪前等待；卸载库时等待入口插件的自动运行结束 / The other exported functions wait until ready; unloading the library waits for the entry plugin's auto-run to end / Die anderen exportierten Funktionen warten bis zur Bereitschaft; das Entladen der Bibliothek wartet auf das Ende des Autostarts des Einstiegs-Plugins
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL PointerTransferInitializeAsync(const pointer_transfer_init_options_t* options);
+    
+/**
+ * @brief 等待调度器就绪 / Wait until the dispatcher is ready / Warten, bis der Dispatcher bereit ist
+ * @return 初始化成功返回0，失败或未开始返回-1 / Returns 0 if initialization succeeded, -1 if it failed or was never started / Gibt 0 zurück, wenn die Initialisierung erfolgreich war, -1 bei Fehler oder wenn sie nie gestartet wurde
+ * @note 不等待入口插件的自动运行 / Does not wait for the entry plugin's auto-run / Wartet nicht auf den Autostart des Einstiegs-Plugins
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL PointerTransferWaitReady(void);
+    
 /**
  * @brief 传递指针 / Transfer pointer / Zeiger übertragen
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
@@ -33,7 +66,63 @@ extern "C" {
  * @return 成功返回0，类型不匹配返回1，其他错误返回-1 / Returns 0 on success, 1 on type mismatch, -1 on other errors / Gibt 0 bei Erfolg zurück, 1 bei Typfehlanpassung, -1 bei anderen Fehlern
  */
 POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferPointer(const char* source_plugin_name, const char* source_interface_name, int source_param_index, void* ptr, nxld_param_type_t expected_type, const char* type_name, size_t data_size);
-
+    
+/**
+ * @brief 按值传递64位整数 / Transfer 64-bit integer by value / 64-Bit-Ganzzahl als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param value 整数值 / Integer value / Ganzzahlwert
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @note 值在调用链中按值传播，调用方无需保持任何存储有效 / The value propagates by value along the call chain, the caller keeps no storage alive / Der Wert wird entlang der Aufrufkette als Wert weitergegeben, der Aufrufer muss keinen Speicher gültig halten
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferInt64(const char* source_plugin_name, const char* source_interface_name, int source_param_index, int64_t value);
+    
+/**
+ * @brief 按值传递双精度浮点数 / Transfer double by value / Double als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param value 浮点值 / Floating-point value / Gleitkommawert
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferDouble(const char* source_plugin_name, const char* source_interface_name, int source_param_index, double value);
+    
+/**
+ * @brief 传递字节缓冲区 / Transfer byte buffer / Bytepuffer übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param data 数据指针 / Data pointer / Datenzeiger
+ * @param size 数据大小 / Data size / Datengröße
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @note 缓冲区只需在调用返回前有效 / The buffer only has to stay valid until the call returns / Der Puffer muss nur bis zur Rückkehr des Aufrufs gültig bleiben
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferBytes(const char* source_plugin_name, const char* source_interface_name, int source_param_index, const void* data, size_t size);
+    
+/**
+ * @brief 批量按值传递64位整数 / Transfer a batch of 64-bit integers by value / Einen Stapel von 64-Bit-Ganzzahlen als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param values 整数数组 / Integer array / Ganzzahl-Array
+ * @param count 数量 / Count / Anzahl
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ * @note 等价于依次对每个值调用TransferInt64，但按规则处理：导出<Interface>_Vec的目标接口对所有值只调用一次 / Equivalent to calling TransferInt64 for each value, but processed rule by rule: target interfaces exporting <Interface>_Vec are called once for all values / Entspricht TransferInt64 für jeden Wert, wird aber Regel für Regel verarbeitet: Zielschnittstellen mit <Interface>_Vec werden für alle Werte nur einmal aufgerufen
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferInt64Batch(const char* source_plugin_name, const char* source_interface_name, int source_param_index, const int64_t* values, size_t count);
+    
+/**
+ * @brief 批量按值传递双精度浮点数 / Transfer a batch of doubles by value / Einen Stapel von Doubles als Wert übertragen
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param values 浮点数组 / Floating-point array / Gleitkomma-Array
+ * @param count 数量 / Count / Anzahl
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferDoubleBatch(const char* source_plugin_name, const char* source_interface_name, int source_param_index, const double* values, size_t count);
+    
 /**
  * @brief 调用目标插件接口 / Call target plugin interface / Ziel-Plugin-Schnittstelle aufrufen
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
@@ -43,7 +132,42 @@ POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL TransferPointer(
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL CallPlugin(const char* source_plugin_name, const char* source_interface_name, int param_index, void* param_value);
-
+    
+/**
+ * @brief 重新加载传递规则 / Reload transfer rules / Übertragungsregeln neu laden
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL ReloadRules(void);
+    
+/**
+ * @brief 热替换目标插件库 / Hot-swap target plugin library / Ziel-Plugin-Bibliothek per Hot-Swap austauschen
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 成功返回0，失败返回-1（保留当前版本） / Returns 0 on success, -1 on failure (current version kept) / Gibt 0 bei Erfolg zurück, -1 bei Fehler (aktuelle Version bleibt)
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL ReloadPlugin(const char* plugin_name);
+    
+/**
+ * @brief 运行时添加传递规则 / Add transfer rule at runtime / Übertragungsregel zur Laufzeit hinzufügen
+ * @param rule_spec 以换行分隔的Key=Value规则描述 / Newline-separated Key=Value rule specification / Durch Zeilenumbrüche getrennte Key=Value-Regelbeschreibung
+ * @return 成功返回新规则索引，失败返回-1 / Returns new rule index on success, -1 on failure / Gibt neuen Regelindex bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL AddTransferRule(const char* rule_spec);
+    
+/**
+ * @brief 运行时移除传递规则 / Remove transfer rule at runtime / Übertragungsregel zur Laufzeit entfernen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL RemoveTransferRule(int rule_index);
+    
+/**
+ * @brief 设置规则启用状态 / Set rule enabled state / Aktivierungsstatus der Regel setzen
+ * @param rule_index 规则索引 / Rule index / Regelindex
+ * @param enabled 非0启用，0禁用 / Non-zero enables, 0 disables / Ungleich 0 aktiviert, 0 deaktiviert
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+POINTER_TRANSFER_PLUGIN_EXPORT int POINTER_TRANSFER_PLUGIN_CALL SetRuleEnabled(int rule_index, int enabled);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -12,7 +12,7 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
  * @brief 加载目标插件 / Load target plugin / Ziel-Plugin laden
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -20,7 +20,7 @@ extern "C" {
  * @return 成功返回插件句柄，失败返回NULL / Returns plugin handle on success, NULL on failure / Gibt Plugin-Handle bei Erfolg zurück, NULL bei Fehler
  */
 void* load_target_plugin(const char* plugin_name, const char* plugin_path);
-
+    
 /**
  * @brief 链式加载插件的.nxpt文件 / Chain load plugin .nxpt file / Plugin-.nxpt-Datei kettenweise laden
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -28,7 +28,7 @@ void* load_target_plugin(const char* plugin_name, const char* plugin_path);
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int chain_load_plugin_nxpt(const char* plugin_name, const char* plugin_path);
-
+    
 /**
  * @brief 获取插件路径（缓存） / Get plugin path (cached) / Plugin-Pfad abrufen (gecacht)
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
@@ -37,7 +37,36 @@ int chain_load_plugin_nxpt(const char* plugin_name, const char* plugin_path);
  * @return 成功返回0，失败返回非0 / Returns 0 on success, non-zero on failure / Gibt 0 bei Erfolg zurück, ungleich 0 bei Fehler
  */
 int get_plugin_path_cached(const char* plugin_name, char* plugin_path, size_t path_size);
-
+    
+/**
+ * @brief 查找已加载的插件 / Find loaded plugin / Geladenes Plugin suchen
+ * @param ctx 上下文 / Context / Kontext
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @return 找到返回插件句柄，否则返回NULL / Returns plugin handle if found, NULL otherwise / Gibt Plugin-Handle zurück, wenn gefunden, sonst NULL
+ */
+void* find_loaded_plugin(pointer_transfer_context_t* ctx, const char* plugin_name);
+    
+/**
+ * @brief 注册已加载的插件 / Register loaded plugin / Geladenes Plugin registrieren
+ * @param ctx 上下文 / Context / Kontext
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param plugin_path 插件路径 / Plugin path / Plugin-Pfad
+ * @param handle 插件句柄 / Plugin handle / Plugin-Handle
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int register_loaded_plugin(pointer_transfer_context_t* ctx, const char* plugin_name, const char* plugin_path, void* handle);
+    
+/**
+ * @brief 启动后台插件预加载（Preload=1时） / Start background plugin preloading (when Preload=1) / Hintergrund-Plugin-Vorladen starten (bei Preload=1)
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+int start_plugin_preload(void);
+    
+/**
+ * @brief 等待预加载完成（就绪屏障） / Wait for preloading to finish (readiness barrier) / Auf Abschluss des Vorladens warten (Bereitschaftsbarriere)
+ */
+void wait_for_plugin_preload(void);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -13,7 +13,7 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-
+    
 /**
  * @brief 返回值类型枚举 / Return value type enumeration / Rückgabewerttyp-Aufzählung
  */
@@ -24,7 +24,25 @@ typedef enum {
     PT_RETURN_TYPE_STRUCT_PTR,     /**< 小结构体返回值（通过指针，RAX包含指针，Windows: <=8字节，Linux: <=16字节） / Small struct return value (via pointer, RAX contains pointer, Windows: <=8 bytes, Linux: <=16 bytes) / Kleine Struktur-Rückgabewert (über Zeiger, RAX enthält Zeiger, Windows: <=8 Bytes, Linux: <=16 Bytes) */
     PT_RETURN_TYPE_STRUCT_VAL      /**< 大结构体返回值（值返回，通过隐藏指针参数，Windows: >8字节，Linux: >16字节） / Large struct return value (value return via hidden pointer parameter, Windows: >8 bytes, Linux: >16 bytes) / Große Struktur-Rückgabewert (Wertrückgabe über versteckten Zeigerparameter, Windows: >8 Bytes, Linux: >16 Bytes) */
 } pt_return_type_t;
-
+    
+/* 值按引用携带：as.ptr指向type类型的数据 / Value carried by reference: as.ptr points to data of the given type / Wert per Referenz getragen: as.ptr zeigt auf Daten des angegebenen Typs */
+#define PT_VALUE_FLAG_BY_REF 0x1
+    
+/**
+ * @brief 带类型的传递值（16字节，按值传递） / Typed transfer value (16 bytes, passed by value) / Typisierter Übertragungswert (16 Bytes, als Wert übergeben)
+ * @details 标量类型直接保存在负载中；指针、字符串等类型及PT_VALUE_FLAG_BY_REF时保存指针 / Scalar types are held in the payload; pointer, string and similar types, and PT_VALUE_FLAG_BY_REF, hold a pointer / Skalare Typen liegen in der Nutzlast; Zeiger-, Zeichenfolgen- und ähnliche Typen sowie PT_VALUE_FLAG_BY_REF halten einen Zeiger
+ */
+typedef struct {
+    uint16_t type;                 /**< nxld_param_type_t值类型 / nxld_param_type_t value type / nxld_param_type_t-Werttyp */
+    uint16_t flags;                /**< PT_VALUE_FLAG_*标志 / PT_VALUE_FLAG_* flags / PT_VALUE_FLAG_*-Flags */
+    uint32_t size;                 /**< 数据大小（字节） / Data size in bytes / Datengröße in Bytes */
+    union {
+        int64_t i64;               /**< 整数负载 / Integer payload / Ganzzahl-Nutzlast */
+        double f64;                /**< 浮点负载 / Floating-point payload / Gleitkomma-Nutzlast */
+        void* ptr;                 /**< 指针负载 / Pointer payload / Zeiger-Nutzlast */
+    } as;
+} pt_typed_value_t;
+    
 /**
  * @brief 传递模式枚举 / Transfer mode enumeration / Übertragungsmodus-Aufzählung
  */
@@ -33,7 +51,24 @@ typedef enum {
     TRANSFER_MODE_BROADCAST,       /**< 广播模式 / Broadcast mode / Broadcast-Modus */
     TRANSFER_MODE_MULTICAST        /**< 组播模式 / Multicast mode / Multicast-Modus */
 } transfer_mode_t;
-
+    
+/**
+ * @brief 后台验证未完成时的调用策略 / Call policy while background validation is pending / Aufrufstrategie bei ausstehender Hintergrundvalidierung
+ */
+typedef enum {
+    VALIDATION_PENDING_WAIT = 0,   /**< 等待验证完成 / Wait for validation to finish / Auf Abschluss der Validierung warten */
+    VALIDATION_PENDING_SKIP,       /**< 跳过本次调用 / Skip this call / Diesen Aufruf überspringen */
+    VALIDATION_PENDING_CALL        /**< 未验证直接调用 / Call without validation / Ohne Validierung aufrufen */
+} validation_pending_policy_t;
+    
+/**
+ * @brief 参数所有权枚举 / Parameter ownership enumeration / Parameterbesitz-Aufzählung
+ */
+typedef enum {
+    PARAM_OWNERSHIP_COPY = 0,      /**< 插件收到参数包中的结构体副本 / The plugin receives a copy of the struct in the parameter pack / Das Plugin erhält eine Kopie der Struktur im Parameterpaket */
+    PARAM_OWNERSHIP_BORROW         /**< 插件收到原始指针，仅在调用期间有效 / The plugin receives the original pointer, valid only for the duration of the call / Das Plugin erhält den Originalzeiger, nur während des Aufrufs gültig */
+} param_ownership_t;
+    
 /**
  * @brief 指针传递规则结构体 / Pointer transfer rule structure / Zeigerübertragungsregel-Struktur
  */
@@ -53,17 +88,102 @@ typedef struct {
     char* condition;              /**< 传递条件 / Transfer condition / Übertragungsbedingung */
     int cache_self;               /**< 缓存自身规则标志 / Cache self rule flag / Selbst-Regel-Cache-Flag */
     char* set_group;              /**< 设置组名称 / Set group name / Set-Gruppenname */
+    param_ownership_t ownership;  /**< 目标参数所有权 / Target parameter ownership / Besitz des Zielparameters */
+    int strings_shared;           /**< 字符串指向.nxptc映射或字符串内存区（不单独释放） / Strings point into a .nxptc mapping or a string arena (not freed individually) / Zeichenfolgen zeigen in eine .nxptc-Zuordnung oder eine Zeichenfolgen-Arena (nicht einzeln freigegeben) */
 } pointer_transfer_rule_t;
-
+    
 /**
- * @brief 已加载的插件信息结构体 / Loaded plugin information structure / Geladenes Plugin-Informationsstruktur
+ * @brief 已解析的插件符号 / Resolved plugin symbol / Aufgelöstes Plugin-Symbol
  */
 typedef struct {
-    void* handle;                 /**< 动态库句柄 / Dynamic library handle / Dynamisches Bibliothekshandle */
-    char* plugin_name;            /**< 插件名称 / Plugin name / Plugin-Name */
-    char* plugin_path;            /**< 插件路径 / Plugin path / Plugin-Pfad */
-} loaded_plugin_info_t;
-
+    const char* symbol_name;      /**< 符号名称（注册表驻留） / Symbol name (interned by the registry) / Symbolname (von der Registry interniert) */
+    uint64_t name_hash;           /**< 符号名称哈希 / Symbol name hash / Hash des Symbolnamens */
+    void* func_ptr;               /**< 函数指针 / Function pointer / Funktionszeiger */
+} plugin_symbol_entry_t;
+    
+/**
+ * @brief 插件注册表条目（地址在注册表生命周期内稳定） / Plugin registry entry (address stable for the registry lifetime) / Plugin-Registry-Eintrag (Adresse während der Registry-Lebensdauer stabil)
+ */
+typedef struct {
+    const char* plugin_name;      /**< 插件名称（注册表驻留） / Plugin name (interned by the registry) / Plugin-Name (von der Registry interniert) */
+    uint64_t name_hash;           /**< 插件名称哈希 / Plugin name hash / Hash des Plugin-Namens */
+    void* handle;                 /**< 动态库句柄（未加载为NULL） / Dynamic library handle (NULL if not loaded) / Dynamisches Bibliothekshandle (NULL wenn nicht geladen) */
+    const char* plugin_path;      /**< 插件路径（未知为NULL） / Plugin path (NULL if unknown) / Plugin-Pfad (NULL wenn unbekannt) */
+    const char* nxpt_path;        /**< 已加载的.nxpt文件路径 / Loaded .nxpt file path / Pfad der geladenen .nxpt-Datei */
+    int nxpt_loaded;              /**< .nxpt已加载标志 / .nxpt loaded flag / .nxpt-geladen-Flag */
+    int64_t load_us;              /**< 库加载耗时（微秒） / Library load time (microseconds) / Ladezeit der Bibliothek (Mikrosekunden) */
+    int64_t last_used_us;         /**< 上次使用时间（单调微秒） / Last use time (monotonic microseconds) / Letzte Verwendung (monotone Mikrosekunden) */
+    volatile int in_flight;       /**< 进行中的调用数（非零时不卸载） / Calls in flight (never unloaded while non-zero) / Laufende Aufrufe (bei ungleich null nie entladen) */
+    size_t rule_refs;             /**< 以该插件为目标的启用规则数（上次清扫时统计） / Enabled rules targeting this plugin (counted at last sweep) / Aktivierte Regeln mit diesem Ziel-Plugin (bei letzter Bereinigung gezählt) */
+    size_t state_refs;            /**< 该插件的接口状态数（上次清扫时统计） / Interface states of this plugin (counted at last sweep) / Schnittstellenstatus dieses Plugins (bei letzter Bereinigung gezählt) */
+    uint64_t load_count;          /**< 加载次数 / Load count / Ladeanzahl */
+    uint64_t unload_count;        /**< 卸载次数 / Unload count / Entladeanzahl */
+    int64_t file_timestamp;       /**< 加载时的库文件修改时间 / Library file modification time at load / Änderungszeit der Bibliotheksdatei beim Laden */
+    char* shadow_path;            /**< 热替换时加载的库副本路径（无则为NULL） / Library copy path loaded by hot swap (NULL if none) / Pfad der beim Hot-Swap geladenen Bibliothekskopie (NULL wenn keine) */
+    uint64_t swap_count;          /**< 热替换次数 / Hot swap count / Anzahl der Hot-Swaps */
+    volatile int swap_pending;    /**< 等待在调用边界热替换 / Hot swap waiting for the call boundary / Hot-Swap wartet auf die Aufrufgrenze */
+    plugin_symbol_entry_t* symbols; /**< 已解析的符号 / Resolved symbols / Aufgelöste Symbole */
+    size_t symbol_count;          /**< 符号数量 / Symbol count / Symbolanzahl */
+    size_t symbol_capacity;       /**< 符号数组容量 / Symbol array capacity / Kapazität des Symbol-Arrays */
+} plugin_registry_entry_t;
+    
+/**
+ * @brief 热替换后等待退役的旧库 / Old library waiting for retirement after a hot swap / Alte Bibliothek, die nach einem Hot-Swap auf Stilllegung wartet
+ */
+typedef struct {
+    plugin_registry_entry_t* entry; /**< 所属条目 / Owning entry / Zugehöriger Eintrag */
+    void* handle;                 /**< 旧库句柄 / Old library handle / Handle der alten Bibliothek */
+    char* shadow_path;            /**< 旧库副本路径（无则为NULL） / Old library copy path (NULL if none) / Pfad der alten Bibliothekskopie (NULL wenn keine) */
+    uint64_t epoch;               /**< 退役时的替换纪元 / Swap epoch at retirement / Austausch-Epoche bei Stilllegung */
+} plugin_retired_handle_t;
+    
+/**
+ * @brief 插件注册表（按驻留的插件名称索引） / Plugin registry (keyed by interned plugin name) / Plugin-Registry (nach interniertem Plugin-Namen indiziert)
+ */
+typedef struct {
+    plugin_registry_entry_t** entries; /**< 条目指针数组（按注册顺序） / Entry pointer array (in registration order) / Eintragszeiger-Array (in Registrierungsreihenfolge) */
+    size_t count;                 /**< 条目数量 / Entry count / Eintragsanzahl */
+    size_t capacity;              /**< 条目数组容量 / Entry array capacity / Kapazität des Eintrags-Arrays */
+    size_t* slots;                /**< 开放寻址槽位（索引+1，0为空） / Open addressing slots (index+1, 0 is empty) / Slots mit offener Adressierung (Index+1, 0 ist leer) */
+    size_t slot_count;            /**< 槽位数量（2的幂） / Slot count (power of two) / Slot-Anzahl (Zweierpotenz) */
+    void* strings;                /**< 名称和路径的字符串内存区 / String arena for names and paths / Zeichenfolgen-Arena für Namen und Pfade */
+    size_t resident_count;        /**< 已加载的库数量 / Loaded library count / Anzahl geladener Bibliotheken */
+    uint64_t total_loads;         /**< 累计加载次数 / Total loads / Gesamtanzahl der Ladevorgänge */
+    uint64_t total_unloads;       /**< 累计卸载次数 / Total unloads / Gesamtanzahl der Entladevorgänge */
+    int64_t last_sweep_us;        /**< 上次空闲清扫时间 / Last idle sweep time / Zeitpunkt der letzten Leerlaufbereinigung */
+    uint64_t swap_epoch;          /**< 热替换纪元（每次发布加1） / Hot swap epoch (incremented on each publish) / Hot-Swap-Epoche (bei jeder Veröffentlichung erhöht) */
+    volatile int swaps_pending;   /**< 等待在调用边界执行的热替换数 / Hot swaps waiting for the call boundary / Auf die Aufrufgrenze wartende Hot-Swaps */
+    plugin_retired_handle_t* retired; /**< 等待进行中调用结束的旧库 / Old libraries waiting for in-flight calls to drain / Alte Bibliotheken, die auf das Ende laufender Aufrufe warten */
+    size_t retired_count;         /**< 待退役旧库数量 / Retired library count / Anzahl stillzulegender Bibliotheken */
+    size_t retired_capacity;      /**< 待退役数组容量 / Retired array capacity / Kapazität des Stilllegungs-Arrays */
+} plugin_registry_t;
+    
+/* 原生调用支持的最大参数数量（6个整数寄存器+8个SSE寄存器+8个栈槽） / Maximum parameter count of native calls (6 integer registers + 8 SSE registers + 8 stack slots) / Maximale Parameteranzahl nativer Aufrufe (6 Ganzzahlregister + 8 SSE-Register + 8 Stack-Slots) */
+#define PT_NATIVE_CALL_MAX_PARAMS 22
+    
+/* 签名所需栈槽超过原生调用可传递数量时的返回码 / Return code when a signature needs more stack slots than native calls pass / Rückgabecode, wenn eine Signatur mehr Stack-Slots braucht als native Aufrufe übergeben */
+#define PT_NATIVE_CALL_STACK_OVERFLOW (-2)
+    
+/**
+ * @brief 原生调用参数位置 / Native call argument location / Argumentposition eines nativen Aufrufs
+ */
+typedef enum {
+    PT_NATIVE_ARG_INT = 0,         /**< 整数寄存器 / Integer register / Ganzzahlregister */
+    PT_NATIVE_ARG_SSE,             /**< SSE寄存器 / SSE register / SSE-Register */
+    PT_NATIVE_ARG_STACK            /**< 栈槽 / Stack slot / Stack-Slot */
+} pt_native_arg_class_t;
+    
+/**
+ * @brief 原生调用计划（创建接口状态时按签名计算一次） / Native call plan (computed once from the signature when the interface state is created) / Plan für native Aufrufe (einmal beim Erstellen des Schnittstellenstatus aus der Signatur berechnet)
+ */
+typedef struct {
+    int valid;                     /**< 签名可原生调用 / Signature can be called natively / Signatur kann nativ aufgerufen werden */
+    int param_count;               /**< 参数数量 / Parameter count / Parameteranzahl */
+    nxld_return_type_t return_type; /**< 声明的返回值类型 / Declared return type / Deklarierter Rückgabetyp */
+    uint8_t arg_class[PT_NATIVE_CALL_MAX_PARAMS]; /**< 每个参数的位置（pt_native_arg_class_t） / Location of each parameter (pt_native_arg_class_t) / Position jedes Parameters (pt_native_arg_class_t) */
+    uint8_t arg_slot[PT_NATIVE_CALL_MAX_PARAMS];  /**< 寄存器或栈槽序号 / Register or stack slot number / Register- oder Stack-Slot-Nummer */
+} pt_native_call_plan_t;
+    
 /**
  * @brief 目标接口参数状态结构体 / Target interface parameter state structure / Ziel-Schnittstellenparameter-Statusstruktur
  */
@@ -79,15 +199,20 @@ typedef struct {
     size_t* param_sizes;          /**< 参数大小数组 / Parameter sizes array / Parametergrößen-Array */
     int64_t* param_int_values;    /**< 参数INT32/INT64常量值数组 / Parameter INT32/INT64 constant values array / Parameter INT32/INT64-Konstantenwerte-Array */
     double* param_float_values;    /**< 参数FLOAT/DOUBLE常量值数组 / Parameter FLOAT/DOUBLE constant values array / Parameter FLOAT/DOUBLE-Konstantenwerte-Array */
+    int* param_borrowed;           /**< 参数借用标志数组（Ownership=borrow，不复制结构体数据） / Parameter borrow flags array (Ownership=borrow, struct data is not copied) / Parameter-Ausleih-Flag-Array (Ownership=borrow, Strukturdaten werden nicht kopiert) */
     int is_variadic;               /**< 可变参数接口标志 / Variadic interface flag / Variabler Parameter-Interface-Flag */
     int min_param_count;           /**< 最小参数数量（用于可变参数接口） / Minimum parameter count (for variadic interfaces) / Mindestparameteranzahl (für variabler Parameter-Interfaces) */
     int actual_param_count;        /**< 实际参数数量 / Actual parameter count / Tatsächliche Parameteranzahl */
     pt_return_type_t return_type;  /**< 返回值类型 / Return value type / Rückgabewerttyp */
     size_t return_size;            /**< 返回值大小 / Return value size / Rückgabewertgröße */
+    int return_is_string;          /**< 接口声明返回字符串（NXLD_RETURN_TYPE_STRING） / Interface declares a string return (NXLD_RETURN_TYPE_STRING) / Schnittstelle deklariert eine Zeichenfolgenrückgabe (NXLD_RETURN_TYPE_STRING) */
+    nxld_call_convention_t call_convention; /**< 调用约定 / Calling convention / Aufrufkonvention */
+    uint32_t pack_version;         /**< 插件接受的参数包版本（仅PACK约定） / Parameter pack version accepted by the plugin (PACK convention only) / Vom Plugin akzeptierte Parameterpaket-Version (nur PACK-Konvention) */
+    pt_native_call_plan_t native_plan; /**< 原生调用计划（仅NATIVE约定） / Native call plan (NATIVE convention only) / Plan für native Aufrufe (nur NATIVE-Konvention) */
     int in_use;                   /**< 使用中标志 / In use flag / In-Verwendung-Flag */
     int validation_done;          /**< 验证完成标志 / Validation done flag / Validierungs-Flag */
 } target_interface_state_t;
-
+    
 /**
  * @brief 哈希表桶节点结构体 / Hash table bucket node structure / Hash-Tabelle-Bucket-Knoten-Struktur
  */
@@ -96,7 +221,7 @@ typedef struct rule_hash_node_s {
     size_t rule_index;            /**< 规则索引 / Rule index / Regelindex */
     struct rule_hash_node_s* next; /**< 下一个节点（链式冲突解决） / Next node (chaining collision resolution) / Nächster Knoten (Verkettungskollisionsauflösung) */
 } rule_hash_node_t;
-
+    
 /**
  * @brief 规则哈希表结构体 / Rule hash table structure / Regel-Hash-Tabelle-Struktur
  */
@@ -105,42 +230,99 @@ typedef struct {
     size_t bucket_count;          /**< 桶数量 / Bucket count / Bucket-Anzahl */
     size_t entry_count;           /**< 条目数量 / Entry count / Eintragsanzahl */
 } rule_hash_table_t;
-
+    
 /**
- * @brief 插件路径缓存项结构体 / Plugin path cache entry structure / Plugin-Pfad-Cache-Eintrag-Struktur
+ * @brief 规则图节点结构体（驻留的"插件.接口"标识） / Rule graph node structure (interned "plugin.interface" identifier) / Regelgraph-Knotenstruktur (internierter "Plugin.Schnittstelle"-Bezeichner)
  */
 typedef struct {
     char* plugin_name;            /**< 插件名称 / Plugin name / Plugin-Name */
-    char* plugin_path;            /**< 插件路径 / Plugin path / Plugin-Pfad */
-} plugin_path_cache_entry_t;
-
+    char* interface_name;         /**< 接口名称 / Interface name / Schnittstellenname */
+    uint64_t hash_key;            /**< 哈希键 / Hash key / Hash-Schlüssel */
+    size_t edge_start;            /**< 出边起始位置 / Outgoing edge start offset / Startoffset ausgehender Kanten */
+    size_t edge_count;            /**< 出边数量 / Outgoing edge count / Anzahl ausgehender Kanten */
+    size_t scc_id;                /**< 强连通分量编号（等于分量的拓扑序号） / Strongly connected component ID (equals the component's topological rank) / ID der starken Zusammenhangskomponente (gleich dem topologischen Rang der Komponente) */
+    size_t topo_rank;             /**< 拓扑序号（缩点DAG，增量更新后可不连续） / Topological rank (condensation DAG, may have gaps after incremental updates) / Topologischer Rang (Kondensations-DAG, nach inkrementellen Aktualisierungen ggf. lückenhaft) */
+    int cyclic;                   /**< 位于环中标志 / Part of a cycle flag / Teil-eines-Zyklus-Flag */
+    int memoizable;               /**< 声明为纯接口的CacheSelf规则数（非0时结果可记忆化） / Number of CacheSelf rules declaring the interface pure (result may be memoized when non-zero) / Anzahl der CacheSelf-Regeln, die die Schnittstelle als rein deklarieren (Ergebnis darf memoisiert werden, wenn ungleich 0) */
+} rule_graph_node_t;
+    
 /**
- * @brief 已加载的.nxpt文件信息结构体 / Loaded .nxpt file information structure / Geladene .nxpt-Datei-Informationsstruktur
+ * @brief 规则图结构体 / Rule graph structure / Regelgraph-Struktur
  */
 typedef struct {
-    char* plugin_name;            /**< 插件名称 / Plugin name / Plugin-Name */
-    char* nxpt_path;              /**< .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad */
-    int loaded;                   /**< 已加载标志 / Loaded flag / Geladenes Flag */
-} loaded_nxpt_info_t;
-
+    rule_graph_node_t* nodes;     /**< 节点数组（下标即接口ID） / Node array (index is interface ID) / Knoten-Array (Index ist Schnittstellen-ID) */
+    size_t node_count;            /**< 节点数量 / Node count / Knotenanzahl */
+    size_t node_capacity;         /**< 节点数组容量 / Node array capacity / Knoten-Array-Kapazität */
+    size_t* node_buckets;         /**< 开放寻址桶（存储ID+1，0为空） / Open addressing buckets (stores ID+1, 0 is empty) / Offene Adressierungs-Buckets (speichert ID+1, 0 ist leer) */
+    size_t bucket_count;          /**< 桶数量（2的幂） / Bucket count (power of two) / Bucket-Anzahl (Zweierpotenz) */
+    size_t* edges;                /**< 邻接表（CSR格式，增量添加的边表移到末尾） / Adjacency list (CSR format, edge lists grown incrementally move to the end) / Adjazenzliste (CSR-Format, inkrementell wachsende Kantenlisten wandern ans Ende) */
+    size_t edge_count;            /**< 边数量 / Edge count / Kantenanzahl */
+    size_t edge_slot_count;       /**< 已使用的边槽位（含移动后留下的空洞） / Used edge slots (including holes left by moved lists) / Belegte Kanten-Slots (einschließlich Lücken verschobener Listen) */
+    size_t edge_capacity;         /**< 边数组容量 / Edge array capacity / Kanten-Array-Kapazität */
+    size_t* rule_source_nodes;    /**< 每条规则的源节点ID / Source node ID per rule / Quellknoten-ID pro Regel */
+    size_t* rule_target_nodes;    /**< 每条规则的目标节点ID / Target node ID per rule / Zielknoten-ID pro Regel */
+    size_t rule_node_count;       /**< 规则节点映射数量 / Rule node mapping count / Anzahl der Regel-Knoten-Zuordnungen */
+    size_t scc_count;             /**< 强连通分量数量 / Strongly connected component count / Anzahl starker Zusammenhangskomponenten */
+    size_t rank_limit;            /**< 下一个可用拓扑序号 / Next free topological rank / Nächster freier topologischer Rang */
+    size_t cyclic_node_count;     /**< 环中节点数量 / Cyclic node count / Anzahl zyklischer Knoten */
+} rule_graph_t;
+    
 /**
- * @brief 已加载.nxpt文件哈希表节点结构体 / Loaded .nxpt file hash table node structure / Geladene .nxpt-Datei-Hash-Tabelle-Knoten-Struktur
+ * @brief 记忆化缓存条目结构体 / Memoization cache entry structure / Memoisierungs-Cache-Eintragsstruktur
  */
-typedef struct nxpt_hash_node_s {
-    uint64_t hash_key;            /**< 哈希键（插件名称的哈希值） / Hash key (hash value of plugin name) / Hash-Schlüssel (Hash-Wert des Plugin-Namens) */
-    size_t array_index;           /**< 数组索引 / Array index / Array-Index */
-    struct nxpt_hash_node_s* next; /**< 下一个节点（链式冲突解决） / Next node (chaining collision resolution) / Nächster Knoten (Verkettungskollisionsauflösung) */
-} nxpt_hash_node_t;
-
+typedef struct {
+    uint64_t hash_key;            /**< 参数包哈希 / Parameter pack hash / Parameterpaket-Hash */
+    size_t node_id;               /**< 目标接口的规则图节点ID / Rule graph node ID of target interface / Regelgraph-Knoten-ID der Zielschnittstelle */
+    unsigned char* key_data;      /**< 序列化的完整键（用于校验哈希冲突） / Serialized full key (verifies hash collisions) / Serialisierter vollständiger Schlüssel (prüft Hash-Kollisionen) */
+    size_t key_size;              /**< 键大小 / Key size / Schlüsselgröße */
+    pt_return_type_t return_type; /**< 返回值类型 / Return type / Rückgabetyp */
+    int64_t result_int;           /**< 整数结果 / Integer result / Ganzzahlergebnis */
+    double result_float;          /**< 浮点数结果 / Float result / Gleitkommaergebnis */
+    unsigned char* value_data;    /**< 结构体或字符串结果副本 / Copy of struct or string result / Kopie des Struktur- oder Zeichenfolgenergebnisses */
+    size_t value_size;            /**< 结果副本大小 / Result copy size / Größe der Ergebniskopie */
+    int64_t expire_ms;            /**< 过期时间（单调毫秒，0=不过期） / Expiry time (monotonic ms, 0=never) / Ablaufzeit (monotone ms, 0=nie) */
+    int referenced;               /**< CLOCK引用位 / CLOCK reference bit / CLOCK-Referenzbit */
+    int occupied;                 /**< 占用标志 / Occupied flag / Belegt-Flag */
+    size_t next;                  /**< 桶链中下一条目（索引+1，0为结尾） / Next entry in bucket chain (index+1, 0 is end) / Nächster Eintrag in Bucket-Kette (Index+1, 0 ist Ende) */
+} memo_cache_entry_t;
+    
 /**
- * @brief 已加载.nxpt文件哈希表结构体 / Loaded .nxpt file hash table structure / Geladene .nxpt-Datei-Hash-Tabelle-Struktur
+ * @brief 记忆化缓存分片结构体 / Memoization cache shard structure / Memoisierungs-Cache-Shard-Struktur
  */
 typedef struct {
-    nxpt_hash_node_t** buckets;   /**< 桶数组 / Bucket array / Bucket-Array */
-    size_t bucket_count;           /**< 桶数量 / Bucket count / Bucket-Anzahl */
-    size_t entry_count;            /**< 条目数量 / Entry count / Eintragsanzahl */
-} nxpt_hash_table_t;
-
+    memo_cache_entry_t* entries;  /**< 条目数组（固定容量） / Entry array (fixed capacity) / Eintrags-Array (feste Kapazität) */
+    size_t capacity;              /**< 条目容量 / Entry capacity / Eintragskapazität */
+    size_t used;                  /**< 已使用过的槽位数量 / Number of slots ever used / Anzahl jemals verwendeter Slots */
+    size_t count;                 /**< 有效条目数量 / Live entry count / Anzahl gültiger Einträge */
+    size_t* buckets;              /**< 桶链头（索引+1，0为空） / Bucket chain heads (index+1, 0 is empty) / Bucket-Kettenköpfe (Index+1, 0 ist leer) */
+    size_t bucket_count;          /**< 桶数量（2的幂） / Bucket count (power of two) / Bucket-Anzahl (Zweierpotenz) */
+    size_t clock_hand;            /**< CLOCK淘汰指针 / CLOCK eviction hand / CLOCK-Verdrängungszeiger */
+    void* lock;                   /**< 分片互斥锁 / Shard mutex / Shard-Mutex */
+    uint64_t hits;                /**< 命中次数 / Hit count / Trefferanzahl */
+    uint64_t misses;              /**< 未命中次数 / Miss count / Fehltrefferanzahl */
+    uint64_t evictions;           /**< 淘汰次数 / Eviction count / Verdrängungsanzahl */
+    uint64_t expirations;         /**< 过期次数 / Expiration count / Ablaufanzahl */
+} memo_cache_shard_t;
+    
+/**
+ * @brief 记忆化缓存结构体 / Memoization cache structure / Memoisierungs-Cache-Struktur
+ */
+typedef struct {
+    memo_cache_shard_t* shards;   /**< 分片数组 / Shard array / Shard-Array */
+    size_t shard_count;           /**< 分片数量（2的幂） / Shard count (power of two) / Shard-Anzahl (Zweierpotenz) */
+    size_t max_entries;           /**< 最大条目数（0=使用默认值） / Maximum entries (0=use default) / Maximale Einträge (0=Standardwert verwenden) */
+    int disabled;                 /**< 禁用标志（MemoCacheSize=0） / Disabled flag (MemoCacheSize=0) / Deaktiviert-Flag (MemoCacheSize=0) */
+    int64_t ttl_ms;               /**< 条目存活时间（毫秒，0=不过期） / Entry time-to-live (ms, 0=never expires) / Eintragslebensdauer (ms, 0=läuft nie ab) */
+} memo_cache_t;
+    
+/**
+ * @brief 规则源文件信息结构体 / Rule source file information structure / Regelquelldatei-Informationsstruktur
+ */
+typedef struct {
+    char* path;                    /**< .nxpt文件路径 / .nxpt file path / .nxpt-Dateipfad */
+    int64_t timestamp;             /**< 上次加载时的修改时间戳 / Modification timestamp at last load / Änderungszeitstempel beim letzten Laden */
+} rule_source_t;
+    
 /**
  * @brief 指针传递上下文结构体 / Pointer transfer context structure / Zeigerübertragungskontext-Struktur
  */
@@ -156,20 +338,11 @@ typedef struct {
     size_t* cached_rule_indices;  /**< 缓存的规则索引数组 / Cached rule indices array / Gecachte Regelindex-Array */
     size_t cached_rule_count;     /**< 缓存的规则数量 / Cached rule count / Anzahl gecachter Regeln */
     size_t cached_rule_capacity; /**< 缓存的规则容量 / Cached rule capacity / Kapazität gecachter Regeln */
-    loaded_plugin_info_t* loaded_plugins; /**< 已加载的插件数组 / Loaded plugins array / Geladenes Plugin-Array */
-    size_t loaded_plugin_count;   /**< 已加载插件数量 / Loaded plugin count / Anzahl geladener Plugins */
-    size_t loaded_plugin_capacity; /**< 已加载插件数组容量 / Loaded plugin array capacity / Geladenes Plugin-Array-Kapazität */
-    plugin_path_cache_entry_t* path_cache; /**< 插件路径缓存 / Plugin path cache / Plugin-Pfad-Cache */
-    size_t path_cache_count;      /**< 路径缓存数量 / Path cache count / Pfad-Cache-Anzahl */
-    size_t path_cache_capacity;   /**< 路径缓存容量 / Path cache capacity / Pfad-Cache-Kapazität */
+    plugin_registry_t plugin_registry; /**< 插件注册表（句柄、路径、.nxpt状态和符号） / Plugin registry (handles, paths, .nxpt state and symbols) / Plugin-Registry (Handles, Pfade, .nxpt-Status und Symbole) */
     char* plugin_dll_path;       /**< 当前插件DLL路径 / Current plugin DLL path / Aktueller Plugin-DLL-Pfad */
     target_interface_state_t* interface_states; /**< 目标接口状态数组 / Target interface states array / Ziel-Schnittstellen-Status-Array */
     size_t interface_state_count; /**< 接口状态数量 / Interface state count / Schnittstellen-Statusanzahl */
     size_t interface_state_capacity; /**< 接口状态数组容量 / Interface state array capacity / Schnittstellen-Status-Array-Kapazität */
-    loaded_nxpt_info_t* loaded_nxpt_files; /**< 已加载的.nxpt文件数组 / Loaded .nxpt files array / Geladene .nxpt-Dateien-Array */
-    size_t loaded_nxpt_count;     /**< 已加载.nxpt文件数量 / Loaded .nxpt files count / Anzahl geladener .nxpt-Dateien */
-    size_t loaded_nxpt_capacity;  /**< 已加载.nxpt文件数组容量 / Loaded .nxpt files array capacity / Geladene .nxpt-Dateien-Array-Kapazität */
-    nxpt_hash_table_t nxpt_hash_table; /**< 已加载.nxpt文件哈希表（用于高效查找） / Loaded .nxpt files hash table (for efficient lookup) / Geladene .nxpt-Dateien-Hash-Tabelle (für effiziente Suche) */
     char* entry_plugin_name;      /**< 入口插件名称 / Entry plugin name / Einstiegs-Plugin-Name */
     char* entry_plugin_path;      /**< 入口插件路径 / Entry plugin path / Einstiegs-Plugin-Pfad */
     char* entry_nxpt_path;        /**< 入口插件.nxpt路径 / Entry plugin .nxpt path / Einstiegs-Plugin-.nxpt-Pfad */
@@ -179,8 +352,34 @@ typedef struct {
     char** ignore_plugins;         /**< 忽略的插件路径列表（相对路径） / Ignored plugin paths list (relative paths) / Liste der ignorierten Plugin-Pfade (relative Pfade) */
     size_t ignore_plugin_count;    /**< 忽略插件数量 / Ignored plugin count / Anzahl ignorierter Plugins */
     size_t ignore_plugin_capacity; /**< 忽略插件数组容量 / Ignored plugin array capacity / Kapazität des Arrays ignorierter Plugins */
+    rule_graph_t rule_graph;       /**< 静态规则图（接口ID、强连通分量和拓扑序） / Static rule graph (interface IDs, SCCs and topological order) / Statischer Regelgraph (Schnittstellen-IDs, SCCs und topologische Ordnung) */
+    int max_call_depth;            /**< 最大调用深度（0=使用默认值） / Maximum call depth (0=use default) / Maximale Aufruftiefe (0=Standardwert verwenden) */
+    memo_cache_t memo_cache;       /**< 纯接口结果记忆化缓存 / Pure interface result memoization cache / Memoisierungs-Cache für Ergebnisse reiner Schnittstellen */
+    rule_source_t* rule_sources;   /**< 已加载规则的.nxpt源文件（按加载顺序） / .nxpt source files of loaded rules (in load order) / .nxpt-Quelldateien geladener Regeln (in Ladereihenfolge) */
+    size_t rule_source_count;      /**< 规则源文件数量 / Rule source file count / Anzahl der Regelquelldateien */
+    size_t rule_source_capacity;   /**< 规则源文件数组容量 / Rule source file array capacity / Kapazität des Regelquelldatei-Arrays */
+    int watch_rules;               /**< 监视规则文件并自动重载（1=启用，0=禁用） / Watch rule files and reload automatically (1=enable, 0=disable) / Regeldateien überwachen und automatisch neu laden (1=aktivieren, 0=deaktivieren) */
+    uint32_t watch_interval_ms;    /**< 规则文件监视间隔（0=使用默认值） / Rule file watch interval (0=use default) / Überwachungsintervall für Regeldateien (0=Standardwert verwenden) */
+    int preload_plugins;           /**< 规则加载后在后台预加载目标插件（1=启用，0=禁用） / Preload target plugins in background after rules load (1=enable, 0=disable) / Ziel-Plugins nach dem Laden der Regeln im Hintergrund vorladen (1=aktivieren, 0=deaktivieren) */
+    int preload_bind_now;          /**< 预加载时立即绑定所有符号 / Bind all symbols immediately when preloading / Beim Vorladen alle Symbole sofort binden */
+    size_t max_loaded_plugins;     /**< 同时驻留的插件上限（0=不限制） / Maximum resident plugins (0=unlimited) / Maximale Anzahl residenter Plugins (0=unbegrenzt) */
+    uint32_t unload_idle_after_ms; /**< 空闲多久后卸载插件（0=不卸载） / Idle time after which plugins are unloaded (0=never) / Leerlaufzeit, nach der Plugins entladen werden (0=nie) */
+    int watch_plugins;             /**< 监视插件库文件并热替换（1=启用，0=禁用） / Watch plugin library files and hot-swap them (1=enable, 0=disable) / Plugin-Bibliotheksdateien überwachen und per Hot-Swap austauschen (1=aktivieren, 0=deaktivieren) */
+    size_t manifest_max_entries;   /**< 每个插件目录清单的库数量上限（0=使用默认值） / Library limit of each plugin directory manifest (0=use default) / Bibliotheksgrenze jedes Plugin-Verzeichnismanifests (0=Standardwert verwenden) */
+    validation_pending_policy_t validation_pending; /**< 后台验证未完成时的调用策略 / Call policy while background validation is pending / Aufrufstrategie bei ausstehender Hintergrundvalidierung */
+    char* trial_call_plugins;      /**< 允许试调用验证的插件文件名（逗号分隔，NULL=无） / Plugin file names that opt into trial call validation (comma-separated, NULL=none) / Plugin-Dateinamen mit Validierung per Probeaufruf (kommagetrennt, NULL=keine) */
+    int disable_metadata_cache;    /**< 不在验证数据库中缓存接口元数据（1=禁用，0=启用） / Do not cache interface metadata in the validation database (1=disable, 0=enable) / Schnittstellen-Metadaten nicht in der Validierungsdatenbank zwischenspeichern (1=deaktivieren, 0=aktivieren) */
+    int rule_batch_depth;          /**< 批量合并嵌套深度 / Batch merge nesting depth / Verschachtelungstiefe der Stapelzusammenführung */
+    int rule_graph_stale;          /**< 规则图需要在批量结束时重建 / Rule graph needs rebuilding at batch end / Regelgraph muss am Stapelende neu aufgebaut werden */
+    void** compiled_rule_maps;     /**< 规则引用的.nxptc文件映射 / .nxptc file mappings referenced by rules / Von Regeln referenzierte .nxptc-Dateizuordnungen */
+    size_t compiled_rule_map_count; /**< .nxptc映射数量 / .nxptc mapping count / Anzahl der .nxptc-Zuordnungen */
+    size_t compiled_rule_map_capacity; /**< .nxptc映射数组容量 / .nxptc mapping array capacity / Kapazität des .nxptc-Zuordnungs-Arrays */
+    void** string_arenas;          /**< 规则引用的字符串内存区 / String arenas referenced by rules / Von Regeln referenzierte Zeichenfolgen-Arenen */
+    size_t string_arena_count;     /**< 字符串内存区数量 / String arena count / Anzahl der Zeichenfolgen-Arenen */
+    size_t string_arena_capacity;  /**< 字符串内存区数组容量 / String arena array capacity / Kapazität des Zeichenfolgen-Arena-Arrays */
+    volatile int targets_prepared; /**< 规则目标的.nxpt和接口状态已在写锁下准备好（规则集变化时清零） / Rule targets' .nxpt files and interface states were prepared under the write lock (cleared when the rule set changes) / .nxpt-Dateien und Schnittstellenstatus der Regelziele wurden unter der Schreibsperre vorbereitet (bei Änderung des Regelsatzes zurückgesetzt) */
 } pointer_transfer_context_t;
-
+    
 #ifdef __cplusplus
 }
 #endif
@@ -66,10 +66,10 @@ int check_type_compatibility(nxld_param_type_t actual_type, nxld_param_type_t ex
 /**
  * @brief 检查传递条件 / Check transfer condition / Übertragungsbedingung prüfen
  * @param condition 条件字符串 / Condition string / Bedingungszeichenfolge
- * @param param_value 参数值指针 / Parameter value pointer / Parameterwert-Zeiger
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @return 满足条件返回1，否则返回0 / Returns 1 if condition is met, 0 otherwise / Gibt 1 zurück, wenn Bedingung erfüllt ist, sonst 0
  */
-int check_condition(const char* condition, void* param_value);
+int check_condition(const char* condition, const pt_typed_value_t* value);
 
 /**
  * @brief 获取当前DLL路径 / Get current DLL path / Aktuellen DLL-Pfad abrufen
@@ -103,16 +103,63 @@ struct target_interface_state_s;
 int set_parameter_value_from_const_string(struct target_interface_state_s* state, int param_index, const char* const_value, const char* plugin_name, const char* interface_name);
 
 /**
- * @brief 从指针设置参数值 / Set parameter value from pointer / Parameterwert aus Zeiger setzen
+ * @brief 构造整数值 / Make integer value / Ganzzahlwert erzeugen
+ * @param value 整数 / Integer / Ganzzahl
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t make_int64_value(int64_t value);
+
+/**
+ * @brief 构造浮点值 / Make floating-point value / Gleitkommawert erzeugen
+ * @param value 浮点数 / Floating-point number / Gleitkommazahl
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t make_double_value(double value);
+
+/**
+ * @brief 构造指针值 / Make pointer value / Zeigerwert erzeugen
+ * @param ptr 指针 / Pointer / Zeiger
+ * @param type 指针所指数据的类型 / Type of the data behind the pointer / Typ der Daten hinter dem Zeiger
+ * @param size 数据大小，0表示未知 / Data size, 0 if unknown / Datengröße, 0 wenn unbekannt
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t make_pointer_value(void* ptr, nxld_param_type_t type, size_t size);
+
+/**
+ * @brief 检查值是否直接携带标量 / Check whether a value carries a scalar directly / Prüfen, ob ein Wert einen Skalar direkt trägt
+ * @param value 带类型的值 / Typed value / Typisierter Wert
+ * @return 直接携带返回1，否则返回0 / Returns 1 if carried directly, 0 otherwise / Gibt 1 zurück, wenn direkt getragen, sonst 0
+ */
+int is_immediate_value(const pt_typed_value_t* value);
+
+/**
+ * @brief 读取值的数值 / Read numeric value of a typed value / Zahlenwert eines typisierten Werts lesen
+ * @param value 带类型的值 / Typed value / Typisierter Wert
+ * @param read_type 指针值的解引用类型 / Dereference type for pointer values / Dereferenzierungstyp für Zeigerwerte
+ * @param int_out 输出整数 / Output integer / Ausgabe-Ganzzahl
+ * @param float_out 输出浮点数 / Output floating-point number / Ausgabe-Gleitkommazahl
+ * @return 浮点返回1，整数返回0，空指针返回-1 / Returns 1 for floating-point, 0 for integer, -1 for a null pointer / Gibt 1 für Gleitkomma, 0 für Ganzzahl, -1 für einen Nullzeiger zurück
+ */
+int read_typed_value_number(const pt_typed_value_t* value, nxld_param_type_t read_type, int64_t* int_out, double* float_out);
+
+/**
+ * @brief 从带类型的值设置参数值 / Set parameter value from typed value / Parameterwert aus typisiertem Wert setzen
  * @param state 接口状态指针 / Interface state pointer / Schnittstellenstatus-Zeiger
  * @param param_index 参数索引 / Parameter index / Parameterindex
- * @param ptr 参数值指针 / Parameter value pointer / Parameterwert-Zeiger
- * @param stored_size 存储的数据大小 / Stored data size / Gespeicherte Datengröße
+ * @param value 带类型的值（NULL视为空指针） / Typed value (NULL counts as a null pointer) / Typisierter Wert (NULL gilt als Nullzeiger)
  * @param plugin_name 插件名称 / Plugin name / Plugin-Name
  * @param interface_name 接口名称 / Interface name / Schnittstellenname
  * @return 成功返回1，失败返回0 / Returns 1 on success, 0 on failure / Gibt 1 bei Erfolg zurück, 0 bei Fehler
  */
-int set_parameter_value_from_pointer(struct target_interface_state_s* state, int param_index, void* ptr, size_t stored_size, const char* plugin_name, const char* interface_name);
+int set_parameter_value_from_typed(struct target_interface_state_s* state, int param_index, const pt_typed_value_t* value, const char* plugin_name, const char* interface_name);
+
+/**
+ * @brief 读取已设置参数的带类型值 / Read typed value of a stored parameter / Typisierten Wert eines gespeicherten Parameters lesen
+ * @param state 接口状态指针 / Interface state pointer / Schnittstellenstatus-Zeiger
+ * @param param_index 参数索引 / Parameter index / Parameterindex
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t get_parameter_typed_value(struct target_interface_state_s* state, int param_index);
 
 /**
  * @brief 从接口描述推断返回值类型 / Infer return type from interface description / Rückgabetyp aus Schnittstellenbeschreibung ableiten
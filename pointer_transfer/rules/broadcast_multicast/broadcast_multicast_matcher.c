@@ -8,13 +8,15 @@
 #include "../../pointer_transfer_utils.h"
 #include "../../pointer_transfer_interface.h"
 #include "../../pointer_transfer_types.h"
+#include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 /**
  * @brief 应用BROADCAST和MULTICAST规则（使用索引） / Apply BROADCAST and MULTICAST rules (using index) / BROADCAST- und MULTICAST-Regeln anwenden (mit Index)
  */
 size_t apply_broadcast_multicast_rules_indexed(const char* source_plugin_name, const char* source_interface_name, 
-                                                int source_param_index, void* ptr, size_t start_index, size_t end_index,
+                                                int source_param_index, const pt_typed_value_t* value, size_t start_index, size_t end_index,
                                                 size_t* success_count) {
     pointer_transfer_context_t* ctx = get_global_context();
     size_t matched_count = 0;
@@ -37,7 +39,7 @@ size_t apply_broadcast_multicast_rules_indexed(const char* source_plugin_name, c
                     }
                 }
                 
-                if (!check_condition(rule->condition, ptr)) {
+                if (!check_condition(rule->condition, value)) {
                     internal_log_write("INFO", "Transfer rule %zu condition not met, skipping - condition: %s", 
                                 i, rule->condition != NULL ? rule->condition : "none");
                     continue;
@@ -51,7 +53,7 @@ size_t apply_broadcast_multicast_rules_indexed(const char* source_plugin_name, c
                             rule->target_interface != NULL ? rule->target_interface : "unknown",
                             rule->target_param_index);
                 
-                int call_result = call_target_plugin_interface(rule, ptr);
+                int call_result = call_target_plugin_interface(rule, value);
                 if (call_result == 0) {
                     (*success_count)++;
                     internal_log_write("INFO", "Successfully called target plugin interface");
@@ -69,7 +71,7 @@ size_t apply_broadcast_multicast_rules_indexed(const char* source_plugin_name, c
  * @brief 应用BROADCAST和MULTICAST规则（线性查找） / Apply BROADCAST and MULTICAST rules (linear search) / BROADCAST- und MULTICAST-Regeln anwenden (lineare Suche)
  */
 size_t apply_broadcast_multicast_rules_linear(const char* source_plugin_name, const char* source_interface_name, 
-                                               int source_param_index, void* ptr, size_t* success_count) {
+                                               int source_param_index, const pt_typed_value_t* value, size_t* success_count) {
     pointer_transfer_context_t* ctx = get_global_context();
     size_t matched_count = 0;
     
@@ -91,7 +93,7 @@ size_t apply_broadcast_multicast_rules_linear(const char* source_plugin_name, co
                         }
                     }
                     
-                    if (!check_condition(rule->condition, ptr)) {
+                    if (!check_condition(rule->condition, value)) {
                         internal_log_write("INFO", "Transfer rule %zu condition not met, skipping - condition: %s", 
                                     i, rule->condition != NULL ? rule->condition : "none");
                         continue;
@@ -105,7 +107,7 @@ size_t apply_broadcast_multicast_rules_linear(const char* source_plugin_name, co
                                 rule->target_interface != NULL ? rule->target_interface : "unknown",
                                 rule->target_param_index);
                     
-                    int call_result = call_target_plugin_interface(rule, ptr);
+                    int call_result = call_target_plugin_interface(rule, value);
                     if (call_result == 0) {
                         (*success_count)++;
                         internal_log_write("INFO", "Successfully called target plugin interface");
@@ -120,3 +122,90 @@ size_t apply_broadcast_multicast_rules_linear(const char* source_plugin_name, co
     return matched_count;
 }
 
+/**
+ * @brief 批量应用BROADCAST和MULTICAST规则 / Apply BROADCAST and MULTICAST rules to a batch / BROADCAST- und MULTICAST-Regeln auf einen Stapel anwenden
+ * @details 收集所有规则中满足条件的行，交由run_pending_calls按拓扑序重排，同一规则的行合并为一次<Interface>_Vec调用 / Collects the rows meeting the condition across all rules and hands them to run_pending_calls, which reorders them topologically and merges the rows of one rule into one <Interface>_Vec call / Sammelt die Zeilen, die die Bedingung erfüllen, über alle Regeln und übergibt sie an run_pending_calls, das sie topologisch umordnet und die Zeilen einer Regel zu einem <Interface>_Vec-Aufruf zusammenfasst
+ */
+size_t apply_broadcast_multicast_rules_batch(const char* source_plugin_name, const char* source_interface_name,
+                                             int source_param_index, const pt_typed_value_t* values, size_t count,
+                                             size_t start_index, size_t end_index, size_t* success_count) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    size_t matched_count = 0;
+    size_t pending_count = 0;
+    size_t pending_capacity = count;
+    
+    pt_pending_call_t* pending = (pt_pending_call_t*)malloc(pending_capacity * sizeof(pt_pending_call_t));
+    if (pending == NULL) {
+        return 0;
+    }
+    
+    for (size_t i = start_index; i <= end_index && i < ctx->rule_count; i++) {
+        pointer_transfer_rule_t* rule = &ctx->rules[i];
+        if (!rule->enabled || rule->source_plugin == NULL || rule->source_interface == NULL ||
+            strcmp(rule->source_plugin, source_plugin_name) != 0 ||
+            strcmp(rule->source_interface, source_interface_name) != 0 ||
+            rule->source_param_index != source_param_index) {
+            continue;
+        }
+        
+        if (rule->transfer_mode != TRANSFER_MODE_BROADCAST && rule->transfer_mode != TRANSFER_MODE_MULTICAST) {
+            continue;
+        }
+        if (rule->transfer_mode == TRANSFER_MODE_MULTICAST &&
+            (rule->multicast_group == NULL || strlen(rule->multicast_group) == 0)) {
+            continue;
+        }
+        
+        /* 每条规则至多追加count行 / Each rule appends at most count rows / Jede Regel fügt höchstens count Zeilen an */
+        if (pending_capacity - pending_count < count) {
+            if (pending_capacity > SIZE_MAX / 2 / sizeof(pt_pending_call_t)) {
+                internal_log_write("ERROR", "Pending call buffer overflow detected (capacity=%zu)", pending_capacity);
+                break;
+            }
+            size_t new_capacity = pending_capacity * 2;
+            pt_pending_call_t* grown = (pt_pending_call_t*)realloc(pending, new_capacity * sizeof(pt_pending_call_t));
+            if (grown == NULL) {
+                internal_log_write("ERROR", "Failed to grow pending call buffer (capacity=%zu)", new_capacity);
+                break;
+            }
+            pending = grown;
+            pending_capacity = new_capacity;
+        }
+        
+        size_t row_count = 0;
+        for (size_t row = 0; row < count; row++) {
+            if (check_condition(rule->condition, &values[row])) {
+                pending[pending_count].rule = rule;
+                pending[pending_count].value = values[row];
+                pending_count++;
+                row_count++;
+            }
+        }
+        if (row_count == 0) {
+            continue;
+        }
+        
+        matched_count += row_count;
+        internal_log_write("INFO", "Applying transfer rule %zu (mode=%d) to %zu rows - %s.%s[%d] to %s.%s[%d]",
+                    i, (int)rule->transfer_mode, row_count,
+                    source_plugin_name, source_interface_name, source_param_index,
+                    rule->target_plugin != NULL ? rule->target_plugin : "unknown",
+                    rule->target_interface != NULL ? rule->target_interface : "unknown",
+                    rule->target_param_index);
+    }
+    
+    if (run_pending_calls(pending, pending_count, success_count) != 0) {
+        /* 无法重排时按提交顺序逐个调用 / Call one by one in submission order when reordering is not possible / Einzeln in Einreichungsreihenfolge aufrufen, wenn Umordnen nicht möglich ist */
+        for (size_t k = 0; k < pending_count; k++) {
+            int call_result = call_target_plugin_interface(pending[k].rule, &pending[k].value);
+            if (call_result == 0) {
+                (*success_count)++;
+            } else {
+                internal_log_write("WARNING", "Failed to call target plugin interface (error=%d)", call_result);
+            }
+        }
+    }
+    
+    free(pending);
+    return matched_count;
+}
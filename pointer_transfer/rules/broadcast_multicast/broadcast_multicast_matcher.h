@@ -6,6 +6,7 @@
 #ifndef BROADCAST_MULTICAST_MATCHER_H
 #define BROADCAST_MULTICAST_MATCHER_H
 
+#include "../../pointer_transfer_types.h"
 #include <stddef.h>
 
 /**
@@ -13,14 +14,14 @@
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
  * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
  * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
- * @param ptr 指针 / Pointer / Zeiger
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @param start_index 起始索引 / Start index / Startindex
  * @param end_index 结束索引 / End index / Endindex
  * @param success_count 成功计数指针 / Success count pointer / Erfolgszähler-Zeiger
  * @return 匹配的规则数量 / Number of matched rules / Anzahl der abgeglichenen Regeln
  */
 size_t apply_broadcast_multicast_rules_indexed(const char* source_plugin_name, const char* source_interface_name, 
-                                                int source_param_index, void* ptr, size_t start_index, size_t end_index,
+                                                int source_param_index, const pt_typed_value_t* value, size_t start_index, size_t end_index,
                                                 size_t* success_count);
 
 /**
@@ -28,12 +29,28 @@ size_t apply_broadcast_multicast_rules_indexed(const char* source_plugin_name, c
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
  * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
  * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
- * @param ptr 指针 / Pointer / Zeiger
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @param success_count 成功计数指针 / Success count pointer / Erfolgszähler-Zeiger
  * @return 匹配的规则数量 / Number of matched rules / Anzahl der abgeglichenen Regeln
  */
 size_t apply_broadcast_multicast_rules_linear(const char* source_plugin_name, const char* source_interface_name, 
-                                               int source_param_index, void* ptr, size_t* success_count);
+                                               int source_param_index, const pt_typed_value_t* value, size_t* success_count);
+
+/**
+ * @brief 批量应用BROADCAST和MULTICAST规则 / Apply BROADCAST and MULTICAST rules to a batch / BROADCAST- und MULTICAST-Regeln auf einen Stapel anwenden
+ * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
+ * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
+ * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
+ * @param values 值数组 / Value array / Wert-Array
+ * @param count 值数量 / Value count / Anzahl der Werte
+ * @param start_index 起始规则索引 / Start rule index / Start-Regelindex
+ * @param end_index 结束规则索引（含） / End rule index (inclusive) / End-Regelindex (einschließlich)
+ * @param success_count 成功调用数量 / Successful call count / Anzahl erfolgreicher Aufrufe
+ * @return 匹配的规则行数 / Number of matched rule rows / Anzahl der abgeglichenen Regelzeilen
+ */
+size_t apply_broadcast_multicast_rules_batch(const char* source_plugin_name, const char* source_interface_name,
+                                             int source_param_index, const pt_typed_value_t* values, size_t count,
+                                             size_t start_index, size_t end_index, size_t* success_count);
 
 #endif /* BROADCAST_MULTICAST_MATCHER_H */
 
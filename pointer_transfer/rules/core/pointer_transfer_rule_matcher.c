@@ -6,23 +6,29 @@
 #include "pointer_transfer_rule_matcher.h"
 #include "../broadcast_multicast/broadcast_multicast_matcher.h"
 #include "../unicast/unicast_matcher.h"
+#include "../../pointer_transfer_interface.h"
+#include <stdint.h>
 
 /**
  * @brief 应用匹配的规则（使用索引） / Apply matched rules (using index) / Passende Regeln anwenden (mit Index)
  */
 size_t apply_matched_rules_indexed(const char* source_plugin_name, const char* source_interface_name, 
-                                    int source_param_index, void* ptr, size_t start_index, size_t end_index,
+                                    int source_param_index, const pt_typed_value_t* value, size_t start_index, size_t end_index,
                                     size_t* success_count) {
     size_t matched_count = 0;
     
+    /* 源接口正在执行，遍历其目标期间保持标记 / The source interface is running, it stays marked while its targets are walked / Die Quellschnittstelle läuft und bleibt markiert, während ihre Ziele durchlaufen werden */
+    size_t source_mark = mark_call_cycle_source(source_plugin_name, source_interface_name);
+    
     /* BROADCAST和MULTICAST规则 / BROADCAST and MULTICAST rules / BROADCAST- und MULTICAST-Regeln */
     matched_count += apply_broadcast_multicast_rules_indexed(source_plugin_name, source_interface_name, 
-                                                              source_param_index, ptr, start_index, end_index, success_count);
+                                                              source_param_index, value, start_index, end_index, success_count);
     
     /* UNICAST规则 / UNICAST rules / UNICAST-Regeln */
     matched_count += apply_unicast_rules_indexed(source_plugin_name, source_interface_name, 
-                                                  source_param_index, ptr, start_index, end_index, success_count);
+                                                  source_param_index, value, start_index, end_index, success_count);
     
+    release_call_cycle_mark(source_mark);
     return matched_count;
 }
 
@@ -30,17 +36,48 @@ size_t apply_matched_rules_indexed(const char* source_plugin_name, const char* s
  * @brief 应用匹配的规则（线性查找） / Apply matched rules (linear search) / Passende Regeln anwenden (lineare Suche)
  */
 size_t apply_matched_rules_linear(const char* source_plugin_name, const char* source_interface_name, 
-                                   int source_param_index, void* ptr, size_t* success_count) {
+                                   int source_param_index, const pt_typed_value_t* value, size_t* success_count) {
     size_t matched_count = 0;
+    size_t source_mark = mark_call_cycle_source(source_plugin_name, source_interface_name);
     
     /* BROADCAST和MULTICAST规则 / BROADCAST and MULTICAST rules / BROADCAST- und MULTICAST-Regeln */
     matched_count += apply_broadcast_multicast_rules_linear(source_plugin_name, source_interface_name, 
-                                                              source_param_index, ptr, success_count);
+                                                              source_param_index, value, success_count);
     
     /* UNICAST规则 / UNICAST rules / UNICAST-Regeln */
     matched_count += apply_unicast_rules_linear(source_plugin_name, source_interface_name, 
-                                                 source_param_index, ptr, success_count);
+                                                 source_param_index, value, success_count);
     
+    release_call_cycle_mark(source_mark);
     return matched_count;
 }
 
+/**
+ * @brief 批量应用匹配的规则 / Apply matched rules to a batch / Passende Regeln auf einen Stapel anwenden
+ * @details BROADCAST和MULTICAST规则按规则合并各行，UNICAST规则逐行应用 / BROADCAST and MULTICAST rules coalesce rows per rule, UNICAST rules are applied row by row / BROADCAST- und MULTICAST-Regeln fassen Zeilen je Regel zusammen, UNICAST-Regeln werden zeilenweise angewendet
+ */
+size_t apply_matched_rules_batch(const char* source_plugin_name, const char* source_interface_name,
+                                 int source_param_index, const pt_typed_value_t* values, size_t count,
+                                 int use_index, size_t start_index, size_t end_index, size_t* success_count) {
+    size_t matched_count = 0;
+    size_t source_mark = mark_call_cycle_source(source_plugin_name, source_interface_name);
+    
+    /* BROADCAST和MULTICAST规则 / BROADCAST and MULTICAST rules / BROADCAST- und MULTICAST-Regeln */
+    matched_count += apply_broadcast_multicast_rules_batch(source_plugin_name, source_interface_name, source_param_index,
+                                                           values, count, use_index ? start_index : 0,
+                                                           use_index ? end_index : SIZE_MAX, success_count);
+    
+    /* UNICAST规则 / UNICAST rules / UNICAST-Regeln */
+    for (size_t row = 0; row < count; row++) {
+        if (use_index) {
+            matched_count += apply_unicast_rules_indexed(source_plugin_name, source_interface_name,
+                                                         source_param_index, &values[row], start_index, end_index, success_count);
+        } else {
+            matched_count += apply_unicast_rules_linear(source_plugin_name, source_interface_name,
+                                                        source_param_index, &values[row], success_count);
+        }
+    }
+    
+    release_call_cycle_mark(source_mark);
+    return matched_count;
+}
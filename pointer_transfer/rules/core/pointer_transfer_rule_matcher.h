@@ -6,20 +6,28 @@
 #ifndef POINTER_TRANSFER_RULE_MATCHER_H
 #define POINTER_TRANSFER_RULE_MATCHER_H
 
+#include "../../pointer_transfer_types.h"
 #include <stddef.h>
 
 /**
  * @brief 应用匹配的规则（使用索引） / Apply matched rules (using index) / Passende Regeln anwenden (mit Index)
  */
 size_t apply_matched_rules_indexed(const char* source_plugin_name, const char* source_interface_name, 
-                                    int source_param_index, void* ptr, size_t start_index, size_t end_index,
+                                    int source_param_index, const pt_typed_value_t* value, size_t start_index, size_t end_index,
                                     size_t* success_count);
 
 /**
  * @brief 应用匹配的规则（线性查找） / Apply matched rules (linear search) / Passende Regeln anwenden (lineare Suche)
  */
 size_t apply_matched_rules_linear(const char* source_plugin_name, const char* source_interface_name, 
-                                   int source_param_index, void* ptr, size_t* success_count);
+                                   int source_param_index, const pt_typed_value_t* value, size_t* success_count);
+
+/**
+ * @brief 批量应用匹配的规则 / Apply matched rules to a batch / Passende Regeln auf einen Stapel anwenden
+ */
+size_t apply_matched_rules_batch(const char* source_plugin_name, const char* source_interface_name,
+                                 int source_param_index, const pt_typed_value_t* values, size_t count,
+                                 int use_index, size_t start_index, size_t end_index, size_t* success_count);
 
 #endif /* POINTER_TRANSFER_RULE_MATCHER_H */
 
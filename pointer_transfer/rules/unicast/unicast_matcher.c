@@ -21,7 +21,7 @@
  * @param end_index 结束索引 / End index / Endindex
  * @return 存在重复返回1，否则返回0 / Returns 1 if duplicate exists, 0 otherwise / Gibt 1 zurück, wenn Duplikat vorhanden ist, sonst 0
  */
-static int check_exact_duplicate_target(pointer_transfer_context_t* ctx, const char* source_plugin_name, 
+static int check_unicast_duplicate_target(pointer_transfer_context_t* ctx, const char* source_plugin_name, 
                                          const char* source_interface_name, int source_param_index,
                                          pointer_transfer_rule_t* current_rule, size_t start_index, size_t end_index) {
     for (size_t j = start_index + 1; j <= end_index && j < ctx->rule_count; j++) {
@@ -47,7 +47,7 @@ static int check_exact_duplicate_target(pointer_transfer_context_t* ctx, const c
  * @brief 应用UNICAST规则（使用索引） / Apply UNICAST rules (using index) / UNICAST-Regeln anwenden (mit Index)
  */
 size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* source_interface_name, 
-                                    int source_param_index, void* ptr, size_t start_index, size_t end_index,
+                                    int source_param_index, const pt_typed_value_t* value, size_t start_index, size_t end_index,
                                     size_t* success_count) {
     pointer_transfer_context_t* ctx = get_global_context();
     size_t matched_count = 0;
@@ -64,7 +64,7 @@ size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* s
                 rule->source_param_index == source_param_index) {
                 
                 if (rule->transfer_mode == TRANSFER_MODE_UNICAST) {
-                    if (!check_condition(rule->condition, ptr)) {
+                    if (!check_condition(rule->condition, value)) {
                         internal_log_write("INFO", "Transfer rule %zu condition not met, skipping - condition: %s", 
                                     i, rule->condition != NULL ? rule->condition : "none");
                         continue;
@@ -78,7 +78,7 @@ size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* s
                                 rule->target_interface != NULL ? rule->target_interface : "unknown",
                                 rule->target_param_index);
                     
-                    int call_result = call_target_plugin_interface(rule, ptr);
+                    int call_result = call_target_plugin_interface(rule, value);
                     if (call_result == 0) {
                         (*success_count)++;
                         internal_log_write("INFO", "Successfully called target plugin interface");
@@ -86,7 +86,7 @@ size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* s
                         internal_log_write("WARNING", "Failed to call target plugin interface (error=%d)", call_result);
                     }
                     
-                    if (check_exact_duplicate_target(ctx, source_plugin_name, source_interface_name, source_param_index, rule, i, end_index)) {
+                    if (check_unicast_duplicate_target(ctx, source_plugin_name, source_interface_name, source_param_index, rule, i, end_index)) {
                         break;
                     }
                 }
@@ -101,7 +101,7 @@ size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* s
  * @brief 应用UNICAST规则（线性查找） / Apply UNICAST rules (linear search) / UNICAST-Regeln anwenden (lineare Suche)
  */
 size_t apply_unicast_rules_linear(const char* source_plugin_name, const char* source_interface_name, 
-                                   int source_param_index, void* ptr, size_t* success_count) {
+                                   int source_param_index, const pt_typed_value_t* value, size_t* success_count) {
     pointer_transfer_context_t* ctx = get_global_context();
     size_t matched_count = 0;
     
@@ -117,7 +117,7 @@ size_t apply_unicast_rules_linear(const char* source_plugin_name, const char* so
                 rule->source_param_index == source_param_index) {
                 
                 if (rule->transfer_mode == TRANSFER_MODE_UNICAST) {
-                    if (!check_condition(rule->condition, ptr)) {
+                    if (!check_condition(rule->condition, value)) {
                         internal_log_write("INFO", "Transfer rule %zu condition not met, skipping - condition: %s", 
                                     i, rule->condition != NULL ? rule->condition : "none");
                         continue;
@@ -131,7 +131,7 @@ size_t apply_unicast_rules_linear(const char* source_plugin_name, const char* so
                                 rule->target_interface != NULL ? rule->target_interface : "unknown",
                                 rule->target_param_index);
                     
-                    int call_result = call_target_plugin_interface(rule, ptr);
+                    int call_result = call_target_plugin_interface(rule, value);
                     if (call_result == 0) {
                         (*success_count)++;
                         internal_log_write("INFO", "Successfully called target plugin interface");
@@ -139,7 +139,7 @@ size_t apply_unicast_rules_linear(const char* source_plugin_name, const char* so
                         internal_log_write("WARNING", "Failed to call target plugin interface (error=%d)", call_result);
                     }
                     
-                    if (check_exact_duplicate_target(ctx, source_plugin_name, source_interface_name, source_param_index, rule, i, ctx->rule_count - 1)) {
+                    if (check_unicast_duplicate_target(ctx, source_plugin_name, source_interface_name, source_param_index, rule, i, ctx->rule_count - 1)) {
                         break;
                     }
                 }
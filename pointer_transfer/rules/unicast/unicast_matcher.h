@@ -6,6 +6,7 @@
 #ifndef UNICAST_MATCHER_H
 #define UNICAST_MATCHER_H
 
+#include "../../pointer_transfer_types.h"
 #include <stddef.h>
 
 /**
@@ -13,14 +14,14 @@
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
  * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
  * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
- * @param ptr 指针 / Pointer / Zeiger
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @param start_index 起始索引 / Start index / Startindex
  * @param end_index 结束索引 / End index / Endindex
  * @param success_count 成功计数指针 / Success count pointer / Erfolgszähler-Zeiger
  * @return 匹配的规则数量 / Number of matched rules / Anzahl der abgeglichenen Regeln
  */
 size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* source_interface_name, 
-                                    int source_param_index, void* ptr, size_t start_index, size_t end_index,
+                                    int source_param_index, const pt_typed_value_t* value, size_t start_index, size_t end_index,
                                     size_t* success_count);
 
 /**
@@ -28,12 +29,12 @@ size_t apply_unicast_rules_indexed(const char* source_plugin_name, const char* s
  * @param source_plugin_name 源插件名称 / Source plugin name / Quell-Plugin-Name
  * @param source_interface_name 源接口名称 / Source interface name / Quell-Schnittstellenname
  * @param source_param_index 源参数索引 / Source parameter index / Quell-Parameterindex
- * @param ptr 指针 / Pointer / Zeiger
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @param success_count 成功计数指针 / Success count pointer / Erfolgszähler-Zeiger
  * @return 匹配的规则数量 / Number of matched rules / Anzahl der abgeglichenen Regeln
  */
 size_t apply_unicast_rules_linear(const char* source_plugin_name, const char* source_interface_name, 
-                                   int source_param_index, void* ptr, size_t* success_count);
+                                   int source_param_index, const pt_typed_value_t* value, size_t* success_count);
 
 #endif /* UNICAST_MATCHER_H */
 
@@ -0,0 +1,103 @@
+/**
+ * @file pointer_transfer_batch_bench.c
+ * @brief 批量传递(_Vec)吞吐量基准 / Batch Transfer (_Vec) Throughput Benchmark / Durchsatz-Benchmark der Batch-Übertragung (_Vec)
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 默认每轮行数和轮数 / Default rows per round and round count / Standardzeilen je Runde und Rundenanzahl */
+#define BATCH_BENCH_DEFAULT_ROWS 4096
+#define BATCH_BENCH_ROUNDS 16
+
+/**
+ * @brief 输出一种路径的吞吐量 / Print the throughput of one path / Durchsatz eines Pfads ausgeben
+ */
+static void print_throughput(const char* label, size_t rows, int64_t elapsed_us) {
+    double seconds = elapsed_us > 0 ? (double)elapsed_us / 1000000.0 : 1e-6;
+    printf("%-24s %10zu rows %10.3f ms %14.0f rows/s\n", label, rows, (double)elapsed_us / 1000.0, (double)rows / seconds);
+}
+
+/**
+ * @brief 基准入口 / Benchmark entry / Benchmark-Einstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径，可选argv[3]为每轮行数） / Arguments (argv[1] is the work directory, argv[2] the test plugin path, optional argv[3] the rows per round) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad, optional argv[3] die Zeilen je Runde)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> [rows]\n", argv[0]);
+        return 2;
+    }
+    size_t row_count = argc > 3 ? (size_t)strtoul(argv[3], NULL, 10) : BATCH_BENCH_DEFAULT_ROWS;
+    if (row_count < 2) {
+        row_count = 2;
+    }
+    
+    /* S.n -> TestPlugin.Scale，关闭INFO日志以免测到日志输出 / S.n -> TestPlugin.Scale, INFO logging off so log output is not measured / S.n -> TestPlugin.Scale, INFO-Protokollierung aus, damit nicht die Protokollausgabe gemessen wird */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[2 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "batch_bench.nxpt");
+    pt_test_path(compiled_path, argv[1], "batch_bench.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    double* values = (double*)malloc(row_count * sizeof(double));
+    PT_TEST_CHECK(values != NULL);
+    if (values == NULL) {
+        return pt_test_finish("pointer_transfer_batch_bench");
+    }
+    for (size_t i = 0; i < row_count; i++) {
+        values[i] = (double)i * 0.25;
+    }
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 预热：加载插件、准备目标并完成验证 / Warm up: load the plugin, prepare targets and finish validation / Aufwärmen: Plugin laden, Ziele vorbereiten und Validierung abschließen */
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, values[0]) == 0);
+    PT_TEST_CHECK(TransferDoubleBatch("S", "n", 0, values, row_count) == 0);
+    
+    int64_t start_us = pt_platform_get_monotonic_us();
+    for (int round = 0; round < BATCH_BENCH_ROUNDS; round++) {
+        for (size_t i = 0; i < row_count; i++) {
+            TransferDouble("S", "n", 0, values[i]);
+        }
+    }
+    int64_t scalar_us = pt_platform_get_monotonic_us() - start_us;
+    
+    start_us = pt_platform_get_monotonic_us();
+    for (int round = 0; round < BATCH_BENCH_ROUNDS; round++) {
+        TransferDoubleBatch("S", "n", 0, values, row_count);
+    }
+    int64_t batch_us = pt_platform_get_monotonic_us() - start_us;
+    
+    size_t total_rows = row_count * BATCH_BENCH_ROUNDS;
+    print_throughput("TransferDouble", total_rows, scalar_us);
+    print_throughput("TransferDoubleBatch", total_rows, batch_us);
+    if (batch_us > 0) {
+        printf("speedup %.2fx\n", (double)scalar_us / (double)batch_us);
+    }
+    
+    free(values);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_batch_bench");
+}
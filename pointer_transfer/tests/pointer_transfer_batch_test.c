@@ -0,0 +1,158 @@
+/**
+ * @file pointer_transfer_batch_test.c
+ * @brief 批量传递(_Vec)测试 / Batch Transfer (_Vec) Test / Batch-Übertragungstest (_Vec)
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 批量行数 / Batch row count / Batch-Zeilenanzahl */
+#define BATCH_TEST_ROWS 64
+
+/* 测试插件Scale_Vec停止的值和所在行 / Value at which the test plugin's Scale_Vec stops, and its row / Wert, bei dem Scale_Vec des Test-Plugins anhält, und seine Zeile */
+#define BATCH_TEST_STOP_VALUE -1000.0
+#define BATCH_TEST_STOP_ROW 40
+
+/* 测试插件的计数器 / Counters of the test plugin / Zähler des Test-Plugins */
+typedef struct {
+    size_t* scalar_calls;
+    size_t* vec_calls;
+    size_t* vec_rows;
+    size_t* record_count;
+    double* records;
+} batch_test_counters_t;
+
+/**
+ * @brief 清零测试插件的计数器 / Reset the test plugin counters / Zähler des Test-Plugins zurücksetzen
+ */
+static void reset_counters(const batch_test_counters_t* counters) {
+    *counters->scalar_calls = 0;
+    *counters->vec_calls = 0;
+    *counters->vec_rows = 0;
+    *counters->record_count = 0;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* S.n -> TestPlugin.Scale -> TestPlugin.Record */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[4 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "batch_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "batch_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=TestPlugin\nSourceInterface=Scale\nSourceParamIndex=-1\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2], argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 与调度器共享同一个已加载的测试插件 / Shares the test plugin already loaded by the dispatcher / Teilt das bereits vom Dispatcher geladene Test-Plugin */
+    void* handle = pt_platform_load_library(argv[2]);
+    PT_TEST_CHECK(handle != NULL);
+    if (handle == NULL) {
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_batch_test");
+    }
+    batch_test_counters_t counters = {
+        .scalar_calls = (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls"),
+        .vec_calls = (size_t*)pt_platform_get_symbol(handle, "test_plugin_vec_calls"),
+        .vec_rows = (size_t*)pt_platform_get_symbol(handle, "test_plugin_vec_rows"),
+        .record_count = (size_t*)pt_platform_get_symbol(handle, "test_plugin_record_count"),
+        .records = (double*)pt_platform_get_symbol(handle, "test_plugin_records")
+    };
+    PT_TEST_CHECK(counters.scalar_calls != NULL && counters.vec_calls != NULL && counters.vec_rows != NULL &&
+                  counters.record_count != NULL && counters.records != NULL);
+    if (counters.scalar_calls == NULL || counters.vec_calls == NULL || counters.vec_rows == NULL ||
+        counters.record_count == NULL || counters.records == NULL) {
+        pt_platform_close_library(handle);
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_batch_test");
+    }
+    
+    /* 单值传递调用标量接口 / A single transfer calls the scalar interface / Eine Einzelübertragung ruft die Skalarschnittstelle auf */
+    reset_counters(&counters);
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 1.5) == 0);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    PT_TEST_CHECK(*counters.vec_calls == 0);
+    PT_TEST_CHECK(*counters.record_count == 1 && counters.records[0] == 3.0);
+    
+    /* 批量传递只调用一次_Vec，下游按输入顺序收到每行结果 / A batch calls _Vec once and downstream receives every row in input order / Ein Batch ruft _Vec einmal auf und nachgelagert kommt jede Zeile in Eingabereihenfolge an */
+    double values[BATCH_TEST_ROWS];
+    for (size_t i = 0; i < BATCH_TEST_ROWS; i++) {
+        values[i] = (double)i * 0.5 - 3.0;
+    }
+    reset_counters(&counters);
+    PT_TEST_CHECK(TransferDoubleBatch("S", "n", 0, values, BATCH_TEST_ROWS) == 0);
+    PT_TEST_CHECK(*counters.vec_calls == 1);
+    PT_TEST_CHECK(*counters.vec_rows == BATCH_TEST_ROWS);
+    PT_TEST_CHECK(*counters.scalar_calls == 0);
+    PT_TEST_CHECK(*counters.record_count == BATCH_TEST_ROWS);
+    if (*counters.record_count == BATCH_TEST_ROWS) {
+        size_t mismatches = 0;
+        for (size_t i = 0; i < BATCH_TEST_ROWS; i++) {
+            if (counters.records[i] != values[i] * 2.0) {
+                mismatches++;
+            }
+        }
+        PT_TEST_CHECK(mismatches == 0);
+    }
+    
+    /* _Vec中途失败时只有未完成的行逐行重新调用，每行恰好执行一次 / When _Vec fails midway only the incomplete rows are called again, every row runs exactly once / Wenn _Vec mittendrin fehlschlägt, werden nur die unvollständigen Zeilen erneut aufgerufen, jede Zeile läuft genau einmal */
+    double stop_values[BATCH_TEST_ROWS];
+    memcpy(stop_values, values, sizeof(stop_values));
+    stop_values[BATCH_TEST_STOP_ROW] = BATCH_TEST_STOP_VALUE;
+    reset_counters(&counters);
+    PT_TEST_CHECK(TransferDoubleBatch("S", "n", 0, stop_values, BATCH_TEST_ROWS) == 0);
+    PT_TEST_CHECK(*counters.vec_calls == 1);
+    PT_TEST_CHECK(*counters.vec_rows == BATCH_TEST_STOP_ROW);
+    PT_TEST_CHECK(*counters.scalar_calls == BATCH_TEST_ROWS - BATCH_TEST_STOP_ROW);
+    PT_TEST_CHECK(*counters.record_count == BATCH_TEST_ROWS);
+    if (*counters.record_count == BATCH_TEST_ROWS) {
+        size_t mismatches = 0;
+        for (size_t i = 0; i < BATCH_TEST_ROWS; i++) {
+            if (counters.records[i] != stop_values[i] * 2.0) {
+                mismatches++;
+            }
+        }
+        PT_TEST_CHECK(mismatches == 0);
+    }
+    
+    /* 单行批量走标量路径 / A one-row batch takes the scalar path / Ein einzeiliger Batch nimmt den Skalarpfad */
+    reset_counters(&counters);
+    PT_TEST_CHECK(TransferDoubleBatch("S", "n", 0, values, 1) == 0);
+    PT_TEST_CHECK(*counters.vec_calls == 0);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    PT_TEST_CHECK(*counters.record_count == 1 && counters.records[0] == values[0] * 2.0);
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_batch_test");
+}
@@ -0,0 +1,106 @@
+/**
+ * @file pointer_transfer_borrow_test.c
+ * @brief 借用结构体参数测试 / Borrowed Struct Parameter Test / Test für ausgeliehene Strukturparameter
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "config/reload/config_reload.h"
+#include <stdint.h>
+#include <string.h>
+
+/* 大于指针的结构体参数 / Struct parameter larger than a pointer / Strukturparameter größer als ein Zeiger */
+typedef struct {
+    int64_t id;
+    double weight;
+    char tag[16];
+} borrow_test_record_t;
+
+/**
+ * @brief 读取版本2参数包中的指针值 / Read a pointer value from a version 2 pack / Zeigerwert aus einem Paket der Version 2 lesen
+ */
+static const void* v2_pointer(const void* data, int index) {
+    const pt_param_pack_v2_t* pack = (const pt_param_pack_v2_t*)data;
+    const void* pointer = NULL;
+    memcpy(&pointer, &pack->values[index], sizeof(void*));
+    return pointer;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ */
+int main(void) {
+    borrow_test_record_t borrowed_record = { 1, 0.5, "borrowed" };
+    borrow_test_record_t copied_record = { 2, 1.5, "copied" };
+    nxld_param_type_t types[2] = { NXLD_PARAM_TYPE_VOID, NXLD_PARAM_TYPE_VOID };
+    void* values[2] = { &borrowed_record, &copied_record };
+    size_t sizes[2] = { sizeof(borrow_test_record_t), sizeof(borrow_test_record_t) };
+    const int borrowed[2] = { 1, 0 };
+    
+    /* 创建参数包只引用结构体数据 / Creating a pack only references the struct data / Das Erstellen eines Pakets referenziert die Strukturdaten nur */
+    pt_param_pack_t* pack = pt_create_param_pack(2, types, values, sizes);
+    PT_TEST_CHECK(pack != NULL);
+    if (pack == NULL) {
+        return pt_test_finish("pointer_transfer_borrow_test");
+    }
+    PT_TEST_CHECK(pack->params[0].value.ptr_val == (void*)&borrowed_record);
+    
+    /* 借用的参数保留原指针，其余参数指向内存块中的副本 / The borrowed parameter keeps the original pointer, the other points to a copy inside the block / Der ausgeliehene Parameter behält den Originalzeiger, der andere zeigt auf eine Kopie im Block */
+    void* v1_data = pt_serialize_param_pack(pack, borrowed);
+    PT_TEST_CHECK(v1_data != NULL);
+    if (v1_data != NULL) {
+        const pt_param_pack_t* v1 = (const pt_param_pack_t*)v1_data;
+        PT_TEST_CHECK(v1->params[0].value.ptr_val == (void*)&borrowed_record);
+        PT_TEST_CHECK(v1->params[1].value.ptr_val != (void*)&copied_record);
+        PT_TEST_CHECK(memcmp(v1->params[1].value.ptr_val, &copied_record, sizeof(copied_record)) == 0);
+    }
+    
+    void* v2_data = pt_serialize_param_pack_v2(pack, borrowed);
+    PT_TEST_CHECK(v2_data != NULL);
+    if (v2_data != NULL) {
+        PT_TEST_CHECK(v2_pointer(v2_data, 0) == (const void*)&borrowed_record);
+        PT_TEST_CHECK(v2_pointer(v2_data, 1) != (const void*)&copied_record);
+        PT_TEST_CHECK(memcmp(v2_pointer(v2_data, 1), &copied_record, sizeof(copied_record)) == 0);
+    }
+    
+    /* 借用方看到调用方之后的修改，副本不受影响 / The borrower sees later changes by the caller, the copy does not / Der Ausleiher sieht spätere Änderungen des Aufrufers, die Kopie nicht */
+    borrowed_record.weight = 2.5;
+    copied_record.weight = 3.5;
+    if (v1_data != NULL) {
+        const pt_param_pack_t* v1 = (const pt_param_pack_t*)v1_data;
+        PT_TEST_CHECK(((const borrow_test_record_t*)v1->params[0].value.ptr_val)->weight == 2.5);
+        PT_TEST_CHECK(((const borrow_test_record_t*)v1->params[1].value.ptr_val)->weight == 1.5);
+    }
+    
+    /* 借用的结构体不占用内存块空间 / A borrowed struct takes no space in the block / Eine ausgeliehene Struktur belegt keinen Platz im Block */
+    void* copied_data = pt_serialize_param_pack(pack, NULL);
+    PT_TEST_CHECK(copied_data != NULL);
+    if (copied_data != NULL && v1_data != NULL) {
+        const pt_param_pack_t* copied = (const pt_param_pack_t*)copied_data;
+        PT_TEST_CHECK(copied->params[0].value.ptr_val != (void*)&borrowed_record);
+        PT_TEST_CHECK((const uint8_t*)copied->params[1].value.ptr_val - (const uint8_t*)copied_data >
+                      (const uint8_t*)((const pt_param_pack_t*)v1_data)->params[1].value.ptr_val - (const uint8_t*)v1_data);
+    }
+    
+    pt_free_serialized_param_pack(copied_data);
+    pt_free_serialized_param_pack(v1_data);
+    pt_free_serialized_param_pack(v2_data);
+    pt_free_param_pack(pack);
+    
+    /* 规则的Ownership键 / The rule's Ownership key / Der Ownership-Schlüssel der Regel */
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(init_rule_set_lock() == 0);
+    size_t borrow_rule = 0;
+    size_t copy_rule = 0;
+    PT_TEST_CHECK(add_transfer_rule("SourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+                                    "TargetPlugin=B\nTargetInterface=g\nTargetParamIndex=0\nOwnership=borrow\n", &borrow_rule) == 0);
+    PT_TEST_CHECK(add_transfer_rule("SourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+                                    "TargetPlugin=B\nTargetInterface=h\nTargetParamIndex=0\n", &copy_rule) == 0);
+    PT_TEST_CHECK(ctx->rules[borrow_rule].ownership == PARAM_OWNERSHIP_BORROW);
+    PT_TEST_CHECK(ctx->rules[copy_rule].ownership == PARAM_OWNERSHIP_COPY);
+    cleanup_context();
+    
+    return pt_test_finish("pointer_transfer_borrow_test");
+}
@@ -0,0 +1,120 @@
+/**
+ * @file pointer_transfer_chain_load_test.c
+ * @brief 依赖.nxpt文件广度优先链式加载测试 / Breadth-First Chain Loading Test of Dependent .nxpt Files / Test des Kettenladens abhängiger .nxpt-Dateien in Breitensuche
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 依赖图中的插件数量（E没有.nxpt文件） / Plugin count of the dependency graph (E has no .nxpt file) / Anzahl der Plugins im Abhängigkeitsgraphen (E hat keine .nxpt-Datei) */
+#define CHAIN_TEST_PLUGIN_COUNT 5
+
+/* 插件名 / Plugin names / Plugin-Namen */
+static const char* const g_chain_plugins[CHAIN_TEST_PLUGIN_COUNT] = { "A", "B", "C", "D", "E" };
+
+/**
+ * @brief 生成插件文件路径 / Build a plugin file path / Plugin-Dateipfad erzeugen
+ */
+static char* chain_test_path(char* buffer, const char* work_dir, const char* plugin_name, const char* extension) {
+    snprintf(buffer, PT_TEST_PATH_SIZE, "%s/chain_test_%s.%s", work_dir, plugin_name, extension);
+    return buffer;
+}
+
+/**
+ * @brief 追加一条以插件名标记描述的规则 / Append one rule whose description tags the plugins / Eine Regel anhängen, deren Beschreibung die Plugins kennzeichnet
+ */
+static size_t append_chain_rule(char* text, size_t used, size_t size, int index, const char* work_dir,
+                                const char* source, const char* target) {
+    char target_path[PT_TEST_PATH_SIZE];
+    chain_test_path(target_path, work_dir, target, "so");
+    if (used >= size) {
+        return used;
+    }
+    return used + (size_t)snprintf(text + used, size - used,
+                                   "[TransferRule_%d]\nSourcePlugin=%s\nSourceInterface=f\nSourceParamIndex=0\n"
+                                   "TargetPlugin=%s\nTargetPluginPath=%s\nTargetInterface=f\nTargetParamIndex=0\n"
+                                   "Description=%s>%s\n", index, source, target, target_path, source, target);
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    const char* work_dir = argv[1];
+    
+    /* A -> B, A -> C；B -> D, B -> A（环）；C -> D（菱形）；D -> E（无.nxpt） / A -> B, A -> C; B -> D, B -> A (cycle); C -> D (diamond); D -> E (no .nxpt) / A -> B, A -> C; B -> D, B -> A (Zyklus); C -> D (Raute); D -> E (keine .nxpt) */
+    char path[PT_TEST_PATH_SIZE];
+    char text[4 * PT_TEST_PATH_SIZE];
+    size_t used = append_chain_rule(text, 0, sizeof(text), 0, work_dir, "A", "B");
+    used = append_chain_rule(text, used, sizeof(text), 1, work_dir, "A", "C");
+    PT_TEST_CHECK(pt_test_write_file(chain_test_path(path, work_dir, "A", "nxpt"), text) == 0);
+    used = append_chain_rule(text, 0, sizeof(text), 0, work_dir, "B", "D");
+    used = append_chain_rule(text, used, sizeof(text), 1, work_dir, "B", "A");
+    PT_TEST_CHECK(pt_test_write_file(chain_test_path(path, work_dir, "B", "nxpt"), text) == 0);
+    append_chain_rule(text, 0, sizeof(text), 0, work_dir, "C", "D");
+    PT_TEST_CHECK(pt_test_write_file(chain_test_path(path, work_dir, "C", "nxpt"), text) == 0);
+    append_chain_rule(text, 0, sizeof(text), 0, work_dir, "D", "E");
+    PT_TEST_CHECK(pt_test_write_file(chain_test_path(path, work_dir, "D", "nxpt"), text) == 0);
+    for (int i = 0; i < CHAIN_TEST_PLUGIN_COUNT; i++) {
+        remove(chain_test_path(path, work_dir, g_chain_plugins[i], "nxptc"));
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, work_dir, "chain_load_test.nxpt");
+    pt_test_path(compiled_path, work_dir, "chain_load_test.nxptc");
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, "[EntryPlugin]\nDisableInfoLog=1\n") == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    size_t rule_count_before = ctx->rule_count;
+    PT_TEST_CHECK(chain_load_plugin_nxpt("A", chain_test_path(path, work_dir, "A", "so")) == 0);
+    
+    /* 每个文件恰好合并一次：环不会重新加载A，菱形汇合的D只加载一次，缺失的E被跳过 / Every file is merged exactly once: the cycle does not reload A, the diamond's D loads once and the missing E is skipped / Jede Datei wird genau einmal zusammengeführt: Der Zyklus lädt A nicht erneut, D der Raute lädt einmal und das fehlende E wird übersprungen */
+    PT_TEST_CHECK(ctx->rule_count - rule_count_before == 6);
+    PT_TEST_CHECK(is_nxpt_loaded("A") && is_nxpt_loaded("B") && is_nxpt_loaded("C") && is_nxpt_loaded("D"));
+    PT_TEST_CHECK(!is_nxpt_loaded("E"));
+    
+    /* 按层和发现顺序合并：A，然后B、C，然后D / Merged by level in discovery order: A, then B and C, then D / Nach Ebene in Entdeckungsreihenfolge zusammengeführt: A, dann B und C, dann D */
+    static const char* const expected_order[] = { "A>B", "A>C", "B>D", "B>A", "C>D", "D>E" };
+    if (ctx->rule_count - rule_count_before == 6) {
+        for (size_t i = 0; i < 6; i++) {
+            const char* description = ctx->rules[rule_count_before + i].description;
+            PT_TEST_CHECK(description != NULL && strcmp(description, expected_order[i]) == 0);
+        }
+    }
+    
+    /* 已加载的根不再重复加载 / An already loaded root is not loaded again / Eine bereits geladene Wurzel wird nicht erneut geladen */
+    size_t rule_count_loaded = ctx->rule_count;
+    PT_TEST_CHECK(chain_load_plugin_nxpt("A", chain_test_path(path, work_dir, "A", "so")) == 0);
+    PT_TEST_CHECK(ctx->rule_count == rule_count_loaded);
+    
+    cleanup_context();
+    for (int i = 0; i < CHAIN_TEST_PLUGIN_COUNT; i++) {
+        remove(chain_test_path(path, work_dir, g_chain_plugins[i], "nxpt"));
+        remove(chain_test_path(path, work_dir, g_chain_plugins[i], "nxptc"));
+    }
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_chain_load_test");
+}
@@ -0,0 +1,131 @@
+/**
+ * @file pointer_transfer_compiled_rules_test.c
+ * @brief 预编译规则文件(.nxptc)往返测试 / Compiled Rules File (.nxptc) Round Trip Test / Rundreisetest der kompilierten Regeldatei (.nxptc)
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "config/reload/config_reload.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 覆盖所有字符串字段和标志的规则 / Rules covering every string field and flag / Regeln, die alle Zeichenfolgenfelder und Flags abdecken */
+static const char* g_rules_text =
+    "[TransferRule_0]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+    "TargetPlugin=B\nTargetPluginPath=./b.so\nTargetInterface=g\nTargetParamIndex=1\n"
+    "TargetParamValue=10\nDescription=first rule\nCondition=value > 0\nCacheSelf=true\n"
+    "SetGroup=grp\nOwnership=borrow\n"
+    "[TransferRule_1]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+    "TargetPlugin=C\nTargetInterface=h\nTargetParamIndex=0\n"
+    "TransferMode=multicast\nMulticastGroup=mc\nEnabled=false\n";
+
+/**
+ * @brief 比较可为NULL的字符串 / Compare strings that may be NULL / Zeichenfolgen vergleichen, die NULL sein können
+ */
+static int same_string(const char* actual, const char* expected) {
+    if (actual == NULL || expected == NULL) {
+        return actual == expected;
+    }
+    return strcmp(actual, expected) == 0;
+}
+
+/**
+ * @brief 检查规则集与规则文本一致 / Check that the rule set matches the rules text / Prüfen, dass der Regelsatz dem Regeltext entspricht
+ */
+static void check_rules(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(ctx->rule_count == 2);
+    if (ctx->rule_count != 2) {
+        return;
+    }
+    
+    const pointer_transfer_rule_t* first = &ctx->rules[0];
+    PT_TEST_CHECK(same_string(first->source_plugin, "A"));
+    PT_TEST_CHECK(same_string(first->source_interface, "f"));
+    PT_TEST_CHECK(first->source_param_index == 0);
+    PT_TEST_CHECK(same_string(first->target_plugin, "B"));
+    PT_TEST_CHECK(same_string(first->target_plugin_path, "./b.so"));
+    PT_TEST_CHECK(same_string(first->target_interface, "g"));
+    PT_TEST_CHECK(first->target_param_index == 1);
+    PT_TEST_CHECK(same_string(first->target_param_value, "10"));
+    PT_TEST_CHECK(same_string(first->description, "first rule"));
+    PT_TEST_CHECK(same_string(first->condition, "value > 0"));
+    PT_TEST_CHECK(same_string(first->set_group, "grp"));
+    PT_TEST_CHECK(same_string(first->multicast_group, NULL));
+    PT_TEST_CHECK(first->transfer_mode == TRANSFER_MODE_UNICAST);
+    PT_TEST_CHECK(first->enabled == 1);
+    PT_TEST_CHECK(first->cache_self == 1);
+    PT_TEST_CHECK(first->ownership == PARAM_OWNERSHIP_BORROW);
+    
+    const pointer_transfer_rule_t* second = &ctx->rules[1];
+    PT_TEST_CHECK(same_string(second->target_plugin, "C"));
+    PT_TEST_CHECK(same_string(second->target_plugin_path, NULL));
+    PT_TEST_CHECK(same_string(second->target_interface, "h"));
+    PT_TEST_CHECK(same_string(second->multicast_group, "mc"));
+    PT_TEST_CHECK(same_string(second->description, NULL));
+    PT_TEST_CHECK(second->transfer_mode == TRANSFER_MODE_MULTICAST);
+    PT_TEST_CHECK(second->enabled == 0);
+    PT_TEST_CHECK(second->cache_self == 0);
+    PT_TEST_CHECK(second->ownership == PARAM_OWNERSHIP_COPY);
+    
+    /* 索引和规则图由记录重建 / Index and rule graph are rebuilt from the records / Index und Regelgraph werden aus den Datensätzen neu aufgebaut */
+    size_t start_index = 0;
+    size_t end_index = 0;
+    PT_TEST_CHECK(find_rule_index_range("A", "f", 0, &start_index, &end_index) == 1);
+    size_t node_id = find_rule_graph_node("B", "g");
+    PT_TEST_CHECK(node_id != RULE_GRAPH_INVALID_NODE);
+    PT_TEST_CHECK(is_rule_graph_node_memoizable(node_id));
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "compiled_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "compiled_test.nxptc");
+    remove(compiled_path);
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(init_rule_set_lock() == 0);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, g_rules_text) == 0);
+    
+    /* 首次加载解析文本并写出.nxptc / The first load parses the text and writes the .nxptc / Das erste Laden parst den Text und schreibt die .nxptc */
+    PT_TEST_CHECK(load_transfer_rules(rules_path) == 0);
+    PT_TEST_CHECK(ctx->compiled_rule_map_count == 0);
+    check_rules();
+    FILE* compiled_file = fopen(compiled_path, "rb");
+    PT_TEST_CHECK(compiled_file != NULL);
+    if (compiled_file != NULL) {
+        fclose(compiled_file);
+    }
+    cleanup_context();
+    
+    /* 再次加载映射.nxptc，字段保持一致 / The second load maps the .nxptc and every field matches / Das zweite Laden bildet die .nxptc ab und alle Felder stimmen überein */
+    PT_TEST_CHECK(load_transfer_rules(rules_path) == 0);
+    PT_TEST_CHECK(ctx->compiled_rule_map_count > 0);
+    PT_TEST_CHECK(ctx->rule_count > 0 && ctx->rules[0].strings_shared);
+    check_rules();
+    cleanup_context();
+    
+    /* 源文件变化后.nxptc失效并重新解析 / A changed source invalidates the .nxptc and is parsed again / Eine geänderte Quelle macht die .nxptc ungültig und wird neu geparst */
+    PT_TEST_CHECK(pt_test_write_file(rules_path, "[TransferRule_0]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+                                                 "TargetPlugin=D\nTargetInterface=k\nTargetParamIndex=0\n") == 0);
+    PT_TEST_CHECK(load_transfer_rules(rules_path) == 0);
+    PT_TEST_CHECK(ctx->compiled_rule_map_count == 0);
+    PT_TEST_CHECK(ctx->rule_count == 1 && same_string(ctx->rules[0].target_plugin, "D"));
+    cleanup_context();
+    
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_compiled_rules_test");
+}
@@ -0,0 +1,124 @@
+/**
+ * @file pointer_transfer_cycle_test.c
+ * @brief 调用循环检测测试 / Call Cycle Detection Test / Test der Aufrufzykluserkennung
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 测试插件的计数器 / Counters of the test plugin / Zähler des Test-Plugins */
+typedef struct {
+    size_t* scalar_calls;
+    size_t* record_count;
+} cycle_test_counters_t;
+
+/**
+ * @brief 清零计数器 / Reset the counters / Zähler zurücksetzen
+ */
+static void reset_counters(const cycle_test_counters_t* counters) {
+    *counters->scalar_calls = 0;
+    *counters->record_count = 0;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[6 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "cycle_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "cycle_test.nxptc");
+    
+    /* A -> B -> A：Scale的参数传给Record，Record的返回值传回Scale；A -> A：Record的参数传给自己；S.n和S.m从环外进入 / A -> B -> A: Scale's parameter goes to Record, Record's return value goes back to Scale; A -> A: Record's parameter goes to itself; S.n and S.m enter from outside the cycles / A -> B -> A: Der Parameter von Scale geht an Record, der Rückgabewert von Record zurück an Scale; A -> A: Der Parameter von Record geht an sich selbst; S.n und S.m treten von außerhalb der Zyklen ein */
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=TestPlugin\nSourceInterface=Scale\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_2]\nSourcePlugin=TestPlugin\nSourceInterface=Record\nSourceParamIndex=-1\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_3]\nSourcePlugin=TestPlugin\nSourceInterface=Record\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_4]\nSourcePlugin=S\nSourceInterface=m\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2], argv[2], argv[2], argv[2], argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 与调度器共享同一个已加载的测试插件 / Shares the test plugin already loaded by the dispatcher / Teilt das bereits vom Dispatcher geladene Test-Plugin */
+    void* handle = pt_platform_load_library(argv[2]);
+    cycle_test_counters_t counters = {
+        .scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL,
+        .record_count = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_record_count") : NULL
+    };
+    PT_TEST_CHECK(counters.scalar_calls != NULL && counters.record_count != NULL);
+    if (counters.scalar_calls == NULL || counters.record_count == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_cycle_test");
+    }
+    
+    /* 从环外进入：每个接口执行一次，回到Scale的边被拒绝 / Entering from outside: each interface runs once, the edge back to Scale is refused / Eintritt von außen: jede Schnittstelle läuft einmal, die Kante zurück zu Scale wird abgewiesen */
+    reset_counters(&counters);
+    TransferDouble("S", "n", 0, 1.5);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    PT_TEST_CHECK(*counters.record_count == 1);
+    
+    /* Scale自己传递时它已在执行：Record执行一次，不会重新进入Scale / When Scale transfers itself it is already running: Record runs once and Scale is not re-entered / Wenn Scale selbst überträgt, läuft es bereits: Record läuft einmal und Scale wird nicht erneut betreten */
+    reset_counters(&counters);
+    TransferDouble("TestPlugin", "Scale", 0, 2.5);
+    PT_TEST_CHECK(*counters.record_count == 1);
+    PT_TEST_CHECK(*counters.scalar_calls == 0);
+    
+    /* 标记在调用结束后释放，下一次传递行为相同 / Marks are released when the call ends, the next transfer behaves the same / Markierungen werden am Aufrufende freigegeben, die nächste Übertragung verhält sich gleich */
+    reset_counters(&counters);
+    TransferDouble("S", "n", 0, 3.5);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    PT_TEST_CHECK(*counters.record_count == 1);
+    
+    /* A -> A从环外进入：Record执行一次，自环边被拒绝，返回值仍传给Scale / A -> A entered from outside: Record runs once, the self-loop edge is refused and the return value still reaches Scale / A -> A von außen betreten: Record läuft einmal, die Selbstschleife wird abgewiesen und der Rückgabewert erreicht dennoch Scale */
+    reset_counters(&counters);
+    TransferDouble("S", "m", 0, 1.5);
+    PT_TEST_CHECK(*counters.record_count == 1);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    
+    /* Record自己传递时不会重新进入自身 / Record transferring itself never re-enters itself / Record, das sich selbst überträgt, betritt sich nie erneut */
+    reset_counters(&counters);
+    TransferDouble("TestPlugin", "Record", 0, 2.5);
+    PT_TEST_CHECK(*counters.record_count == 0);
+    PT_TEST_CHECK(*counters.scalar_calls == 0);
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_cycle_test");
+}
@@ -0,0 +1,120 @@
+/**
+ * @file pointer_transfer_depth_test.c
+ * @brief 调用深度限制测试 / Call Depth Limit Test / Test der Aufruftiefenbegrenzung
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 插件的计数器 / Counters of the plugins / Zähler der Plugins */
+typedef struct {
+    size_t* scalar_calls;
+    size_t* record_count;
+    double* records;
+    size_t* native_record_count;
+    double* native_record;
+} depth_test_counters_t;
+
+/**
+ * @brief 清零计数器 / Reset the counters / Zähler zurücksetzen
+ */
+static void reset_counters(const depth_test_counters_t* counters) {
+    *counters->scalar_calls = 0;
+    *counters->record_count = 0;
+    *counters->native_record_count = 0;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径，argv[3]为原生测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path, argv[3] the native test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad, argv[3] der Pfad des nativen Test-Plugins)
+ */
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> <native_test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* S.n -> TestPlugin.Scale（深度0） -> NativeTestPlugin.Record（深度1） -> TestPlugin.Record（深度2），MaxCallDepth=1 / S.n -> TestPlugin.Scale (depth 0) -> NativeTestPlugin.Record (depth 1) -> TestPlugin.Record (depth 2), MaxCallDepth=1 / S.n -> TestPlugin.Scale (Tiefe 0) -> NativeTestPlugin.Record (Tiefe 1) -> TestPlugin.Record (Tiefe 2), MaxCallDepth=1 */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[4 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "depth_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "depth_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\nMaxCallDepth=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=TestPlugin\nSourceInterface=Scale\nSourceParamIndex=-1\n"
+             "TargetPlugin=NativeTestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_2]\nSourcePlugin=NativeTestPlugin\nSourceInterface=Record\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2], argv[3], argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 与调度器共享同一个已加载的插件 / Shares the plugins already loaded by the dispatcher / Teilt die bereits vom Dispatcher geladenen Plugins */
+    void* handle = pt_platform_load_library(argv[2]);
+    void* native_handle = pt_platform_load_library(argv[3]);
+    depth_test_counters_t counters = {
+        .scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL,
+        .record_count = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_record_count") : NULL,
+        .records = handle != NULL ? (double*)pt_platform_get_symbol(handle, "test_plugin_records") : NULL,
+        .native_record_count = native_handle != NULL ? (size_t*)pt_platform_get_symbol(native_handle, "native_test_record_count") : NULL,
+        .native_record = native_handle != NULL ? (double*)pt_platform_get_symbol(native_handle, "native_test_record") : NULL
+    };
+    PT_TEST_CHECK(counters.scalar_calls != NULL && counters.record_count != NULL && counters.records != NULL &&
+                  counters.native_record_count != NULL && counters.native_record != NULL);
+    if (counters.scalar_calls == NULL || counters.record_count == NULL || counters.records == NULL ||
+        counters.native_record_count == NULL || counters.native_record == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        if (native_handle != NULL) {
+            pt_platform_close_library(native_handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_depth_test");
+    }
+    
+    /* 深度0和1的调用执行，超过MaxCallDepth的深度2调用被丢弃 / Calls at depth 0 and 1 run, the depth 2 call past MaxCallDepth is dropped / Aufrufe in Tiefe 0 und 1 laufen, der Aufruf in Tiefe 2 jenseits von MaxCallDepth wird verworfen */
+    reset_counters(&counters);
+    TransferDouble("S", "n", 0, 1.5);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    PT_TEST_CHECK(*counters.native_record_count == 1 && *counters.native_record == 3.0);
+    PT_TEST_CHECK(*counters.record_count == 0);
+    
+    /* 限制按帧深度计算而非按接口：从链中间进入时同一接口在深度0执行 / The limit counts frame depth, not interfaces: entering mid-chain runs the same interface at depth 0 / Die Grenze zählt die Rahmentiefe, nicht Schnittstellen: Beim Eintritt mitten in der Kette läuft dieselbe Schnittstelle in Tiefe 0 */
+    reset_counters(&counters);
+    TransferDouble("NativeTestPlugin", "Record", 0, 2.5);
+    PT_TEST_CHECK(*counters.record_count == 1 && counters.records[0] == 2.5);
+    
+    /* 被丢弃的调用不影响后续传递 / A dropped call does not affect later transfers / Ein verworfener Aufruf beeinträchtigt spätere Übertragungen nicht */
+    reset_counters(&counters);
+    TransferDouble("S", "n", 0, 4.0);
+    PT_TEST_CHECK(*counters.scalar_calls == 1);
+    PT_TEST_CHECK(*counters.native_record_count == 1 && *counters.native_record == 8.0);
+    PT_TEST_CHECK(*counters.record_count == 0);
+    
+    pt_platform_close_library(handle);
+    pt_platform_close_library(native_handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_depth_test");
+}
@@ -0,0 +1,111 @@
+/**
+ * @file pointer_transfer_descriptor_test.c
+ * @brief 插件描述符导出测试 / Plugin Descriptor Export Test / Test des Plugin-Deskriptor-Exports
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径，argv[3]为原生测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path, argv[3] the native test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad, argv[3] der Pfad des nativen Test-Plugins)
+ */
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> <native_test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 返回值类型映射：字符串和指针按指针返回，结构体保留大小 / Return type mapping: strings and pointers return as pointers, structs keep their size / Rückgabetyp-Abbildung: Zeichenfolgen und Zeiger als Zeiger, Strukturen behalten ihre Größe */
+    nxld_interface_descriptor_t synthetic;
+    memset(&synthetic, 0, sizeof(synthetic));
+    size_t return_size = 1;
+    synthetic.return_type = NXLD_RETURN_TYPE_INT64;
+    PT_TEST_CHECK(map_descriptor_return_type(&synthetic, &return_size) == PT_RETURN_TYPE_INTEGER && return_size == 0);
+    synthetic.return_type = NXLD_RETURN_TYPE_FLOAT;
+    PT_TEST_CHECK(map_descriptor_return_type(&synthetic, NULL) == PT_RETURN_TYPE_FLOAT);
+    synthetic.return_type = NXLD_RETURN_TYPE_STRING;
+    PT_TEST_CHECK(map_descriptor_return_type(&synthetic, NULL) == PT_RETURN_TYPE_STRUCT_PTR);
+    synthetic.return_type = NXLD_RETURN_TYPE_STRUCT;
+    synthetic.return_size = 24;
+    PT_TEST_CHECK(map_descriptor_return_type(&synthetic, &return_size) == PT_RETURN_TYPE_STRUCT_PTR && return_size == 24);
+    PT_TEST_CHECK(map_descriptor_return_type(NULL, &return_size) == PT_RETURN_TYPE_INTEGER && return_size == 0);
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "descriptor_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "descriptor_test.nxptc");
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, "[EntryPlugin]\nDisableInfoLog=1\n") == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    void* handle = pt_platform_load_library(argv[2]);
+    void* native_handle = pt_platform_load_library(argv[3]);
+    PT_TEST_CHECK(handle != NULL && native_handle != NULL);
+    if (handle == NULL || native_handle == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        if (native_handle != NULL) {
+            pt_platform_close_library(native_handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_descriptor_test");
+    }
+    void* scale = pt_platform_get_symbol(handle, "Scale");
+    void* record = pt_platform_get_symbol(handle, "Record");
+    void* native_record = pt_platform_get_symbol(native_handle, "Record");
+    
+    /* 描述符一次给出接口的全部元数据和插件的调用约定 / The descriptor gives all metadata of an interface and the plugin's calling convention at once / Der Deskriptor liefert alle Metadaten einer Schnittstelle und die Aufrufkonvention des Plugins auf einmal */
+    nxld_call_convention_t call_convention = NXLD_CALL_CONVENTION_NATIVE;
+    const nxld_interface_descriptor_t* descriptor = find_interface_descriptor(handle, "Scale", scale, &call_convention);
+    PT_TEST_CHECK(descriptor != NULL && call_convention == NXLD_CALL_CONVENTION_PACK);
+    if (descriptor != NULL) {
+        PT_TEST_CHECK(strcmp(descriptor->name, "Scale") == 0 && descriptor->func_ptr == scale);
+        PT_TEST_CHECK(descriptor->return_type == NXLD_RETURN_TYPE_DOUBLE);
+        PT_TEST_CHECK(descriptor->param_count_type == NXLD_PARAM_COUNT_FIXED && descriptor->min_param_count == 1);
+        PT_TEST_CHECK(descriptor->param_types != NULL && descriptor->param_types[0] == NXLD_PARAM_TYPE_DOUBLE);
+    }
+    descriptor = find_interface_descriptor(native_handle, "Record", native_record, &call_convention);
+    PT_TEST_CHECK(descriptor != NULL && call_convention == NXLD_CALL_CONVENTION_NATIVE);
+    
+    /* 未列出的接口或与导出不一致的描述符退回到逐项查询 / Unlisted interfaces or descriptors disagreeing with the export fall back to per-item queries / Nicht gelistete Schnittstellen oder dem Export widersprechende Deskriptoren fallen auf Einzelabfragen zurück */
+    PT_TEST_CHECK(find_interface_descriptor(handle, "Scale_Vec", pt_platform_get_symbol(handle, "Scale_Vec"), &call_convention) == NULL);
+    PT_TEST_CHECK(call_convention == NXLD_CALL_CONVENTION_PACK);
+    PT_TEST_CHECK(find_interface_descriptor(handle, "Scale", record, NULL) == NULL);
+    PT_TEST_CHECK(find_interface_descriptor(NULL, "Scale", scale, NULL) == NULL);
+    
+    /* 接口状态从描述符得到返回类型、参数数量和参数类型 / Interface states take return type, parameter count and parameter types from the descriptor / Schnittstellenstatus übernehmen Rückgabetyp, Parameteranzahl und Parametertypen aus dem Deskriptor */
+    target_interface_state_t* state = find_or_create_interface_state("TestPlugin", "Scale", handle, scale);
+    PT_TEST_CHECK(state != NULL);
+    if (state != NULL) {
+        PT_TEST_CHECK(state->return_type == PT_RETURN_TYPE_DOUBLE);
+        PT_TEST_CHECK(state->param_count == 1 && !state->is_variadic);
+        PT_TEST_CHECK(state->param_types != NULL && state->param_types[0] == NXLD_PARAM_TYPE_DOUBLE);
+        PT_TEST_CHECK(state->call_convention == NXLD_CALL_CONVENTION_PACK);
+    }
+    state = find_or_create_interface_state("NativeTestPlugin", "Record", native_handle, native_record);
+    PT_TEST_CHECK(state != NULL && state->call_convention == NXLD_CALL_CONVENTION_NATIVE);
+    PT_TEST_CHECK(state != NULL && state->return_type == PT_RETURN_TYPE_INTEGER && state->param_count == 1);
+    
+    cleanup_context();
+    pt_platform_close_library(handle);
+    pt_platform_close_library(native_handle);
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_descriptor_test");
+}
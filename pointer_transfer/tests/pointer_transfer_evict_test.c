@@ -0,0 +1,118 @@
+/**
+ * @file pointer_transfer_evict_test.c
+ * @brief 插件驻留上限和卸载测试 / Plugin Residency Limit and Unloading Test / Test der Plugin-Residenzgrenze und Entladung
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径，argv[3]为原生测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path, argv[3] the native test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad, argv[3] der Pfad des nativen Test-Plugins)
+ */
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> <native_test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 两个目标插件，最多驻留一个 / Two target plugins, at most one resident / Zwei Ziel-Plugins, höchstens eines resident */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[4 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "evict_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "evict_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\nMaxLoadedPlugins=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=m\nSourceParamIndex=0\n"
+             "TargetPlugin=NativeTestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2], argv[3]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 测试自己的引用使卸载后计数器仍可读 / The test's own references keep the counters readable after unloading / Die eigenen Referenzen des Tests halten die Zähler nach dem Entladen lesbar */
+    void* handle = pt_platform_load_library(argv[2]);
+    void* native_handle = pt_platform_load_library(argv[3]);
+    size_t* scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL;
+    size_t* native_record_count = native_handle != NULL ? (size_t*)pt_platform_get_symbol(native_handle, "native_test_record_count") : NULL;
+    PT_TEST_CHECK(scalar_calls != NULL && native_record_count != NULL);
+    if (scalar_calls == NULL || native_record_count == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        if (native_handle != NULL) {
+            pt_platform_close_library(native_handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_evict_test");
+    }
+    
+    uint64_t loads = 0;
+    uint64_t unloads = 0;
+    size_t resident = 0;
+    
+    /* 首次传递准备目标时加载两个插件，传递结束时的清扫卸载未被调用的那个 / The first transfer loads both plugins while preparing targets, the sweep at its end unloads the one not called / Die erste Übertragung lädt beim Vorbereiten der Ziele beide Plugins, die Bereinigung an ihrem Ende entlädt das nicht aufgerufene */
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 1.5) == 0);
+    PT_TEST_CHECK(*scalar_calls == 1);
+    get_plugin_residency_stats(&loads, &unloads, &resident);
+    PT_TEST_CHECK(loads == 2 && unloads == 1 && resident == 1);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "TestPlugin") != NULL);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "NativeTestPlugin") == NULL);
+    
+    /* 重新加载的插件超出上限，最近最少使用的插件被卸载，其接口状态被解绑 / The reloaded plugin exceeds the limit, the least recently used one is unloaded and its interface states detached / Das neu geladene Plugin überschreitet die Grenze, das am längsten unbenutzte wird entladen und seine Schnittstellenstatus gelöst */
+    PT_TEST_CHECK(TransferDouble("S", "m", 0, 2.5) == 0);
+    PT_TEST_CHECK(*native_record_count == 1);
+    get_plugin_residency_stats(&loads, &unloads, &resident);
+    PT_TEST_CHECK(loads == 3 && unloads == 2 && resident == 1);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "TestPlugin") == NULL);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "NativeTestPlugin") != NULL);
+    target_interface_state_t* state = find_interface_state("TestPlugin", "Scale");
+    PT_TEST_CHECK(state != NULL && state->handle == NULL && state->func_ptr == NULL);
+    
+    /* 下次使用时重新加载并重新绑定 / The next use reloads and rebinds it / Die nächste Verwendung lädt und bindet es erneut */
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 3.5) == 0);
+    PT_TEST_CHECK(*scalar_calls == 2);
+    get_plugin_residency_stats(&loads, &unloads, &resident);
+    PT_TEST_CHECK(loads == 4 && unloads == 3 && resident == 1);
+    plugin_registry_entry_t* entry = find_plugin_registry_entry("TestPlugin");
+    PT_TEST_CHECK(entry != NULL && entry->load_count == 2 && entry->unload_count == 1);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "NativeTestPlugin") == NULL);
+    
+    /* 被固定的插件不被卸载，此时只能卸载刚使用的插件 / A pinned plugin is never unloaded, so the plugin just used is the only candidate / Ein angeheftetes Plugin wird nie entladen, daher ist das gerade verwendete Plugin der einzige Kandidat */
+    PT_TEST_CHECK(TransferDouble("S", "m", 0, 4.5) == 0);
+    PT_TEST_CHECK(*native_record_count == 2);
+    plugin_registry_entry_t* pinned = pin_plugin_registry_entry("NativeTestPlugin");
+    PT_TEST_CHECK(pinned != NULL);
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 5.5) == 0);
+    PT_TEST_CHECK(*scalar_calls == 3);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "NativeTestPlugin") != NULL);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "TestPlugin") == NULL);
+    unpin_plugin_registry_entry(pinned);
+    
+    pt_platform_close_library(handle);
+    pt_platform_close_library(native_handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_evict_test");
+}
@@ -0,0 +1,110 @@
+/**
+ * @file pointer_transfer_hot_swap_test.c
+ * @brief 插件热替换测试 / Plugin Hot Swap Test / Test des Plugin-Hot-Swaps
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[2 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "hot_swap_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "hot_swap_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 测试自己的引用指向原始库，其计数器在替换后不再增加 / The test's own reference points at the original library, whose counter stops growing after the swap / Die eigene Referenz des Tests zeigt auf die ursprüngliche Bibliothek, deren Zähler nach dem Austausch nicht mehr wächst */
+    void* handle = pt_platform_load_library(argv[2]);
+    size_t* scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL;
+    PT_TEST_CHECK(scalar_calls != NULL);
+    if (scalar_calls == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_hot_swap_test");
+    }
+    
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 1.5) == 0);
+    PT_TEST_CHECK(*scalar_calls == 1);
+    plugin_registry_entry_t* entry = find_plugin_registry_entry("TestPlugin");
+    target_interface_state_t* state = find_interface_state("TestPlugin", "Scale");
+    PT_TEST_CHECK(entry != NULL && state != NULL);
+    if (entry == NULL || state == NULL) {
+        pt_platform_close_library(handle);
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_hot_swap_test");
+    }
+    void* old_handle = entry->handle;
+    void* old_func_ptr = state->func_ptr;
+    uint64_t epoch = ctx->plugin_registry.swap_epoch;
+    PT_TEST_CHECK(old_handle == handle && old_func_ptr == pt_platform_get_symbol(handle, "Scale"));
+    
+    /* 替换发布新句柄和函数指针，无进行中调用时旧库立即关闭 / The swap publishes the new handle and function pointer, the old library closes at once without calls in flight / Der Austausch veröffentlicht neues Handle und Funktionszeiger, ohne laufende Aufrufe schließt die alte Bibliothek sofort */
+    PT_TEST_CHECK(ReloadPlugin("TestPlugin") == 0);
+    PT_TEST_CHECK(entry->swap_count == 1);
+    PT_TEST_CHECK(ctx->plugin_registry.swap_epoch == epoch + 1);
+    PT_TEST_CHECK(entry->handle != NULL && entry->handle != old_handle);
+    PT_TEST_CHECK(state->handle == entry->handle);
+    PT_TEST_CHECK(state->func_ptr != NULL && state->func_ptr != old_func_ptr);
+    PT_TEST_CHECK(ctx->plugin_registry.retired_count == 0);
+    
+    /* 之后的调用进入新库 / Later calls go to the new library / Spätere Aufrufe gehen an die neue Bibliothek */
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 2.5) == 0);
+    PT_TEST_CHECK(*scalar_calls == 1);
+    
+    /* 读锁内的请求推迟到调用边界 / A request under the read lock is deferred to the call boundary / Eine Anforderung unter der Lesesperre wird auf die Aufrufgrenze verschoben */
+    void* swapped_handle = entry->handle;
+    acquire_rule_set_read();
+    PT_TEST_CHECK(hot_swap_plugin("TestPlugin") == 0);
+    PT_TEST_CHECK(entry->swap_pending && entry->swap_count == 1 && entry->handle == swapped_handle);
+    release_rule_set_read();
+    apply_pending_plugin_swaps();
+    PT_TEST_CHECK(!entry->swap_pending && ctx->plugin_registry.swaps_pending == 0);
+    PT_TEST_CHECK(entry->swap_count == 2 && entry->handle != swapped_handle);
+    PT_TEST_CHECK(state->handle == entry->handle);
+    PT_TEST_CHECK(TransferDouble("S", "n", 0, 3.5) == 0);
+    
+    /* 未注册的插件无法替换 / An unregistered plugin cannot be swapped / Ein nicht registriertes Plugin kann nicht ausgetauscht werden */
+    PT_TEST_CHECK(ReloadPlugin("NoSuchPlugin") != 0);
+    PT_TEST_CHECK(ReloadPlugin(NULL) != 0);
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_hot_swap_test");
+}
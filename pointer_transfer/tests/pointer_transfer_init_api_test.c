@@ -0,0 +1,85 @@
+/**
+ * @file pointer_transfer_init_api_test.c
+ * @brief 显式和异步初始化接口测试 / Explicit and Asynchronous Initialization API Test / Test der expliziten und asynchronen Initialisierungsschnittstelle
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[2 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "init_api_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "init_api_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    /* 未开始时不就绪；结构体大小不符的选项被拒绝且不开始初始化 / Not ready before starting; options with a wrong structure size are rejected without starting / Vor dem Start nicht bereit; Optionen mit falscher Strukturgröße werden abgelehnt, ohne zu starten */
+    plugin_setup();
+    PT_TEST_CHECK(PointerTransferWaitReady() != 0);
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options) - 1;
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) != 0);
+    PT_TEST_CHECK(PointerTransferInitializeAsync(&options) != 0);
+    PT_TEST_CHECK(PointerTransferWaitReady() != 0);
+    
+    /* 后台加载完成后规则可用 / Rules are usable once background loading is done / Regeln sind nach Abschluss des Hintergrundladens nutzbar */
+    options.struct_size = sizeof(options);
+    PT_TEST_CHECK(PointerTransferInitializeAsync(&options) == 0);
+    PT_TEST_CHECK(PointerTransferWaitReady() == 0);
+    PT_TEST_CHECK(get_plugin_init_result() == 0);
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(ctx->rule_count == 1);
+    
+    /* 重复初始化保持原有选项并返回原结果 / Repeated initialization keeps the original options and returns the original result / Wiederholte Initialisierung behält die ursprünglichen Optionen und liefert das ursprüngliche Ergebnis */
+    pointer_transfer_init_options_t other_options;
+    memset(&other_options, 0, sizeof(other_options));
+    other_options.struct_size = sizeof(other_options);
+    other_options.config_path = compiled_path;
+    PT_TEST_CHECK(PointerTransferInitialize(&other_options) == 0);
+    PT_TEST_CHECK(PointerTransferInitializeAsync(NULL) == 0);
+    PT_TEST_CHECK(PointerTransferInitialize(NULL) == 0);
+    PT_TEST_CHECK(ctx->rule_count == 1);
+    
+    /* 导出接口在就绪后直接调度 / Exported functions dispatch directly once ready / Exportierte Funktionen leiten nach Bereitschaft direkt weiter */
+    void* handle = pt_platform_load_library(argv[2]);
+    size_t* scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL;
+    PT_TEST_CHECK(scalar_calls != NULL);
+    if (scalar_calls != NULL) {
+        size_t calls_before = *scalar_calls;
+        PT_TEST_CHECK(TransferDouble("S", "n", 0, 2.0) == 0);
+        PT_TEST_CHECK(*scalar_calls == calls_before + 1);
+    }
+    
+    if (handle != NULL) {
+        pt_platform_close_library(handle);
+    }
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_init_api_test");
+}
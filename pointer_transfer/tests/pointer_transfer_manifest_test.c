@@ -0,0 +1,112 @@
+/**
+ * @file pointer_transfer_manifest_test.c
+ * @brief 插件目录清单测试 / Plugin Directory Manifest Test / Test des Plugin-Verzeichnismanifests
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "currying/validate/pointer_transfer_currying_validate_db.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 清单中的测试库数量 / Test library count in the manifest / Anzahl der Testbibliotheken im Manifest */
+#define MANIFEST_TEST_LIBRARY_COUNT 4
+
+/* 测试库名（只需扩展名符合平台） / Test library names (only the extension has to match the platform) / Namen der Testbibliotheken (nur die Endung muss zur Plattform passen) */
+#ifdef _WIN32
+static const char* const g_manifest_libraries[MANIFEST_TEST_LIBRARY_COUNT] = {
+    "manifest_test_a.dll", "manifest_test_b.dll", "manifest_test_c.dll", "manifest_test_d.dll"
+};
+#else
+static const char* const g_manifest_libraries[MANIFEST_TEST_LIBRARY_COUNT] = {
+    "manifest_test_a.so", "manifest_test_b.so", "manifest_test_c.so", "manifest_test_d.so"
+};
+#endif
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char note_path[PT_TEST_PATH_SIZE];
+    char paths[MANIFEST_TEST_LIBRARY_COUNT][PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "manifest_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "manifest_test.nxptc");
+    pt_test_path(note_path, argv[1], "manifest_test_note.txt");
+    for (int i = 0; i < MANIFEST_TEST_LIBRARY_COUNT; i++) {
+        pt_test_path(paths[i], argv[1], g_manifest_libraries[i]);
+        remove(paths[i]);
+    }
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, "[EntryPlugin]\nDisableInfoLog=1\n") == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 首次更新扫描目录，只登记动态库 / The first refresh scans the directory and registers only libraries / Die erste Aktualisierung scannt das Verzeichnis und registriert nur Bibliotheken */
+    PT_TEST_CHECK(pt_test_write_file(paths[0], "a") == 0);
+    PT_TEST_CHECK(pt_test_write_file(paths[1], "b") == 0);
+    PT_TEST_CHECK(pt_test_write_file(note_path, "note") == 0);
+    validation_db_t* db = acquire_validation_db(paths[0]);
+    PT_TEST_CHECK(db != NULL);
+    if (db == NULL) {
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_manifest_test");
+    }
+    PT_TEST_CHECK(refresh_plugin_manifest(db) == 0);
+    PT_TEST_CHECK(db->manifest.built);
+    plugin_manifest_entry_t* entry_a = find_plugin_manifest_entry(db, paths[0]);
+    plugin_manifest_entry_t* entry_b = find_plugin_manifest_entry(db, paths[1]);
+    PT_TEST_CHECK(entry_a != NULL && entry_a->present && entry_a->size == 1);
+    PT_TEST_CHECK(entry_b != NULL && entry_b->present);
+    PT_TEST_CHECK(find_plugin_manifest_entry(db, note_path) == NULL);
+    PT_TEST_CHECK(find_plugin_manifest_entry(db, paths[2]) == NULL);
+    if (entry_a != NULL) {
+        entry_a->synced = 1;
+    }
+    
+    /* 之后的更新只处理监视器报告的变化；删除的库保留条目 / Later refreshes only apply changes the watcher reports; deleted libraries keep their entry / Spätere Aktualisierungen übernehmen nur gemeldete Änderungen; gelöschte Bibliotheken behalten ihren Eintrag */
+    PT_TEST_CHECK(pt_test_write_file(paths[0], "aaaa") == 0);
+    PT_TEST_CHECK(remove(paths[1]) == 0);
+    PT_TEST_CHECK(pt_test_write_file(paths[2], "c") == 0);
+    PT_TEST_CHECK(refresh_plugin_manifest(db) == 0);
+    entry_a = find_plugin_manifest_entry(db, paths[0]);
+    entry_b = find_plugin_manifest_entry(db, paths[1]);
+    plugin_manifest_entry_t* entry_c = find_plugin_manifest_entry(db, paths[2]);
+    PT_TEST_CHECK(entry_a != NULL && entry_a->present && entry_a->size == 4 && !entry_a->synced);
+    PT_TEST_CHECK(entry_b != NULL && !entry_b->present);
+    PT_TEST_CHECK(entry_c != NULL && entry_c->present && entry_c->size == 1);
+    
+    /* 达到上限后新库不进入清单 / New libraries stay out of the manifest once the limit is reached / Neue Bibliotheken bleiben nach Erreichen der Grenze außerhalb des Manifests */
+    size_t count = db->manifest.count;
+    db->manifest.max_entries = count;
+    PT_TEST_CHECK(pt_test_write_file(paths[3], "d") == 0);
+    PT_TEST_CHECK(refresh_plugin_manifest(db) == 0);
+    PT_TEST_CHECK(find_plugin_manifest_entry(db, paths[3]) == NULL);
+    PT_TEST_CHECK(db->manifest.count == count && db->manifest.limit_reported);
+    release_validation_db(db);
+    
+    cleanup_context();
+    for (int i = 0; i < MANIFEST_TEST_LIBRARY_COUNT; i++) {
+        remove(paths[i]);
+    }
+    remove(note_path);
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_manifest_test");
+}
@@ -0,0 +1,87 @@
+/**
+ * @file pointer_transfer_memo_test.c
+ * @brief 记忆化缓存命中与过期测试 / Memoization Cache Hit and Expiry Test / Test für Treffer und Ablauf des Memoisierungs-Caches
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_platform.h"
+#include "config/reload/config_reload.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* 条目存活时间（毫秒） / Entry time-to-live (ms) / Eintragslebensdauer (ms) */
+#define MEMO_TEST_TTL_MS 40
+
+/**
+ * @brief 查找整数结果 / Look up an integer result / Ganzzahlergebnis suchen
+ */
+static int lookup_int(uint64_t hash_key, size_t node_id, const char* key, int64_t* result_out) {
+    pt_return_type_t return_type = PT_RETURN_TYPE_INTEGER;
+    double result_float = 0.0;
+    void* value = NULL;
+    size_t value_size = 0;
+    int result = memo_cache_lookup(hash_key, node_id, (const unsigned char*)key, strlen(key),
+                                   &return_type, result_out, &result_float, &value, &value_size);
+    free(value);
+    return result;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ */
+int main(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(init_rule_set_lock() == 0);
+    ctx->memo_cache.ttl_ms = MEMO_TEST_TTL_MS;
+    
+    /* CacheSelf声明目标接口为纯接口 / CacheSelf declares the target interface pure / CacheSelf deklariert die Zielschnittstelle als rein */
+    size_t rule_index = 0;
+    PT_TEST_CHECK(add_transfer_rule("SourcePlugin=Src\nSourceInterface=Emit\nSourceParamIndex=0\n"
+                                    "TargetPlugin=Math\nTargetInterface=Square\nTargetParamIndex=0\nCacheSelf=true\n",
+                                    &rule_index) == 0);
+    size_t node_id = find_rule_graph_node("Math", "Square");
+    PT_TEST_CHECK(node_id != RULE_GRAPH_INVALID_NODE);
+    PT_TEST_CHECK(is_rule_graph_node_memoizable(node_id));
+    PT_TEST_CHECK(ensure_memo_cache() == 0);
+    PT_TEST_CHECK(ctx->memo_cache.shards != NULL);
+    
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t expirations = 0;
+    size_t entries = 0;
+    int64_t result = 0;
+    
+    /* 未存储时未命中，存储后命中 / Miss before store, hit after store / Fehltreffer vor dem Speichern, Treffer danach */
+    PT_TEST_CHECK(lookup_int(7, node_id, "x=7", &result) != 0);
+    PT_TEST_CHECK(memo_cache_store(7, node_id, (const unsigned char*)"x=7", 3, PT_RETURN_TYPE_INTEGER, 49, 0.0, NULL, 0) == 0);
+    PT_TEST_CHECK(lookup_int(7, node_id, "x=7", &result) == 0);
+    PT_TEST_CHECK(result == 49);
+    
+    /* 哈希相同但键不同时不得命中 / Same hash with a different key must not hit / Gleicher Hash mit anderem Schlüssel darf nicht treffen */
+    PT_TEST_CHECK(lookup_int(7, node_id, "x=8", &result) != 0);
+    
+    get_memo_cache_stats(&hits, &misses, &evictions, &expirations, &entries);
+    PT_TEST_CHECK(hits == 1);
+    PT_TEST_CHECK(misses == 2);
+    PT_TEST_CHECK(entries == 1);
+    
+    /* 超过TTL后条目过期 / Entry expires after the TTL / Eintrag läuft nach der TTL ab */
+    pt_platform_sleep_ms(MEMO_TEST_TTL_MS * 2);
+    PT_TEST_CHECK(lookup_int(7, node_id, "x=7", &result) != 0);
+    get_memo_cache_stats(&hits, &misses, &evictions, &expirations, &entries);
+    PT_TEST_CHECK(expirations == 1);
+    PT_TEST_CHECK(entries == 0);
+    
+    /* 移除唯一声明纯接口的规则后条目被丢弃 / Entries are dropped once the only rule declaring the interface pure is removed / Einträge werden verworfen, sobald die einzige Regel entfernt ist, die die Schnittstelle als rein deklariert */
+    PT_TEST_CHECK(memo_cache_store(9, node_id, (const unsigned char*)"x=9", 3, PT_RETURN_TYPE_INTEGER, 81, 0.0, NULL, 0) == 0);
+    PT_TEST_CHECK(remove_transfer_rule(rule_index) == 0);
+    PT_TEST_CHECK(!is_rule_graph_node_memoizable(node_id));
+    PT_TEST_CHECK(lookup_int(9, node_id, "x=9", &result) != 0);
+    
+    cleanup_context();
+    return pt_test_finish("pointer_transfer_memo_test");
+}
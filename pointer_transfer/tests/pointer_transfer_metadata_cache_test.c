@@ -0,0 +1,121 @@
+/**
+ * @file pointer_transfer_metadata_cache_test.c
+ * @brief 验证数据库中的插件元数据缓存测试 / Plugin Metadata Cache in the Validation Database Test / Test des Plugin-Metadaten-Caches in der Validierungsdatenbank
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 插件副本放在工作目录，缓存写入工作目录的数据库 / The plugin copy lives in the work directory, so the cache goes to that directory's database / Die Plugin-Kopie liegt im Arbeitsverzeichnis, daher geht der Cache in dessen Datenbank */
+    char plugin_path[PT_TEST_PATH_SIZE];
+    char db_path[PT_TEST_PATH_SIZE];
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+#ifdef _WIN32
+    pt_test_path(plugin_path, argv[1], "metadata_cache_test.dll");
+#else
+    pt_test_path(plugin_path, argv[1], "metadata_cache_test.so");
+#endif
+    pt_test_path(db_path, argv[1], "plugins.nxpvdb");
+    pt_test_path(rules_path, argv[1], "metadata_cache_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "metadata_cache_test.nxptc");
+    remove(db_path);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_platform_copy_file(argv[2], plugin_path) == 0);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, "[EntryPlugin]\nDisableInfoLog=1\n") == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 两个插件名指向同一库文件，各自持有一个引用 / Two plugin names point at the same library file, each holding one reference / Zwei Plugin-Namen zeigen auf dieselbe Bibliotheksdatei, jeder hält eine Referenz */
+    void* handle = pt_platform_load_library(plugin_path);
+    void* warm_handle = pt_platform_load_library(plugin_path);
+    PT_TEST_CHECK(handle != NULL && warm_handle != NULL);
+    if (handle == NULL || warm_handle == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        if (warm_handle != NULL) {
+            pt_platform_close_library(warm_handle);
+        }
+        cleanup_context();
+        remove(plugin_path);
+        return pt_test_finish("pointer_transfer_metadata_cache_test");
+    }
+    PT_TEST_CHECK(register_loaded_plugin(ctx, "MetaPlugin", plugin_path, handle) == 0);
+    PT_TEST_CHECK(register_loaded_plugin(ctx, "MetaPluginWarm", plugin_path, warm_handle) == 0);
+    
+    /* 关闭缓存时不写入元数据 / Nothing is written while the cache is off / Bei deaktiviertem Cache wird nichts geschrieben */
+    pt_cached_metadata_t cached;
+    ctx->disable_metadata_cache = 1;
+    PT_TEST_CHECK(find_or_create_interface_state("MetaPlugin", "Record", handle, pt_platform_get_symbol(handle, "Record")) != NULL);
+    PT_TEST_CHECK(pt_load_cached_metadata(plugin_path, "Record", &cached) != 0);
+    ctx->disable_metadata_cache = 0;
+    
+    /* 冷启动从插件读取元数据并写入缓存 / A cold start reads the metadata from the plugin and caches it / Ein Kaltstart liest die Metadaten aus dem Plugin und speichert sie zwischen */
+    PT_TEST_CHECK(find_or_create_interface_state("MetaPlugin", "Scale", handle, pt_platform_get_symbol(handle, "Scale")) != NULL);
+    memset(&cached, 0, sizeof(cached));
+    PT_TEST_CHECK(pt_load_cached_metadata(plugin_path, "Scale", &cached) == 0);
+    PT_TEST_CHECK(cached.return_type == PT_RETURN_TYPE_DOUBLE && cached.native_return_type == NXLD_RETURN_TYPE_DOUBLE);
+    PT_TEST_CHECK(cached.param_count_type == NXLD_PARAM_COUNT_FIXED && cached.min_count == 1 && cached.max_count == 1);
+    PT_TEST_CHECK(cached.param_type_count == 1 && cached.param_types != NULL && cached.param_types[0] == NXLD_PARAM_TYPE_DOUBLE);
+    PT_TEST_CHECK(cached.call_convention == NXLD_CALL_CONVENTION_PACK);
+    free(cached.param_types);
+    
+    /* 热启动优先使用缓存：写入与描述符不同的记录后，新状态采用缓存的值 / A warm start prefers the cache: after storing a record that differs from the descriptor, a new state takes the cached values / Ein Warmstart bevorzugt den Cache: nach Speichern eines vom Deskriptor abweichenden Datensatzes übernimmt ein neuer Status die gecachten Werte */
+    nxld_param_type_t warm_types[1] = { NXLD_PARAM_TYPE_INT64 };
+    pt_cached_metadata_t warm = {
+        .interface_index = 1,
+        .return_type = PT_RETURN_TYPE_DOUBLE,
+        .return_size = 0,
+        .param_count_type = NXLD_PARAM_COUNT_FIXED,
+        .min_count = 1,
+        .max_count = 1,
+        .param_types = warm_types,
+        .param_type_count = 1,
+        .call_convention = NXLD_CALL_CONVENTION_PACK,
+        .native_return_type = NXLD_RETURN_TYPE_DOUBLE
+    };
+    PT_TEST_CHECK(pt_record_cached_metadata(plugin_path, "Record", &warm) == 0);
+    target_interface_state_t* state = find_or_create_interface_state("MetaPluginWarm", "Record", warm_handle,
+                                                                     pt_platform_get_symbol(warm_handle, "Record"));
+    PT_TEST_CHECK(state != NULL);
+    if (state != NULL) {
+        PT_TEST_CHECK(state->return_type == PT_RETURN_TYPE_DOUBLE);
+        PT_TEST_CHECK(state->param_count == 1 && state->param_types != NULL && state->param_types[0] == NXLD_PARAM_TYPE_INT64);
+    }
+    
+    /* 注册表关闭两个引用 / The registry closes both references / Die Registry schließt beide Referenzen */
+    cleanup_context();
+    remove(plugin_path);
+    remove(db_path);
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_metadata_cache_test");
+}
@@ -0,0 +1,120 @@
+/**
+ * @file pointer_transfer_native_test.c
+ * @brief 原生调用约定往返测试 / Native Calling Convention Round-Trip Test / Rundlauftest der nativen Aufrufkonvention
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* 与原生测试插件中的定义相同 / Same definition as in the native test plugin / Gleiche Definition wie im nativen Test-Plugin */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    double weight;
+} native_test_point_t;
+
+/**
+ * @brief 读取原生测试插件导出的变量 / Read a variable exported by the native test plugin / Vom nativen Test-Plugin exportierte Variable lesen
+ */
+static void* native_symbol(void* handle, const char* name) {
+    void* symbol = handle != NULL ? pt_platform_get_symbol(handle, name) : NULL;
+    PT_TEST_CHECK(symbol != NULL);
+    return symbol;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[3]为原生测试插件路径） / Arguments (argv[1] is the work directory, argv[3] the native test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[3] der Pfad des nativen Test-Plugins)
+ */
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> <native_test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* S.mix[0..8] -> NativeTestPlugin.Mix，返回值 -> NativeTestPlugin.Record / S.mix[0..8] -> NativeTestPlugin.Mix, return value -> NativeTestPlugin.Record / S.mix[0..8] -> NativeTestPlugin.Mix, Rückgabewert -> NativeTestPlugin.Record */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[12 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "native_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "native_test.nxptc");
+    size_t used = (size_t)snprintf(rules_text, sizeof(rules_text), "[EntryPlugin]\nDisableInfoLog=1\n");
+    for (int i = 0; i < 9 && used < sizeof(rules_text); i++) {
+        used += (size_t)snprintf(rules_text + used, sizeof(rules_text) - used,
+                                 "[TransferRule_%d]\nSourcePlugin=S\nSourceInterface=mix\nSourceParamIndex=%d\n"
+                                 "TargetPlugin=NativeTestPlugin\nTargetPluginPath=%s\nTargetInterface=Mix\nTargetParamIndex=%d\n"
+                                 "TransferMode=Broadcast\n", i, i, argv[3], i);
+    }
+    if (used < sizeof(rules_text)) {
+        snprintf(rules_text + used, sizeof(rules_text) - used,
+                 "[TransferRule_9]\nSourcePlugin=NativeTestPlugin\nSourceInterface=Mix\nSourceParamIndex=-1\n"
+                 "TargetPlugin=NativeTestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+                 "TransferMode=Broadcast\n", argv[3]);
+    }
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 与调度器共享同一个已加载的原生测试插件 / Shares the native test plugin already loaded by the dispatcher / Teilt das bereits vom Dispatcher geladene native Test-Plugin */
+    void* handle = pt_platform_load_library(argv[3]);
+    PT_TEST_CHECK(handle != NULL);
+    size_t* mix_calls = (size_t*)native_symbol(handle, "native_test_mix_calls");
+    size_t* record_count = (size_t*)native_symbol(handle, "native_test_record_count");
+    if (mix_calls == NULL || record_count == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_native_test");
+    }
+    
+    /* 整数、浮点和结构体指针交错，第七个整数类参数经栈传递 / Integers, floats and a struct pointer interleave, the seventh integer-class argument goes through the stack / Ganzzahlen, Gleitkommazahlen und ein Strukturzeiger wechseln sich ab, das siebte Argument der Ganzzahlklasse geht über den Stack */
+    native_test_point_t point = { 3, 4, 0.5 };
+    PT_TEST_CHECK(TransferInt64("S", "mix", 0, -7) == 0);
+    PT_TEST_CHECK(TransferDouble("S", "mix", 1, 0.75) == 0);
+    PT_TEST_CHECK(TransferPointer("S", "mix", 2, &point, NXLD_PARAM_TYPE_POINTER, "native_test_point_t", sizeof(point)) == 0);
+    PT_TEST_CHECK(TransferInt64("S", "mix", 3, INT64_C(5000000000)) == 0);
+    PT_TEST_CHECK(TransferDouble("S", "mix", 4, -2.25) == 0);
+    PT_TEST_CHECK(TransferInt64("S", "mix", 5, 11) == 0);
+    PT_TEST_CHECK(TransferInt64("S", "mix", 6, -40) == 0);
+    PT_TEST_CHECK(TransferInt64("S", "mix", 7, 'A') == 0);
+    PT_TEST_CHECK(TransferInt64("S", "mix", 8, 123456789) == 0);
+    PT_TEST_CHECK(*mix_calls >= 1);
+    
+    /* 每个参数按声明的C类型原样到达 / Every argument arrives unchanged as its declared C type / Jedes Argument kommt unverändert als sein deklarierter C-Typ an */
+    PT_TEST_CHECK(*(int32_t*)native_symbol(handle, "native_test_count") == -7);
+    PT_TEST_CHECK(*(float*)native_symbol(handle, "native_test_ratio") == 0.75f);
+    const native_test_point_t* received_point = (const native_test_point_t*)native_symbol(handle, "native_test_point");
+    PT_TEST_CHECK(received_point != NULL && received_point->x == 3 && received_point->y == 4 && received_point->weight == 0.5);
+    PT_TEST_CHECK(*(int64_t*)native_symbol(handle, "native_test_offset") == INT64_C(5000000000));
+    PT_TEST_CHECK(*(double*)native_symbol(handle, "native_test_scale") == -2.25);
+    PT_TEST_CHECK(*(int32_t*)native_symbol(handle, "native_test_delta") == 11);
+    PT_TEST_CHECK(*(int64_t*)native_symbol(handle, "native_test_base") == -40);
+    PT_TEST_CHECK(*(char*)native_symbol(handle, "native_test_tag") == 'A');
+    PT_TEST_CHECK(*(int64_t*)native_symbol(handle, "native_test_stack_value") == 123456789);
+    
+    /* double返回值经返回值规则原生传给Record / The double return value is passed natively to Record through the return value rule / Der double-Rückgabewert wird über die Rückgaberegel nativ an Record übergeben */
+    double expected = -7.0 * 0.75 + 7.0 * 0.5 + 5000000000.0 - 2.25 + 11.0 - 40.0 + 65.0 + 123456789.0;
+    PT_TEST_CHECK(*record_count >= 1);
+    PT_TEST_CHECK(*(double*)native_symbol(handle, "native_test_record") == expected);
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_native_test");
+}
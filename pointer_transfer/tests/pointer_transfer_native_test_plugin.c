@@ -0,0 +1,231 @@
+/**
+ * @file pointer_transfer_native_test_plugin.c
+ * @brief 原生调用约定的行为测试插件 / Plugin for behavior tests of the native calling convention / Plugin für Verhaltenstests der nativen Aufrufkonvention
+ */
+
+#include "nxld_plugin_interface.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PLUGIN_NAME "NativeTestPlugin"
+#define PLUGIN_VERSION "1.0.0"
+#define INTERFACE_COUNT 2
+#define MIX_PARAM_COUNT 9
+
+/* 通过指针传递的结构体，测试中有相同的定义 / Struct passed by pointer, the test has the same definition / Per Zeiger übergebene Struktur, der Test hat dieselbe Definition */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    double weight;
+} native_test_point_t;
+
+/* Mix最近一次收到的参数，测试逐个检查 / Arguments Mix received last, checked one by one by the test / Zuletzt von Mix empfangene Argumente, vom Test einzeln geprüft */
+NXLD_PLUGIN_EXPORT size_t native_test_mix_calls = 0;
+NXLD_PLUGIN_EXPORT int32_t native_test_count = 0;
+NXLD_PLUGIN_EXPORT float native_test_ratio = 0.0f;
+NXLD_PLUGIN_EXPORT native_test_point_t native_test_point = { 0, 0, 0.0 };
+NXLD_PLUGIN_EXPORT int64_t native_test_offset = 0;
+NXLD_PLUGIN_EXPORT double native_test_scale = 0.0;
+NXLD_PLUGIN_EXPORT int32_t native_test_delta = 0;
+NXLD_PLUGIN_EXPORT int64_t native_test_base = 0;
+NXLD_PLUGIN_EXPORT char native_test_tag = 0;
+NXLD_PLUGIN_EXPORT int64_t native_test_stack_value = 0;
+
+/* Record收到的返回值 / Return values received by Record / Von Record empfangene Rückgabewerte */
+NXLD_PLUGIN_EXPORT size_t native_test_record_count = 0;
+NXLD_PLUGIN_EXPORT double native_test_record = 0.0;
+
+/**
+ * @brief 复制字符串到缓冲区 / Copy a string into a buffer / Zeichenfolge in einen Puffer kopieren
+ */
+static void copy_text(char* buffer, size_t buffer_size, const char* text) {
+    if (buffer == NULL || buffer_size == 0) {
+        return;
+    }
+    size_t len = strlen(text);
+    if (len >= buffer_size) {
+        len = buffer_size - 1;
+    }
+    memcpy(buffer, text, len);
+    buffer[len] = '\0';
+}
+
+/**
+ * @brief 混合整数、浮点和结构体指针参数 / Mix integer, floating-point and struct pointer arguments / Ganzzahl-, Gleitkomma- und Strukturzeigerargumente mischen
+ * @details 七个整数类参数使最后一个经栈传递 / Seven integer-class arguments push the last one onto the stack / Sieben Argumente der Ganzzahlklasse legen das letzte auf den Stack
+ * @return 所有参数的加权和 / Weighted sum of all arguments / Gewichtete Summe aller Argumente
+ */
+NXLD_PLUGIN_EXPORT double NXLD_PLUGIN_CALL Mix(int32_t count, float ratio, const native_test_point_t* point, int64_t offset,
+                                              double scale, int32_t delta, int64_t base, char tag, int64_t stack_value) {
+    native_test_mix_calls++;
+    native_test_count = count;
+    native_test_ratio = ratio;
+    if (point != NULL) {
+        native_test_point = *point;
+    }
+    native_test_offset = offset;
+    native_test_scale = scale;
+    native_test_delta = delta;
+    native_test_base = base;
+    native_test_tag = tag;
+    native_test_stack_value = stack_value;
+    
+    double point_value = point != NULL ? (double)(point->x + point->y) * point->weight : 0.0;
+    return (double)count * (double)ratio + point_value + (double)offset + scale +
+           (double)delta + (double)base + (double)tag + (double)stack_value;
+}
+
+/**
+ * @brief 记录传入的值 / Record the value passed in / Übergebenen Wert aufzeichnen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL Record(double value) {
+    native_test_record = value;
+    native_test_record_count++;
+    return 0;
+}
+
+/* 参数类型和名称 / Parameter types and names / Parametertypen und -namen */
+static const nxld_param_type_t mix_param_types[MIX_PARAM_COUNT] = {
+    NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_FLOAT, NXLD_PARAM_TYPE_POINTER, NXLD_PARAM_TYPE_INT64, NXLD_PARAM_TYPE_DOUBLE,
+    NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_INT64, NXLD_PARAM_TYPE_CHAR, NXLD_PARAM_TYPE_INT64
+};
+static const char* const mix_param_names[MIX_PARAM_COUNT] = {
+    "count", "ratio", "point", "offset", "scale", "delta", "base", "tag", "stack_value"
+};
+static const char* const mix_type_names[MIX_PARAM_COUNT] = {
+    "int32_t", "float", "native_test_point_t*", "int64_t", "double", "int32_t", "int64_t", "char", "int64_t"
+};
+static const nxld_param_type_t record_param_types[] = { NXLD_PARAM_TYPE_DOUBLE };
+static const char* const record_param_names[] = { "value" };
+static const char* const record_type_names[] = { "double" };
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "Mix",
+        "Weighted sum of mixed arguments, returns double",
+        "1.0.0",
+        (void*)Mix,
+        NXLD_RETURN_TYPE_DOUBLE,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        MIX_PARAM_COUNT,
+        MIX_PARAM_COUNT,
+        mix_param_types
+    },
+    {
+        "Record",
+        "Record the value, returns int32",
+        "1.0.0",
+        (void*)Record,
+        NXLD_RETURN_TYPE_INT32,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        1,
+        1,
+        record_param_types
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_NATIVE
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}
+
+/* 逐项查询函数（静态验证要求导出），均由描述符表回答 / Per-item query functions (static validation requires them), all answered from the descriptor table / Einzelabfragefunktionen (von der statischen Validierung verlangt), alle aus der Deskriptortabelle beantwortet */
+
+/**
+ * @brief 获取插件名称 / Get plugin name / Plugin-Namen abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_name(char* name, size_t name_size) {
+    if (name == NULL || name_size == 0) {
+        return -1;
+    }
+    copy_text(name, name_size, PLUGIN_NAME);
+    return 0;
+}
+
+/**
+ * @brief 获取插件版本 / Get plugin version / Plugin-Version abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_version(char* version, size_t version_size) {
+    if (version == NULL || version_size == 0) {
+        return -1;
+    }
+    copy_text(version, version_size, PLUGIN_VERSION);
+    return 0;
+}
+
+/**
+ * @brief 获取接口数量 / Get interface count / Schnittstellenanzahl abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_count(size_t* count) {
+    if (count == NULL) {
+        return -1;
+    }
+    *count = INTERFACE_COUNT;
+    return 0;
+}
+
+/**
+ * @brief 获取接口信息 / Get interface information / Schnittstelleninformationen abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_info(size_t index,
+                                                        char* name, size_t name_size,
+                                                        char* description, size_t desc_size,
+                                                        char* version, size_t version_size) {
+    if (index >= INTERFACE_COUNT) {
+        return -1;
+    }
+    copy_text(name, name_size, interface_descriptors[index].name);
+    copy_text(description, desc_size, interface_descriptors[index].description);
+    copy_text(version, version_size, interface_descriptors[index].version);
+    return 0;
+}
+
+/**
+ * @brief 获取接口参数数量 / Get interface parameter count / Schnittstellenparameteranzahl abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_count(size_t index,
+                                                               nxld_param_count_type_t* count_type,
+                                                               int32_t* min_count, int32_t* max_count) {
+    if (index >= INTERFACE_COUNT || count_type == NULL || min_count == NULL || max_count == NULL) {
+        return -1;
+    }
+    *count_type = interface_descriptors[index].param_count_type;
+    *min_count = interface_descriptors[index].min_param_count;
+    *max_count = interface_descriptors[index].max_param_count;
+    return 0;
+}
+
+/**
+ * @brief 获取接口参数信息 / Get interface parameter information / Schnittstellenparameterinformationen abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_info(size_t index, int32_t param_index,
+                                                              char* param_name, size_t name_size,
+                                                              nxld_param_type_t* param_type,
+                                                              char* type_name, size_t type_name_size) {
+    if (index >= INTERFACE_COUNT || param_index < 0 || param_index >= interface_descriptors[index].max_param_count ||
+        param_name == NULL || name_size == 0 || param_type == NULL) {
+        return -1;
+    }
+    const char* const* names = index == 0 ? mix_param_names : record_param_names;
+    const char* const* type_names = index == 0 ? mix_type_names : record_type_names;
+    copy_text(param_name, name_size, names[param_index]);
+    *param_type = interface_descriptors[index].param_types[param_index];
+    copy_text(type_name, type_name_size, type_names[param_index]);
+    return 0;
+}
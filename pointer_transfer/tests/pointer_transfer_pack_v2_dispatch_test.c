@@ -0,0 +1,91 @@
+/**
+ * @file pointer_transfer_pack_v2_dispatch_test.c
+ * @brief 版本2参数包调度测试（加法插件） / Version 2 Parameter Pack Dispatch Test (Addition Plugin) / Dispatch-Test für Parameterpakete der Version 2 (Additions-Plugin)
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径，argv[4]为加法插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path, argv[4] the addition plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad, argv[4] der Pfad des Additions-Plugins)
+ */
+int main(int argc, char** argv) {
+    if (argc < 5) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> <native_test_plugin> <add_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* S.add[0..1] -> AddPlugin.Add -> TestPlugin.Record */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[4 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "pack_v2_dispatch_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "pack_v2_dispatch_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=add\nSourceParamIndex=0\n"
+             "TargetPlugin=AddPlugin\nTargetPluginPath=%s\nTargetInterface=Add\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=add\nSourceParamIndex=1\n"
+             "TargetPlugin=AddPlugin\nTargetPluginPath=%s\nTargetInterface=Add\nTargetParamIndex=1\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_2]\nSourcePlugin=AddPlugin\nSourceInterface=Add\nSourceParamIndex=-1\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[4], argv[4], argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 与调度器共享同一个已加载的测试插件 / Shares the test plugin already loaded by the dispatcher / Teilt das bereits vom Dispatcher geladene Test-Plugin */
+    void* handle = pt_platform_load_library(argv[2]);
+    size_t* record_count = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_record_count") : NULL;
+    double* records = handle != NULL ? (double*)pt_platform_get_symbol(handle, "test_plugin_records") : NULL;
+    PT_TEST_CHECK(record_count != NULL && records != NULL);
+    if (record_count == NULL || records == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_pack_v2_dispatch_test");
+    }
+    *record_count = 0;
+    
+    /* 两个参数经版本2参数包到达Add，和传给Record；ANY参数按大小读取，因此使用64位整数 / Both arguments reach Add through a version 2 pack and the sum goes to Record; ANY parameters are read by size, so 64-bit integers are used / Beide Argumente erreichen Add über ein Paket der Version 2 und die Summe geht an Record; ANY-Parameter werden nach Größe gelesen, daher werden 64-Bit-Ganzzahlen verwendet */
+    PT_TEST_CHECK(TransferInt64("S", "add", 0, 3) == 0);
+    PT_TEST_CHECK(TransferInt64("S", "add", 1, 4) == 0);
+    PT_TEST_CHECK(*record_count == 1 && records[0] == 7.0);
+    
+    /* 加法插件导出的版本被采用 / The version exported by the addition plugin is adopted / Die vom Additions-Plugin exportierte Version wird übernommen */
+    acquire_rule_set_read();
+    const target_interface_state_t* state = find_interface_state("AddPlugin", "Add");
+    PT_TEST_CHECK(state != NULL && state->pack_version == NXLD_PACK_VERSION_2);
+    release_rule_set_read();
+    
+    /* 调用后参数重新等待，第二次调用使用两个新值 / Parameters wait again after a call, the second call uses two new values / Parameter warten nach einem Aufruf erneut, der zweite Aufruf verwendet zwei neue Werte */
+    TransferInt64("S", "add", 0, -10);
+    PT_TEST_CHECK(*record_count == 1);
+    PT_TEST_CHECK(TransferInt64("S", "add", 1, 2) == 0);
+    PT_TEST_CHECK(*record_count == 2 && records[1] == -8.0);
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_pack_v2_dispatch_test");
+}
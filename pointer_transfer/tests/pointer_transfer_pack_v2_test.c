@@ -0,0 +1,102 @@
+/**
+ * @file pointer_transfer_pack_v2_test.c
+ * @brief 版本2参数包(SoA)序列化测试 / Version 2 Parameter Pack (SoA) Serialization Test / Serialisierungstest für Parameterpakete der Version 2 (SoA)
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_currying.h"
+#include <stdint.h>
+#include <string.h>
+
+/* 按值传递的结构体参数 / Struct parameter passed by value / Als Wert übergebener Strukturparameter */
+typedef struct {
+    double x;
+    double y;
+    double z;
+} pack_test_vector_t;
+
+/**
+ * @brief 读取版本2参数值槽 / Read a version 2 parameter value slot / Wert-Slot eines Pakets der Version 2 lesen
+ */
+static pt_curried_param_t read_v2_slot(const pt_param_pack_v2_t* pack, int index) {
+    pt_curried_param_t param;
+    memset(&param, 0, sizeof(param));
+    param.type = (nxld_param_type_t)pack->types[index];
+    param.size = pack->sizes != NULL ? pack->sizes[index] : 0;
+    memcpy(&param.value, &pack->values[index], sizeof(uint64_t));
+    return param;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ */
+int main(void) {
+    int32_t count_value = 7;
+    double scale_value = 2.5;
+    char flag_value = 'x';
+    pack_test_vector_t vector_value = { 1.0, 2.0, 3.0 };
+    nxld_param_type_t types[4] = { NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_DOUBLE, NXLD_PARAM_TYPE_CHAR, NXLD_PARAM_TYPE_VOID };
+    void* values[4] = { &count_value, &scale_value, &flag_value, &vector_value };
+    size_t sizes[4] = { sizeof(int32_t), sizeof(double), sizeof(char), sizeof(pack_test_vector_t) };
+    pt_param_pack_t* pack = pt_create_param_pack(4, types, values, sizes);
+    PT_TEST_CHECK(pack != NULL);
+    if (pack == NULL) {
+        return pt_test_finish("pointer_transfer_pack_v2_test");
+    }
+    
+    void* v1_data = pt_serialize_param_pack(pack, NULL);
+    void* v2_data = pt_serialize_param_pack_v2(pack, NULL);
+    PT_TEST_CHECK(v1_data != NULL && v2_data != NULL);
+    if (v1_data != NULL && v2_data != NULL) {
+        const pt_param_pack_t* v1 = (const pt_param_pack_t*)v1_data;
+        const pt_param_pack_v2_t* v2 = (const pt_param_pack_v2_t*)v2_data;
+        
+        /* 头部标识版本2，版本1的首字段仍是参数数量 / The header tags version 2, the first field of version 1 stays the count / Der Kopf kennzeichnet Version 2, das erste Feld der Version 1 bleibt die Anzahl */
+        PT_TEST_CHECK(v2->magic == PT_PARAM_PACK_V2_MAGIC);
+        PT_TEST_CHECK(v2->param_count == 4);
+        PT_TEST_CHECK(v1->param_count == 4);
+        PT_TEST_CHECK(((uintptr_t)v2->values & 7u) == 0);
+        
+        /* 结构体大小不是自然大小，因此带大小数组 / The struct size is not a natural size, so the sizes array is present / Die Strukturgröße ist keine natürliche Größe, daher ist das Größen-Array vorhanden */
+        PT_TEST_CHECK(v2->sizes != NULL);
+        
+        /* 两种布局的类型、大小和标量值一致 / Types, sizes and scalar values agree between both layouts / Typen, Größen und Skalarwerte stimmen in beiden Layouts überein */
+        for (int i = 0; i < 4; i++) {
+            pt_curried_param_t slot = read_v2_slot(v2, i);
+            PT_TEST_CHECK(slot.type == v1->params[i].type);
+            PT_TEST_CHECK(slot.size == v1->params[i].size);
+        }
+        PT_TEST_CHECK(read_v2_slot(v2, 0).value.int32_val == 7);
+        PT_TEST_CHECK(read_v2_slot(v2, 1).value.double_val == 2.5);
+        PT_TEST_CHECK(read_v2_slot(v2, 2).value.char_val == 'x');
+        PT_TEST_CHECK(v1->params[0].value.int32_val == 7);
+        PT_TEST_CHECK(v1->params[1].value.double_val == 2.5);
+        
+        /* 未借用的结构体被复制到内存块中，版本2的副本8字节对齐 / An unborrowed struct is copied into the block, the version 2 copy is 8-byte aligned / Eine nicht ausgeliehene Struktur wird in den Block kopiert, die Kopie der Version 2 ist 8-Byte-ausgerichtet */
+        const void* v2_struct = read_v2_slot(v2, 3).value.ptr_val;
+        const void* v1_struct = v1->params[3].value.ptr_val;
+        PT_TEST_CHECK(v2_struct != (const void*)&vector_value && v1_struct != (const void*)&vector_value);
+        PT_TEST_CHECK(((uintptr_t)v2_struct & 7u) == 0);
+        PT_TEST_CHECK(memcmp(v2_struct, &vector_value, sizeof(vector_value)) == 0);
+        PT_TEST_CHECK(memcmp(v1_struct, &vector_value, sizeof(vector_value)) == 0);
+    }
+    pt_free_serialized_param_pack(v1_data);
+    pt_free_serialized_param_pack(v2_data);
+    pt_free_param_pack(pack);
+    
+    /* 全部为自然大小时省略大小数组 / The sizes array is omitted when every size is natural / Das Größen-Array entfällt, wenn alle Größen natürlich sind */
+    pack = pt_create_param_pack(2, types, values, sizes);
+    PT_TEST_CHECK(pack != NULL);
+    v2_data = pack != NULL ? pt_serialize_param_pack_v2(pack, NULL) : NULL;
+    PT_TEST_CHECK(v2_data != NULL);
+    if (v2_data != NULL) {
+        const pt_param_pack_v2_t* v2 = (const pt_param_pack_v2_t*)v2_data;
+        PT_TEST_CHECK(v2->param_count == 2);
+        PT_TEST_CHECK(v2->sizes == NULL);
+        PT_TEST_CHECK(read_v2_slot(v2, 1).value.double_val == 2.5);
+    }
+    pt_free_serialized_param_pack(v2_data);
+    pt_free_param_pack(pack);
+    
+    return pt_test_finish("pointer_transfer_pack_v2_test");
+}
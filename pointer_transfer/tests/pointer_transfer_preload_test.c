@@ -0,0 +1,104 @@
+/**
+ * @file pointer_transfer_preload_test.c
+ * @brief 后台插件预加载和就绪屏障测试 / Background Plugin Preload and Readiness Barrier Test / Test des Hintergrund-Vorladens und der Bereitschaftsbarriere
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径，argv[3]为原生测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path, argv[3] the native test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad, argv[3] der Pfad des nativen Test-Plugins)
+ */
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin> <native_test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 入口配置开启Preload，入口规则引用两个插件和一个不存在的插件 / The entry config enables Preload, the entry rules reference two plugins and one that does not exist / Die Einstiegskonfiguration aktiviert Preload, die Einstiegsregeln verweisen auf zwei Plugins und eines, das nicht existiert */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char entry_path[PT_TEST_PATH_SIZE];
+    char entry_compiled_path[PT_TEST_PATH_SIZE];
+    char missing_path[PT_TEST_PATH_SIZE];
+    char rules_text[2 * PT_TEST_PATH_SIZE];
+    char entry_text[6 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "preload_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "preload_test.nxptc");
+    pt_test_path(entry_path, argv[1], "preload_test_entry.nxpt");
+    pt_test_path(entry_compiled_path, argv[1], "preload_test_entry.nxptc");
+    pt_test_path(missing_path, argv[1], "preload_test_missing.so");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nPluginName=PreloadEntry\nNxptPath=%s\nDisableInfoLog=1\nPreload=true\nPreloadBindNow=true\n",
+             entry_path);
+    snprintf(entry_text, sizeof(entry_text),
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=m\nSourceParamIndex=0\n"
+             "TargetPlugin=NativeTestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_2]\nSourcePlugin=S\nSourceInterface=x\nSourceParamIndex=0\n"
+             "TargetPlugin=MissingPlugin\nTargetPluginPath=%s\nTargetInterface=f\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2], argv[3], missing_path);
+    remove(compiled_path);
+    remove(entry_compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    PT_TEST_CHECK(pt_test_write_file(entry_path, entry_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 屏障之后目标插件已加载、接口已解析，尚未调用任何接口 / After the barrier the target plugins are loaded and their interfaces resolved, no interface has been called yet / Nach der Barriere sind die Ziel-Plugins geladen und ihre Schnittstellen aufgelöst, noch keine Schnittstelle wurde aufgerufen */
+    wait_for_plugin_preload();
+    wait_for_plugin_preload();
+    pointer_transfer_context_t* ctx = get_global_context();
+    void* preloaded = find_loaded_plugin(ctx, "TestPlugin");
+    PT_TEST_CHECK(preloaded != NULL);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "NativeTestPlugin") != NULL);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "MissingPlugin") == NULL);
+    
+    target_interface_state_t* state = find_interface_state("TestPlugin", "Scale");
+    PT_TEST_CHECK(state != NULL);
+    void* handle = pt_platform_load_library(argv[2]);
+    PT_TEST_CHECK(handle != NULL);
+    size_t* scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL;
+    PT_TEST_CHECK(scalar_calls != NULL);
+    if (state != NULL && handle != NULL) {
+        PT_TEST_CHECK(state->handle == preloaded);
+        PT_TEST_CHECK(state->func_ptr != NULL && state->func_ptr == pt_platform_get_symbol(handle, "Scale"));
+    }
+    PT_TEST_CHECK(find_interface_state("NativeTestPlugin", "Record") != NULL);
+    
+    /* 预加载的接口直接可用 / A preloaded interface is usable right away / Eine vorgeladene Schnittstelle ist sofort nutzbar */
+    if (scalar_calls != NULL) {
+        PT_TEST_CHECK(*scalar_calls == 0);
+        PT_TEST_CHECK(TransferDouble("S", "n", 0, 1.5) == 0);
+        PT_TEST_CHECK(*scalar_calls == 1);
+        PT_TEST_CHECK(find_loaded_plugin(ctx, "TestPlugin") == preloaded);
+    }
+    
+    if (handle != NULL) {
+        pt_platform_close_library(handle);
+    }
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    remove(entry_path);
+    remove(entry_compiled_path);
+    return pt_test_finish("pointer_transfer_preload_test");
+}
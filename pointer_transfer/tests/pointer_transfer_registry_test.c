@@ -0,0 +1,105 @@
+/**
+ * @file pointer_transfer_registry_test.c
+ * @brief 哈希插件注册表测试 / Hashed Plugin Registry Test / Test der gehashten Plugin-Registry
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 超过初始容量的插件数量 / Plugin count beyond the initial capacity / Plugin-Anzahl über der Anfangskapazität */
+#define REGISTRY_TEST_PLUGIN_COUNT 200
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "registry_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "registry_test.nxptc");
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, "[EntryPlugin]\nDisableInfoLog=1\n") == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    pointer_transfer_context_t* ctx = get_global_context();
+    
+    /* 槽位表扩展后条目地址不变，按名称仍能找到 / Entry addresses stay put when the slot table grows and names still resolve / Eintragsadressen bleiben beim Wachsen der Slot-Tabelle gleich und Namen werden weiterhin aufgelöst */
+    static plugin_registry_entry_t* entries[REGISTRY_TEST_PLUGIN_COUNT];
+    char name[32];
+    for (int i = 0; i < REGISTRY_TEST_PLUGIN_COUNT; i++) {
+        snprintf(name, sizeof(name), "RegistryPlugin%d", i);
+        entries[i] = get_or_create_plugin_registry_entry(name);
+        PT_TEST_CHECK(entries[i] != NULL);
+    }
+    size_t mismatches = 0;
+    for (int i = 0; i < REGISTRY_TEST_PLUGIN_COUNT; i++) {
+        snprintf(name, sizeof(name), "RegistryPlugin%d", i);
+        if (find_plugin_registry_entry(name) != entries[i] || get_or_create_plugin_registry_entry(name) != entries[i] ||
+            entries[i] == NULL || strcmp(entries[i]->plugin_name, name) != 0) {
+            mismatches++;
+        }
+    }
+    PT_TEST_CHECK(mismatches == 0);
+    PT_TEST_CHECK(ctx->plugin_registry.count == REGISTRY_TEST_PLUGIN_COUNT);
+    PT_TEST_CHECK(ctx->plugin_registry.slot_count >= 2 * ctx->plugin_registry.count);
+    PT_TEST_CHECK(find_plugin_registry_entry("RegistryPlugin") == NULL);
+    PT_TEST_CHECK(find_loaded_plugin(ctx, "RegistryPlugin0") == NULL);
+    
+    /* 注册的句柄、缓存的路径和.nxpt状态在同一条目中 / The registered handle, the cached path and the .nxpt state share one entry / Registriertes Handle, gecachter Pfad und .nxpt-Status teilen einen Eintrag */
+    void* handle = pt_platform_load_library(argv[2]);
+    PT_TEST_CHECK(handle != NULL);
+    if (handle != NULL) {
+        PT_TEST_CHECK(register_loaded_plugin(ctx, "TestPlugin", argv[2], handle) == 0);
+        PT_TEST_CHECK(find_loaded_plugin(ctx, "TestPlugin") == handle);
+        char cached_path[PT_TEST_PATH_SIZE];
+        PT_TEST_CHECK(get_plugin_path_cached("TestPlugin", cached_path, sizeof(cached_path)) == 0 &&
+                      strcmp(cached_path, argv[2]) == 0);
+        PT_TEST_CHECK(!is_nxpt_loaded("TestPlugin"));
+        PT_TEST_CHECK(mark_nxpt_loaded("TestPlugin", "test_plugin.nxpt") == 0);
+        PT_TEST_CHECK(is_nxpt_loaded("TestPlugin"));
+        plugin_registry_entry_t* entry = find_plugin_registry_entry("TestPlugin");
+        PT_TEST_CHECK(entry != NULL && entry->handle == handle && entry->nxpt_loaded);
+        
+        /* 符号解析一次后从条目缓存返回 / A symbol is resolved once and then served from the entry cache / Ein Symbol wird einmal aufgelöst und dann aus dem Eintragscache geliefert */
+        if (entry != NULL) {
+            void* scale = resolve_plugin_registry_symbol(entry, "Scale");
+            PT_TEST_CHECK(scale != NULL && scale == pt_platform_get_symbol(handle, "Scale"));
+            size_t symbol_count = entry->symbol_count;
+            PT_TEST_CHECK(resolve_plugin_registry_symbol(entry, "Scale") == scale);
+            PT_TEST_CHECK(entry->symbol_count == symbol_count);
+            PT_TEST_CHECK(resolve_plugin_registry_symbol(entry, "NoSuchSymbol") == NULL);
+            PT_TEST_CHECK(entry->symbol_count == symbol_count);
+        }
+    }
+    
+    /* 名称和路径在注册表内存区中只存一份 / Names and paths are stored once in the registry arena / Namen und Pfade werden einmal in der Registry-Arena gespeichert */
+    const char* interned = intern_plugin_registry_string(argv[2]);
+    PT_TEST_CHECK(interned != NULL && interned == intern_plugin_registry_string(argv[2]));
+    PT_TEST_CHECK(interned == get_or_create_plugin_registry_entry("TestPlugin")->plugin_path);
+    
+    /* 注册表关闭已注册的库 / The registry closes the registered library / Die Registry schließt die registrierte Bibliothek */
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_registry_test");
+}
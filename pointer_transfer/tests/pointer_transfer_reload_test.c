@@ -0,0 +1,87 @@
+/**
+ * @file pointer_transfer_reload_test.c
+ * @brief 规则重载测试（失败时保留旧规则集） / Rules Reload Test (old rule set kept on failure) / Regel-Neuladetest (alter Regelsatz bleibt bei Fehler erhalten)
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "config/reload/config_reload.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 两条规则 / Two rules / Zwei Regeln */
+static const char* g_two_rules =
+    "[TransferRule_0]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+    "TargetPlugin=B\nTargetInterface=g\nTargetParamIndex=0\n"
+    "[TransferRule_1]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+    "TargetPlugin=B\nTargetInterface=h\nTargetParamIndex=0\n";
+
+/* 三条规则 / Three rules / Drei Regeln */
+static const char* g_three_rules =
+    "[TransferRule_0]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+    "TargetPlugin=B\nTargetInterface=g\nTargetParamIndex=0\n"
+    "[TransferRule_1]\nSourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+    "TargetPlugin=B\nTargetInterface=h\nTargetParamIndex=0\n"
+    "[TransferRule_2]\nSourcePlugin=B\nSourceInterface=g\nSourceParamIndex=-1\n"
+    "TargetPlugin=C\nTargetInterface=k\nTargetParamIndex=0\n";
+
+/**
+ * @brief 检查规则集是否为三条规则的版本 / Check that the rule set is the three-rule version / Prüfen, dass der Regelsatz die Version mit drei Regeln ist
+ */
+static void check_three_rules(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(ctx->rule_count == 3);
+    if (ctx->rule_count != 3) {
+        return;
+    }
+    
+    PT_TEST_CHECK(ctx->rules[2].target_interface != NULL && strcmp(ctx->rules[2].target_interface, "k") == 0);
+    
+    size_t start_index = 0;
+    size_t end_index = 0;
+    PT_TEST_CHECK(find_rule_index_range("A", "f", 0, &start_index, &end_index) == 1);
+    PT_TEST_CHECK(find_rule_index_range("B", "g", -1, &start_index, &end_index) == 1);
+    PT_TEST_CHECK(start_index == 2);
+    PT_TEST_CHECK(find_rule_graph_node("C", "k") != RULE_GRAPH_INVALID_NODE);
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "reload_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "reload_test.nxptc");
+    remove(compiled_path);
+    
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(init_rule_set_lock() == 0);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, g_two_rules) == 0);
+    PT_TEST_CHECK(load_transfer_rules(rules_path) == 0);
+    PT_TEST_CHECK(ctx->rule_count == 2);
+    
+    /* 成功的重载替换规则集 / A successful reload replaces the rule set / Ein erfolgreiches Neuladen ersetzt den Regelsatz */
+    PT_TEST_CHECK(pt_test_write_file(rules_path, g_three_rules) == 0);
+    PT_TEST_CHECK(reload_transfer_rules() == 0);
+    check_three_rules();
+    
+    /* 规则文件无法读取时重载失败，旧规则集保持可用 / Reload fails when the rules file cannot be read, the old rule set stays usable / Neuladen schlägt fehl, wenn die Regeldatei nicht lesbar ist, der alte Regelsatz bleibt nutzbar */
+    PT_TEST_CHECK(remove(rules_path) == 0);
+    remove(compiled_path);
+    PT_TEST_CHECK(reload_transfer_rules() != 0);
+    check_three_rules();
+    
+    cleanup_context();
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_reload_test");
+}
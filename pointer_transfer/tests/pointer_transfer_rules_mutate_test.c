@@ -0,0 +1,82 @@
+/**
+ * @file pointer_transfer_rules_mutate_test.c
+ * @brief 运行时添加和移除规则测试 / Runtime Rule Add and Remove Test / Test für das Hinzufügen und Entfernen von Regeln zur Laufzeit
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_config.h"
+#include "config/reload/config_reload.h"
+
+/**
+ * @brief 检查源接口是否有索引项 / Check whether a source interface has index entries / Prüfen, ob eine Quellschnittstelle Indexeinträge hat
+ */
+static int is_source_indexed(const char* plugin_name, const char* interface_name, int param_index) {
+    size_t start_index = 0;
+    size_t end_index = 0;
+    return find_rule_index_range(plugin_name, interface_name, param_index, &start_index, &end_index);
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ */
+int main(void) {
+    pointer_transfer_context_t* ctx = get_global_context();
+    PT_TEST_CHECK(init_rule_set_lock() == 0);
+    
+    /* A.f -> B.g -> C.k 链 / A.f -> B.g -> C.k chain / Kette A.f -> B.g -> C.k */
+    size_t first_rule = 0;
+    size_t second_rule = 0;
+    PT_TEST_CHECK(add_transfer_rule("SourcePlugin=A\nSourceInterface=f\nSourceParamIndex=0\n"
+                                    "TargetPlugin=B\nTargetInterface=g\nTargetParamIndex=0\n", &first_rule) == 0);
+    PT_TEST_CHECK(add_transfer_rule("SourcePlugin=B\nSourceInterface=g\nSourceParamIndex=-1\n"
+                                    "TargetPlugin=C\nTargetInterface=k\nTargetParamIndex=0\n", &second_rule) == 0);
+    PT_TEST_CHECK(ctx->rule_count == 2);
+    PT_TEST_CHECK(is_source_indexed("A", "f", 0));
+    PT_TEST_CHECK(is_source_indexed("B", "g", -1));
+    
+    size_t node_g = find_rule_graph_node("B", "g");
+    size_t node_k = find_rule_graph_node("C", "k");
+    PT_TEST_CHECK(node_g != RULE_GRAPH_INVALID_NODE && node_k != RULE_GRAPH_INVALID_NODE);
+    PT_TEST_CHECK(get_rule_target_graph_node(&ctx->rules[second_rule]) == node_k);
+    PT_TEST_CHECK(get_rule_graph_node_rank(node_g) < get_rule_graph_node_rank(node_k));
+    PT_TEST_CHECK(!is_rule_graph_node_cyclic(node_g));
+    
+    /* C.k -> B.g 形成环 / C.k -> B.g closes a cycle / C.k -> B.g schließt einen Zyklus */
+    size_t back_rule = 0;
+    PT_TEST_CHECK(add_transfer_rule("SourcePlugin=C\nSourceInterface=k\nSourceParamIndex=-1\n"
+                                    "TargetPlugin=B\nTargetInterface=g\nTargetParamIndex=1\n", &back_rule) == 0);
+    PT_TEST_CHECK(is_rule_graph_node_cyclic(node_g));
+    PT_TEST_CHECK(is_rule_graph_node_cyclic(node_k));
+    
+    /* 移除回边后环消失，拓扑序恢复 / Removing the back edge breaks the cycle and restores the order / Entfernen der Rückkante löst den Zyklus auf und stellt die Ordnung wieder her */
+    PT_TEST_CHECK(remove_transfer_rule(back_rule) == 0);
+    PT_TEST_CHECK(!is_rule_graph_node_cyclic(node_g));
+    PT_TEST_CHECK(!is_rule_graph_node_cyclic(node_k));
+    PT_TEST_CHECK(get_rule_graph_node_rank(node_g) < get_rule_graph_node_rank(node_k));
+    PT_TEST_CHECK(!is_source_indexed("C", "k", -1));
+    
+    /* 已移除的规则不能再次移除 / A removed rule cannot be removed again / Eine entfernte Regel kann nicht erneut entfernt werden */
+    PT_TEST_CHECK(remove_transfer_rule(back_rule) != 0);
+    
+    /* 禁用的规则不被查找到，重新启用后恢复 / A disabled rule is skipped by lookup and found again once re-enabled / Eine deaktivierte Regel wird bei der Suche übersprungen und nach erneuter Aktivierung wieder gefunden */
+    PT_TEST_CHECK(set_transfer_rule_enabled(first_rule, 0) == 0);
+    PT_TEST_CHECK(!ctx->rules[first_rule].enabled);
+    PT_TEST_CHECK(!is_source_indexed("A", "f", 0));
+    PT_TEST_CHECK(set_transfer_rule_enabled(first_rule, 1) == 0);
+    PT_TEST_CHECK(is_source_indexed("A", "f", 0));
+    
+    /* 移除后索引项被删除 / Removing drops the index entry / Entfernen verwirft den Indexeintrag */
+    PT_TEST_CHECK(remove_transfer_rule(first_rule) == 0);
+    PT_TEST_CHECK(!is_source_indexed("A", "f", 0));
+    PT_TEST_CHECK(is_source_indexed("B", "g", -1));
+    
+    /* 缺少必需键的规则被拒绝 / A rule missing required keys is rejected / Eine Regel ohne erforderliche Schlüssel wird abgelehnt */
+    size_t rule_count = ctx->rule_count;
+    size_t rejected_rule = 0;
+    PT_TEST_CHECK(add_transfer_rule("SourceInterface=f\nTargetInterface=g\n", &rejected_rule) != 0);
+    PT_TEST_CHECK(ctx->rule_count == rule_count);
+    
+    cleanup_context();
+    return pt_test_finish("pointer_transfer_rules_mutate_test");
+}
@@ -0,0 +1,98 @@
+/**
+ * @file pointer_transfer_string_arena_test.c
+ * @brief 配置字符串去重内存区测试 / Deduplicating Configuration String Arena Test / Test der deduplizierenden Konfigurations-Zeichenfolgen-Arena
+ */
+
+#include "pointer_transfer_test.h"
+#include "config/arena/config_string_arena.h"
+#include "config/rules/config_rules_loader.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 超过初始槽位数的不同字符串数量 / Distinct string count beyond the initial slot count / Anzahl verschiedener Zeichenfolgen über der anfänglichen Slot-Anzahl */
+#define ARENA_TEST_STRING_COUNT 1000
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    
+    config_string_arena_t* arena = create_config_string_arena();
+    PT_TEST_CHECK(arena != NULL);
+    if (arena == NULL) {
+        return pt_test_finish("pointer_transfer_string_arena_test");
+    }
+    
+    /* 相同内容返回同一指针，输入无需NUL结尾 / Equal contents return the same pointer and input need not be NUL-terminated / Gleiche Inhalte liefern denselben Zeiger, die Eingabe muss nicht NUL-terminiert sein */
+    const char* source = "plugin.so;plugin";
+    char* first = intern_config_string(arena, source, 9);
+    char* second = intern_config_string(arena, "plugin.so", 9);
+    char* other = intern_config_string(arena, source + 10, 6);
+    PT_TEST_CHECK(first != NULL && strcmp(first, "plugin.so") == 0);
+    PT_TEST_CHECK(first == second);
+    PT_TEST_CHECK(other != NULL && other != first && strcmp(other, "plugin") == 0);
+    char* empty = intern_config_string(arena, "", 0);
+    PT_TEST_CHECK(empty != NULL && empty[0] == '\0' && intern_config_string(arena, NULL, 0) == empty);
+    PT_TEST_CHECK(arena->request_count == 5 && arena->unique_count == 3);
+    PT_TEST_CHECK(arena->bytes_used == 10 + 7 + 1);
+    
+    /* 去重表扩展后已驻留的字符串仍然命中 / Interned strings still hit after the table grows / Internierte Zeichenfolgen treffen nach dem Tabellenwachstum weiterhin */
+    static char* interned[ARENA_TEST_STRING_COUNT];
+    char text[32];
+    for (int i = 0; i < ARENA_TEST_STRING_COUNT; i++) {
+        int length = snprintf(text, sizeof(text), "interface_%d", i);
+        interned[i] = intern_config_string(arena, text, (size_t)length);
+    }
+    size_t unique_after_fill = arena->unique_count;
+    PT_TEST_CHECK(unique_after_fill == 3 + ARENA_TEST_STRING_COUNT);
+    PT_TEST_CHECK(arena->slot_capacity > unique_after_fill);
+    size_t mismatches = 0;
+    for (int i = 0; i < ARENA_TEST_STRING_COUNT; i++) {
+        int length = snprintf(text, sizeof(text), "interface_%d", i);
+        char* again = intern_config_string(arena, text, (size_t)length);
+        if (again == NULL || again != interned[i] || strcmp(again, text) != 0) {
+            mismatches++;
+        }
+    }
+    PT_TEST_CHECK(mismatches == 0);
+    PT_TEST_CHECK(arena->unique_count == unique_after_fill);
+    
+    /* 超过块大小的字符串单独成块 / A string larger than the chunk size gets a chunk of its own / Eine Zeichenfolge größer als die Blockgröße erhält einen eigenen Block */
+    static char large[CONFIG_STRING_ARENA_CHUNK_SIZE + 100];
+    memset(large, 'x', sizeof(large) - 1);
+    large[sizeof(large) - 1] = '\0';
+    char* large_interned = intern_config_string(arena, large, sizeof(large) - 1);
+    PT_TEST_CHECK(large_interned != NULL && strcmp(large_interned, large) == 0);
+    PT_TEST_CHECK(arena->chunks != NULL && arena->chunks->size == sizeof(large));
+    PT_TEST_CHECK(strcmp(first, "plugin.so") == 0 && strcmp(interned[0], "interface_0") == 0);
+    destroy_config_string_arena(arena);
+    
+    /* 解析的规则共享重复的插件名和路径 / Parsed rules share repeated plugin names and paths / Geparste Regeln teilen wiederholte Plugin-Namen und -Pfade */
+    char rules_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "string_arena_test.nxpt");
+    PT_TEST_CHECK(pt_test_write_file(rules_path,
+                                     "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+                                     "TargetPlugin=T\nTargetPluginPath=./t.so\nTargetInterface=f\nTargetParamIndex=0\n"
+                                     "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=m\nSourceParamIndex=0\n"
+                                     "TargetPlugin=T\nTargetPluginPath=./t.so\nTargetInterface=g\nTargetParamIndex=0\n") == 0);
+    parsed_rules_file_t parsed;
+    PT_TEST_CHECK(parse_transfer_rules_file(rules_path, &parsed) == 0);
+    PT_TEST_CHECK(parsed.rule_count == 2 && parsed.strings != NULL);
+    if (parsed.rule_count == 2 && parsed.strings != NULL) {
+        PT_TEST_CHECK(parsed.rules[0].source_plugin == parsed.rules[1].source_plugin);
+        PT_TEST_CHECK(parsed.rules[0].target_plugin == parsed.rules[1].target_plugin);
+        PT_TEST_CHECK(parsed.rules[0].target_plugin_path == parsed.rules[1].target_plugin_path);
+        PT_TEST_CHECK(parsed.rules[0].target_interface != parsed.rules[1].target_interface);
+        PT_TEST_CHECK(parsed.strings->unique_count < parsed.strings->request_count);
+    }
+    free_parsed_rules_file(&parsed);
+    
+    remove(rules_path);
+    return pt_test_finish("pointer_transfer_string_arena_test");
+}
@@ -0,0 +1,84 @@
+/**
+ * @file pointer_transfer_test.h
+ * @brief 行为测试辅助宏和函数 / Behavior Test Helper Macros and Functions / Hilfsmakros und -funktionen für Verhaltenstests
+ */
+
+#ifndef POINTER_TRANSFER_TEST_H
+#define POINTER_TRANSFER_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+    
+/* 测试路径缓冲区大小 / Test path buffer size / Puffergröße für Testpfade */
+#define PT_TEST_PATH_SIZE 1024
+    
+/* 失败检查数量 / Failed check count / Anzahl fehlgeschlagener Prüfungen */
+static int g_pt_test_failures = 0;
+    
+/**
+ * @brief 检查条件，失败时记录位置并继续 / Check a condition, record the location on failure and continue / Bedingung prüfen, bei Fehler Stelle protokollieren und fortfahren
+ */
+#define PT_TEST_CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            g_pt_test_failures++; \
+        } \
+    } while (0)
+    
+/**
+ * @brief 拼接测试工作目录和文件名 / Join test work directory and file name / Testarbeitsverzeichnis und Dateinamen verbinden
+ * @param buffer 输出缓冲区（PT_TEST_PATH_SIZE字节） / Output buffer (PT_TEST_PATH_SIZE bytes) / Ausgabepuffer (PT_TEST_PATH_SIZE Bytes)
+ * @param work_dir 工作目录 / Work directory / Arbeitsverzeichnis
+ * @param file_name 文件名 / File name / Dateiname
+ * @return 缓冲区 / Buffer / Puffer
+ */
+static inline char* pt_test_path(char* buffer, const char* work_dir, const char* file_name) {
+    snprintf(buffer, PT_TEST_PATH_SIZE, "%s/%s", work_dir, file_name);
+    return buffer;
+}
+    
+/**
+ * @brief 写入文本文件（覆盖） / Write a text file (overwrites) / Textdatei schreiben (überschreibt)
+ * @param path 文件路径 / File path / Dateipfad
+ * @param text 文件内容 / File contents / Dateiinhalt
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+static inline int pt_test_write_file(const char* path, const char* text) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return -1;
+    }
+    size_t length = strlen(text);
+    int result = fwrite(text, 1, length, file) == length ? 0 : -1;
+    if (fclose(file) != 0) {
+        result = -1;
+    }
+    return result;
+}
+    
+/**
+ * @brief 输出测试结论 / Print test verdict / Testergebnis ausgeben
+ * @param test_name 测试名称 / Test name / Testname
+ * @return 进程退出码，全部通过返回0 / Process exit code, 0 if all checks passed / Prozess-Exitcode, 0 wenn alle Prüfungen bestanden
+ */
+static inline int pt_test_finish(const char* test_name) {
+    if (g_pt_test_failures != 0) {
+        fprintf(stderr, "%s: %d checks failed\n", test_name, g_pt_test_failures);
+        return 1;
+    }
+    printf("%s: passed\n", test_name);
+    return 0;
+}
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POINTER_TRANSFER_TEST_H */
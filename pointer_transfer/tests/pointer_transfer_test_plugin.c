@@ -0,0 +1,233 @@
+/**
+ * @file pointer_transfer_test_plugin.c
+ * @brief 行为测试用插件（带批量接口） / Plugin for behavior tests (with a batch interface) / Plugin für Verhaltenstests (mit Batch-Schnittstelle)
+ */
+
+#include "nxld_plugin_interface.h"
+#include "pointer_transfer_plugin_types.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PLUGIN_NAME "TestPlugin"
+#define PLUGIN_VERSION "1.0.0"
+#define INTERFACE_COUNT 2
+#define TEST_PLUGIN_RECORD_CAPACITY 4096
+
+/* Scale_Vec在该值所在行停止并返回失败 / Scale_Vec stops at the row holding this value and fails / Scale_Vec hält an der Zeile mit diesem Wert an und schlägt fehl */
+#define TEST_PLUGIN_VEC_STOP_VALUE -1000.0
+
+/* 测试读取的计数器 / Counters read by the tests / Von den Tests gelesene Zähler */
+NXLD_PLUGIN_EXPORT size_t test_plugin_scalar_calls = 0;
+NXLD_PLUGIN_EXPORT size_t test_plugin_vec_calls = 0;
+NXLD_PLUGIN_EXPORT size_t test_plugin_vec_rows = 0;
+NXLD_PLUGIN_EXPORT size_t test_plugin_record_count = 0;
+NXLD_PLUGIN_EXPORT double test_plugin_records[TEST_PLUGIN_RECORD_CAPACITY];
+
+/**
+ * @brief 复制字符串到缓冲区 / Copy a string into a buffer / Zeichenfolge in einen Puffer kopieren
+ */
+static void copy_text(char* buffer, size_t buffer_size, const char* text) {
+    if (buffer == NULL || buffer_size == 0) {
+        return;
+    }
+    size_t len = strlen(text);
+    if (len >= buffer_size) {
+        len = buffer_size - 1;
+    }
+    memcpy(buffer, text, len);
+    buffer[len] = '\0';
+}
+
+/**
+ * @brief 读取第一个参数的double值（两种参数包布局） / Read the first parameter as double (either pack layout) / Ersten Parameter als double lesen (beide Paketlayouts)
+ */
+static double first_param_double(const void* pack_ptr) {
+    const pt_param_value_u* value = pt_pack_param_value(pack_ptr, 0);
+    if (value == NULL) {
+        return 0.0;
+    }
+    switch (pt_pack_param_type(pack_ptr, 0)) {
+        case NXLD_PARAM_TYPE_INT32:
+            return (double)value->int32_val;
+        case NXLD_PARAM_TYPE_INT64:
+            return (double)value->int64_val;
+        case NXLD_PARAM_TYPE_FLOAT:
+            return (double)value->float_val;
+        default:
+            return value->double_val;
+    }
+}
+
+/**
+ * @brief 返回参数的两倍 / Return twice the parameter / Das Doppelte des Parameters zurückgeben
+ */
+NXLD_PLUGIN_EXPORT double NXLD_PLUGIN_CALL Scale(void* pack_ptr) {
+    test_plugin_scalar_calls++;
+    return first_param_double(pack_ptr) * 2.0;
+}
+
+/**
+ * @brief Scale的批量版本 / Batch version of Scale / Batch-Version von Scale
+ * @details 遇到TEST_PLUGIN_VEC_STOP_VALUE时在该行之前停止，已执行的行标记在row_done中 / Stops before a row holding TEST_PLUGIN_VEC_STOP_VALUE, the rows already run are marked in row_done / Hält vor einer Zeile mit TEST_PLUGIN_VEC_STOP_VALUE an, bereits ausgeführte Zeilen werden in row_done markiert
+ * @return 成功返回0，参数无效或遇到停止值时返回-1 / Returns 0 on success, -1 if parameters are invalid or the stop value was reached / Gibt 0 bei Erfolg zurück, -1 wenn Parameter ungültig sind oder der Stoppwert erreicht wurde
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL Scale_Vec(const pt_batch_t* batch) {
+    if (batch == NULL || batch->param_count < 1 || batch->types == NULL ||
+        batch->columns == NULL || batch->results == NULL || batch->types[0] != NXLD_PARAM_TYPE_DOUBLE) {
+        return -1;
+    }
+    
+    test_plugin_vec_calls++;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        if (batch->columns[0][row].double_val == TEST_PLUGIN_VEC_STOP_VALUE) {
+            return -1;
+        }
+        batch->results[row].double_val = batch->columns[0][row].double_val * 2.0;
+        test_plugin_vec_rows++;
+        if (batch->row_done != NULL) {
+            batch->row_done[row] = 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 按调用顺序记录参数 / Record the parameter in call order / Parameter in Aufrufreihenfolge aufzeichnen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL Record(void* pack_ptr) {
+    if (test_plugin_record_count < TEST_PLUGIN_RECORD_CAPACITY) {
+        test_plugin_records[test_plugin_record_count++] = first_param_double(pack_ptr);
+    }
+    return 0;
+}
+
+/* 参数类型 / Parameter types / Parametertypen */
+static const nxld_param_type_t double_param_types[] = { NXLD_PARAM_TYPE_DOUBLE };
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "Scale",
+        "Return twice the value, returns double",
+        "1.0.0",
+        (void*)Scale,
+        NXLD_RETURN_TYPE_DOUBLE,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        1,
+        1,
+        double_param_types
+    },
+    {
+        "Record",
+        "Record the value, returns int32",
+        "1.0.0",
+        (void*)Record,
+        NXLD_RETURN_TYPE_INT32,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        1,
+        1,
+        double_param_types
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_PACK
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}
+
+/* 逐项查询函数（静态验证要求导出），均由描述符表回答 / Per-item query functions (static validation requires them), all answered from the descriptor table / Einzelabfragefunktionen (von der statischen Validierung verlangt), alle aus der Deskriptortabelle beantwortet */
+
+/**
+ * @brief 获取插件名称 / Get plugin name / Plugin-Namen abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_name(char* name, size_t name_size) {
+    if (name == NULL || name_size == 0) {
+        return -1;
+    }
+    copy_text(name, name_size, PLUGIN_NAME);
+    return 0;
+}
+
+/**
+ * @brief 获取插件版本 / Get plugin version / Plugin-Version abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_version(char* version, size_t version_size) {
+    if (version == NULL || version_size == 0) {
+        return -1;
+    }
+    copy_text(version, version_size, PLUGIN_VERSION);
+    return 0;
+}
+
+/**
+ * @brief 获取接口数量 / Get interface count / Schnittstellenanzahl abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_count(size_t* count) {
+    if (count == NULL) {
+        return -1;
+    }
+    *count = INTERFACE_COUNT;
+    return 0;
+}
+
+/**
+ * @brief 获取接口信息 / Get interface information / Schnittstelleninformationen abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_info(size_t index,
+                                                        char* name, size_t name_size,
+                                                        char* description, size_t desc_size,
+                                                        char* version, size_t version_size) {
+    if (index >= INTERFACE_COUNT) {
+        return -1;
+    }
+    copy_text(name, name_size, interface_descriptors[index].name);
+    copy_text(description, desc_size, interface_descriptors[index].description);
+    copy_text(version, version_size, interface_descriptors[index].version);
+    return 0;
+}
+
+/**
+ * @brief 获取接口参数数量 / Get interface parameter count / Schnittstellenparameteranzahl abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_count(size_t index,
+                                                               nxld_param_count_type_t* count_type,
+                                                               int32_t* min_count, int32_t* max_count) {
+    if (index >= INTERFACE_COUNT || count_type == NULL || min_count == NULL || max_count == NULL) {
+        return -1;
+    }
+    *count_type = interface_descriptors[index].param_count_type;
+    *min_count = interface_descriptors[index].min_param_count;
+    *max_count = interface_descriptors[index].max_param_count;
+    return 0;
+}
+
+/**
+ * @brief 获取接口参数信息 / Get interface parameter information / Schnittstellenparameterinformationen abrufen
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_info(size_t index, int32_t param_index,
+                                                              char* param_name, size_t name_size,
+                                                              nxld_param_type_t* param_type,
+                                                              char* type_name, size_t type_name_size) {
+    if (index >= INTERFACE_COUNT || param_index != 0 || param_name == NULL || name_size == 0 || param_type == NULL) {
+        return -1;
+    }
+    copy_text(param_name, name_size, "value");
+    *param_type = interface_descriptors[index].param_types[param_index];
+    copy_text(type_name, type_name_size, "double");
+    return 0;
+}
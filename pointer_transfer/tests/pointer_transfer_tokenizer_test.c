@@ -0,0 +1,121 @@
+/**
+ * @file pointer_transfer_tokenizer_test.c
+ * @brief .nxpt零拷贝分词器和键完美哈希测试 / Zero-Copy .nxpt Tokenizer and Key Perfect Hash Test / Test des kopierfreien .nxpt-Tokenizers und des perfekten Schlüssel-Hashs
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_platform.h"
+#include "config/tokenizer/config_tokenizer.h"
+#include "config/rules/config_rules_loader.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 带BOM、CRLF、注释、空行、无'='行和无结尾换行的输入 / Input with a BOM, CRLF, comments, blank lines, a line without '=' and no final newline / Eingabe mit BOM, CRLF, Kommentaren, Leerzeilen, einer Zeile ohne '=' und ohne abschließenden Zeilenumbruch */
+static const char g_tokenizer_input[] =
+    "\xEF\xBB\xBF# comment\r\n"
+    "\r\n"
+    "  [EntryPlugin]  \r\n"
+    "DisableInfoLog = 1\r\n"
+    "no equals sign\n"
+    "\tMaxCallDepth=\t64 \n"
+    "UnknownKey=a=b\n"
+    "[TransferRule_0]\n"
+    "SourcePlugin=S";
+
+/**
+ * @brief 检查片段位于输入缓冲区内且内容相同 / Check that a span lies inside the input buffer and has the given text / Prüfen, dass ein Abschnitt im Eingabepuffer liegt und den Text hat
+ */
+static int span_in_input(config_span_t span, const char* text) {
+    return span.data >= g_tokenizer_input && span.data + span.length <= g_tokenizer_input + sizeof(g_tokenizer_input) - 1 &&
+           config_span_equals(span, text);
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 每个已知键独占槽位，查找恰好命中自己 / Every known key owns its slot and looks up to itself / Jeder bekannte Schlüssel besitzt seinen Slot und wird zu sich selbst aufgelöst */
+    PT_TEST_CHECK(verify_config_key_table() == 0);
+    PT_TEST_CHECK(lookup_config_key("SourcePlugin", 12) == CONFIG_KEY_SOURCE_PLUGIN);
+    PT_TEST_CHECK(lookup_config_key("TargetParamIndex", 16) == CONFIG_KEY_TARGET_PARAM_INDEX);
+    PT_TEST_CHECK(lookup_config_key("Ownership", 9) == CONFIG_KEY_OWNERSHIP);
+    PT_TEST_CHECK(lookup_config_key("CachePluginMetadata", 19) == CONFIG_KEY_CACHE_PLUGIN_METADATA);
+    
+    /* 同槽位的近似键由比较排除 / Near-miss keys that land in a used slot are rejected by the comparison / Beinahe-Treffer in einem belegten Slot werden durch den Vergleich abgewiesen */
+    PT_TEST_CHECK(lookup_config_key("sourcePlugin", 12) == CONFIG_KEY_UNKNOWN);
+    PT_TEST_CHECK(lookup_config_key("SourcePlugins", 13) == CONFIG_KEY_UNKNOWN);
+    PT_TEST_CHECK(lookup_config_key("SourcePlugin", 6) == CONFIG_KEY_UNKNOWN);
+    PT_TEST_CHECK(lookup_config_key("", 0) == CONFIG_KEY_UNKNOWN);
+    
+    /* 词法单元指向输入缓冲区，跳过的行仍计入行号 / Tokens point into the input buffer and skipped lines still count toward line numbers / Token zeigen in den Eingabepuffer und übersprungene Zeilen zählen weiter für Zeilennummern */
+    config_tokenizer_t tokenizer;
+    config_token_t token;
+    config_tokenizer_init(&tokenizer, g_tokenizer_input, sizeof(g_tokenizer_input) - 1);
+    
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 1);
+    PT_TEST_CHECK(token.type == CONFIG_TOKEN_SECTION && span_in_input(token.name, "EntryPlugin") && token.line_number == 3);
+    
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 1);
+    PT_TEST_CHECK(token.type == CONFIG_TOKEN_KEY_VALUE && token.key_id == CONFIG_KEY_DISABLE_INFO_LOG);
+    PT_TEST_CHECK(span_in_input(token.name, "DisableInfoLog") && span_in_input(token.value, "1") && token.line_number == 4);
+    
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 1);
+    PT_TEST_CHECK(token.type == CONFIG_TOKEN_KEY_VALUE && token.key_id == CONFIG_KEY_MAX_CALL_DEPTH);
+    PT_TEST_CHECK(span_in_input(token.value, "64") && token.line_number == 6);
+    
+    /* 只在第一个'='处分割，未知键仍作为键值对返回 / Split at the first '=' only, unknown keys still come back as key-value pairs / Nur am ersten '=' getrennt, unbekannte Schlüssel kommen weiterhin als Schlüssel-Wert-Paare zurück */
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 1);
+    PT_TEST_CHECK(token.type == CONFIG_TOKEN_KEY_VALUE && token.key_id == CONFIG_KEY_UNKNOWN);
+    PT_TEST_CHECK(span_in_input(token.name, "UnknownKey") && span_in_input(token.value, "a=b"));
+    
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 1);
+    PT_TEST_CHECK(token.type == CONFIG_TOKEN_SECTION && span_in_input(token.name, "TransferRule_0") && token.line_number == 8);
+    
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 1);
+    PT_TEST_CHECK(token.key_id == CONFIG_KEY_SOURCE_PLUGIN && span_in_input(token.value, "S") && token.line_number == 9);
+    
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 0);
+    PT_TEST_CHECK(token.type == CONFIG_TOKEN_END);
+    
+    /* 空输入直接结束 / Empty input ends immediately / Leere Eingabe endet sofort */
+    config_tokenizer_init(&tokenizer, NULL, 0);
+    PT_TEST_CHECK(config_tokenizer_next(&tokenizer, &token) == 0);
+    
+    /* 单次扫描文件：规则、入口设置和指向映射的入口键值一起产生 / A single file pass yields the rules, the entry settings and entry key-values pointing into the mapping / Ein einziger Dateidurchlauf liefert Regeln, Einstiegseinstellungen und Einstiegs-Schlüssel-Werte, die in die Zuordnung zeigen */
+    char rules_path[PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "tokenizer_test.nxpt");
+    PT_TEST_CHECK(pt_test_write_file(rules_path,
+                                     "[EntryPlugin]\nDisableInfoLog=1\nMaxCallDepth=64\n"
+                                     "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+                                     "TargetPlugin=T\nTargetInterface=f\nTargetParamIndex=0\n"
+                                     "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=m\nSourceParamIndex=1\n"
+                                     "TargetPlugin=T\nTargetInterface=g\nTargetParamIndex=2\n") == 0);
+    parsed_rules_file_t parsed;
+    PT_TEST_CHECK(parse_transfer_rules_file(rules_path, &parsed) == 0);
+    PT_TEST_CHECK(parsed.rule_count == 2);
+    if (parsed.rule_count == 2) {
+        PT_TEST_CHECK(strcmp(parsed.rules[0].source_interface, "n") == 0 && parsed.rules[0].target_param_index == 0);
+        PT_TEST_CHECK(strcmp(parsed.rules[1].target_interface, "g") == 0 && parsed.rules[1].source_param_index == 1 &&
+                      parsed.rules[1].target_param_index == 2);
+    }
+    PT_TEST_CHECK(parsed.settings.disable_info_log == 1);
+    PT_TEST_CHECK(parsed.entry_item_count == 2);
+    if (parsed.entry_item_count == 2 && parsed.source_map != NULL) {
+        const char* map_data = (const char*)pt_platform_file_map_data((const pt_platform_file_map_t*)parsed.source_map);
+        size_t map_size = pt_platform_file_map_size((const pt_platform_file_map_t*)parsed.source_map);
+        const config_key_value_t* depth_item = &parsed.entry_items[1];
+        PT_TEST_CHECK(depth_item->key_id == CONFIG_KEY_MAX_CALL_DEPTH && config_span_equals(depth_item->value, "64"));
+        PT_TEST_CHECK(depth_item->value.data >= map_data && depth_item->value.data + depth_item->value.length <= map_data + map_size);
+    }
+    free_parsed_rules_file(&parsed);
+    
+    remove(rules_path);
+    return pt_test_finish("pointer_transfer_tokenizer_test");
+}
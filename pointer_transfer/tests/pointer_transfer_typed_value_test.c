@@ -0,0 +1,129 @@
+/**
+ * @file pointer_transfer_typed_value_test.c
+ * @brief 带类型传递值测试 / Typed Transfer Value Test / Test typisierter Übertragungswerte
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 值为16字节；标量直接携带，指向标量的指针按引用携带 / Values are 16 bytes; scalars travel directly, pointers to scalars by reference / Werte sind 16 Bytes; Skalare werden direkt, Zeiger auf Skalare per Referenz getragen */
+    PT_TEST_CHECK(sizeof(pt_typed_value_t) == 16);
+    pt_typed_value_t int_value = make_int64_value(-3);
+    pt_typed_value_t double_value = make_double_value(0.5);
+    int32_t referenced = 42;
+    double referenced_double = -1.25;
+    pt_typed_value_t by_ref = make_pointer_value(&referenced, NXLD_PARAM_TYPE_INT32, sizeof(referenced));
+    pt_typed_value_t raw_pointer = make_pointer_value(&referenced_double, NXLD_PARAM_TYPE_POINTER, sizeof(referenced_double));
+    pt_typed_value_t null_pointer = make_pointer_value(NULL, NXLD_PARAM_TYPE_POINTER, 0);
+    PT_TEST_CHECK(is_immediate_value(&int_value) && is_immediate_value(&double_value));
+    PT_TEST_CHECK(!is_immediate_value(&by_ref) && (by_ref.flags & PT_VALUE_FLAG_BY_REF));
+    PT_TEST_CHECK(!is_immediate_value(&raw_pointer) && !(raw_pointer.flags & PT_VALUE_FLAG_BY_REF));
+    
+    /* 数值按值自身的类型读取；无类型指针按请求的类型解引用 / Numbers are read by the value's own type; untyped pointers are dereferenced as the requested type / Zahlen werden nach dem eigenen Typ des Werts gelesen; untypisierte Zeiger als angeforderter Typ dereferenziert */
+    int64_t int_out = 0;
+    double float_out = 0.0;
+    PT_TEST_CHECK(read_typed_value_number(&int_value, NXLD_PARAM_TYPE_DOUBLE, &int_out, &float_out) == 0 && int_out == -3);
+    PT_TEST_CHECK(read_typed_value_number(&double_value, NXLD_PARAM_TYPE_INT32, &int_out, &float_out) == 1 && float_out == 0.5);
+    PT_TEST_CHECK(read_typed_value_number(&by_ref, NXLD_PARAM_TYPE_DOUBLE, &int_out, &float_out) == 0 && int_out == 42);
+    PT_TEST_CHECK(read_typed_value_number(&raw_pointer, NXLD_PARAM_TYPE_DOUBLE, &int_out, &float_out) == 1 && float_out == -1.25);
+    PT_TEST_CHECK(read_typed_value_number(&null_pointer, NXLD_PARAM_TYPE_INT32, &int_out, &float_out) == -1);
+    PT_TEST_CHECK(read_typed_value_number(NULL, NXLD_PARAM_TYPE_INT32, &int_out, &float_out) == -1);
+    
+    /* 条件按值的类型比较，直接标量从不为空 / Conditions compare by the value's type, immediate scalars are never null / Bedingungen vergleichen nach dem Typ des Werts, Direktskalare sind nie null */
+    pt_typed_value_t zero_value = make_int64_value(0);
+    PT_TEST_CHECK(check_condition(">0", &double_value) && !check_condition("<0", &double_value));
+    PT_TEST_CHECK(check_condition("<0", &int_value) && check_condition("!=0", &int_value));
+    PT_TEST_CHECK(check_condition("not_null", &zero_value) && !check_condition("null", &zero_value));
+    PT_TEST_CHECK(check_condition("==0", &zero_value));
+    PT_TEST_CHECK(check_condition("null", &null_pointer) && !check_condition(">0", &null_pointer));
+    PT_TEST_CHECK(check_condition(">0", &by_ref));
+    
+    /* Record按调用顺序记录参数；第二条规则只传递正值 / Record logs its parameter in call order; the second rule only passes positive values / Record protokolliert seinen Parameter in Aufrufreihenfolge; die zweite Regel gibt nur positive Werte weiter */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[4 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "typed_value_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "typed_value_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=v\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n"
+             "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=c\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\nCondition=>0\n", argv[2], argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    void* handle = pt_platform_load_library(argv[2]);
+    size_t* record_count = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_record_count") : NULL;
+    double* records = handle != NULL ? (double*)pt_platform_get_symbol(handle, "test_plugin_records") : NULL;
+    PT_TEST_CHECK(record_count != NULL && records != NULL);
+    if (record_count == NULL || records == NULL) {
+        if (handle != NULL) {
+            pt_platform_close_library(handle);
+        }
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_typed_value_test");
+    }
+    
+    /* 整数、浮点和字节缓冲区都按目标参数类型转换 / Integers, doubles and byte buffers are all converted to the target parameter type / Ganzzahlen, Doubles und Bytepuffer werden alle in den Zielparametertyp konvertiert */
+    size_t first = *record_count;
+    PT_TEST_CHECK(TransferInt64("S", "v", 0, 7) == 0);
+    PT_TEST_CHECK(TransferDouble("S", "v", 0, 2.5) == 0);
+    PT_TEST_CHECK(TransferBytes("S", "v", 0, &referenced_double, sizeof(referenced_double)) == 0);
+    PT_TEST_CHECK(TransferBytes("S", "v", 0, NULL, sizeof(referenced_double)) != 0);
+    
+    /* 0.5按浮点比较通过条件，负整数被过滤 / 0.5 passes the condition as a double, the negative integer is filtered / 0.5 besteht die Bedingung als Double, die negative Ganzzahl wird gefiltert */
+    PT_TEST_CHECK(TransferDouble("S", "c", 0, 0.5) == 0);
+    PT_TEST_CHECK(TransferInt64("S", "c", 0, -4) == 0);
+    PT_TEST_CHECK(*record_count == first + 4);
+    if (*record_count == first + 4) {
+        PT_TEST_CHECK(records[first] == 7.0 && records[first + 1] == 2.5);
+        PT_TEST_CHECK(records[first + 2] == -1.25 && records[first + 3] == 0.5);
+    }
+    
+    /* 参数槽保存转换后的值，读回时为直接值 / Parameter slots hold the converted value and read back as an immediate value / Parameterplätze halten den konvertierten Wert und werden als Direktwert zurückgelesen */
+    target_interface_state_t* state = find_interface_state("TestPlugin", "Record");
+    PT_TEST_CHECK(state != NULL);
+    if (state != NULL) {
+        pt_typed_value_t five = make_int64_value(5);
+        PT_TEST_CHECK(set_parameter_value_from_typed((struct target_interface_state_s*)state, 0, &five, "TestPlugin", "Record") == 1);
+        PT_TEST_CHECK(state->param_float_values[0] == 5.0 && state->param_sizes[0] == sizeof(double));
+        pt_typed_value_t stored = get_parameter_typed_value((struct target_interface_state_s*)state, 0);
+        PT_TEST_CHECK(is_immediate_value(&stored) && stored.type == NXLD_PARAM_TYPE_DOUBLE && stored.as.f64 == 5.0);
+        PT_TEST_CHECK(set_parameter_value_from_typed((struct target_interface_state_s*)state, 1, &five, "TestPlugin", "Record") == 0);
+    }
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_typed_value_test");
+}
@@ -0,0 +1,115 @@
+/**
+ * @file pointer_transfer_validate_db_test.c
+ * @brief 验证数据库(.nxpvdb)往返测试 / Validation Database (.nxpvdb) Round Trip Test / Rundreisetest der Validierungsdatenbank (.nxpvdb)
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_currying.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <utime.h>
+
+/**
+ * @brief 检查接口验证缓存 / Check the interface validation cache / Schnittstellen-Validierungs-Cache prüfen
+ * @return 缓存有效返回1，否则返回0 / Returns 1 if the cache is valid, 0 otherwise / Gibt 1 zurück, wenn der Cache gültig ist, sonst 0
+ */
+static int is_cache_valid(const char* plugin_path, int param_count) {
+    int cache_valid = -1;
+    PT_TEST_CHECK(pt_check_validation_cache(plugin_path, "Scale", param_count, PT_RETURN_TYPE_DOUBLE, &cache_valid) == 0);
+    return cache_valid == 1;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录） / Arguments (argv[1] is the work directory) / Argumente (argv[1] ist das Arbeitsverzeichnis)
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <work_dir>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 数据库位于插件所在目录，插件文件只需存在 / The database lives in the plugin directory, the plugin file only has to exist / Die Datenbank liegt im Plugin-Verzeichnis, die Plugin-Datei muss nur existieren */
+    char plugin_path[PT_TEST_PATH_SIZE];
+    char db_path[PT_TEST_PATH_SIZE];
+    pt_test_path(plugin_path, argv[1], "validate_db_test.so");
+    pt_test_path(db_path, argv[1], "plugins.nxpvdb");
+    remove(db_path);
+    PT_TEST_CHECK(pt_test_write_file(plugin_path, "first build") == 0);
+    PT_TEST_CHECK(init_validation_db_lock() == 0);
+    
+    PT_TEST_CHECK(!is_cache_valid(plugin_path, 2));
+    PT_TEST_CHECK(pt_record_validation_result(plugin_path, "Scale", 2, PT_RETURN_TYPE_DOUBLE, 1) == 0);
+    
+    nxld_param_type_t param_types[2] = { NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_DOUBLE };
+    pt_cached_metadata_t metadata = {
+        .interface_index = 3,
+        .return_type = PT_RETURN_TYPE_DOUBLE,
+        .return_size = sizeof(double),
+        .param_count_type = NXLD_PARAM_COUNT_FIXED,
+        .min_count = 2,
+        .max_count = 2,
+        .param_types = param_types,
+        .param_type_count = 2,
+        .call_convention = NXLD_CALL_CONVENTION_NATIVE,
+        .native_return_type = NXLD_RETURN_TYPE_DOUBLE
+    };
+    PT_TEST_CHECK(pt_record_cached_metadata(plugin_path, "Scale", &metadata) == 0);
+    
+    /* 关闭后重新打开，结果从文件读回 / Close and reopen so the results are read back from the file / Schließen und erneut öffnen, damit die Ergebnisse aus der Datei gelesen werden */
+    close_validation_databases();
+    PT_TEST_CHECK(init_validation_db_lock() == 0);
+    FILE* db_file = fopen(db_path, "rb");
+    PT_TEST_CHECK(db_file != NULL);
+    if (db_file != NULL) {
+        fclose(db_file);
+    }
+    
+    PT_TEST_CHECK(is_cache_valid(plugin_path, 2));
+    PT_TEST_CHECK(!is_cache_valid(plugin_path, 3));
+    
+    pt_cached_metadata_t loaded = { 0 };
+    PT_TEST_CHECK(pt_load_cached_metadata(plugin_path, "Scale", &loaded) == 0);
+    PT_TEST_CHECK(loaded.interface_index == 3);
+    PT_TEST_CHECK(loaded.return_type == PT_RETURN_TYPE_DOUBLE);
+    PT_TEST_CHECK(loaded.return_size == sizeof(double));
+    PT_TEST_CHECK(loaded.param_count_type == NXLD_PARAM_COUNT_FIXED);
+    PT_TEST_CHECK(loaded.min_count == 2 && loaded.max_count == 2);
+    PT_TEST_CHECK(loaded.param_type_count == 2);
+    PT_TEST_CHECK(loaded.param_types != NULL && loaded.param_types != param_types);
+    if (loaded.param_types != NULL && loaded.param_type_count == 2) {
+        PT_TEST_CHECK(loaded.param_types[0] == NXLD_PARAM_TYPE_INT32);
+        PT_TEST_CHECK(loaded.param_types[1] == NXLD_PARAM_TYPE_DOUBLE);
+    }
+    PT_TEST_CHECK(loaded.call_convention == NXLD_CALL_CONVENTION_NATIVE);
+    PT_TEST_CHECK(loaded.native_return_type == NXLD_RETURN_TYPE_DOUBLE);
+    free(loaded.param_types);
+    
+    /* 只有修改时间变化时内容哈希相同，结果保留 / When only the mtime changes the content hash matches and the results are kept / Ändert sich nur die Änderungszeit, stimmt der Inhalts-Hash und die Ergebnisse bleiben erhalten */
+    struct utimbuf times;
+    times.actime = time(NULL) + 5;
+    times.modtime = times.actime;
+    PT_TEST_CHECK(utime(plugin_path, &times) == 0);
+    PT_TEST_CHECK(is_cache_valid(plugin_path, 2));
+    
+    /* 插件内容变化后验证结果和元数据失效 / Validation results and metadata are invalidated once the plugin content changes / Validierungsergebnisse und Metadaten werden ungültig, sobald sich der Plugin-Inhalt ändert */
+    PT_TEST_CHECK(pt_test_write_file(plugin_path, "second build") == 0);
+    times.actime = time(NULL) + 10;
+    times.modtime = times.actime;
+    PT_TEST_CHECK(utime(plugin_path, &times) == 0);
+    PT_TEST_CHECK(!is_cache_valid(plugin_path, 2));
+    pt_cached_metadata_t stale = { 0 };
+    PT_TEST_CHECK(pt_load_cached_metadata(plugin_path, "Scale", &stale) != 0);
+    free(stale.param_types);
+    
+    close_validation_databases();
+    remove(plugin_path);
+    remove(db_path);
+    return pt_test_finish("pointer_transfer_validate_db_test");
+}
@@ -0,0 +1,96 @@
+/**
+ * @file pointer_transfer_validate_pipeline_test.c
+ * @brief 启动时后台接口验证测试 / Background Interface Validation at Startup Test / Test der Hintergrund-Schnittstellenvalidierung beim Start
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_interface.h"
+#include "pointer_transfer_plugin_loader.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 预加载和验证同时开启，预加载的接口进入后台验证计划 / Preload and validation are both on, so preloaded interfaces join the background plan / Vorladen und Validierung sind beide aktiv, vorgeladene Schnittstellen kommen in den Hintergrundplan */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char entry_path[PT_TEST_PATH_SIZE];
+    char entry_compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[2 * PT_TEST_PATH_SIZE];
+    char entry_text[2 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "validate_pipeline_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "validate_pipeline_test.nxptc");
+    pt_test_path(entry_path, argv[1], "validate_pipeline_test_entry.nxpt");
+    pt_test_path(entry_compiled_path, argv[1], "validate_pipeline_test_entry.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nPluginName=PipelineEntry\nNxptPath=%s\nDisableInfoLog=1\nPreload=true\n"
+             "EnableValidation=true\nValidationPending=wait\n", entry_path);
+    snprintf(entry_text, sizeof(entry_text),
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "TransferMode=Broadcast\n", argv[2]);
+    remove(compiled_path);
+    remove(entry_compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    PT_TEST_CHECK(pt_test_write_file(entry_path, entry_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 后台验证结束后结果可直接查询，接口尚未标记为已验证 / After the background pass the result can be queried, the interface is not marked validated yet / Nach dem Hintergrunddurchlauf ist das Ergebnis abfragbar, die Schnittstelle ist noch nicht als validiert markiert */
+    wait_for_plugin_preload();
+    wait_for_interface_validation();
+    wait_for_interface_validation();
+    target_interface_state_t* state = find_interface_state("TestPlugin", "Scale");
+    PT_TEST_CHECK(state != NULL);
+    if (state == NULL) {
+        cleanup_context();
+        return pt_test_finish("pointer_transfer_validate_pipeline_test");
+    }
+    PT_TEST_CHECK(get_interface_validation_result(state, state->param_count, state->return_type) == INTERFACE_VALIDATION_PASSED);
+    PT_TEST_CHECK(get_interface_validation_result(state, state->param_count + 1, state->return_type) == INTERFACE_VALIDATION_NONE);
+    PT_TEST_CHECK(!state->validation_done);
+    
+    /* 首次调用只采用后台结果 / The first call only adopts the background result / Der erste Aufruf übernimmt nur das Hintergrundergebnis */
+    void* handle = pt_platform_load_library(argv[2]);
+    size_t* scalar_calls = handle != NULL ? (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls") : NULL;
+    PT_TEST_CHECK(scalar_calls != NULL);
+    if (scalar_calls != NULL) {
+        size_t calls_before = *scalar_calls;
+        PT_TEST_CHECK(TransferDouble("S", "n", 0, 1.5) == 0);
+        PT_TEST_CHECK(*scalar_calls == calls_before + 1);
+    }
+    PT_TEST_CHECK(state->validation_done);
+    
+    /* 已结束的计划不再需要结算 / A finished plan needs no settling / Ein beendeter Plan muss nicht mehr abgeschlossen werden */
+    settle_plugin_validation(state->handle, 0);
+    PT_TEST_CHECK(get_interface_validation_result(state, state->param_count, state->return_type) == INTERFACE_VALIDATION_PASSED);
+    
+    if (handle != NULL) {
+        pt_platform_close_library(handle);
+    }
+    cleanup_context();
+    remove(rules_path);
+    remove(compiled_path);
+    remove(entry_path);
+    remove(entry_compiled_path);
+    return pt_test_finish("pointer_transfer_validate_pipeline_test");
+}
@@ -0,0 +1,122 @@
+/**
+ * @file pointer_transfer_validate_static_test.c
+ * @brief 静态插件验证测试 / Static Plugin Validation Test / Test der statischen Plugin-Validierung
+ */
+
+#include "pointer_transfer_test.h"
+#include "pointer_transfer_plugin.h"
+#include "pointer_transfer_context.h"
+#include "pointer_transfer_currying.h"
+#include "pointer_transfer_platform.h"
+#include "core/init/pointer_transfer_plugin_init.h"
+#include <stdio.h>
+#include <string.h>
+
+/* 检查的导出符号数量 / Checked export count / Anzahl geprüfter Exporte */
+#define STATIC_TEST_SYMBOL_COUNT 3
+
+/**
+ * @brief 取路径中的文件名 / Get file name of a path / Dateinamen eines Pfads abrufen
+ */
+static const char* static_test_file_name(const char* path) {
+    const char* file_name = path;
+    for (const char* cursor = path; *cursor != '\0'; cursor++) {
+        if (*cursor == '/' || *cursor == '\\') {
+            file_name = cursor + 1;
+        }
+    }
+    return file_name;
+}
+
+/**
+ * @brief 测试入口 / Test entry / Testeinstieg
+ * @param argc 参数数量 / Argument count / Argumentanzahl
+ * @param argv 参数（argv[1]为工作目录，argv[2]为测试插件路径） / Arguments (argv[1] is the work directory, argv[2] the test plugin path) / Argumente (argv[1] ist das Arbeitsverzeichnis, argv[2] der Test-Plugin-Pfad)
+ */
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <work_dir> <test_plugin>\n", argv[0]);
+        return 2;
+    }
+    
+    /* 导出表直接从库文件读取；不是库的文件无法解析 / The export table is read straight from the library file; a file that is no library cannot be parsed / Die Exporttabelle wird direkt aus der Bibliotheksdatei gelesen; eine Datei, die keine Bibliothek ist, kann nicht geparst werden */
+    char note_path[PT_TEST_PATH_SIZE];
+    pt_test_path(note_path, argv[1], "validate_static_test.txt");
+    PT_TEST_CHECK(pt_test_write_file(note_path, "not a library") == 0);
+    const char* symbol_names[STATIC_TEST_SYMBOL_COUNT] = { "Scale", "nxld_plugin_get_interface_count", "NoSuchExport" };
+    int found[STATIC_TEST_SYMBOL_COUNT] = { 0 };
+    PT_TEST_CHECK(pt_platform_check_library_exports(note_path, symbol_names, STATIC_TEST_SYMBOL_COUNT, found) != 0);
+#ifndef _WIN32
+    PT_TEST_CHECK(pt_platform_check_library_exports(argv[2], symbol_names, STATIC_TEST_SYMBOL_COUNT, found) == 0);
+    PT_TEST_CHECK(found[0] && found[1] && !found[2]);
+#endif
+    
+    /* Record规则的参数索引超出元数据声明的参数数量；TrialCalls只列出其他插件 / The Record rule's parameter index exceeds the count the metadata declares; TrialCalls only lists other plugins / Der Parameterindex der Record-Regel überschreitet die deklarierte Anzahl; TrialCalls listet nur andere Plugins */
+    char rules_path[PT_TEST_PATH_SIZE];
+    char compiled_path[PT_TEST_PATH_SIZE];
+    char rules_text[4 * PT_TEST_PATH_SIZE];
+    pt_test_path(rules_path, argv[1], "validate_static_test.nxpt");
+    pt_test_path(compiled_path, argv[1], "validate_static_test.nxptc");
+    snprintf(rules_text, sizeof(rules_text),
+             "[EntryPlugin]\nDisableInfoLog=1\nTrialCalls=other_plugin.so, trial_%s\n"
+             "[TransferRule_0]\nSourcePlugin=S\nSourceInterface=n\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Scale\nTargetParamIndex=0\n"
+             "[TransferRule_1]\nSourcePlugin=S\nSourceInterface=r\nSourceParamIndex=0\n"
+             "TargetPlugin=TestPlugin\nTargetPluginPath=%s\nTargetInterface=Record\nTargetParamIndex=3\n",
+             static_test_file_name(argv[2]), argv[2], argv[2]);
+    remove(compiled_path);
+    PT_TEST_CHECK(pt_test_write_file(rules_path, rules_text) == 0);
+    
+    plugin_setup();
+    pointer_transfer_init_options_t options;
+    memset(&options, 0, sizeof(options));
+    options.struct_size = sizeof(options);
+    options.config_path = rules_path;
+    options.skip_auto_run = 1;
+    PT_TEST_CHECK(PointerTransferInitialize(&options) == 0);
+    
+    /* 试调用只对按文件名列出的插件开放 / Trial calls are only open to plugins listed by file name / Probeaufrufe stehen nur nach Dateinamen gelisteten Plugins offen */
+    char trial_path[PT_TEST_PATH_SIZE];
+    snprintf(trial_path, sizeof(trial_path), "dir/trial_%s", static_test_file_name(argv[2]));
+    PT_TEST_CHECK(!pt_plugin_allows_trial_call(argv[2]));
+    PT_TEST_CHECK(pt_plugin_allows_trial_call("other_plugin.so"));
+    PT_TEST_CHECK(pt_plugin_allows_trial_call(trial_path));
+    PT_TEST_CHECK(!pt_plugin_allows_trial_call("other_plugin.so.1"));
+    
+    void* handle = pt_platform_load_library(argv[2]);
+    PT_TEST_CHECK(handle != NULL);
+    if (handle == NULL) {
+        cleanup_context();
+        remove(note_path);
+        return pt_test_finish("pointer_transfer_validate_static_test");
+    }
+    void* scale = pt_platform_get_symbol(handle, "Scale");
+    void* record = pt_platform_get_symbol(handle, "Record");
+    size_t* scalar_calls = (size_t*)pt_platform_get_symbol(handle, "test_plugin_scalar_calls");
+    size_t* record_count = (size_t*)pt_platform_get_symbol(handle, "test_plugin_record_count");
+    PT_TEST_CHECK(scale != NULL && record != NULL && scalar_calls != NULL && record_count != NULL);
+    
+    /* 符合元数据和规则的接口通过，且不执行插件函数 / An interface matching metadata and rules passes without running the plugin function / Eine zu Metadaten und Regeln passende Schnittstelle besteht, ohne die Plugin-Funktion auszuführen */
+    if (scale != NULL && record != NULL && scalar_calls != NULL && record_count != NULL) {
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, scale, argv[2], "Scale", 1, PT_RETURN_TYPE_DOUBLE) == 0);
+        PT_TEST_CHECK(*scalar_calls == 0);
+        
+        /* 与元数据不符、符号不匹配或未描述的接口被拒绝 / Interfaces contradicting the metadata, with a mismatched symbol or undescribed are rejected / Schnittstellen, die den Metadaten widersprechen, ein abweichendes Symbol haben oder nicht beschrieben sind, werden abgelehnt */
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, scale, argv[2], "Scale", 2, PT_RETURN_TYPE_DOUBLE) != 0);
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, scale, argv[2], "Scale", 1, PT_RETURN_TYPE_INTEGER) != 0);
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, record, argv[2], "Scale", 1, PT_RETURN_TYPE_DOUBLE) != 0);
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, pt_platform_get_symbol(handle, "Scale_Vec"), argv[2], "Scale_Vec", 1, PT_RETURN_TYPE_INTEGER) != 0);
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, scale, argv[2], "NoSuchExport", 1, PT_RETURN_TYPE_DOUBLE) != 0);
+        
+        /* 规则引用的参数索引也被检查 / Parameter indices referenced by rules are checked as well / Von Regeln referenzierte Parameterindizes werden ebenfalls geprüft */
+        PT_TEST_CHECK(pt_validate_plugin_static(handle, record, argv[2], "Record", 1, PT_RETURN_TYPE_INTEGER) != 0);
+        PT_TEST_CHECK(*record_count == 0);
+    }
+    
+    pt_platform_close_library(handle);
+    cleanup_context();
+    remove(note_path);
+    remove(rules_path);
+    remove(compiled_path);
+    return pt_test_finish("pointer_transfer_validate_static_test");
+}
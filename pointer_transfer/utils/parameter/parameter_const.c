@@ -65,13 +65,15 @@ int set_parameter_value_from_const_string(struct target_interface_state_s* state
         case NXLD_PARAM_TYPE_FLOAT: {
             double parsed_val = strtod(const_value, &endptr);
             if (endptr != NULL && *endptr == '\0' && parsed_val >= -FLT_MAX && parsed_val <= FLT_MAX) {
-                typed_state->param_float_values[param_index] = (double)parsed_val;
+                float narrow_value = (float)parsed_val;
+                typed_state->param_float_values[param_index] = 0.0;
+                memcpy(&typed_state->param_float_values[param_index], &narrow_value, sizeof(float));
                 typed_state->param_values[param_index] = &typed_state->param_float_values[param_index];
                 typed_state->param_ready[param_index] = 1;
                 typed_state->param_sizes[param_index] = sizeof(float);
                 internal_log_write("INFO", "Using constant value for parameter %d of %s.%s: %f", 
                     param_index, plugin_name != NULL ? plugin_name : "unknown", 
-                    interface_name != NULL ? interface_name : "unknown", (float)typed_state->param_float_values[param_index]);
+                    interface_name != NULL ? interface_name : "unknown", narrow_value);
                 return 1;
             }
             break;
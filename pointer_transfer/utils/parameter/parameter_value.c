@@ -0,0 +1,256 @@
+/**
+ * @file parameter_value.c
+ * @brief 带类型传递值的构造和参数设置 / Typed transfer value construction and parameter setting / Erzeugung typisierter Übertragungswerte und Parametereinstellung
+ */
+
+#include "pointer_transfer_utils.h"
+#include "pointer_transfer_types.h"
+#include "pointer_transfer_context.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * @brief 检查类型是否为标量 / Check whether a type is scalar / Prüfen, ob ein Typ skalar ist
+ */
+static int is_scalar_param_type(nxld_param_type_t type) {
+    return type == NXLD_PARAM_TYPE_INT32 || type == NXLD_PARAM_TYPE_INT64 || type == NXLD_PARAM_TYPE_CHAR ||
+           type == NXLD_PARAM_TYPE_FLOAT || type == NXLD_PARAM_TYPE_DOUBLE;
+}
+
+/**
+ * @brief 构造整数值 / Make integer value / Ganzzahlwert erzeugen
+ * @param value 整数 / Integer / Ganzzahl
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t make_int64_value(int64_t value) {
+    pt_typed_value_t result;
+    memset(&result, 0, sizeof(result));
+    result.type = NXLD_PARAM_TYPE_INT64;
+    result.size = sizeof(int64_t);
+    result.as.i64 = value;
+    return result;
+}
+
+/**
+ * @brief 构造浮点值 / Make floating-point value / Gleitkommawert erzeugen
+ * @param value 浮点数 / Floating-point number / Gleitkommazahl
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t make_double_value(double value) {
+    pt_typed_value_t result;
+    memset(&result, 0, sizeof(result));
+    result.type = NXLD_PARAM_TYPE_DOUBLE;
+    result.size = sizeof(double);
+    result.as.f64 = value;
+    return result;
+}
+
+/**
+ * @brief 构造指针值 / Make pointer value / Zeigerwert erzeugen
+ * @param ptr 指针 / Pointer / Zeiger
+ * @param type 指针所指数据的类型，标量类型按引用携带 / Type of the data behind the pointer, scalar types are carried by reference / Typ der Daten hinter dem Zeiger, skalare Typen werden per Referenz getragen
+ * @param size 数据大小，0表示未知 / Data size, 0 if unknown / Datengröße, 0 wenn unbekannt
+ * @return 带类型的值 / Typed value / Typisierter Wert
+ */
+pt_typed_value_t make_pointer_value(void* ptr, nxld_param_type_t type, size_t size) {
+    pt_typed_value_t result;
+    memset(&result, 0, sizeof(result));
+    result.type = (uint16_t)type;
+    result.flags = is_scalar_param_type(type) ? PT_VALUE_FLAG_BY_REF : 0;
+    result.size = size > UINT32_MAX ? UINT32_MAX : (uint32_t)size;
+    result.as.ptr = ptr;
+    return result;
+}
+
+/**
+ * @brief 检查值是否直接携带标量 / Check whether a value carries a scalar directly / Prüfen, ob ein Wert einen Skalar direkt trägt
+ * @param value 带类型的值 / Typed value / Typisierter Wert
+ * @return 直接携带返回1，否则返回0 / Returns 1 if carried directly, 0 otherwise / Gibt 1 zurück, wenn direkt getragen, sonst 0
+ */
+int is_immediate_value(const pt_typed_value_t* value) {
+    return value != NULL && !(value->flags & PT_VALUE_FLAG_BY_REF) && is_scalar_param_type((nxld_param_type_t)value->type);
+}
+
+/**
+ * @brief 读取值的数值 / Read numeric value of a typed value / Zahlenwert eines typisierten Werts lesen
+ * @param value 带类型的值 / Typed value / Typisierter Wert
+ * @param read_type 指针值按此类型解引用（值自带标量类型时忽略） / Pointer values are dereferenced as this type (ignored when the value has its own scalar type) / Zeigerwerte werden als dieser Typ dereferenziert (ignoriert, wenn der Wert einen eigenen skalaren Typ hat)
+ * @param int_out 输出整数 / Output integer / Ausgabe-Ganzzahl
+ * @param float_out 输出浮点数 / Output floating-point number / Ausgabe-Gleitkommazahl
+ * @return 浮点返回1，整数返回0，空指针返回-1 / Returns 1 for floating-point, 0 for integer, -1 for a null pointer / Gibt 1 für Gleitkomma, 0 für Ganzzahl, -1 für einen Nullzeiger zurück
+ */
+int read_typed_value_number(const pt_typed_value_t* value, nxld_param_type_t read_type, int64_t* int_out, double* float_out) {
+    *int_out = 0;
+    *float_out = 0.0;
+    if (value == NULL) {
+        return -1;
+    }
+    
+    nxld_param_type_t type = (nxld_param_type_t)value->type;
+    if (is_immediate_value(value)) {
+        if (type == NXLD_PARAM_TYPE_FLOAT || type == NXLD_PARAM_TYPE_DOUBLE) {
+            *float_out = value->as.f64;
+            return 1;
+        }
+        *int_out = value->as.i64;
+        return 0;
+    }
+    
+    const void* ptr = value->as.ptr;
+    if (ptr == NULL) {
+        return -1;
+    }
+    if (value->flags & PT_VALUE_FLAG_BY_REF) {
+        read_type = type;
+    }
+    switch (read_type) {
+        case NXLD_PARAM_TYPE_INT32:
+            *int_out = (int64_t)*(const int32_t*)ptr;
+            return 0;
+        case NXLD_PARAM_TYPE_CHAR:
+            *int_out = (int64_t)*(const char*)ptr;
+            return 0;
+        case NXLD_PARAM_TYPE_FLOAT:
+            *float_out = (double)*(const float*)ptr;
+            return 1;
+        case NXLD_PARAM_TYPE_DOUBLE:
+            *float_out = *(const double*)ptr;
+            return 1;
+        default:
+            *int_out = *(const int64_t*)ptr;
+            return 0;
+    }
+}
+
+/**
+ * @brief 记录已设置的参数 / Log a stored parameter / Gespeicherten Parameter protokollieren
+ */
+static void log_stored_parameter(const target_interface_state_t* state, int param_index, nxld_param_type_t param_type,
+                                 const char* plugin_name, const char* interface_name) {
+    const char* plugin = plugin_name != NULL ? plugin_name : "unknown";
+    const char* interface = interface_name != NULL ? interface_name : "unknown";
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_INT64:
+        case NXLD_PARAM_TYPE_CHAR:
+            internal_log_write("INFO", "Stored parameter %d for %s.%s (type=%d, integer value: %lld)",
+                param_index, plugin, interface, param_type, (long long)state->param_int_values[param_index]);
+            break;
+        case NXLD_PARAM_TYPE_FLOAT:
+            internal_log_write("INFO", "Stored parameter %d for %s.%s (type=%d, float value: %f)",
+                param_index, plugin, interface, param_type, *(const float*)state->param_values[param_index]);
+            break;
+        case NXLD_PARAM_TYPE_DOUBLE:
+            internal_log_write("INFO", "Stored parameter %d for %s.%s (type=%d, float value: %lf)",
+                param_index, plugin, interface, param_type, state->param_float_values[param_index]);
+            break;
+        default:
+            internal_log_write("INFO", "Stored parameter %d for %s.%s (type=%d, size=%zu)",
+                param_index, plugin, interface, param_type, state->param_sizes[param_index]);
+            break;
+    }
+}
+
+/**
+ * @brief 从带类型的值设置参数值 / Set parameter value from typed value / Parameterwert aus typisiertem Wert setzen
+ * @param state 接口状态结构体指针 / Interface state structure pointer / Schnittstellenstatus-Struktur-Zeiger
+ * @param param_index 参数索引 / Parameter index / Parameterindex
+ * @param value 带类型的值（NULL视为空指针） / Typed value (NULL counts as a null pointer) / Typisierter Wert (NULL gilt als Nullzeiger)
+ * @param plugin_name 插件名称 / Plugin name / Plugin-Name
+ * @param interface_name 接口名称 / Interface name / Schnittstellenname
+ * @return 成功返回1，失败返回0 / Returns 1 on success, 0 on failure / Gibt 1 bei Erfolg zurück, 0 bei Fehler
+ * @details 按值的类型转换为参数类型，不根据大小猜测 / Converts from the value's type to the parameter type instead of guessing from sizes / Konvertiert vom Typ des Werts in den Parametertyp, statt anhand von Größen zu raten
+ */
+int set_parameter_value_from_typed(struct target_interface_state_s* state, int param_index, const pt_typed_value_t* value,
+                                   const char* plugin_name, const char* interface_name) {
+    target_interface_state_t* typed_state = (target_interface_state_t*)state;
+    if (typed_state == NULL || param_index < 0 || param_index >= typed_state->param_count ||
+        typed_state->param_types == NULL || typed_state->param_values == NULL ||
+        typed_state->param_int_values == NULL || typed_state->param_float_values == NULL) {
+        return 0;
+    }
+    
+    pt_typed_value_t null_value = make_pointer_value(NULL, NXLD_PARAM_TYPE_POINTER, 0);
+    if (value == NULL) {
+        value = &null_value;
+    }
+    
+    nxld_param_type_t param_type = typed_state->param_types[param_index];
+    int64_t int_value = 0;
+    double float_value = 0.0;
+    int is_float = 0;
+    switch (param_type) {
+        case NXLD_PARAM_TYPE_INT32:
+        case NXLD_PARAM_TYPE_INT64:
+        case NXLD_PARAM_TYPE_CHAR:
+            is_float = read_typed_value_number(value, param_type, &int_value, &float_value);
+            typed_state->param_int_values[param_index] = is_float == 1 ? (int64_t)float_value : int_value;
+            typed_state->param_values[param_index] = &typed_state->param_int_values[param_index];
+            typed_state->param_sizes[param_index] = param_type == NXLD_PARAM_TYPE_INT32 ? sizeof(int32_t) :
+                                                    param_type == NXLD_PARAM_TYPE_CHAR ? sizeof(char) : sizeof(int64_t);
+            break;
+        case NXLD_PARAM_TYPE_FLOAT:
+        case NXLD_PARAM_TYPE_DOUBLE:
+            is_float = read_typed_value_number(value, param_type, &int_value, &float_value);
+            if (is_float == 0) {
+                float_value = (double)int_value;
+            }
+            if (param_type == NXLD_PARAM_TYPE_FLOAT) {
+                /* FLOAT槽保存float位模式，所有读取者按float*读取 / FLOAT slots hold float bits, every reader dereferences them as float* / FLOAT-Plätze enthalten float-Bits, alle Leser lesen sie als float* */
+                float narrow_value = (float)float_value;
+                typed_state->param_float_values[param_index] = 0.0;
+                memcpy(&typed_state->param_float_values[param_index], &narrow_value, sizeof(float));
+            } else {
+                typed_state->param_float_values[param_index] = float_value;
+            }
+            typed_state->param_values[param_index] = &typed_state->param_float_values[param_index];
+            typed_state->param_sizes[param_index] = param_type == NXLD_PARAM_TYPE_FLOAT ? sizeof(float) : sizeof(double);
+            break;
+        default:
+            if (is_immediate_value(value)) {
+                /* 标量保存在参数槽中，按原始字节传递 / Scalars are kept in the parameter slot and passed as raw bytes / Skalare liegen im Parameterplatz und werden als Rohbytes übergeben */
+                memcpy(&typed_state->param_int_values[param_index], &value->as, sizeof(int64_t));
+                typed_state->param_values[param_index] = &typed_state->param_int_values[param_index];
+                typed_state->param_sizes[param_index] = value->size;
+            } else {
+                typed_state->param_values[param_index] = value->as.ptr;
+                typed_state->param_sizes[param_index] = value->size > 0 ? value->size : sizeof(void*);
+            }
+            break;
+    }
+    typed_state->param_ready[param_index] = 1;
+    log_stored_parameter(typed_state, param_index, param_type, plugin_name, interface_name);
+    return 1;
+}
+
+/**
+ * @brief 读取已设置参数的带类型值 / Read typed value of a stored parameter / Typisierten Wert eines gespeicherten Parameters lesen
+ * @param state 接口状态结构体指针 / Interface state structure pointer / Schnittstellenstatus-Struktur-Zeiger
+ * @param param_index 参数索引 / Parameter index / Parameterindex
+ * @return 标量复制为直接值，其余类型携带参数指针和大小 / Scalars are copied into an immediate value, other types carry the parameter pointer and size / Skalare werden in einen Direktwert kopiert, andere Typen tragen Parameterzeiger und Größe
+ */
+pt_typed_value_t get_parameter_typed_value(struct target_interface_state_s* state, int param_index) {
+    target_interface_state_t* typed_state = (target_interface_state_t*)state;
+    if (typed_state == NULL || param_index < 0 || param_index >= typed_state->param_count ||
+        typed_state->param_types == NULL || typed_state->param_values == NULL) {
+        return make_pointer_value(NULL, NXLD_PARAM_TYPE_POINTER, 0);
+    }
+    
+    nxld_param_type_t param_type = typed_state->param_types[param_index];
+    size_t param_size = typed_state->param_sizes != NULL ? typed_state->param_sizes[param_index] : 0;
+    pt_typed_value_t stored = make_pointer_value(typed_state->param_values[param_index], param_type, param_size);
+    if (!(stored.flags & PT_VALUE_FLAG_BY_REF)) {
+        return stored;
+    }
+    
+    int64_t int_value = 0;
+    double float_value = 0.0;
+    int kind = read_typed_value_number(&stored, param_type, &int_value, &float_value);
+    if (kind < 0) {
+        return stored;
+    }
+    pt_typed_value_t result = kind == 1 ? make_double_value(float_value) : make_int64_value(int_value);
+    result.type = (uint16_t)param_type;
+    return result;
+}
@@ -3,6 +3,11 @@
  * @brief 获取当前DLL文件路径函数 / Get current DLL file path function / Aktuellen DLL-Dateipfad abrufen Funktion
  */
 
+/* dladdr和Dl_info是GNU扩展 / dladdr and Dl_info are GNU extensions / dladdr und Dl_info sind GNU-Erweiterungen */
+#ifndef _WIN32
+#define _GNU_SOURCE
+#endif
+
 #include "pointer_transfer_utils.h"
 #include <string.h>
 
@@ -16,6 +16,22 @@ void free_single_rule(pointer_transfer_rule_t* rule) {
         return;
     }
     
+    /* 共享字符串随映射或内存区一起释放 / Shared strings are released with their mapping or arena / Gemeinsame Zeichenfolgen werden mit ihrer Zuordnung oder Arena freigegeben */
+    if (rule->strings_shared) {
+        rule->source_plugin = NULL;
+        rule->source_interface = NULL;
+        rule->target_plugin = NULL;
+        rule->target_plugin_path = NULL;
+        rule->target_interface = NULL;
+        rule->target_param_value = NULL;
+        rule->description = NULL;
+        rule->multicast_group = NULL;
+        rule->condition = NULL;
+        rule->set_group = NULL;
+        rule->strings_shared = 0;
+        return;
+    }
+    
     if (rule->source_plugin != NULL) {
         free(rule->source_plugin);
         rule->source_plugin = NULL;
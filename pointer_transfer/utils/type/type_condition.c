@@ -10,46 +10,48 @@
 /**
  * @brief 检查传递条件 / Check transfer condition / Übertragungsbedingung prüfen
  * @param condition 条件字符串 / Condition string / Bedingungszeichenfolge
- * @param param_value 参数值指针 / Parameter value pointer / Parameterwert-Zeiger
+ * @param value 传递的值 / Transferred value / Übertragener Wert
  * @return 满足条件返回1，否则返回0 / Returns 1 if condition is met, 0 otherwise / Gibt 1 zurück, wenn Bedingung erfüllt ist, sonst 0
+ * @details 直接携带的标量总是非空；数值比较按值自身的类型读取，未标注类型的指针按int读取 / Scalars carried directly are never null; numeric comparisons read the value by its own type, untyped pointers are read as int / Direkt getragene Skalare sind nie null; numerische Vergleiche lesen den Wert nach seinem eigenen Typ, untypisierte Zeiger als int
  */
-int check_condition(const char* condition, void* param_value) {
+int check_condition(const char* condition, const pt_typed_value_t* value) {
     if (condition == NULL || strlen(condition) == 0) {
         return 1;
     }
     
+    int64_t int_value = 0;
+    double float_value = 0.0;
+    int kind = read_typed_value_number(value, NXLD_PARAM_TYPE_INT32, &int_value, &float_value);
+    int is_null = !is_immediate_value(value) && (value == NULL || value->as.ptr == NULL);
+    int sign = kind == 1 ? (float_value > 0.0) - (float_value < 0.0) : (int_value > 0) - (int_value < 0);
+    
     if (strcmp(condition, "not_null") == 0) {
-        return (param_value != NULL) ? 1 : 0;
+        return is_null ? 0 : 1;
     }
     
     if (strcmp(condition, "null") == 0) {
-        return (param_value == NULL) ? 1 : 0;
+        return is_null ? 1 : 0;
     }
     
     if (strcmp(condition, ">0") == 0) {
-        if (param_value == NULL) return 0;
-        int* int_val = (int*)param_value;
-        return (*int_val > 0) ? 1 : 0;
+        if (is_null) return 0;
+        return (sign > 0) ? 1 : 0;
     }
     
     if (strcmp(condition, "<0") == 0) {
-        if (param_value == NULL) return 0;
-        int* int_val = (int*)param_value;
-        return (*int_val < 0) ? 1 : 0;
+        if (is_null) return 0;
+        return (sign < 0) ? 1 : 0;
     }
     
     if (strcmp(condition, "==0") == 0 || strcmp(condition, "=0") == 0) {
-        if (param_value == NULL) return 1;
-        int* int_val = (int*)param_value;
-        return (*int_val == 0) ? 1 : 0;
+        if (is_null) return 1;
+        return (sign == 0) ? 1 : 0;
     }
     
     if (strcmp(condition, "!=0") == 0) {
-        if (param_value == NULL) return 0;
-        int* int_val = (int*)param_value;
-        return (*int_val != 0) ? 1 : 0;
+        if (is_null) return 0;
+        return (sign != 0) ? 1 : 0;
     }
     
     return 1;
 }
-
@@ -114,6 +114,78 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL nxld_plugin_get_interface_param_info
                                                               nxld_param_type_t* param_type,
                                                               char* type_name, size_t type_name_size);
 
+/**
+ * @brief 返回值类型枚举（用于插件描述符） / Return type enumeration (for plugin descriptors) / Rückgabetyp-Aufzählung (für Plugin-Deskriptoren)
+ */
+typedef enum {
+    NXLD_RETURN_TYPE_VOID = 0,             /**< 无返回值 / no return value / kein Rückgabewert */
+    NXLD_RETURN_TYPE_INT32,                /**< int32_t返回值 / int32_t return value / int32_t-Rückgabewert */
+    NXLD_RETURN_TYPE_INT64,                /**< int64_t返回值 / int64_t return value / int64_t-Rückgabewert */
+    NXLD_RETURN_TYPE_FLOAT,                /**< float返回值 / float return value / float-Rückgabewert */
+    NXLD_RETURN_TYPE_DOUBLE,               /**< double返回值 / double return value / double-Rückgabewert */
+    NXLD_RETURN_TYPE_POINTER,              /**< 指针返回值 / pointer return value / Zeiger-Rückgabewert */
+    NXLD_RETURN_TYPE_STRING,               /**< 字符串指针返回值 / string pointer return value / Zeichenfolgenzeiger-Rückgabewert */
+    NXLD_RETURN_TYPE_STRUCT                /**< 按值返回的结构体（大小见return_size） / struct returned by value (size in return_size) / als Wert zurückgegebene Struktur (Größe in return_size) */
+} nxld_return_type_t;
+
+/**
+ * @brief 接口调用约定 / Interface calling convention / Aufrufkonvention der Schnittstellen
+ */
+typedef enum {
+    NXLD_CALL_CONVENTION_PACK = 0,         /**< 接口接收一个参数包指针 / Interfaces take one parameter pack pointer / Schnittstellen erhalten einen Parameterpaket-Zeiger */
+    NXLD_CALL_CONVENTION_NATIVE            /**< 接口按param_types声明的C签名直接调用 / Interfaces are called directly with the C signature declared by param_types / Schnittstellen werden direkt mit der durch param_types deklarierten C-Signatur aufgerufen */
+} nxld_call_convention_t;
+
+/* 参数包格式版本 / Parameter pack format versions / Formatversionen des Parameterpakets */
+#define NXLD_PACK_VERSION_1 1
+#define NXLD_PACK_VERSION_2 2
+
+/*
+ * 可选导出的数据符号，声明插件接受的最高参数包版本；未导出时使用版本1。
+ * Optional exported data symbol declaring the highest parameter pack version the plugin accepts; version 1 is used when it is not exported.
+ * Optional exportiertes Datensymbol, das die höchste vom Plugin akzeptierte Parameterpaket-Version angibt; ohne Export wird Version 1 verwendet.
+ *   NXLD_PLUGIN_EXPORT const uint32_t nxld_plugin_pack_version = NXLD_PACK_VERSION_2;
+ */
+#define NXLD_PLUGIN_PACK_VERSION_SYMBOL "nxld_plugin_pack_version"
+
+/* 插件描述符格式版本（版本1没有call_convention字段） / Plugin descriptor format version (version 1 has no call_convention field) / Formatversion des Plugin-Deskriptors (Version 1 hat kein call_convention-Feld) */
+#define NXLD_PLUGIN_DESCRIPTOR_VERSION 2
+
+/**
+ * @brief 接口描述符 / Interface descriptor / Schnittstellendeskriptor
+ */
+typedef struct {
+    const char* name;                      /**< 接口名称（即导出符号名） / Interface name (the exported symbol name) / Schnittstellenname (der exportierte Symbolname) */
+    const char* description;               /**< 接口描述 / Interface description / Schnittstellenbeschreibung */
+    const char* version;                   /**< 接口版本 / Interface version / Schnittstellenversion */
+    void* func_ptr;                        /**< 接口函数指针 / Interface function pointer / Schnittstellen-Funktionszeiger */
+    nxld_return_type_t return_type;        /**< 返回值类型 / Return type / Rückgabetyp */
+    size_t return_size;                    /**< 返回值大小（字节） / Return value size (bytes) / Rückgabewertgröße (Bytes) */
+    nxld_param_count_type_t param_count_type; /**< 参数数量类型 / Parameter count type / Parameteranzahl-Typ */
+    int32_t min_param_count;               /**< 最小参数数量 / Minimum parameter count / Mindestparameteranzahl */
+    int32_t max_param_count;               /**< 最大参数数量（可变数量无上限时为-1） / Maximum parameter count (-1 when variable without limit) / Maximalparameteranzahl (-1 bei variabler Anzahl ohne Grenze) */
+    const nxld_param_type_t* param_types;  /**< 参数类型数组（max_param_count项，无上限时min_param_count项） / Parameter type array (max_param_count entries, min_param_count when unlimited) / Parametertyp-Array (max_param_count Einträge, min_param_count wenn unbegrenzt) */
+} nxld_interface_descriptor_t;
+
+/**
+ * @brief 插件描述符 / Plugin descriptor / Plugin-Deskriptor
+ */
+typedef struct {
+    uint32_t descriptor_version;           /**< 描述符格式版本（NXLD_PLUGIN_DESCRIPTOR_VERSION） / Descriptor format version (NXLD_PLUGIN_DESCRIPTOR_VERSION) / Deskriptor-Formatversion (NXLD_PLUGIN_DESCRIPTOR_VERSION) */
+    const char* plugin_name;               /**< 插件名称 / Plugin name / Plugin-Name */
+    const char* plugin_version;            /**< 插件版本 / Plugin version / Plugin-Version */
+    size_t interface_count;                /**< 接口数量 / Interface count / Schnittstellenanzahl */
+    const nxld_interface_descriptor_t* interfaces; /**< 接口描述符数组 / Interface descriptor array / Schnittstellendeskriptor-Array */
+    nxld_call_convention_t call_convention; /**< 所有接口的调用约定 / Calling convention of all interfaces / Aufrufkonvention aller Schnittstellen */
+} nxld_plugin_descriptor_t;
+
+/**
+ * @brief 获取插件描述符（可选导出） / Get plugin descriptor (optional export) / Plugin-Deskriptor abrufen (optionaler Export)
+ * @return 插件生命周期内有效的静态描述符，不支持时返回NULL / Static descriptor valid for the plugin's lifetime, NULL if unsupported / Statischer Deskriptor, gültig während der Plugin-Lebensdauer, NULL wenn nicht unterstützt
+ * @note 一次调用提供全部接口元数据；未导出时加载器逐项调用上面的查询函数 / Provides all interface metadata in one call; loaders query the functions above one by one when it is not exported / Liefert alle Schnittstellen-Metadaten mit einem Aufruf; ohne Export fragen Lader die obigen Funktionen einzeln ab
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void);
+
 #ifdef __cplusplus
 }
 #endif
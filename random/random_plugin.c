@@ -447,3 +447,183 @@ NXLD_PLUGIN_EXPORT double NXLD_PLUGIN_CALL RandomDouble(void* pack_ptr) {
     return min + ((double)rand() / (double)RAND_MAX) * range;
 }
 
+/**
+ * @brief 取批量调用第row行的参数包 / Build the parameter pack of one batch row / Parameterpaket einer Batch-Zeile bilden
+ * @param batch 批量调用 / Batch call / Batch-Aufruf
+ * @param row 行号 / Row index / Zeilenindex
+ * @param params 至少两个元素的参数数组 / Parameter array with at least two elements / Parameter-Array mit mindestens zwei Elementen
+ * @param pack 输出参数包 / Output parameter pack / Ausgabe-Parameterpaket
+ */
+static void load_batch_row(const pt_batch_t* batch, uint32_t row, pt_curried_param_t* params, pt_param_pack_t* pack) {
+    int count = batch->param_count > 2 ? 2 : (int)batch->param_count;
+    for (int i = 0; i < count; i++) {
+        params[i].type = (nxld_param_type_t)batch->types[i];
+        params[i].size = batch->sizes[i];
+        params[i].value = batch->columns[i][row];
+    }
+    pack->param_count = count;
+    pack->params = params;
+}
+
+/**
+ * @brief 检查批量调用结构 / Check the batch call structure / Struktur des Batch-Aufrufs prüfen
+ */
+static int batch_is_valid(const pt_batch_t* batch) {
+    if (batch == NULL || batch->results == NULL) {
+        return 0;
+    }
+    return batch->param_count == 0 || (batch->types != NULL && batch->sizes != NULL && batch->columns != NULL);
+}
+
+/**
+ * @brief 批量生成随机 int32 / Generate random int32 values in batch / Zufällige int32-Werte im Stapel generieren
+ * @param batch 批量调用，结果写入int64_val / Batch call, results are written to int64_val / Batch-Aufruf, Ergebnisse werden nach int64_val geschrieben
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL RandomInt32_Vec(const pt_batch_t* batch) {
+    if (!batch_is_valid(batch)) {
+        return -1;
+    }
+    
+    pt_curried_param_t params[2];
+    pt_param_pack_t pack;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        load_batch_row(batch, row, params, &pack);
+        batch->results[row].int64_val = RandomInt32(&pack);
+    }
+    return 0;
+}
+
+/**
+ * @brief 批量生成随机 int64 / Generate random int64 values in batch / Zufällige int64-Werte im Stapel generieren
+ * @param batch 批量调用，结果写入int64_val / Batch call, results are written to int64_val / Batch-Aufruf, Ergebnisse werden nach int64_val geschrieben
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL RandomInt64_Vec(const pt_batch_t* batch) {
+    if (!batch_is_valid(batch)) {
+        return -1;
+    }
+    
+    pt_curried_param_t params[2];
+    pt_param_pack_t pack;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        load_batch_row(batch, row, params, &pack);
+        batch->results[row].int64_val = RandomInt64(&pack);
+    }
+    return 0;
+}
+
+/**
+ * @brief 批量生成随机 float / Generate random float values in batch / Zufällige float-Werte im Stapel generieren
+ * @param batch 批量调用，结果写入float_val / Batch call, results are written to float_val / Batch-Aufruf, Ergebnisse werden nach float_val geschrieben
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL RandomFloat_Vec(const pt_batch_t* batch) {
+    if (!batch_is_valid(batch)) {
+        return -1;
+    }
+    
+    pt_curried_param_t params[2];
+    pt_param_pack_t pack;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        load_batch_row(batch, row, params, &pack);
+        batch->results[row].float_val = RandomFloat(&pack);
+    }
+    return 0;
+}
+
+/**
+ * @brief 批量生成随机 double / Generate random double values in batch / Zufällige double-Werte im Stapel generieren
+ * @param batch 批量调用，结果写入double_val / Batch call, results are written to double_val / Batch-Aufruf, Ergebnisse werden nach double_val geschrieben
+ * @return 成功返回0，失败返回-1 / Returns 0 on success, -1 on failure / Gibt 0 bei Erfolg zurück, -1 bei Fehler
+ */
+NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL RandomDouble_Vec(const pt_batch_t* batch) {
+    if (!batch_is_valid(batch)) {
+        return -1;
+    }
+    
+    pt_curried_param_t params[2];
+    pt_param_pack_t pack;
+    for (uint32_t row = 0; row < batch->count; row++) {
+        load_batch_row(batch, row, params, &pack);
+        batch->results[row].double_val = RandomDouble(&pack);
+    }
+    return 0;
+}
+
+
+/* 随机数接口参数类型（min, max） / Random interface parameter types (min, max) / Parametertypen der Zufallsschnittstellen (min, max) */
+static const nxld_param_type_t random_int32_param_types[] = { NXLD_PARAM_TYPE_INT32, NXLD_PARAM_TYPE_INT32 };
+static const nxld_param_type_t random_int64_param_types[] = { NXLD_PARAM_TYPE_INT64, NXLD_PARAM_TYPE_INT64 };
+static const nxld_param_type_t random_float_param_types[] = { NXLD_PARAM_TYPE_FLOAT, NXLD_PARAM_TYPE_FLOAT };
+static const nxld_param_type_t random_double_param_types[] = { NXLD_PARAM_TYPE_DOUBLE, NXLD_PARAM_TYPE_DOUBLE };
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "RandomInt32",
+        "Generate random int32 (optional: min, max), returns int32",
+        "1.0.0",
+        (void*)RandomInt32,
+        NXLD_RETURN_TYPE_INT32,
+        0,
+        NXLD_PARAM_COUNT_VARIABLE,
+        0,
+        2,
+        random_int32_param_types
+    },
+    {
+        "RandomInt64",
+        "Generate random int64 (optional: min, max), returns int64",
+        "1.0.0",
+        (void*)RandomInt64,
+        NXLD_RETURN_TYPE_INT64,
+        0,
+        NXLD_PARAM_COUNT_VARIABLE,
+        0,
+        2,
+        random_int64_param_types
+    },
+    {
+        "RandomFloat",
+        "Generate random float (optional: min, max), returns float",
+        "1.0.0",
+        (void*)RandomFloat,
+        NXLD_RETURN_TYPE_FLOAT,
+        0,
+        NXLD_PARAM_COUNT_VARIABLE,
+        0,
+        2,
+        random_float_param_types
+    },
+    {
+        "RandomDouble",
+        "Generate random double (optional: min, max), returns double",
+        "1.0.0",
+        (void*)RandomDouble,
+        NXLD_RETURN_TYPE_DOUBLE,
+        0,
+        NXLD_PARAM_COUNT_VARIABLE,
+        0,
+        2,
+        random_double_param_types
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_PACK
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ * @return 静态描述符，一次调用提供全部接口元数据 / Static descriptor providing all interface metadata in one call / Statischer Deskriptor, der alle Schnittstellen-Metadaten mit einem Aufruf liefert
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}
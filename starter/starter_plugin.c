@@ -172,3 +172,36 @@ NXLD_PLUGIN_EXPORT int32_t NXLD_PLUGIN_CALL Start(void* pack_ptr) {
     return 0;
 }
 
+
+/* 接口描述符表 / Interface descriptor table / Schnittstellendeskriptor-Tabelle */
+static const nxld_interface_descriptor_t interface_descriptors[INTERFACE_COUNT] = {
+    {
+        "Start",
+        "Start execution chain (no parameters), returns int32 (0=success, -1=failure)",
+        "1.0.0",
+        (void*)Start,
+        NXLD_RETURN_TYPE_INT32,
+        0,
+        NXLD_PARAM_COUNT_FIXED,
+        0,
+        0,
+        NULL
+    }
+};
+
+/* 插件描述符 / Plugin descriptor / Plugin-Deskriptor */
+static const nxld_plugin_descriptor_t plugin_descriptor = {
+    NXLD_PLUGIN_DESCRIPTOR_VERSION,
+    PLUGIN_NAME,
+    PLUGIN_VERSION,
+    INTERFACE_COUNT,
+    interface_descriptors,
+    NXLD_CALL_CONVENTION_PACK
+};
+
+/**
+ * @brief 获取插件描述符 / Get plugin descriptor / Plugin-Deskriptor abrufen
+ */
+NXLD_PLUGIN_EXPORT const nxld_plugin_descriptor_t* NXLD_PLUGIN_CALL nxld_plugin_get_descriptor(void) {
+    return &plugin_descriptor;
+}